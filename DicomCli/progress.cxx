@@ -27,6 +27,7 @@ void ProgressObserver::Execute(vtkObject *, unsigned long e, void *vp)
     this->LastTime = t;
     this->Stage = 0;
     this->Anim = 0;
+    this->LastProgress = -1;
     }
   else if (e == vtkCommand::ProgressEvent)
     {
@@ -53,11 +54,13 @@ void ProgressObserver::Execute(vtkObject *, unsigned long e, void *vp)
           std::cout.flush();
           this->LastTime = t;
           }
-        else
+        else if (progress != this->LastProgress)
           {
+          // skip the update if the percentage has not changed
           std::cout << "\r" << this->Text << " " << progress << "%";
           std::cout.flush();
           this->LastTime = t;
+          this->LastProgress = progress;
           }
         }
       }
@@ -26,11 +26,13 @@ public:
     vtkObject *caller, unsigned long eventId, void *callData);
   void SetText(const char *text) { this->Text = text; }
 protected:
-  ProgressObserver() : Stage(0), Anim(0), LastTime(0), Text("") {}
+  ProgressObserver() :
+    Stage(0), Anim(0), LastProgress(-1), LastTime(0), Text("") {}
   ProgressObserver(const ProgressObserver& c) : vtkCommand(c) {}
   void operator=(const ProgressObserver&) {}
   int Stage;
   int Anim;
+  int LastProgress;
   double LastTime;
   const char *Text;
 };
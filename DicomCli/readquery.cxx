@@ -23,6 +23,8 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
+#include <utility>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -57,10 +59,38 @@ vtkDICOMTagPath path_append(const vtkDICOMTagPath& tpath, vtkDICOMTag tag)
   return result;
 }
 
+// The key lines of a query file, with their line numbers
+typedef std::vector<std::pair<int, std::string> > QueryLineList;
+
 // Read a query file
 bool dicomcli_readquery(
   const char *fname, vtkDICOMItem *query, QueryTagList *ql)
 {
+  // Cache the key lines of each query file that is read, so that if the
+  // same file is read again within the same process, the filesystem does
+  // not have to be touched a second time.  The lines are cached, rather
+  // than the parsed tags and values, because the parsing of each line can
+  // depend on what is already in the caller's query (e.g. the resolution
+  // of private tags), so a pre-parsed representation could not simply be
+  // merged without changing the result.
+  static std::map<std::string, QueryLineList> cache;
+
+  std::map<std::string, QueryLineList>::iterator it = cache.find(fname);
+  if (it != cache.end())
+    {
+    // replay the cached lines instead of re-reading the file
+    const QueryLineList& lines = it->second;
+    for (size_t i = 0; i < lines.size(); i++)
+      {
+      if (!dicomcli_readkey_query(lines[i].second.c_str(), query, ql, true))
+        {
+        fprintf(stderr, "Error %s line %d:\n", fname, lines[i].first);
+        return false;
+        }
+      }
+    return true;
+    }
+
 #ifdef _WIN32
   int cn = MultiByteToWideChar(CP_UTF8, 0, fname, -1, NULL, 0);
   wchar_t *wfname = new wchar_t[cn];
@@ -83,6 +113,7 @@ bool dicomcli_readquery(
   // [PRIVATE_CREATOR]GGGG,EEEE # private tag with creator name
   // GGGG,EEEE\GGGG,EEEE         # a tag nested within a sequence
 
+  QueryLineList lines;
   int lineNumber = 0;
   while (f.good())
     {
@@ -110,8 +141,13 @@ bool dicomcli_readquery(
       fprintf(stderr, "Error %s line %d:\n", fname, lineNumber);
       return false;
       }
+
+    lines.push_back(std::make_pair(lineNumber, line));
     }
 
+  // only files that were read without error are cached
+  cache[fname] = lines;
+
   return true;
 }
 
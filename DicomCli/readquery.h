@@ -27,7 +27,8 @@ typedef std::vector<vtkDICOMTagPath> QueryTagList;
  *  attribute values.  If the ordering within the file is important,
  *  then a QueryTagList can also be provided.  The tags will be pushed
  *  onto the QueryTagList in the same order as they are encountered in
- *  the file.
+ *  the file.  Files that have been successfully read are cached, so
+ *  reading the same file again will not access the filesystem.
  */
 bool dicomcli_readquery(
   const char *fname, vtkDICOMItem *query, QueryTagList *ql=0);
@@ -0,0 +1,497 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDICOMConfig.h"
+#include "vtkDICOMDictionary.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMFilePath.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMValue.h"
+
+// from dicomcli
+#include "vtkConsoleOutputWindow.h"
+#include "mainmacro.h"
+
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// remove path portion of filename
+const char *fileBasename(const char *filename)
+{
+  const char *cp = filename + strlen(filename);
+  while (cp != filename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  return cp;
+}
+
+// print the version
+void dicomcheck_version(FILE *file, const char *cp)
+{
+  fprintf(file, "%s %s\n", cp, DICOM_VERSION);
+  fprintf(file, "\n"
+    "Copyright (c) 2012-2016, David Gobbi.\n\n"
+    "This software is distributed under an open-source license.  See the\n"
+    "Copyright.txt file that comes with the vtk-dicom source distribution.\n");
+}
+
+// print the usage
+void dicomcheck_usage(FILE *file, const char *cp)
+{
+  fprintf(file, "usage:\n"
+    "  %s [options] <directory> ...\n\n", cp);
+  fprintf(file, "options:\n"
+    "  -j n            Set the number of verification threads.\n"
+    "  -L              Follow symbolic links (default).\n"
+    "  -P              Do not follow symbolic links.\n"
+    "  --input-list f  Read the files and directories to check from f.\n"
+    "  --help          Print a brief help message.\n"
+    "  --version       Print the software version.\n");
+}
+
+// print the help
+void dicomcheck_help(FILE *file, const char *cp)
+{
+  dicomcheck_usage(file, cp);
+  fprintf(file, "\n"
+    "Verify that the DICOM files in an archive are readable.  Every file\n"
+    "is parsed from beginning to end so that the structure of the data\n"
+    "set is checked, but the element values are skipped over rather than\n"
+    "decoded.  The length of the PixelData is compared against the size\n"
+    "that is advertised by Rows, Columns, BitsAllocated, SamplesPerPixel\n"
+    "and NumberOfFrames, and the file size is checked to ensure that the\n"
+    "pixel data is not cut short.  Files that are not DICOM are counted,\n"
+    "but are not treated as failures.\n"
+    "\n"
+    "Each failure is reported on a line of its own, and a one-line\n"
+    "summary is printed at the end.  The files are checked by a pool of\n"
+    "worker threads (one per processor core, unless \'-j\' says otherwise)\n"
+    "so that a full audit of an archive can saturate the storage device.\n"
+    "The exit code is 1 if any file failed the check.\n\n");
+}
+
+// read a list of files and directories from a text file
+bool dicomcheck_readfilelist(const char *fname, vtkStringArray *a)
+{
+#ifdef _WIN32
+  int cn = MultiByteToWideChar(CP_UTF8, 0, fname, -1, NULL, 0);
+  wchar_t *wfname = new wchar_t[cn];
+  MultiByteToWideChar(CP_UTF8, 0, fname, -1, wfname, cn);
+  std::ifstream f(wfname);
+  delete [] wfname;
+#else
+  std::ifstream f(fname);
+#endif
+  if (!f.good())
+    {
+    return false;
+    }
+
+  while (f.good())
+    {
+    std::string line;
+    std::getline(f, line);
+    const char *cp = line.c_str();
+    size_t n = line.size();
+
+    // strip leading whitespace
+    size_t s = 0;
+    while (s < n && isspace(cp[s]))
+      {
+      s++;
+      }
+
+    // strip trailing whitespace
+    while (n > s && isspace(cp[n-1]))
+      {
+      n--;
+      }
+
+    // skip blank lines and comments
+    if (n > s && cp[s] != '#')
+      {
+      a->InsertNextValue(line.substr(s, n-s));
+      }
+    }
+
+  return true;
+}
+
+// recursively collect all of the files in a directory
+void dicomcheck_scandir(
+  const char *dirname, vtkStringArray *files, bool followSymlinks)
+{
+  vtkDICOMFileDirectory d(dirname);
+  if (d.GetError() != 0)
+    {
+    fprintf(stderr, "Could not read directory %s\n", dirname);
+    return;
+    }
+
+  vtkDICOMFilePath path(dirname);
+  int n = d.GetNumberOfFiles();
+  for (int i = 0; i < n; i++)
+    {
+    const char *fname = d.GetFile(i);
+    if ((fname[0] != '.' || (fname[1] != '\0' &&
+         (fname[1] != '.' || fname[2] != '\0'))) &&
+        strcmp(fname, "DICOMDIR") != 0)
+      {
+      path.PushBack(fname);
+      std::string fileString = path.AsString();
+      path.PopBack();
+      if (!followSymlinks && d.IsSymlink(i))
+        {
+        // Do nothing unless symlinks are being followed
+        }
+      else if (d.IsDirectory(i))
+        {
+        dicomcheck_scandir(fileString.c_str(), files, followSymlinks);
+        }
+      else
+        {
+        files->InsertNextValue(fileString);
+        }
+      }
+    }
+}
+
+// the possible outcomes of checking one file
+enum
+{
+  CHECK_GOOD,
+  CHECK_NOT_DICOM,
+  CHECK_FAILED
+};
+
+// check one file, and describe any failure in "message"
+int dicomcheck_verify(
+  vtkDICOMParser *parser, vtkDICOMMetaData *meta,
+  const char *fileName, std::string *message)
+{
+  if (!vtkDICOMUtilities::IsDICOMFile(fileName))
+    {
+    return CHECK_NOT_DICOM;
+    }
+
+  meta->Initialize();
+  parser->SetFileName(fileName);
+  parser->Update();
+
+  if (parser->GetErrorCode() != 0)
+    {
+    if (parser->GetNumberOfConditions() > 0)
+      {
+      *message = parser->GetConditionMessage(0);
+      }
+    else
+      {
+      *message = "Could not read file ";
+      *message += fileName;
+      }
+    return CHECK_FAILED;
+    }
+
+  if (parser->GetPixelDataFound())
+    {
+    // compare the advertised image dimensions against the actual
+    // size of the pixel data
+    long long rows = meta->GetAttributeValue(DC::Rows).AsInt();
+    long long cols = meta->GetAttributeValue(DC::Columns).AsInt();
+    long long bits = meta->GetAttributeValue(DC::BitsAllocated).AsInt();
+    long long spp = meta->GetAttributeValue(DC::SamplesPerPixel).AsInt();
+    long long frames = meta->GetAttributeValue(DC::NumberOfFrames).AsInt();
+    spp = (spp > 0 ? spp : 1);
+    frames = (frames > 0 ? frames : 1);
+    long long expected = (rows*cols*spp*bits + 7)/8*frames;
+    expected += (expected & 1); // the value length is padded to even
+
+    unsigned int vl = parser->GetPixelDataVL();
+    long long remaining = parser->GetFileSize() - parser->GetFileOffset();
+    char text[256];
+
+    if (vl == 0xffffffffu)
+      {
+      // encapsulated (compressed) data: the frame lengths cannot be
+      // computed from the dimensions, just check that data is present
+      if (remaining <= 0)
+        {
+        *message = "File ends before the encapsulated PixelData: ";
+        *message += fileName;
+        return CHECK_FAILED;
+        }
+      }
+    else if (remaining < static_cast<long long>(vl))
+      {
+      sprintf(text, "PixelData is cut short, %lld of %u bytes: ",
+              remaining, vl);
+      *message = text;
+      *message += fileName;
+      return CHECK_FAILED;
+      }
+    else if (rows*cols != 0 && static_cast<long long>(vl) != expected)
+      {
+      sprintf(text, "PixelData length %u, but dimensions give %lld: ",
+              vl, expected);
+      *message = text;
+      *message += fileName;
+      return CHECK_FAILED;
+      }
+    }
+
+  return CHECK_GOOD;
+}
+
+// the state that is shared by all of the verification threads
+struct dicomcheck_workinfo
+{
+  vtkStringArray *Files;
+  vtkDICOMItem *Query;
+  vtkIdType NextIndex; // guarded by Lock
+  vtkSimpleCriticalSection Lock;
+  long long Good;      // counters and output, guarded by ReportLock
+  long long NotDICOM;
+  long long Failed;
+  vtkSimpleCriticalSection ReportLock;
+};
+
+// the method that is run by each of the verification threads
+VTK_THREAD_RETURN_TYPE dicomcheck_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicomcheck_workinfo *info =
+    static_cast<dicomcheck_workinfo *>(ti->UserData);
+
+  // each worker parses with its own parser and metadata object,
+  // claiming files from the shared list until none remain
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetMetaData(meta);
+  parser->SetQueryItem(*info->Query);
+  parser->DeferErrorReportingOn();
+
+  vtkIdType numberOfFiles = info->Files->GetNumberOfValues();
+
+  for (;;)
+    {
+    info->Lock.Lock();
+    vtkIdType k = info->NextIndex++;
+    info->Lock.Unlock();
+    if (k >= numberOfFiles)
+      {
+      break;
+      }
+
+    const std::string& fileName = info->Files->GetValue(k);
+    std::string message;
+    int outcome = dicomcheck_verify(
+      parser, meta, fileName.c_str(), &message);
+
+    info->ReportLock.Lock();
+    if (outcome == CHECK_GOOD)
+      {
+      info->Good++;
+      }
+    else if (outcome == CHECK_NOT_DICOM)
+      {
+      info->NotDICOM++;
+      }
+    else
+      {
+      info->Failed++;
+      fprintf(stdout, "%s\n", message.c_str());
+      }
+    info->ReportLock.Unlock();
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// This program will check the files of a DICOM archive for readability
+int MAINMACRO(int argc, char *argv[])
+{
+  // redirect all VTK errors to stderr
+  vtkConsoleOutputWindow::Install();
+
+  // silence the warnings that the parsers would generate
+  vtkObject::SetGlobalWarningDisplay(0);
+
+  int rval = 0;
+  int threads = 0;
+  bool followSymlinks = true;
+
+  if (argc < 2)
+    {
+    dicomcheck_usage(stdout, fileBasename(argv[0]));
+    return rval;
+    }
+  else if (argc == 2 && strcmp(argv[1], "--help") == 0)
+    {
+    dicomcheck_help(stdout, fileBasename(argv[0]));
+    return rval;
+    }
+  else if (argc == 2 && strcmp(argv[1], "--version") == 0)
+    {
+    dicomcheck_version(stdout, fileBasename(argv[0]));
+    return rval;
+    }
+
+  vtkSmartPointer<vtkStringArray> entries =
+    vtkSmartPointer<vtkStringArray>::New();
+
+  for (int argi = 1; argi < argc; argi++)
+    {
+    const char *arg = argv[argi];
+    if (strcmp(arg, "-j") == 0)
+      {
+      if (argi + 1 == argc || argv[argi+1][0] == '-')
+        {
+        fprintf(stderr, "%s must be followed by a number.\n\n", arg);
+        return 1;
+        }
+      threads = static_cast<int>(strtol(argv[++argi], 0, 10));
+      }
+    else if (strcmp(arg, "-L") == 0)
+      {
+      followSymlinks = true;
+      }
+    else if (strcmp(arg, "-P") == 0)
+      {
+      followSymlinks = false;
+      }
+    else if (strcmp(arg, "--input-list") == 0)
+      {
+      if (argi + 1 == argc || argv[argi+1][0] == '-')
+        {
+        fprintf(stderr, "%s must be followed by a file.\n\n", arg);
+        return 1;
+        }
+      const char *lfile = argv[++argi];
+      if (!dicomcheck_readfilelist(lfile, entries))
+        {
+        fprintf(stderr, "Error: Can't read file list %s\n\n", lfile);
+        return 1;
+        }
+      }
+    else if (arg[0] == '-')
+      {
+      fprintf(stderr, "unrecognized option %s.\n\n", arg);
+      dicomcheck_usage(stderr, fileBasename(argv[0]));
+      return 1;
+      }
+    else
+      {
+      entries->InsertNextValue(arg);
+      }
+    }
+
+  // expand the directories into their files
+  vtkSmartPointer<vtkStringArray> files =
+    vtkSmartPointer<vtkStringArray>::New();
+  for (vtkIdType i = 0; i < entries->GetNumberOfValues(); i++)
+    {
+    const std::string& entry = entries->GetValue(i);
+    int code = vtkDICOMFile::Access(entry.c_str(), vtkDICOMFile::In);
+    if (code == vtkDICOMFile::FileIsDirectory)
+      {
+      dicomcheck_scandir(entry.c_str(), files, followSymlinks);
+      }
+    else
+      {
+      files->InsertNextValue(entry);
+      }
+    }
+
+  if (files->GetNumberOfValues() == 0)
+    {
+    fprintf(stderr, "No files were found.\n");
+    return 1;
+    }
+
+  // the query makes the parser sweep the structure of each file
+  // while skipping the values of all other elements, so nothing is
+  // decoded except the attributes used for the pixel data check
+  vtkDICOMItem query;
+  static const DC::EnumType queryElements[] = {
+    DC::SpecificCharacterSet,
+    DC::Rows,
+    DC::Columns,
+    DC::BitsAllocated,
+    DC::SamplesPerPixel,
+    DC::NumberOfFrames,
+    DC::ItemDelimitationItem
+  };
+  for (const DC::EnumType *tagPtr = queryElements;
+       *tagPtr != DC::ItemDelimitationItem;
+       ++tagPtr)
+    {
+    vtkDICOMVR vr = query.FindDictVR(*tagPtr);
+    query.SetAttributeValue(*tagPtr, vtkDICOMValue(vr));
+    }
+
+  dicomcheck_workinfo workInfo;
+  workInfo.Files = files;
+  workInfo.Query = &query;
+  workInfo.NextIndex = 0;
+  workInfo.Good = 0;
+  workInfo.NotDICOM = 0;
+  workInfo.Failed = 0;
+
+  // deal the files out to a pool of verification threads
+  vtkSmartPointer<vtkMultiThreader> threader =
+    vtkSmartPointer<vtkMultiThreader>::New();
+  if (threads > 0)
+    {
+    threader->SetNumberOfThreads(threads);
+    }
+  if (threader->GetNumberOfThreads() >
+      static_cast<int>(files->GetNumberOfValues()))
+    {
+    threader->SetNumberOfThreads(
+      static_cast<int>(files->GetNumberOfValues()));
+    }
+  threader->SetSingleMethod(dicomcheck_thread, &workInfo);
+  threader->SingleMethodExecute();
+
+  fprintf(stdout, "%lld files checked: %lld good, %lld not DICOM, "
+          "%lld failed\n",
+          workInfo.Good + workInfo.NotDICOM + workInfo.Failed,
+          workInfo.Good, workInfo.NotDICOM, workInfo.Failed);
+
+  if (workInfo.Failed > 0)
+    {
+    rval = 1;
+    }
+
+  return rval;
+}
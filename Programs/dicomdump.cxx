@@ -505,6 +505,15 @@ int MAINMACRO(int argc, char *argv[])
     vtkSmartPointer<vtkDICOMMetaData>::New();
   parser->SetMetaData(data);
 
+  if (query.GetNumberOfDataElements() > 0)
+    {
+    // only parse the elements that are going to be printed: the parser
+    // will skip the values of all other elements, and will stop reading
+    // the file as soon as the last queried group has been passed
+    parser->SetQueryItem(query);
+    parser->StopAtQueryEndOn();
+    }
+
   int m = sorter->GetNumberOfStudies();
   for (int j = 0; j < m; j++)
     {
@@ -70,6 +70,7 @@ void dicomfind_usage(FILE *file, const char *cp)
     "  -u <uids.txt>   Provide a file that contains a list of UIDs.\n"
     "  -maxdepth n     Set the maximum directory depth.\n"
     "  -name pattern   Set a pattern to match (with \"*\" or \"?\").\n"
+    "  -index <file>   Resolve the query through a persistent index file.\n"
     "  -image          Restrict the search to files with PixelData.\n"
     "  -series         Find all files in series if even one file matches.\n"
     "  -print          Print the filenames of all matched files (default).\n"
@@ -112,7 +113,16 @@ void dicomfind_help(FILE *file, const char *cp)
     "program will be run on each DICOM series and {} will be replaced by all\n"
     "files in the series.  The \"-execdir\" argument is similar, except that\n"
     "it runs the program from within the directory of the file (or files),\n"
-    "and {} is replaced by just the filenames instead of with the full paths.\n\n");
+    "and {} is replaced by just the filenames instead of with the full paths.\n"
+    "\n"
+    "The \"-index\" argument names a persistent index file that was written\n"
+    "by a previous scan (see vtkDICOMDirectory::SetIndexFileName).  When\n"
+    "the query constrains PatientID, StudyDate, Modality, or\n"
+    "SeriesInstanceUID, the candidate files are found through the index\n"
+    "instead of by walking the directory tree.  For any other queried\n"
+    "attribute, including private tags, the per-file tag presence\n"
+    "filters in the index narrow the scan to the files that might\n"
+    "contain the attribute, so only those files are opened.\n\n");
 
 }
 
@@ -569,6 +579,7 @@ int MAINMACRO(int argc, char *argv[])
   vtkDICOMItem query;
   bool requirePixelData = false;
   bool findSeries = false;
+  const char *indexFile = 0;
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
 
@@ -673,6 +684,16 @@ int MAINMACRO(int argc, char *argv[])
         }
       pattern = argv[argi];
       }
+    else if (strcmp(arg, "-index") == 0)
+      {
+      ++argi;
+      if (argi == argc)
+        {
+        fprintf(stderr, "%s must be followed by an argument.\n\n", arg);
+        return 1;
+        }
+      indexFile = argv[argi];
+      }
     else if (strcmp(arg, "-image") == 0)
       {
       requirePixelData = true;
@@ -733,6 +754,62 @@ int MAINMACRO(int argc, char *argv[])
   // Remember the current directory
   std::string originalDir = dicomfind_getcwd();
 
+  // Use the secondary indexes of an index file to turn the query into
+  // a candidate file list, instead of walking the directory tree.  The
+  // full query is still applied to the candidates by the finder.
+  if (indexFile)
+    {
+    static const DC::EnumType indexedTags[] = {
+      DC::PatientID, DC::StudyDate, DC::Modality,
+      DC::SeriesInstanceUID, DC::ItemDelimitationItem
+    };
+    bool resolved = false;
+    for (int t = 0; indexedTags[t] != DC::ItemDelimitationItem; t++)
+      {
+      const vtkDICOMValue& v = query.GetAttributeValue(indexedTags[t]);
+      if (v.IsValid() && v.GetVL() > 0)
+        {
+        vtkSmartPointer<vtkStringArray> matches =
+          vtkSmartPointer<vtkStringArray>::New();
+        if (vtkDICOMDirectory::QueryIndexFile(
+              indexFile, indexedTags[t], v.AsString().c_str(), matches))
+          {
+          a = matches;
+          resolved = true;
+          }
+        break;
+        }
+      }
+    if (!resolved)
+      {
+      // fall back to the per-file tag presence filters: any queried
+      // attribute with a value must be present in a matching file,
+      // so its tag can restrict the scan to the files that might
+      // contain it (creator elements are skipped, because private
+      // blocks are assigned differently from file to file)
+      vtkDICOMDataElementIterator iter;
+      for (iter = query.Begin(); iter != query.End(); ++iter)
+        {
+        vtkDICOMTag tag = iter->GetTag();
+        const vtkDICOMValue& v = iter->GetValue();
+        if (tag == DC::SpecificCharacterSet ||
+            ((tag.GetGroup() & 1) != 0 && tag.GetElement() <= 0x00ff) ||
+            !v.IsValid() || v.GetVL() == 0)
+          {
+          continue;
+          }
+        vtkSmartPointer<vtkStringArray> matches =
+          vtkSmartPointer<vtkStringArray>::New();
+        if (vtkDICOMDirectory::QueryIndexFileForTag(
+              indexFile, tag, matches))
+          {
+          a = matches;
+          }
+        break;
+        }
+      }
+    }
+
   // Write data for every input directory
   if (a->GetNumberOfTuples() > 0)
     {
@@ -0,0 +1,493 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDICOMConfig.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMValue.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMFileDirectory.h"
+
+// from dicomcli
+#include "vtkConsoleOutputWindow.h"
+#include "mainmacro.h"
+
+#include <vtkStringArray.h>
+#include <vtkSmartPointer.h>
+
+#include <string>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+namespace {
+
+// print the version
+void dicomgenerate_version(FILE *file, const char *cp)
+{
+  fprintf(file, "%s %s\n", cp, DICOM_VERSION);
+  fprintf(file, "\n"
+    "Copyright (c) 2012-2016, David Gobbi.\n\n"
+    "This software is distributed under an open-source license.  See the\n"
+    "Copyright.txt file that comes with the vtk-dicom source distribution.\n");
+}
+
+// print the usage
+void dicomgenerate_usage(FILE *file, const char *cp)
+{
+  fprintf(file, "usage:\n"
+    "  %s [options] <directory>\n\n", cp);
+  fprintf(file, "options:\n"
+    "  --patients <n>        Number of patients (default 1).\n"
+    "  --studies <n>         Number of studies per patient (default 1).\n"
+    "  --series <n>          Number of series per study (default 1).\n"
+    "  --slices <n>          Number of slices per series (default 10).\n"
+    "  --rows <n>            Number of rows per slice (default 64).\n"
+    "  --columns <n>         Number of columns per slice (default 64).\n"
+    "  --modality CT|MR      The modality to emulate (default CT).\n"
+    "  --syntax <uid>        The transfer syntax to write with.\n"
+    "  --private-tags <n>    Private elements per file (default 0).\n"
+    "  --sequence-depth <n>  Nested sequence depth (default 0).\n"
+    "  --seed <n>            Seed for the synthetic data (default 1).\n"
+    "  --silent              Do not report progress.\n"
+    "  --help                Print a brief help message.\n"
+    "  --version             Print the software version.\n");
+}
+
+// print the help
+void dicomgenerate_help(FILE *file, const char *cp)
+{
+  dicomgenerate_usage(file, cp);
+  fprintf(file, "\n"
+    "Generate a synthetic DICOM archive for performance testing.\n"
+    "\n"
+    "This writes a parameterized archive of fabricated CT or MR files,\n"
+    "so that directory scanning, sorting, and reading can be benchmarked\n"
+    "at scale without shipping patient data around.  The pixel data is a\n"
+    "simple phantom with seeded pseudo-random noise, so two runs with the\n"
+    "same parameters and seed produce identical image content.  The\n"
+    "\"--private-tags\" and \"--sequence-depth\" options pad each file with\n"
+    "vendor-style private elements and nested sequences, to reproduce the\n"
+    "parsing cost of real scanner output.  The files are arranged in one\n"
+    "directory per series, nested by patient and study.\n"
+    "\n"
+    "The transfer syntaxes supported for \"--syntax\" are 1.2.840.10008.1.2\n"
+    "(implicit little-endian), 1.2.840.10008.1.2.1 (explicit little-endian,\n"
+    "the default), and 1.2.840.10008.1.2.2 (explicit big-endian).\n\n");
+}
+
+// remove path portion of filename
+const char *dicomgenerate_basename(const char *filename)
+{
+  const char *cp = filename + strlen(filename);
+  while (cp != filename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  return cp;
+}
+
+// a linear congruential generator for reproducible noise
+unsigned int dicomgenerate_random(unsigned int *seed)
+{
+  *seed = (*seed)*1664525u + 1013904223u;
+  return *seed;
+}
+
+// fill one slice with an elliptical phantom plus seeded noise,
+// the values fit within 12 stored bits
+void dicomgenerate_fill(
+  unsigned short *pixels, int rows, int cols, int slice, int slices,
+  unsigned int *seed, bool bigEndian)
+{
+  // the ellipse shrinks towards the ends of the stack
+  double f = 1.0;
+  if (slices > 1)
+    {
+    double z = (2.0*slice)/(slices - 1) - 1.0;
+    f = 1.0 - 0.5*z*z;
+    }
+  double cy = 0.5*(rows - 1);
+  double cx = 0.5*(cols - 1);
+  double ry = 0.4*rows*f;
+  double rx = 0.4*cols*f;
+
+  for (int y = 0; y < rows; y++)
+    {
+    for (int x = 0; x < cols; x++)
+      {
+      double dy = (y - cy)/ry;
+      double dx = (x - cx)/rx;
+      unsigned short v = 20;
+      if (dx*dx + dy*dy <= 1.0)
+        {
+        v = static_cast<unsigned short>(
+          1000 + (dicomgenerate_random(seed) >> 24));
+        }
+      if (bigEndian)
+        {
+        v = static_cast<unsigned short>((v << 8) | (v >> 8));
+        }
+      *pixels++ = v;
+      }
+    }
+}
+
+// add vendor-style private elements to one instance
+void dicomgenerate_private(
+  vtkDICOMMetaData *meta, int idx, int count, unsigned int *seed)
+{
+  unsigned short group = 0x0009;
+  for (int i = 0; i < count; i++)
+    {
+    int element = i % 0xF0;
+    if (element == 0)
+      {
+      // each block of up to 240 elements gets its own private group,
+      // reserved by a creator element in slot 0x0010
+      group = static_cast<unsigned short>(0x0009 + 2*(i/0xF0));
+      meta->SetAttributeValue(
+        vtkDICOMTag(group, 0x0010),
+        vtkDICOMValue(vtkDICOMVR::LO, "VTK DICOM GENERATOR"));
+      }
+    vtkDICOMTag tag(group, static_cast<unsigned short>(0x1000 + element));
+    char text[64];
+    if ((i & 1) == 0)
+      {
+      sprintf(text, "%u", dicomgenerate_random(seed) % 100000u);
+      meta->SetAttributeValue(
+        idx, tag, vtkDICOMValue(vtkDICOMVR::DS, text));
+      }
+    else
+      {
+      sprintf(text, "SYNTHETIC VALUE %d", i);
+      meta->SetAttributeValue(
+        idx, tag, vtkDICOMValue(vtkDICOMVR::LO, text));
+      }
+    }
+}
+
+// build a content sequence nested to the requested depth
+vtkDICOMSequence dicomgenerate_sequence(int depth)
+{
+  vtkDICOMItem item;
+  item.SetAttributeValue(DC::ValueType, "TEXT");
+  item.SetAttributeValue(DC::TextValue, "Synthetic content for testing");
+  for (int d = 1; d < depth; d++)
+    {
+    vtkDICOMSequence seq(1);
+    seq.SetItem(0, item);
+    vtkDICOMItem outer;
+    outer.SetAttributeValue(DC::ValueType, "CONTAINER");
+    outer.SetAttributeValue(DC::ContentSequence, seq);
+    item = outer;
+    }
+  vtkDICOMSequence top(1);
+  top.SetItem(0, item);
+  return top;
+}
+
+} // end anonymous namespace
+
+// This program generates a synthetic archive of DICOM files.
+int MAINMACRO(int argc, char *argv[])
+{
+  // redirect all VTK errors to stderr
+  vtkConsoleOutputWindow::Install();
+
+  int numPatients = 1;
+  int numStudies = 1;
+  int numSeries = 1;
+  int numSlices = 10;
+  int rows = 64;
+  int cols = 64;
+  int privateTags = 0;
+  int sequenceDepth = 0;
+  unsigned int seed = 1;
+  bool silent = false;
+  const char *modality = "CT";
+  const char *syntax = "1.2.840.10008.1.2.1";
+  const char *directory = 0;
+
+  if (argc < 2)
+    {
+    dicomgenerate_usage(stdout, dicomgenerate_basename(argv[0]));
+    return 0;
+    }
+
+  for (int argi = 1; argi < argc; argi++)
+    {
+    const char *arg = argv[argi];
+    if (strcmp(arg, "--help") == 0)
+      {
+      dicomgenerate_help(stdout, dicomgenerate_basename(argv[0]));
+      return 0;
+      }
+    else if (strcmp(arg, "--version") == 0)
+      {
+      dicomgenerate_version(stdout, dicomgenerate_basename(argv[0]));
+      return 0;
+      }
+    else if (strcmp(arg, "--silent") == 0)
+      {
+      silent = true;
+      }
+    else if (strcmp(arg, "--patients") == 0 ||
+             strcmp(arg, "--studies") == 0 ||
+             strcmp(arg, "--series") == 0 ||
+             strcmp(arg, "--slices") == 0 ||
+             strcmp(arg, "--rows") == 0 ||
+             strcmp(arg, "--columns") == 0 ||
+             strcmp(arg, "--modality") == 0 ||
+             strcmp(arg, "--syntax") == 0 ||
+             strcmp(arg, "--private-tags") == 0 ||
+             strcmp(arg, "--sequence-depth") == 0 ||
+             strcmp(arg, "--seed") == 0)
+      {
+      if (argi + 1 == argc || argv[argi+1][0] == '-')
+        {
+        fprintf(stderr, "%s must be followed by an argument.\n\n", arg);
+        return 1;
+        }
+      const char *val = argv[++argi];
+      if (strcmp(arg, "--patients") == 0) { numPatients = atoi(val); }
+      else if (strcmp(arg, "--studies") == 0) { numStudies = atoi(val); }
+      else if (strcmp(arg, "--series") == 0) { numSeries = atoi(val); }
+      else if (strcmp(arg, "--slices") == 0) { numSlices = atoi(val); }
+      else if (strcmp(arg, "--rows") == 0) { rows = atoi(val); }
+      else if (strcmp(arg, "--columns") == 0) { cols = atoi(val); }
+      else if (strcmp(arg, "--modality") == 0) { modality = val; }
+      else if (strcmp(arg, "--syntax") == 0) { syntax = val; }
+      else if (strcmp(arg, "--private-tags") == 0)
+        {
+        privateTags = atoi(val);
+        }
+      else if (strcmp(arg, "--sequence-depth") == 0)
+        {
+        sequenceDepth = atoi(val);
+        }
+      else if (strcmp(arg, "--seed") == 0)
+        {
+        seed = static_cast<unsigned int>(strtoul(val, 0, 10));
+        }
+      }
+    else if (arg[0] == '-')
+      {
+      fprintf(stderr, "unrecognized option %s.\n\n", arg);
+      dicomgenerate_usage(stderr, dicomgenerate_basename(argv[0]));
+      return 1;
+      }
+    else if (directory == 0)
+      {
+      directory = arg;
+      }
+    else
+      {
+      fprintf(stderr, "too many arguments.\n\n");
+      dicomgenerate_usage(stderr, dicomgenerate_basename(argv[0]));
+      return 1;
+      }
+    }
+
+  if (directory == 0)
+    {
+    fprintf(stderr, "an output directory must be given.\n\n");
+    return 1;
+    }
+  if (numPatients < 1 || numStudies < 1 || numSeries < 1 ||
+      numSlices < 1 || rows < 1 || cols < 1)
+    {
+    fprintf(stderr, "all counts and dimensions must be positive.\n\n");
+    return 1;
+    }
+  bool isMR = (strcmp(modality, "MR") == 0);
+  if (!isMR && strcmp(modality, "CT") != 0)
+    {
+    fprintf(stderr, "the modality must be CT or MR.\n\n");
+    return 1;
+    }
+  bool bigEndian = (strcmp(syntax, "1.2.840.10008.1.2.2") == 0);
+  if (!bigEndian &&
+      strcmp(syntax, "1.2.840.10008.1.2") != 0 &&
+      strcmp(syntax, "1.2.840.10008.1.2.1") != 0)
+    {
+    fprintf(stderr, "unsupported transfer syntax %s.\n\n", syntax);
+    return 1;
+    }
+
+  const char *classUID = (isMR ? "1.2.840.10008.5.1.4.1.1.4"
+                               : "1.2.840.10008.5.1.4.1.1.2");
+  vtkIdType sliceSize = 2*static_cast<vtkIdType>(rows)*cols;
+  unsigned short *pixels = new unsigned short[rows*cols];
+
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetTransferSyntaxUID(syntax);
+
+  int rval = 0;
+  for (int pIdx = 0; pIdx < numPatients && rval == 0; pIdx++)
+    {
+    char patientName[64];
+    char patientID[64];
+    sprintf(patientName, "SYNTHETIC^PATIENT^%06d", pIdx + 1);
+    sprintf(patientID, "SYN%06d", pIdx + 1);
+
+    for (int stIdx = 0; stIdx < numStudies && rval == 0; stIdx++)
+      {
+      std::string studyUID =
+        vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID);
+      std::string frameUID =
+        vtkDICOMUtilities::GenerateUID(DC::FrameOfReferenceUID);
+      char studyID[64];
+      char accession[64];
+      sprintf(studyID, "S%04d", stIdx + 1);
+      sprintf(accession, "A%06d%04d", pIdx + 1, stIdx + 1);
+
+      for (int seIdx = 0; seIdx < numSeries && rval == 0; seIdx++)
+        {
+        std::string seriesUID =
+          vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+
+        // build the metadata that all files of the series share
+        vtkSmartPointer<vtkDICOMMetaData> meta =
+          vtkSmartPointer<vtkDICOMMetaData>::New();
+        meta->SetNumberOfInstances(numSlices);
+
+        meta->SetAttributeValue(DC::SOPClassUID, classUID);
+        meta->SetAttributeValue(DC::PatientName, patientName);
+        meta->SetAttributeValue(DC::PatientID, patientID);
+        meta->SetAttributeValue(DC::PatientBirthDate, "19700101");
+        meta->SetAttributeValue(DC::PatientSex, (pIdx % 2 ? "F" : "M"));
+        meta->SetAttributeValue(DC::StudyInstanceUID, studyUID);
+        meta->SetAttributeValue(DC::StudyDate, "20080101");
+        meta->SetAttributeValue(DC::StudyTime, "120000");
+        meta->SetAttributeValue(DC::StudyID, studyID);
+        meta->SetAttributeValue(DC::AccessionNumber, accession);
+        meta->SetAttributeValue(DC::StudyDescription, "Synthetic study");
+        meta->SetAttributeValue(DC::ReferringPhysicianName, "");
+        meta->SetAttributeValue(DC::SeriesInstanceUID, seriesUID);
+        meta->SetAttributeValue(DC::SeriesNumber, seIdx + 1);
+        meta->SetAttributeValue(DC::SeriesDescription, "Synthetic series");
+        meta->SetAttributeValue(DC::Modality, modality);
+        meta->SetAttributeValue(DC::Manufacturer, "vtk-dicom");
+        meta->SetAttributeValue(DC::FrameOfReferenceUID, frameUID);
+        meta->SetAttributeValue(DC::PositionReferenceIndicator, "");
+        meta->SetAttributeValue(DC::ImageOrientationPatient,
+          vtkDICOMValue(vtkDICOMVR::DS, "1\\0\\0\\0\\1\\0"));
+        meta->SetAttributeValue(DC::PixelSpacing,
+          vtkDICOMValue(vtkDICOMVR::DS, "0.5\\0.5"));
+        meta->SetAttributeValue(DC::SliceThickness, "1.0");
+        meta->SetAttributeValue(DC::SamplesPerPixel, 1);
+        meta->SetAttributeValue(DC::PhotometricInterpretation,
+                                "MONOCHROME2");
+        meta->SetAttributeValue(DC::Rows, rows);
+        meta->SetAttributeValue(DC::Columns, cols);
+        meta->SetAttributeValue(DC::BitsAllocated, 16);
+        meta->SetAttributeValue(DC::BitsStored, 12);
+        meta->SetAttributeValue(DC::HighBit, 11);
+        meta->SetAttributeValue(DC::PixelRepresentation, 0);
+        if (isMR)
+          {
+          meta->SetAttributeValue(DC::RepetitionTime, "500");
+          meta->SetAttributeValue(DC::EchoTime, "15");
+          meta->SetAttributeValue(DC::EchoTrainLength, "1");
+          meta->SetAttributeValue(DC::ScanningSequence, "SE");
+          meta->SetAttributeValue(DC::SequenceVariant, "NONE");
+          }
+        else
+          {
+          meta->SetAttributeValue(DC::KVP, "120");
+          meta->SetAttributeValue(DC::RescaleIntercept, "-1024");
+          meta->SetAttributeValue(DC::RescaleSlope, "1");
+          }
+        if (sequenceDepth > 0)
+          {
+          meta->SetAttributeValue(DC::ContentSequence,
+                                  dicomgenerate_sequence(sequenceDepth));
+          }
+
+        // the per-instance attributes
+        vtkSmartPointer<vtkStringArray> sopUIDs =
+          vtkSmartPointer<vtkStringArray>::New();
+        sopUIDs->SetNumberOfValues(numSlices);
+        vtkDICOMUtilities::GenerateUIDs(DC::SOPInstanceUID, sopUIDs);
+        for (int i = 0; i < numSlices; i++)
+          {
+          char position[64];
+          sprintf(position, "0\\0\\%d.0", i);
+          meta->SetAttributeValue(i, DC::SOPInstanceUID,
+                                  sopUIDs->GetValue(i));
+          meta->SetAttributeValue(i, DC::InstanceNumber, i + 1);
+          meta->SetAttributeValue(i, DC::ImagePositionPatient,
+            vtkDICOMValue(vtkDICOMVR::DS, position));
+          if (privateTags > 0)
+            {
+            dicomgenerate_private(meta, i, privateTags, &seed);
+            }
+          }
+
+        // one directory per series
+        char subpath[64];
+        sprintf(subpath, "/PT%06d/ST%04d/SE%04d",
+                pIdx + 1, stIdx + 1, seIdx + 1);
+        std::string seriesDir = directory;
+        seriesDir += subpath;
+        int code = vtkDICOMFileDirectory::Create(seriesDir.c_str());
+        if (code != 0)
+          {
+          fprintf(stderr, "unable to create directory %s\n",
+                  seriesDir.c_str());
+          rval = 1;
+          break;
+          }
+
+        compiler->SetMetaData(meta);
+        for (int i = 0; i < numSlices; i++)
+          {
+          char filepart[32];
+          sprintf(filepart, "/IM%06d.dcm", i + 1);
+          std::string fileName = seriesDir;
+          fileName += filepart;
+          compiler->SetFileName(fileName.c_str());
+          compiler->SetIndex(i);
+          compiler->SetSOPInstanceUID(
+            meta->GetAttributeValue(i, DC::SOPInstanceUID).GetCharData());
+          compiler->SetSeriesInstanceUID(seriesUID.c_str());
+          compiler->WriteHeader();
+          dicomgenerate_fill(pixels, rows, cols, i, numSlices,
+                             &seed, bigEndian);
+          compiler->WriteFrame(
+            reinterpret_cast<unsigned char *>(pixels), sliceSize);
+          compiler->Close();
+          if (compiler->GetErrorCode() != 0)
+            {
+            fprintf(stderr, "unable to write %s\n", fileName.c_str());
+            rval = 1;
+            break;
+            }
+          }
+
+        if (!silent && rval == 0)
+          {
+          printf("wrote %s (%d files)\n", seriesDir.c_str(), numSlices);
+          fflush(stdout);
+          }
+        }
+      }
+    }
+
+  delete [] pixels;
+
+  return rval;
+}
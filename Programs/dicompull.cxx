@@ -12,6 +12,7 @@
 
 =========================================================================*/
 
+#include "vtkDICOMBundle.h"
 #include "vtkDICOMConfig.h"
 #include "vtkDICOMDirectory.h"
 #include "vtkDICOMMetaData.h"
@@ -22,6 +23,7 @@
 #include "vtkDICOMFile.h"
 #include "vtkDICOMFilePath.h"
 #include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMUtilities.h"
 
 // from dicomcli
 #include "vtkConsoleOutputWindow.h"
@@ -31,6 +33,8 @@
 
 #include <vtkStringArray.h>
 #include <vtkSmartPointer.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -39,7 +43,9 @@
 
 #include <limits>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 // print the version
 void dicompull_version(FILE *file, const char *cp)
@@ -65,6 +71,10 @@ void dicompull_usage(FILE *file, const char *cp)
     "  -o <directory>  Directory to place the files into.\n"
     "  -maxdepth n     Set the maximum directory depth.\n"
     "  -name pattern   Set file names to match (with \"*\" or \"?\").\n"
+    "  -j n            Copy the files with n threads working in parallel.\n"
+    "  -manifest file  Use a manifest to make the copy restartable.\n"
+    "  -verify         Verify completed manifest entries by checksum.\n"
+    "  -bundle         Pack each series into a single bundle file.\n"
     "  -image          Restrict the search to files with PixelData.\n"
     "  -series         Find all files in series if even one file matches.\n"
     "  --silent        Do not report any progress information.\n"
@@ -105,6 +115,24 @@ void dicompull_help(FILE *file, const char *cp)
     "where the first line of the file is the key (e.g. SeriesInstanceUID) and\n"
     "the rest of the file is the UIDs to match, one UID per line.\n"
     "\n"
+    "With \"-bundle\", the files of each series are packed into one bundle\n"
+    "file (named IM-nnnn.dcmb) instead of being copied one-by-one.  A bundle\n"
+    "holds the complete data sets behind a byte-range index, and it can be\n"
+    "read directly by any program that uses vtkDICOMReader, with one file\n"
+    "open per series instead of one per image.\n"
+    "\n"
+    "With \"-manifest\", a large extraction becomes restartable.  If the\n"
+    "manifest file does not exist, then the search is performed as usual\n"
+    "and every planned copy is written to the manifest before the copying\n"
+    "begins; as each file is copied, a completion record with its size and\n"
+    "checksum is appended.  If the manifest file already exists, then the\n"
+    "search is skipped entirely and only the entries whose destination is\n"
+    "missing or has the wrong size are copied, so a run that died partway\n"
+    "through can be rerun to transfer just the remainder.  The \"-verify\"\n"
+    "option additionally checks completed entries against the recorded\n"
+    "checksums, at the cost of re-reading the copied files.  A manifest\n"
+    "cannot be combined with \"-bundle\".\n"
+    "\n"
   );
 }
 
@@ -247,6 +275,387 @@ std::string dicompull_makedirname(
   return s;
 }
 
+// A single file to be copied to the output directory
+struct dicompull_copytask
+{
+  std::string SourceName;
+  std::string DestName;
+  long long Size;
+};
+
+// Information shared by the file copy threads
+struct dicompull_copyinfo
+{
+  std::vector<dicompull_copytask> *Tasks;
+  vtkIdType NextIndex;
+  vtkIdType DoneCount;
+  ProgressObserver *Progress;
+  FILE *Manifest;
+  vtkSimpleCriticalSection Lock;
+};
+
+// Copy one file, print a message to stderr if an error occurs.
+// The byte count and the CRC-32C of the copied data are returned
+// through the final two arguments, and the return value is true
+// if the copy was completed.
+bool dicompull_copyfile(
+  const std::string& srcname, const std::string& fullname,
+  unsigned char *buffer, size_t bufsize,
+  long long *bytes, unsigned int *checksum)
+{
+  bool success = false;
+  *bytes = 0;
+  *checksum = 0;
+  vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
+  if (infile.GetError())
+    {
+    const char *message = "Cannot copy file";
+    switch (infile.GetError())
+      {
+      case vtkDICOMFile::AccessDenied:
+        message = "Access denied for file";
+        break;
+      case vtkDICOMFile::FileIsDirectory:
+        message = "This file is a directory";
+        break;
+      case vtkDICOMFile::ImpossiblePath:
+        message = "Bad file path";
+        break;
+      }
+    fprintf(stderr, "Error: %s: %s\n", message, srcname.c_str());
+    }
+  else if (infile.GetSize() == 0)
+    {
+    fprintf(stderr, "Error: File size is zero: %s\n",
+            srcname.c_str());
+    }
+  else
+    {
+    vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
+    if (outfile.GetError())
+      {
+      const char *message = "Cannot write file";
+      switch (outfile.GetError())
+        {
+        case vtkDICOMFile::AccessDenied:
+          message = "Access denied for output file";
+          break;
+        case vtkDICOMFile::FileIsDirectory:
+          message = "This output is a directory";
+          break;
+        case vtkDICOMFile::ImpossiblePath:
+          message = "Bad file path";
+          break;
+        }
+      fprintf(stderr, "Error: %s: %s\n", message, fullname.c_str());
+      }
+    else
+      {
+      // copy the file
+      success = true;
+      while (!infile.EndOfFile())
+        {
+        size_t bytecount = infile.Read(buffer, bufsize);
+        if (bytecount == 0 && infile.GetError())
+          {
+          fprintf(stderr, "Error, incomplete read: %s\n",
+                  srcname.c_str());
+          vtkDICOMFile::Remove(fullname.c_str());
+          success = false;
+          break;
+          }
+        if (bytecount > 0 &&
+            outfile.Write(buffer, bytecount) != bytecount)
+          {
+          fprintf(stderr, "Error: Incomplete write: %s\n",
+                  fullname.c_str());
+          vtkDICOMFile::Remove(fullname.c_str());
+          success = false;
+          break;
+          }
+        // the checksum comes almost for free while the bytes are
+        // passing through the copy buffer
+        *checksum = vtkDICOMUtilities::ComputeCRC32C(
+          *checksum, buffer, bytecount);
+        *bytes += static_cast<long long>(bytecount);
+        }
+      }
+    }
+
+  return success;
+}
+
+// Compute the CRC-32C of a whole file (for manifest verification)
+unsigned int dicompull_filechecksum(
+  const std::string& fname, unsigned char *buffer, size_t bufsize)
+{
+  unsigned int checksum = 0;
+  vtkDICOMFile infile(fname.c_str(), vtkDICOMFile::In);
+  if (infile.GetError() == 0)
+    {
+    while (!infile.EndOfFile())
+      {
+      size_t bytecount = infile.Read(buffer, bufsize);
+      if (bytecount == 0)
+        {
+        break;
+        }
+      checksum = vtkDICOMUtilities::ComputeCRC32C(
+        checksum, buffer, bytecount);
+      }
+    }
+  return checksum;
+}
+
+// Copy files until there are none left to claim
+VTK_THREAD_RETURN_TYPE dicompull_copythread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicompull_copyinfo *info =
+    static_cast<dicompull_copyinfo *>(ti->UserData);
+
+  vtkIdType total = static_cast<vtkIdType>(info->Tasks->size());
+  const size_t bufsize = 65536;
+  unsigned char *buffer = new unsigned char [bufsize];
+
+  for (;;)
+    {
+    info->Lock.Lock();
+    vtkIdType idx = info->NextIndex++;
+    info->Lock.Unlock();
+    if (idx >= total)
+      {
+      break;
+      }
+
+    const dicompull_copytask& task = (*info->Tasks)[idx];
+    long long bytes = 0;
+    unsigned int checksum = 0;
+    bool success = dicompull_copyfile(
+      task.SourceName, task.DestName, buffer, bufsize, &bytes, &checksum);
+
+    info->Lock.Lock();
+    if (success && info->Manifest)
+      {
+      // check the entry off so that a rerun will not repeat it
+      fprintf(info->Manifest, "done\t%lld\t%08x\t%s\n",
+              bytes, checksum, task.DestName.c_str());
+      fflush(info->Manifest);
+      }
+    info->DoneCount++;
+    if (info->Progress)
+      {
+      double progress = (static_cast<double>(info->DoneCount)/
+                         static_cast<double>(total));
+      info->Progress->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+      }
+    info->Lock.Unlock();
+    }
+
+  delete [] buffer;
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// A completion record read back from a manifest
+struct dicompull_manifestrecord
+{
+  long long Size;
+  unsigned int Checksum;
+};
+
+// Write the planned copies to a new manifest file, returning the
+// open file handle so completion records can be appended to it
+FILE *dicompull_writemanifest(
+  const char *fname, const std::vector<dicompull_copytask>& tasks)
+{
+  FILE *fp = fopen(fname, "w");
+  if (fp)
+    {
+    fprintf(fp, "# dicompull manifest\n");
+    for (size_t i = 0; i < tasks.size(); i++)
+      {
+      fprintf(fp, "todo\t%lld\t%s\t%s\n", tasks[i].Size,
+              tasks[i].SourceName.c_str(), tasks[i].DestName.c_str());
+      }
+    fflush(fp);
+    }
+  return fp;
+}
+
+// Read a manifest and gather the entries that still need copying.
+// An entry is complete if its destination exists with the expected
+// size, and, when "verify" is set, if the destination also matches
+// the checksum that was recorded when it was copied.
+bool dicompull_readmanifest(
+  const char *fname, std::vector<dicompull_copytask> *tasks, bool verify)
+{
+  FILE *fp = fopen(fname, "r");
+  if (fp == 0)
+    {
+    return false;
+    }
+
+  std::vector<dicompull_copytask> planned;
+  std::map<std::string, dicompull_manifestrecord> completed;
+
+  char line[8192];
+  while (fgets(line, sizeof(line), fp))
+    {
+    // strip the newline and split the line at the tabs
+    size_t l = strlen(line);
+    while (l > 0 && (line[l-1] == '\n' || line[l-1] == '\r'))
+      {
+      line[--l] = '\0';
+      }
+    char *fields[4];
+    int nfields = 0;
+    char *cp = line;
+    fields[nfields++] = cp;
+    while (nfields < 4 && (cp = strchr(cp, '\t')) != 0)
+      {
+      *cp++ = '\0';
+      fields[nfields++] = cp;
+      }
+    if (nfields != 4 || line[0] == '#')
+      {
+      continue;
+      }
+    if (strcmp(fields[0], "todo") == 0)
+      {
+      dicompull_copytask task;
+      task.Size = 0;
+      sscanf(fields[1], "%lld", &task.Size);
+      task.SourceName = fields[2];
+      task.DestName = fields[3];
+      planned.push_back(task);
+      }
+    else if (strcmp(fields[0], "done") == 0)
+      {
+      dicompull_manifestrecord record;
+      record.Size = 0;
+      sscanf(fields[1], "%lld", &record.Size);
+      record.Checksum =
+        static_cast<unsigned int>(strtoul(fields[2], 0, 16));
+      completed[fields[3]] = record;
+      }
+    }
+  fclose(fp);
+
+  const size_t bufsize = 65536;
+  unsigned char *buffer = new unsigned char [bufsize];
+
+  for (size_t i = 0; i < planned.size(); i++)
+    {
+    const dicompull_copytask& task = planned[i];
+    vtkDICOMFile::Size size = 0;
+    long long mtime = 0;
+    bool complete =
+      (vtkDICOMFile::GetFileInfo(task.DestName.c_str(), &size, &mtime) &&
+       static_cast<long long>(size) == task.Size);
+    if (complete && verify)
+      {
+      std::map<std::string, dicompull_manifestrecord>::iterator it =
+        completed.find(task.DestName);
+      complete = (it != completed.end() &&
+                  it->second.Size == task.Size &&
+                  it->second.Checksum == dicompull_filechecksum(
+                    task.DestName, buffer, bufsize));
+      }
+    if (!complete)
+      {
+      // make sure the destination directory exists, in case the
+      // previous run was interrupted before it was flushed out
+      std::string dirname = dicompull_dirname(task.DestName.c_str());
+      if (!dirname.empty())
+        {
+        vtkDICOMFileDirectory::Create(dirname.c_str());
+        }
+      tasks->push_back(task);
+      }
+    }
+
+  delete [] buffer;
+
+  return true;
+}
+
+// A series of files to be packed into one bundle file
+struct dicompull_bundletask
+{
+  std::vector<std::string> SourceNames;
+  std::string DestName;
+};
+
+// Information shared by the bundle writing threads
+struct dicompull_bundleinfo
+{
+  std::vector<dicompull_bundletask> *Tasks;
+  vtkIdType NextIndex;
+  vtkIdType DoneCount;
+  ProgressObserver *Progress;
+  vtkSimpleCriticalSection Lock;
+};
+
+// Pack the files of one series into a bundle file
+void dicompull_writebundle(const dicompull_bundletask& task)
+{
+  vtkSmartPointer<vtkDICOMBundle> bundle =
+    vtkSmartPointer<vtkDICOMBundle>::New();
+  bundle->SetFileName(task.DestName.c_str());
+  if (!bundle->StartWrite(static_cast<int>(task.SourceNames.size())))
+    {
+    fprintf(stderr, "Error: Cannot write file: %s\n", task.DestName.c_str());
+    return;
+    }
+  for (size_t i = 0; i < task.SourceNames.size(); i++)
+    {
+    bundle->WriteInstanceFromFile(task.SourceNames[i].c_str());
+    }
+  if (!bundle->FinishWrite())
+    {
+    fprintf(stderr, "Error: Incomplete write: %s\n", task.DestName.c_str());
+    vtkDICOMFile::Remove(task.DestName.c_str());
+    }
+}
+
+// Write bundles until there are none left to claim
+VTK_THREAD_RETURN_TYPE dicompull_bundlethread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicompull_bundleinfo *info =
+    static_cast<dicompull_bundleinfo *>(ti->UserData);
+
+  vtkIdType total = static_cast<vtkIdType>(info->Tasks->size());
+
+  for (;;)
+    {
+    info->Lock.Lock();
+    vtkIdType idx = info->NextIndex++;
+    info->Lock.Unlock();
+    if (idx >= total)
+      {
+      break;
+      }
+
+    dicompull_writebundle((*info->Tasks)[idx]);
+
+    info->Lock.Lock();
+    info->DoneCount++;
+    if (info->Progress)
+      {
+      double progress = (static_cast<double>(info->DoneCount)/
+                         static_cast<double>(total));
+      info->Progress->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+      }
+    info->Lock.Unlock();
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 // Delay wildcard expansion for -name option
 MAINMACRO_PASSTHROUGH(-name);
 
@@ -264,7 +673,11 @@ int MAINMACRO(int argc, char *argv[])
   vtkDICOMItem query;
   bool requirePixelData = false;
   bool findSeries = false;
+  bool makeBundle = false;
   bool silent = false;
+  int numThreads = 1;
+  const char *manifest = 0;
+  bool verify = false;
   std::string outdir;
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
@@ -382,6 +795,35 @@ int MAINMACRO(int argc, char *argv[])
         }
       pattern = argv[argi];
       }
+    else if (strcmp(arg, "-j") == 0)
+      {
+      ++argi;
+      if (argi == argc)
+        {
+        fprintf(stderr, "Error: %s must be followed by an argument.\n\n", arg);
+        return 1;
+        }
+      numThreads = static_cast<int>(atol(argv[argi]));
+      }
+    else if (strcmp(arg, "-manifest") == 0)
+      {
+      ++argi;
+      if (argi == argc || argv[argi][0] == '-')
+        {
+        fprintf(stderr, "Error: %s must be followed by a file name.\n\n",
+                arg);
+        return 1;
+        }
+      manifest = argv[argi];
+      }
+    else if (strcmp(arg, "-verify") == 0)
+      {
+      verify = true;
+      }
+    else if (strcmp(arg, "-bundle") == 0)
+      {
+      makeBundle = true;
+      }
     else if (strcmp(arg, "-image") == 0)
       {
       requirePixelData = true;
@@ -429,6 +871,14 @@ int MAINMACRO(int argc, char *argv[])
     exit(1);
     }
 
+  // a manifest records one entry per copied file, bundles do not
+  if (manifest && makeBundle)
+    {
+    fprintf(stderr,
+      "\nError: The -manifest option cannot be used with -bundle.\n\n");
+    exit(1);
+    }
+
   // do a dry run to make sure outdir string is valid
   dicompull_makedirname(NULL, 0, 0, outdir.c_str());
 
@@ -436,12 +886,40 @@ int MAINMACRO(int argc, char *argv[])
   // number of series that have been written to the directory.
   std::map<std::string, int> dircount;
 
+  // an existing manifest means a previous run is being resumed
+  bool resuming =
+    (manifest != 0 &&
+     vtkDICOMFile::Access(manifest, vtkDICOMFile::In) ==
+       vtkDICOMFile::Good);
+
+  // the copies to be performed, and the manifest to record them in
+  std::vector<dicompull_copytask> tasks;
+  std::vector<dicompull_bundletask> bundleTasks;
+  FILE *manifestFile = 0;
+
+  vtkSmartPointer<ProgressObserver> p =
+    vtkSmartPointer<ProgressObserver>::New();
+
+  if (resuming)
+    {
+    // the scan was already done by the run that wrote the manifest,
+    // so load the manifest and keep the entries not yet completed
+    if (!dicompull_readmanifest(manifest, &tasks, verify))
+      {
+      fprintf(stderr, "Error: Can't read manifest file %s\n", manifest);
+      exit(1);
+      }
+    manifestFile = fopen(manifest, "a");
+    if (manifestFile == 0)
+      {
+      fprintf(stderr, "Error: Can't append to manifest file %s\n",
+              manifest);
+      exit(1);
+      }
+    }
   // Write data for every input directory
-  if (a->GetNumberOfTuples() > 0)
+  else if (a->GetNumberOfTuples() > 0)
     {
-    const size_t bufsize = 8192;
-    unsigned char *buffer = new unsigned char [bufsize];
-
     vtkSmartPointer<vtkDICOMDirectory> finder =
       vtkSmartPointer<vtkDICOMDirectory>::New();
     finder->SetInputFileNames(a);
@@ -453,8 +931,6 @@ int MAINMACRO(int argc, char *argv[])
     finder->SetFindLevel(
       findSeries ? vtkDICOMDirectory::SERIES : vtkDICOMDirectory::IMAGE);
 
-    vtkSmartPointer<ProgressObserver> p =
-      vtkSmartPointer<ProgressObserver>::New();
     if (!silent)
       {
       p->SetText("Scanning");
@@ -464,18 +940,9 @@ int MAINMACRO(int argc, char *argv[])
       }
     finder->Update();
 
-    vtkIdType count = 0;
-    vtkIdType total = 0;
-    if (!silent)
-      {
-      p->SetText("Copying");
-      p->Execute(NULL, vtkCommand::StartEvent, NULL);
-      for (int k = 0; k < finder->GetNumberOfSeries(); k++)
-        {
-        total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
-        }
-      }
-
+    // Build the list of copy tasks and create the output directories,
+    // so that the copies are independent of each other and can be
+    // distributed over several threads.
     for (int j = 0; j < finder->GetNumberOfStudies(); j++)
       {
       int k0 = finder->GetFirstSeriesForStudy(j);
@@ -502,105 +969,173 @@ int MAINMACRO(int argc, char *argv[])
             {
             fprintf(stderr, "Error: Cannot create directory: %s\n",
                     dirname.c_str());
-            delete [] buffer;
             exit(1);
             }
           }
         vtkDICOMFilePath outpath(dirname);
-        for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
+        if (makeBundle)
           {
-          // copy the file
+          // the whole series goes into a single bundle file
           char fname[32];
-          sprintf(fname, "IM-%04d-%04d.dcm", si, static_cast<int>(i+1));
-          const std::string& srcname = sa->GetValue(i);
-          std::string fullname = outpath.Join(fname);
-          if (!vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
+          sprintf(fname, "IM-%04d.dcmb", si);
+          dicompull_bundletask task;
+          task.DestName = outpath.Join(fname);
+          for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
             {
-            vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
-            if (infile.GetError())
-              {
-              const char *message = "Cannot copy file";
-              switch (infile.GetError())
-                {
-                case vtkDICOMFile::AccessDenied:
-                  message = "Access denied for file";
-                  break;
-                case vtkDICOMFile::FileIsDirectory:
-                  message = "This file is a directory";
-                  break;
-                case vtkDICOMFile::ImpossiblePath:
-                  message = "Bad file path";
-                  break;
-                }
-              fprintf(stderr, "Error: %s: %s\n", message, srcname.c_str());
-              }
-            else if (infile.GetSize() == 0)
-              {
-              fprintf(stderr, "Error: File size is zero: %s\n",
-                      srcname.c_str());
-              }
-            else
+            task.SourceNames.push_back(sa->GetValue(i));
+            }
+          bundleTasks.push_back(task);
+          }
+        else
+          {
+          for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
+            {
+            char fname[32];
+            sprintf(fname, "IM-%04d-%04d.dcm", si, static_cast<int>(i+1));
+            const std::string& srcname = sa->GetValue(i);
+            std::string fullname = outpath.Join(fname);
+            if (!vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
               {
-              vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
-              if (outfile.GetError())
-                {
-                const char *message = "Cannot write file";
-                switch (outfile.GetError())
-                  {
-                  case vtkDICOMFile::AccessDenied:
-                    message = "Access denied for output file";
-                    break;
-                  case vtkDICOMFile::FileIsDirectory:
-                    message = "This output is a directory";
-                    break;
-                  case vtkDICOMFile::ImpossiblePath:
-                    message = "Bad file path";
-                    break;
-                  }
-                fprintf(stderr, "Error: %s: %s\n", message, fullname.c_str());
-                }
-              else
+              dicompull_copytask task;
+              task.SourceName = srcname;
+              task.DestName = fullname;
+              task.Size = 0;
+              vtkDICOMFile::Size fileSize = 0;
+              long long mtime = 0;
+              if (vtkDICOMFile::GetFileInfo(srcname.c_str(),
+                                            &fileSize, &mtime))
                 {
-                // copy the file
-                while (!infile.EndOfFile())
-                  {
-                  size_t bytecount = infile.Read(buffer, bufsize);
-                  if (bytecount == 0 && infile.GetError())
-                    {
-                    fprintf(stderr, "Error, incomplete read: %s\n",
-                            srcname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                    }
-                  if (bytecount > 0 &&
-                      outfile.Write(buffer, bytecount) != bytecount)
-                    {
-                    fprintf(stderr, "Error: Incomplete write: %s\n",
-                            fullname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                    }
-                  }
+                task.Size = static_cast<long long>(fileSize);
                 }
+              tasks.push_back(task);
               }
             }
+          }
+        }
+      }
 
+    if (manifest)
+      {
+      // record every planned copy before the copying begins
+      manifestFile = dicompull_writemanifest(manifest, tasks);
+      if (manifestFile == 0)
+        {
+        fprintf(stderr, "Error: Can't write manifest file %s\n",
+                manifest);
+        exit(1);
+        }
+      }
+    }
+
+  // Perform the copies that were planned (or that remain) above
+  if (tasks.size() + bundleTasks.size() > 0 || resuming)
+    {
+    if (!silent)
+      {
+      p->SetText(makeBundle ? "Packing" : "Copying");
+      p->Execute(NULL, vtkCommand::StartEvent, NULL);
+      }
+
+    if (makeBundle)
+      {
+      dicompull_bundleinfo info;
+      info.Tasks = &bundleTasks;
+      info.NextIndex = 0;
+      info.DoneCount = 0;
+      info.Progress = (silent ? NULL : p.GetPointer());
+
+      vtkIdType total = static_cast<vtkIdType>(bundleTasks.size());
+      if (numThreads > 1 && total > 1)
+        {
+        // write the bundles with several threads working in parallel
+        vtkSmartPointer<vtkMultiThreader> threader =
+          vtkSmartPointer<vtkMultiThreader>::New();
+        int n = numThreads;
+        if (total < static_cast<vtkIdType>(n))
+          {
+          n = static_cast<int>(total);
+          }
+        threader->SetNumberOfThreads(n);
+        threader->SetSingleMethod(&dicompull_bundlethread, &info);
+        threader->SingleMethodExecute();
+        }
+      else
+        {
+        for (vtkIdType i = 0; i < total; i++)
+          {
+          dicompull_writebundle(bundleTasks[i]);
+          if (!silent)
+            {
+            double progress = (static_cast<double>(i+1)/
+                               static_cast<double>(total));
+            p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+            }
+          }
+        }
+      }
+    else
+      {
+      dicompull_copyinfo info;
+      info.Tasks = &tasks;
+      info.Manifest = manifestFile;
+      info.NextIndex = 0;
+      info.DoneCount = 0;
+      info.Progress = (silent ? NULL : p.GetPointer());
+
+      vtkIdType total = static_cast<vtkIdType>(tasks.size());
+      if (numThreads > 1 && total > 1)
+        {
+        // copy the files with several threads working in parallel
+        vtkSmartPointer<vtkMultiThreader> threader =
+          vtkSmartPointer<vtkMultiThreader>::New();
+        int n = numThreads;
+        if (total < static_cast<vtkIdType>(n))
+          {
+          n = static_cast<int>(total);
+          }
+        threader->SetNumberOfThreads(n);
+        threader->SetSingleMethod(&dicompull_copythread, &info);
+        threader->SingleMethodExecute();
+        }
+      else
+        {
+        const size_t bufsize = 65536;
+        unsigned char *buffer = new unsigned char [bufsize];
+        for (vtkIdType i = 0; i < total; i++)
+          {
+          long long bytes = 0;
+          unsigned int checksum = 0;
+          bool success = dicompull_copyfile(
+            tasks[i].SourceName, tasks[i].DestName,
+            buffer, bufsize, &bytes, &checksum);
+          if (success && manifestFile)
+            {
+            // check the entry off so that a rerun will not repeat it
+            fprintf(manifestFile, "done\t%lld\t%08x\t%s\n",
+                    bytes, checksum, tasks[i].DestName.c_str());
+            fflush(manifestFile);
+            }
           if (!silent)
             {
-            count++;
-            double progress = (static_cast<double>(count)/
+            double progress = (static_cast<double>(i+1)/
                                static_cast<double>(total));
             p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
             }
           }
+        delete [] buffer;
         }
       }
-    delete [] buffer;
+
     if (!silent)
       {
       p->Execute(NULL, vtkCommand::EndEvent, NULL);
       }
     }
 
+  if (manifestFile)
+    {
+    fclose(manifestFile);
+    }
+
   return rval;
 }
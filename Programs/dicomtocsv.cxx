@@ -36,8 +36,13 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <ctype.h>
 
+#include <fstream>
 #include <limits>
+#include <map>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -65,11 +70,15 @@ void dicomtocsv_usage(FILE *file, const char *cp)
     "  -q <query.txt>   Provide a file to describe the find query.\n"
     "  -u <uids.txt>    Provide a file that contains a list of UIDs.\n"
     "  -o <data.csv>    Provide a file for the query results.\n"
+    "  --input-list <files.txt>  Read a list of input files from a file.\n"
+    "  --merge          Merge csv files produced by separate runs.\n"
+    "  --binary         Write a binary columnar table instead of csv.\n"
     "  --first-nonzero  Search series for first nonzero value of each key.\n"
     "  --directory-only Use directory scan only, do not re-scan files.\n"
     "  --study          Print one row for each study.\n"
     "  --series         Print one row for each series (default).\n"
     "  --image          Print one row for each image.\n"
+    "  --streaming      Write each series as soon as it has been scanned.\n"
     "  --silent         Do not report any progress information.\n"
     "  --help           Print a brief help message.\n"
     "  --version        Print the software version.\n");
@@ -99,7 +108,24 @@ void dicomtocsv_help(FILE *file, const char *cp)
     "will be the value used for the search.\n"
     "\n"
     "If no attributes are specified with either \"-k\" or \"-q\", then a\n"
-    "default set of query attributes will be used.\n\n");
+    "default set of query attributes will be used.\n"
+    "\n"
+    "To spread a large extraction job over several hosts, split a master\n"
+    "list of files into slices, run one instance of this program per slice\n"
+    "with \"--input-list\", and then combine the resulting csv files with\n"
+    "\"--merge\".  The merge re-groups the rows by StudyInstanceUID and\n"
+    "SeriesInstanceUID (these columns are part of the default queries), so\n"
+    "that rows for a series whose files landed in different slices end up\n"
+    "together, with their NumberOfReferences file counts summed.  If those\n"
+    "columns are absent, the merge simply concatenates the rows.\n"
+    "\n"
+    "With \"--binary\", the output is a binary columnar table rather than\n"
+    "csv text, so that analytic tools can load the columns directly into\n"
+    "typed arrays without any text parsing.  Attributes whose VR is a\n"
+    "single number become 64-bit float columns, everything else becomes a\n"
+    "dictionary-encoded string column.  The exact layout is documented in\n"
+    "the source code of this program.  This option requires \"-o\" and\n"
+    "cannot be combined with \"--merge\".\n\n");
 }
 
 // remove path portion of filename
@@ -305,234 +331,805 @@ std::string dicomtocsv_quote(const std::string& s)
   return r;
 }
 
-// Write out the results in csv format
-void dicomtocsv_write(vtkDICOMDirectory *finder,
-  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
-  int level, bool firstNonZero, bool useDirectoryRecords, vtkCommand *p)
+// Read a list of file names (one per line, "#" marks a comment)
+bool dicomtocsv_readfilelist(const char *fname, vtkStringArray *a)
 {
-  // for keeping track of progress
-  vtkIdType count = 0.0;
-  vtkIdType total = 0.0;
-  if (p)
+#ifdef _WIN32
+  int cn = MultiByteToWideChar(CP_UTF8, 0, fname, -1, NULL, 0);
+  wchar_t *wfname = new wchar_t[cn];
+  MultiByteToWideChar(CP_UTF8, 0, fname, -1, wfname, cn);
+  std::ifstream f(wfname);
+  delete [] wfname;
+#else
+  std::ifstream f(fname);
+#endif
+  if (!f.good())
     {
-    for (int k = 0; k < finder->GetNumberOfSeries(); k++)
+    return false;
+    }
+
+  while (f.good())
+    {
+    std::string line;
+    std::getline(f, line);
+    const char *cp = line.c_str();
+    size_t n = line.size();
+
+    // strip leading whitespace
+    size_t s = 0;
+    while (s < n && isspace(cp[s]))
       {
-      total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
+      s++;
       }
-    p->Execute(NULL, vtkCommand::StartEvent, NULL);
+
+    // strip trailing whitespace
+    while (n > s && isspace(cp[n-1]))
+      {
+      --n;
+      }
+
+    // skip line if it is empty or a comment
+    if (s == n || cp[s] == '#')
+      {
+      continue;
+      }
+
+    a->InsertNextValue(std::string(&cp[s], n-s));
     }
 
-  for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+  return true;
+}
+
+// Read one csv row, keeping each field in its raw (quoted) form so
+// that the row can be written back out without any loss of formatting
+bool dicomtocsv_readrow(std::istream& f, std::vector<std::string> *fields)
+{
+  fields->clear();
+
+  std::string line;
+  if (!std::getline(f, line))
     {
-    int k0 = finder->GetFirstSeriesForStudy(j);
-    int k1 = finder->GetLastSeriesForStudy(j);
-    int numberOfFiles = 1;
+    return false;
+    }
 
-    if (level < 3 && k1 > k0)
+  // re-join lines that were broken inside of a quoted field
+  for (;;)
+    {
+    size_t quotes = 0;
+    for (size_t i = 0; i < line.length(); i++)
       {
-      // if level is "study", only look at one series
-      numberOfFiles = 0;
-      for (int k = k0; k <= k1; k++)
+      quotes += (line[i] == '\"');
+      }
+    if ((quotes & 1) == 0)
+      {
+      break;
+      }
+    std::string more;
+    if (!std::getline(f, more))
+      {
+      break;
+      }
+    line += "\n";
+    line += more;
+    }
+
+  // strip the carriage return left over from the "\r\n" terminator
+  if (line.length() > 0 && line[line.length()-1] == '\r')
+    {
+    line.resize(line.length()-1);
+    }
+
+  // split the line at commas that lie outside of quoted fields
+  size_t start = 0;
+  bool inQuotes = false;
+  for (size_t i = 0; i <= line.length(); i++)
+    {
+    if (i == line.length() || (line[i] == ',' && !inQuotes))
+      {
+      fields->push_back(line.substr(start, i-start));
+      start = i+1;
+      }
+    else if (line[i] == '\"')
+      {
+      inQuotes = !inQuotes;
+      }
+    }
+
+  return true;
+}
+
+// Remove the quoting from a csv field (the reverse of dicomtocsv_quote)
+std::string dicomtocsv_unquote(const std::string& s)
+{
+  std::string r;
+  bool inQuotes = false;
+
+  for (size_t i = 0; i < s.length(); i++)
+    {
+    if (s[i] == '\"')
+      {
+      if (inQuotes && i+1 < s.length() && s[i+1] == '\"')
         {
-        vtkStringArray *a = finder->GetFileNamesForSeries(k);
-        numberOfFiles += a->GetNumberOfValues();
+        r += '\"';
+        i++;
+        }
+      else
+        {
+        inQuotes = !inQuotes;
         }
-      k1 = k0;
       }
+    else
+      {
+      r += s[i];
+      }
+    }
 
-    for (int k = k0; k <= k1; k++)
+  return r;
+}
+
+// Find the position of a named column in a csv header row
+int dicomtocsv_findcolumn(
+  const std::vector<std::string>& header, const char *name)
+{
+  for (size_t i = 0; i < header.size(); i++)
+    {
+    if (dicomtocsv_unquote(header[i]) == name)
       {
-      vtkStringArray *a = finder->GetFileNamesForSeries(k);
-      if (a->GetNumberOfValues() == 0)
+      return static_cast<int>(i);
+      }
+    }
+
+  return -1;
+}
+
+// Write one csv row from its raw fields
+void dicomtocsv_writerow(const std::vector<std::string>& fields, FILE *fp)
+{
+  for (size_t i = 0; i < fields.size(); i++)
+    {
+    if (i != 0)
+      {
+      fprintf(fp, "%s", ",");
+      }
+    fprintf(fp, "%s", fields[i].c_str());
+    }
+  fprintf(fp, "%s", "\r\n");
+}
+
+// The binary columnar output format (the "--binary" option).  All
+// integers are unsigned and little-endian, doubles are IEEE 754 in
+// native byte order, and strings are a 4-byte length followed by that
+// many bytes of UTF-8 (no terminator).  The layout is as follows:
+//
+//   the 8-byte magic number "VTKDCTBL"
+//   a 4-byte format version (currently 1)
+//   a 4-byte column count, then for each column:
+//     the column name as a string
+//     a 1-byte column type (0 = text, 1 = real)
+//   a sequence of chunks, running to the end of the file, where
+//   each chunk is a 4-byte row count followed by, for each column:
+//     for a real column, one 8-byte double per row (NaN if missing)
+//     for a text column, a 4-byte count of new dictionary entries,
+//       the new entries as strings (their codes continue the numbering
+//       from all previous chunks), and then one 4-byte dictionary code
+//       per row (0xFFFFFFFF if missing)
+//
+// Rows are flushed in chunks of a few thousand so that memory use
+// stays bounded and so that consumers can stream the table.
+
+// The number of rows that are buffered before a chunk is written
+const unsigned int ColumnarChunkSize = 4096;
+
+// One column of a binary columnar table
+struct ColumnarColumn
+{
+  ColumnarColumn() : IsReal(false) {}
+
+  std::string Name;
+  bool IsReal;
+  // codes for strings seen so far, shared by all chunks
+  std::map<std::string, unsigned int> Dictionary;
+  // dictionary entries that are new in the current chunk
+  std::vector<std::string> NewEntries;
+  // the buffered cell values for the current chunk
+  std::vector<unsigned int> Codes;
+  std::vector<double> Reals;
+};
+
+// The writer state for a binary columnar table
+struct ColumnarTable
+{
+  ColumnarTable(FILE *fp) : File(fp), NumRows(0) {}
+
+  FILE *File;
+  std::vector<ColumnarColumn> Columns;
+  unsigned int NumRows;
+};
+
+// Append a 4-byte integer to the binary output
+void dicomtocsv_columnar_putint(FILE *fp, unsigned int i)
+{
+  unsigned char b[4];
+  b[0] = static_cast<unsigned char>(i);
+  b[1] = static_cast<unsigned char>(i >> 8);
+  b[2] = static_cast<unsigned char>(i >> 16);
+  b[3] = static_cast<unsigned char>(i >> 24);
+  fwrite(b, 1, 4, fp);
+}
+
+// Append a length-prefixed string to the binary output
+void dicomtocsv_columnar_putstring(FILE *fp, const std::string& s)
+{
+  dicomtocsv_columnar_putint(fp, static_cast<unsigned int>(s.length()));
+  fwrite(s.data(), 1, s.length(), fp);
+}
+
+// Write the buffered rows as one chunk and reset the buffers
+void dicomtocsv_columnar_flush(ColumnarTable *t)
+{
+  if (t->NumRows == 0)
+    {
+    return;
+    }
+
+  dicomtocsv_columnar_putint(t->File, t->NumRows);
+  for (size_t i = 0; i < t->Columns.size(); i++)
+    {
+    ColumnarColumn& c = t->Columns[i];
+    if (c.IsReal)
+      {
+      fwrite(&c.Reals[0], sizeof(double), c.Reals.size(), t->File);
+      c.Reals.clear();
+      }
+    else
+      {
+      dicomtocsv_columnar_putint(
+        t->File, static_cast<unsigned int>(c.NewEntries.size()));
+      for (size_t j = 0; j < c.NewEntries.size(); j++)
         {
-        continue;
+        dicomtocsv_columnar_putstring(t->File, c.NewEntries[j]);
         }
+      c.NewEntries.clear();
+      for (size_t j = 0; j < c.Codes.size(); j++)
+        {
+        dicomtocsv_columnar_putint(t->File, c.Codes[j]);
+        }
+      c.Codes.clear();
+      }
+    }
+  t->NumRows = 0;
+}
 
-      if (level == 3)
+// Set the value of a real cell in the current row
+void dicomtocsv_columnar_putreal(ColumnarTable *t, size_t col, double d)
+{
+  t->Columns[col].Reals.push_back(d);
+}
+
+// Set the value of a text cell in the current row, the string is
+// dictionary-encoded so that repeated values cost four bytes per row
+void dicomtocsv_columnar_puttext(
+  ColumnarTable *t, size_t col, const std::string& s)
+{
+  ColumnarColumn& c = t->Columns[col];
+  std::map<std::string, unsigned int>::iterator it = c.Dictionary.find(s);
+  if (it == c.Dictionary.end())
+    {
+    unsigned int code = static_cast<unsigned int>(c.Dictionary.size());
+    it = c.Dictionary.insert(std::make_pair(s, code)).first;
+    c.NewEntries.push_back(s);
+    }
+  c.Codes.push_back(it->second);
+}
+
+// Finish the current row, cells that were not set become missing
+void dicomtocsv_columnar_endrow(ColumnarTable *t)
+{
+  for (size_t i = 0; i < t->Columns.size(); i++)
+    {
+    ColumnarColumn& c = t->Columns[i];
+    if (c.IsReal)
+      {
+      if (c.Reals.size() == t->NumRows)
         {
-        // at series level, this is the number of files
-        numberOfFiles = a->GetNumberOfValues();
+        c.Reals.push_back(std::numeric_limits<double>::quiet_NaN());
         }
+      }
+    else if (c.Codes.size() == t->NumRows)
+      {
+      c.Codes.push_back(0xFFFFFFFF);
+      }
+    }
 
-      vtkSmartPointer<vtkDICOMMetaData> meta;
-      if (useDirectoryRecords)
+  t->NumRows++;
+  if (t->NumRows == ColumnarChunkSize)
+    {
+    dicomtocsv_columnar_flush(t);
+    }
+}
+
+// Create the columns from the query and write the table header
+void dicomtocsv_columnar_start(
+  ColumnarTable *t, const vtkDICOMItem& query, const QueryTagList *ql)
+{
+  for (size_t i = 0; i < ql->size(); i++)
+    {
+    ColumnarColumn c;
+    const vtkDICOMItem *pitem = &query;
+    vtkDICOMTagPath tagPath = ql->at(i);
+    for (;;)
+      {
+      vtkDICOMTag tag = tagPath.GetHead();
+      vtkDICOMDictEntry e = pitem->FindDictEntry(tag);
+      if (e.IsValid())
         {
-        meta = finder->GetMetaDataForSeries(k);
+        c.Name += e.GetName();
         }
-      else
+      if (!tagPath.HasTail())
         {
-        meta = vtkSmartPointer<vtkDICOMMetaData>::New();
-        if (level >= 4 || firstNonZero)
+        // the VR of the final tag in the path decides the column type
+        if (e.IsValid())
           {
-          // need to parse all files
-          meta->SetNumberOfInstances(a->GetNumberOfValues());
+          VR vr = e.GetVR();
+          c.IsReal = (vr == VR::SS || vr == VR::US ||
+                      vr == VR::SL || vr == VR::UL ||
+                      vr == VR::FL || vr == VR::FD);
           }
+        break;
+        }
+      pitem = pitem->GetAttributeValue(tag).GetSequenceData();
+      tagPath = tagPath.GetTail();
+      c.Name += '\\';
+      }
+    t->Columns.push_back(c);
+    }
 
-        // need to go to the files for the meta data
-        vtkSmartPointer<vtkDICOMParser> parser =
-          vtkSmartPointer<vtkDICOMParser>::New();
+  fwrite("VTKDCTBL", 1, 8, t->File);
+  dicomtocsv_columnar_putint(t->File, 1);
+  dicomtocsv_columnar_putint(
+    t->File, static_cast<unsigned int>(t->Columns.size()));
+  for (size_t i = 0; i < t->Columns.size(); i++)
+    {
+    dicomtocsv_columnar_putstring(t->File, t->Columns[i].Name);
+    unsigned char type = (t->Columns[i].IsReal ? 1 : 0);
+    fwrite(&type, 1, 1, t->File);
+    }
+}
 
-        parser->SetQueryItem(query);
-        parser->SetMetaData(meta);
+// Merge csv files that were produced by separate (sharded) runs over
+// slices of one file list.  Rows are re-grouped by StudyInstanceUID and
+// SeriesInstanceUID so that a series whose files were scanned by more
+// than one shard comes out as a single contiguous group of rows, and
+// series-level (or study-level) rows for the same entity are combined,
+// with the NumberOfReferences file counts summed.
+int dicomtocsv_merge(vtkStringArray *a, FILE *fp)
+{
+  std::vector<std::string> header;
+  std::vector<std::vector<std::string> > rows;
+  std::map<std::string, size_t> rowMap;
+  std::vector<std::string> studyOrder;
+  std::map<std::string, std::vector<size_t> > studyRows;
+  int studyCol = -1;
+  int seriesCol = -1;
+  int imageCol = -1;
+  int countCol = -1;
+
+  for (vtkIdType j = 0; j < a->GetNumberOfValues(); j++)
+    {
+    const std::string& fname = a->GetValue(j);
+#ifdef _WIN32
+    int cn = MultiByteToWideChar(CP_UTF8, 0, fname.c_str(), -1, NULL, 0);
+    wchar_t *wfname = new wchar_t[cn];
+    MultiByteToWideChar(CP_UTF8, 0, fname.c_str(), -1, wfname, cn);
+    std::ifstream f(wfname);
+    delete [] wfname;
+#else
+    std::ifstream f(fname.c_str());
+#endif
+    if (!f.good())
+      {
+      fprintf(stderr, "Error: Unable to read csv file %s.\n", fname.c_str());
+      return 1;
+      }
 
-        for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
+    // every shard must have been produced with the same query
+    std::vector<std::string> h;
+    if (!dicomtocsv_readrow(f, &h))
+      {
+      fprintf(stderr, "Error: Empty csv file %s.\n", fname.c_str());
+      return 1;
+      }
+    if (header.empty())
+      {
+      header = h;
+      studyCol = dicomtocsv_findcolumn(header, "StudyInstanceUID");
+      seriesCol = dicomtocsv_findcolumn(header, "SeriesInstanceUID");
+      imageCol = dicomtocsv_findcolumn(header, "SOPInstanceUID");
+      countCol = dicomtocsv_findcolumn(header, "NumberOfReferences");
+      }
+    else if (h != header)
+      {
+      fprintf(stderr, "Error: The csv file %s has a different header "
+              "than the first csv file.\n", fname.c_str());
+      return 1;
+      }
+
+    std::vector<std::string> fields;
+    while (dicomtocsv_readrow(f, &fields))
+      {
+      if (fields.size() != header.size())
+        {
+        continue;
+        }
+
+      // the study UID groups the output, the finest available UID
+      // decides which rows describe the same entity
+      std::string studyKey;
+      std::string rowKey;
+      if (studyCol >= 0)
+        {
+        studyKey = dicomtocsv_unquote(fields[studyCol]);
+        rowKey = studyKey;
+        }
+      if (seriesCol >= 0)
+        {
+        rowKey += '\\';
+        rowKey += dicomtocsv_unquote(fields[seriesCol]);
+        }
+      if (imageCol >= 0)
+        {
+        rowKey += '\\';
+        rowKey += dicomtocsv_unquote(fields[imageCol]);
+        }
+
+      std::map<std::string, size_t>::iterator it = rowMap.end();
+      if (rowKey.length() > 0)
+        {
+        it = rowMap.find(rowKey);
+        }
+
+      if (it == rowMap.end())
+        {
+        if (rowKey.length() > 0)
+          {
+          rowMap[rowKey] = rows.size();
+          }
+        if (studyRows.count(studyKey) == 0)
           {
-          parser->SetIndex(ii);
-          parser->SetFileName(a->GetValue(ii));
-          parser->Update();
+          studyOrder.push_back(studyKey);
           }
+        studyRows[studyKey].push_back(rows.size());
+        rows.push_back(fields);
         }
-
-      // this loop is only for the "image" level
-      int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
-      for (int jj = 0; jj < m; jj++)
+      else
         {
-        // print the value of each tag
-        for (size_t i = 0; i < ql->size(); i++)
+        // combine with the existing row for this entity
+        std::vector<std::string>& row = rows[it->second];
+        for (size_t i = 0; i < row.size(); i++)
           {
-          if (i != 0)
+          if (static_cast<int>(i) == countCol)
+            {
+            // sum the per-shard file counts for the entity
+            int total = atoi(dicomtocsv_unquote(row[i]).c_str()) +
+                        atoi(dicomtocsv_unquote(fields[i]).c_str());
+            char text[32];
+            sprintf(text, "\"%d\"", total);
+            row[i] = text;
+            }
+          else if (dicomtocsv_unquote(row[i]).length() == 0)
             {
-            fprintf(fp, "%s", ",");
+            // fill in values that this entity's other shard lacked
+            row[i] = fields[i];
             }
+          }
+        }
+      }
+    }
 
-          const vtkDICOMItem *qitem = &query;
-          const vtkDICOMItem *mitem = 0;
-          const vtkDICOMValue *vp = 0;
-          vtkDICOMTagPath tagPath = ql->at(i);
+  if (header.empty())
+    {
+    fprintf(stderr, "Error: No csv files were provided for the merge.\n");
+    return 1;
+    }
 
-          // this loop is only needed if firstNonZero is set
-          int n = (firstNonZero ? meta->GetNumberOfInstances() : 1);
-          n = (level >= 4 ? jj+1 : n);
-          for (int ii = jj; ii < n; ii++)
-            {
-            // Create an adapter, which helps with extracting attributes from
-            // the PerFrameFunctionalSequence of enhanced IODs.
-            vtkDICOMMetaDataAdapter adapter(meta, ii);
+  dicomtocsv_writerow(header, fp);
+  for (size_t j = 0; j < studyOrder.size(); j++)
+    {
+    const std::vector<size_t>& indices = studyRows[studyOrder[j]];
+    for (size_t i = 0; i < indices.size(); i++)
+      {
+      dicomtocsv_writerow(rows[indices[i]], fp);
+      }
+    }
 
-            for (;;)
-              {
-              vtkDICOMTag tag = tagPath.GetHead();
-              std::string creator;
-              if ((tag.GetGroup() & 0x0001) == 1)
-                {
-                vtkDICOMTag ctag(tag.GetGroup(), tag.GetElement() >> 8);
-                creator = qitem->GetAttributeValue(ctag).AsString();
-                if (mitem)
-                  {
-                  tag = mitem->ResolvePrivateTag(tag, creator);
-                  }
-                else
-                  {
-                  tag = adapter->ResolvePrivateTag(tag, creator);
-                  }
-                }
-              if (mitem)
-                {
-                vp = &mitem->GetAttributeValue(tag);
-                }
-              else if (tag != DC::NumberOfFrames)
-                {
-                // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
-                // will never be found if we check the adapter
-                vp = &adapter->GetAttributeValue(tag);
-                }
-              else
-                {
-                vp = &meta->GetAttributeValue(ii, tag);
-                }
-              if (vp && !vp->IsValid())
-                {
-                vp = 0;
-                }
-              // break if we have reached the end of a tag path
-              if (vp == 0 || !tagPath.HasTail())
-                {
-                break;
-                }
-              // go one level deeper into the query
-              qitem = qitem->GetAttributeValue(
-                tagPath.GetHead()).GetSequenceData();
-              // go one level deeper along the tag path
-              tagPath = tagPath.GetTail();
-              // go one level deeper into the meta data
-              mitem = vp->GetSequenceData();
-              if (mitem == 0 || vp->GetNumberOfValues() == 0)
-                {
-                break;
-                }
-              }
-            // If numerical value is zero, keep going until non-zero because
-            // the zero value is of little interest
-            if (vp != 0)
-              {
-              if (!vp->GetVR().HasNumericValue() || vp->AsDouble() != 0.0)
-                {
-                break;
-                }
-              }
-            }
+  return 0;
+}
+
+// Write out the rows for one series (csv, or columnar if ct is set)
+void dicomtocsv_writeseries(vtkDICOMDirectory *finder, int k,
+  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
+  ColumnarTable *ct, int level, bool firstNonZero,
+  bool useDirectoryRecords, int numberOfFiles, vtkCommand *p,
+  vtkIdType *count, vtkIdType total)
+{
+      vtkStringArray *a = finder->GetFileNamesForSeries(k);
+      if (a->GetNumberOfValues() == 0)
+        {
+        return;
+        }
+
+      if (level == 3)
+        {
+        // at series level, this is the number of files
+        numberOfFiles = a->GetNumberOfValues();
+        }
+
+  vtkSmartPointer<vtkDICOMMetaData> meta;
+  if (useDirectoryRecords)
+    {
+    meta = finder->GetMetaDataForSeries(k);
+    }
+  else
+    {
+    meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    if (level >= 4 || firstNonZero)
+      {
+      // need to parse all files
+      meta->SetNumberOfInstances(a->GetNumberOfValues());
+      }
+
+    // need to go to the files for the meta data
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+
+    parser->SetQueryItem(query);
+    parser->SetMetaData(meta);
+
+    for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
+      {
+      parser->SetIndex(ii);
+      parser->SetFileName(a->GetValue(ii));
+      parser->Update();
+      }
+    }
+
+  // this loop is only for the "image" level
+  int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
+  for (int jj = 0; jj < m; jj++)
+    {
+    // print the value of each tag
+    for (size_t i = 0; i < ql->size(); i++)
+      {
+      if (ct == 0 && i != 0)
+        {
+        fprintf(fp, "%s", ",");
+        }
+
+      const vtkDICOMItem *qitem = &query;
+      const vtkDICOMItem *mitem = 0;
+      const vtkDICOMValue *vp = 0;
+      vtkDICOMTagPath tagPath = ql->at(i);
+
+      // this loop is only needed if firstNonZero is set
+      int n = (firstNonZero ? meta->GetNumberOfInstances() : 1);
+      n = (level >= 4 ? jj+1 : n);
+      for (int ii = jj; ii < n; ii++)
+        {
+        // Create an adapter, which helps with extracting attributes from
+        // the PerFrameFunctionalSequence of enhanced IODs.
+        vtkDICOMMetaDataAdapter adapter(meta, ii);
 
-          if (vp != 0)
+        for (;;)
+          {
+          vtkDICOMTag tag = tagPath.GetHead();
+          std::string creator;
+          if ((tag.GetGroup() & 0x0001) == 1)
             {
-            const vtkDICOMValue& v = *vp;
-            if (v.GetNumberOfValues() == 1 &&
-                (v.GetVR() == VR::SS ||
-                 v.GetVR() == VR::US ||
-                 v.GetVR() == VR::SL ||
-                 v.GetVR() == VR::UL ||
-                 v.GetVR() == VR::FL ||
-                 v.GetVR() == VR::FD))
-              {
-              std::string s = v.AsString();
-              fprintf(fp, "%s", s.c_str());
-              }
-            else if (v.GetVR() == VR::DA ||
-                     v.GetVR() == VR::TM ||
-                     v.GetVR() == VR::DT)
+            vtkDICOMTag ctag(tag.GetGroup(), tag.GetElement() >> 8);
+            creator = qitem->GetAttributeValue(ctag).AsString();
+            if (mitem)
               {
-              std::string s = dicomtocsv_date(v.AsString(), v.GetVR());
-              fprintf(fp, "\"%s\"", s.c_str());
+              tag = mitem->ResolvePrivateTag(tag, creator);
               }
-            else if (v.GetVR() == VR::SQ)
+            else
               {
-              // how should a sequence be printed out to the csv file?
-              }
-            else if (v.GetVL() != 0 && v.GetVL() != 0xFFFFFFFF)
-              {
-              std::string s = dicomtocsv_quote(v.AsUTF8String());
-              fprintf(fp, "\"%s\"", s.c_str());
+              tag = adapter->ResolvePrivateTag(tag, creator);
               }
             }
-          else if (tagPath.GetHead() == DC::ReferencedFileID &&
-                   !tagPath.HasTail())
+          if (mitem)
+            {
+            vp = &mitem->GetAttributeValue(tag);
+            }
+          else if (tag != DC::NumberOfFrames)
+            {
+            // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
+            // will never be found if we check the adapter
+            vp = &adapter->GetAttributeValue(tag);
+            }
+          else
+            {
+            vp = &meta->GetAttributeValue(ii, tag);
+            }
+          if (vp && !vp->IsValid())
+            {
+            vp = 0;
+            }
+          // break if we have reached the end of a tag path
+          if (vp == 0 || !tagPath.HasTail())
             {
-            // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
-            // but we hijack it to report the first file in the series.
-            std::string s = dicomtocsv_quote(a->GetValue(jj));
-            fprintf(fp, "\"%s\"", s.c_str());
+            break;
             }
-          else if (tagPath.GetHead() == DC::NumberOfReferences &&
-                   !tagPath.HasTail())
+          // go one level deeper into the query
+          qitem = qitem->GetAttributeValue(
+            tagPath.GetHead()).GetSequenceData();
+          // go one level deeper along the tag path
+          tagPath = tagPath.GetTail();
+          // go one level deeper into the meta data
+          mitem = vp->GetSequenceData();
+          if (mitem == 0 || vp->GetNumberOfValues() == 0)
             {
-            // NumberOfReferences (0004,1600) is a retired attribute meant
-            // to count the number of references to a file, but we hijack
-            // it and use it to report the number of files found for the
-            // series.
-            fprintf(fp, "\"%d\"", numberOfFiles);
+            break;
             }
           }
+        // If numerical value is zero, keep going until non-zero because
+        // the zero value is of little interest
+        if (vp != 0)
+          {
+          if (!vp->GetVR().HasNumericValue() || vp->AsDouble() != 0.0)
+            {
+            break;
+            }
+          }
+        }
 
-        fprintf(fp, "%s", "\r\n");
-
-        // report progress
-        if (p)
+      if (vp != 0 && ct != 0)
+        {
+        // binary columnar output, the cell type follows the column type
+        const vtkDICOMValue& v = *vp;
+        if (ct->Columns[i].IsReal)
+          {
+          dicomtocsv_columnar_putreal(ct, i, v.AsDouble());
+          }
+        else if (v.GetVR() == VR::DA ||
+                 v.GetVR() == VR::TM ||
+                 v.GetVR() == VR::DT)
           {
-          count += numberOfFiles;
-          double progress = (static_cast<double>(count)/
-                             static_cast<double>(total));
-          p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+          dicomtocsv_columnar_puttext(
+            ct, i, dicomtocsv_date(v.AsString(), v.GetVR()));
           }
+        else if (v.GetVR() != VR::SQ &&
+                 v.GetVL() != 0 && v.GetVL() != 0xFFFFFFFF)
+          {
+          dicomtocsv_columnar_puttext(ct, i, meta->ConvertValueToUTF8(vp));
+          }
+        }
+      else if (vp != 0)
+        {
+        const vtkDICOMValue& v = *vp;
+        if (v.GetNumberOfValues() == 1 &&
+            (v.GetVR() == VR::SS ||
+             v.GetVR() == VR::US ||
+             v.GetVR() == VR::SL ||
+             v.GetVR() == VR::UL ||
+             v.GetVR() == VR::FL ||
+             v.GetVR() == VR::FD))
+          {
+          std::string s = v.AsString();
+          fprintf(fp, "%s", s.c_str());
+          }
+        else if (v.GetVR() == VR::DA ||
+                 v.GetVR() == VR::TM ||
+                 v.GetVR() == VR::DT)
+          {
+          std::string s = dicomtocsv_date(v.AsString(), v.GetVR());
+          fprintf(fp, "\"%s\"", s.c_str());
+          }
+        else if (v.GetVR() == VR::SQ)
+          {
+          // how should a sequence be printed out to the csv file?
+          }
+        else if (v.GetVL() != 0 && v.GetVL() != 0xFFFFFFFF)
+          {
+          // use the conversion cache, so that shared values (such as
+          // PatientName) are only converted once rather than per-row
+          std::string s = dicomtocsv_quote(meta->ConvertValueToUTF8(vp));
+          fprintf(fp, "\"%s\"", s.c_str());
+          }
+        }
+      else if (tagPath.GetHead() == DC::ReferencedFileID &&
+               !tagPath.HasTail())
+        {
+        // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
+        // but we hijack it to report the first file in the series.
+        if (ct)
+          {
+          dicomtocsv_columnar_puttext(ct, i, a->GetValue(jj));
+          }
+        else
+          {
+          std::string s = dicomtocsv_quote(a->GetValue(jj));
+          fprintf(fp, "\"%s\"", s.c_str());
+          }
+        }
+      else if (tagPath.GetHead() == DC::NumberOfReferences &&
+               !tagPath.HasTail())
+        {
+        // NumberOfReferences (0004,1600) is a retired attribute meant
+        // to count the number of references to a file, but we hijack
+        // it and use it to report the number of files found for the
+        // series.
+        if (ct)
+          {
+          dicomtocsv_columnar_putreal(ct, i, numberOfFiles);
+          }
+        else
+          {
+          fprintf(fp, "\"%d\"", numberOfFiles);
+          }
+        }
+      }
+
+    if (ct)
+      {
+      dicomtocsv_columnar_endrow(ct);
+      }
+    else
+      {
+      fprintf(fp, "%s", "\r\n");
+      }
+
+    // report progress
+    if (p)
+      {
+      *count += numberOfFiles;
+      double progress = (static_cast<double>(*count)/
+                         static_cast<double>(total));
+      p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+      }
+    }
+}
+
+// Write out the results in csv (or binary columnar) format
+void dicomtocsv_write(vtkDICOMDirectory *finder,
+  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
+  ColumnarTable *ct, int level, bool firstNonZero,
+  bool useDirectoryRecords, vtkCommand *p)
+{
+  // for keeping track of progress
+  vtkIdType count = 0.0;
+  vtkIdType total = 0.0;
+  if (p)
+    {
+    for (int k = 0; k < finder->GetNumberOfSeries(); k++)
+      {
+      total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
+      }
+    p->Execute(NULL, vtkCommand::StartEvent, NULL);
+    }
+
+  for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+    {
+    int k0 = finder->GetFirstSeriesForStudy(j);
+    int k1 = finder->GetLastSeriesForStudy(j);
+    int numberOfFiles = 1;
+
+    if (level < 3 && k1 > k0)
+      {
+      // if level is "study", only look at one series
+      numberOfFiles = 0;
+      for (int k = k0; k <= k1; k++)
+        {
+        vtkStringArray *a = finder->GetFileNamesForSeries(k);
+        numberOfFiles += a->GetNumberOfValues();
         }
+      k1 = k0;
+      }
+
+    for (int k = k0; k <= k1; k++)
+      {
+      dicomtocsv_writeseries(
+        finder, k, query, ql, fp, ct, level, firstNonZero,
+        useDirectoryRecords, numberOfFiles, p, &count, total);
       }
     }
 
@@ -542,6 +1139,46 @@ void dicomtocsv_write(vtkDICOMDirectory *finder,
     }
 }
 
+// Observer for writing each series as soon as it has been scanned
+class StreamingObserver : public vtkCommand
+{
+public:
+  static StreamingObserver *New() { return new StreamingObserver; }
+
+  virtual void Execute(vtkObject *caller, unsigned long eventId, void *);
+
+  const vtkDICOMItem *Query;
+  const QueryTagList *QueryTags;
+  FILE *OutputFile;
+  ColumnarTable *Table;
+  int Level;
+  bool FirstNonZero;
+  bool UseDirectoryRecords;
+
+protected:
+  StreamingObserver() : Query(0), QueryTags(0), OutputFile(0), Table(0),
+    Level(3), FirstNonZero(false), UseDirectoryRecords(false) {}
+};
+
+void StreamingObserver::Execute(
+  vtkObject *caller, unsigned long eventId, void *)
+{
+  if (eventId == vtkDICOMDirectory::SeriesAddedEvent)
+    {
+    // write the rows for the series before its data is discarded
+    vtkDICOMDirectory *finder = static_cast<vtkDICOMDirectory *>(caller);
+    int k = finder->GetNumberOfSeries() - 1;
+    dicomtocsv_writeseries(
+      finder, k, *this->Query, this->QueryTags, this->OutputFile,
+      this->Table, this->Level, this->FirstNonZero,
+      this->UseDirectoryRecords, 1, 0, 0, 0);
+    if (this->Table == 0)
+      {
+      fflush(this->OutputFile);
+      }
+    }
+}
+
 } // end anonymous namespace
 
 // This program will dump all the metadata in the given file
@@ -557,7 +1194,10 @@ int MAINMACRO(int argc, char *argv[])
   std::vector<std::string> oplist;
   bool firstNonZero = false;
   bool useDirectoryRecords = false;
+  bool streaming = false;
   bool silent = false;
+  bool merge = false;
+  bool binary = false;
   int level = 3; // default to series level
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
@@ -644,6 +1284,29 @@ int MAINMACRO(int argc, char *argv[])
         return 1;
         }
       }
+    else if (strcmp(arg, "--input-list") == 0)
+      {
+      if (argi + 1 == argc || argv[argi+1][0] == '-')
+        {
+        fprintf(stderr, "Error: %s must be followed by a file.\n\n", arg);
+        dicomtocsv_usage(stderr, dicomtocsv_basename(argv[0]));
+        return 1;
+        }
+      const char *lfile = argv[++argi];
+      if (!dicomtocsv_readfilelist(lfile, a))
+        {
+        fprintf(stderr, "Error: Can't read file list %s\n\n", lfile);
+        return 1;
+        }
+      }
+    else if (strcmp(arg, "--binary") == 0)
+      {
+      binary = true;
+      }
+    else if (strcmp(arg, "--merge") == 0)
+      {
+      merge = true;
+      }
     else if (strcmp(arg, "--first-nonzero") == 0)
       {
       firstNonZero = true;
@@ -664,6 +1327,10 @@ int MAINMACRO(int argc, char *argv[])
       {
       level = 4;
       }
+    else if (strcmp(arg, "--streaming") == 0)
+      {
+      streaming = true;
+      }
     else if (strcmp(arg, "--silent") == 0)
       {
       silent = true;
@@ -700,6 +1367,27 @@ int MAINMACRO(int argc, char *argv[])
       }
     }
 
+  // study rows summarize all the series of the study, so they cannot
+  // be written until the whole study has been scanned
+  if (streaming && level < 3)
+    {
+    fprintf(stderr, "Error: --streaming cannot be used with --study.\n\n");
+    return 1;
+    }
+
+  // the merge operates on csv text, and writing binary data to stdout
+  // would mangle it on some platforms
+  if (binary && merge)
+    {
+    fprintf(stderr, "Error: --binary cannot be used with --merge.\n\n");
+    return 1;
+    }
+  if (binary && !ofile)
+    {
+    fprintf(stderr, "Error: --binary requires an output file (-o).\n\n");
+    return 1;
+    }
+
   FILE *fp = stdout;
   FILE *fp1 = NULL;
 
@@ -729,6 +1417,18 @@ int MAINMACRO(int argc, char *argv[])
     silent = true;
     }
 
+  // In merge mode, the inputs are csv files from sharded runs
+  if (merge)
+    {
+    rval = dicomtocsv_merge(a, fp);
+    fflush(fp);
+    if (fp1)
+      {
+      fclose(fp1);
+      }
+    return rval;
+    }
+
   // If no query specified, then use a default one
   if (qtlist.size() == 0)
     {
@@ -747,8 +1447,18 @@ int MAINMACRO(int argc, char *argv[])
     }
 
   // Write the header
-  dicomtocsv_writeheader(query, &qtlist, fp);
-  fflush(fp);
+  ColumnarTable table(fp);
+  ColumnarTable *ct = 0;
+  if (binary)
+    {
+    ct = &table;
+    dicomtocsv_columnar_start(ct, query, &qtlist);
+    }
+  else
+    {
+    dicomtocsv_writeheader(query, &qtlist, fp);
+    fflush(fp);
+    }
 
   // Write data for every input directory
   if (a->GetNumberOfTuples() > 0)
@@ -772,18 +1482,44 @@ int MAINMACRO(int argc, char *argv[])
     finder->SetInputFileNames(a);
     finder->SetScanDepth(scandepth);
     finder->SetFindQuery(query);
+
+    vtkSmartPointer<StreamingObserver> s;
+    if (streaming)
+      {
+      // write the rows during the scan, so that memory use stays flat
+      // and the output starts flowing immediately
+      s = vtkSmartPointer<StreamingObserver>::New();
+      s->Query = &query;
+      s->QueryTags = &qtlist;
+      s->OutputFile = fp;
+      s->Table = ct;
+      s->Level = level;
+      s->FirstNonZero = firstNonZero;
+      s->UseDirectoryRecords = useDirectoryRecords;
+      finder->StreamingOn();
+      finder->AddObserver(vtkDICOMDirectory::SeriesAddedEvent, s);
+      }
+
     finder->Update();
 
-    if (!silent)
+    if (!streaming)
       {
-      p->SetText("Writing");
+      if (!silent)
+        {
+        p->SetText("Writing");
+        }
+      dicomtocsv_write(
+        finder, query, &qtlist, fp, ct, level,
+        firstNonZero, useDirectoryRecords, p);
       }
-    dicomtocsv_write(
-      finder, query, &qtlist, fp, level,
-      firstNonZero, useDirectoryRecords, p);
+    }
 
-    fflush(fp);
+  if (ct)
+    {
+    // write any rows still buffered in the final partial chunk
+    dicomtocsv_columnar_flush(ct);
     }
+  fflush(fp);
 
   if (fp1)
     {
@@ -16,6 +16,7 @@
 #include "vtkDICOMBuild.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMParser.h"
+#include "vtkDICOMCompiler.h"
 #include "vtkDICOMReader.h"
 #include "vtkDICOMWriter.h"
 #include "vtkDICOMFileSorter.h"
@@ -32,9 +33,12 @@
 #include <vtkImageReslice.h>
 #include <vtkStringArray.h>
 #include <vtkIntArray.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkErrorCode.h>
 #include <vtkSortFileNames.h>
 #include <vtkSmartPointer.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
 
 #include <string>
 #include <vector>
@@ -69,6 +73,8 @@ struct dicomtodicom_options
   const char *series_number;
   const char *uid_prefix;
   int mpr;
+  int jobs;
+  bool splice;
   bool silent;
   bool verbose;
   const char *output;
@@ -112,10 +118,12 @@ void dicomtodicom_usage(FILE *file, const char *command_name)
     "  -o directory            The output directory.\n"
     "  -s --silent             Do not print anything while executing.\n"
     "  -v --verbose            Verbose error reporting.\n"
+    "  -j --jobs N             Convert N series concurrently.\n"
     "  --axial                 Produce axial slices.\n"
     "  --coronal               Produce coronal slices.\n"
     "  --sagittal              Produce sagittal slices.\n"
     "  --series-description    Textual description of the series.\n"
+    "  --splice                Copy compressed pixel data verbatim.\n"
     "  --series-number         The series number to use.\n"
     "  --modality              The modality: MR or CT or SC.\n"
     "  --uid-prefix            A DICOM uid prefix (optional).\n"
@@ -160,6 +168,19 @@ void dicomtodicom_help(FILE *file, const char *command_name)
     "This is an experimental feature and causes much of the per-instance\n"
     "meta data to be discarded.\n"
     "\n");
+  fprintf(file,
+    "If the input files comprise more than one series, then each series\n"
+    "is converted separately.  The --jobs option sets the number of series\n"
+    "that will be converted concurrently.\n"
+    "\n");
+  fprintf(file,
+    "The --splice option provides a fast path for compressed input when\n"
+    "no reformatting is requested: the metadata is rewritten, but the\n"
+    "compressed pixel data is copied into the output verbatim, without\n"
+    "being decoded, and the original meta data is kept wholesale rather\n"
+    "than being coerced to the output SOP class.  Input that is not\n"
+    "compressed is converted in the usual way.\n"
+    "\n");
 }
 
 // Print error
@@ -235,10 +256,12 @@ void dicomtodicom_read_options(
   dicomtodicom_options *options, vtkStringArray *files)
 {
   options->mpr = 0;
+  options->jobs = 1;
   options->modality = 0;
   options->series_description = 0;
   options->series_number = 0;
   options->uid_prefix = "2.25";
+  options->splice = false;
   options->silent = false;
   options->verbose = false;
   options->output = 0;
@@ -284,6 +307,21 @@ void dicomtodicom_read_options(
           }
         argi++;
         }
+      else if (strcmp(arg, "--jobs") == 0)
+        {
+        if (argi >= argc ||
+            argv[argi][0] == '-')
+          {
+          fprintf(stderr, "\nA value must follow the \'%s\' flag\n\n", arg);
+          exit(1);
+          }
+        options->jobs = atoi(argv[argi]);
+        if (options->jobs < 1)
+          {
+          options->jobs = 1;
+          }
+        argi++;
+        }
       else if (strcmp(arg, "--axial") == 0)
         {
         options->mpr = MPRAxial;
@@ -296,6 +334,10 @@ void dicomtodicom_read_options(
         {
         options->mpr = MPRSagittal;
         }
+      else if (strcmp(arg, "--splice") == 0)
+        {
+        options->splice = true;
+        }
       else if (strcmp(arg, "--silent") == 0)
         {
         options->silent = true;
@@ -356,6 +398,29 @@ void dicomtodicom_read_options(
             options->output = arg;
             break;
             }
+          else if (arg[argj] == 'j')
+            {
+            if (arg[argj+1] != '\0')
+              {
+              arg += argj+1;
+              }
+            else
+              {
+              if (argi >= argc)
+                {
+                fprintf(stderr, "\nA value must follow the \'-j\' flag\n\n");
+                dicomtodicom_usage(stderr, argv[0]);
+                exit(1);
+                }
+              arg = argv[argi++];
+              }
+            options->jobs = atoi(arg);
+            if (options->jobs < 1)
+              {
+              options->jobs = 1;
+              }
+            break;
+            }
           else
             {
             fprintf(stderr, "\nUnrecognized \'%c\' in option %s\n\n", arg[argj], arg);
@@ -377,12 +442,145 @@ void dicomtodicom_read_options(
     }
 }
 
+// Rewrite one series without transcoding the pixel data: when no
+// reformat is requested and the input stores its pixel data in an
+// encapsulated (compressed) form, the metadata is recompiled but the
+// compressed fragments are spliced into the output verbatim, with
+// only the basic offset table recomputed.  Returns false if the
+// series needs the full conversion instead.
+bool dicomtodicom_try_splice(
+  const dicomtodicom_options *options,
+  vtkStringArray *a,
+  const char *outfile,
+  int series)
+{
+  // reformatting requires decoding the pixels
+  if (!options->splice || options->mpr)
+    {
+    return false;
+    }
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkTypeInt64Array> fragments =
+    vtkSmartPointer<vtkTypeInt64Array>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetMetaData(meta);
+  parser->SetFragmentTable(fragments);
+
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->KeepOriginalPixelDataVROn();
+
+  // all of the output files share one new series UID
+  std::string seriesUID =
+    vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+  compiler->SetSeriesInstanceUID(seriesUID.c_str());
+
+  vtkIdType n = a->GetNumberOfValues();
+  for (vtkIdType i = 0; i < n; i++)
+    {
+    meta->Initialize();
+    fragments->Initialize();
+    parser->SetFileName(a->GetValue(i));
+    parser->Update();
+    if (parser->GetErrorCode() != 0 ||
+        fragments->GetNumberOfValues() < 4)
+      {
+      // the file could not be parsed, or its pixel data is not
+      // encapsulated, so hand the series to the full conversion
+      return false;
+      }
+
+    // apply the same metadata edits as the full conversion
+    meta->SetAttributeValue(DC::SeriesNumber,
+      meta->GetAttributeValue(DC::SeriesNumber).AsUnsignedInt() + 1000);
+    std::string seriesDescription =
+      (meta->GetAttributeValue(DC::SeriesDescription).AsString() +
+       dicomtodicom_description[0]);
+    if (seriesDescription.size() < 64)
+      {
+      meta->SetAttributeValue(DC::SeriesDescription, seriesDescription);
+      }
+    if (options->series_description)
+      {
+      meta->SetAttributeValue(
+        DC::SeriesDescription, options->series_description);
+      }
+    if (options->series_number)
+      {
+      meta->SetAttributeValue(DC::SeriesNumber, options->series_number);
+      }
+
+    // use the same file naming as the writer
+    char tail[32];
+    sprintf(tail, "/IM-%04.4d-%04.4d.dcm",
+            series + 1, static_cast<int>(i + 1));
+    std::string fname = std::string(outfile) + tail;
+
+    std::string tsyntax =
+      meta->GetAttributeValue(DC::TransferSyntaxUID).AsString();
+    compiler->SetFileName(fname.c_str());
+    compiler->SetTransferSyntaxUID(tsyntax.c_str());
+    compiler->SetMetaData(meta);
+    compiler->SetIndex(0);
+    compiler->WriteHeader();
+
+    // splice the fragments, skipping the basic offset table item
+    vtkDICOMFile infile(a->GetValue(i), vtkDICOMFile::In);
+    bool spliced = (infile.GetError() == 0 &&
+                    compiler->GetErrorCode() == 0);
+    std::vector<unsigned char> buffer;
+    vtkIdType m = fragments->GetNumberOfValues();
+    for (vtkIdType j = 2; j + 1 < m && spliced; j += 2)
+      {
+      vtkTypeInt64 offset = fragments->GetValue(j);
+      size_t length = static_cast<size_t>(fragments->GetValue(j + 1));
+      buffer.resize(length + 1);
+      spliced =
+        (infile.SetPosition(static_cast<vtkDICOMFile::Size>(offset)) &&
+         infile.Read(&buffer[0], length) == length);
+      if (spliced)
+        {
+        compiler->WriteCompressedFrame(
+          &buffer[0], static_cast<vtkIdType>(length));
+        }
+      }
+    infile.Close();
+
+    if (spliced)
+      {
+      compiler->Close();
+      spliced = (compiler->GetErrorCode() == 0);
+      }
+    else
+      {
+      compiler->CloseAndRemove();
+      }
+    if (!spliced)
+      {
+      return false;
+      }
+    }
+
+  return true;
+}
+
 // Convert one DICOM series into another DICOM series
 void dicomtodicom_convert_one(
   const dicomtodicom_options *options,
   vtkStringArray *a,
-  const char *outfile)
+  const char *outfile,
+  int series)
 {
+  // when the pixels are not being reformatted, compressed input can
+  // be rewritten by splicing its pixel data instead of transcoding
+  if (dicomtodicom_try_splice(options, a, outfile, series))
+    {
+    return;
+    }
+
   // read the files
   vtkSmartPointer<vtkDICOMReader> reader =
     vtkSmartPointer<vtkDICOMReader>::New();
@@ -583,7 +781,9 @@ void dicomtodicom_convert_one(
     }
   writer->SetMetaData(meta);
   writer->SetFilePrefix(outfile);
-  writer->SetFilePattern("%s/IM-0001-%04.4d.dcm");
+  char pattern[32];
+  sprintf(pattern, "%%s/IM-%04.4d-%%04.4d.dcm", series + 1);
+  writer->SetFilePattern(pattern);
   writer->TimeAsVectorOn();
   if (reader->GetTimeDimension() > 1)
     {
@@ -602,6 +802,45 @@ void dicomtodicom_convert_one(
   dicomtodicom_check_error(writer);
 }
 
+// The state that is shared by all of the conversion threads
+struct dicomtodicom_job_queue
+{
+  const dicomtodicom_options *Options;
+  vtkDICOMFileSorter *Sorter;
+  const char *OutPath;
+  int NumberOfSeries;
+  int NextSeries; // guarded by Lock
+  vtkSimpleCriticalSection Lock;
+};
+
+// The method executed by each conversion thread, each worker owns its
+// own reader, generator, and writer, and claims series from a shared
+// queue until all of the series have been converted
+VTK_THREAD_RETURN_TYPE dicomtodicom_convert_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicomtodicom_job_queue *queue =
+    static_cast<dicomtodicom_job_queue *>(ti->UserData);
+
+  for (;;)
+    {
+    queue->Lock.Lock();
+    int series = queue->NextSeries++;
+    queue->Lock.Unlock();
+    if (series >= queue->NumberOfSeries)
+      {
+      break;
+      }
+
+    dicomtodicom_convert_one(
+      queue->Options, queue->Sorter->GetFileNamesForSeries(series),
+      queue->OutPath, series);
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 // Process a list of files
 void dicomtodicom_convert_files(
   dicomtodicom_options *options, vtkStringArray *files,
@@ -622,8 +861,58 @@ void dicomtodicom_convert_files(
   sorter->Update();
   dicomtodicom_check_error(sorter);
 
-  dicomtodicom_convert_one(
-    options, sorter->GetOutputFileNames(), outpath);
+  int numberOfSeries = sorter->GetNumberOfSeries();
+  long long startTime = vtkDICOMUtilities::GetUTC(0);
+
+  if (options->jobs > 1 && numberOfSeries > 1)
+    {
+    // convert independent series concurrently: the workers share the
+    // read-only output of the sorter and claim series from a queue
+    dicomtodicom_job_queue queue;
+    queue.Options = options;
+    queue.Sorter = sorter;
+    queue.OutPath = outpath;
+    queue.NumberOfSeries = numberOfSeries;
+    queue.NextSeries = 0;
+
+    vtkSmartPointer<vtkMultiThreader> threader =
+      vtkSmartPointer<vtkMultiThreader>::New();
+    int jobs = options->jobs;
+    if (jobs > numberOfSeries)
+      {
+      jobs = numberOfSeries;
+      }
+    threader->SetNumberOfThreads(jobs);
+    threader->SetSingleMethod(&dicomtodicom_convert_thread, &queue);
+    threader->SingleMethodExecute();
+    }
+  else if (numberOfSeries > 1)
+    {
+    for (int i = 0; i < numberOfSeries; i++)
+      {
+      dicomtodicom_convert_one(
+        options, sorter->GetFileNamesForSeries(i), outpath, i);
+      }
+    }
+  else
+    {
+    dicomtodicom_convert_one(
+      options, sorter->GetOutputFileNames(), outpath, 0);
+    }
+
+  // report the aggregate throughput
+  if (!options->silent)
+    {
+    double elapsed = 1e-6*(vtkDICOMUtilities::GetUTC(0) - startTime);
+    long long totalFiles = 0;
+    for (int i = 0; i < numberOfSeries; i++)
+      {
+      totalFiles += sorter->GetFileNamesForSeries(i)->GetNumberOfValues();
+      }
+    fprintf(stdout, "Converted %d series (%lld files) in %.2f s"
+            " (%.1f files/s)\n", numberOfSeries, totalFiles, elapsed,
+            (elapsed > 0 ? totalFiles/elapsed : 0.0));
+    }
 }
 
 // This program will convert DICOM to DICOM
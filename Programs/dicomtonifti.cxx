@@ -38,6 +38,8 @@
 #include <vtkErrorCode.h>
 #include <vtkSortFileNames.h>
 #include <vtkSmartPointer.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
 
 #if (VTK_MAJOR_VERSION > 5) || (VTK_MINOR_VERSION > 9)
 #include <vtkImageHistogramStatistics.h>
@@ -73,6 +75,7 @@ struct dicomtonifti_options
   bool silent;
   bool verbose;
   int volume;
+  int jobs;
   const char *output;
 };
 
@@ -115,6 +118,7 @@ void dicomtonifti_usage(FILE *file, const char *command_name)
     "  -z --compress           Compress output files.\n"
     "  -r --recurse            Recurse into subdirectories.\n"
     "  -b --batch              Do multiple series at once.\n"
+    "  -j --jobs <n>           Convert n series in parallel (batch mode).\n"
     "  -s --silent             Do not echo output filenames.\n"
     "  -v --verbose            Verbose error reporting.\n"
     "  -L --follow-symlinks    Follow symbolic links when recursing.\n"
@@ -190,6 +194,10 @@ void dicomtonifti_help(FILE *file, const char *command_name)
     "directory:\n"
     "\n"
     "%s -brz -o {SeriesDescription}-{SeriesNumber}.nii /path/to/dicom/files\n"
+    "\n"
+    "In batch mode, the \"-j\" option can be used to convert several series\n"
+    "in parallel, so that one series is read and reformatted while another\n"
+    "is being compressed and written.\n"
     "\n",
     command_name);
 }
@@ -280,6 +288,7 @@ void dicomtonifti_read_options(
   options->silent = false;
   options->verbose = false;
   options->volume = -1;
+  options->jobs = 1;
   options->output = 0;
 
   // read the options from the command line
@@ -363,6 +372,17 @@ void dicomtonifti_read_options(
         arg = argv[argi++];
         options->volume = atoi(arg);
         }
+      else if (strcmp(arg, "--jobs") == 0)
+        {
+        if (argi >= argc || argv[argi][0] == '-')
+          {
+          fprintf(stderr, "\nA number must follow \'--jobs\'\n\n");
+          dicomtonifti_usage(stderr, argv[0]);
+          exit(1);
+          }
+        arg = argv[argi++];
+        options->jobs = atoi(arg);
+        }
       else if (strcmp(arg, "--version") == 0)
         {
         dicomtonifti_version(stdout, argv[0], false);
@@ -412,6 +432,25 @@ void dicomtonifti_read_options(
             {
             options->follow_symlinks = true;
             }
+          else if (arg[argj] == 'j')
+            {
+            if (arg[argj+1] != '\0')
+              {
+              arg += argj+1;
+              }
+            else
+              {
+              if (argi >= argc)
+                {
+                fprintf(stderr, "\nA number must follow the \'-j\' flag\n\n");
+                dicomtonifti_usage(stderr, argv[0]);
+                exit(1);
+                }
+              arg = argv[argi++];
+              }
+            options->jobs = atoi(arg);
+            break;
+            }
           else if (arg[argj] == 'o')
             {
             if (arg[argj+1] != '\0')
@@ -624,9 +663,25 @@ void dicomtonifti_convert_one(
     vtkSmartPointer<vtkDICOMToRAS>::New();
   converter->SetInputConnection(lastOutput);
   converter->SetPatientMatrix(patientMatrix);
-  converter->SetAllowRowReordering(!options->no_row_reordering);
-  converter->SetAllowColumnReordering(!options->no_column_reordering);
+
+  // negotiate the memory order with the writer: first try leaving the
+  // voxels exactly as they are, and ask whether the header that will
+  // be written (qform, sform, or both) can describe that orientation
+  // losslessly; if it can, the row/column reordering is skipped and
+  // the data passes through vtkDICOMToRAS untouched, saving a repack
+  // pass over the volume.  FSL and reformatted outputs still get
+  // reordered data, because they rely on the memory order itself.
+  converter->SetAllowRowReordering(0);
+  converter->SetAllowColumnReordering(0);
   converter->UpdateMatrix();
+  if (options->fsl || options->reformat_to_axial ||
+      !vtkNIFTIWriter::CanDescribeOrientation(
+        converter->GetRASMatrix(), !options->no_qform, !options->no_sform))
+    {
+    converter->SetAllowRowReordering(!options->no_row_reordering);
+    converter->SetAllowColumnReordering(!options->no_column_reordering);
+    converter->UpdateMatrix();
+    }
 
   // check if slices have been reordered by vtkDICOMToRAS
   vtkSmartPointer<vtkMatrix4x4> checkMatrix =
@@ -889,6 +944,12 @@ void dicomtonifti_convert_one(
   writer->SetDescription(descrip.c_str());
   writer->SetNIFTIHeader(hdr);
   writer->SetFileName(outfile);
+  if (options->compress)
+    {
+    // compress blocks of data concurrently, the output is written as
+    // a multi-member gzip file that any gzip-aware reader can read
+    writer->ParallelCompressionOn();
+    }
   if (reader->GetTimeDimension() > 1 &&
       options->volume < 0)
     {
@@ -914,6 +975,55 @@ void dicomtonifti_convert_one(
   dicomtonifti_check_error(writer);
 }
 
+// One series conversion, as queued in batch mode
+struct dicomtonifti_task
+{
+  vtkSmartPointer<vtkStringArray> InputNames;
+  std::string OutputName;
+};
+
+// Shared state for the conversion worker threads
+struct dicomtonifti_taskinfo
+{
+  std::vector<dicomtonifti_task> *Tasks;
+  const dicomtonifti_options *Options;
+  vtkIdType NextIndex;
+  vtkSimpleCriticalSection Lock;
+};
+
+// The worker thread for parallel batch conversion, it claims one series
+// at a time so that one series can be read and reformatted while another
+// is being compressed and written
+VTK_THREAD_RETURN_TYPE dicomtonifti_convert_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicomtonifti_taskinfo *info =
+    static_cast<dicomtonifti_taskinfo *>(ti->UserData);
+  vtkIdType numTasks = static_cast<vtkIdType>(info->Tasks->size());
+
+  for (;;)
+    {
+    info->Lock.Lock();
+    vtkIdType taskId = info->NextIndex++;
+    if (taskId < numTasks && !info->Options->silent)
+      {
+      printf("%s\n", (*info->Tasks)[taskId].OutputName.c_str());
+      fflush(stdout);
+      }
+    info->Lock.Unlock();
+    if (taskId >= numTasks)
+      {
+      break;
+      }
+    const dicomtonifti_task& task = (*info->Tasks)[taskId];
+    dicomtonifti_convert_one(
+      info->Options, task.InputNames, task.OutputName.c_str());
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 // Process a list of DICOM files
 void dicomtonifti_convert_files(
   dicomtonifti_options *options, vtkStringArray *files,
@@ -958,6 +1068,9 @@ void dicomtonifti_convert_files(
       vtkSmartPointer<vtkDICOMMetaData>::New();
     parser->SetMetaData(meta);
 
+    // queue one conversion task per series
+    std::vector<dicomtonifti_task> tasks;
+
     int m = sorter->GetNumberOfStudies();
     for (int j = 0; j < m; j++)
       {
@@ -1001,13 +1114,42 @@ void dicomtonifti_convert_files(
             }
           }
 
+        tasks.push_back(dicomtonifti_task());
+        tasks.back().InputNames = a;
+        tasks.back().OutputName = outfile;
+        }
+      }
+
+    // convert the series, several at a time if requested
+    vtkIdType numTasks = static_cast<vtkIdType>(tasks.size());
+    int numThreads = options->jobs;
+    if (numTasks < numThreads)
+      {
+      numThreads = static_cast<int>(numTasks);
+      }
+    if (numThreads > 1)
+      {
+      dicomtonifti_taskinfo info;
+      info.Tasks = &tasks;
+      info.Options = options;
+      info.NextIndex = 0;
+
+      vtkSmartPointer<vtkMultiThreader> threader =
+        vtkSmartPointer<vtkMultiThreader>::New();
+      threader->SetNumberOfThreads(numThreads);
+      threader->SetSingleMethod(&dicomtonifti_convert_thread, &info);
+      threader->SingleMethodExecute();
+      }
+    else
+      {
+      for (vtkIdType taskId = 0; taskId < numTasks; taskId++)
+        {
         if (!options->silent)
           {
-          printf("%s\n", outfile.c_str());
+          printf("%s\n", tasks[taskId].OutputName.c_str());
           }
-
-        // convert the file
-        dicomtonifti_convert_one(options, a, outfile.c_str());
+        dicomtonifti_convert_one(
+          options, tasks[taskId].InputNames, tasks[taskId].OutputName.c_str());
         }
       }
     }
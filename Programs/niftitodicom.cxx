@@ -74,6 +74,7 @@ struct niftitodicom_options
   const char *series_number;
   const char *uid_prefix;
   int mpr;
+  bool streaming;
   bool silent;
   bool verbose;
   const char *output;
@@ -122,6 +123,7 @@ void niftitodicom_usage(FILE *file, const char *command_name)
     "  --axial                 Produce axial slices.\n"
     "  --coronal               Produce coronal slices.\n"
     "  --sagittal              Produce sagittal slices.\n"
+    "  --streaming             Stream the data one slice at a time.\n"
     "  --series-description    Textual description of the series.\n"
     "  --series-number         The series number to use.\n"
     "  --modality              The modality: MR or CT or SC.\n"
@@ -156,6 +158,12 @@ void niftitodicom_help(FILE *file, const char *command_name)
     "the images are in the usual orientation (right is left, posterior is\n"
     "down) by reordering the columns or rows as compared to the NIFTI file.\n"
     "\n");
+  fprintf(file,
+    "With the --streaming option, the voxel data is pulled through the\n"
+    "pipeline one slice at a time, and each DICOM file is written as its\n"
+    "slice arrives.  This bounds the memory use to a few slices, instead\n"
+    "of two or three copies of the whole volume.\n"
+    "\n");
   fprintf(file,
     "If the NIFTI file is floating-point, then the data might be rescaled\n"
     "when written to DICOM as 16-bit integers.  If any data values are too\n"
@@ -258,6 +266,7 @@ void niftitodicom_read_options(
   niftitodicom_options *options, vtkStringArray *files)
 {
   options->mpr = 0;
+  options->streaming = false;
   options->no_reordering = false;
   options->modality = 0;
   options->series_description = 0;
@@ -325,6 +334,10 @@ void niftitodicom_read_options(
         {
         options->no_reordering = true;
         }
+      else if (strcmp(arg, "--streaming") == 0)
+        {
+        options->streaming = true;
+        }
       else if (strcmp(arg, "--silent") == 0)
         {
         options->silent = true;
@@ -484,7 +497,18 @@ void niftitodicom_convert_one(
     vtkSmartPointer<vtkNIFTIReader>::New();
   reader->TimeAsVectorOn();
   reader->SetFileName(filename);
-  reader->Update();
+  if (options->streaming)
+    {
+    // only read the header up front: the writer will pull the voxel
+    // data through the pipeline one slice at a time, and each slice
+    // is written to its DICOM file as soon as it arrives
+    reader->MemoryMappingOn();
+    reader->UpdateInformation();
+    }
+  else
+    {
+    reader->Update();
+    }
   niftitodicom_check_error(reader);
   vtkAlgorithmOutput *lastOutput = reader->GetOutputPort();
 
@@ -643,7 +667,7 @@ void niftitodicom_convert_one(
     }
 
   // convert to signed short if not short
-  int scalarType = reader->GetOutput()->GetScalarType();
+  int scalarType = reader->GetDataScalarType();
   vtkSmartPointer<vtkImageShiftScale> caster =
     vtkSmartPointer<vtkImageShiftScale>::New();
 
@@ -794,6 +818,10 @@ void niftitodicom_convert_one(
     }
   writer->SetInputConnection(lastOutput);
   writer->SetMemoryRowOrderToFileNative();
+  if (options->streaming)
+    {
+    writer->StreamingOn();
+    }
   writer->Write();
   niftitodicom_check_error(writer);
 }
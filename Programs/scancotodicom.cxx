@@ -605,6 +605,11 @@ void scancotodicom_convert_one(
   vtkSmartPointer<vtkDICOMWriter> writer =
     vtkSmartPointer<vtkDICOMWriter>::New();
   writer->StreamingOn();
+  // stream the volume slab-by-slab, so that only a few slabs of
+  // decoded voxels are in memory at a time, and let the files of
+  // each slab be assembled and written concurrently
+  writer->SetStreamingSlabSize(16);
+  writer->ParallelWritingOn();
   if (reader->GetDataScalarType() != VTK_SIGNED_CHAR)
     {
     vtkSmartPointer<vtkDICOMCTGenerator> generator =
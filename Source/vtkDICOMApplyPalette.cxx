@@ -97,6 +97,20 @@ void vtkDICOMApplyPaletteExecute(
   target *= extent[3] - extent[2] + 1;
   vtkIdType progress = 0;
 
+  // the output color is a pure function of the stored pixel value, and
+  // the template is only instantiated for 8-bit and 16-bit types, so the
+  // mapping can be flattened into a table of at most 65536 RGB entries
+  // that is computed once per slice and applied with a simple gather
+  unsigned int maskValue = (sizeof(T) == 1 ? 0x00ff : 0xffff);
+  vtkIdType sliceVoxels = extent[1] - extent[0] + 1;
+  sliceVoxels *= extent[3] - extent[2] + 1;
+  bool useFlatTable = (sliceVoxels > static_cast<vtkIdType>(maskValue));
+  std::vector<unsigned char> flatTable;
+  if (useFlatTable)
+    {
+    flatTable.resize(3*(maskValue + 1));
+    }
+
   for (int c = 0; c < inputComponents; c++)
     {
     T *inPtrC = inPtr0 + c;
@@ -165,6 +179,42 @@ void vtkDICOMApplyPaletteExecute(
           }
         }
 
+      // compute the color for every possible stored pixel value
+      unsigned char *lut = 0;
+      if (useFlatTable)
+        {
+        lut = &flatTable[0];
+        unsigned char *lp = lut;
+        for (unsigned int q = 0; q <= maskValue; q++)
+          {
+          // recover the pixel value from its stored bit pattern
+          T value = static_cast<T>(q);
+          int idx = value - firstValueMapped;
+          if (monochrome || (supplemental && idx < 0))
+            {
+            // use monochrome
+            double fidx = (value - windowCenter)*windowScale + 127.5;
+            fidx = (fidx >= 0.0 ? fidx : 0.0);
+            fidx = (fidx <= 255.0 ? fidx : 255.0);
+            int gray = static_cast<int>(fidx + 0.5);
+            lp[0] = gray;
+            lp[1] = gray;
+            lp[2] = gray;
+            }
+          else
+            {
+            // use color
+            idx = (idx >= 0 ? idx : 0);
+            idx = (idx <= maxIdx ? idx : maxIdx);
+            const unsigned char *rgb = rgba + 4*idx;
+            lp[0] = rgb[0];
+            lp[1] = rgb[1];
+            lp[2] = rgb[2];
+            }
+          lp += 3;
+          }
+        }
+
       for (int yIdx = extent[2]; yIdx <= extent[3]; yIdx++)
         {
         T *inPtr = inPtrZ + inIncY*(yIdx - extent[2]);
@@ -181,6 +231,22 @@ void vtkDICOMApplyPaletteExecute(
             }
           }
 
+        if (lut)
+          {
+          // apply the precomputed table
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            const unsigned char *rgb =
+              lut + 3*(static_cast<unsigned int>(inPtr[0]) & maskValue);
+            outPtr[0] = rgb[0];
+            outPtr[1] = rgb[1];
+            outPtr[2] = rgb[2];
+            inPtr += inputComponents;
+            outPtr += outputComponents;
+            }
+          continue;
+          }
+
         for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
           {
           int idx = inPtr[0] - firstValueMapped;
@@ -316,13 +382,48 @@ int vtkDICOMApplyPalette::RequestData(
     return 1;
     }
 
-  // Build the lookup tables for all files that make up the volume
+  // Check whether the palette attributes are shared by all instances,
+  // which is the usual case for a series
+  static const DC::EnumType paletteTags[] = {
+    DC::PixelRepresentation,
+    DC::RedPaletteColorLookupTableDescriptor,
+    DC::GreenPaletteColorLookupTableDescriptor,
+    DC::BluePaletteColorLookupTableDescriptor,
+    DC::AlphaPaletteColorLookupTableDescriptor,
+    DC::RedPaletteColorLookupTableData,
+    DC::GreenPaletteColorLookupTableData,
+    DC::BluePaletteColorLookupTableData,
+    DC::AlphaPaletteColorLookupTableData,
+    DC::ItemDelimitationItem
+  };
+  bool sharedPalette = true;
+  for (const DC::EnumType *tagPtr = paletteTags;
+       *tagPtr != DC::ItemDelimitationItem;
+       tagPtr++)
+    {
+    vtkDICOMDataElementIterator iter = meta->Find(*tagPtr);
+    if (iter != meta->End() && iter->IsPerInstance())
+      {
+      sharedPalette = false;
+      break;
+      }
+    }
+
+  // Build the lookup tables for all files that make up the volume,
+  // one shared table suffices if the palette attributes are shared
   int n = meta->GetNumberOfInstances();
   this->Palette->resize(n);
   for (int i = 0; i < n; i++)
     {
-    (*(this->Palette))[i] = vtkSmartPointer<vtkDICOMLookupTable>::New();
-    (*(this->Palette))[i]->BuildImagePalette(meta, i);
+    if (sharedPalette && i > 0)
+      {
+      (*(this->Palette))[i] = (*(this->Palette))[0];
+      }
+    else
+      {
+      (*(this->Palette))[i] = vtkSmartPointer<vtkDICOMLookupTable>::New();
+      (*(this->Palette))[i]->BuildImagePalette(meta, i);
+      }
     }
 
   // Allow the superclass to call the ThreadedRequestData method
@@ -76,7 +76,8 @@ vtkDICOMApplyRescale::~vtkDICOMApplyRescale()
 //----------------------------------------------------------------------------
 void vtkDICOMApplyRescale::SetOutputScalarType(int t)
 {
-  if (t != this->OutputScalarType && (t == VTK_DOUBLE || t == VTK_FLOAT))
+  if (t != this->OutputScalarType &&
+      (t == VTK_DOUBLE || t == VTK_FLOAT || t == VTK_INT || t == VTK_SHORT))
     {
     this->OutputScalarType = t;
     this->Modified();
@@ -114,6 +115,24 @@ void vtkDICOMApplyRescaleExecute(
   target *= extent[3] - extent[2] + 1;
   vtkIdType progress = 0;
 
+  // the output is a pure function of the stored pixel value, and the
+  // template is only instantiated for 8-bit and 16-bit types, so the
+  // mapping can be flattened into a table of at most 65536 entries
+  // that is applied with a simple gather; the table carries over to
+  // the next slice whenever the mapping is unchanged
+  unsigned int maskValue = (sizeof(T) == 1 ? 0x00ff : 0xffff);
+  vtkIdType sliceVoxels = extent[1] - extent[0] + 1;
+  sliceVoxels *= extent[3] - extent[2] + 1;
+  bool useFlatTable =
+    (mapArray != 0 && sliceVoxels > static_cast<vtkIdType>(maskValue));
+  std::vector<F> flatTable;
+  vtkDICOMRealWorldMapping tableMapping;
+  bool tableValid = false;
+  if (useFlatTable)
+    {
+    flatTable.resize(maskValue + 1);
+    }
+
   for (int c = 0; c < numComponents; c++)
     {
     T *inPtrC = inPtr0 + c;
@@ -137,6 +156,39 @@ void vtkDICOMApplyRescaleExecute(
           }
         }
 
+      // compute the output for every possible stored pixel value
+      F *lut = 0;
+      if (useFlatTable && mapping != 0)
+        {
+        lut = &flatTable[0];
+        if (!tableValid ||
+            tableMapping.First != mapping->First ||
+            tableMapping.Last != mapping->Last ||
+            tableMapping.Slope != mapping->Slope ||
+            tableMapping.Intercept != mapping->Intercept ||
+            tableMapping.Map != mapping->Map)
+          {
+          tableMapping = *mapping;
+          tableValid = true;
+          const double *table = mapping->Map;
+          double m = mapping->Slope;
+          double b = mapping->Intercept;
+          F *lp = lut;
+          for (unsigned int q = 0; q <= maskValue; q++)
+            {
+            // recover the pixel value from its stored bit pattern
+            T value = static_cast<T>(q);
+            F r = 0;
+            if (value >= first && value <= last)
+              {
+              r = static_cast<F>(
+                table ? table[value - first] : value*m + b);
+              }
+            *lp++ = r;
+            }
+          }
+        }
+
       T *inPtrZ = inPtrC + (zIdx - extent[4])*inIncZ;
       F *outPtrZ = outPtrC + (zIdx - extent[4])*outIncZ;
 
@@ -156,7 +208,17 @@ void vtkDICOMApplyRescaleExecute(
             }
           }
 
-        if (mapping == 0)
+        if (lut)
+          {
+          // apply the flattened mapping
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            *outPtr = lut[static_cast<unsigned int>(*inPtr) & maskValue];
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else if (mapping == 0)
           {
           // no mapping to apply
           for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
@@ -208,6 +270,242 @@ void vtkDICOMApplyRescaleExecute(
     }
 }
 
+//----------------------------------------------------------------------------
+// Round to the nearest integer and saturate at the limits of the
+// output type.
+template<class F>
+F vtkDICOMApplyRescaleClamp(double v)
+{
+  double minval = vtkTypeTraits<F>::Min();
+  double maxval = vtkTypeTraits<F>::Max();
+  v = (v > minval ? v : minval);
+  v = (v < maxval ? v : maxval);
+  return static_cast<F>(floor(v + 0.5));
+}
+
+//----------------------------------------------------------------------------
+// This is used when the output type F is an integer type, it applies
+// the rescale with integer arithmetic whenever the slope and intercept
+// are integers and no intermediate value can overflow an int.
+template<class T, class F>
+void vtkDICOMApplyRescaleExecuteInt(
+  vtkDICOMApplyRescale *self, vtkImageData *inData, T *inPtr0,
+  vtkImageData *outData, F *outPtr0, vtkDICOMRealWorldMapping *mapArray,
+  int extent[6], int id)
+{
+  vtkIdType inIncX, inIncY, inIncZ;
+  inData->GetIncrements(inIncX, inIncY, inIncZ);
+  vtkIdType outIncX, outIncY, outIncZ;
+  outData->GetIncrements(outIncX, outIncY, outIncZ);
+  int numComponents = inData->GetNumberOfScalarComponents();
+  int wholeExtent[6];
+  outData->GetExtent(wholeExtent);
+
+  // the saturation limits for the output type
+  int minval = vtkTypeTraits<F>::Min();
+  int maxval = vtkTypeTraits<F>::Max();
+
+  // target for progress tracking
+  vtkIdType target = numComponents;
+  target *= extent[5] - extent[4] + 1;
+  target *= extent[3] - extent[2] + 1;
+  vtkIdType progress = 0;
+
+  // flatten the mapping into a table, exactly as in the generic
+  // execute method, but with the output rounded and saturated
+  unsigned int maskValue = (sizeof(T) == 1 ? 0x00ff : 0xffff);
+  vtkIdType sliceVoxels = extent[1] - extent[0] + 1;
+  sliceVoxels *= extent[3] - extent[2] + 1;
+  bool useFlatTable =
+    (mapArray != 0 && sliceVoxels > static_cast<vtkIdType>(maskValue));
+  std::vector<F> flatTable;
+  vtkDICOMRealWorldMapping tableMapping;
+  bool tableValid = false;
+  if (useFlatTable)
+    {
+    flatTable.resize(maskValue + 1);
+    }
+
+  for (int c = 0; c < numComponents; c++)
+    {
+    T *inPtrC = inPtr0 + c;
+    F *outPtrC = outPtr0 + c;
+
+    for (int zIdx = extent[4]; zIdx <= extent[5]; zIdx++)
+      {
+      vtkDICOMRealWorldMapping *mapping = 0;
+      T first = vtkTypeTraits<T>::Min();
+      T last = vtkTypeTraits<T>::Max();
+      if (mapArray)
+        {
+        mapping = &mapArray[(zIdx - wholeExtent[4])*numComponents + c];
+        if (mapping->First > static_cast<int>(first))
+          {
+          first = static_cast<T>(mapping->First);
+          }
+        if (mapping->Last < static_cast<int>(last))
+          {
+          last = static_cast<T>(mapping->Last);
+          }
+        }
+
+      // compute the output for every possible stored pixel value
+      F *lut = 0;
+      if (useFlatTable && mapping != 0)
+        {
+        lut = &flatTable[0];
+        if (!tableValid ||
+            tableMapping.First != mapping->First ||
+            tableMapping.Last != mapping->Last ||
+            tableMapping.Slope != mapping->Slope ||
+            tableMapping.Intercept != mapping->Intercept ||
+            tableMapping.Map != mapping->Map)
+          {
+          tableMapping = *mapping;
+          tableValid = true;
+          const double *table = mapping->Map;
+          double m = mapping->Slope;
+          double b = mapping->Intercept;
+          F *lp = lut;
+          for (unsigned int q = 0; q <= maskValue; q++)
+            {
+            // recover the pixel value from its stored bit pattern
+            T value = static_cast<T>(q);
+            F r = 0;
+            if (value >= first && value <= last)
+              {
+              r = vtkDICOMApplyRescaleClamp<F>(
+                table ? table[value - first] : value*m + b);
+              }
+            *lp++ = r;
+            }
+          }
+        }
+
+      // check whether integer arithmetic can be used for this slice
+      bool isInteger = false;
+      int mi = 0;
+      int bi = 0;
+      if (mapping && mapping->Map == 0)
+        {
+        double m = mapping->Slope;
+        double b = mapping->Intercept;
+        double v1 = first*m + b;
+        double v2 = last*m + b;
+        if (m == floor(m) && b == floor(b) &&
+            v1 >= VTK_INT_MIN && v1 <= VTK_INT_MAX &&
+            v2 >= VTK_INT_MIN && v2 <= VTK_INT_MAX)
+          {
+          isInteger = true;
+          mi = static_cast<int>(m);
+          bi = static_cast<int>(b);
+          }
+        }
+
+      T *inPtrZ = inPtrC + (zIdx - extent[4])*inIncZ;
+      F *outPtrZ = outPtrC + (zIdx - extent[4])*outIncZ;
+
+      for (int yIdx = extent[2]; yIdx <= extent[3]; yIdx++)
+        {
+        T *inPtr = inPtrZ + inIncY*(yIdx - extent[2]);
+        F *outPtr = outPtrZ + outIncY*(yIdx - extent[2]);
+
+        // in base thread, report progress every 2% of the way to 100%
+        if (id == 0)
+          {
+          ++progress;
+          vtkIdType icount = progress*50/target;
+          if (progress == icount*target/50)
+            {
+            self->UpdateProgress(progress*1.0/target);
+            }
+          }
+
+        if (lut)
+          {
+          // apply the flattened mapping
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            *outPtr = lut[static_cast<unsigned int>(*inPtr) & maskValue];
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else if (mapping == 0)
+          {
+          // no mapping to apply, but saturation is still needed
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            int v = *inPtr;
+            v = (v > minval ? v : minval);
+            v = (v < maxval ? v : maxval);
+            *outPtr = static_cast<F>(v);
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else if (mapping->Map)
+          {
+          // apply lookup table
+          const double *table = mapping->Map;
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            if (*inPtr >= first && *inPtr <= last)
+              {
+              *outPtr = vtkDICOMApplyRescaleClamp<F>(table[*inPtr - first]);
+              }
+            else
+              {
+              *outPtr = 0;
+              }
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else if (isInteger)
+          {
+          // apply slope and intercept with integer arithmetic
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            if (*inPtr >= first && *inPtr <= last)
+              {
+              int v = *inPtr*mi + bi;
+              v = (v > minval ? v : minval);
+              v = (v < maxval ? v : maxval);
+              *outPtr = static_cast<F>(v);
+              }
+            else
+              {
+              *outPtr = 0;
+              }
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else
+          {
+          // apply slope and intercept, then round
+          double m = mapping->Slope;
+          double b = mapping->Intercept;
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            if (*inPtr >= first && *inPtr <= last)
+              {
+              *outPtr = vtkDICOMApplyRescaleClamp<F>(*inPtr*m + b);
+              }
+            else
+              {
+              *outPtr = 0;
+              }
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        }
+      }
+    }
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -407,4 +705,24 @@ void vtkDICOMApplyRescale::ThreadedRequestData(
           static_cast<double *>(outVoidPtr), this->Mapping, extent, id));
       }
     }
+  else if (outScalarType == VTK_INT)
+    {
+    switch (scalarType)
+      {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyRescaleExecuteInt(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<int *>(outVoidPtr), this->Mapping, extent, id));
+      }
+    }
+  else if (outScalarType == VTK_SHORT)
+    {
+    switch (scalarType)
+      {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyRescaleExecuteInt(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<short *>(outVoidPtr), this->Mapping, extent, id));
+      }
+    }
 }
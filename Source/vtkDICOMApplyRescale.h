@@ -44,12 +44,23 @@ public:
   virtual void PrintSelf(ostream& os, vtkIndent indent);
 
   // Description:
-  // Set the output data type to float or double (default is double).
+  // Set the output data type (default is double).
+  // In addition to float and double, the output can be short or int:
+  // this cuts the memory use when the rescaled values are known to be
+  // integers, as is common for CT.  For integer output, the rescale is
+  // done in integer arithmetic if the slope and intercept are integral,
+  // otherwise the values are rounded to the nearest integer.  Any value
+  // outside the range of the output type saturates at the limits of
+  // that range.
   void SetOutputScalarType(int t);
   void SetOutputScalarTypeToFloat() {
     this->SetOutputScalarType(VTK_FLOAT); }
   void SetOutputScalarTypeToDouble() {
     this->SetOutputScalarType(VTK_DOUBLE); }
+  void SetOutputScalarTypeToInt() {
+    this->SetOutputScalarType(VTK_INT); }
+  void SetOutputScalarTypeToShort() {
+    this->SetOutputScalarType(VTK_SHORT); }
   int GetOutputScalarType() {
     return this->OutputScalarType; }
 
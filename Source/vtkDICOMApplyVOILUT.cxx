@@ -0,0 +1,583 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMApplyVOILUT.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMItem.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkImageData.h>
+#include <vtkInformationVector.h>
+#include <vtkInformation.h>
+#include <vtkIntArray.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkDataSetAttributes.h>
+#include "vtkPointData.h"
+#include <vtkSmartPointer.h>
+#include <vtkTypeTraits.h>
+#include <vtkVersion.h>
+
+#include "vtkTemplateAliasMacro.h"
+// turn off unused input types
+# undef VTK_USE_INT64
+# define VTK_USE_INT64 0
+# undef VTK_USE_UINT64
+# define VTK_USE_UINT64 0
+# undef VTK_USE_INT32
+# define VTK_USE_INT32 0
+# undef VTK_USE_UINT32
+# define VTK_USE_UINT32 0
+
+#include <math.h>
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMApplyVOILUT);
+
+//----------------------------------------------------------------------------
+// The transformations that the VOI attributes can describe
+enum
+{
+  VOILUT_NONE = 0,
+  VOILUT_LINEAR = 1,
+  VOILUT_LINEAR_EXACT = 2,
+  VOILUT_SIGMOID = 3,
+  VOILUT_LUT = 4
+};
+
+//----------------------------------------------------------------------------
+// A struct to hold the VOI transform for one slice and component
+class vtkDICOMVOILUTMapping
+{
+public:
+  int Function;
+  double Center;
+  double Width;
+  int First;
+  int Count;
+  double Divisor;
+  const unsigned short *Map;
+  const unsigned char *MapC;
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMApplyVOILUT::vtkDICOMApplyVOILUT()
+{
+  this->Mapping = 0;
+  this->OutputScalarType = VTK_UNSIGNED_CHAR;
+  this->OutputRange[0] = 0.0;
+  this->OutputRange[1] = 255.0;
+  this->WindowIndex = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMApplyVOILUT::~vtkDICOMApplyVOILUT()
+{
+  delete [] this->Mapping;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMApplyVOILUT::SetOutputScalarType(int t)
+{
+  if (t != this->OutputScalarType &&
+      (t == VTK_UNSIGNED_CHAR || t == VTK_UNSIGNED_SHORT || t == VTK_FLOAT))
+    {
+    this->OutputScalarType = t;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMApplyVOILUT::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "OutputScalarType: " << this->OutputScalarType << "\n";
+  os << indent << "OutputRange: " << this->OutputRange[0] << " "
+     << this->OutputRange[1] << "\n";
+  os << indent << "WindowIndex: " << this->WindowIndex << "\n";
+}
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+//----------------------------------------------------------------------------
+// Apply the VOI transform to one value, the result lies between
+// ylo and ylo + yrange.
+double vtkDICOMApplyVOILUTCompute(
+  const vtkDICOMVOILUTMapping *mapping, double v, double ylo, double yrange)
+{
+  double y = 0.0;
+
+  switch (mapping->Function)
+    {
+    case VOILUT_LUT:
+      {
+      // values beyond the table clamp to its first and last entries
+      double i = v - mapping->First;
+      double last = mapping->Count - 1;
+      i = (i > 0 ? i : 0);
+      i = (i < last ? i : last);
+      int idx = static_cast<int>(i);
+      double e = (mapping->Map ?
+                  static_cast<double>(mapping->Map[idx]) :
+                  static_cast<double>(mapping->MapC[idx]));
+      y = e/mapping->Divisor;
+      }
+      break;
+    case VOILUT_LINEAR:
+      {
+      // see DICOM PS3.3 C.11.2.1.2, note the half-unit offsets
+      double c = mapping->Center - 0.5;
+      double w = mapping->Width - 1.0;
+      if (w <= 0)
+        {
+        y = (v <= c ? 0.0 : 1.0);
+        }
+      else
+        {
+        y = (v - c)/w + 0.5;
+        y = (y > 0 ? y : 0);
+        y = (y < 1 ? y : 1);
+        }
+      }
+      break;
+    case VOILUT_LINEAR_EXACT:
+      {
+      y = (v - mapping->Center)/mapping->Width + 0.5;
+      y = (y > 0 ? y : 0);
+      y = (y < 1 ? y : 1);
+      }
+      break;
+    case VOILUT_SIGMOID:
+      {
+      y = 1.0/(1.0 + exp(-4.0*(v - mapping->Center)/mapping->Width));
+      }
+      break;
+    }
+
+  return ylo + y*yrange;
+}
+
+//----------------------------------------------------------------------------
+// Convert the computed display value to the output type, rounding
+// for the integer output types.
+template<class F>
+F vtkDICOMApplyVOILUTRound(double v)
+{
+  return static_cast<F>(floor(v + 0.5));
+}
+
+template<>
+float vtkDICOMApplyVOILUTRound<float>(double v)
+{
+  return static_cast<float>(v);
+}
+
+//----------------------------------------------------------------------------
+template<class T, class F>
+void vtkDICOMApplyVOILUTExecute(
+  vtkDICOMApplyVOILUT *self, vtkImageData *inData, T *inPtr0,
+  vtkImageData *outData, F *outPtr0, vtkDICOMVOILUTMapping *mapArray,
+  const double outputRange[2], int extent[6], int id)
+{
+  vtkIdType inIncX, inIncY, inIncZ;
+  inData->GetIncrements(inIncX, inIncY, inIncZ);
+  vtkIdType outIncX, outIncY, outIncZ;
+  outData->GetIncrements(outIncX, outIncY, outIncZ);
+  int numComponents = inData->GetNumberOfScalarComponents();
+  int wholeExtent[6];
+  outData->GetExtent(wholeExtent);
+
+  double ylo = outputRange[0];
+  double yhi = outputRange[1];
+  double yrange = yhi - ylo;
+
+  // target for progress tracking
+  vtkIdType target = numComponents;
+  target *= extent[5] - extent[4] + 1;
+  target *= extent[3] - extent[2] + 1;
+  vtkIdType progress = 0;
+
+  // the output is a pure function of the stored pixel value, so for
+  // 8-bit and 16-bit input the transform is flattened into a table of
+  // at most 65536 entries that is applied with a simple gather; the
+  // table carries over to the next slice whenever the VOI attributes
+  // are unchanged
+  unsigned int maskValue = (sizeof(T) == 1 ? 0x00ff : 0xffff);
+  vtkIdType sliceVoxels = extent[1] - extent[0] + 1;
+  sliceVoxels *= extent[3] - extent[2] + 1;
+  bool useFlatTable =
+    (sizeof(T) <= 2 && sliceVoxels > static_cast<vtkIdType>(maskValue));
+  std::vector<F> flatTable;
+  vtkDICOMVOILUTMapping tableMapping;
+  bool tableValid = false;
+  if (useFlatTable)
+    {
+    flatTable.resize(maskValue + 1);
+    }
+
+  for (int c = 0; c < numComponents; c++)
+    {
+    T *inPtrC = inPtr0 + c;
+    F *outPtrC = outPtr0 + c;
+
+    for (int zIdx = extent[4]; zIdx <= extent[5]; zIdx++)
+      {
+      vtkDICOMVOILUTMapping *mapping =
+        &mapArray[(zIdx - wholeExtent[4])*numComponents + c];
+
+      // compute the output for every possible stored pixel value
+      F *lut = 0;
+      if (useFlatTable)
+        {
+        lut = &flatTable[0];
+        if (!tableValid ||
+            tableMapping.Function != mapping->Function ||
+            tableMapping.Center != mapping->Center ||
+            tableMapping.Width != mapping->Width ||
+            tableMapping.First != mapping->First ||
+            tableMapping.Count != mapping->Count ||
+            tableMapping.Map != mapping->Map ||
+            tableMapping.MapC != mapping->MapC)
+          {
+          tableMapping = *mapping;
+          tableValid = true;
+          F *lp = lut;
+          for (unsigned int q = 0; q <= maskValue; q++)
+            {
+            // recover the pixel value from its stored bit pattern
+            double v = static_cast<T>(q);
+            double r;
+            if (mapping->Function == VOILUT_NONE)
+              {
+              r = (v > ylo ? v : ylo);
+              r = (r < yhi ? r : yhi);
+              }
+            else
+              {
+              r = vtkDICOMApplyVOILUTCompute(mapping, v, ylo, yrange);
+              }
+            *lp++ = vtkDICOMApplyVOILUTRound<F>(r);
+            }
+          }
+        }
+
+      T *inPtrZ = inPtrC + (zIdx - extent[4])*inIncZ;
+      F *outPtrZ = outPtrC + (zIdx - extent[4])*outIncZ;
+
+      for (int yIdx = extent[2]; yIdx <= extent[3]; yIdx++)
+        {
+        T *inPtr = inPtrZ + inIncY*(yIdx - extent[2]);
+        F *outPtr = outPtrZ + outIncY*(yIdx - extent[2]);
+
+        // in base thread, report progress every 2% of the way to 100%
+        if (id == 0)
+          {
+          ++progress;
+          vtkIdType icount = progress*50/target;
+          if (progress == icount*target/50)
+            {
+            self->UpdateProgress(progress*1.0/target);
+            }
+          }
+
+        if (lut)
+          {
+          // apply the flattened transform
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            *outPtr = lut[static_cast<unsigned int>(*inPtr) & maskValue];
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else if (mapping->Function == VOILUT_NONE)
+          {
+          // no VOI for this slice, clamp to the output range
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            double v = *inPtr;
+            v = (v > ylo ? v : ylo);
+            v = (v < yhi ? v : yhi);
+            *outPtr = vtkDICOMApplyVOILUTRound<F>(v);
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        else
+          {
+          // apply the transform one value at a time
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+            {
+            *outPtr = vtkDICOMApplyVOILUTRound<F>(
+              vtkDICOMApplyVOILUTCompute(mapping, *inPtr, ylo, yrange));
+            inPtr += numComponents;
+            outPtr += numComponents;
+            }
+          }
+        }
+      }
+    }
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+int vtkDICOMApplyVOILUT::RequestInformation(
+  vtkInformation* request,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  this->Superclass::RequestInformation(request, inputVector, outputVector);
+
+  // Get the scalar information
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(inInfo,
+    vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  int numComponents =
+    scalarInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS());
+
+  // Set the output information.
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataObject::SetPointDataActiveScalarInfo(
+    outInfo, this->OutputScalarType, numComponents);
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMApplyVOILUT::RequestData(
+  vtkInformation* request,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  // Get the scalar information
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(inInfo,
+    vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  int numComponents =
+    scalarInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS());
+
+  // Get the whole extent from the output port
+  int extent[6];
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+
+  // Get the meta data
+  vtkInformation *metaInfo = this->GetMetaDataInformation(inputVector, 0, 0);
+  vtkDICOMMetaData *meta = vtkDICOMMetaData::SafeDownCast(
+      metaInfo->Get(vtkDICOMAlgorithm::META_DATA()));
+
+  if (meta)
+    {
+    size_t sz = (static_cast<size_t>(numComponents)*
+                 static_cast<size_t>(extent[5] - extent[4] + 1));
+    this->Mapping = new vtkDICOMVOILUTMapping[sz];
+    bool hasVOI = false;
+
+    for (int c = 0; c < numComponents; c++)
+      {
+      for (int zIdx = extent[4]; zIdx <= extent[5]; zIdx++)
+        {
+        vtkDICOMVOILUTMapping *mapping =
+          &this->Mapping[(zIdx - extent[4])*numComponents + c];
+        mapping->Function = VOILUT_NONE;
+        mapping->Center = 0.0;
+        mapping->Width = 0.0;
+        mapping->First = 0;
+        mapping->Count = 0;
+        mapping->Divisor = 1.0;
+        mapping->Map = 0;
+        mapping->MapC = 0;
+
+        int i = meta->GetFileIndex(zIdx, c, numComponents);
+        int j = meta->GetFrameIndex(zIdx, c, numComponents);
+
+        // use the first item of the VOI LUT sequence, if present
+        const vtkDICOMValue& seq = meta->GetAttributeValue(
+          i, j, DC::VOILUTSequence);
+        const vtkDICOMItem *item = seq.GetSequenceData();
+        if (item && seq.GetNumberOfValues() > 0)
+          {
+          const vtkDICOMValue& desc =
+            item->GetAttributeValue(DC::LUTDescriptor);
+          const vtkDICOMValue& data =
+            item->GetAttributeValue(DC::LUTData);
+          if (desc.GetNumberOfValues() == 3)
+            {
+            // first descriptor value is the size of the table
+            int n = desc.GetUnsignedShort(0);
+            n = (n == 0 ? 65536 : n);
+
+            // second value is the first pixel value that is mapped
+            bool isSigned = (meta->GetAttributeValue(
+              i, DC::PixelRepresentation).AsInt() != 0);
+            unsigned short f = desc.GetUnsignedShort(1);
+            mapping->First = (isSigned ? static_cast<short>(f) : f);
+            mapping->Count = n;
+
+            // third value is the number of bits per table entry
+            int nbits = desc.GetUnsignedShort(2);
+            mapping->Divisor = (nbits == 0 ? 1.0 : (1u << nbits) - 1.0);
+
+            // get the lookup table data and confirm its size
+            if (data.GetVL() >= static_cast<unsigned int>(2*n))
+              {
+              mapping->Map = data.GetUnsignedShortData();
+              }
+            else if (data.GetVL() >= static_cast<unsigned int>(n))
+              {
+              mapping->MapC = data.GetUnsignedCharData();
+              if (mapping->MapC == 0)
+                {
+                mapping->MapC = reinterpret_cast<const unsigned char *>(
+                  data.GetUnsignedShortData());
+                }
+              }
+
+            if (mapping->Map || mapping->MapC)
+              {
+              mapping->Function = VOILUT_LUT;
+              hasVOI = true;
+              }
+            }
+          }
+
+        // otherwise, use the window center and width
+        if (mapping->Function == VOILUT_NONE)
+          {
+          const vtkDICOMValue& wc = meta->GetAttributeValue(
+            i, j, DC::WindowCenter);
+          const vtkDICOMValue& ww = meta->GetAttributeValue(
+            i, j, DC::WindowWidth);
+          size_t nc = wc.GetNumberOfValues();
+          size_t nw = ww.GetNumberOfValues();
+          if (nc > 0 && nw > 0)
+            {
+            // select one of the windows that are present
+            size_t widx = (this->WindowIndex > 0 ?
+                           static_cast<size_t>(this->WindowIndex) : 0);
+            double width = ww.GetDouble(widx < nw ? widx : nw - 1);
+            double center = wc.GetDouble(widx < nc ? widx : nc - 1);
+            if (width > 0)
+              {
+              mapping->Center = center;
+              mapping->Width = width;
+              mapping->Function = VOILUT_LINEAR;
+              std::string fs = meta->GetAttributeValue(
+                i, j, DC::VOILUTFunction).AsString();
+              if (fs == "LINEAR_EXACT")
+                {
+                mapping->Function = VOILUT_LINEAR_EXACT;
+                }
+              else if (fs == "SIGMOID")
+                {
+                mapping->Function = VOILUT_SIGMOID;
+                }
+              hasVOI = true;
+              }
+            }
+          }
+        }
+      }
+
+    if (!hasVOI)
+      {
+      delete [] this->Mapping;
+      this->Mapping = 0;
+      }
+    }
+
+  // Passthrough if there are no VOI attributes to apply
+  int rval = 1;
+  if (this->Mapping == 0)
+    {
+    vtkImageData *inData =
+      vtkImageData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+    vtkImageData *outData =
+      static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+    outData->CopyStructure(inData);
+    outData->GetPointData()->PassData(inData->GetPointData());
+    }
+  else
+    {
+    // Allow the superclass to call the ThreadedRequestData method
+    rval = this->Superclass::RequestData(
+      request, inputVector, outputVector);
+    }
+
+  delete [] this->Mapping;
+  this->Mapping = 0;
+
+  return rval;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMApplyVOILUT::ThreadedRequestData(
+    vtkInformation *vtkNotUsed(request),
+    vtkInformationVector **inputVector,
+    vtkInformationVector *outputVector,
+    vtkImageData ***,
+    vtkImageData **,
+    int extent[6], int id)
+{
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  vtkImageData *inData =
+    vtkImageData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+  vtkImageData *outData =
+    static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  int scalarType = inData->GetScalarType();
+  void *inVoidPtr = inData->GetScalarPointerForExtent(extent);
+  void *outVoidPtr = outData->GetScalarPointerForExtent(extent);
+
+  int outScalarType = outData->GetScalarType();
+
+  if (outScalarType == VTK_UNSIGNED_CHAR)
+    {
+    switch (scalarType)
+      {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyVOILUTExecute(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<unsigned char *>(outVoidPtr), this->Mapping,
+          this->OutputRange, extent, id));
+      }
+    }
+  else if (outScalarType == VTK_UNSIGNED_SHORT)
+    {
+    switch (scalarType)
+      {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyVOILUTExecute(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<unsigned short *>(outVoidPtr), this->Mapping,
+          this->OutputRange, extent, id));
+      }
+    }
+  else if (outScalarType == VTK_FLOAT)
+    {
+    switch (scalarType)
+      {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyVOILUTExecute(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<float *>(outVoidPtr), this->Mapping,
+          this->OutputRange, extent, id));
+      }
+    }
+}
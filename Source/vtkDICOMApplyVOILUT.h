@@ -0,0 +1,107 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// .NAME vtkDICOMApplyVOILUT - Apply the DICOM VOI LUT or window.
+// .SECTION Description
+// This filter maps stored pixel values to display values according to
+// the VOI LUT attributes in the DICOM meta data.  It uses the first
+// item of the VOILUTSequence if one is present, otherwise it applies
+// the WindowCenter and WindowWidth with the transformation named by
+// VOILUTFunction (LINEAR, LINEAR_EXACT, or SIGMOID).  Images without
+// any VOI attributes pass through unchanged.  Note that if this filter
+// is used on CT images, then vtkDICOMApplyRescale should be applied
+// first (or AutoRescale left on at the reader), because the window
+// attributes are expressed in rescaled units.  Like all filters in
+// VTK-DICOM this filter streams, so it can run inside a
+// vtkDICOMFilterChain without producing a full-size intermediate.
+
+#ifndef vtkDICOMApplyVOILUT_h
+#define vtkDICOMApplyVOILUT_h
+
+#include "vtkDICOMAlgorithm.h"
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkDICOMVOILUTMapping;
+
+class VTKDICOM_EXPORT vtkDICOMApplyVOILUT :
+  public vtkDICOMAlgorithm
+{
+public:
+  vtkTypeMacro(vtkDICOMApplyVOILUT, vtkDICOMAlgorithm);
+
+  // Description:
+  // Static method for construction.
+  static vtkDICOMApplyVOILUT *New();
+
+  // Description:
+  // Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  // Description:
+  // Set the output data type (default is unsigned char).
+  // Use unsigned short when the display range has more than 256
+  // levels, or float when the values will be processed further.
+  void SetOutputScalarType(int t);
+  void SetOutputScalarTypeToUnsignedChar() {
+    this->SetOutputScalarType(VTK_UNSIGNED_CHAR); }
+  void SetOutputScalarTypeToUnsignedShort() {
+    this->SetOutputScalarType(VTK_UNSIGNED_SHORT); }
+  void SetOutputScalarTypeToFloat() {
+    this->SetOutputScalarType(VTK_FLOAT); }
+  int GetOutputScalarType() {
+    return this->OutputScalarType; }
+
+  // Description:
+  // Set the output range (default: 0 255).
+  // The smallest and largest display values that the VOI transform
+  // produces.  For integer output the range is also the saturation
+  // limit, so it must fit within the output data type.
+  vtkSetVector2Macro(OutputRange, double);
+  vtkGetVector2Macro(OutputRange, double);
+
+  // Description:
+  // Select which window to use if several are present (default: 0).
+  // The WindowCenter and WindowWidth attributes are multi-valued when
+  // a file provides more than one preset.  If the index is beyond the
+  // number of values present, the last value is used.
+  vtkSetMacro(WindowIndex, int);
+  vtkGetMacro(WindowIndex, int);
+
+protected:
+  vtkDICOMApplyVOILUT();
+  ~vtkDICOMApplyVOILUT();
+
+  virtual int RequestInformation(
+    vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector);
+
+  virtual int RequestData(
+    vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector);
+
+  virtual void ThreadedRequestData(
+    vtkInformation *request, vtkInformationVector **inputVector,
+    vtkInformationVector *outputVector, vtkImageData ***inData,
+    vtkImageData **outData, int ext[6], int id);
+
+  vtkDICOMVOILUTMapping *Mapping;
+  int OutputScalarType;
+  double OutputRange[2];
+  int WindowIndex;
+
+private:
+  vtkDICOMApplyVOILUT(const vtkDICOMApplyVOILUT&);  // Not implemented.
+  void operator=(const vtkDICOMApplyVOILUT&);  // Not implemented.
+};
+
+#endif // vtkDICOMApplyVOILUT_h
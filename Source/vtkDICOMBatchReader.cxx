@@ -0,0 +1,212 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMBatchReader.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMReader.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkImageData.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMBatchReader);
+
+//----------------------------------------------------------------------------
+// the queued series, stored in the order that they were added
+class vtkDICOMBatchReaderInternals
+{
+public:
+  std::vector<vtkStringArray *> Series;
+};
+
+//----------------------------------------------------------------------------
+// this friendship class allows the worker threads to call the
+// protected methods of the batch reader
+class vtkDICOMBatchReaderFriendship
+{
+public:
+  static vtkIdType ClaimSeries(vtkDICOMBatchReader *self)
+    {
+    return self->ClaimSeries();
+    }
+
+  static bool ReadSeries(
+    vtkDICOMBatchReader *self, vtkIdType seriesId, void *reader)
+    {
+    return self->ReadSeries(seriesId, reader);
+    }
+};
+
+//----------------------------------------------------------------------------
+// the method that is executed by each of the worker threads
+static VTK_THREAD_RETURN_TYPE vtkDICOMBatchReaderThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMBatchReader *self =
+    static_cast<vtkDICOMBatchReader *>(ti->UserData);
+
+  // each worker creates one reader and re-uses it for every series
+  // that it claims, so the reader's setup cost (the parser, the
+  // sorter, the properties) is paid once per worker, not per series
+  vtkSmartPointer<vtkDICOMReader> reader =
+    vtkSmartPointer<vtkDICOMReader>::New();
+
+  for (;;)
+    {
+    vtkIdType seriesId = vtkDICOMBatchReaderFriendship::ClaimSeries(self);
+    if (seriesId < 0)
+      {
+      break;
+      }
+    vtkDICOMBatchReaderFriendship::ReadSeries(self, seriesId, reader);
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMBatchReader::vtkDICOMBatchReader()
+{
+  this->Internals = new vtkDICOMBatchReaderInternals;
+  this->Threader = vtkMultiThreader::New();
+  this->Lock = new vtkSimpleCriticalSection;
+  this->Callback = 0;
+  this->CallbackClientData = 0;
+  this->NumberOfThreads = 4;
+  this->NextIndex = 0;
+  this->FailedCount = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMBatchReader::~vtkDICOMBatchReader()
+{
+  std::vector<vtkStringArray *>& series = this->Internals->Series;
+  for (size_t i = 0; i < series.size(); i++)
+    {
+    series[i]->Delete();
+    }
+  delete this->Internals;
+  this->Threader->Delete();
+  delete this->Lock;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMBatchReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "NumberOfQueuedSeries: "
+     << this->Internals->Series.size() << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMBatchReader::SetCompletionCallback(
+  CompletionFunction f, void *clientData)
+{
+  if (f != this->Callback || clientData != this->CallbackClientData)
+    {
+    this->Callback = f;
+    this->CallbackClientData = clientData;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMBatchReader::QueueSeries(vtkStringArray *fileNames)
+{
+  fileNames->Register(this);
+  this->Internals->Series.push_back(fileNames);
+  return static_cast<vtkIdType>(this->Internals->Series.size() - 1);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMBatchReader::ExecuteBatch()
+{
+  std::vector<vtkStringArray *>& series = this->Internals->Series;
+
+  this->NextIndex = 0;
+  this->FailedCount = 0;
+
+  if (!series.empty())
+    {
+    int n = this->NumberOfThreads;
+    n = (n > 0 ? n : 1);
+    if (static_cast<size_t>(n) > series.size())
+      {
+      n = static_cast<int>(series.size());
+      }
+    this->Threader->SetNumberOfThreads(n);
+    this->Threader->SetSingleMethod(&vtkDICOMBatchReaderThread, this);
+    this->Threader->SingleMethodExecute();
+    }
+
+  // the batch is done, clear the queue
+  for (size_t i = 0; i < series.size(); i++)
+    {
+    series[i]->Delete();
+    }
+  series.clear();
+
+  return this->FailedCount;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMBatchReader::ClaimSeries()
+{
+  vtkIdType n = static_cast<vtkIdType>(this->Internals->Series.size());
+  vtkIdType idx = -1;
+
+  this->Lock->Lock();
+  if (this->NextIndex < n)
+    {
+    idx = this->NextIndex++;
+    }
+  this->Lock->Unlock();
+
+  return idx;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBatchReader::ReadSeries(vtkIdType seriesId, void *rp)
+{
+  vtkDICOMReader *reader = static_cast<vtkDICOMReader *>(rp);
+  vtkStringArray *fileNames = this->Internals->Series[seriesId];
+
+  reader->SetFileNames(fileNames);
+  reader->Update();
+
+  bool success = (reader->GetErrorCode() == 0);
+
+  if (this->Callback)
+    {
+    vtkImageData *data = (success ? reader->GetOutput() : 0);
+    this->Callback(this, seriesId, data, reader->GetMetaData(),
+                   this->CallbackClientData);
+    }
+
+  if (!success)
+    {
+    this->Lock->Lock();
+    this->FailedCount++;
+    this->Lock->Unlock();
+    }
+
+  return success;
+}
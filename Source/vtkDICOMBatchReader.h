@@ -0,0 +1,131 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMBatchReader_h
+#define vtkDICOMBatchReader_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkStringArray;
+class vtkImageData;
+class vtkMultiThreader;
+class vtkSimpleCriticalSection;
+class vtkDICOMMetaData;
+class vtkDICOMBatchReaderInternals;
+class vtkDICOMBatchReaderFriendship;
+
+//! Read a large batch of small series with a shared pool of readers.
+/*!
+ *  When thousands of small series are read one after the other, the
+ *  setup cost of each vtkDICOMReader (the parser, the slice sorter,
+ *  the conversion of the meta data into properties) is paid once per
+ *  series and can rival the cost of reading the slices themselves.
+ *  This class queues up many series and executes them on a pool of
+ *  worker threads, where each worker re-uses a single reader for all
+ *  of the series that it claims, so the setup cost is amortized over
+ *  the whole batch.  The results are delivered through a completion
+ *  callback that is invoked from the worker threads as each series
+ *  finishes.
+ */
+class VTKDICOM_EXPORT vtkDICOMBatchReader : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMBatchReader *New();
+  vtkTypeMacro(vtkDICOMBatchReader, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //! The signature of the completion callback.
+  /*!
+   *  The callback receives the identifier that QueueSeries() returned
+   *  for the series, the image data, and the meta data.  If the series
+   *  could not be read, then the image data will be a null pointer.
+   *  The callback is invoked from the worker threads, so it must be
+   *  thread safe, and the data and meta data belong to the worker's
+   *  reader: they are only valid for the duration of the call, and
+   *  anything to be kept must be copied before the callback returns.
+   */
+  typedef void (*CompletionFunction)(
+    vtkDICOMBatchReader *self, vtkIdType seriesId,
+    vtkImageData *data, vtkDICOMMetaData *meta, void *clientData);
+
+  //@{
+  //! Set the callback through which results are delivered.
+  void SetCompletionCallback(CompletionFunction f, void *clientData);
+  //@}
+
+  //@{
+  //! The number of worker threads to use (default: four).
+  /*!
+   *  Each worker owns one reader, so this is also the number of
+   *  series that are held in memory at any one time.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  int GetNumberOfThreads() { return this->NumberOfThreads; }
+  //@}
+
+  //@{
+  //! Add a series to the queue, given its sorted list of files.
+  /*!
+   *  The identifier that is returned is passed to the completion
+   *  callback when the series has been read.  The file name array
+   *  must not be modified until the batch has been executed.
+   */
+  vtkIdType QueueSeries(vtkStringArray *fileNames);
+
+  //! Read all of the queued series, then clear the queue.
+  /*!
+   *  This blocks until every series in the queue has been read and
+   *  its completion callback has returned.  The number of series
+   *  that could not be read is returned.
+   */
+  vtkIdType ExecuteBatch();
+  //@}
+
+protected:
+  vtkDICOMBatchReader();
+  ~vtkDICOMBatchReader();
+
+  //! Claim the next queued series, or a negative value if none remain.
+  vtkIdType ClaimSeries();
+
+  //! Read one series and deliver it through the callback.
+  /*!
+   *  The reader is the claiming worker's own reader, which is re-used
+   *  for every series that the worker claims.  The return value is
+   *  true if the series was read successfully.
+   */
+  bool ReadSeries(vtkIdType seriesId, void *reader);
+
+  vtkDICOMBatchReaderInternals *Internals;
+  vtkMultiThreader *Threader;
+  vtkSimpleCriticalSection *Lock;
+  CompletionFunction Callback;
+  void *CallbackClientData;
+  int NumberOfThreads;
+  vtkIdType NextIndex;   // guarded by Lock
+  vtkIdType FailedCount; // guarded by Lock
+
+private:
+  friend class vtkDICOMBatchReaderFriendship;
+
+  vtkDICOMBatchReader(const vtkDICOMBatchReader&);  // Not implemented.
+  void operator=(const vtkDICOMBatchReader&);  // Not implemented.
+};
+
+#endif // vtkDICOMBatchReader_h
@@ -0,0 +1,380 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMBundle.h"
+#include "vtkDICOMFile.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkTypeInt64Array.h>
+
+#include <string.h>
+
+vtkStandardNewMacro(vtkDICOMBundle);
+
+namespace {
+
+// the signature at the start of every bundle file
+const char vtkDICOMBundleMagic[8] = {
+  'D', 'I', 'C', 'M', 'B', 'N', 'D', 'L'
+};
+
+// the current version of the bundle format
+const unsigned int vtkDICOMBundleVersion = 1;
+
+// the size of the fixed part of the header
+const vtkTypeInt64 vtkDICOMBundleHeaderSize = 16;
+
+// pack a 32-bit integer as little-endian
+void vtkDICOMBundlePutInt32(unsigned char *cp, unsigned int v)
+{
+  cp[0] = static_cast<unsigned char>(v);
+  cp[1] = static_cast<unsigned char>(v >> 8);
+  cp[2] = static_cast<unsigned char>(v >> 16);
+  cp[3] = static_cast<unsigned char>(v >> 24);
+}
+
+// pack a 64-bit integer as little-endian
+void vtkDICOMBundlePutInt64(unsigned char *cp, vtkTypeInt64 v)
+{
+  vtkDICOMBundlePutInt32(cp, static_cast<unsigned int>(v));
+  vtkDICOMBundlePutInt32(cp + 4, static_cast<unsigned int>(v >> 32));
+}
+
+// unpack a 32-bit little-endian integer
+unsigned int vtkDICOMBundleGetInt32(const unsigned char *cp)
+{
+  return (cp[0] + (cp[1] << 8) + ((cp[2] + (cp[3] << 8)) << 16));
+}
+
+// unpack a 64-bit little-endian integer
+vtkTypeInt64 vtkDICOMBundleGetInt64(const unsigned char *cp)
+{
+  vtkTypeInt64 v = vtkDICOMBundleGetInt32(cp + 4);
+  return ((v << 32) + vtkDICOMBundleGetInt32(cp));
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMBundle::vtkDICOMBundle()
+{
+  this->FileName = 0;
+  this->Index = vtkTypeInt64Array::New();
+  this->Index->SetNumberOfComponents(2);
+  this->OutputFile = 0;
+  this->ReservedInstances = 0;
+  this->WritePosition = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMBundle::~vtkDICOMBundle()
+{
+  if (this->OutputFile)
+    {
+    this->OutputFile->Close();
+    delete this->OutputFile;
+    }
+  if (this->Index)
+    {
+    this->Index->Delete();
+    }
+  delete [] this->FileName;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMBundle::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileName: "
+     << (this->FileName ? this->FileName : "(NULL)") << "\n";
+  os << indent << "NumberOfInstances: "
+     << this->GetNumberOfInstances() << "\n";
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::TestHeader(const char *fileName)
+{
+  unsigned char magic[8];
+  vtkDICOMFile infile(fileName, vtkDICOMFile::In);
+  bool isBundle = (infile.GetError() == 0 &&
+                   infile.Read(magic, 8) == 8 &&
+                   memcmp(magic, vtkDICOMBundleMagic, 8) == 0);
+  infile.Close();
+  return isBundle;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMBundle::GetNumberOfInstances()
+{
+  return static_cast<int>(this->Index->GetNumberOfTuples());
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::ReadIndex()
+{
+  this->Index->SetNumberOfTuples(0);
+
+  if (!this->FileName)
+    {
+    vtkErrorMacro("ReadIndex: No file name has been set");
+    return false;
+    }
+
+  vtkDICOMFile infile(this->FileName, vtkDICOMFile::In);
+  if (infile.GetError())
+    {
+    vtkErrorMacro("ReadIndex: Can't open the file " << this->FileName);
+    return false;
+    }
+
+  vtkTypeInt64 fileSize = static_cast<vtkTypeInt64>(infile.GetSize());
+  unsigned char head[16];
+  bool valid = (fileSize >= vtkDICOMBundleHeaderSize &&
+                infile.Read(head, 16) == 16 &&
+                memcmp(head, vtkDICOMBundleMagic, 8) == 0 &&
+                vtkDICOMBundleGetInt32(head + 8) == vtkDICOMBundleVersion);
+
+  vtkTypeInt64 count = 0;
+  if (valid)
+    {
+    count = vtkDICOMBundleGetInt32(head + 12);
+    valid = (vtkDICOMBundleHeaderSize + 16*count <= fileSize);
+    }
+
+  unsigned char *entries = 0;
+  if (valid && count > 0)
+    {
+    size_t indexSize = static_cast<size_t>(16*count);
+    entries = new unsigned char[indexSize];
+    valid = (infile.Read(entries, indexSize) == indexSize);
+    }
+
+  if (valid)
+    {
+    this->Index->SetNumberOfTuples(count);
+    for (vtkTypeInt64 i = 0; i < count && valid; i++)
+      {
+      vtkTypeInt64 range[2];
+      range[0] = vtkDICOMBundleGetInt64(entries + 16*i);
+      range[1] = vtkDICOMBundleGetInt64(entries + 16*i + 8);
+      valid = (range[0] >= vtkDICOMBundleHeaderSize + 16*count &&
+               range[1] > 0 && range[0] + range[1] <= fileSize);
+      this->Index->SetTupleValue(i, range);
+      }
+    }
+
+  delete [] entries;
+  infile.Close();
+
+  if (!valid)
+    {
+    this->Index->SetNumberOfTuples(0);
+    vtkErrorMacro("ReadIndex: Not a valid bundle file: " << this->FileName);
+    }
+
+  return valid;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::StartWrite(int numInstances)
+{
+  if (!this->FileName)
+    {
+    vtkErrorMacro("StartWrite: No file name has been set");
+    return false;
+    }
+  if (this->OutputFile)
+    {
+    vtkErrorMacro("StartWrite: A write is already in progress");
+    return false;
+    }
+  if (numInstances < 0)
+    {
+    numInstances = 0;
+    }
+
+  this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+  if (this->OutputFile->GetError())
+    {
+    vtkErrorMacro("StartWrite: Can't write the file " << this->FileName);
+    delete this->OutputFile;
+    this->OutputFile = 0;
+    return false;
+    }
+
+  // write the header, with the index zeroed: the real index entries
+  // are written by FinishWrite, after the byte ranges are known
+  size_t headerSize = static_cast<size_t>(16 + 16*numInstances);
+  unsigned char *header = new unsigned char[headerSize];
+  memset(header, 0, headerSize);
+  memcpy(header, vtkDICOMBundleMagic, 8);
+  vtkDICOMBundlePutInt32(header + 8, vtkDICOMBundleVersion);
+  vtkDICOMBundlePutInt32(header + 12, static_cast<unsigned int>(numInstances));
+  bool success = (this->OutputFile->Write(header, headerSize) == headerSize);
+  delete [] header;
+
+  if (!success)
+    {
+    vtkErrorMacro("StartWrite: Can't write the file " << this->FileName);
+    this->OutputFile->Close();
+    delete this->OutputFile;
+    this->OutputFile = 0;
+    return false;
+    }
+
+  this->ReservedInstances = numInstances;
+  this->WritePosition = static_cast<vtkTypeInt64>(headerSize);
+  this->Index->SetNumberOfTuples(0);
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::WriteInstance(const void *data, vtkTypeInt64 size)
+{
+  if (!this->OutputFile)
+    {
+    vtkErrorMacro("WriteInstance: StartWrite has not been called");
+    return false;
+    }
+  if (this->GetNumberOfInstances() >= this->ReservedInstances)
+    {
+    vtkErrorMacro("WriteInstance: The bundle index is full");
+    return false;
+    }
+  if (size <= 0)
+    {
+    vtkErrorMacro("WriteInstance: The data set is empty");
+    return false;
+    }
+
+  size_t n = static_cast<size_t>(size);
+  const unsigned char *cp = static_cast<const unsigned char *>(data);
+  if (this->OutputFile->Write(cp, n) != n)
+    {
+    vtkErrorMacro("WriteInstance: Can't write the file " << this->FileName);
+    return false;
+    }
+
+  vtkTypeInt64 range[2];
+  range[0] = this->WritePosition;
+  range[1] = size;
+  this->Index->InsertNextTupleValue(range);
+  this->WritePosition += size;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::WriteInstanceFromFile(const char *fileName)
+{
+  if (!this->OutputFile)
+    {
+    vtkErrorMacro("WriteInstanceFromFile: StartWrite has not been called");
+    return false;
+    }
+  if (this->GetNumberOfInstances() >= this->ReservedInstances)
+    {
+    vtkErrorMacro("WriteInstanceFromFile: The bundle index is full");
+    return false;
+    }
+
+  vtkDICOMFile infile(fileName, vtkDICOMFile::In);
+  if (infile.GetError())
+    {
+    vtkErrorMacro("WriteInstanceFromFile: Can't read the file " << fileName);
+    return false;
+    }
+
+  // copy the file into the bundle through a small buffer
+  const size_t bufsize = 65536;
+  unsigned char *buffer = new unsigned char[bufsize];
+  vtkTypeInt64 total = 0;
+  bool success = true;
+  while (success && !infile.EndOfFile())
+    {
+    size_t m = infile.Read(buffer, bufsize);
+    if (m == 0 && infile.GetError())
+      {
+      vtkErrorMacro("WriteInstanceFromFile: Incomplete read: " << fileName);
+      success = false;
+      }
+    else if (m > 0 && this->OutputFile->Write(buffer, m) != m)
+      {
+      vtkErrorMacro("WriteInstanceFromFile: Can't write the file "
+                    << this->FileName);
+      success = false;
+      }
+    total += m;
+    }
+  delete [] buffer;
+  infile.Close();
+
+  if (!success || total == 0)
+    {
+    // reclaim the space so that the bundle is still usable
+    this->OutputFile->SetPosition(
+      static_cast<vtkDICOMFile::Size>(this->WritePosition));
+    return false;
+    }
+
+  vtkTypeInt64 range[2];
+  range[0] = this->WritePosition;
+  range[1] = total;
+  this->Index->InsertNextTupleValue(range);
+  this->WritePosition += total;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMBundle::FinishWrite()
+{
+  if (!this->OutputFile)
+    {
+    vtkErrorMacro("FinishWrite: StartWrite has not been called");
+    return false;
+    }
+
+  // rewrite the count and the index now that the byte ranges are
+  // known (the count may be less than the count that StartWrite
+  // reserved room for, if some of the data sets could not be written)
+  int count = this->GetNumberOfInstances();
+  size_t indexSize = static_cast<size_t>(4 + 16*count);
+  unsigned char *entries = new unsigned char[indexSize];
+  vtkDICOMBundlePutInt32(entries, static_cast<unsigned int>(count));
+  for (int i = 0; i < count; i++)
+    {
+    vtkTypeInt64 range[2];
+    this->Index->GetTupleValue(i, range);
+    vtkDICOMBundlePutInt64(entries + 4 + 16*i, range[0]);
+    vtkDICOMBundlePutInt64(entries + 4 + 16*i + 8, range[1]);
+    }
+  bool success = (this->OutputFile->SetPosition(12) &&
+                  this->OutputFile->Write(entries, indexSize) == indexSize);
+  delete [] entries;
+
+  this->OutputFile->Close();
+  delete this->OutputFile;
+  this->OutputFile = 0;
+  this->ReservedInstances = 0;
+  this->WritePosition = 0;
+
+  if (!success)
+    {
+    vtkErrorMacro("FinishWrite: Can't write the file " << this->FileName);
+    }
+
+  return success;
+}
@@ -0,0 +1,138 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMBundle_h
+#define vtkDICOMBundle_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkTypeInt64Array;
+class vtkDICOMFile;
+
+//! A single-file container for a DICOM series.
+/*!
+ *  A series bundle stores the data sets of a whole DICOM series in
+ *  one file, behind an index that gives the byte range of every data
+ *  set.  Loading a series from a bundle therefore costs one file open
+ *  followed by sequential reads, instead of one open per instance,
+ *  which makes a large difference for series of many small files on
+ *  file systems with a high per-file latency.  Every data set in the
+ *  bundle is a complete Part-10 stream, so the instances can always
+ *  be extracted back into ordinary files.
+ *
+ *  The layout of a bundle file is as follows, with all of the integer
+ *  fields stored as little-endian:
+ *  - the eight signature bytes "DICMBNDL"
+ *  - the format version as a 32-bit integer (currently 1)
+ *  - the number of data sets as a 32-bit integer
+ *  - for each data set, its byte offset within the bundle and its
+ *    length, each as a 64-bit integer
+ *  - the data sets themselves
+ *
+ *  Bundles can be read directly by vtkDICOMReader, and written by
+ *  vtkDICOMWriter (see SetBundleFileName) and by dicompull.
+ */
+class VTKDICOM_EXPORT vtkDICOMBundle : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMBundle *New();
+  vtkTypeMacro(vtkDICOMBundle, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //@{
+  //! Check whether a file begins with the bundle signature.
+  /*!
+   *  This reads only the first few bytes of the file, so it is cheap
+   *  enough to use for file type detection.
+   */
+  static bool TestHeader(const char *fileName);
+  //@}
+
+  //@{
+  //! Set the name of the bundle file to read or write.
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  //@}
+
+  //@{
+  //! Read the index of the bundle file.
+  /*!
+   *  This reads and validates the bundle header, and fills the index
+   *  array with the byte range of every data set.  False is returned
+   *  if the file cannot be read or is not a valid bundle.
+   */
+  bool ReadIndex();
+
+  //! Get the index that was read by ReadIndex().
+  /*!
+   *  The array has one two-component tuple per data set: the byte
+   *  offset of the data set within the bundle, and its length.
+   */
+  vtkTypeInt64Array *GetIndex() { return this->Index; }
+
+  //! Get the number of data sets in the bundle.
+  int GetNumberOfInstances();
+  //@}
+
+  //@{
+  //! Start writing a bundle with room for the given number of data sets.
+  /*!
+   *  This creates the file and reserves space for the header and the
+   *  index, which are rewritten by FinishWrite().  If fewer data sets
+   *  than planned are actually written, the count in the header is
+   *  reduced to match, so a bundle is still valid after a partial
+   *  write that was properly finished.
+   */
+  bool StartWrite(int numInstances);
+
+  //! Append one complete data set to the bundle.
+  bool WriteInstance(const void *data, vtkTypeInt64 size);
+
+  //! Append the contents of a file as one data set of the bundle.
+  bool WriteInstanceFromFile(const char *fileName);
+
+  //! Write the index and close the bundle file.
+  bool FinishWrite();
+  //@}
+
+protected:
+  vtkDICOMBundle();
+  ~vtkDICOMBundle();
+
+  //! The name of the bundle file.
+  char *FileName;
+
+  //! The byte range of every data set (two components per tuple).
+  vtkTypeInt64Array *Index;
+
+  //! The file being written, between StartWrite and FinishWrite.
+  vtkDICOMFile *OutputFile;
+
+  //! The number of data sets that StartWrite reserved room for.
+  int ReservedInstances;
+
+  //! The offset at which the next data set will be written.
+  vtkTypeInt64 WritePosition;
+
+private:
+  vtkDICOMBundle(const vtkDICOMBundle&);  // Not implemented.
+  void operator=(const vtkDICOMBundle&);  // Not implemented.
+};
+
+#endif /* vtkDICOMBundle_h */
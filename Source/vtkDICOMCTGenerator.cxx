@@ -132,6 +132,55 @@ bool vtkDICOMCTGenerator::GenerateCTImageModule(vtkDICOMMetaData *source)
           this->CopyOptionalAttributes(optional, source));
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCTGenerator::GenerateEnhancedCTImageModule(
+  vtkDICOMMetaData *source)
+{
+  // ImageType is specialized from GeneralImageModule: for enhanced CT
+  // it has four mandatory values, where the third value is the image
+  // flavor and the fourth value is the derived pixel contrast
+  vtkDICOMMetaData *meta = this->MetaData;
+  vtkDICOMValue imageType;
+  if (source)
+    {
+    imageType = source->GetAttributeValue(DC::ImageType);
+    }
+  if (imageType.GetNumberOfValues() != 4)
+    {
+    imageType = vtkDICOMValue(
+      vtkDICOMVR::CS, "DERIVED\\SECONDARY\\AXIAL\\NONE");
+    }
+  meta->SetAttributeValue(DC::ImageType, imageType);
+
+  // these are mandatory for the enhanced image modules
+  meta->SetAttributeValue(DC::PixelPresentation, "MONOCHROME");
+  meta->SetAttributeValue(DC::VolumetricProperties, "VOLUME");
+  meta->SetAttributeValue(DC::VolumeBasedCalculationTechnique, "NONE");
+  meta->SetAttributeValue(DC::BurnedInAnnotation, "NO");
+  meta->SetAttributeValue(DC::LossyImageCompression, "00");
+  meta->SetAttributeValue(DC::PresentationLUTShape, "IDENTITY");
+
+  // required items: use simple read/write validation
+  static const DC::EnumType required[] = {
+    DC::AcquisitionNumber,
+    DC::AcquisitionDateTime,
+    DC::ItemDelimitationItem
+  };
+
+  // optional and conditional: direct copy of values with no checks
+  static const DC::EnumType optional[] = {
+    DC::AcquisitionDuration, // 1C
+    DC::ContentQualification,
+    DC::ImageComments,
+    DC::AnatomicRegionSequence,
+    DC::PrimaryAnatomicStructureSequence,
+    DC::ItemDelimitationItem
+  };
+
+  return (this->CopyRequiredAttributes(required, source) &&
+          this->CopyOptionalAttributes(optional, source));
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMCTGenerator::GenerateCTInstance(vtkInformation *info)
 {
@@ -171,13 +220,79 @@ bool vtkDICOMCTGenerator::GenerateCTInstance(vtkInformation *info)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCTGenerator::GenerateEnhancedCTInstance(vtkInformation *info)
+{
+  this->SetPixelRestrictions(
+    RepresentationSigned | RepresentationUnsigned,
+    BitsStored12 | BitsStored16,
+    1);
+
+  const char *SOPClass = "1.2.840.10008.5.1.4.1.1.2.1";
+  this->InitializeMetaData(info);
+
+  vtkDICOMMetaData *source = this->SourceMetaData;
+  if (!this->GenerateSOPCommonModule(source, SOPClass) ||
+      !this->GeneratePatientModule(source) ||
+      !this->GenerateClinicalTrialSubjectModule(source) ||
+      !this->GenerateGeneralStudyModule(source) ||
+      !this->GeneratePatientStudyModule(source) ||
+      !this->GenerateClinicalTrialStudyModule(source) ||
+      !this->GenerateGeneralSeriesModule(source) ||
+      !this->GenerateFrameOfReferenceModule(source) ||
+      !this->GenerateClinicalTrialSeriesModule(source) ||
+      !this->GenerateGeneralEquipmentModule(source) ||
+      !this->GenerateGeneralImageModule(source) ||
+      !this->GenerateImagePixelModule(source) ||
+      !this->GenerateContrastBolusModule(source) ||
+      !this->GenerateDeviceModule(source) ||
+      !this->GenerateSpecimenModule(source) ||
+      !this->GenerateCTSeriesModule(source) ||
+      !this->GenerateEnhancedCTImageModule(source) ||
+      !this->GenerateAcquisitionContextModule(source) ||
+      !this->GenerateMultiFrameDimensionModule())
+    {
+    return false;
+    }
+
+  // the frame type repeats the image type for every frame
+  vtkDICOMMetaData *meta = this->MetaData;
+  vtkDICOMItem frameType;
+  frameType.SetAttributeValue(
+    DC::FrameType, meta->GetAttributeValue(DC::ImageType));
+  frameType.SetAttributeValue(DC::PixelPresentation, "MONOCHROME");
+  frameType.SetAttributeValue(DC::VolumetricProperties, "VOLUME");
+  frameType.SetAttributeValue(
+    DC::VolumeBasedCalculationTechnique, "NONE");
+  vtkDICOMSequence frameTypeSeq;
+  frameTypeSeq.AddItem(frameType);
+
+  // for CT, the rescaling goes into the shared functional groups
+  vtkDICOMItem pixelValueTransformation;
+  pixelValueTransformation.SetAttributeValue(
+    DC::RescaleIntercept, this->RescaleIntercept);
+  pixelValueTransformation.SetAttributeValue(
+    DC::RescaleSlope, this->RescaleSlope);
+  pixelValueTransformation.SetAttributeValue(DC::RescaleType, "HU");
+  vtkDICOMSequence pixelValueTransformationSeq;
+  pixelValueTransformationSeq.AddItem(pixelValueTransformation);
+
+  vtkDICOMItem sharedGroups;
+  sharedGroups.SetAttributeValue(
+    DC::CTImageFrameTypeSequence, frameTypeSeq);
+  sharedGroups.SetAttributeValue(
+    DC::PixelValueTransformationSequence, pixelValueTransformationSeq);
+
+  return this->GenerateMultiFrameFunctionalGroupsModule(
+    source, sharedGroups);
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMCTGenerator::GenerateInstance(vtkInformation *info)
 {
   if (this->MultiFrame)
     {
-    vtkErrorMacro("Enhanced Multi-Frame CT is not yet supported.");
-    return false;
+    return this->GenerateEnhancedCTInstance(info);
     }
 
   return this->GenerateCTInstance(info);
@@ -24,6 +24,7 @@
  *  are being written out as derived images after being processed.
  *  The specific IOD classes supported are as follows:
  *  - CT Image, 1.2.840.10008.5.1.4.1.1.2
+ *  - Enhanced CT Image, 1.2.840.10008.5.1.4.1.1.2.1
  */
 class VTKDICOM_EXPORT vtkDICOMCTGenerator : public vtkDICOMGenerator
 {
@@ -53,9 +54,15 @@ protected:
   //! Generate the Image Module.
   virtual bool GenerateCTImageModule(vtkDICOMMetaData *source);
 
+  //! Generate the Enhanced CT Image Module.
+  virtual bool GenerateEnhancedCTImageModule(vtkDICOMMetaData *source);
+
   //! Instantiate a DICOM Secondary Capture Image object.
   virtual bool GenerateCTInstance(vtkInformation *info);
 
+  //! Instantiate a DICOM Enhanced CT Image object.
+  virtual bool GenerateEnhancedCTInstance(vtkInformation *info);
+
 private:
   vtkDICOMCTGenerator(const vtkDICOMCTGenerator&);  // Not implemented.
   void operator=(const vtkDICOMCTGenerator&);  // Not implemented.
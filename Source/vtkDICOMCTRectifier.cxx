@@ -303,6 +303,23 @@ int vtkDICOMCTRectifier::RequestData(
 
   this->CopyMetaDataToOutputData(outInfo, outData);
 
+  // if the volume has no tilt, then the shear matrix is the identity and
+  // the resampling would simply copy the voxels, so instead pass the
+  // scalar array straight through to the output
+  bool identity = true;
+  const double *shear = *this->Matrix->Element;
+  for (int i = 0; i < 16 && identity; i++)
+    {
+    double expected = ((i % 5) == 0 ? 1.0 : 0.0);
+    identity = (fabs(shear[i] - expected) < 1e-12);
+    }
+  if (identity)
+    {
+    outData->CopyStructure(inData);
+    outData->GetPointData()->PassData(inData->GetPointData());
+    return 1;
+    }
+
   vtkSmartPointer<vtkImageData> image =
     vtkSmartPointer<vtkImageData>::New();
   image->CopyStructure(inData);
@@ -114,6 +114,19 @@ public:
    */
   std::string ConvertToUTF8(const char *text, size_t l) const;
 
+  //! Convert text from UTF-8 to this encoding.
+  /*!
+   *  This is the counterpart of ConvertToUTF8, for writing values that
+   *  were edited as UTF-8 back into a data set that uses a different
+   *  character set.  Pure ASCII text is copied at memory speed, since
+   *  ASCII encodes itself in every supported character set except
+   *  JIS X 0201.  Characters that cannot be represented are replaced
+   *  by question marks, and since only the ASCII and single-byte
+   *  encoders are implemented, that includes all non-ASCII characters
+   *  when the target is ISO 2022 or GB18030/GBK.
+   */
+  std::string ConvertFromUTF8(const char *text, size_t l) const;
+
   //! Convert text into a form suitable for case-insensitive matching.
   /*!
    *  This function will perform case normalization on a string by
@@ -19,19 +19,33 @@
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMItem.h"
 #include "vtkDICOMImageCodec.h"
+#include "vtkDICOMProfiler.h"
+#include "vtkDICOMConfig.h"
+
+// Header for zlib
+#ifdef DICOM_USE_VTKZLIB
+#include "vtk_zlib.h"
+#else
+#include "zlib.h"
+#endif
 
 #include <vtkObjectFactory.h>
 #include <vtkStringArray.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedShortArray.h>
 #include <vtkErrorCode.h>
 
 #include <ctype.h>
+#include <string.h>
 #include <assert.h>
 
+#include <map>
 #include <string>
 
 vtkStandardNewMacro(vtkDICOMCompiler);
 vtkCxxSetObjectMacro(vtkDICOMCompiler, MetaData, vtkDICOMMetaData);
+vtkCxxSetObjectMacro(vtkDICOMCompiler, OutputBuffer, vtkUnsignedCharArray);
 
 char vtkDICOMCompiler::StudyUID[64] = {};
 
@@ -101,6 +115,12 @@ public:
   // Whether to use implicit VRs (default: explicit VRs).
   void SetImplicitVR(bool i) { this->ImplicitVR = i; }
 
+  // Whether the metadata is trusted (default: untrusted).
+  void SetTrusted(bool t) { this->Trusted = t; }
+
+  // Whether to write sequences with delimiters (default: lengths).
+  void SetDelimited(bool d) { this->Delimited = d; }
+
   // Set the instance UID to use.
   void SetSOPInstanceUID(const char *uid) {
     this->SOPInstanceUID = uid; };
@@ -133,6 +153,11 @@ public:
   bool CheckBuffer(
     unsigned char* &cp, unsigned char* &ep, size_t n);
 
+  // Write "n" bytes that are already in the output encoding.
+  bool WriteRawData(
+    unsigned char* &cp, unsigned char* &ep,
+    const unsigned char *ptr, size_t n);
+
   // Count the number of bytes required to write the specified data,
   // returns 0xffffffff if size cannot be computed or is larger than
   // can be stored in a 32-bit unsigned integer.
@@ -144,7 +169,8 @@ protected:
   // Constructor that initializes all of the members.
   EncoderBase(vtkDICOMCompiler *comp, int idx) :
     Compiler(comp), SOPInstanceUID(0), SeriesInstanceUID(0),
-    StudyInstanceUID(0), Index(idx), Depth(0), ImplicitVR(0) {}
+    StudyInstanceUID(0), Index(idx), Depth(0), ImplicitVR(0),
+    Trusted(0), Delimited(0) {}
 
   // the vtkDICOMCompiler::FlushBuffer method is used to refill the buffer
   vtkDICOMCompiler *Compiler;
@@ -158,6 +184,10 @@ protected:
   int Depth;
   // if this is set, then VRs are implicit
   bool ImplicitVR;
+  // if this is set, then values pass through without re-encoding
+  bool Trusted;
+  // if this is set, sequences are written with undefined length
+  bool Delimited;
 };
 
 //----------------------------------------------------------------------------
@@ -252,6 +282,23 @@ inline bool EncoderBase::CheckBuffer(
   return r;
 }
 
+//----------------------------------------------------------------------------
+inline bool EncoderBase::WriteRawData(
+  unsigned char* &cp, unsigned char* &ep, const unsigned char *ptr, size_t n)
+{
+  while (n != 0 && this->CheckBuffer(cp, ep, 1))
+    {
+    size_t m = static_cast<size_t>(ep - cp);
+    if (m > n) { m = n; }
+    memcpy(cp, ptr, m);
+    cp += m;
+    ptr += m;
+    n -= m;
+    }
+
+  return (n == 0);
+}
+
 //----------------------------------------------------------------------------
 unsigned int EncoderBase::DataSize(
   vtkDICOMDataElementIterator iter,
@@ -267,6 +314,11 @@ unsigned int EncoderBase::DataSize(
 
     if (vr == vtkDICOMVR::SQ)
       {
+      if (this->Delimited)
+        {
+        // the sequence will be written with undefined length
+        vl = HxFFFFFFFF;
+        }
       size_t n = v.GetNumberOfValues();
       const vtkDICOMItem *ptr = v.GetSequenceData();
       for (size_t i = 0; i < n && vl != HxFFFFFFFF; i++)
@@ -564,6 +616,13 @@ bool Encoder<E>::WriteDataElement(
     }
   else if (vr == vtkDICOMVR::SQ)
     {
+    if (this->Delimited)
+      {
+      // write the sequence with undefined length and a delimiter,
+      // so that the nested contents stream straight to the output
+      // without a recursive pre-pass to total up their sizes
+      vl = HxFFFFFFFF;
+      }
     // compute the true vl for the sequence
     size_t n = v.GetNumberOfValues();
     const vtkDICOMItem *ptr = v.GetSequenceData();
@@ -595,6 +654,55 @@ bool Encoder<E>::WriteDataElement(
     }
   cp += this->Encoder<E>::WriteElementHead(cp, tag, vr, vl);
 
+  // trusted pass-through: when the metadata came unmodified from the
+  // parser and the output byte order is the byte order of this machine,
+  // the value buffer is already in its file encoding, so it can be
+  // copied through as raw bytes instead of being re-encoded value by
+  // value (sequences and attribute tags are excluded because they are
+  // not stored as raw bytes)
+#ifdef VTK_WORDS_BIGENDIAN
+  const bool sameEndian = (E == BE);
+#else
+  const bool sameEndian = (E == LE);
+#endif
+  if (this->Trusted && sameEndian && vl != HxFFFFFFFF)
+    {
+    const unsigned char *bp = 0;
+    switch (vr.GetType())
+      {
+      case VTK_CHAR:
+        bp = reinterpret_cast<const unsigned char *>(v.GetCharData());
+        break;
+      case VTK_UNSIGNED_CHAR:
+        bp = v.GetUnsignedCharData();
+        break;
+      case VTK_SHORT:
+        bp = reinterpret_cast<const unsigned char *>(v.GetShortData());
+        break;
+      case VTK_UNSIGNED_SHORT:
+        bp = reinterpret_cast<const unsigned char *>(
+          v.GetUnsignedShortData());
+        break;
+      case VTK_INT:
+        bp = reinterpret_cast<const unsigned char *>(v.GetIntData());
+        break;
+      case VTK_UNSIGNED_INT:
+        bp = reinterpret_cast<const unsigned char *>(
+          v.GetUnsignedIntData());
+        break;
+      case VTK_FLOAT:
+        bp = reinterpret_cast<const unsigned char *>(v.GetFloatData());
+        break;
+      case VTK_DOUBLE:
+        bp = reinterpret_cast<const unsigned char *>(v.GetDoubleData());
+        break;
+      }
+    if (bp != 0)
+      {
+      return this->WriteRawData(cp, ep, bp, vl);
+      }
+    }
+
   // write the value
   bool r = true;
   switch (vr.GetType())
@@ -674,7 +782,7 @@ bool Encoder<E>::WriteDataElement(
       for (size_t i = 0; i < n && r; i++)
         {
         unsigned int il = 0xFFFFFFFF;
-        if (!ptr[i].IsDelimited())
+        if (!this->Delimited && !ptr[i].IsDelimited())
           {
           // compute the bytes in the item
           il = this->DataSize(ptr[i].Begin(), ptr[i].End());
@@ -851,6 +959,35 @@ bool Encoder<E>::WriteElements(
   return true;
 }
 
+//----------------------------------------------------------------------------
+// Copy a range of bytes from a source file into the write buffer,
+// flushing the buffer through the compiler as it fills.
+bool CopyFileBytes(
+  EncoderBase *encoder, vtkDICOMFile *infile,
+  unsigned char* &cp, unsigned char* &ep, vtkTypeInt64 n)
+{
+  while (n > 0)
+    {
+    if (!encoder->CheckBuffer(cp, ep, 1))
+      {
+      return false;
+      }
+    size_t m = static_cast<size_t>(ep - cp);
+    if (n < static_cast<vtkTypeInt64>(m))
+      {
+      m = static_cast<size_t>(n);
+      }
+    if (infile->Read(cp, m) != m)
+      {
+      return false;
+      }
+    cp += m;
+    n -= m;
+    }
+
+  return true;
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -868,16 +1005,23 @@ vtkDICOMCompiler::vtkDICOMCompiler()
   this->TransferSyntaxUID = NULL;
   this->MetaData = NULL;
   this->OutputFile = NULL;
+  this->OutputBuffer = NULL;
   this->Buffer = NULL;
-  this->BufferSize = 8192;
+  this->BufferSize = 65536;
   this->ChunkSize = 0;
   this->Index = 0;
   this->FrameCounter = 0;
   this->FrameData = 0;
   this->FrameLength = 0;
+  this->FrameAllocated = 0;
   this->BigEndian = false;
   this->Compressed = false;
   this->KeepOriginalPixelDataVR = false;
+  this->TrustedSource = false;
+  this->DelimitedSequences = false;
+  this->Deflated = false;
+  this->ZStream = NULL;
+  this->ZBuffer = NULL;
   this->ErrorCode = 0;
   this->SeriesUIDs = 0;
 
@@ -905,6 +1049,8 @@ vtkDICOMCompiler::~vtkDICOMCompiler()
 {
   this->Close();
 
+  delete [] this->Buffer;
+  delete [] this->ZBuffer;
   delete [] this->FileName;
   delete [] this->SOPInstanceUID;
   delete [] this->SeriesInstanceUID;
@@ -918,6 +1064,10 @@ vtkDICOMCompiler::~vtkDICOMCompiler()
     {
     this->MetaData->Delete();
     }
+  if (this->OutputBuffer)
+    {
+    this->OutputBuffer->Delete();
+    }
   if (this->SeriesUIDs)
     {
     this->SeriesUIDs->Delete();
@@ -966,8 +1116,22 @@ void vtkDICOMCompiler::GenerateSeriesUIDs()
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::WriteHeader()
 {
+  // time the write when profiling (the byte count only includes the
+  // pixel data, so zero bytes are recorded for the header)
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
   this->FrameCounter = 0;
   this->WriteFile(this->MetaData, this->Index);
+
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    vtkDICOMProfiler::EndPhase(
+      this, vtkDICOMProfiler::FileWrite, profileStart, 0);
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -978,6 +1142,13 @@ void vtkDICOMCompiler::Close()
     this->WriteFragments();
     }
 
+  if (this->Deflated && !this->FinishDeflate())
+    {
+    // the tail of the deflate stream could not be written
+    this->DiskFullError();
+    return;
+    }
+
   if (this->OutputFile)
     {
     this->OutputFile->Close();
@@ -994,6 +1165,11 @@ void vtkDICOMCompiler::CloseAndRemove()
     this->FreeFragments();
     }
 
+  if (this->Deflated)
+    {
+    this->AbortDeflate();
+    }
+
   if (this->OutputFile)
     {
     this->OutputFile->Close();
@@ -1001,6 +1177,11 @@ void vtkDICOMCompiler::CloseAndRemove()
     this->OutputFile = NULL;
     vtkDICOMFile::Remove(this->FileName);
     }
+  else if (this->OutputBuffer)
+    {
+    // discard the partially written data stream
+    this->OutputBuffer->Initialize();
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -1008,7 +1189,7 @@ bool vtkDICOMCompiler::WriteFragments()
 {
   bool fileError = false;
 
-  if (this->OutputFile && this->ErrorCode == 0)
+  if ((this->OutputFile || this->OutputBuffer) && this->ErrorCode == 0)
     {
     // Compressed frames
     unsigned int numFrames = this->FrameCounter;
@@ -1043,7 +1224,7 @@ bool vtkDICOMCompiler::WriteFragments()
       }
 
     // write the offset table to the file
-    n = this->OutputFile->Write(buffer, tableLength + 8);
+    n = this->WriteBytes(buffer, tableLength + 8);
     if (n < tableLength + 8)
       {
       fileError = true;
@@ -1057,17 +1238,20 @@ bool vtkDICOMCompiler::WriteFragments()
       Encoder<LE>::PutInt16(buffer, HxFFFE);
       Encoder<LE>::PutInt16(buffer+2, HxE000);
       Encoder<LE>::PutInt32(buffer+4, this->FrameLength[i]);
-      n = this->OutputFile->Write(buffer, 8);
-      if (n < 8)
-        {
-        fileError = true;
-        break;
-        }
 
-      // - Fragment data
+      // - Fragment data, written together with the header
       assert((this->FrameLength[i] & 1) == 0);
-      n = this->OutputFile->Write(this->FrameData[i], this->FrameLength[i]);
-      if (n < this->FrameLength[i])
+      if (this->OutputBuffer)
+        {
+        n = this->WriteBytes(buffer, 8);
+        n += this->WriteBytes(this->FrameData[i], this->FrameLength[i]);
+        }
+      else
+        {
+        n = this->OutputFile->WriteV(
+          buffer, 8, this->FrameData[i], this->FrameLength[i]);
+        }
+      if (n < 8 + static_cast<size_t>(this->FrameLength[i]))
         {
         fileError = true;
         break;
@@ -1082,7 +1266,7 @@ bool vtkDICOMCompiler::WriteFragments()
       Encoder<LE>::PutInt16(buffer, HxFFFE);
       Encoder<LE>::PutInt16(buffer+2, HxE0DD);
       Encoder<LE>::PutInt32(buffer+4, 0);
-      n = this->OutputFile->Write(buffer, 8);
+      n = this->WriteBytes(buffer, 8);
       if (n < 8)
         {
         fileError = true;
@@ -1114,13 +1298,14 @@ void vtkDICOMCompiler::FreeFragments()
   delete [] this->FrameLength;
   this->FrameData = 0;
   this->FrameCounter = 0;
+  this->FrameAllocated = 0;
 }
 
 //----------------------------------------------------------------------------
 bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
 {
   // Check that the file name has been set.
-  if (!this->FileName)
+  if (!this->FileName && !this->OutputBuffer)
     {
     this->SetErrorCode(vtkErrorCode::NoFileNameError);
     vtkErrorMacro("WriteFile: No file name has been set");
@@ -1136,29 +1321,43 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     this->GenerateSeriesUIDs();
     }
 
-  this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
-
-  if (this->OutputFile->GetError())
+  if (this->OutputBuffer)
     {
-    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
-    const char *errText = "Can't open the file ";
-    if (this->OutputFile->GetError() == vtkDICOMFile::AccessDenied)
-      {
-      errText = "No permission to write the file ";
-      }
-    else if (this->OutputFile->GetError() == vtkDICOMFile::FileIsDirectory)
+    // compile into memory, the buffer starts out empty
+    this->OutputBuffer->Initialize();
+    }
+  else
+    {
+    this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+
+    if (this->OutputFile->GetError())
       {
-      errText = "The selected file is a directory ";
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      const char *errText = "Can't open the file ";
+      if (this->OutputFile->GetError() == vtkDICOMFile::AccessDenied)
+        {
+        errText = "No permission to write the file ";
+        }
+      else if (this->OutputFile->GetError() == vtkDICOMFile::FileIsDirectory)
+        {
+        errText = "The selected file is a directory ";
+        }
+      delete this->OutputFile;
+      this->OutputFile = 0;
+      vtkErrorMacro("WriteFile: " << errText << this->FileName);
+      return false;
       }
-    delete this->OutputFile;
-    this->OutputFile = 0;
-    vtkErrorMacro("WriteFile: " << errText << this->FileName);
-    return false;
     }
 
-  this->Buffer = new unsigned char [this->BufferSize];
-  // guard against anyone changing BufferSize while compiling the file
-  this->ChunkSize = this->BufferSize;
+  // guard against anyone changing BufferSize while compiling the file,
+  // and keep the buffer so that writing a series of files through the
+  // same compiler does not allocate a new buffer for every file
+  if (this->ChunkSize != this->BufferSize)
+    {
+    delete [] this->Buffer;
+    this->Buffer = new unsigned char [this->BufferSize];
+    this->ChunkSize = this->BufferSize;
+    }
 
   unsigned char *cp = this->Buffer;
   unsigned char *ep = cp + this->ChunkSize;
@@ -1179,6 +1378,17 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     cp += 4;
 
     r = this->WriteMetaHeader(cp, ep, data, idx);
+    if (r && strcmp(this->TransferSyntaxUID,
+                    "1.2.840.10008.1.2.1.99") == 0)
+      {
+      // the data set that follows the meta header is deflated, so
+      // flush the raw meta header and then compress everything else
+      r = this->FlushBuffer(cp, ep);
+      if (r)
+        {
+        r = this->StartDeflate();
+        }
+      }
     }
   if (r)
     {
@@ -1189,8 +1399,6 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     r = this->FlushBuffer(cp, ep);
     }
 
-  delete [] this->Buffer;
-
   // delete the file if an error occurred
   if (!r)
     {
@@ -1207,29 +1415,393 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
   return r;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::PatchFile(
+  const char *sourceName, vtkTypeInt64Array *offsets,
+  vtkDICOMMetaData *changes)
+{
+  // Check that the file name has been set.
+  if (!this->FileName && !this->OutputBuffer)
+    {
+    this->SetErrorCode(vtkErrorCode::NoFileNameError);
+    vtkErrorMacro("PatchFile: No file name has been set");
+    return false;
+    }
+  if (sourceName == 0 || offsets == 0 || changes == 0)
+    {
+    vtkErrorMacro("PatchFile: A source file, an offset table, and the "
+                  "changed elements must all be provided");
+    return false;
+    }
+  if (this->FileName && strcmp(sourceName, this->FileName) == 0)
+    {
+    vtkErrorMacro("PatchFile: The output file must differ from the "
+                  "source file");
+    return false;
+    }
+
+  // the encoders to choose from
+  LittleEndianEncoder encoderLE(this, this->Index);
+  BigEndianEncoder encoderBE(this, this->Index);
+  EncoderBase *encoder = &encoderLE;
+  bool bigEndian = false;
+
+  // the encoding must match the source transfer syntax, and anything
+  // not listed here encodes its top-level elements as Explicit LE
+  std::string tsyntax =
+    (this->TransferSyntaxUID ? this->TransferSyntaxUID : "");
+  if (tsyntax == "" || // If no meta header, use Implicit LE
+      tsyntax == "1.2.840.10008.1.2" ||  // Implicit LE
+      tsyntax == "1.2.840.10008.1.20" || // Papyrus Implicit LE
+      tsyntax == "1.2.840.113619.5.2")   // GE LE with BE data
+    {
+    encoder->SetImplicitVR(true);
+    }
+  else if (tsyntax == "1.2.840.10008.1.2.2") // Explicit BE
+    {
+    encoder = &encoderBE;
+    bigEndian = true;
+    }
+  else if (tsyntax == "1.2.840.10008.1.2.1.99") // Deflated Explicit LE
+    {
+    // byte offsets within the inflated stream are of no use for
+    // splicing the compressed bytes of the file
+    this->CompileError("Deflated files cannot be patched.");
+    return false;
+    }
+
+  // the meta header and anything past the PixelData cannot be patched
+  vtkDICOMTag pixelDataTag = vtkDICOMTag(DC::PixelData);
+  vtkDICOMDataElementIterator chIter = changes->Begin();
+  vtkDICOMDataElementIterator chEnd = changes->End();
+  while (chIter != chEnd && chIter->GetTag().GetGroup() <= 0x0002)
+    {
+    ++chIter;
+    }
+
+  // ignore a trailing partial tuple in the offset table
+  vtkIdType nn = offsets->GetNumberOfValues();
+  nn -= nn % 3;
+
+  // compute how much each change adds to (or removes from) its group,
+  // so that retired group length elements can be adjusted
+  std::map<unsigned short, vtkTypeInt64> groupDeltas;
+  vtkDICOMDataElementIterator iter = chIter;
+  while (iter != chEnd && iter->GetTag() < pixelDataTag)
+    {
+    vtkDICOMDataElementIterator next = iter;
+    ++next;
+    vtkDICOMTag tag = iter->GetTag();
+    unsigned int nl = encoder->DataSize(iter, next);
+    if (nl == HxFFFFFFFF)
+      {
+      this->CompileError("Encoded size of patched value is unknown.");
+      return false;
+      }
+    vtkTypeInt64 key = tag.GetGroup();
+    key = (key << 16) | tag.GetElement();
+    vtkTypeInt64 ol = 0;
+    for (vtkIdType i = 0; i < nn; i += 3)
+      {
+      if (offsets->GetValue(i) == key)
+        {
+        ol = offsets->GetValue(i + 2) - offsets->GetValue(i + 1);
+        break;
+        }
+      }
+    groupDeltas[tag.GetGroup()] += static_cast<vtkTypeInt64>(nl) - ol;
+    iter = next;
+    }
+
+  // open the source file
+  vtkDICOMFile infile(sourceName, vtkDICOMFile::In);
+  if (infile.GetError())
+    {
+    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    vtkErrorMacro("PatchFile: Can't open the file " << sourceName);
+    return false;
+    }
+
+  if (this->OutputBuffer)
+    {
+    // compile into memory, the buffer starts out empty
+    this->OutputBuffer->Initialize();
+    }
+  else
+    {
+    this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+
+    if (this->OutputFile->GetError())
+      {
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      const char *errText = "Can't open the file ";
+      if (this->OutputFile->GetError() == vtkDICOMFile::AccessDenied)
+        {
+        errText = "No permission to write the file ";
+        }
+      else if (this->OutputFile->GetError() == vtkDICOMFile::FileIsDirectory)
+        {
+        errText = "The selected file is a directory ";
+        }
+      delete this->OutputFile;
+      this->OutputFile = 0;
+      vtkErrorMacro("PatchFile: " << errText << this->FileName);
+      return false;
+      }
+    }
+
+  // guard against anyone changing BufferSize while patching the file
+  if (this->ChunkSize != this->BufferSize)
+    {
+    delete [] this->Buffer;
+    this->Buffer = new unsigned char [this->BufferSize];
+    this->ChunkSize = this->BufferSize;
+    }
+
+  unsigned char *cp = this->Buffer;
+  unsigned char *ep = cp + this->ChunkSize;
+
+  // walk the offset table, splicing the untouched byte ranges of the
+  // source file around the re-encoded elements
+  bool r = true;
+  vtkTypeInt64 pos = 0;
+  iter = chIter;
+  for (vtkIdType i = 0; r && i < nn; i += 3)
+    {
+    vtkTypeInt64 key = offsets->GetValue(i);
+    vtkTypeInt64 start = offsets->GetValue(i + 1);
+    vtkTypeInt64 end = offsets->GetValue(i + 2);
+    vtkDICOMTag tag(static_cast<unsigned short>(key >> 16),
+                    static_cast<unsigned short>(key & 0xFFFF));
+
+    // copy everything up to the start of this element
+    if (start > pos)
+      {
+      r = CopyFileBytes(encoder, &infile, cp, ep, start - pos);
+      pos = start;
+      if (!r) { break; }
+      }
+
+    // insert any new elements that sort before this element
+    while (iter != chEnd && iter->GetTag() < tag)
+      {
+      vtkDICOMDataElementIterator next = iter;
+      ++next;
+      r = encoder->WriteElements(cp, ep, iter, next);
+      iter = next;
+      if (!r) { break; }
+      }
+    if (!r) { break; }
+
+    if (iter != chEnd && iter->GetTag() == tag)
+      {
+      // replace the element with its changed value, and hop over
+      // the original bytes in the source file
+      vtkDICOMDataElementIterator next = iter;
+      ++next;
+      r = encoder->WriteElements(cp, ep, iter, next);
+      iter = next;
+      r = r && infile.SetPosition(static_cast<vtkDICOMFile::Size>(end));
+      pos = end;
+      }
+    else if (tag.GetElement() == 0x0000 && tag.GetGroup() > 0x0002 &&
+             end - start == 12 &&
+             groupDeltas.find(tag.GetGroup()) != groupDeltas.end() &&
+             groupDeltas[tag.GetGroup()] != 0)
+      {
+      // rewrite the group length to account for the size changes
+      unsigned char head[12];
+      if (infile.Read(head, 12) != 12)
+        {
+        r = false;
+        break;
+        }
+      unsigned int gl;
+      if (bigEndian)
+        {
+        gl = head[11] + (head[10] << 8) + ((head[9] + (head[8] << 8)) << 16);
+        gl = static_cast<unsigned int>(gl + groupDeltas[tag.GetGroup()]);
+        Encoder<BE>::PutInt32(head + 8, gl);
+        }
+      else
+        {
+        gl = head[8] + (head[9] << 8) + ((head[10] + (head[11] << 8)) << 16);
+        gl = static_cast<unsigned int>(gl + groupDeltas[tag.GetGroup()]);
+        Encoder<LE>::PutInt32(head + 8, gl);
+        }
+      r = encoder->WriteRawData(cp, ep, head, 12);
+      pos = end;
+      }
+    // other elements are left alone, their bytes are copied when the
+    // next range copy catches up to them
+    }
+
+  // copy up to the end of the last recorded element
+  vtkTypeInt64 lastEnd = (nn > 0 ? offsets->GetValue(nn - 1) : 0);
+  if (r && pos < lastEnd)
+    {
+    r = CopyFileBytes(encoder, &infile, cp, ep, lastEnd - pos);
+    pos = lastEnd;
+    }
+
+  // insert any remaining new elements, they belong before the trailer
+  while (r && iter != chEnd && iter->GetTag() < pixelDataTag)
+    {
+    vtkDICOMDataElementIterator next = iter;
+    ++next;
+    r = encoder->WriteElements(cp, ep, iter, next);
+    iter = next;
+    }
+
+  // copy the trailer (the PixelData and everything that follows it)
+  if (r)
+    {
+    vtkTypeInt64 fileSize = static_cast<vtkTypeInt64>(infile.GetSize());
+    if (fileSize > pos)
+      {
+      r = CopyFileBytes(encoder, &infile, cp, ep, fileSize - pos);
+      }
+    }
+  if (r)
+    {
+    r = this->FlushBuffer(cp, ep);
+    }
+
+  // delete the file if an error occurred
+  if (!r)
+    {
+    if (this->GetErrorCode() != vtkErrorCode::NoError)
+      {
+      this->CloseAndRemove();
+      }
+    else if (infile.EndOfFile() || infile.GetError())
+      {
+      this->CompileError("Premature end of the source file.");
+      this->CloseAndRemove();
+      }
+    else
+      {
+      this->DiskFullError();
+      }
+    }
+  else
+    {
+    this->Close();
+    }
+
+  return r;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::WritePixelData(const unsigned char *cp, vtkIdType size)
 {
-  if (this->OutputFile == 0)
+  if (this->OutputFile == 0 && this->OutputBuffer == 0)
     {
     return;
     }
 
-  size_t n = this->OutputFile->Write(cp, size);
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
+  size_t n = this->WriteBytes(cp, size);
   if (n != static_cast<size_t>(size))
     {
     this->DiskFullError();
     }
+
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    vtkDICOMProfiler::EndPhase(
+      this, vtkDICOMProfiler::FileWrite, profileStart,
+      static_cast<vtkTypeInt64>(n));
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::PackBits(
+  const void *buffer, void *filePtr, vtkIdType bufferSize, int bits)
+{
+  if (bits == 12)
+    {
+    const unsigned char *readPtr =
+      static_cast<const unsigned char *>(buffer);
+    unsigned char *writePtr =
+      static_cast<unsigned char *>(filePtr);
+    vtkIdType n = bufferSize/2;
+    // pack the values two-at-a-time (four bytes to three bytes),
+    // with a branch-free loop body that compilers can vectorize
+    for (vtkIdType m = n/2; m > 0; m--)
+      {
+      unsigned int b1 = readPtr[0] | (readPtr[1] << 8);
+      unsigned int b2 = readPtr[2] | (readPtr[3] << 8);
+      writePtr[0] = static_cast<unsigned char>(b1 >> 4);
+      writePtr[1] = static_cast<unsigned char>((b1 & 0x0f) | (b2 & 0xf0));
+      writePtr[2] = static_cast<unsigned char>(
+        ((b2 & 0x0f) << 4) | ((b2 >> 8) & 0x0f));
+      readPtr += 4;
+      writePtr += 3;
+      }
+    if ((n & 1) != 0)
+      {
+      // pack the final unpaired value
+      unsigned int b1 = readPtr[0] | (readPtr[1] << 8);
+      writePtr[0] = static_cast<unsigned char>(b1 >> 4);
+      writePtr[1] = static_cast<unsigned char>(b1 & 0x0f);
+      }
+    }
+  else if (bits == 1)
+    {
+    const unsigned char *readPtr =
+      static_cast<const unsigned char *>(buffer);
+    unsigned char *writePtr =
+      static_cast<unsigned char *>(filePtr);
+    // gather the low bit of eight bytes into one byte at a time:
+    // load a 64-bit word, keep the low bit of each lane, and use a
+    // multiply to sum the lanes into the top byte with the shifts
+    // that put the first byte's bit in bit zero on either byte order
+#ifdef VTK_WORDS_BIGENDIAN
+    const vtkTypeUInt64 gather = 0x8040201008040201ull;
+#else
+    const vtkTypeUInt64 gather = 0x0102040810204080ull;
+#endif
+    for (vtkIdType n = bufferSize/8; n > 0; n--)
+      {
+      vtkTypeUInt64 a;
+      memcpy(&a, readPtr, 8);
+      a &= 0x0101010101010101ull;
+      *writePtr++ = static_cast<unsigned char>((a*gather) >> 56);
+      readPtr += 8;
+      }
+    size_t r = (bufferSize % 8);
+    if (r > 0)
+      {
+      unsigned int a = 0;
+      for (size_t j = 0; j < r; j++)
+        {
+        a |= (readPtr[j] & 1) << j;
+        }
+      *writePtr = static_cast<unsigned char>(a);
+      }
+    }
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
 {
-  if (this->OutputFile == 0)
+  if (this->OutputFile == 0 && this->OutputBuffer == 0)
     {
     return;
     }
 
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
   union { char c[2]; short s; } endiancheck;
   // this will set endiancheck.s to 1 on little endian architectures
   endiancheck.c[0] = 1;
@@ -1246,6 +1818,7 @@ void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
       numFrames = (numFrames == 0 ? 1 : numFrames);
       this->FrameData = new unsigned char *[numFrames];
       this->FrameLength = new unsigned int[numFrames];
+      this->FrameAllocated = numFrames;
       for (unsigned int i = 0; i < numFrames; i++)
         {
         this->FrameData[i] = 0;
@@ -1315,13 +1888,13 @@ void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
         cp += 8;
         }
       }
-    n = this->OutputFile->Write(buf, size);
+    n = this->WriteBytes(buf, size);
     delete [] buf;
     }
   else
     {
     // For uncompressed frames, write the data raw
-    n = this->OutputFile->Write(cp, size);
+    n = this->WriteBytes(cp, size);
     }
 
   if (n != static_cast<size_t>(size))
@@ -1329,6 +1902,77 @@ void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
     this->DiskFullError();
     }
 
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    vtkDICOMProfiler::EndPhase(
+      this, vtkDICOMProfiler::FileWrite, profileStart,
+      static_cast<vtkTypeInt64>(n));
+    }
+
+  this->FrameCounter++;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::WriteCompressedFrame(
+  const unsigned char *cp, vtkIdType size)
+{
+  if (this->OutputFile == 0 && this->OutputBuffer == 0)
+    {
+    return;
+    }
+
+  if (!this->Compressed)
+    {
+    this->SetErrorCode(vtkErrorCode::FileFormatError);
+    vtkErrorMacro("WriteCompressedFrame: the transfer syntax is not "
+                  "an encapsulated syntax.");
+    return;
+    }
+
+  // allocate space to hold the fragments until the offset table can
+  // be computed, a single-frame file may have several fragments so
+  // grow the arrays if the frame count from the meta data fills up
+  if (this->FrameData == 0)
+    {
+    unsigned int numFrames =
+      this->MetaData->GetAttributeValue(DC::NumberOfFrames).AsUnsignedInt();
+    numFrames = (numFrames == 0 ? 1 : numFrames);
+    this->FrameData = new unsigned char *[numFrames];
+    this->FrameLength = new unsigned int[numFrames];
+    this->FrameAllocated = numFrames;
+    for (unsigned int i = 0; i < numFrames; i++)
+      {
+      this->FrameData[i] = 0;
+      this->FrameLength[i] = 0;
+      }
+    }
+  else if (this->FrameCounter >= this->FrameAllocated)
+    {
+    unsigned int numFrames = 2*this->FrameAllocated;
+    unsigned char **frameData = new unsigned char *[numFrames];
+    unsigned int *frameLength = new unsigned int[numFrames];
+    for (unsigned int i = 0; i < numFrames; i++)
+      {
+      frameData[i] = (i < this->FrameCounter ? this->FrameData[i] : 0);
+      frameLength[i] = (i < this->FrameCounter ? this->FrameLength[i] : 0);
+      }
+    delete [] this->FrameData;
+    delete [] this->FrameLength;
+    this->FrameData = frameData;
+    this->FrameLength = frameLength;
+    this->FrameAllocated = numFrames;
+    }
+
+  // copy the fragment verbatim, padding it to an even length
+  unsigned int fl = static_cast<unsigned int>(size);
+  unsigned char *fd = new unsigned char[fl + (fl & 1)];
+  memcpy(fd, cp, fl);
+  if ((fl & 1) != 0)
+    {
+    fd[fl++] = 0;
+    }
+  this->FrameData[this->FrameCounter] = fd;
+  this->FrameLength[this->FrameCounter] = fl;
   this->FrameCounter++;
 }
 
@@ -1437,6 +2081,10 @@ bool vtkDICOMCompiler::WriteMetaData(
   // the encoders to choose from
   LittleEndianEncoder encoderLE(this, idx);
   BigEndianEncoder encoderBE(this, idx);
+  encoderLE.SetTrusted(this->TrustedSource);
+  encoderBE.SetTrusted(this->TrustedSource);
+  encoderLE.SetDelimited(this->DelimitedSequences);
+  encoderBE.SetDelimited(this->DelimitedSequences);
   EncoderBase *encoder = &encoderLE;
   this->Compressed = false;
   this->BigEndian = false;
@@ -1460,6 +2108,11 @@ bool vtkDICOMCompiler::WriteMetaData(
     encoder->SetImplicitVR(true);
     this->BigEndian = true;
     }
+  else if (tsyntax == "1.2.840.10008.1.2.1.99") // Deflated Explicit LE
+    {
+    // ordinary explicit LE encoding, the deflation itself is
+    // applied as the encoded bytes pass through WriteBytes()
+    }
   else if (tsyntax != "1.2.840.10008.1.2.1") // Explicit LE
     {
     this->Compressed = true;
@@ -1589,6 +2242,133 @@ unsigned int vtkDICOMCompiler::ComputePixelDataSize()
   return vl;
 }
 
+//----------------------------------------------------------------------------
+size_t vtkDICOMCompiler::WriteBytes(const void *data, size_t count)
+{
+  if (!this->Deflated)
+    {
+    return this->WriteRawBytes(data, count);
+    }
+
+  // pass the bytes through the deflate stream, writing the
+  // compressed output as it is produced
+  z_stream *zs = static_cast<z_stream *>(this->ZStream);
+  const unsigned char *dp = static_cast<const unsigned char *>(data);
+  size_t remaining = count;
+
+  while (remaining > 0)
+    {
+    // feed the input in chunks that fit in an unsigned int
+    const size_t maxchunk = 0x40000000; // 1GB
+    size_t chunk = (remaining < maxchunk ? remaining : maxchunk);
+    zs->next_in = const_cast<unsigned char *>(dp);
+    zs->avail_in = static_cast<unsigned int>(chunk);
+
+    while (zs->avail_in > 0)
+      {
+      zs->next_out = this->ZBuffer;
+      zs->avail_out = static_cast<unsigned int>(this->ChunkSize);
+      deflate(zs, Z_NO_FLUSH);
+      size_t n = this->ChunkSize - zs->avail_out;
+      if (n != 0 && this->WriteRawBytes(this->ZBuffer, n) != n)
+        {
+        return 0;
+        }
+      }
+
+    dp += chunk;
+    remaining -= chunk;
+    }
+
+  return count;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMCompiler::WriteRawBytes(const void *data, size_t count)
+{
+  if (this->OutputBuffer)
+    {
+    // append the bytes to the growable output buffer
+    vtkIdType n = this->OutputBuffer->GetNumberOfTuples();
+    unsigned char *dp = this->OutputBuffer->WritePointer(
+      n, static_cast<vtkIdType>(count));
+    memcpy(dp, data, count);
+    return count;
+    }
+
+  return this->OutputFile->Write(
+    static_cast<const unsigned char *>(data), count);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::StartDeflate()
+{
+  z_stream *zs = new z_stream;
+  memset(zs, 0, sizeof(z_stream));
+
+  // negative window bits: raw deflate data, without a zlib header
+  if (deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+    delete zs;
+    this->CompileError("Could not allocate the deflate state.");
+    return false;
+    }
+  this->ZStream = zs;
+
+  if (this->ZBuffer == NULL)
+    {
+    this->ZBuffer = new unsigned char [this->ChunkSize];
+    }
+  this->Deflated = true;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::FinishDeflate()
+{
+  z_stream *zs = static_cast<z_stream *>(this->ZStream);
+  bool rval = true;
+  int code;
+
+  do
+    {
+    zs->next_out = this->ZBuffer;
+    zs->avail_out = static_cast<unsigned int>(this->ChunkSize);
+    code = deflate(zs, Z_FINISH);
+    size_t n = this->ChunkSize - zs->avail_out;
+    if (n != 0 && this->WriteRawBytes(this->ZBuffer, n) != n)
+      {
+      rval = false;
+      break;
+      }
+    if (code != Z_OK && code != Z_BUF_ERROR && code != Z_STREAM_END)
+      {
+      rval = false;
+      break;
+      }
+    }
+  while (code != Z_STREAM_END);
+
+  deflateEnd(zs);
+  delete zs;
+  this->ZStream = NULL;
+  this->Deflated = false;
+
+  return rval;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::AbortDeflate()
+{
+  z_stream *zs = static_cast<z_stream *>(this->ZStream);
+  deflateEnd(zs);
+  delete zs;
+  this->ZStream = NULL;
+  this->Deflated = false;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMCompiler::FlushBuffer(
   unsigned char* &ucp, unsigned char* &ep)
@@ -1602,7 +2382,7 @@ bool vtkDICOMCompiler::FlushBuffer(
   if (cp)
     {
     size_t n = cp - dp;
-    size_t m = this->OutputFile->Write(dp, n);
+    size_t m = this->WriteBytes(dp, n);
     rval = (n == m);
     }
 
@@ -1614,7 +2394,8 @@ void vtkDICOMCompiler::CompileError(const char* message)
 {
   this->SetErrorCode(vtkErrorCode::FileFormatError);
   vtkErrorMacro("Error while writing file "
-                << this->FileName << ": " << message);
+                << (this->FileName ? this->FileName : "(output buffer)")
+                << ": " << message);
 }
 
 //----------------------------------------------------------------------------
@@ -1653,8 +2434,13 @@ void vtkDICOMCompiler::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "TransferSyntaxUID: "
      << (this->TransferSyntaxUID ? this->TransferSyntaxUID : "(NULL)") << "\n";
   os << indent << "MetaData: " << this->MetaData << "\n";
+  os << indent << "OutputBuffer: " << this->OutputBuffer << "\n";
   os << indent << "Index: " << this->Index << "\n";
   os << indent << "BufferSize: " << this->BufferSize << "\n";
   os << indent << "KeepOriginalPixelDataVR: "
      << (this->KeepOriginalPixelDataVR ? "On\n" : "Off\n");
+  os << indent << "TrustedSource: "
+     << (this->TrustedSource ? "On\n" : "Off\n");
+  os << indent << "DelimitedSequences: "
+     << (this->DelimitedSequences ? "On\n" : "Off\n");
 }
@@ -19,6 +19,8 @@
 
 
 class vtkStringArray;
+class vtkTypeInt64Array;
+class vtkUnsignedCharArray;
 class vtkDICOMFile;
 class vtkDICOMMetaData;
 class vtkDICOMCompilerInternalFriendship;
@@ -131,7 +133,7 @@ public:
   //@}
 
   //@{
-  //! Set the buffer size, the default is 8192 (8k).
+  //! Set the buffer size, the default is 65536 (64k).
   /*!
    *  A larger buffer size results in fewer IO calls.  The
    *  minimum buffer size is 256 bytes.
@@ -140,6 +142,21 @@ public:
   int GetBufferSize() { return this->BufferSize; }
   //@}
 
+  //@{
+  //! Compile into memory instead of into a file.
+  /*!
+   *  Supply a growable buffer that will receive the complete Part-10
+   *  data stream.  The buffer is emptied when writing begins, and
+   *  after Close() it holds the same bytes that would have gone into
+   *  the file, ready to be handed to a socket send without any trip
+   *  through the filesystem.  The file name is ignored while an
+   *  output buffer is set.  Set the buffer to NULL to revert to
+   *  writing a file.
+   */
+  void SetOutputBuffer(vtkUnsignedCharArray *buffer);
+  vtkUnsignedCharArray *GetOutputBuffer() { return this->OutputBuffer; }
+  //@}
+
   //@{
   //! Write the metadata to the file.
   virtual void WriteHeader();
@@ -155,6 +172,21 @@ public:
   //! Write one frame to the end of the file.
   virtual void WriteFrame(const unsigned char *cp, vtkIdType size);
 
+  //! Write one frame that is already compressed.
+  /*!
+   *  The supplied bytes are spliced into the encapsulated PixelData
+   *  element exactly as given, without being passed through a codec,
+   *  so the transfer syntax of this compiler must match the syntax
+   *  that the frame was compressed with.  Each call produces one
+   *  fragment and one entry in the basic offset table, which is
+   *  recomputed from the fragment lengths when the file is closed.
+   *  Use this together with the fragment table of vtkDICOMParser
+   *  (see SetFragmentTable) to rewrite the metadata of a compressed
+   *  file at raw copy speed instead of transcode speed.
+   */
+  virtual void WriteCompressedFrame(
+    const unsigned char *cp, vtkIdType size);
+
   //! Close the file.
   virtual void Close();
 
@@ -169,6 +201,32 @@ public:
   unsigned long GetErrorCode() { return this->ErrorCode; }
   //@}
 
+  //@{
+  //! Patch individual elements of an existing file.
+  /*!
+   *  This provides a fast path for changing a handful of attributes
+   *  (a corrected PatientID, shifted dates) without recompiling the
+   *  whole file.  The source file must first be parsed with an
+   *  offset table (see SetOffsetTable in vtkDICOMParser), and the
+   *  transfer syntax of this compiler must be set to the transfer
+   *  syntax of the source file.  Each element of "changes" replaces
+   *  the element with the same tag in the source file, or is
+   *  inserted at the proper position if the tag is absent, while
+   *  every other byte range of the source, including the pixel
+   *  data, is copied verbatim, so bulk edits are limited by disk
+   *  speed rather than by re-encoding.  Any retired group length
+   *  elements in the source are adjusted to account for changes in
+   *  size.  Elements of the file meta header (group 0x0002) and
+   *  elements at or beyond the PixelData cannot be patched, and
+   *  deflated files cannot be patched at all.  The output goes to
+   *  the file set with SetFileName() (or to the output buffer),
+   *  and must not overwrite the source file.
+   */
+  virtual bool PatchFile(
+    const char *sourceName, vtkTypeInt64Array *offsets,
+    vtkDICOMMetaData *changes);
+  //@}
+
   //@{
   //! Generate a series UID and instance UIDs for the meta data.
   /*!
@@ -191,10 +249,80 @@ public:
   vtkGetMacro(KeepOriginalPixelDataVR, bool);
   //@}
 
+  //@{
+  //! Write trusted metadata without per-element re-encoding.
+  /*!
+   *  When the metadata comes unmodified from vtkDICOMParser, every
+   *  value is already known to satisfy the size and padding rules of
+   *  its VR and, if the output transfer syntax has the same byte
+   *  order as this machine, the value buffers are already in their
+   *  file encoding.  Setting this flag makes the compiler copy such
+   *  values through byte-for-byte instead of re-encoding them value
+   *  by value, which speeds up round trips like dicomtodicom.  The
+   *  output bytes are identical either way, so this is purely a
+   *  performance setting, but it must be left off for metadata that
+   *  was built or modified by hand.
+   */
+  vtkSetMacro(TrustedSource, bool);
+  vtkBooleanMacro(TrustedSource, bool);
+  vtkGetMacro(TrustedSource, bool);
+  //@}
+
+  //@{
+  //! Write sequences with undefined length and delimiter items.
+  /*!
+   *  By default, every sequence and item is written with an explicit
+   *  length, which requires a recursive pass over the nested contents
+   *  to total up their encoded sizes before the first byte of the
+   *  sequence can be written.  Setting this flag writes sequences and
+   *  items with the undefined length 0xFFFFFFFF and closes them with
+   *  delimiters instead (see DICOM Part 5, Section 7.5), so nested
+   *  contents stream straight into the output buffer in a single
+   *  pass.  This helps for data sets that are mostly sequence, such
+   *  as structure sets with large contour sequences.
+   */
+  vtkSetMacro(DelimitedSequences, bool);
+  vtkBooleanMacro(DelimitedSequences, bool);
+  vtkGetMacro(DelimitedSequences, bool);
+  //@}
+
+  //@{
+  //! Pack 8 bits to 1 bit or 16 bits to 12 bits.
+  /*!
+   *  This is the inverse of vtkDICOMReader::UnpackBits, for use when
+   *  writing bit-packed pixel data.  The bufferSize is the size in
+   *  bytes of the unpacked data in the buffer; for 12 bits, every two
+   *  16-bit values are packed into three bytes of output, and for
+   *  1 bit, every eight bytes are packed into a single output byte.
+   */
+  static void PackBits(
+    const void *buffer, void *filePtr, vtkIdType bufferSize, int bits);
+  //@}
+
 protected:
   vtkDICOMCompiler();
   ~vtkDICOMCompiler();
 
+  //! Write bytes to the output file or to the output buffer.
+  /*!
+   *  If the transfer syntax is Deflated Explicit VR Little Endian,
+   *  then everything written after the meta header passes through
+   *  the deflate stream before it reaches the output.
+   */
+  size_t WriteBytes(const void *data, size_t count);
+
+  //! Write bytes directly, bypassing any deflation.
+  size_t WriteRawBytes(const void *data, size_t count);
+
+  //! Begin deflating everything that is written after this call.
+  bool StartDeflate();
+
+  //! Finish the deflate stream, writing the remaining output.
+  bool FinishDeflate();
+
+  //! Discard the deflate stream without writing anything.
+  void AbortDeflate();
+
   //! Internal method for flushing the IO buffer.
   /*!
    *  This is an internal method that flushes the buffer to the file.
@@ -251,16 +379,23 @@ protected:
   vtkDICOMMetaData *MetaData;
   vtkStringArray *SeriesUIDs;
   vtkDICOMFile *OutputFile;
+  vtkUnsignedCharArray *OutputBuffer;
   unsigned char *Buffer;
   unsigned char **FrameData;
   unsigned int *FrameLength;
   unsigned int FrameCounter;
+  unsigned int FrameAllocated;
   int BufferSize;
   int ChunkSize;
   int Index;
   bool BigEndian;
   bool Compressed;
   bool KeepOriginalPixelDataVR;
+  bool TrustedSource;
+  bool DelimitedSequences;
+  bool Deflated;
+  void *ZStream;
+  unsigned char *ZBuffer;
   unsigned long ErrorCode;
 
   static char StudyUID[64];
@@ -0,0 +1,406 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMDIRGenerator.h"
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFilePath.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMUtilities.h"
+
+#include <vtkErrorCode.h>
+#include <vtkIntArray.h>
+#include <vtkObjectFactory.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMDIRGenerator);
+vtkCxxSetObjectMacro(vtkDICOMDIRGenerator,Directory,vtkDICOMDirectory);
+
+//----------------------------------------------------------------------------
+namespace {
+
+// The SOP Class for DICOMDIR files (Media Storage Directory Storage).
+const char *MediaStorageDirectoryUID = "1.2.840.10008.1.3.10";
+
+// Check for a path separator (POSIX or Windows).
+bool vtkDICOMDIRGeneratorIsSeparator(char c)
+{
+  return (c == '/' || c == '\\');
+}
+
+// Give a directory record its type and placeholder link elements.
+// The links are patched with real byte offsets before the final write.
+void vtkDICOMDIRGeneratorInitRecord(vtkDICOMItem *item, const char *type)
+{
+  item->SetAttributeValue(DC::OffsetOfTheNextDirectoryRecord, 0);
+  item->SetAttributeValue(DC::RecordInUseFlag, 0xFFFF);
+  item->SetAttributeValue(
+    DC::OffsetOfReferencedLowerLevelDirectoryEntity, 0);
+  item->SetAttributeValue(DC::DirectoryRecordType, type);
+}
+
+// Convert a file name into a File ID relative to the file set root,
+// with the components joined by backslashes as for a multi-valued CS.
+// Return false if the file does not lie within the root directory.
+bool vtkDICOMDIRGeneratorRelativeFileID(
+  const std::string& root, const std::string& fileName, std::string *fileID)
+{
+  size_t n = root.length();
+  while (n > 0 && vtkDICOMDIRGeneratorIsSeparator(root[n-1]))
+    {
+    --n;
+    }
+
+  if (fileName.length() <= n + 1 ||
+      fileName.compare(0, n, root, 0, n) != 0 ||
+      !vtkDICOMDIRGeneratorIsSeparator(fileName[n]))
+    {
+    return false;
+    }
+
+  // split the remainder into components, dropping empty ones
+  fileID->clear();
+  size_t i = n + 1;
+  while (i < fileName.length())
+    {
+    size_t j = i;
+    while (j < fileName.length() &&
+           !vtkDICOMDIRGeneratorIsSeparator(fileName[j]))
+      {
+      j++;
+      }
+    if (j > i)
+      {
+      std::string component = fileName.substr(i, j - i);
+      if (component == "..")
+        {
+        // refuse paths that escape the file set root
+        return false;
+        }
+      if (component != ".")
+        {
+        if (!fileID->empty())
+          {
+          fileID->push_back('\\');
+          }
+        fileID->append(component);
+        }
+      }
+    i = j + 1;
+    }
+
+  return !fileID->empty();
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDIRGenerator::vtkDICOMDIRGenerator()
+{
+  this->Directory = 0;
+  this->DirectoryName = 0;
+  this->FileSetID = 0;
+  this->ErrorCode = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDIRGenerator::~vtkDICOMDIRGenerator()
+{
+  if (this->Directory)
+    {
+    this->Directory->Delete();
+    }
+  delete [] this->DirectoryName;
+  delete [] this->FileSetID;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDIRGenerator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Directory: " << this->Directory << "\n";
+  os << indent << "DirectoryName: "
+     << (this->DirectoryName ? this->DirectoryName : "(NULL)") << "\n";
+  os << indent << "FileSetID: "
+     << (this->FileSetID ? this->FileSetID : "(NULL)") << "\n";
+  os << indent << "ErrorCode: " << this->ErrorCode << "\n";
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDIRGenerator::WriteDICOMDIR()
+{
+  this->ErrorCode = 0;
+
+  if (this->Directory == 0 || this->DirectoryName == 0)
+    {
+    vtkErrorMacro("WriteDICOMDIR: A scanned directory and a directory"
+                  " name must be set.");
+    this->ErrorCode = vtkErrorCode::NoFileNameError;
+    return false;
+    }
+
+  vtkDICOMDirectory *dir = this->Directory;
+  std::string root = this->DirectoryName;
+
+  // Build the record hierarchy in depth-first order, with the links
+  // stored as indices into the record vector (-1 if no link).
+  std::vector<vtkDICOMItem> records;
+  std::vector<int> nexts;
+  std::vector<int> childs;
+  int lastRoot = -1;
+
+  int numberOfPatients = dir->GetNumberOfPatients();
+  for (int p = 0; p < numberOfPatients; p++)
+    {
+    int patientIdx = static_cast<int>(records.size());
+    vtkDICOMItem patientRecord = dir->GetPatientRecord(p);
+    vtkDICOMDIRGeneratorInitRecord(&patientRecord, "PATIENT");
+    records.push_back(patientRecord);
+    nexts.push_back(-1);
+    childs.push_back(-1);
+    if (lastRoot >= 0)
+      {
+      nexts[lastRoot] = patientIdx;
+      }
+    lastRoot = patientIdx;
+
+    vtkIntArray *studies = dir->GetStudiesForPatient(p);
+    vtkIdType numberOfStudies = studies->GetNumberOfTuples();
+    int lastStudy = -1;
+    for (vtkIdType si = 0; si < numberOfStudies; si++)
+      {
+      int study = studies->GetValue(si);
+      int studyIdx = static_cast<int>(records.size());
+      vtkDICOMItem studyRecord = dir->GetStudyRecord(study);
+      vtkDICOMDIRGeneratorInitRecord(&studyRecord, "STUDY");
+      records.push_back(studyRecord);
+      nexts.push_back(-1);
+      childs.push_back(-1);
+      if (lastStudy >= 0)
+        {
+        nexts[lastStudy] = studyIdx;
+        }
+      else
+        {
+        childs[patientIdx] = studyIdx;
+        }
+      lastStudy = studyIdx;
+
+      int lastSeries = -1;
+      int seriesEnd = dir->GetLastSeriesForStudy(study);
+      for (int series = dir->GetFirstSeriesForStudy(study);
+           series <= seriesEnd; series++)
+        {
+        int seriesIdx = static_cast<int>(records.size());
+        vtkDICOMItem seriesRecord = dir->GetSeriesRecord(series);
+        vtkDICOMDIRGeneratorInitRecord(&seriesRecord, "SERIES");
+        records.push_back(seriesRecord);
+        nexts.push_back(-1);
+        childs.push_back(-1);
+        if (lastSeries >= 0)
+          {
+          nexts[lastSeries] = seriesIdx;
+          }
+        else
+          {
+          childs[studyIdx] = seriesIdx;
+          }
+        lastSeries = seriesIdx;
+
+        vtkDICOMMetaData *meta = dir->GetMetaDataForSeries(series);
+        vtkStringArray *files = dir->GetFileNamesForSeries(series);
+        vtkIdType numberOfFiles =
+          (files ? files->GetNumberOfValues() : 0);
+        int lastImage = -1;
+        for (vtkIdType f = 0; f < numberOfFiles; f++)
+          {
+          std::string fileID;
+          if (!vtkDICOMDIRGeneratorRelativeFileID(
+                root, files->GetValue(f), &fileID))
+            {
+            vtkWarningMacro("WriteDICOMDIR: Skipping file outside of"
+                            " the file set: " << files->GetValue(f));
+            continue;
+            }
+
+          int imageIdx = static_cast<int>(records.size());
+          vtkDICOMItem imageRecord;
+          vtkDICOMDIRGeneratorInitRecord(&imageRecord, "IMAGE");
+          imageRecord.SetAttributeValue(DC::ReferencedFileID,
+            vtkDICOMValue(vtkDICOMVR::CS, fileID));
+          if (meta)
+            {
+            int idx = static_cast<int>(f);
+            imageRecord.SetAttributeValue(
+              DC::ReferencedSOPClassUIDInFile,
+              meta->GetAttributeValue(idx, DC::SOPClassUID));
+            imageRecord.SetAttributeValue(
+              DC::ReferencedSOPInstanceUIDInFile,
+              meta->GetAttributeValue(idx, DC::SOPInstanceUID));
+            const vtkDICOMValue& tsv =
+              meta->GetAttributeValue(idx, DC::TransferSyntaxUID);
+            if (tsv.IsValid())
+              {
+              imageRecord.SetAttributeValue(
+                DC::ReferencedTransferSyntaxUIDInFile, tsv);
+              }
+            const vtkDICOMValue& inst =
+              meta->GetAttributeValue(idx, DC::InstanceNumber);
+            if (inst.IsValid())
+              {
+              imageRecord.SetAttributeValue(DC::InstanceNumber, inst);
+              }
+            }
+          records.push_back(imageRecord);
+          nexts.push_back(-1);
+          childs.push_back(-1);
+          if (lastImage >= 0)
+            {
+            nexts[lastImage] = imageIdx;
+            }
+          else
+            {
+            childs[seriesIdx] = imageIdx;
+            }
+          lastImage = imageIdx;
+          }
+        }
+      }
+    }
+
+  size_t numberOfRecords = records.size();
+
+  // Assemble the data set, initially with placeholder offsets.
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->SetAttributeValue(
+    DC::MediaStorageSOPClassUID, MediaStorageDirectoryUID);
+  meta->SetAttributeValue(
+    DC::FileSetID,
+    std::string(this->FileSetID ? this->FileSetID : ""));
+  meta->SetAttributeValue(
+    DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity, 0);
+  meta->SetAttributeValue(
+    DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity, 0);
+  meta->SetAttributeValue(DC::FileSetConsistencyFlag, 0);
+
+  vtkDICOMSequence recordSeq(
+    static_cast<unsigned int>(numberOfRecords));
+  for (size_t i = 0; i < numberOfRecords; i++)
+    {
+    recordSeq.SetItem(i, records[i]);
+    }
+  meta->SetAttributeValue(DC::DirectoryRecordSequence, recordSeq);
+
+  // The same SOP Instance UID must be used for both passes, so that
+  // the byte offsets found in the first pass remain valid.
+  std::string instanceUID =
+    vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID);
+
+  // First pass: compile into memory to discover the byte offset of
+  // each directory record.
+  vtkSmartPointer<vtkUnsignedCharArray> buffer =
+    vtkSmartPointer<vtkUnsignedCharArray>::New();
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetMetaData(meta);
+  compiler->SetSOPInstanceUID(instanceUID.c_str());
+  compiler->SetOutputBuffer(buffer);
+  compiler->WriteHeader();
+  compiler->Close();
+  if (compiler->GetErrorCode() != 0)
+    {
+    this->ErrorCode = compiler->GetErrorCode();
+    return false;
+    }
+
+  // Parse the compiled data set to recover the item byte offsets.
+  vtkSmartPointer<vtkDICOMMetaData> parsedMeta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetInputBuffer(
+    buffer->GetPointer(0), buffer->GetNumberOfTuples());
+  parser->SetMetaData(parsedMeta);
+  parser->Update();
+  const vtkDICOMValue& parsedSeq =
+    parsedMeta->GetAttributeValue(DC::DirectoryRecordSequence);
+  if (parser->GetErrorCode() != 0 ||
+      parsedSeq.GetNumberOfValues() != numberOfRecords)
+    {
+    vtkErrorMacro("WriteDICOMDIR: Unable to compute the directory"
+                  " record offsets.");
+    this->ErrorCode = vtkErrorCode::UnknownError;
+    return false;
+    }
+  const vtkDICOMItem *parsedItems = parsedSeq.GetSequenceData();
+
+  // Patch the real offsets into the records.  The offsets are stable
+  // between the two passes, because only the values of fixed-size UL
+  // elements change.
+  for (size_t i = 0; i < numberOfRecords; i++)
+    {
+    unsigned int nextOffset =
+      (nexts[i] < 0 ? 0 : parsedItems[nexts[i]].GetByteOffset());
+    unsigned int childOffset =
+      (childs[i] < 0 ? 0 : parsedItems[childs[i]].GetByteOffset());
+    records[i].SetAttributeValue(
+      DC::OffsetOfTheNextDirectoryRecord, nextOffset);
+    records[i].SetAttributeValue(
+      DC::OffsetOfReferencedLowerLevelDirectoryEntity, childOffset);
+    recordSeq.SetItem(i, records[i]);
+    }
+  meta->SetAttributeValue(DC::DirectoryRecordSequence, recordSeq);
+  if (numberOfRecords > 0)
+    {
+    meta->SetAttributeValue(
+      DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity,
+      parsedItems[0].GetByteOffset());
+    meta->SetAttributeValue(
+      DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity,
+      parsedItems[lastRoot].GetByteOffset());
+    }
+
+  // Second pass: compile to the DICOMDIR file itself.
+  vtkDICOMFilePath path(root);
+  path.PushBack("DICOMDIR");
+  compiler->SetOutputBuffer(0);
+  compiler->SetFileName(path.AsString().c_str());
+  compiler->WriteHeader();
+  if (compiler->GetErrorCode() != 0)
+    {
+    this->ErrorCode = compiler->GetErrorCode();
+    compiler->CloseAndRemove();
+    return false;
+    }
+  compiler->Close();
+  if (compiler->GetErrorCode() != 0)
+    {
+    // the final flush failed, remove the partial file
+    this->ErrorCode = compiler->GetErrorCode();
+    vtkDICOMFile::Remove(path.AsString().c_str());
+    return false;
+    }
+
+  return true;
+}
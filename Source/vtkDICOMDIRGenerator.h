@@ -0,0 +1,98 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMDIRGenerator_h
+#define vtkDICOMDIRGenerator_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkDICOMDirectory;
+
+//! Generate a DICOMDIR file for a DICOM file set.
+/*!
+ *  This class builds the directory record hierarchy (PATIENT, STUDY,
+ *  SERIES, IMAGE) from the results of a vtkDICOMDirectory scan, and
+ *  compiles it into a DICOMDIR file at the root of the file set.  A
+ *  file set that ships with a DICOMDIR can be indexed without opening
+ *  the individual files, for example by setting TrustDICOMDIR on a
+ *  vtkDICOMDirectory that later scans the same tree.  Only files that
+ *  lie within the file set root directory can be referenced, since
+ *  the DICOMDIR stores relative paths.
+ */
+class VTKDICOM_EXPORT vtkDICOMDIRGenerator : public vtkObject
+{
+public:
+  //! Create a new vtkDICOMDIRGenerator instance.
+  static vtkDICOMDIRGenerator *New();
+
+  //! VTK dynamic type information macro.
+  vtkTypeMacro(vtkDICOMDIRGenerator, vtkObject);
+
+  //! Print a summary of the contents of this object.
+  void PrintSelf(ostream& os, vtkIndent indent);
+
+  //@{
+  //! Set the scanned directory that describes the file set.
+  /*!
+   *  The directory must have been updated before the DICOMDIR is
+   *  generated, and the files that it lists must reside within the
+   *  directory given by SetDirectoryName().
+   */
+  void SetDirectory(vtkDICOMDirectory *);
+  vtkDICOMDirectory *GetDirectory() { return this->Directory; }
+  //@}
+
+  //@{
+  //! Set the root directory of the file set.
+  /*!
+   *  The DICOMDIR file will be written into this directory, and all
+   *  file references within the DICOMDIR will be relative to it.
+   */
+  vtkSetStringMacro(DirectoryName);
+  vtkGetStringMacro(DirectoryName);
+  //@}
+
+  //@{
+  //! Set the File-set ID to record in the DICOMDIR (16 chars max).
+  /*!
+   *  The File-set ID is a purely informative label for the file set.
+   *  If no ID is provided, the attribute will be left empty.
+   */
+  vtkSetStringMacro(FileSetID);
+  vtkGetStringMacro(FileSetID);
+  //@}
+
+  //@{
+  //! Generate the DICOMDIR file, return false if an error occurred.
+  virtual bool WriteDICOMDIR();
+
+  //! Get the IO error code from the most recent write.
+  unsigned long GetErrorCode() { return this->ErrorCode; }
+  //@}
+
+protected:
+  vtkDICOMDIRGenerator();
+  ~vtkDICOMDIRGenerator();
+
+  vtkDICOMDirectory *Directory;
+  char *DirectoryName;
+  char *FileSetID;
+  unsigned long ErrorCode;
+
+private:
+  vtkDICOMDIRGenerator(const vtkDICOMDIRGenerator&);  // Not implemented.
+  void operator=(const vtkDICOMDIRGenerator&);  // Not implemented.
+};
+
+#endif /* vtkDICOMDIRGenerator_h */
@@ -0,0 +1,420 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMDictFile.h"
+#include "vtkDICOMFile.h"
+
+#include <vtkObjectFactory.h>
+
+#include <string.h>
+
+#include <map>
+#include <string>
+
+vtkStandardNewMacro(vtkDICOMDictFile);
+
+namespace {
+
+// the signature at the start of every dictionary file
+const char vtkDICOMDictFileMagic[8] = {
+  'D', 'I', 'C', 'M', 'D', 'I', 'C', 'T'
+};
+
+// the current version of the dictionary file format
+const unsigned int vtkDICOMDictFileVersion = 1;
+
+// the marker that records the byte order of the writing machine
+const unsigned short vtkDICOMDictFileEndian = 0x0102;
+
+// the sizes of the fixed-layout parts of the file
+const unsigned int vtkDICOMDictFileHeaderSize = 24;
+const unsigned int vtkDICOMDictFileRecordSize = 28;
+const unsigned int vtkDICOMDictFileEntrySize = 12;
+
+// the integers are stored in the byte order of the writing machine,
+// memcpy is used so that unaligned offsets are safe
+void vtkDICOMDictFilePut16(unsigned char *cp, unsigned short v)
+{
+  memcpy(cp, &v, 2);
+}
+
+void vtkDICOMDictFilePut32(unsigned char *cp, unsigned int v)
+{
+  memcpy(cp, &v, 4);
+}
+
+unsigned short vtkDICOMDictFileGet16(const unsigned char *cp)
+{
+  unsigned short v;
+  memcpy(&v, cp, 2);
+  return v;
+}
+
+unsigned int vtkDICOMDictFileGet32(const unsigned char *cp)
+{
+  unsigned int v;
+  memcpy(&v, cp, 4);
+  return v;
+}
+
+// Compute the length of a hash table, in values.  The first hashSize
+// values of the table are bucket offsets into the table itself, and
+// each bucket is a count followed by that many pairs of values, so
+// the length is found by walking to the end of the furthest bucket.
+unsigned int vtkDICOMDictFileTableSize(
+  const unsigned short *table, unsigned short hashSize)
+{
+  unsigned int n = hashSize;
+  for (unsigned short i = 0; i < hashSize; i++)
+    {
+    unsigned int off = table[i];
+    unsigned int end = off + 1 + 2*table[off];
+    n = (end > n ? end : n);
+    }
+  return n;
+}
+
+// Add a string to the pool, re-using any identical earlier string,
+// and return its offset within the pool.
+unsigned int vtkDICOMDictFileAddString(
+  std::string *pool, std::map<std::string, unsigned int> *index,
+  const char *text)
+{
+  std::string s(text ? text : "");
+  std::map<std::string, unsigned int>::iterator it = index->find(s);
+  if (it != index->end())
+    {
+    return it->second;
+    }
+  unsigned int offset = static_cast<unsigned int>(pool->size());
+  pool->append(s);
+  pool->push_back('\0');
+  index->insert(std::make_pair(s, offset));
+  return offset;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDictFile::vtkDICOMDictFile()
+{
+  this->FileName = 0;
+  this->InputFile = 0;
+  this->Mapping = 0;
+  this->Dicts = 0;
+  this->NumberOfDictionaries = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDictFile::~vtkDICOMDictFile()
+{
+  this->Unload();
+  delete [] this->FileName;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictFile::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileName: "
+     << (this->FileName ? this->FileName : "(NULL)") << "\n";
+  os << indent << "NumberOfDictionaries: "
+     << this->NumberOfDictionaries << "\n";
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDictFile::Load()
+{
+  if (this->Mapping)
+    {
+    vtkErrorMacro("Load: A dictionary file is already loaded");
+    return false;
+    }
+  if (!this->FileName)
+    {
+    vtkErrorMacro("Load: No file name has been set");
+    return false;
+    }
+
+  vtkDICOMFile *infile = new vtkDICOMFile(this->FileName, vtkDICOMFile::In);
+  if (infile->GetError())
+    {
+    vtkErrorMacro("Load: Can't open the file " << this->FileName);
+    delete infile;
+    return false;
+    }
+
+  size_t fileSize = static_cast<size_t>(infile->GetSize());
+  const unsigned char *cp = infile->Map(fileSize);
+  if (cp)
+    {
+    // the mapping is shared read-only with every other process that
+    // has loaded the same file
+    this->InputFile = infile;
+    }
+  else
+    {
+    // fall back to reading the file, if it cannot be mapped
+    unsigned char *buffer = new unsigned char[fileSize];
+    if (infile->Read(buffer, fileSize) != fileSize)
+      {
+      vtkErrorMacro("Load: Can't read the file " << this->FileName);
+      delete [] buffer;
+      delete infile;
+      return false;
+      }
+    infile->Close();
+    delete infile;
+    cp = buffer;
+    }
+  this->Mapping = cp;
+
+  // validate the header
+  bool valid = (fileSize >= vtkDICOMDictFileHeaderSize &&
+                memcmp(cp, vtkDICOMDictFileMagic, 8) == 0 &&
+                vtkDICOMDictFileGet32(cp + 8) == vtkDICOMDictFileVersion);
+  if (valid && vtkDICOMDictFileGet16(cp + 12) != vtkDICOMDictFileEndian)
+    {
+    vtkErrorMacro("Load: The file " << this->FileName << " was compiled"
+                  " on a machine with a different byte order");
+    this->Unload();
+    return false;
+    }
+
+  unsigned int count = 0;
+  if (valid)
+    {
+    count = vtkDICOMDictFileGet32(cp + 16);
+    valid = (vtkDICOMDictFileGet32(cp + 20) == fileSize &&
+             vtkDICOMDictFileHeaderSize +
+               count*vtkDICOMDictFileRecordSize <= fileSize);
+    }
+
+  // build one dictionary from each record, the hash tables and the
+  // strings are used in place from the mapping, only the entry array
+  // is allocated because its records hold pointers into the mapping
+  vtkDICOMDictionary::Dict **dicts = 0;
+  if (valid && count > 0)
+    {
+    dicts = new vtkDICOMDictionary::Dict *[count];
+    }
+  unsigned int numLoaded = 0;
+  for (unsigned int i = 0; i < count && valid; i++)
+    {
+    const unsigned char *rp =
+      cp + vtkDICOMDictFileHeaderSize + i*vtkDICOMDictFileRecordSize;
+    unsigned int nameOffset = vtkDICOMDictFileGet32(rp);
+    unsigned int tagOffset = vtkDICOMDictFileGet32(rp + 4);
+    unsigned int tagCount = vtkDICOMDictFileGet32(rp + 8);
+    unsigned int keyOffset = vtkDICOMDictFileGet32(rp + 12);
+    unsigned int keyCount = vtkDICOMDictFileGet32(rp + 16);
+    unsigned int entryOffset = vtkDICOMDictFileGet32(rp + 20);
+    unsigned short hashSize = vtkDICOMDictFileGet16(rp + 24);
+    unsigned short dataSize = vtkDICOMDictFileGet16(rp + 26);
+
+    valid = (hashSize > 0 &&
+             nameOffset < fileSize &&
+             tagOffset % 2 == 0 && keyOffset % 2 == 0 &&
+             tagOffset + 2*static_cast<size_t>(tagCount) <= fileSize &&
+             keyOffset + 2*static_cast<size_t>(keyCount) <= fileSize &&
+             entryOffset + static_cast<size_t>(dataSize)*
+               vtkDICOMDictFileEntrySize <= fileSize);
+    if (!valid)
+      {
+      break;
+      }
+
+    vtkDICOMDictEntry::Entry *entries =
+      new vtkDICOMDictEntry::Entry[dataSize];
+    for (unsigned short j = 0; j < dataSize && valid; j++)
+      {
+      const unsigned char *ep =
+        cp + entryOffset + j*vtkDICOMDictFileEntrySize;
+      entries[j].Group = vtkDICOMDictFileGet16(ep);
+      entries[j].Element = vtkDICOMDictFileGet16(ep + 2);
+      entries[j].Flags = ep[4];
+      entries[j].VR = ep[5];
+      entries[j].VM = vtkDICOMDictFileGet16(ep + 6);
+      unsigned int entryName = vtkDICOMDictFileGet32(ep + 8);
+      valid = (entryName < fileSize);
+      entries[j].Name = reinterpret_cast<const char *>(cp + entryName);
+      }
+    if (!valid)
+      {
+      delete [] entries;
+      break;
+      }
+
+    vtkDICOMDictionary::Dict *dict = new vtkDICOMDictionary::Dict;
+    dict->Name = reinterpret_cast<const char *>(cp + nameOffset);
+    dict->HashSize = hashSize;
+    dict->DataSize = dataSize;
+    dict->TagHashTable =
+      reinterpret_cast<const unsigned short *>(cp + tagOffset);
+    dict->KeyHashTable =
+      reinterpret_cast<const unsigned short *>(cp + keyOffset);
+    dict->Contents = entries;
+    dicts[numLoaded++] = dict;
+
+    vtkDICOMDictionary::AddPrivateDictionary(dict);
+    }
+
+  this->Dicts = dicts;
+  this->NumberOfDictionaries = static_cast<int>(numLoaded);
+
+  if (!valid)
+    {
+    vtkErrorMacro("Load: Not a valid dictionary file: " << this->FileName);
+    this->Unload();
+    }
+
+  return valid;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictFile::Unload()
+{
+  if (this->Dicts)
+    {
+    for (int i = 0; i < this->NumberOfDictionaries; i++)
+      {
+      vtkDICOMDictionary::Dict *dict = this->Dicts[i];
+      vtkDICOMDictionary::RemovePrivateDictionary(dict->Name);
+      delete [] const_cast<vtkDICOMDictEntry::Entry *>(dict->Contents);
+      delete dict;
+      }
+    delete [] this->Dicts;
+    this->Dicts = 0;
+    }
+  this->NumberOfDictionaries = 0;
+
+  if (this->InputFile)
+    {
+    // the mapping belongs to the file
+    this->InputFile->Close();
+    delete this->InputFile;
+    this->InputFile = 0;
+    }
+  else if (this->Mapping)
+    {
+    // the file could not be mapped, so the memory is our own
+    delete [] this->Mapping;
+    }
+  this->Mapping = 0;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDictFile::Write(
+  const char *fileName, vtkDICOMDictionary::Dict **dicts)
+{
+  unsigned int count = 0;
+  while (dicts && dicts[count] != 0)
+    {
+    count++;
+    }
+  if (fileName == 0 || count == 0)
+    {
+    return false;
+    }
+
+  // lay out the sections that follow the records, and build the
+  // string pool with duplicate strings stored only once
+  std::string pool;
+  std::map<std::string, unsigned int> poolIndex;
+  unsigned int offset =
+    vtkDICOMDictFileHeaderSize + count*vtkDICOMDictFileRecordSize;
+  for (unsigned int i = 0; i < count; i++)
+    {
+    vtkDICOMDictionary::Dict *dict = dicts[i];
+    vtkDICOMDictFileAddString(&pool, &poolIndex, dict->Name);
+    unsigned int tagCount = vtkDICOMDictFileTableSize(
+      dict->TagHashTable, dict->HashSize);
+    unsigned int keyCount = vtkDICOMDictFileTableSize(
+      dict->KeyHashTable, dict->HashSize);
+    for (unsigned short j = 0; j < dict->DataSize; j++)
+      {
+      vtkDICOMDictFileAddString(&pool, &poolIndex, dict->Contents[j].Name);
+      }
+    offset += 2*tagCount + 2*keyCount +
+              dict->DataSize*vtkDICOMDictFileEntrySize;
+    offset += (offset & 2); // keep the sections 4-byte aligned
+    }
+  unsigned int poolOffset = offset;
+  unsigned int fileSize = poolOffset + static_cast<unsigned int>(pool.size());
+
+  // assemble the whole file in memory
+  unsigned char *buffer = new unsigned char[fileSize];
+  memset(buffer, 0, fileSize);
+  memcpy(buffer, vtkDICOMDictFileMagic, 8);
+  vtkDICOMDictFilePut32(buffer + 8, vtkDICOMDictFileVersion);
+  vtkDICOMDictFilePut16(buffer + 12, vtkDICOMDictFileEndian);
+  vtkDICOMDictFilePut32(buffer + 16, count);
+  vtkDICOMDictFilePut32(buffer + 20, fileSize);
+  memcpy(buffer + poolOffset, pool.data(), pool.size());
+
+  offset = vtkDICOMDictFileHeaderSize + count*vtkDICOMDictFileRecordSize;
+  for (unsigned int i = 0; i < count; i++)
+    {
+    vtkDICOMDictionary::Dict *dict = dicts[i];
+    unsigned int tagCount = vtkDICOMDictFileTableSize(
+      dict->TagHashTable, dict->HashSize);
+    unsigned int keyCount = vtkDICOMDictFileTableSize(
+      dict->KeyHashTable, dict->HashSize);
+    unsigned int tagOffset = offset;
+    memcpy(buffer + tagOffset, dict->TagHashTable, 2*tagCount);
+    unsigned int keyOffset = tagOffset + 2*tagCount;
+    memcpy(buffer + keyOffset, dict->KeyHashTable, 2*keyCount);
+    unsigned int entryOffset = keyOffset + 2*keyCount;
+    for (unsigned short j = 0; j < dict->DataSize; j++)
+      {
+      const vtkDICOMDictEntry::Entry *e = &dict->Contents[j];
+      unsigned char *ep =
+        buffer + entryOffset + j*vtkDICOMDictFileEntrySize;
+      vtkDICOMDictFilePut16(ep, e->Group);
+      vtkDICOMDictFilePut16(ep + 2, e->Element);
+      ep[4] = e->Flags;
+      ep[5] = e->VR;
+      vtkDICOMDictFilePut16(ep + 6, e->VM);
+      vtkDICOMDictFilePut32(ep + 8, poolOffset +
+        vtkDICOMDictFileAddString(&pool, &poolIndex, e->Name));
+      }
+    offset = entryOffset + dict->DataSize*vtkDICOMDictFileEntrySize;
+    offset += (offset & 2);
+
+    unsigned char *rp = buffer + vtkDICOMDictFileHeaderSize +
+      i*vtkDICOMDictFileRecordSize;
+    vtkDICOMDictFilePut32(rp, poolOffset +
+      vtkDICOMDictFileAddString(&pool, &poolIndex, dict->Name));
+    vtkDICOMDictFilePut32(rp + 4, tagOffset);
+    vtkDICOMDictFilePut32(rp + 8, tagCount);
+    vtkDICOMDictFilePut32(rp + 12, keyOffset);
+    vtkDICOMDictFilePut32(rp + 16, keyCount);
+    vtkDICOMDictFilePut32(rp + 20, entryOffset);
+    vtkDICOMDictFilePut16(rp + 24, dict->HashSize);
+    vtkDICOMDictFilePut16(rp + 26, dict->DataSize);
+    }
+
+  vtkDICOMFile outfile(fileName, vtkDICOMFile::Out);
+  bool success = (outfile.GetError() == 0 &&
+                  outfile.Write(buffer, fileSize) == fileSize);
+  outfile.Close();
+  delete [] buffer;
+
+  if (!success)
+    {
+    vtkGenericWarningMacro("Can't write dictionary file: " << fileName);
+    }
+
+  return success;
+}
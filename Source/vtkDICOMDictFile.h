@@ -0,0 +1,113 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMDictFile_h
+#define vtkDICOMDictFile_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMDictionary.h"
+
+class vtkDICOMFile;
+
+//! A compiled dictionary file for runtime-loaded private dictionaries.
+/*!
+ *  A dictionary file stores private dictionaries in exactly the hash
+ *  table layout that makedict.py generates into vtkDICOMDictPrivate,
+ *  so that site-specific dictionaries can be registered at runtime
+ *  without regenerating that file and rebuilding the library, and
+ *  without parsing a text dictionary at startup in every process.
+ *
+ *  When a dictionary file is loaded, it is mapped into memory and the
+ *  hash tables and strings are used directly from the mapping, which
+ *  the operating system shares read-only between all processes that
+ *  load the same file.  The only memory that is allocated is the
+ *  small array of entry records for each dictionary, because those
+ *  records hold pointers to the mapped strings and pointers cannot be
+ *  stored in a file.
+ *
+ *  The integers in the file are stored in the byte order of the
+ *  machine that wrote it, so that they can be used from the mapping
+ *  without any conversion.  A header marker allows a machine with the
+ *  opposite byte order to recognize and reject the file.
+ */
+class VTKDICOM_EXPORT vtkDICOMDictFile : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMDictFile *New();
+  vtkTypeMacro(vtkDICOMDictFile, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //@{
+  //! Set the name of the dictionary file to load.
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  //@}
+
+  //@{
+  //! Map the file and register the dictionaries it contains.
+  /*!
+   *  The dictionaries remain registered, and the mapping remains in
+   *  place, until Unload() is called or this object is destroyed.
+   *  False is returned if the file cannot be read, is not a valid
+   *  dictionary file, or was written on a machine with a different
+   *  byte order.
+   */
+  bool Load();
+
+  //! Remove the registered dictionaries and release the mapping.
+  void Unload();
+
+  //! Get the number of dictionaries that are currently loaded.
+  int GetNumberOfDictionaries() { return this->NumberOfDictionaries; }
+  //@}
+
+  //! Compile dictionaries into a file.
+  /*!
+   *  The argument is a NULL-terminated array of dictionaries, whose
+   *  hash tables are written verbatim.  The tables can come from
+   *  code generated by makedict.py, or they can be built by whatever
+   *  tool a site uses to maintain its own dictionary.
+   */
+  static bool Write(const char *fileName, vtkDICOMDictionary::Dict **dicts);
+
+protected:
+  vtkDICOMDictFile();
+  ~vtkDICOMDictFile();
+
+  //! The name of the dictionary file.
+  char *FileName;
+
+  //! The open file whose mapping is in use.
+  vtkDICOMFile *InputFile;
+
+  //! The mapped contents of the file.
+  const unsigned char *Mapping;
+
+  //! The dictionaries built from the mapping, while loaded.
+  vtkDICOMDictionary::Dict **Dicts;
+
+  //! The number of dictionaries that are loaded.
+  int NumberOfDictionaries;
+
+private:
+  vtkDICOMDictFile(const vtkDICOMDictFile&);  // Not implemented.
+  void operator=(const vtkDICOMDictFile&);  // Not implemented.
+};
+
+#endif /* vtkDICOMDictFile_h */
@@ -27631,10 +27631,11 @@ vtkDICOMDictPrivateInitializer::vtkDICOMDictPrivateInitializer()
 {
   if (vtkDICOMDictPrivateInitializerCounter++ == 0)
     {
-    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)
-      {
-      vtkDICOMDictionary::AddPrivateDictionary(*dp);
-      }
+    // hand the static table over for lazy registration: the name
+    // hashing and heap allocation for all of these dictionaries is
+    // deferred until the first private tag lookup, so that short
+    // program runs that never use them do not pay at load time
+    vtkDICOMDictionary::SetBuiltInPrivateDicts(PrivateDictData);
     }
 }
 
@@ -27642,9 +27643,18 @@ vtkDICOMDictPrivateInitializer::~vtkDICOMDictPrivateInitializer()
 {
   if (--vtkDICOMDictPrivateInitializerCounter == 0)
     {
-    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)
+    if (vtkDICOMDictionary::BuiltInPrivateDicts != 0)
+      {
+      // the dictionaries were never registered
+      vtkDICOMDictionary::SetBuiltInPrivateDicts(0);
+      }
+    else
       {
-      vtkDICOMDictionary::RemovePrivateDictionary((*dp)->Name);
+      for (vtkDICOMDictionary::Dict **dp = PrivateDictData;
+           *dp != NULL; dp++)
+        {
+        vtkDICOMDictionary::RemovePrivateDictionary((*dp)->Name);
+        }
       }
     }
 }
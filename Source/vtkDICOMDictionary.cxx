@@ -32,6 +32,80 @@ struct vtkDICOMDictionary::DictHashEntry
 vtkDICOMDictionary::DictHashEntry *
   vtkDICOMDictionary::PrivateDictTable[DICT_PRIVATE_TABLE_SIZE];
 
+vtkDICOMDictionary::Dict **vtkDICOMDictionary::BuiltInPrivateDicts;
+
+//----------------------------------------------------------------------------
+// The "hot" table provides single-probe lookup for the tags that are
+// queried most frequently: the attributes that the reader, the directory
+// scanner, and the sorter request from every file, plus the data set
+// elements whose VRs are most often resolved during implicit VR parsing.
+// It is populated from the main dictionary when the library loads, and
+// all other tags fall through to the generic hash table.
+#define DICT_HOT_TABLE_SIZE 256
+
+static unsigned int vtkDICOMDictionaryHotKeys[DICT_HOT_TABLE_SIZE];
+static const vtkDICOMDictEntry::Entry *
+  vtkDICOMDictionaryHotEntries[DICT_HOT_TABLE_SIZE];
+
+static const DC::EnumType vtkDICOMDictionaryHotTags[] = {
+  DC::MediaStorageSOPClassUID,
+  DC::MediaStorageSOPInstanceUID,
+  DC::TransferSyntaxUID,
+  DC::SpecificCharacterSet,
+  DC::ImageType,
+  DC::SOPClassUID,
+  DC::SOPInstanceUID,
+  DC::StudyDate,
+  DC::SeriesDate,
+  DC::AcquisitionDate,
+  DC::StudyTime,
+  DC::SeriesTime,
+  DC::AccessionNumber,
+  DC::Modality,
+  DC::Manufacturer,
+  DC::InstitutionName,
+  DC::ReferringPhysicianName,
+  DC::StudyDescription,
+  DC::SeriesDescription,
+  DC::PatientName,
+  DC::PatientID,
+  DC::PatientBirthDate,
+  DC::PatientSex,
+  DC::SliceThickness,
+  DC::EchoTime,
+  DC::EchoNumbers,
+  DC::SpacingBetweenSlices,
+  DC::StudyInstanceUID,
+  DC::SeriesInstanceUID,
+  DC::StudyID,
+  DC::SeriesNumber,
+  DC::AcquisitionNumber,
+  DC::InstanceNumber,
+  DC::ImagePositionPatient,
+  DC::ImageOrientationPatient,
+  DC::FrameOfReferenceUID,
+  DC::TemporalPositionIdentifier,
+  DC::SliceLocation,
+  DC::SamplesPerPixel,
+  DC::PhotometricInterpretation,
+  DC::NumberOfFrames,
+  DC::Rows,
+  DC::Columns,
+  DC::PixelSpacing,
+  DC::BitsAllocated,
+  DC::BitsStored,
+  DC::HighBit,
+  DC::PixelRepresentation,
+  DC::WindowCenter,
+  DC::WindowWidth,
+  DC::RescaleIntercept,
+  DC::RescaleSlope,
+  DC::RescaleType,
+  DC::SharedFunctionalGroupsSequence,
+  DC::PerFrameFunctionalGroupsSequence,
+  DC::PixelData,
+};
+
 //----------------------------------------------------------------------------
 // A helper class to delete static variables when program exits.
 static unsigned int vtkDICOMDictionaryInitializerCounter;
@@ -45,6 +119,7 @@ vtkDICOMDictionaryInitializer::vtkDICOMDictionaryInitializer()
       {
       vtkDICOMDictionary::PrivateDictTable[i] = 0;
       }
+    vtkDICOMDictionary::InitializeHotTags();
     }
 }
 
@@ -88,10 +163,35 @@ unsigned int vtkDICOMDictionary::HashLongString(
   return h;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::SetBuiltInPrivateDicts(Dict **dicts)
+{
+  vtkDICOMDictionary::BuiltInPrivateDicts = dicts;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::BuildPrivateDictTable()
+{
+  // the pointer is cleared first, because AddPrivateDictionary would
+  // otherwise re-enter this method
+  Dict **dicts = vtkDICOMDictionary::BuiltInPrivateDicts;
+  vtkDICOMDictionary::BuiltInPrivateDicts = 0;
+
+  for (Dict **dp = dicts; *dp != 0; dp++)
+    {
+    vtkDICOMDictionary::AddPrivateDictionary(*dp);
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
   const char *name)
 {
+  if (vtkDICOMDictionary::BuiltInPrivateDicts)
+    {
+    vtkDICOMDictionary::BuildPrivateDictTable();
+    }
+
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
   DictHashEntry *hptr;
@@ -116,6 +216,59 @@ vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
   return 0;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::InitializeHotTags()
+{
+  for (int i = 0; i < DICT_HOT_TABLE_SIZE; i++)
+    {
+    vtkDICOMDictionaryHotKeys[i] = 0;
+    vtkDICOMDictionaryHotEntries[i] = 0;
+    }
+
+  vtkDICOMDictionary::Dict *dict = &vtkDICOMDictionary::DictData;
+  const vtkDICOMDictEntry::Entry *dptr = dict->Contents;
+  size_t n = sizeof(vtkDICOMDictionaryHotTags)/
+             sizeof(vtkDICOMDictionaryHotTags[0]);
+
+  for (size_t k = 0; k < n; k++)
+    {
+    vtkDICOMTag tag(vtkDICOMDictionaryHotTags[k]);
+    unsigned short group = tag.GetGroup();
+    unsigned short element = tag.GetElement();
+    unsigned int h = tag.ComputeHash();
+
+    // find the entry via the generic hash table
+    const vtkDICOMDictEntry::Entry *entry = 0;
+    const unsigned short *hptr =
+      &dict->TagHashTable[dict->TagHashTable[h & (DICT_HASH_TABLE_SIZE - 1)]];
+    for (unsigned short m = *hptr; m != 0; --m)
+      {
+      ++hptr;
+      const vtkDICOMDictEntry::Entry *e = &dptr[*hptr];
+      ++hptr;
+      if (*hptr == element && e->Group == group)
+        {
+        entry = e;
+        break;
+        }
+      }
+
+    if (entry != 0)
+      {
+      // insert with open addressing, collisions probe linearly so the
+      // lookup in FindDictEntry only ends at a match or an empty slot
+      unsigned int i = (h & (DICT_HOT_TABLE_SIZE - 1));
+      while (vtkDICOMDictionaryHotEntries[i] != 0)
+        {
+        i = ((i + 1) & (DICT_HOT_TABLE_SIZE - 1));
+        }
+      vtkDICOMDictionaryHotKeys[i] =
+        ((static_cast<unsigned int>(group) << 16) | element);
+      vtkDICOMDictionaryHotEntries[i] = entry;
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
   const vtkDICOMTag tag, const char *dictname)
@@ -127,6 +280,22 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
   unsigned int h = tag.ComputeHash();
   unsigned int i = (h & (DICT_HASH_TABLE_SIZE - 1));
 
+  // check the hot table first, it resolves the most frequently queried
+  // standard tags with a single probe
+  if ((group & 1) == 0)
+    {
+    unsigned int key = ((static_cast<unsigned int>(group) << 16) | element);
+    unsigned int j = (h & (DICT_HOT_TABLE_SIZE - 1));
+    while (vtkDICOMDictionaryHotEntries[j] != 0)
+      {
+      if (vtkDICOMDictionaryHotKeys[j] == key)
+        {
+        return vtkDICOMDictEntry(vtkDICOMDictionaryHotEntries[j]);
+        }
+      j = ((j + 1) & (DICT_HOT_TABLE_SIZE - 1));
+      }
+    }
+
   // default to the standard dictionary
   vtkDICOMDictionary::Dict *dict = &vtkDICOMDictionary::DictData;
 
@@ -139,7 +308,7 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
       // private dictionary not found
       return vtkDICOMDictEntry();
       }
-    i = (h % dict->HashSize);
+    return vtkDICOMDictionary::FindDictEntryInDict(tag, dict);
     }
 
   // search the hash table
@@ -160,6 +329,35 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
   return vtkDICOMDictEntry();
 }
 
+//----------------------------------------------------------------------------
+vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntryInDict(
+  const vtkDICOMTag tag, Dict *dict)
+{
+  unsigned short group = tag.GetGroup();
+  unsigned short element = tag.GetElement();
+
+  // compute the hash table index
+  unsigned int h = tag.ComputeHash();
+  unsigned int i = (h % dict->HashSize);
+
+  // search the hash table
+  const unsigned short *hptr = &dict->TagHashTable[dict->TagHashTable[i]];
+  const vtkDICOMDictEntry::Entry *dptr = dict->Contents;
+  for (unsigned short n = *hptr; n != 0; --n)
+    {
+    ++hptr;
+    const vtkDICOMDictEntry::Entry *entry = &dptr[*hptr];
+    ++hptr;
+    if (*hptr == element && entry->Group == group)
+      {
+      return vtkDICOMDictEntry(entry);
+      }
+    }
+
+  // not found in dictionary
+  return vtkDICOMDictEntry();
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
   const char *key, const char *dictname)
@@ -225,6 +423,11 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
 //----------------------------------------------------------------------------
 void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
 {
+  if (vtkDICOMDictionary::BuiltInPrivateDicts)
+    {
+    vtkDICOMDictionary::BuildPrivateDictTable();
+    }
+
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
 
@@ -276,6 +479,11 @@ void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
 //----------------------------------------------------------------------------
 void vtkDICOMDictionary::RemovePrivateDictionary(const char *name)
 {
+  if (vtkDICOMDictionary::BuiltInPrivateDicts)
+    {
+    vtkDICOMDictionary::BuildPrivateDictTable();
+    }
+
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
   DictHashEntry *hptr;
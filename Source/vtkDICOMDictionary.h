@@ -22,6 +22,8 @@
 #define DICT_HASH_TABLE_SIZE 4096
 #define DICT_PRIVATE_TABLE_SIZE 512
 
+class vtkDICOMDictPrivateInitializer;
+
 //! Provide access to the DICOM tag dictionary.
 class VTKDICOM_EXPORT vtkDICOMDictionary
 {
@@ -72,6 +74,28 @@ public:
     const char *key, const char *privateDict);
   //@}
 
+  //@{
+  //! Locate a private dictionary, given the creator name.
+  /*!
+   *  The returned pointer remains valid until the dictionary is
+   *  removed, and can be passed to FindDictEntryInDict() so that
+   *  the creator name does not have to be hashed again for every
+   *  private tag that is looked up.  Returns null if no dictionary
+   *  is registered for the creator.
+   */
+  static Dict *FindPrivateDict(const char *name);
+
+  //! Find the entry for the given tag in a resolved dictionary.
+  /*!
+   *  The dict must be a non-null pointer that was returned by
+   *  FindPrivateDict().  This allows callers that cache the resolved
+   *  dictionary to look up private tags at the same cost as standard
+   *  tags.
+   */
+  static vtkDICOMDictEntry FindDictEntryInDict(
+    const vtkDICOMTag tag, Dict *dict);
+  //@}
+
   //@{
   //! Add the hash table for a private dictionary.
   /*!
@@ -87,6 +111,25 @@ public:
 
 private:
   friend class vtkDICOMDictionaryInitializer;
+  friend class vtkDICOMDictPrivateInitializer;
+
+  //! Hand over the built-in private dictionaries for lazy loading.
+  /*!
+   *  The argument is a NULL-terminated array of static dictionary
+   *  structs.  Only the pointer is stored: the name hashing and the
+   *  heap allocation needed to register the dictionaries is deferred
+   *  until the first private dictionary lookup, so that programs
+   *  that never touch a private tag never pay for the registration.
+   */
+  static void SetBuiltInPrivateDicts(Dict **dicts);
+
+  //! Register the built-in private dictionaries.
+  /*!
+   *  This is called on the first private dictionary lookup (or the
+   *  first registration or removal of a user dictionary), after which
+   *  the stored pointer is cleared so registration happens only once.
+   */
+  static void BuildPrivateDictTable();
 
   //! Compute a string hash for a DICOM text value.
   /*!
@@ -95,18 +138,23 @@ private:
    */
   static unsigned int HashLongString(const char *lo, char stripped[64]);
 
-  //! Locate a private dictionary, given the name.
+  //! Populate the fast lookup table for frequently queried tags.
   /*!
-   *  This returns the hash table, and also returns the size of the
-   *  hash table in the second argument.
+   *  This is called when the library is initialized.  It fills a small
+   *  collision-free table that allows the tags that are queried most
+   *  frequently, when files are parsed and sorted, to be resolved with
+   *  a single probe instead of a walk through a hash table bucket.
    */
-  static Dict *FindPrivateDict(const char *name);
+  static void InitializeHotTags();
 
   //! The lookup table for the dictionary.
   static Dict DictData;
 
   //! The lookup table for private dictionaries.
   static DictHashEntry *PrivateDictTable[DICT_PRIVATE_TABLE_SIZE];
+
+  //! The built-in private dictionaries, until they are registered.
+  static Dict **BuiltInPrivateDicts;
 };
 
 //! Initializer (Schwarz counter).
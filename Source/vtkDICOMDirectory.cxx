@@ -17,9 +17,11 @@
 #include "vtkDICOMFileDirectory.h"
 #include "vtkDICOMFilePath.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMMemoryGovernor.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMParser.h"
+#include "vtkDICOMProfiler.h"
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMVR.h"
 
@@ -27,9 +29,12 @@
 #include <vtkSmartPointer.h>
 #include <vtkStringArray.h>
 #include <vtkIntArray.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkErrorCode.h>
 #include <vtkCommand.h>
 #include <vtkUnsignedShortArray.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
 
 #include <vtkSQLiteDatabase.h>
 #include <vtkSQLQuery.h>
@@ -42,6 +47,7 @@
 #include <utility>
 
 #include <ctype.h>
+#include <time.h>
 #include <stdlib.h>
 
 vtkStandardNewMacro(vtkDICOMDirectory);
@@ -54,6 +60,12 @@ struct vtkDICOMDirectory::SeriesItem
   vtkDICOMItem Record;
   vtkSmartPointer<vtkStringArray> Files;
   vtkSmartPointer<vtkDICOMMetaData> Meta;
+  vtkSmartPointer<vtkTypeInt64Array> FileOffsets;
+  // used by MetaDataSpilling: the estimated size of Meta, the last
+  // access stamp, and whether Meta was released under memory pressure
+  vtkTypeInt64 MetaBytes;
+  unsigned int MetaStamp;
+  bool MetaSpilled;
 };
 
 struct vtkDICOMDirectory::StudyItem
@@ -86,6 +98,54 @@ class vtkDICOMDirectory::VisitedVector
   : public std::vector<std::string>
 {};
 
+//----------------------------------------------------------------------------
+// One directory in the persistent index: the modification time and the
+// depth at which the directory was visited, plus the candidate files
+// (as the scanned path and the real path) and the subdirectories that
+// the visit produced.  A rescan can use the recorded listing when the
+// modification time of the directory has not changed.
+
+struct vtkDICOMDirectoryDirEntry
+{
+  long long MTime;
+  int Depth;
+  std::vector<std::pair<std::string, std::string> > Files;
+  std::vector<std::string> Subdirs;
+};
+
+// the directory records, keyed by the real path of the directory
+class vtkDICOMDirectoryDirIndex
+  : public std::map<std::string, vtkDICOMDirectoryDirEntry>
+{};
+
+// for each file from an unchanged directory, its real path
+class vtkDICOMDirectoryTrustedMap
+  : public std::map<std::string, std::string>
+{};
+
+//----------------------------------------------------------------------------
+// An element of the find query, prepared for fast repeated matching.
+// The value is pre-converted to utf-8 (with person names case-folded),
+// and the cost ranks the element for evaluation order: exact matches
+// first, then ranges, then wildcard patterns, then universal matches.
+
+struct vtkDICOMDirectory::QueryElement
+{
+  vtkDICOMTag Tag;
+  vtkDICOMValue Value;
+  int Cost;
+};
+
+class vtkDICOMDirectory::QueryElementVector
+  : public std::vector<vtkDICOMDirectory::QueryElement>
+{};
+
+bool vtkDICOMDirectory::CompareQueryElement(
+  const QueryElement &e1, const QueryElement &e2)
+{
+  return (e1.Cost < e2.Cost);
+}
+
 //----------------------------------------------------------------------------
 // Information used to sort DICOM files.
 
@@ -94,6 +154,10 @@ struct vtkDICOMDirectory::FileInfo
   unsigned int InstanceNumber;
   const char *FileName;
   vtkDICOMItem ImageRecord;
+  // the complete metadata, only kept when KeepFileMetaData is on
+  vtkSmartPointer<vtkDICOMMetaData> Meta;
+  vtkTypeInt64 PixelDataOffset;
+  vtkTypeInt64 FileSize;
 };
 
 struct vtkDICOMDirectory::SeriesInfo
@@ -134,6 +198,7 @@ vtkDICOMDirectory::vtkDICOMDirectory()
   this->DirectoryName = 0;
   this->InputFileNames = 0;
   this->FilePattern = 0;
+  this->IndexFileName = 0;
   this->Series = new SeriesVector;
   this->Studies = new StudyVector;
   this->Patients = new PatientVector;
@@ -143,15 +208,38 @@ vtkDICOMDirectory::vtkDICOMDirectory()
   this->RequirePixelData = 1;
   this->FollowSymlinks = 1;
   this->ShowHidden = 1;
+  this->TrustDICOMDIR = 0;
   this->ScanDepth = 1;
+  this->ParallelScan = 0;
+  this->NumberOfScanThreads = 0;
+  this->Streaming = 0;
+  this->KeepFileMetaData = 0;
+  this->MetaDataSpilling = 0;
+  this->MemoryClient = 0;
+  this->MetaClock = 0;
+  this->MetaSpillLock = new vtkSimpleCriticalSection;
   this->Query = 0;
+  this->CompiledQuery = new QueryElementVector;
   this->FindLevel = vtkDICOMDirectory::IMAGE;
   this->UsingOsirixDatabase = false;
+  this->IncrementalRescan = 0;
+  this->CheckpointInterval = 0;
+  this->DirIndex = new vtkDICOMDirectoryDirIndex;
+  this->NewDirIndex = new vtkDICOMDirectoryDirIndex;
+  this->TrustedFiles = new vtkDICOMDirectoryTrustedMap;
+  this->IndexDirectories = false;
 }
 
 //----------------------------------------------------------------------------
 vtkDICOMDirectory::~vtkDICOMDirectory()
 {
+  if (this->MemoryClient)
+    {
+    // after this, no release callback can arrive
+    vtkDICOMMemoryGovernor::RemoveClient(this->MemoryClient);
+    }
+  delete this->MetaSpillLock;
+
   if (this->InputFileNames)
     {
     this->InputFileNames->Delete();
@@ -159,6 +247,7 @@ vtkDICOMDirectory::~vtkDICOMDirectory()
 
   delete [] this->DirectoryName;
   delete [] this->FilePattern;
+  delete [] this->IndexFileName;
   delete [] this->InternalFileName;
 
   delete this->Series;
@@ -167,6 +256,10 @@ vtkDICOMDirectory::~vtkDICOMDirectory()
   delete this->Visited;
   delete [] this->FileSetID;
   delete this->Query;
+  delete this->CompiledQuery;
+  delete this->DirIndex;
+  delete this->NewDirIndex;
+  delete this->TrustedFiles;
 }
 
 //----------------------------------------------------------------------------
@@ -183,6 +276,15 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ScanDepth: " << this->ScanDepth << "\n";
 
+  os << indent << "IndexFileName: "
+     << (this->IndexFileName ? this->IndexFileName : "(NULL)") << "\n";
+
+  os << indent << "IncrementalRescan: "
+     << (this->IncrementalRescan ? "On\n" : "Off\n");
+
+  os << indent << "CheckpointInterval: "
+     << this->CheckpointInterval << "\n";
+
   os << indent << "FindLevel: "
      << (this->FindLevel == vtkDICOMDirectory::IMAGE ?
          "IMAGE\n" : "SERIES\n");
@@ -193,6 +295,23 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FollowSymlinks: "
      << (this->FollowSymlinks ? "On\n" : "Off\n");
 
+  os << indent << "TrustDICOMDIR: "
+     << (this->TrustDICOMDIR ? "On\n" : "Off\n");
+
+  os << indent << "ParallelScan: "
+     << (this->ParallelScan ? "On\n" : "Off\n");
+
+  os << indent << "NumberOfScanThreads: "
+     << this->NumberOfScanThreads << "\n";
+
+  os << indent << "Streaming: "
+     << (this->Streaming ? "On\n" : "Off\n");
+
+  os << indent << "KeepFileMetaData: "
+     << (this->KeepFileMetaData ? "On\n" : "Off\n");
+  os << indent << "MetaDataSpilling: "
+     << (this->MetaDataSpilling ? "On\n" : "Off\n");
+
   os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
   os << indent << "NumberOfStudies: " << this->GetNumberOfStudies() << "\n";
   os << indent << "NumberOfPatients: " << this->GetNumberOfPatients() << "\n";
@@ -243,6 +362,27 @@ void vtkDICOMDirectory::SetFilePattern(const char *name)
   this->Modified();
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::SetIndexFileName(const char *name)
+{
+  if (name == this->IndexFileName ||
+      (name && this->IndexFileName &&
+       strcmp(name, this->IndexFileName) == 0))
+    {
+    return;
+    }
+
+  delete [] this->IndexFileName;
+  this->IndexFileName = 0;
+  if (name)
+    {
+    char *cp = new char[strlen(name) + 1];
+    strcpy(cp, name);
+    this->IndexFileName = cp;
+    }
+  this->Modified();
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::SetInputFileNames(vtkStringArray *sa)
 {
@@ -381,10 +521,155 @@ vtkStringArray *vtkDICOMDirectory::GetFileNamesForSeries(int i)
   return (*this->Series)[i].Files;
 }
 
+//----------------------------------------------------------------------------
+// Estimate the heap memory that a metadata object occupies, as the
+// value bytes plus a fixed overhead for each data element.
+static vtkTypeInt64 vtkDICOMDirectoryMetaDataSize(vtkDICOMMetaData *meta)
+{
+  vtkTypeInt64 total = 0;
+  vtkDICOMDataElementIterator iter = meta->Begin();
+  vtkDICOMDataElementIterator iterEnd = meta->End();
+  for (; iter != iterEnd; ++iter)
+    {
+    unsigned int vl = iter->GetValue().GetVL();
+    total += 64 + (vl == 0xffffffffu ? 0 : vl);
+    }
+  return total;
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMMetaData *vtkDICOMDirectory::GetMetaDataForSeries(int i)
 {
-  return (*this->Series)[i].Meta;
+  if (this->MemoryClient == 0)
+    {
+    return (*this->Series)[i].Meta;
+    }
+
+  this->MetaSpillLock->Lock();
+  SeriesItem& item = (*this->Series)[i];
+  item.MetaStamp = ++this->MetaClock;
+  bool spilled = item.MetaSpilled;
+  vtkDICOMMetaData *metaPtr = item.Meta;
+  vtkSmartPointer<vtkStringArray> fileNames = item.Files;
+  this->MetaSpillLock->Unlock();
+
+  if (spilled)
+    {
+    // the metadata was released under memory pressure, so read it
+    // back from the files of the series
+    vtkIdType n = fileNames->GetNumberOfValues();
+    vtkSmartPointer<vtkDICOMMetaData> meta =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    meta->SetNumberOfInstances(static_cast<int>(n));
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser->AddObserver(
+      vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
+    parser->SetMetaData(meta);
+    for (vtkIdType j = 0; j < n; j++)
+      {
+      parser->SetIndex(static_cast<int>(j));
+      parser->SetFileName(fileNames->GetValue(j).c_str());
+      parser->Update();
+      }
+
+    vtkTypeInt64 metaBytes = vtkDICOMDirectoryMetaDataSize(meta);
+    this->MetaSpillLock->Lock();
+    item.Meta = meta;
+    item.MetaBytes = metaBytes;
+    item.MetaSpilled = false;
+    item.MetaStamp = ++this->MetaClock;
+    this->MetaSpillLock->Unlock();
+    vtkDICOMMemoryGovernor::RecordAllocation(this->MemoryClient, metaBytes);
+    metaPtr = meta;
+    }
+
+  return metaPtr;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64Array *vtkDICOMDirectory::GetFileOffsetsForSeries(int i)
+{
+  return (*this->Series)[i].FileOffsets;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::AccountMetaData()
+{
+  if (this->MemoryClient)
+    {
+    vtkDICOMMemoryGovernor::RemoveClient(this->MemoryClient);
+    this->MemoryClient = 0;
+    }
+
+  // spilling only applies to the complete headers that are retained
+  // when KeepFileMetaData is on (and it must be possible to re-read
+  // them, so a find query rules it out)
+  if (this->MetaDataSpilling == 0 || this->KeepFileMetaData == 0 ||
+      this->Query != 0)
+    {
+    return;
+    }
+
+  vtkTypeInt64 total = 0;
+  size_t n = this->Series->size();
+  for (size_t i = 0; i < n; i++)
+    {
+    SeriesItem& item = (*this->Series)[i];
+    item.MetaBytes = 0;
+    item.MetaStamp = 0;
+    item.MetaSpilled = false;
+    if (item.Meta)
+      {
+      item.MetaBytes = vtkDICOMDirectoryMetaDataSize(item.Meta);
+      total += item.MetaBytes;
+      }
+    }
+
+  this->MemoryClient = vtkDICOMMemoryGovernor::AddClient(
+    &vtkDICOMDirectory::ReleaseMetaData, this);
+  if (total > 0)
+    {
+    vtkDICOMMemoryGovernor::RecordAllocation(this->MemoryClient, total);
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ReleaseMetaData(void *data, vtkTypeInt64 bytes)
+{
+  vtkDICOMDirectory *self = static_cast<vtkDICOMDirectory *>(data);
+
+  vtkTypeInt64 freed = 0;
+  self->MetaSpillLock->Lock();
+  size_t n = self->Series->size();
+  while (freed < bytes)
+    {
+    // spill the series that was least recently accessed
+    SeriesItem *spill = 0;
+    for (size_t i = 0; i < n; i++)
+      {
+      SeriesItem& item = (*self->Series)[i];
+      if (item.Meta != 0 && item.MetaBytes > 0 &&
+          (spill == 0 || item.MetaStamp < spill->MetaStamp))
+        {
+        spill = &item;
+        }
+      }
+    if (spill == 0)
+      {
+      break;
+      }
+    spill->Meta = 0;
+    spill->MetaSpilled = true;
+    freed += spill->MetaBytes;
+    spill->MetaBytes = 0;
+    }
+  self->MetaSpillLock->Unlock();
+
+  if (freed > 0)
+    {
+    vtkDICOMMemoryGovernor::RecordFree(self->MemoryClient, freed);
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -487,6 +772,100 @@ bool MatchesOsirixDatabase(
 
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::CompileQuery()
+{
+  this->CompiledQuery->clear();
+
+  if (this->Query == 0)
+    {
+    return;
+    }
+
+  vtkDICOMDataElementIterator iter;
+  for (iter = this->Query->Begin(); iter != this->Query->End(); ++iter)
+    {
+    vtkDICOMTag tag = iter->GetTag();
+    if (tag == DC::SpecificCharacterSet || tag.GetGroup() == 0x0004)
+      {
+      continue;
+      }
+
+    QueryElement element;
+    element.Tag = tag;
+    element.Value = iter->GetValue();
+    vtkDICOMVR vr = element.Value.GetVR();
+
+    if (vr == vtkDICOMVR::SQ)
+      {
+      // sequences cannot be checked against the directory records
+      element.Cost = 5;
+      }
+    else if (element.Value.GetVL() == 0)
+      {
+      // empty values match universally, so check them last
+      element.Cost = 4;
+      }
+    else if (vr == vtkDICOMVR::PN)
+      {
+      // fold the case of the pattern once, rather than once per file
+      // (folding is idempotent, so the match result is unchanged)
+      const char *cp = element.Value.GetCharData();
+      element.Value = vtkDICOMValue(
+        vr, vtkDICOMCharacterSet::ISO_IR_192,
+        element.Value.GetCharacterSet().CaseFoldedUTF8(
+          cp, element.Value.GetVL()));
+      element.Cost = 3;
+      }
+    else if (vr.HasTextValue())
+      {
+      // convert the pattern to utf-8 once, rather than once per file
+      vtkDICOMCharacterSet cs = element.Value.GetCharacterSet();
+      if (cs != vtkDICOMCharacterSet::ISO_IR_6 &&
+          cs != vtkDICOMCharacterSet::ISO_IR_192)
+        {
+        element.Value = vtkDICOMValue(
+          vr, vtkDICOMCharacterSet::ISO_IR_192,
+          element.Value.AsUTF8String());
+        }
+      // exact matches are the most selective, so check them first,
+      // followed by date and time ranges, then wildcard patterns
+      bool wildcard = false;
+      const char *cp = element.Value.GetCharData();
+      size_t l = element.Value.GetVL();
+      for (size_t i = 0; i < l && cp[i] != '\0'; i++)
+        {
+        wildcard |= (cp[i] == '*');
+        wildcard |= (cp[i] == '?');
+        }
+      if (wildcard)
+        {
+        element.Cost = 3;
+        }
+      else if (vr == vtkDICOMVR::DA ||
+               vr == vtkDICOMVR::TM ||
+               vr == vtkDICOMVR::DT)
+        {
+        element.Cost = 2;
+        }
+      else
+        {
+        element.Cost = 1;
+        }
+      }
+    else
+      {
+      // numerical comparisons are cheap
+      element.Cost = 1;
+      }
+
+    this->CompiledQuery->push_back(element);
+    }
+
+  std::stable_sort(this->CompiledQuery->begin(), this->CompiledQuery->end(),
+                   vtkDICOMDirectory::CompareQueryElement);
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMDirectory::MatchesQuery(
   const vtkDICOMItem& record, vtkDICOMItem& results)
@@ -495,32 +874,28 @@ bool vtkDICOMDirectory::MatchesQuery(
 
   if (this->Query)
     {
-    vtkDICOMDataElementIterator iter;
-    for (iter = record.Begin(); iter != record.End(); ++iter)
+    QueryElementVector::iterator iter;
+    for (iter = this->CompiledQuery->begin();
+         iter != this->CompiledQuery->end(); ++iter)
       {
-      vtkDICOMTag tag = iter->GetTag();
-      if (tag != DC::SpecificCharacterSet && tag.GetGroup() != 0x0004)
+      const vtkDICOMValue& u = record.GetAttributeValue(iter->Tag);
+      if (u.IsValid())
         {
-        const vtkDICOMValue& v = this->Query->GetAttributeValue(tag);
-        if (v.IsValid())
+        if (this->UsingOsirixDatabase)
           {
-          const vtkDICOMValue& u = iter->GetValue();
-          if (this->UsingOsirixDatabase)
-            {
-            matched = MatchesOsirixDatabase(tag, u, v);
-            }
-          else
-            {
-            matched = u.Matches(v);
-            }
-          if (matched)
-            {
-            results.SetAttributeValue(tag, u);
-            }
-          else
-            {
-            break;
-            }
+          matched = MatchesOsirixDatabase(iter->Tag, u, iter->Value);
+          }
+        else
+          {
+          matched = u.Matches(iter->Value);
+          }
+        if (matched)
+          {
+          results.SetAttributeValue(iter->Tag, u);
+          }
+        else
+          {
+          break;
           }
         }
       }
@@ -538,11 +913,13 @@ int vtkDICOMDirectory::MatchesImageQuery(
 
   if (this->Query)
     {
-    vtkDICOMDataElementIterator iter;
-    for (iter = this->Query->Begin(); iter != this->Query->End(); ++iter)
+    // the compiled order tests the most selective elements first, so
+    // that a mismatch is usually found before an absent attribute
+    QueryElementVector::iterator iter;
+    for (iter = this->CompiledQuery->begin();
+         iter != this->CompiledQuery->end(); ++iter)
       {
-      vtkDICOMTag tag = iter->GetTag();
-      const vtkDICOMValue& v = iter->GetValue();
+      const vtkDICOMValue& v = iter->Value;
       if (v.GetVR() == vtkDICOMVR::SQ)
         {
         if (v.GetNumberOfValues() > 0)
@@ -551,22 +928,19 @@ int vtkDICOMDirectory::MatchesImageQuery(
           break;
           }
         }
-      else if (tag != DC::SpecificCharacterSet && tag.GetGroup() != 0x0004)
+      else if (v.GetVL() > 0)
         {
-        if (v.GetVL() > 0)
+        if (!results.GetAttributeValue(iter->Tag).IsValid())
           {
-          if (!results.GetAttributeValue(tag).IsValid())
+          const vtkDICOMValue& u = record.GetAttributeValue(iter->Tag);
+          if (!u.IsValid())
             {
-            const vtkDICOMValue& u = record.GetAttributeValue(tag);
-            if (!u.IsValid())
-              {
-              fullyMatched = false;
-              }
-            else if (!u.Matches(v))
-              {
-              misMatched = true;
-              break;
-              }
+            fullyMatched = false;
+            }
+          else if (!u.Matches(v))
+            {
+            misMatched = true;
+            break;
             }
           }
         }
@@ -654,6 +1028,8 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
 
     parser->AddObserver(
       vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
+    parser->DeferErrorReportingOn();
+    parser->SetIOPriority(vtkDICOMFile::PriorityBackground);
 
     parser->SetMetaData(meta);
     parser->SetQueryItem(*this->Query);
@@ -678,6 +1054,13 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
         // All remaining queries were matched by image record
         matched = true;
         }
+      else if (r > 0 && this->TrustDICOMDIR && !this->UsingOsirixDatabase)
+        {
+        // Trust the directory records: assume that the attributes that
+        // are absent from the records would have matched the query if
+        // the referenced file itself had been read.
+        matched = true;
+        }
       else if (r > 0)
         {
         // Read the file metadata
@@ -690,6 +1073,11 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
           if (!this->ErrorCode)
             {
             this->ErrorCode = parser->GetErrorCode();
+            if (parser->GetNumberOfConditions() > 0)
+              {
+              // render the deferred parse error for the failed file
+              vtkErrorMacro(<< parser->GetConditionMessage(0).c_str());
+              }
             }
           if (this->ErrorCode || this->RequirePixelData)
             {
@@ -730,7 +1118,9 @@ void vtkDICOMDirectory::AddSeriesFileNames(
   const vtkDICOMItem& patientRecord,
   const vtkDICOMItem& studyRecord,
   const vtkDICOMItem& seriesRecord,
-  const vtkDICOMItem *imageRecords[])
+  const vtkDICOMItem *imageRecords[],
+  vtkDICOMMetaData *fileMetas[],
+  const vtkTypeInt64 *fileOffsets)
 {
   int m = static_cast<int>(this->Patients->size());
   int n = static_cast<int>(this->Studies->size());
@@ -826,6 +1216,14 @@ void vtkDICOMDirectory::AddSeriesFileNames(
     this->CopyRecord(meta, &studyRecord, -1);
     this->CopyRecord(meta, &seriesRecord, -1);
 
+    vtkSmartPointer<vtkTypeInt64Array> offsets;
+    if (fileOffsets)
+      {
+      offsets = vtkSmartPointer<vtkTypeInt64Array>::New();
+      offsets->SetNumberOfComponents(2);
+      offsets->SetNumberOfTuples(seriesLength[kk]);
+      }
+
     vtkSmartPointer<vtkStringArray> newfiles;
     if (numberOfDuplicates > 0)
       {
@@ -843,6 +1241,21 @@ void vtkDICOMDirectory::AddSeriesFileNames(
       if (duplicate[ii] == kk)
         {
         this->CopyRecord(meta, imageRecords[ii], jj);
+        if (fileMetas && fileMetas[ii])
+          {
+          // copy the complete file header that the scan kept
+          vtkDICOMDataElementIterator miter = fileMetas[ii]->Begin();
+          vtkDICOMDataElementIterator mEnd = fileMetas[ii]->End();
+          for (; miter != mEnd; ++miter)
+            {
+            meta->SetAttributeValue(jj, miter->GetTag(), miter->GetValue());
+            }
+          }
+        if (offsets)
+          {
+          offsets->SetValue(2*jj, fileOffsets[2*ii]);
+          offsets->SetValue(2*jj + 1, fileOffsets[2*ii + 1]);
+          }
         if (numberOfDuplicates > 0)
           {
           newfiles->SetValue(jj, files->GetValue(ii));
@@ -851,12 +1264,27 @@ void vtkDICOMDirectory::AddSeriesFileNames(
         }
       }
 
+    // most attributes repeat across the instances of a series, so
+    // collapse the repeats into shared storage
+    meta->CollapseEqualValues();
+
     (*this->Studies)[study].LastSeries = series++;
     this->Series->push_back(SeriesItem());
     SeriesItem& item = this->Series->back();
     item.Record = seriesRecord;
     item.Files = newfiles;
     item.Meta = meta;
+    item.FileOffsets = offsets;
+
+    if (this->Streaming)
+      {
+      // report the series, then discard its data to bound memory use
+      this->InvokeEvent(vtkDICOMDirectory::SeriesAddedEvent);
+      item.Record = vtkDICOMItem();
+      item.Files = 0;
+      item.Meta = 0;
+      item.FileOffsets = 0;
+      }
     }
 }
 
@@ -937,79 +1365,1272 @@ void vtkDICOMDirectory::FillSeriesRecord(
     DC::ItemDelimitationItem
   };
 
-  const DC::EnumType *tag = tags;
-  while (*tag != DC::ItemDelimitationItem)
+  const DC::EnumType *tag = tags;
+  while (*tag != DC::ItemDelimitationItem)
+    {
+    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
+    tag++;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::FillStudyRecord(
+  vtkDICOMItem *item, vtkDICOMMetaData *meta)
+{
+  static const DC::EnumType tags[] = {
+    DC::SpecificCharacterSet,
+    DC::StudyDate,
+    DC::StudyTime,
+    DC::ReferringPhysicianName,
+    DC::PatientAge,
+    DC::StudyInstanceUID,
+    DC::StudyID,
+    DC::AccessionNumber,
+    DC::StudyDescription,
+    DC::ItemDelimitationItem
+  };
+
+  const DC::EnumType *tag = tags;
+  while (*tag != DC::ItemDelimitationItem)
+    {
+    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
+    tag++;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::FillPatientRecord(
+  vtkDICOMItem *item, vtkDICOMMetaData *meta)
+{
+  static const DC::EnumType tags[] = {
+    DC::SpecificCharacterSet,
+    DC::PatientName,
+    DC::PatientID,
+    DC::PatientBirthDate,
+    DC::PatientSex,
+    DC::ItemDelimitationItem
+  };
+
+  const DC::EnumType *tag = tags;
+  while (*tag != DC::ItemDelimitationItem)
+    {
+    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
+    tag++;
+    }
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+unsigned int vtkDICOMDirectoryHashString(const std::string& str)
+{
+  // Compute a string hash based on the function "djb2".
+  unsigned int h = 5381;
+  size_t n = str.size();
+  const char *cp = str.data();
+  for (size_t k = 0; k < n; k++)
+    {
+    unsigned char c = cp[k];
+    if (c == '\0') { break; }
+    h = (h << 5) + h + c;
+    }
+
+  return h;
+}
+
+// one entry of the persistent scan index, files that were found to
+// not be DICOM are recorded with IsDICOM false and a null Meta, so
+// that a rescan does not have to open them again
+struct vtkDICOMDirectoryIndexEntry
+{
+  vtkDICOMFile::Size Size;
+  long long MTime;
+  bool IsDICOM;
+  bool PixelDataFound;
+  vtkSmartPointer<vtkDICOMMetaData> Meta;
+  // the digest of the bytes that the scan read from the file, and
+  // the number of bytes it covers (zero if no digest was computed)
+  unsigned int Digest;
+  vtkTypeInt64 DigestLength;
+  // the tag presence filter for the file, empty if none was built
+  std::vector<unsigned char> TagFilter;
+};
+
+// the persistent scan index, keyed by the real (canonical) file path
+typedef std::map<std::string, vtkDICOMDirectoryIndexEntry>
+  vtkDICOMDirectoryIndex;
+
+// the results of scanning one file, filled in by a scan thread
+struct vtkDICOMDirectoryScanSlot
+{
+  vtkSmartPointer<vtkDICOMMetaData> Meta;
+  int AccessCode;
+  bool IsDICOM;
+  bool FromIndex;
+  bool PixelDataFound;
+  bool QueryMatched;
+  unsigned long ErrorCode;
+  int Condition;
+  vtkTypeInt64 ConditionOffset;
+  vtkDICOMFile::Size Size;
+  long long MTime;
+  bool StatOK;
+  vtkTypeInt64 PixelDataOffset;
+  vtkTypeInt64 FileSize;
+  unsigned int Digest;
+  vtkTypeInt64 DigestLength;
+  std::vector<unsigned char> TagFilter;
+};
+
+// the state that is shared by all of the scan threads
+struct vtkDICOMDirectoryScanInfo
+{
+  vtkDICOMDirectory *Directory;
+  vtkStringArray *Input;
+  const std::vector<vtkIdType> *Candidates;
+  const std::vector<std::string> *RealNames;
+  const std::vector<bool> *Trusted;
+  std::vector<vtkDICOMDirectoryScanSlot> *Slots;
+  const vtkDICOMDirectoryIndex *Index;
+  vtkDICOMMetaData *QueryMeta;
+  bool BuildTagFilters;
+  int BufferSize;
+  vtkIdType BatchStart;
+  vtkIdType BatchEnd;
+  vtkIdType NextIndex; // guarded by Lock
+  vtkSimpleCriticalSection Lock;
+};
+
+// the method executed by each scan thread, each worker owns its own
+// parser and claims files from a shared queue until the batch is done
+VTK_THREAD_RETURN_TYPE vtkDICOMDirectoryThreadScan(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMDirectoryScanInfo *info =
+    static_cast<vtkDICOMDirectoryScanInfo *>(ti->UserData);
+
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->DeferErrorReportingOn();
+  parser->SetIOPriority(vtkDICOMFile::PriorityBackground);
+  if (info->QueryMeta)
+    {
+    parser->SetQuery(info->QueryMeta);
+    }
+  if (info->BufferSize > 0)
+    {
+    parser->SetBufferSize(info->BufferSize);
+    }
+  if (info->BuildTagFilters)
+    {
+    // content digests for the persistent index are folded into the
+    // bytes as they are read, so they come almost for free
+    parser->ComputeDigestOn();
+    }
+
+  for (;;)
+    {
+    if (info->Directory->GetAbortExecute()) { break; }
+
+    info->Lock.Lock();
+    vtkIdType k = info->NextIndex++;
+    info->Lock.Unlock();
+    if (k >= info->BatchEnd)
+      {
+      break;
+      }
+
+    vtkDICOMDirectoryScanSlot& slot =
+      (*info->Slots)[k - info->BatchStart];
+    vtkIdType j = (*info->Candidates)[k];
+    const std::string& fileName = info->Input->GetValue(j);
+
+    // the slots are recycled between batches
+    slot.FromIndex = false;
+    slot.StatOK = false;
+    slot.Condition = vtkDICOMParser::NoCondition;
+    slot.ConditionOffset = 0;
+    slot.PixelDataOffset = -1;
+    slot.FileSize = -1;
+    slot.Digest = 0;
+    slot.DigestLength = 0;
+    slot.TagFilter.clear();
+
+    if (info->Index)
+      {
+      // use the entry from the persistent index, if it is current;
+      // files from directories that are unchanged since the index was
+      // written are known to be current without examining the files
+      vtkDICOMDirectoryIndex::const_iterator ti;
+      if ((*info->Trusted)[j] &&
+          (ti = info->Index->find((*info->RealNames)[j])) !=
+            info->Index->end())
+        {
+        slot.Size = ti->second.Size;
+        slot.MTime = ti->second.MTime;
+        slot.StatOK = true;
+        }
+      else
+        {
+        slot.StatOK = vtkDICOMFile::GetFileInfo(
+          fileName.c_str(), &slot.Size, &slot.MTime);
+        }
+      if (slot.StatOK)
+        {
+        vtkDICOMDirectoryIndex::const_iterator ei =
+          info->Index->find((*info->RealNames)[j]);
+        if (ei != info->Index->end() &&
+            ei->second.Size == slot.Size &&
+            ei->second.MTime == slot.MTime)
+          {
+          slot.IsDICOM = ei->second.IsDICOM;
+          slot.FromIndex = true;
+          slot.AccessCode = 0;
+          slot.PixelDataFound = ei->second.PixelDataFound;
+          slot.QueryMatched = slot.IsDICOM;
+          slot.ErrorCode = 0;
+          slot.Meta = ei->second.Meta;
+          slot.Digest = ei->second.Digest;
+          slot.DigestLength = ei->second.DigestLength;
+          slot.TagFilter = ei->second.TagFilter;
+          continue;
+          }
+        }
+      }
+
+    slot.IsDICOM = vtkDICOMUtilities::IsDICOMFile(fileName.c_str());
+    if (!slot.IsDICOM)
+      {
+      slot.AccessCode =
+        vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+      continue;
+      }
+
+    slot.Meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    parser->SetMetaData(slot.Meta);
+    parser->SetFileName(fileName.c_str());
+    if (info->BuildTagFilters)
+      {
+      // build a tag presence filter for the persistent index
+      slot.TagFilter.assign(vtkDICOMParser::TagFilterSize, 0);
+      parser->SetTagFilterBuffer(&slot.TagFilter[0]);
+      }
+    parser->Update();
+    slot.PixelDataFound = parser->GetPixelDataFound();
+    slot.QueryMatched = parser->GetQueryMatched();
+    slot.ErrorCode = parser->GetErrorCode();
+    slot.Condition = parser->GetCondition(0);
+    slot.ConditionOffset = parser->GetConditionOffset(0);
+    slot.PixelDataOffset = parser->GetFileOffset();
+    slot.FileSize = parser->GetFileSize();
+    slot.Digest = parser->GetDigest();
+    slot.DigestLength = parser->GetDigestLength();
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// append raw bytes to the serialized form of the index
+void vtkDICOMDirectoryIndexAppend(
+  std::vector<unsigned char>& buf, const void *data, size_t n)
+{
+  const unsigned char *cp = static_cast<const unsigned char *>(data);
+  buf.insert(buf.end(), cp, cp + n);
+}
+
+// get a pointer to the raw data of a value, or NULL for sequences,
+// attribute tags, and nested values, which the index does not store
+const void *vtkDICOMDirectoryIndexValueData(const vtkDICOMValue& v)
+{
+  const void *dp = 0;
+  switch (v.GetVR().GetType())
+    {
+    case VTK_CHAR:
+      dp = v.GetCharData();
+      break;
+    case VTK_UNSIGNED_CHAR:
+      dp = v.GetUnsignedCharData();
+      break;
+    case VTK_SHORT:
+      dp = v.GetShortData();
+      break;
+    case VTK_UNSIGNED_SHORT:
+      dp = v.GetUnsignedShortData();
+      break;
+    case VTK_INT:
+      dp = v.GetIntData();
+      break;
+    case VTK_UNSIGNED_INT:
+      dp = v.GetUnsignedIntData();
+      break;
+    case VTK_FLOAT:
+      dp = v.GetFloatData();
+      break;
+    case VTK_DOUBLE:
+      dp = v.GetDoubleData();
+      break;
+    }
+  return dp;
+}
+
+// recreate a value from its raw data as stored in the index
+vtkDICOMValue vtkDICOMDirectoryIndexMakeValue(
+  vtkDICOMVR vr, vtkDICOMCharacterSet cs,
+  const unsigned char *data, unsigned int vl)
+{
+  vtkDICOMValue v;
+  switch (vr.GetType())
+    {
+    case VTK_CHAR:
+      {
+      char *p = v.AllocateCharData(vr, cs, vl);
+      memcpy(p, data, vl);
+      v.ComputeNumberOfValuesForCharData();
+      }
+      break;
+    case VTK_UNSIGNED_CHAR:
+      memcpy(v.AllocateUnsignedCharData(vr, vl), data, vl);
+      break;
+    case VTK_SHORT:
+      memcpy(v.AllocateShortData(vr, vl/2), data, vl);
+      break;
+    case VTK_UNSIGNED_SHORT:
+      memcpy(v.AllocateUnsignedShortData(vr, vl/2), data, vl);
+      break;
+    case VTK_INT:
+      memcpy(v.AllocateIntData(vr, vl/4), data, vl);
+      break;
+    case VTK_UNSIGNED_INT:
+      memcpy(v.AllocateUnsignedIntData(vr, vl/4), data, vl);
+      break;
+    case VTK_FLOAT:
+      memcpy(v.AllocateFloatData(vr, vl/4), data, vl);
+      break;
+    case VTK_DOUBLE:
+      memcpy(v.AllocateDoubleData(vr, vl/8), data, vl);
+      break;
+    }
+  return v;
+}
+
+// the magic number and version for the index file format,
+// stored in native byte order so that the version also acts
+// as a byte-order check
+const char vtkDICOMDirectoryIndexMagic[8] = {
+  'V', 'T', 'K', 'D', 'C', 'M', 'I', 'X'
+};
+const unsigned int vtkDICOMDirectoryIndexVersion = 6;
+
+// the attributes that get secondary indexes (sorted projections) at
+// the end of the index file, so that selective queries on them can
+// be answered without deserializing the per-file attribute records
+const DC::EnumType vtkDICOMDirectoryIndexProjections[4] = {
+  DC::PatientID, DC::StudyDate, DC::Modality, DC::SeriesInstanceUID
+};
+
+// append a length-prefixed string to the serialized form of the index
+void vtkDICOMDirectoryIndexAppendString(
+  std::vector<unsigned char>& buf, const std::string& s)
+{
+  unsigned int l = static_cast<unsigned int>(s.size());
+  vtkDICOMDirectoryIndexAppend(buf, &l, 4);
+  vtkDICOMDirectoryIndexAppend(buf, s.data(), l);
+}
+
+// read a length-prefixed string, returns false if the data is short
+bool vtkDICOMDirectoryIndexReadString(
+  const unsigned char **cpp, const unsigned char *ep, std::string *s)
+{
+  const unsigned char *cp = *cpp;
+  unsigned int l;
+  if (ep - cp < 4) { return false; }
+  memcpy(&l, cp, 4);
+  cp += 4;
+  if (static_cast<size_t>(ep - cp) < l) { return false; }
+  s->assign(reinterpret_cast<const char *>(cp), l);
+  *cpp = cp + l;
+  return true;
+}
+
+// write the index to disk, the format is the scan options that shape
+// the directory listings (file pattern and flags), then the directory
+// records (path, mtime, depth, candidate files, subdirectories), then
+// a counted sequence of file records: path length and path, file
+// size, mtime, the content digest and the byte count it covers,
+// DICOM flag, pixel data flag, the tag presence filter
+// (a flag byte, and the filter itself if the flag is set), and the
+// serialized attributes (tag, vr, charset, length, raw data);
+// non-DICOM files have no attributes; the file ends with the
+// secondary indexes
+bool vtkDICOMDirectoryWriteIndex(
+  const char *fname, const vtkDICOMDirectoryIndex& index,
+  const vtkDICOMDirectoryDirIndex& dirs,
+  const char *pattern, unsigned char flags)
+{
+  std::vector<unsigned char> buf;
+  vtkDICOMDirectoryIndexAppend(buf, vtkDICOMDirectoryIndexMagic, 8);
+  vtkDICOMDirectoryIndexAppend(buf, &vtkDICOMDirectoryIndexVersion, 4);
+
+  // the scan options that the directory records depend upon
+  vtkDICOMDirectoryIndexAppendString(
+    buf, std::string(pattern ? pattern : ""));
+  vtkDICOMDirectoryIndexAppend(buf, &flags, 1);
+
+  // the directory records
+  unsigned int nd = static_cast<unsigned int>(dirs.size());
+  vtkDICOMDirectoryIndexAppend(buf, &nd, 4);
+  vtkDICOMDirectoryDirIndex::const_iterator di;
+  for (di = dirs.begin(); di != dirs.end(); ++di)
+    {
+    const vtkDICOMDirectoryDirEntry& e = di->second;
+    vtkDICOMDirectoryIndexAppendString(buf, di->first);
+    long long mtime = e.MTime;
+    vtkDICOMDirectoryIndexAppend(buf, &mtime, 8);
+    int depth = e.Depth;
+    vtkDICOMDirectoryIndexAppend(buf, &depth, 4);
+    unsigned int nf = static_cast<unsigned int>(e.Files.size());
+    vtkDICOMDirectoryIndexAppend(buf, &nf, 4);
+    for (unsigned int i = 0; i < nf; i++)
+      {
+      vtkDICOMDirectoryIndexAppendString(buf, e.Files[i].first);
+      vtkDICOMDirectoryIndexAppendString(buf, e.Files[i].second);
+      }
+    unsigned int ns = static_cast<unsigned int>(e.Subdirs.size());
+    vtkDICOMDirectoryIndexAppend(buf, &ns, 4);
+    for (unsigned int i = 0; i < ns; i++)
+      {
+      vtkDICOMDirectoryIndexAppendString(buf, e.Subdirs[i]);
+      }
+    }
+
+  // the file records, preceded by their count
+  unsigned int nrec = 0;
+  vtkDICOMDirectoryIndex::const_iterator iter;
+  for (iter = index.begin(); iter != index.end(); ++iter)
+    {
+    nrec += (!iter->second.IsDICOM ||
+             iter->second.Meta.GetPointer() != 0);
+    }
+  vtkDICOMDirectoryIndexAppend(buf, &nrec, 4);
+
+  // the secondary index projections are collected while the file
+  // records are written, keyed by attribute value and holding the
+  // ordinals of the records where each value occurs
+  std::map<std::string, std::vector<unsigned int> > projections[4];
+  unsigned int ordinal = 0;
+
+  for (iter = index.begin(); iter != index.end(); ++iter)
+    {
+    const std::string& path = iter->first;
+    const vtkDICOMDirectoryIndexEntry& e = iter->second;
+    if (e.IsDICOM && e.Meta.GetPointer() == 0)
+      {
+      continue;
+      }
+
+    if (e.Meta.GetPointer() != 0)
+      {
+      for (int t = 0; t < 4; t++)
+        {
+        const vtkDICOMValue& v = e.Meta->GetAttributeValue(
+          vtkDICOMDirectoryIndexProjections[t]);
+        if (v.IsValid())
+          {
+          projections[t][v.AsString()].push_back(ordinal);
+          }
+        }
+      }
+    ordinal++;
+
+    unsigned int pl = static_cast<unsigned int>(path.size());
+    vtkDICOMDirectoryIndexAppend(buf, &pl, 4);
+    vtkDICOMDirectoryIndexAppend(buf, path.data(), pl);
+    unsigned long long fileSize = e.Size;
+    vtkDICOMDirectoryIndexAppend(buf, &fileSize, 8);
+    long long mtime = e.MTime;
+    vtkDICOMDirectoryIndexAppend(buf, &mtime, 8);
+    unsigned int digest = e.Digest;
+    vtkDICOMDirectoryIndexAppend(buf, &digest, 4);
+    long long digestLength = e.DigestLength;
+    vtkDICOMDirectoryIndexAppend(buf, &digestLength, 8);
+    unsigned char dicm = (e.IsDICOM != 0);
+    vtkDICOMDirectoryIndexAppend(buf, &dicm, 1);
+    unsigned char pix = (e.PixelDataFound != 0);
+    vtkDICOMDirectoryIndexAppend(buf, &pix, 1);
+    unsigned char filt = (e.TagFilter.size() ==
+      static_cast<size_t>(vtkDICOMParser::TagFilterSize));
+    vtkDICOMDirectoryIndexAppend(buf, &filt, 1);
+    if (filt)
+      {
+      vtkDICOMDirectoryIndexAppend(
+        buf, &e.TagFilter[0], vtkDICOMParser::TagFilterSize);
+      }
+
+    // count the attributes that can be serialized
+    unsigned int n = 0;
+    vtkDICOMDataElementIterator di;
+    if (e.Meta.GetPointer() != 0)
+      {
+      for (di = e.Meta->Begin(); di != e.Meta->End(); ++di)
+        {
+        n += (vtkDICOMDirectoryIndexValueData(di->GetValue()) != 0);
+        }
+      }
+    vtkDICOMDirectoryIndexAppend(buf, &n, 4);
+
+    if (e.Meta.GetPointer() != 0)
+      {
+      for (di = e.Meta->Begin(); di != e.Meta->End(); ++di)
+        {
+        const vtkDICOMValue& v = di->GetValue();
+        const void *dp = vtkDICOMDirectoryIndexValueData(v);
+        if (dp == 0)
+          {
+          continue;
+          }
+        unsigned short g = di->GetTag().GetGroup();
+        unsigned short el = di->GetTag().GetElement();
+        vtkDICOMDirectoryIndexAppend(buf, &g, 2);
+        vtkDICOMDirectoryIndexAppend(buf, &el, 2);
+        vtkDICOMDirectoryIndexAppend(buf, v.GetVR().GetText(), 2);
+        unsigned char cs = v.GetCharacterSet().GetKey();
+        vtkDICOMDirectoryIndexAppend(buf, &cs, 1);
+        unsigned int vl = v.GetVL();
+        vtkDICOMDirectoryIndexAppend(buf, &vl, 4);
+        vtkDICOMDirectoryIndexAppend(buf, dp, vl);
+        }
+      }
+    }
+
+  // the secondary indexes: for each projected attribute, the sorted
+  // distinct values, and for each value the ordinals of the records
+  // where it occurs
+  for (int t = 0; t < 4; t++)
+    {
+    vtkDICOMTag ptag(vtkDICOMDirectoryIndexProjections[t]);
+    unsigned short g = ptag.GetGroup();
+    unsigned short el = ptag.GetElement();
+    vtkDICOMDirectoryIndexAppend(buf, &g, 2);
+    vtkDICOMDirectoryIndexAppend(buf, &el, 2);
+    unsigned int nv = static_cast<unsigned int>(projections[t].size());
+    vtkDICOMDirectoryIndexAppend(buf, &nv, 4);
+    std::map<std::string, std::vector<unsigned int> >::const_iterator vi;
+    for (vi = projections[t].begin(); vi != projections[t].end(); ++vi)
+      {
+      vtkDICOMDirectoryIndexAppendString(buf, vi->first);
+      unsigned int np = static_cast<unsigned int>(vi->second.size());
+      vtkDICOMDirectoryIndexAppend(buf, &np, 4);
+      vtkDICOMDirectoryIndexAppend(buf, &vi->second[0], 4*np);
+      }
+    }
+
+  vtkDICOMFile f(fname, vtkDICOMFile::Out);
+  if (f.GetError())
+    {
+    return false;
+    }
+  size_t m = f.Write(&buf[0], buf.size());
+  f.Close();
+  return (m == buf.size());
+}
+
+// checkpoint a partial scan: the records produced so far are written
+// to the index file, merged over the entries that were loaded at the
+// start of the scan, so that entries for files the scan has not yet
+// reached are carried through and a resumed or later scan can still
+// use them
+bool vtkDICOMDirectoryWriteCheckpoint(
+  const char *fname, const vtkDICOMDirectoryIndex& oldIndex,
+  const vtkDICOMDirectoryIndex& newIndex,
+  const vtkDICOMDirectoryDirIndex& dirs,
+  const char *pattern, unsigned char flags)
+{
+  vtkDICOMDirectoryIndex merged(oldIndex);
+  for (vtkDICOMDirectoryIndex::const_iterator it = newIndex.begin();
+       it != newIndex.end(); ++it)
+    {
+    merged[it->first] = it->second;
+    }
+  return vtkDICOMDirectoryWriteIndex(fname, merged, dirs, pattern, flags);
+}
+
+// read the index from disk, a missing or malformed index file is
+// not an error, it simply means that every file must be parsed;
+// either of the two output maps may be null: when "dirs" is null
+// the directory records are skipped, and when "index" is null the
+// read stops once the directory records have been read; directory
+// records are only returned if the stored scan options match the
+// pattern and flags that are given
+bool vtkDICOMDirectoryReadIndex(
+  const char *fname, vtkDICOMDirectoryIndex *index,
+  vtkDICOMDirectoryDirIndex *dirs,
+  const char *pattern, unsigned char flags)
+{
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+    {
+    return false;
+    }
+  vtkDICOMFile::Size size = f.GetSize();
+  if (size == static_cast<vtkDICOMFile::Size>(-1) || size < 12)
+    {
+    f.Close();
+    return false;
+    }
+  std::vector<unsigned char> buf(static_cast<size_t>(size));
+  size_t m = f.Read(&buf[0], buf.size());
+  f.Close();
+  if (m != buf.size() ||
+      memcmp(&buf[0], vtkDICOMDirectoryIndexMagic, 8) != 0 ||
+      memcmp(&buf[8], &vtkDICOMDirectoryIndexVersion, 4) != 0)
+    {
+    return false;
+    }
+
+  const unsigned char *cp = &buf[0] + 12;
+  const unsigned char *ep = &buf[0] + buf.size();
+
+  // the scan options that the directory records depend upon
+  std::string storedPattern;
+  if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &storedPattern) ||
+      ep - cp < 5)
+    {
+    return false;
+    }
+  bool sameOptions = (storedPattern == (pattern ? pattern : "") &&
+                      *cp == flags);
+  cp++;
+
+  // the directory records
+  unsigned int nd;
+  memcpy(&nd, cp, 4);
+  cp += 4;
+  for (unsigned int d = 0; d < nd; d++)
+    {
+    std::string dirname;
+    vtkDICOMDirectoryDirEntry entry;
+    if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &dirname) ||
+        ep - cp < 16)
+      {
+      return false;
+      }
+    memcpy(&entry.MTime, cp, 8);
+    memcpy(&entry.Depth, cp + 8, 4);
+    unsigned int nf;
+    memcpy(&nf, cp + 12, 4);
+    cp += 16;
+    if (static_cast<size_t>(ep - cp) < 8*static_cast<size_t>(nf))
+      {
+      return false;
+      }
+    entry.Files.resize(nf);
+    for (unsigned int i = 0; i < nf; i++)
+      {
+      if (!vtkDICOMDirectoryIndexReadString(
+            &cp, ep, &entry.Files[i].first) ||
+          !vtkDICOMDirectoryIndexReadString(
+            &cp, ep, &entry.Files[i].second))
+        {
+        return false;
+        }
+      }
+    unsigned int ns;
+    if (ep - cp < 4) { return false; }
+    memcpy(&ns, cp, 4);
+    cp += 4;
+    if (static_cast<size_t>(ep - cp) < 4*static_cast<size_t>(ns))
+      {
+      return false;
+      }
+    entry.Subdirs.resize(ns);
+    for (unsigned int i = 0; i < ns; i++)
+      {
+      if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &entry.Subdirs[i]))
+        {
+        return false;
+        }
+      }
+    if (dirs && sameOptions)
+      {
+      vtkDICOMDirectoryDirEntry& e = (*dirs)[dirname];
+      e.MTime = entry.MTime;
+      e.Depth = entry.Depth;
+      e.Files.swap(entry.Files);
+      e.Subdirs.swap(entry.Subdirs);
+      }
+    }
+
+  // the file records are not needed when only the directory records
+  // were asked for
+  if (index == 0)
+    {
+    return true;
+    }
+
+  // the secondary indexes that follow the file records are only used
+  // by QueryIndexFile(), so the read stops after the counted records
+  unsigned int nrec;
+  if (ep - cp < 4) { return false; }
+  memcpy(&nrec, cp, 4);
+  cp += 4;
+  for (unsigned int r = 0; r < nrec; r++)
+    {
+    unsigned int pl;
+    if (ep - cp < 4) { return false; }
+    memcpy(&pl, cp, 4);
+    cp += 4;
+    if (static_cast<size_t>(ep - cp) < static_cast<size_t>(pl) + 35)
+      {
+      return false;
+      }
+    std::string path(reinterpret_cast<const char *>(cp), pl);
+    cp += pl;
+    vtkDICOMDirectoryIndexEntry& e = (*index)[path];
+    unsigned long long fileSize;
+    memcpy(&fileSize, cp, 8);
+    cp += 8;
+    e.Size = fileSize;
+    memcpy(&e.MTime, cp, 8);
+    cp += 8;
+    memcpy(&e.Digest, cp, 4);
+    cp += 4;
+    long long digestLength;
+    memcpy(&digestLength, cp, 8);
+    cp += 8;
+    e.DigestLength = digestLength;
+    e.IsDICOM = (*cp++ != 0);
+    e.PixelDataFound = (*cp++ != 0);
+    if (*cp++ != 0)
+      {
+      // the tag presence filter for the file
+      if (ep - cp < vtkDICOMParser::TagFilterSize + 4)
+        {
+        return false;
+        }
+      e.TagFilter.assign(cp, cp + vtkDICOMParser::TagFilterSize);
+      cp += vtkDICOMParser::TagFilterSize;
+      }
+    unsigned int n;
+    if (ep - cp < 4) { return false; }
+    memcpy(&n, cp, 4);
+    cp += 4;
+    if (e.IsDICOM)
+      {
+      e.Meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+      }
+    else if (n != 0)
+      {
+      return false;
+      }
+    for (unsigned int i = 0; i < n; i++)
+      {
+      if (ep - cp < 11) { return false; }
+      unsigned short g, el;
+      memcpy(&g, cp, 2);
+      memcpy(&el, cp + 2, 2);
+      char vrtext[2] = { static_cast<char>(cp[4]),
+                         static_cast<char>(cp[5]) };
+      vtkDICOMVR vr(vrtext);
+      unsigned char cs = cp[6];
+      unsigned int vl;
+      memcpy(&vl, cp + 7, 4);
+      cp += 11;
+      if (static_cast<size_t>(ep - cp) < vl || !vr.IsValid())
+        {
+        return false;
+        }
+      e.Meta->SetAttributeValue(vtkDICOMTag(g, el),
+        vtkDICOMDirectoryIndexMakeValue(vr, cs, cp, vl));
+      cp += vl;
+      }
+    }
+
+  return true;
+}
+
+// position a read pointer at the counted file records of a serialized
+// index by skipping the scan options and the directory records; used
+// by the static query methods, which do not need those sections
+bool vtkDICOMDirectoryIndexSkipToRecords(
+  const unsigned char **cpp, const unsigned char *ep)
+{
+  const unsigned char *cp = *cpp;
+
+  // skip the scan options
+  std::string s;
+  if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &s) || ep - cp < 5)
+    {
+    return false;
+    }
+  cp++;
+
+  // skip the directory records
+  unsigned int nd;
+  memcpy(&nd, cp, 4);
+  cp += 4;
+  for (unsigned int d = 0; d < nd; d++)
+    {
+    if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &s) ||
+        ep - cp < 16)
+      {
+      return false;
+      }
+    unsigned int nf;
+    memcpy(&nf, cp + 12, 4);
+    cp += 16;
+    for (unsigned int i = 0; i < 2*nf; i++)
+      {
+      if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &s))
+        {
+        return false;
+        }
+      }
+    unsigned int ns;
+    if (ep - cp < 4) { return false; }
+    memcpy(&ns, cp, 4);
+    cp += 4;
+    for (unsigned int i = 0; i < ns; i++)
+      {
+      if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &s))
+        {
+        return false;
+        }
+      }
+    }
+
+  *cpp = cp;
+  return true;
+}
+
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::QueryIndexFile(
+  const char *fname, vtkDICOMTag tag, const char *value,
+  vtkStringArray *paths)
+{
+  if (fname == 0 || value == 0 || paths == 0)
+    {
+    return false;
+    }
+
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+    {
+    return false;
+    }
+  vtkDICOMFile::Size size = f.GetSize();
+  if (size == static_cast<vtkDICOMFile::Size>(-1) || size < 12)
+    {
+    f.Close();
+    return false;
+    }
+  std::vector<unsigned char> buf(static_cast<size_t>(size));
+  size_t m = f.Read(&buf[0], buf.size());
+  f.Close();
+  if (m != buf.size() ||
+      memcmp(&buf[0], vtkDICOMDirectoryIndexMagic, 8) != 0 ||
+      memcmp(&buf[8], &vtkDICOMDirectoryIndexVersion, 4) != 0)
+    {
+    return false;
+    }
+
+  const unsigned char *cp = &buf[0] + 12;
+  const unsigned char *ep = &buf[0] + buf.size();
+
+  // skip the scan options and the directory records
+  if (!vtkDICOMDirectoryIndexSkipToRecords(&cp, ep))
+    {
+    return false;
+    }
+
+  // read the file paths, skipping over the serialized attributes
+  unsigned int nrec;
+  if (ep - cp < 4) { return false; }
+  memcpy(&nrec, cp, 4);
+  cp += 4;
+  std::vector<std::string> recordPaths(nrec);
+  for (unsigned int r = 0; r < nrec; r++)
+    {
+    if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &recordPaths[r]) ||
+        ep - cp < 35)
+      {
+      return false;
+      }
+    unsigned char filt = cp[30];
+    cp += 31;
+    if (filt)
+      {
+      // hop over the tag presence filter
+      if (ep - cp < vtkDICOMParser::TagFilterSize + 4)
+        {
+        return false;
+        }
+      cp += vtkDICOMParser::TagFilterSize;
+      }
+    unsigned int n;
+    memcpy(&n, cp, 4);
+    cp += 4;
+    for (unsigned int i = 0; i < n; i++)
+      {
+      if (ep - cp < 11) { return false; }
+      unsigned int vl;
+      memcpy(&vl, cp + 7, 4);
+      cp += 11;
+      if (static_cast<size_t>(ep - cp) < vl) { return false; }
+      cp += vl;
+      }
+    }
+
+  // interpret a StudyDate range of the form "lo-hi", where either
+  // end of the range may be omitted
+  std::string lo = value;
+  std::string hi = value;
+  bool openHi = false;
+  if (tag == vtkDICOMTag(DC::StudyDate))
+    {
+    size_t dash = lo.find('-');
+    if (dash != std::string::npos)
+      {
+      hi = lo.substr(dash + 1);
+      lo = lo.substr(0, dash);
+      openHi = hi.empty();
+      }
+    }
+
+  // walk the projections and collect matches from the requested one
+  for (int t = 0; t < 4; t++)
+    {
+    if (ep - cp < 8) { return false; }
+    unsigned short g, el;
+    memcpy(&g, cp, 2);
+    memcpy(&el, cp + 2, 2);
+    unsigned int nv;
+    memcpy(&nv, cp + 4, 4);
+    cp += 8;
+    bool wanted = (vtkDICOMTag(g, el) == tag);
+    for (unsigned int i = 0; i < nv; i++)
+      {
+      std::string v;
+      if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &v) ||
+          ep - cp < 4)
+        {
+        return false;
+        }
+      unsigned int np;
+      memcpy(&np, cp, 4);
+      cp += 4;
+      if (static_cast<size_t>(ep - cp) < 4*static_cast<size_t>(np))
+        {
+        return false;
+        }
+      if (wanted && v >= lo && (openHi || v <= hi))
+        {
+        for (unsigned int j = 0; j < np; j++)
+          {
+          unsigned int ord;
+          memcpy(&ord, cp + 4*j, 4);
+          if (ord < nrec)
+            {
+            paths->InsertNextValue(recordPaths[ord]);
+            }
+          }
+        }
+      cp += 4*static_cast<size_t>(np);
+      }
+    if (wanted)
+      {
+      return true;
+      }
+    }
+
+  return false;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::QueryIndexFileForTag(
+  const char *fname, vtkDICOMTag tag, vtkStringArray *paths)
+{
+  if (fname == 0 || paths == 0)
+    {
+    return false;
+    }
+
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+    {
+    return false;
+    }
+  vtkDICOMFile::Size size = f.GetSize();
+  if (size == static_cast<vtkDICOMFile::Size>(-1) || size < 12)
+    {
+    f.Close();
+    return false;
+    }
+  std::vector<unsigned char> buf(static_cast<size_t>(size));
+  size_t m = f.Read(&buf[0], buf.size());
+  f.Close();
+  if (m != buf.size() ||
+      memcmp(&buf[0], vtkDICOMDirectoryIndexMagic, 8) != 0 ||
+      memcmp(&buf[8], &vtkDICOMDirectoryIndexVersion, 4) != 0)
+    {
+    return false;
+    }
+
+  const unsigned char *cp = &buf[0] + 12;
+  const unsigned char *ep = &buf[0] + buf.size();
+
+  // skip the scan options and the directory records
+  if (!vtkDICOMDirectoryIndexSkipToRecords(&cp, ep))
+    {
+    return false;
+    }
+
+  // the bit positions that the tag sets in a presence filter; for a
+  // private tag, the block assignment (the high byte of the element)
+  // varies from file to file, so every possible block is tested
+  std::vector<unsigned int> bits;
+  if ((tag.GetGroup() & 1) != 0 && (tag.GetElement() & 0xff00) >= 0x1000)
+    {
+    unsigned short e = tag.GetElement() & 0x00ff;
+    for (int b = 0x10; b <= 0xff; b++)
+      {
+      unsigned int t[3];
+      vtkDICOMParser::TagFilterBits(
+        vtkDICOMTag(tag.GetGroup(), (b << 8) | e), t);
+      bits.insert(bits.end(), t, t + 3);
+      }
+    }
+  else
+    {
+    unsigned int t[3];
+    vtkDICOMParser::TagFilterBits(tag, t);
+    bits.insert(bits.end(), t, t + 3);
+    }
+
+  // test the filter of each file record, skipping the attributes
+  unsigned int nrec;
+  if (ep - cp < 4) { return false; }
+  memcpy(&nrec, cp, 4);
+  cp += 4;
+  for (unsigned int r = 0; r < nrec; r++)
     {
-    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
-    tag++;
+    std::string path;
+    if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &path) ||
+        ep - cp < 35)
+      {
+      return false;
+      }
+    unsigned char dicm = cp[28];
+    unsigned char filt = cp[30];
+    cp += 31;
+    bool candidate = (dicm != 0);
+    if (filt)
+      {
+      if (ep - cp < vtkDICOMParser::TagFilterSize + 4)
+        {
+        return false;
+        }
+      // the tag can only be present if all three of its bits are set
+      // (a file without a filter stays a candidate, to be safe)
+      bool present = false;
+      for (size_t ii = 0; ii < bits.size() && !present; ii += 3)
+        {
+        present =
+          ((cp[bits[ii] >> 3] & (1 << (bits[ii] & 7))) != 0 &&
+           (cp[bits[ii+1] >> 3] & (1 << (bits[ii+1] & 7))) != 0 &&
+           (cp[bits[ii+2] >> 3] & (1 << (bits[ii+2] & 7))) != 0);
+        }
+      candidate = (candidate && present);
+      cp += vtkDICOMParser::TagFilterSize;
+      }
+    unsigned int n;
+    memcpy(&n, cp, 4);
+    cp += 4;
+    for (unsigned int i = 0; i < n; i++)
+      {
+      if (ep - cp < 11) { return false; }
+      unsigned int vl;
+      memcpy(&vl, cp + 7, 4);
+      cp += 11;
+      if (static_cast<size_t>(ep - cp) < vl) { return false; }
+      cp += vl;
+      }
+    if (candidate)
+      {
+      paths->InsertNextValue(path);
+      }
     }
+
+  return true;
 }
 
 //----------------------------------------------------------------------------
-void vtkDICOMDirectory::FillStudyRecord(
-  vtkDICOMItem *item, vtkDICOMMetaData *meta)
+bool vtkDICOMDirectory::QueryIndexFileForDuplicates(
+  const char *fname, vtkStringArray *candidates, vtkStringArray *duplicates)
 {
-  static const DC::EnumType tags[] = {
-    DC::SpecificCharacterSet,
-    DC::StudyDate,
-    DC::StudyTime,
-    DC::ReferringPhysicianName,
-    DC::PatientAge,
-    DC::StudyInstanceUID,
-    DC::StudyID,
-    DC::AccessionNumber,
-    DC::StudyDescription,
-    DC::ItemDelimitationItem
-  };
+  if (fname == 0 || candidates == 0 || duplicates == 0)
+    {
+    return false;
+    }
 
-  const DC::EnumType *tag = tags;
-  while (*tag != DC::ItemDelimitationItem)
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
     {
-    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
-    tag++;
+    return false;
+    }
+  vtkDICOMFile::Size size = f.GetSize();
+  if (size == static_cast<vtkDICOMFile::Size>(-1) || size < 12)
+    {
+    f.Close();
+    return false;
+    }
+  std::vector<unsigned char> buf(static_cast<size_t>(size));
+  size_t m = f.Read(&buf[0], buf.size());
+  f.Close();
+  if (m != buf.size() ||
+      memcmp(&buf[0], vtkDICOMDirectoryIndexMagic, 8) != 0 ||
+      memcmp(&buf[8], &vtkDICOMDirectoryIndexVersion, 4) != 0)
+    {
+    return false;
     }
-}
 
-//----------------------------------------------------------------------------
-void vtkDICOMDirectory::FillPatientRecord(
-  vtkDICOMItem *item, vtkDICOMMetaData *meta)
-{
-  static const DC::EnumType tags[] = {
-    DC::SpecificCharacterSet,
-    DC::PatientName,
-    DC::PatientID,
-    DC::PatientBirthDate,
-    DC::PatientSex,
-    DC::ItemDelimitationItem
-  };
+  const unsigned char *cp = &buf[0] + 12;
+  const unsigned char *ep = &buf[0] + buf.size();
 
-  const DC::EnumType *tag = tags;
-  while (*tag != DC::ItemDelimitationItem)
+  // skip the scan options and the directory records
+  if (!vtkDICOMDirectoryIndexSkipToRecords(&cp, ep))
     {
-    item->SetAttributeValue(*tag, meta->GetAttributeValue(*tag));
-    tag++;
+    return false;
     }
-}
 
-//----------------------------------------------------------------------------
-namespace {
-
-unsigned int vtkDICOMDirectoryHashString(const std::string& str)
-{
-  // Compute a string hash based on the function "djb2".
-  unsigned int h = 5381;
-  size_t n = str.size();
-  const char *cp = str.data();
-  for (size_t k = 0; k < n; k++)
+  // collect the digests of the indexed files, keyed by file size so
+  // that a candidate is only opened when its size matches an indexed
+  // file; each digest is paired with the byte count it covers
+  typedef std::multimap<unsigned long long,
+                        std::pair<long long, unsigned int> > DigestMap;
+  DigestMap digests;
+
+  unsigned int nrec;
+  if (ep - cp < 4) { return false; }
+  memcpy(&nrec, cp, 4);
+  cp += 4;
+  for (unsigned int r = 0; r < nrec; r++)
     {
-    unsigned char c = cp[k];
-    if (c == '\0') { break; }
-    h = (h << 5) + h + c;
+    std::string path;
+    if (!vtkDICOMDirectoryIndexReadString(&cp, ep, &path) ||
+        ep - cp < 35)
+      {
+      return false;
+      }
+    unsigned long long fileSize;
+    memcpy(&fileSize, cp, 8);
+    unsigned int digest;
+    memcpy(&digest, cp + 16, 4);
+    long long digestLength;
+    memcpy(&digestLength, cp + 20, 8);
+    unsigned char dicm = cp[28];
+    unsigned char filt = cp[30];
+    cp += 31;
+    if (dicm && digestLength > 0)
+      {
+      digests.insert(std::make_pair(
+        fileSize, std::make_pair(digestLength, digest)));
+      }
+    if (filt)
+      {
+      // hop over the tag presence filter
+      if (ep - cp < vtkDICOMParser::TagFilterSize + 4)
+        {
+        return false;
+        }
+      cp += vtkDICOMParser::TagFilterSize;
+      }
+    unsigned int n;
+    memcpy(&n, cp, 4);
+    cp += 4;
+    for (unsigned int i = 0; i < n; i++)
+      {
+      if (ep - cp < 11) { return false; }
+      unsigned int vl;
+      memcpy(&vl, cp + 7, 4);
+      cp += 11;
+      if (static_cast<size_t>(ep - cp) < vl) { return false; }
+      cp += vl;
+      }
     }
 
-  return h;
-}
+  // check each candidate against the collected digests
+  vtkIdType numCandidates = candidates->GetNumberOfValues();
+  for (vtkIdType i = 0; i < numCandidates; i++)
+    {
+    const std::string& path = candidates->GetValue(i);
+    vtkDICOMFile::Size candSize = 0;
+    long long candMTime = 0;
+    if (!vtkDICOMFile::GetFileInfo(path.c_str(), &candSize, &candMTime))
+      {
+      continue;
+      }
+    std::pair<DigestMap::const_iterator, DigestMap::const_iterator>
+      range = digests.equal_range(candSize);
+    if (range.first == range.second)
+      {
+      continue;
+      }
 
+    // the prefix lengths to be checked, in increasing order, so that
+    // the candidate can be read once, front to back, with the digest
+    // compared at each recorded length along the way
+    std::map<long long, std::vector<unsigned int> > lengths;
+    for (DigestMap::const_iterator di = range.first;
+         di != range.second; ++di)
+      {
+      lengths[di->second.first].push_back(di->second.second);
+      }
+
+    vtkDICOMFile cf(path.c_str(), vtkDICOMFile::In);
+    if (cf.GetError())
+      {
+      continue;
+      }
+    unsigned char block[8192];
+    unsigned int crc = 0;
+    long long pos = 0;
+    bool matched = false;
+    std::map<long long, std::vector<unsigned int> >::iterator li;
+    for (li = lengths.begin(); li != lengths.end() && !matched; ++li)
+      {
+      long long target = li->first;
+      while (pos < target)
+        {
+        size_t want = sizeof(block);
+        if (target - pos < static_cast<long long>(want))
+          {
+          want = static_cast<size_t>(target - pos);
+          }
+        size_t got = cf.Read(block, want);
+        if (got == 0) { break; }
+        crc = vtkDICOMUtilities::ComputeCRC32C(crc, block, got);
+        pos += got;
+        }
+      if (pos != target)
+        {
+        break;
+        }
+      for (size_t j = 0; j < li->second.size() && !matched; j++)
+        {
+        matched = (li->second[j] == crc);
+        }
+      }
+    cf.Close();
+    if (matched)
+      {
+      duplicates->InsertNextValue(path);
+      }
+    }
+
+  return true;
 }
 
 //----------------------------------------------------------------------------
@@ -1025,6 +2646,13 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
   parser->AddObserver(
     vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
 
+  // record parse errors as cheap condition codes, and only render
+  // them into text for the files whose errors are actually reported
+  parser->DeferErrorReportingOn();
+
+  // the scan is background work, its reads yield to interactive loads
+  parser->SetIOPriority(vtkDICOMFile::PriorityBackground);
+
   parser->SetMetaData(meta);
 
   // these are the attributes that must be part of the query
@@ -1084,7 +2712,45 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     parser->SetBufferSize(4096);
     }
 
-  parser->SetQuery(query);
+  // When the complete file metadata is to be kept, the query is not
+  // given to the parser, since the parser only stores the attributes
+  // that are listed in its query.  This mode is incompatible with a
+  // find query, which must be applied while the files are parsed.
+  bool keepMeta = (this->KeepFileMetaData != 0 && this->Query == 0);
+  if (!keepMeta)
+    {
+    parser->SetQuery(query);
+    }
+
+  // Load the persistent index, if one has been set.  The index is not
+  // consulted when a find query is set, because queries are applied
+  // while the file is parsed, but it is still rewritten after the scan.
+  // It is also not used when the complete file metadata is to be kept,
+  // because the index does not store complete headers.
+  vtkDICOMDirectoryIndex index;
+  vtkDICOMDirectoryIndex newIndex;
+  bool useIndex =
+    (this->IndexFileName != 0 && this->IndexFileName[0] != '\0' &&
+     this->Query == 0 && !keepMeta);
+  bool readFromIndex = false;
+  if (useIndex)
+    {
+    readFromIndex = vtkDICOMDirectoryReadIndex(
+      this->IndexFileName, &index, 0, 0, 0);
+    if (!readFromIndex)
+      {
+      index.clear();
+      }
+    }
+
+  // the scan options that are recorded in the index file
+  unsigned char scanFlags = (this->ShowHidden != 0);
+  scanFlags |= (this->FollowSymlinks != 0) << 1;
+
+  // checkpoint long scans to the index file at a regular interval,
+  // so that an interrupted scan can be resumed instead of restarted
+  bool checkpointing = (useIndex && this->CheckpointInterval > 0);
+  time_t lastCheckpointTime = time(0);
 
   SeriesInfoList sortedFiles;
   SeriesInfoList::iterator li;
@@ -1097,6 +2763,11 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
   tableType dupcheck(numberOfStrings/4 + 1);
   std::vector<std::string> realnames;
   realnames.reserve(numberOfStrings);
+  std::vector<bool> trusted(numberOfStrings, false);
+
+  // Make a list of unique files to be scanned.
+  std::vector<vtkIdType> candidates;
+  candidates.reserve(numberOfStrings);
 
   for (vtkIdType j = 0; j < numberOfStrings; j++)
     {
@@ -1105,7 +2776,20 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     // Check to see if this file name has already appeared, this is
     // done with a hash table and is an O(n) check, which is better
     // than using std::map at O(n log n) or brute-force at O(n^2)
-    realnames.push_back(vtkDICOMFilePath(fileName).GetRealPath());
+    // (for files from directories that have not changed since an
+    // incremental rescan index was written, the real path was
+    // recorded in the index and does not have to be resolved again)
+    vtkDICOMDirectoryTrustedMap::const_iterator ti =
+      this->TrustedFiles->find(fileName);
+    if (ti != this->TrustedFiles->end())
+      {
+      realnames.push_back(ti->second);
+      trusted[j] = true;
+      }
+    else
+      {
+      realnames.push_back(vtkDICOMFilePath(fileName).GetRealPath());
+      }
     const std::string& realname = realnames.back();
     unsigned int hash = vtkDICOMDirectoryHashString(realname);
     hash = hash % dupcheck.size();
@@ -1123,44 +2807,281 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       continue;
       }
     row.push_back(j);
+    candidates.push_back(j);
+    }
+
+  vtkIdType numberOfCandidates =
+    static_cast<vtkIdType>(candidates.size());
+
+  // When scanning in parallel, the file headers are parsed in batches
+  // by a pool of worker threads, and then the grouping into series is
+  // done on this thread in the original file order, so that the sorted
+  // tables come out exactly the same as for a sequential scan.
+  bool parallel = (this->ParallelScan != 0 && numberOfCandidates > 1);
+  vtkIdType batchSize = numberOfCandidates;
+  std::vector<vtkDICOMDirectoryScanSlot> slots;
+  if (parallel)
+    {
+    batchSize = 1024;
+    batchSize = (batchSize < numberOfCandidates ?
+                 batchSize : numberOfCandidates);
+    slots.resize(batchSize);
+    }
+
+  for (vtkIdType batchStart = 0; batchStart < numberOfCandidates;
+       batchStart += batchSize)
+    {
+    vtkIdType batchEnd = batchStart + batchSize;
+    batchEnd = (batchEnd < numberOfCandidates ?
+                batchEnd : numberOfCandidates);
+
+    if (parallel)
+      {
+      // issue readahead hints for the whole batch up front, so that
+      // the kernel fetches the file heads from the storage device
+      // while the worker threads are busy parsing (files that will
+      // be served from the persistent index are skipped)
+      for (vtkIdType kk = batchStart; kk < batchEnd; kk++)
+        {
+        vtkIdType jj = candidates[kk];
+        if (!useIndex || !trusted[jj])
+          {
+          vtkDICOMFile::Prefetch(input->GetValue(jj).c_str(), 16384);
+          }
+        }
+
+      vtkDICOMDirectoryScanInfo info;
+      info.Directory = this;
+      info.Input = input;
+      info.Candidates = &candidates;
+      info.RealNames = &realnames;
+      info.Trusted = &trusted;
+      info.Slots = &slots;
+      info.Index = (useIndex ? &index : 0);
+      info.QueryMeta = (keepMeta ? 0 : query.GetPointer());
+      info.BuildTagFilters = useIndex;
+      info.BufferSize = (this->Query ? 4096 : 0);
+      info.BatchStart = batchStart;
+      info.BatchEnd = batchEnd;
+      info.NextIndex = batchStart;
+
+      vtkMultiThreader *threader = vtkMultiThreader::New();
+      if (this->NumberOfScanThreads > 0)
+        {
+        threader->SetNumberOfThreads(this->NumberOfScanThreads);
+        }
+      if (threader->GetNumberOfThreads() > batchEnd - batchStart)
+        {
+        threader->SetNumberOfThreads(
+          static_cast<int>(batchEnd - batchStart));
+        }
+      threader->SetSingleMethod(vtkDICOMDirectoryThreadScan, &info);
+      threader->SingleMethodExecute();
+      threader->Delete();
+      }
+
+    for (vtkIdType k = batchStart; k < batchEnd; k++)
+    {
+    vtkIdType j = candidates[k];
+    const std::string& fileName = input->GetValue(j);
+
+    bool isDICOM;
+    int accessCode = 0;
+    vtkSmartPointer<vtkDICOMMetaData> fileMetaHolder;
+    vtkDICOMMetaData *fileMeta = 0;
+    bool pixelDataFound = false;
+    bool fileQueryMatched = false;
+    unsigned long errorCode = 0;
+    int condition = vtkDICOMParser::NoCondition;
+    vtkTypeInt64 conditionOffset = 0;
+    vtkDICOMFile::Size fileSize = 0;
+    long long fileMTime = 0;
+    bool statOK = false;
+    vtkTypeInt64 pixelDataOffset = -1;
+    vtkTypeInt64 parsedFileSize = -1;
+    unsigned int digest = 0;
+    vtkTypeInt64 digestLength = 0;
+    std::vector<unsigned char> tagFilter;
+
+    if (parallel)
+      {
+      // take the scan results produced by the worker threads
+      vtkDICOMDirectoryScanSlot& slot = slots[k - batchStart];
+      isDICOM = slot.IsDICOM;
+      accessCode = slot.AccessCode;
+      fileMetaHolder = slot.Meta;
+      fileMeta = slot.Meta;
+      pixelDataFound = slot.PixelDataFound;
+      fileQueryMatched = slot.QueryMatched;
+      errorCode = slot.ErrorCode;
+      condition = slot.Condition;
+      conditionOffset = slot.ConditionOffset;
+      fileSize = slot.Size;
+      fileMTime = slot.MTime;
+      statOK = slot.StatOK;
+      pixelDataOffset = slot.PixelDataOffset;
+      parsedFileSize = slot.FileSize;
+      digest = slot.Digest;
+      digestLength = slot.DigestLength;
+      tagFilter.swap(slot.TagFilter);
+      }
+    else
+      {
+      bool fromIndex = false;
+      if (useIndex)
+        {
+        // files from directories that are unchanged since the index
+        // was written are known to be current without examining them
+        vtkDICOMDirectoryIndex::const_iterator ti;
+        if (trusted[j] &&
+            (ti = index.find(realnames[j])) != index.end())
+          {
+          fileSize = ti->second.Size;
+          fileMTime = ti->second.MTime;
+          statOK = true;
+          }
+        else
+          {
+          statOK = vtkDICOMFile::GetFileInfo(
+            fileName.c_str(), &fileSize, &fileMTime);
+          }
+        }
+      if (readFromIndex && statOK)
+        {
+        // use the entry from the persistent index, if it is current
+        vtkDICOMDirectoryIndex::const_iterator ei =
+          index.find(realnames[j]);
+        if (ei != index.end() && ei->second.Size == fileSize &&
+            ei->second.MTime == fileMTime)
+          {
+          isDICOM = ei->second.IsDICOM;
+          fromIndex = true;
+          if (isDICOM)
+            {
+            fileMetaHolder = ei->second.Meta;
+            fileMeta = ei->second.Meta;
+            pixelDataFound = ei->second.PixelDataFound;
+            fileQueryMatched = true;
+            digest = ei->second.Digest;
+            digestLength = ei->second.DigestLength;
+            tagFilter = ei->second.TagFilter;
+            }
+          }
+        }
+      if (!fromIndex)
+        {
+        isDICOM = vtkDICOMUtilities::IsDICOMFile(fileName.c_str());
+        if (!isDICOM)
+          {
+          accessCode =
+            vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+          }
+        else
+          {
+          // Read the file metadata
+          if (useIndex || keepMeta)
+            {
+            // each file needs its own metadata when building the
+            // index or when the metadata is kept for the reader
+            fileMetaHolder = vtkSmartPointer<vtkDICOMMetaData>::New();
+            fileMeta = fileMetaHolder;
+            parser->SetMetaData(fileMeta);
+            }
+          else
+            {
+            meta->Initialize();
+            fileMeta = meta;
+            }
+          this->SetInternalFileName(fileName.c_str());
+          parser->SetFileName(fileName.c_str());
+          if (useIndex)
+            {
+            // build a tag presence filter for the persistent index,
+            // and fold a content digest into the bytes that are read
+            tagFilter.assign(vtkDICOMParser::TagFilterSize, 0);
+            parser->SetTagFilterBuffer(&tagFilter[0]);
+            parser->ComputeDigestOn();
+            }
+          parser->Update();
+          parser->SetTagFilterBuffer(0);
+          pixelDataFound = parser->GetPixelDataFound();
+          fileQueryMatched = parser->GetQueryMatched();
+          errorCode = parser->GetErrorCode();
+          condition = parser->GetCondition(0);
+          conditionOffset = parser->GetConditionOffset(0);
+          pixelDataOffset = parser->GetFileOffset();
+          parsedFileSize = parser->GetFileSize();
+          digest = parser->GetDigest();
+          digestLength = parser->GetDigestLength();
+          }
+        }
+      }
 
     // Skip anything that does not look like a DICOM file.
-    if (!vtkDICOMUtilities::IsDICOMFile(fileName.c_str()))
+    if (!isDICOM)
       {
-      int code = vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
-      if (code == vtkDICOMFile::FileNotFound)
+      // Record the verdict, so that a rescan with the same index
+      // will not have to open the file at all.
+      if (useIndex && statOK && accessCode == 0)
+        {
+        vtkDICOMDirectoryIndexEntry& entry = newIndex[realnames[j]];
+        entry.Size = fileSize;
+        entry.MTime = fileMTime;
+        entry.IsDICOM = false;
+        entry.PixelDataFound = false;
+        entry.Digest = 0;
+        entry.DigestLength = 0;
+        }
+      if (accessCode == vtkDICOMFile::FileNotFound)
         {
         vtkWarningMacro("File does not exist: " << fileName.c_str());
         }
-      else if (code == vtkDICOMFile::AccessDenied)
+      else if (accessCode == vtkDICOMFile::AccessDenied)
         {
         vtkWarningMacro("File permission denied: " << fileName.c_str());
         }
-      else if (code == vtkDICOMFile::FileIsDirectory)
+      else if (accessCode == vtkDICOMFile::FileIsDirectory)
         {
         vtkWarningMacro("File is a directory: " << fileName.c_str());
         }
-      else if (code == vtkDICOMFile::ImpossiblePath)
+      else if (accessCode == vtkDICOMFile::ImpossiblePath)
         {
         vtkWarningMacro("Bad file path: " << fileName.c_str());
         }
-      else if (code != 0)
+      else if (accessCode != 0)
         {
         vtkWarningMacro("Unknown file error: " << fileName.c_str());
         }
       continue;
       }
 
-    // Read the file metadata
-    meta->Initialize();
-    this->SetInternalFileName(fileName.c_str());
-    parser->SetFileName(fileName.c_str());
-    parser->Update();
-    if (!parser->GetPixelDataFound())
+    // Record this file for the index that is written after the scan.
+    if (useIndex && statOK && errorCode == 0 && fileMeta != 0)
+      {
+      vtkDICOMDirectoryIndexEntry& entry = newIndex[realnames[j]];
+      entry.Size = fileSize;
+      entry.MTime = fileMTime;
+      entry.IsDICOM = true;
+      entry.PixelDataFound = pixelDataFound;
+      entry.Meta = fileMeta;
+      entry.Digest = digest;
+      entry.DigestLength = digestLength;
+      entry.TagFilter.swap(tagFilter);
+      }
+
+    if (!pixelDataFound)
       {
       if (!this->ErrorCode)
         {
-        this->ErrorCode = parser->GetErrorCode();
+        this->ErrorCode = errorCode;
+        if (condition != vtkDICOMParser::NoCondition)
+          {
+          // render the deferred parse error for the failed file
+          this->SetInternalFileName(fileName.c_str());
+          vtkErrorMacro("At byte offset " << conditionOffset
+                        << " in file " << fileName.c_str() << ": "
+                        << vtkDICOMParser::GetConditionText(condition));
+          }
         }
       if (this->ErrorCode || this->RequirePixelData)
         {
@@ -1171,7 +3092,7 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     // Check for abort and update progress at 1% intervals
     if (!this->AbortExecute)
       {
-      double progress = (j + 1.0)/numberOfStrings;
+      double progress = (k + 1.0)/numberOfCandidates;
       if (progress == 1.0 || progress > this->GetProgress() + 0.01)
         {
         progress = static_cast<int>(progress*100.0)/100.0;
@@ -1180,11 +3101,36 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       }
     if (this->AbortExecute)
       {
+      // save the completed work so that the scan can be resumed
+      if (checkpointing)
+        {
+        vtkDICOMDirectoryWriteCheckpoint(
+          this->IndexFileName, index, newIndex, *this->NewDirIndex,
+          this->FilePattern, scanFlags);
+        }
       return;
       }
 
+    // Checkpoint the scan when the interval has elapsed
+    if (checkpointing && (k & 0xff) == 0xff)
+      {
+      time_t now = time(0);
+      if (now - lastCheckpointTime >= this->CheckpointInterval)
+        {
+        lastCheckpointTime = now;
+        if (!vtkDICOMDirectoryWriteCheckpoint(
+              this->IndexFileName, index, newIndex, *this->NewDirIndex,
+              this->FilePattern, scanFlags))
+          {
+          vtkWarningMacro("Unable to write index file: "
+                          << this->IndexFileName);
+          checkpointing = false;
+          }
+        }
+      }
+
     // Check if the file matches the query
-    bool queryMatched = (!this->Query || parser->GetQueryMatched());
+    bool queryMatched = (!this->Query || fileQueryMatched);
     if (!queryMatched && this->FindLevel == vtkDICOMDirectory::IMAGE)
       {
       continue;
@@ -1193,23 +3139,29 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     // Insert the file into the sorted list
     FileInfo fileInfo;
     fileInfo.InstanceNumber =
-      meta->GetAttributeValue(DC::InstanceNumber).AsUnsignedInt();
+      fileMeta->GetAttributeValue(DC::InstanceNumber).AsUnsignedInt();
     fileInfo.FileName = fileName.c_str(); // stored in input StringArray
+    fileInfo.PixelDataOffset = pixelDataOffset;
+    fileInfo.FileSize = parsedFileSize;
+    if (keepMeta)
+      {
+      fileInfo.Meta = fileMetaHolder;
+      }
 
     const vtkDICOMValue& patientNameValue =
-      meta->GetAttributeValue(DC::PatientName);
+      fileMeta->GetAttributeValue(DC::PatientName);
     const vtkDICOMValue& patientIDValue =
-      meta->GetAttributeValue(DC::PatientID);
+      fileMeta->GetAttributeValue(DC::PatientID);
     const vtkDICOMValue& studyDateValue =
-      meta->GetAttributeValue(DC::StudyDate);
+      fileMeta->GetAttributeValue(DC::StudyDate);
     const vtkDICOMValue& studyTimeValue =
-      meta->GetAttributeValue(DC::StudyTime);
+      fileMeta->GetAttributeValue(DC::StudyTime);
     const vtkDICOMValue& studyUIDValue =
-      meta->GetAttributeValue(DC::StudyInstanceUID);
+      fileMeta->GetAttributeValue(DC::StudyInstanceUID);
     const vtkDICOMValue& seriesUIDValue =
-      meta->GetAttributeValue(DC::SeriesInstanceUID);
+      fileMeta->GetAttributeValue(DC::SeriesInstanceUID);
     unsigned int seriesNumber =
-      meta->GetAttributeValue(DC::SeriesNumber).AsUnsignedInt();
+      fileMeta->GetAttributeValue(DC::SeriesNumber).AsUnsignedInt();
 
     const char *patientName = patientNameValue.GetCharData();
     const char *patientID = patientIDValue.GetCharData();
@@ -1277,7 +3229,7 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
           li->Files.insert(
             std::upper_bound(li->Files.begin(), li->Files.end(), fileInfo,
               CompareInstance), fileInfo);
-        this->FillImageRecord(&pos->ImageRecord, meta);
+        this->FillImageRecord(&pos->ImageRecord, fileMeta);
         li->QueryMatched |= queryMatched;
         foundSeries = true;
         break;
@@ -1299,10 +3251,23 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       li->SeriesNumber = seriesNumber;
       li->Files.push_back(fileInfo);
       li->QueryMatched = queryMatched;
-      this->FillPatientRecord(&li->PatientRecord, meta);
-      this->FillStudyRecord(&li->StudyRecord, meta);
-      this->FillSeriesRecord(&li->SeriesRecord, meta);
-      this->FillImageRecord(&li->Files.back().ImageRecord, meta);
+      this->FillPatientRecord(&li->PatientRecord, fileMeta);
+      this->FillStudyRecord(&li->StudyRecord, fileMeta);
+      this->FillSeriesRecord(&li->SeriesRecord, fileMeta);
+      this->FillImageRecord(&li->Files.back().ImageRecord, fileMeta);
+      }
+    }
+    }
+
+  // Rewrite the persistent index to reflect this scan.
+  if (useIndex && !this->AbortExecute)
+    {
+    if (!vtkDICOMDirectoryWriteIndex(this->IndexFileName, newIndex,
+                                     *this->NewDirIndex,
+                                     this->FilePattern, scanFlags))
+      {
+      vtkWarningMacro("Unable to write index file: "
+                      << this->IndexFileName);
       }
     }
 
@@ -1337,14 +3302,29 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     vtkIdType n = static_cast<vtkIdType>(v.Files.size());
     sa->SetNumberOfValues(n);
     std::vector<const vtkDICOMItem *> imageRecords(n);
+    std::vector<vtkDICOMMetaData *> fileMetas;
+    std::vector<vtkTypeInt64> fileOffsets;
+    if (keepMeta)
+      {
+      fileMetas.resize(n);
+      fileOffsets.resize(2*n);
+      }
     for (vtkIdType i = 0; i < n; i++)
       {
       sa->SetValue(i, v.Files[i].FileName);
       imageRecords[i] = &v.Files[i].ImageRecord;
+      if (keepMeta)
+        {
+        fileMetas[i] = v.Files[i].Meta;
+        fileOffsets[2*i] = v.Files[i].PixelDataOffset;
+        fileOffsets[2*i + 1] = v.Files[i].FileSize;
+        }
       }
     this->AddSeriesFileNames(
       patientCount-1, studyCount-1, sa,
-      v.PatientRecord, v.StudyRecord, v.SeriesRecord, &imageRecords[0]);
+      v.PatientRecord, v.StudyRecord, v.SeriesRecord, &imageRecords[0],
+      (keepMeta ? &fileMetas[0] : 0),
+      (keepMeta ? &fileOffsets[0] : 0));
     }
 }
 
@@ -2047,6 +4027,38 @@ void vtkDICOMDirectory::ProcessDirectory(
     return;
     }
 
+  // For an incremental rescan, check whether the directory has been
+  // modified since its listing was recorded in the index.  If it has
+  // not, then the recorded listing is used: the files are added as
+  // candidates whose index entries are known to be current, and the
+  // recorded subdirectories are visited in the usual way so that any
+  // changes deeper in the tree are still found.
+  long long dirMTime = 0;
+  bool dirMTimeOK = false;
+  if (this->IndexDirectories)
+    {
+    dirMTimeOK = vtkDICOMFile::GetDirectoryInfo(dirname, &dirMTime);
+    vtkDICOMDirectoryDirIndex::const_iterator di =
+      this->DirIndex->find(realname);
+    if (dirMTimeOK && di != this->DirIndex->end() &&
+        di->second.Depth == depth && di->second.MTime == dirMTime)
+      {
+      const vtkDICOMDirectoryDirEntry& entry = di->second;
+      for (size_t i = 0; i < entry.Files.size(); i++)
+        {
+        files->InsertNextValue(entry.Files[i].first);
+        (*this->TrustedFiles)[entry.Files[i].first] =
+          entry.Files[i].second;
+        }
+      (*this->NewDirIndex)[realname] = entry;
+      for (size_t i = 0; i < entry.Subdirs.size(); i++)
+        {
+        this->ProcessDirectory(entry.Subdirs[i].c_str(), depth-1, files);
+        }
+      return;
+      }
+    }
+
   vtkDICOMFileDirectory d(dirname);
   if (d.GetError() != 0)
     {
@@ -2059,6 +4071,18 @@ void vtkDICOMDirectory::ProcessDirectory(
       }
     }
 
+  // Record the listing for the next incremental rescan.  The
+  // modification time was taken before the directory was listed, so
+  // that a concurrent change makes the record look stale rather than
+  // current.
+  vtkDICOMDirectoryDirEntry *entry = 0;
+  if (this->IndexDirectories && dirMTimeOK && d.GetError() == 0)
+    {
+    entry = &(*this->NewDirIndex)[realname];
+    entry->MTime = dirMTime;
+    entry->Depth = depth;
+    }
+
   int n = d.GetNumberOfFiles();
   for (int i = 0; i < n; i++)
     {
@@ -2087,6 +4111,10 @@ void vtkDICOMDirectory::ProcessDirectory(
         {
         if (depth > 1)
           {
+          if (entry)
+            {
+            entry->Subdirs.push_back(fileString);
+            }
           this->ProcessDirectory(fileString.c_str(), depth-1, files);
           }
         }
@@ -2094,6 +4122,11 @@ void vtkDICOMDirectory::ProcessDirectory(
                vtkDICOMUtilities::PatternMatches(
                  this->FilePattern, fileString.c_str()))
         {
+        if (entry)
+          {
+          entry->Files.push_back(std::make_pair(
+            fileString, vtkDICOMFilePath(fileString).GetRealPath()));
+          }
         files->InsertNextValue(fileString);
         }
       }
@@ -2103,6 +4136,13 @@ void vtkDICOMDirectory::ProcessDirectory(
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::Execute()
 {
+  // Withdraw from the memory governor before clearing the output
+  if (this->MemoryClient)
+    {
+    vtkDICOMMemoryGovernor::RemoveClient(this->MemoryClient);
+    this->MemoryClient = 0;
+    }
+
   // Clear the output
   this->Series->clear();
   this->Studies->clear();
@@ -2112,6 +4152,31 @@ void vtkDICOMDirectory::Execute()
   this->FileSetID = 0;
   this->ErrorCode = 0;
 
+  // prepare the query for fast repeated evaluation
+  this->CompileQuery();
+
+  // for an incremental rescan, load the directory records from the
+  // index so that unchanged directories do not have to be listed
+  // again (the file records are loaded later, by SortFiles)
+  this->DirIndex->clear();
+  this->NewDirIndex->clear();
+  this->TrustedFiles->clear();
+  this->IndexDirectories =
+    (this->IncrementalRescan != 0 &&
+     this->IndexFileName != 0 && this->IndexFileName[0] != '\0' &&
+     this->Query == 0 && this->KeepFileMetaData == 0);
+  if (this->IndexDirectories)
+    {
+    unsigned char scanFlags = (this->ShowHidden != 0);
+    scanFlags |= (this->FollowSymlinks != 0) << 1;
+    if (!vtkDICOMDirectoryReadIndex(this->IndexFileName, 0,
+                                    this->DirIndex,
+                                    this->FilePattern, scanFlags))
+      {
+      this->DirIndex->clear();
+      }
+    }
+
   this->InvokeEvent(vtkCommand::StartEvent);
 
   vtkSmartPointer<vtkStringArray> files =
@@ -2125,7 +4190,20 @@ void vtkDICOMDirectory::Execute()
       int code = vtkDICOMFile::Access(fname.c_str(), vtkDICOMFile::In);
       if (code == vtkDICOMFile::FileIsDirectory)
         {
+        double profileStart = 0.0;
+        vtkIdType profileFiles = 0;
+        if (vtkDICOMProfiler::GetEnabled())
+          {
+          profileStart = vtkDICOMProfiler::StartPhase();
+          profileFiles = files->GetNumberOfValues();
+          }
         this->ProcessDirectory(fname.c_str(), this->ScanDepth, files);
+        if (vtkDICOMProfiler::GetEnabled())
+          {
+          vtkDICOMProfiler::EndPhase(
+            this, vtkDICOMProfiler::DirectoryScan, profileStart,
+            files->GetNumberOfValues() - profileFiles);
+          }
         }
       else if (code == vtkDICOMFile::FileNotFound)
         {
@@ -2174,7 +4252,18 @@ void vtkDICOMDirectory::Execute()
     int code = vtkDICOMFile::Access(this->DirectoryName, vtkDICOMFile::In);
     if (code == vtkDICOMFile::FileIsDirectory)
       {
+      double profileStart = 0.0;
+      if (vtkDICOMProfiler::GetEnabled())
+        {
+        profileStart = vtkDICOMProfiler::StartPhase();
+        }
       this->ProcessDirectory(this->DirectoryName, this->ScanDepth, files);
+      if (vtkDICOMProfiler::GetEnabled())
+        {
+        vtkDICOMProfiler::EndPhase(
+          this, vtkDICOMProfiler::DirectoryScan, profileStart,
+          files->GetNumberOfValues());
+        }
       }
     else if (code == vtkDICOMFile::FileNotFound)
       {
@@ -2223,6 +4312,9 @@ void vtkDICOMDirectory::Execute()
     this->SortFiles(files);
     }
 
+  // register the kept metadata with the memory governor
+  this->AccountMetaData();
+
   this->InvokeEvent(vtkCommand::EndEvent);
 }
 
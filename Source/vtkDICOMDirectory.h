@@ -16,11 +16,16 @@
 
 #include <vtkAlgorithm.h>
 #include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMTag.h" // For method parameter
 
 class vtkStringArray;
 class vtkIntArray;
+class vtkTypeInt64Array;
 class vtkDICOMMetaData;
 class vtkDICOMItem;
+class vtkDICOMDirectoryDirIndex;
+class vtkDICOMDirectoryTrustedMap;
+class vtkSimpleCriticalSection;
 
 //! Get information about all DICOM files within a directory.
 /*!
@@ -41,6 +46,14 @@ public:
     PATIENT, STUDY, SERIES, IMAGE, FRAME
   };
 
+  //! The event that is invoked when Streaming is on.
+  /*!
+   *  The value is vtkCommand::UserEvent plus one.
+   */
+  enum {
+    SeriesAddedEvent = 1001
+  };
+
   //@{
   //! Set the input directory.
   /*!
@@ -176,6 +189,19 @@ public:
    *  and InstanceNumber for each file.
    */
   vtkDICOMMetaData *GetMetaDataForSeries(int i);
+
+  //! Get the pixel data offsets for the files in a series.
+  /*!
+   *  The returned array has one tuple per file, where the first
+   *  component is the offset of the pixel data within the file and
+   *  the second component is the file size.  The offsets are only
+   *  recorded when the scan is done with KeepFileMetaData on, so
+   *  this method returns a null pointer otherwise.  Together with
+   *  GetMetaDataForSeries(), the array can be given to a reader
+   *  with vtkDICOMReader::SetPreParsedData(), so that the reader
+   *  does not have to parse the file headers a second time.
+   */
+  vtkTypeInt64Array *GetFileOffsetsForSeries(int i);
   //@}
 
   //@{
@@ -217,6 +243,219 @@ public:
   int GetShowHidden() { return this->ShowHidden; }
   //@}
 
+  //@{
+  //! Build the tables from DICOMDIR records alone (default: off).
+  /*!
+   *  When a DICOMDIR file is present, the patient, study, and series
+   *  tables are built from its directory records, but if a find query
+   *  has been set, then any query attributes that are absent from the
+   *  records are checked by reading the referenced files themselves.
+   *  When this option is on, the records are trusted and none of the
+   *  referenced files are opened during the scan: query attributes
+   *  that cannot be checked against the records are assumed to match.
+   *  This makes browsing DICOMDIR-indexed media such as CDs and DVDs
+   *  nearly instantaneous, at the cost of deferring the validation of
+   *  the referenced files until they are actually read.
+   */
+  vtkSetMacro(TrustDICOMDIR, int);
+  vtkBooleanMacro(TrustDICOMDIR, int);
+  int GetTrustDICOMDIR() { return this->TrustDICOMDIR; }
+  //@}
+
+  //@{
+  //! Set a file to use as a persistent index for rescans.
+  /*!
+   *  If an index file is set, it will be loaded before the scan, and
+   *  any scanned file whose size and modification time match its entry
+   *  in the index will not be re-parsed; the attributes stored in the
+   *  index are used instead.  Files that were found to not be DICOM
+   *  are also recorded, so that a rescan will not even open them.
+   *  After the scan, the index is rewritten
+   *  with an entry for every file that was scanned.  The index is
+   *  neither consulted nor updated when a find query has been set,
+   *  since the stored attributes cannot be matched against a query.
+   */
+  void SetIndexFileName(const char *name);
+  const char *GetIndexFileName() { return this->IndexFileName; }
+  //@}
+
+  //@{
+  //! Skip directories that have not changed since the last scan
+  //! (default: off).
+  /*!
+   *  This option requires an index file (see SetIndexFileName).  When
+   *  it is on, the index also records the modification time of every
+   *  directory that is visited, along with the listing that the visit
+   *  produced.  On a rescan, a directory whose modification time has
+   *  not changed is not listed again: the recorded listing is used,
+   *  and the files within it are not even examined, since their index
+   *  entries are known to be current.  This makes the cost of a
+   *  rescan proportional to the number of new files rather than to
+   *  the size of the archive, so directories that continuously
+   *  receive files from a modality can be rescanned frequently.  A
+   *  file that is rewritten in place, without any directory entry
+   *  being added, removed, or renamed, will not be detected; files
+   *  in a DICOM archive are not normally modified in this way.
+   */
+  vtkSetMacro(IncrementalRescan, int);
+  vtkBooleanMacro(IncrementalRescan, int);
+  int GetIncrementalRescan() { return this->IncrementalRescan; }
+  //@}
+
+  //@{
+  //! Periodically checkpoint a long scan to the index file.
+  /*!
+   *  This option requires an index file (see SetIndexFileName).
+   *  When a positive interval (in seconds) is set, the partial
+   *  results of the scan are written to the index file at roughly
+   *  that interval, and also when the scan is aborted.  If a long
+   *  scan is interrupted or killed, running it again with the same
+   *  index file resumes from the last checkpoint, because the files
+   *  that were already examined are loaded from the index instead of
+   *  being parsed again.  Index entries from before the scan are
+   *  carried through each checkpoint, so an interrupted rescan
+   *  cannot lose them.  The default is zero, for no checkpoints.
+   */
+  vtkSetMacro(CheckpointInterval, int);
+  vtkGetMacro(CheckpointInterval, int);
+  //@}
+
+  //@{
+  //! Look up files in a persistent index via its secondary indexes.
+  /*!
+   *  The index file (see SetIndexFileName) ends with sorted
+   *  projections over PatientID, StudyDate, Modality, and
+   *  SeriesInstanceUID, so selective queries on these attributes can
+   *  be answered directly from the index without walking the
+   *  directory tree or loading the per-file attributes.  The tag must
+   *  be one of the four indexed attributes, and matching is exact,
+   *  except that StudyDate also accepts a range in the DICOM query
+   *  form "YYYYMMDD-YYYYMMDD" (either end may be omitted).  The
+   *  paths of the matching files are appended to the supplied array.
+   *  The return value is false if the index file cannot be read or
+   *  does not contain a secondary index for the requested tag.
+   */
+  static bool QueryIndexFile(
+    const char *fname, vtkDICOMTag tag, const char *value,
+    vtkStringArray *paths);
+
+  //! Find the files in a persistent index that may contain a tag.
+  /*!
+   *  Every file record in the index carries a compact tag presence
+   *  filter (a Bloom filter over the element tags that the scan saw
+   *  in the file), so the files that might contain any given tag,
+   *  including private tags, can be found without opening a single
+   *  file.  The paths of the candidate files are appended to the
+   *  supplied array: files whose filters rule the tag out are
+   *  certainly free of it, while the candidates may include a small
+   *  fraction of false positives, so the caller should parse the
+   *  candidates to confirm the match.  For a private tag, all of the
+   *  blocks that the tag could be stored under are tested, since the
+   *  block assignment can vary from file to file.  The return value
+   *  is false if the index file cannot be read.
+   */
+  static bool QueryIndexFileForTag(
+    const char *fname, vtkDICOMTag tag, vtkStringArray *paths);
+
+  //! Find which of the given files are already in a persistent index.
+  /*!
+   *  Every file record in the index carries a digest (a CRC-32C) of
+   *  the bytes that the scan read from the file, computed as a side
+   *  effect of the parse, so a file that is re-sent to an archive
+   *  can be recognized without being parsed, copied, or re-indexed.
+   *  For each candidate file, the file size is compared against the
+   *  indexed sizes first, and only when a size matches is the
+   *  candidate opened, to fold a digest over the same byte range
+   *  that the indexed digest covers.  The paths of the candidates
+   *  whose size and digest match an indexed file are appended to
+   *  the "duplicates" array.  A match makes the candidate an
+   *  overwhelmingly likely duplicate, but the digest covers only
+   *  the bytes that the scan read (normally everything up to the
+   *  PixelData), so a caller that needs certainty should confirm by
+   *  comparing the matched files.  The return value is false if the
+   *  index file cannot be read.
+   */
+  static bool QueryIndexFileForDuplicates(
+    const char *fname, vtkStringArray *candidates,
+    vtkStringArray *duplicates);
+  //@}
+
+  //@{
+  //! Scan the file metadata with multiple threads (default: off).
+  /*!
+   *  When this is on, the headers of the files that are found during
+   *  the scan will be parsed by a pool of worker threads, where each
+   *  worker owns its own vtkDICOMParser.  The sorted series tables
+   *  that are produced are identical to the ones that are produced
+   *  by a sequential scan.
+   */
+  vtkSetMacro(ParallelScan, int);
+  vtkBooleanMacro(ParallelScan, int);
+  int GetParallelScan() { return this->ParallelScan; }
+  //@}
+
+  //@{
+  //! The number of threads to use for a parallel scan.
+  /*!
+   *  The default is zero, which means one thread per processor core.
+   */
+  vtkSetMacro(NumberOfScanThreads, int);
+  int GetNumberOfScanThreads() { return this->NumberOfScanThreads; }
+  //@}
+
+  //@{
+  //! Report each series as soon as it has been scanned (default: off).
+  /*!
+   *  When this is on, a SeriesAddedEvent is invoked as soon as each
+   *  series has been scanned and sorted.  The observer can retrieve
+   *  the information about the series with the usual Get methods,
+   *  where the index of the new series is GetNumberOfSeries() minus
+   *  one.  After the observers have returned, the file names, records
+   *  and meta data of the series are discarded so that the memory use
+   *  of the scan stays bounded no matter how large the archive is.
+   */
+  vtkSetMacro(Streaming, int);
+  vtkBooleanMacro(Streaming, int);
+  int GetStreaming() { return this->Streaming; }
+  //@}
+
+  //@{
+  //! Keep the complete metadata of every scanned file (default: off).
+  /*!
+   *  When this is on, and no find query has been set, the scan stores
+   *  the entire header of each file instead of just the attributes
+   *  that are needed to sort the files, and GetMetaDataForSeries()
+   *  then provides the complete metadata of every file in the series.
+   *  Along with the offsets from GetFileOffsetsForSeries(), it can be
+   *  handed to vtkDICOMReader::SetPreParsedData() so that opening a
+   *  series does not re-parse headers that the scan has already read.
+   *  The persistent index is neither consulted nor updated when this
+   *  option is on, since the index does not store complete headers.
+   */
+  vtkSetMacro(KeepFileMetaData, int);
+  vtkBooleanMacro(KeepFileMetaData, int);
+  int GetKeepFileMetaData() { return this->KeepFileMetaData; }
+  //@}
+
+  //@{
+  //! Let kept metadata be released under memory pressure (default: off).
+  /*!
+   *  When this is on together with KeepFileMetaData, the metadata that
+   *  is retained for each series is registered with the library-wide
+   *  memory budget (see vtkDICOMMemoryGovernor).  If the budget is
+   *  exceeded, the metadata of the series that were least recently
+   *  accessed through GetMetaDataForSeries() is released, and is
+   *  transparently re-read from the files of the series if it is
+   *  accessed again.  Since the release can occur on whatever thread
+   *  exceeded the budget, a caller must take a reference to the object
+   *  returned by GetMetaDataForSeries() before doing anything else
+   *  that might allocate memory.
+   */
+  vtkSetMacro(MetaDataSpilling, int);
+  vtkBooleanMacro(MetaDataSpilling, int);
+  int GetMetaDataSpilling() { return this->MetaDataSpilling; }
+  //@}
+
 protected:
   vtkDICOMDirectory();
   ~vtkDICOMDirectory();
@@ -224,10 +463,26 @@ protected:
   const char *DirectoryName;
   vtkStringArray *InputFileNames;
   const char *FilePattern;
+  const char *IndexFileName;
   int RequirePixelData;
   int FollowSymlinks;
   int ShowHidden;
+  int TrustDICOMDIR;
   int ScanDepth;
+  int ParallelScan;
+  int NumberOfScanThreads;
+  int Streaming;
+  int KeepFileMetaData;
+  int MetaDataSpilling;
+  int IncrementalRescan;
+  int CheckpointInterval;
+
+  //! For MetaDataSpilling: the handle from vtkDICOMMemoryGovernor, a
+  //! clock for finding the least recently accessed series, and a lock
+  //! that guards the series metadata against the release callback.
+  void *MemoryClient;
+  unsigned int MetaClock;
+  vtkSimpleCriticalSection *MetaSpillLock;
 
   vtkTimeStamp UpdateTime;
   char *InternalFileName;
@@ -255,14 +510,19 @@ protected:
    *  This method is called from SortFiles to provide the files
    *  that make up one series.  The study that the files belong
    *  to must also be provided, as a number that starts at zero
-   *  and monotonically increases.
+   *  and monotonically increases.  If the scan kept the complete
+   *  metadata of the files, then it is passed via fileMetas, along
+   *  with the pixel data offset and file size of each file packed
+   *  pairwise into fileOffsets.
    */
   void AddSeriesFileNames(
     int patient, int study, vtkStringArray *files,
     const vtkDICOMItem& patientRecord,
     const vtkDICOMItem& studyRecord,
     const vtkDICOMItem& seriesRecord,
-    const vtkDICOMItem *imageRecords[]);
+    const vtkDICOMItem *imageRecords[],
+    vtkDICOMMetaData *fileMetas[] = 0,
+    const vtkTypeInt64 *fileOffsets = 0);
 
   //! Add files only if they match the query.
   void AddSeriesWithQuery(
@@ -272,6 +532,16 @@ protected:
     const vtkDICOMItem& seriesRecord,
     const vtkDICOMItem *imageRecords[]);
 
+  //! Compile the query for fast repeated evaluation.
+  /*!
+   *  This resolves the query into a flat list of elements, converts
+   *  the query strings to utf-8, folds the case of person names, and
+   *  orders the elements so that the cheapest and most selective
+   *  comparisons are performed first.  It must be called before
+   *  MatchesQuery() or MatchesImageQuery() can be used.
+   */
+  void CompileQuery();
+
   //! Returns false if the record doesn't match the query.
   /*!
    *  Matching values are placed into the result parameter.
@@ -320,6 +590,16 @@ protected:
   void CopyRecord(
     vtkDICOMMetaData *meta, const vtkDICOMItem *item, int instance);
 
+  //! Register the kept series metadata with the memory governor.
+  /*!
+   *  Called at the end of the scan.  Does nothing unless both
+   *  KeepFileMetaData and MetaDataSpilling are on.
+   */
+  void AccountMetaData();
+
+  //! The release callback for vtkDICOMMemoryGovernor.
+  static void ReleaseMetaData(void *data, vtkTypeInt64 bytes);
+
 private:
   vtkDICOMDirectory(const vtkDICOMDirectory&);  // Not implemented.
   void operator=(const vtkDICOMDirectory&);  // Not implemented.
@@ -334,8 +614,11 @@ private:
   struct SeriesInfo;
   class SeriesInfoList;
   class VisitedVector;
+  struct QueryElement;
+  class QueryElementVector;
 
   vtkDICOMItem *Query;
+  QueryElementVector *CompiledQuery;
   int FindLevel;
   SeriesVector *Series;
   StudyVector *Studies;
@@ -344,8 +627,21 @@ private:
   char *FileSetID;
   bool UsingOsirixDatabase;
 
+  //! The directory records for incremental rescans: the records that
+  //! were loaded from the index, the records for the index that will
+  //! be written after the scan, and the files whose index entries can
+  //! be used without examining the files themselves.
+  vtkDICOMDirectoryDirIndex *DirIndex;
+  vtkDICOMDirectoryDirIndex *NewDirIndex;
+  vtkDICOMDirectoryTrustedMap *TrustedFiles;
+  bool IndexDirectories;
+
   //! Compare FileInfo entries by instance number
   static bool CompareInstance(const FileInfo &fi1, const FileInfo &fi2);
+
+  //! Compare QueryElement entries by evaluation cost
+  static bool CompareQueryElement(
+    const QueryElement &e1, const QueryElement &e2);
 };
 
 #endif
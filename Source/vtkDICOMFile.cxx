@@ -15,12 +15,19 @@
 #include "vtkDICOMFile.h"
 #include "vtkDICOMFilePath.h"
 
+#include <vtkSimpleCriticalSection.h>
+
 #if defined(VTK_DICOM_POSIX_IO)
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 #elif defined(VTK_DICOM_WIN32_IO)
 #include <windows.h>
 #else
@@ -40,6 +47,25 @@
 //----------------------------------------------------------------------------
 vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
 {
+  this->Open(filename, mode, NoHint);
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode, Hint hint)
+{
+  this->Open(filename, mode, hint);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Open(const char *filename, Mode mode, Hint hint)
+{
+  this->MapAddress = 0;
+  this->MapLength = 0;
+  this->IOPriority = PriorityInteractive;
+#if defined(VTK_DICOM_WIN32_IO)
+  this->MapHandle = 0;
+#endif
+
 #if defined(VTK_DICOM_POSIX_IO)
   this->Handle = -1;
   this->Error = 0;
@@ -83,6 +109,21 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
       this->Error = UnknownError;
       }
     }
+#if defined(POSIX_FADV_SEQUENTIAL)
+  else if (mode == In && hint != NoHint)
+    {
+    // tell the kernel how the file will be read, so that it can
+    // tune its readahead accordingly; this is advisory only, so
+    // any failure can be safely ignored
+    posix_fadvise(this->Handle, 0, 0, POSIX_FADV_SEQUENTIAL);
+    if (hint == WholeFile)
+      {
+      posix_fadvise(this->Handle, 0, 0, POSIX_FADV_WILLNEED);
+      }
+    }
+#else
+  (void)hint;
+#endif
 #elif defined(VTK_DICOM_WIN32_IO)
   this->Handle = INVALID_HANDLE_VALUE;
   this->Error = 0;
@@ -94,9 +135,15 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
     {
     if (mode == In)
       {
+      // pass the access pattern hint as a flag when opening the file
+      DWORD flags = FILE_ATTRIBUTE_NORMAL;
+      if (hint != NoHint)
+        {
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        }
       this->Handle = CreateFileW(wideFilename,
         GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
-        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        NULL, OPEN_EXISTING, flags, NULL);
       }
     else if (mode == Out)
       {
@@ -144,6 +191,7 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
   this->Handle = 0;
   this->Error = 0;
   this->Eof = false;
+  (void)hint;
 
   if (mode == In)
     {
@@ -169,6 +217,7 @@ vtkDICOMFile::~vtkDICOMFile()
 //----------------------------------------------------------------------------
 void vtkDICOMFile::Close()
 {
+  this->Unmap();
 #if defined(VTK_DICOM_POSIX_IO)
   if (this->Handle)
     {
@@ -194,9 +243,139 @@ void vtkDICOMFile::Close()
 #endif
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// the process-wide state for scheduling reads between priorities
+vtkSimpleCriticalSection vtkDICOMFileSchedLock;
+int vtkDICOMFileInteractiveReads = 0;    // guarded by SchedLock
+double vtkDICOMFileBackgroundRate = 0.0; // guarded by SchedLock
+double vtkDICOMFileTokenBytes = 0.0;     // guarded by SchedLock
+double vtkDICOMFileTokenTime = 0.0;      // guarded by SchedLock
+
+// a monotonic clock, in seconds
+double vtkDICOMFileSchedClock()
+{
+#if defined(_WIN32)
+  return GetTickCount64()/1000.0;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+#endif
+}
+
+// sleep briefly while waiting for an interactive read or for tokens
+void vtkDICOMFileSchedSleep()
+{
+#if defined(_WIN32)
+  Sleep(1);
+#else
+  struct timespec ts = { 0, 1000000 }; // one millisecond
+  nanosleep(&ts, 0);
+#endif
+}
+
+// hold a scheduling slot for the duration of one read: interactive
+// reads register themselves, background reads wait until there is no
+// interactive read in progress and then draw from the token bucket
+class vtkDICOMFileReadSlot
+{
+public:
+  vtkDICOMFileReadSlot(int priority, size_t len);
+  ~vtkDICOMFileReadSlot();
+private:
+  int Priority;
+};
+
+vtkDICOMFileReadSlot::vtkDICOMFileReadSlot(int priority, size_t len)
+  : Priority(priority)
+{
+  if (priority != vtkDICOMFile::PriorityBackground)
+    {
+    vtkDICOMFileSchedLock.Lock();
+    vtkDICOMFileInteractiveReads++;
+    vtkDICOMFileSchedLock.Unlock();
+    return;
+    }
+
+  for (;;)
+    {
+    bool proceed = false;
+    vtkDICOMFileSchedLock.Lock();
+    if (vtkDICOMFileInteractiveReads == 0)
+      {
+      double rate = vtkDICOMFileBackgroundRate;
+      if (rate <= 0.0)
+        {
+        proceed = true;
+        }
+      else
+        {
+        // refill the token bucket, allowing a short burst
+        double now = vtkDICOMFileSchedClock();
+        double tokens = vtkDICOMFileTokenBytes;
+        tokens += (now - vtkDICOMFileTokenTime)*rate;
+        if (tokens > 0.25*rate)
+          {
+          tokens = 0.25*rate;
+          }
+        vtkDICOMFileTokenTime = now;
+        // one read may overdraw the bucket, and later reads then
+        // wait until the refill has repaid the debt
+        if (tokens >= 0.0)
+          {
+          tokens -= static_cast<double>(len);
+          proceed = true;
+          }
+        vtkDICOMFileTokenBytes = tokens;
+        }
+      }
+    vtkDICOMFileSchedLock.Unlock();
+    if (proceed)
+      {
+      break;
+      }
+    vtkDICOMFileSchedSleep();
+    }
+}
+
+vtkDICOMFileReadSlot::~vtkDICOMFileReadSlot()
+{
+  if (this->Priority != vtkDICOMFile::PriorityBackground)
+    {
+    vtkDICOMFileSchedLock.Lock();
+    vtkDICOMFileInteractiveReads--;
+    vtkDICOMFileSchedLock.Unlock();
+    }
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::SetBackgroundByteRate(double bytesPerSecond)
+{
+  vtkDICOMFileSchedLock.Lock();
+  vtkDICOMFileBackgroundRate = bytesPerSecond;
+  vtkDICOMFileTokenBytes = 0.0;
+  vtkDICOMFileTokenTime = vtkDICOMFileSchedClock();
+  vtkDICOMFileSchedLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+double vtkDICOMFile::GetBackgroundByteRate()
+{
+  vtkDICOMFileSchedLock.Lock();
+  double rate = vtkDICOMFileBackgroundRate;
+  vtkDICOMFileSchedLock.Unlock();
+  return rate;
+}
+
 //----------------------------------------------------------------------------
 size_t vtkDICOMFile::Read(unsigned char *data, size_t len)
 {
+  vtkDICOMFileReadSlot slot(this->IOPriority, len);
+
 #if defined(VTK_DICOM_POSIX_IO)
   ssize_t n;
   while ((n = read(this->Handle, data, len)) == -1)
@@ -304,6 +483,78 @@ size_t vtkDICOMFile::Write(const unsigned char *data, size_t len)
 #endif
 }
 
+//----------------------------------------------------------------------------
+size_t vtkDICOMFile::WriteV(
+  const unsigned char *data1, size_t len1,
+  const unsigned char *data2, size_t len2)
+{
+#if defined(VTK_DICOM_POSIX_IO)
+  struct iovec iov[2];
+  iov[0].iov_base = const_cast<unsigned char *>(data1);
+  iov[0].iov_len = len1;
+  iov[1].iov_base = const_cast<unsigned char *>(data2);
+  iov[1].iov_len = len2;
+  ssize_t n;
+  while ((n = writev(this->Handle, iov, 2)) == -1)
+    {
+    if (errno != EINTR)
+      {
+      break;
+      }
+    errno = 0;
+    }
+  if (n == -1)
+    {
+    this->Error = UnknownError;
+    n = 0;
+    }
+  return n;
+#else
+  size_t n = this->Write(data1, len1);
+  if (n == len1)
+    {
+    n += this->Write(data2, len2);
+    }
+  return n;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::Sync()
+{
+#if defined(VTK_DICOM_POSIX_IO)
+  int r;
+  while ((r = fsync(this->Handle)) == -1)
+    {
+    if (errno != EINTR)
+      {
+      break;
+      }
+    errno = 0;
+    }
+  if (r == -1)
+    {
+    this->Error = UnknownError;
+    return false;
+    }
+  return true;
+#elif defined(VTK_DICOM_WIN32_IO)
+  if (FlushFileBuffers(this->Handle) == FALSE)
+    {
+    this->Error = UnknownError;
+    return false;
+    }
+  return true;
+#else
+  if (fflush(static_cast<FILE *>(this->Handle)) != 0)
+    {
+    this->Error = UnknownError;
+    return false;
+    }
+  return true;
+#endif
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMFile::SetPosition(Size offset)
 {
@@ -377,6 +628,248 @@ vtkDICOMFile::Size vtkDICOMFile::GetSize()
 #endif
 }
 
+//----------------------------------------------------------------------------
+const unsigned char *vtkDICOMFile::Map(Size length)
+{
+  if (this->MapAddress)
+    {
+    return static_cast<const unsigned char *>(this->MapAddress);
+    }
+  if (length == 0)
+    {
+    return 0;
+    }
+#if defined(VTK_DICOM_POSIX_IO)
+  if (this->Handle != -1 && length <= static_cast<Size>(-1)/2)
+    {
+    void *addr = mmap(0, static_cast<size_t>(length), PROT_READ,
+                      MAP_PRIVATE, this->Handle, 0);
+    if (addr != MAP_FAILED)
+      {
+      this->MapAddress = addr;
+      this->MapLength = length;
+      }
+    }
+#elif defined(VTK_DICOM_WIN32_IO)
+  if (this->Handle != INVALID_HANDLE_VALUE)
+    {
+    HANDLE mh = CreateFileMappingW(this->Handle, NULL, PAGE_READONLY,
+                                   0, 0, NULL);
+    if (mh)
+      {
+      void *addr = MapViewOfFile(mh, FILE_MAP_READ, 0, 0,
+                                 static_cast<SIZE_T>(length));
+      if (addr)
+        {
+        this->MapHandle = mh;
+        this->MapAddress = addr;
+        this->MapLength = length;
+        }
+      else
+        {
+        CloseHandle(mh);
+        }
+      }
+    }
+#endif
+  return static_cast<const unsigned char *>(this->MapAddress);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Unmap()
+{
+  if (this->MapAddress)
+    {
+#if defined(VTK_DICOM_POSIX_IO)
+    munmap(this->MapAddress, static_cast<size_t>(this->MapLength));
+#elif defined(VTK_DICOM_WIN32_IO)
+    UnmapViewOfFile(this->MapAddress);
+    CloseHandle(this->MapHandle);
+    this->MapHandle = 0;
+#endif
+    this->MapAddress = 0;
+    this->MapLength = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+void *vtkDICOMFile::MapScratchFile(const char *dirname, Size length)
+{
+  void *ptr = 0;
+  if (length == 0)
+    {
+    return ptr;
+    }
+
+#if defined(VTK_DICOM_POSIX_IO)
+  if (dirname == 0 || dirname[0] == '\0')
+    {
+    dirname = getenv("TMPDIR");
+    if (dirname == 0 || dirname[0] == '\0')
+      {
+      dirname = "/tmp";
+      }
+    }
+
+  // build a template for a uniquely-named file in the directory
+  static const char suffix[] = "/vtkDICOMScratchXXXXXX";
+  char *fname = new char[strlen(dirname) + sizeof(suffix)];
+  strcpy(fname, dirname);
+  strcat(fname, suffix);
+
+  int fd = mkstemp(fname);
+  if (fd != -1)
+    {
+    // remove the directory entry right away, so that the file is
+    // reclaimed as soon as the mapping is released, even if the
+    // process exits without releasing it
+    unlink(fname);
+    if (ftruncate(fd, static_cast<off_t>(length)) == 0)
+      {
+      void *addr = mmap(0, static_cast<size_t>(length),
+                        PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if (addr != MAP_FAILED)
+        {
+        ptr = addr;
+        }
+      }
+    // the mapping keeps its own reference to the file
+    close(fd);
+    }
+  delete [] fname;
+#elif defined(VTK_DICOM_WIN32_IO)
+  wchar_t tpath[MAX_PATH+1];
+  wchar_t tname[MAX_PATH+1];
+  tpath[0] = 0;
+  if (dirname && dirname[0] != '\0')
+    {
+    vtkDICOMFilePath fpath(dirname);
+    const wchar_t *wideDirname = fpath.Wide();
+    if (wideDirname == 0 || wcslen(wideDirname) >= MAX_PATH)
+      {
+      return ptr;
+      }
+    wcscpy(tpath, wideDirname);
+    }
+  else if (GetTempPathW(MAX_PATH, tpath) == 0)
+    {
+    return ptr;
+    }
+  if (GetTempFileNameW(tpath, L"dcm", 0, tname) == 0)
+    {
+    return ptr;
+    }
+
+  // the file is deleted by the system when its last handle closes,
+  // and the mapping counts as a handle
+  HANDLE h = CreateFileW(tname, GENERIC_READ | GENERIC_WRITE, 0, NULL,
+                         CREATE_ALWAYS,
+                         FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+                         NULL);
+  if (h != INVALID_HANDLE_VALUE)
+    {
+    HANDLE mh = CreateFileMappingW(h, NULL, PAGE_READWRITE,
+                                   static_cast<DWORD>(length >> 32),
+                                   static_cast<DWORD>(length), NULL);
+    if (mh)
+      {
+      ptr = MapViewOfFile(mh, FILE_MAP_WRITE, 0, 0,
+                          static_cast<SIZE_T>(length));
+      CloseHandle(mh);
+      }
+    CloseHandle(h);
+    }
+#else
+  (void)dirname;
+#endif
+
+  return ptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::UnmapScratchFile(void *ptr, Size length)
+{
+  if (ptr)
+    {
+#if defined(VTK_DICOM_POSIX_IO)
+    munmap(ptr, static_cast<size_t>(length));
+#elif defined(VTK_DICOM_WIN32_IO)
+    (void)length;
+    UnmapViewOfFile(ptr);
+#else
+    (void)length;
+#endif
+    }
+}
+
+//----------------------------------------------------------------------------
+void *vtkDICOMFile::MapLargePages(Size length)
+{
+  void *ptr = 0;
+  if (length == 0)
+    {
+    return ptr;
+    }
+
+#if defined(VTK_DICOM_POSIX_IO)
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#if defined(MAP_ANONYMOUS)
+  if (length <= static_cast<Size>(-1)/2)
+    {
+    void *addr = mmap(0, static_cast<size_t>(length),
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr != MAP_FAILED)
+      {
+      ptr = addr;
+#if defined(MADV_HUGEPAGE)
+      // advisory only: the kernel backs the range with transparent
+      // huge pages if it can, and with ordinary pages otherwise
+      madvise(addr, static_cast<size_t>(length), MADV_HUGEPAGE);
+#endif
+      }
+    }
+#endif
+#elif defined(VTK_DICOM_WIN32_IO)
+  // explicit large pages need the lock-memory privilege, which most
+  // processes do not hold, so be prepared to fall back
+  SIZE_T granularity = GetLargePageMinimum();
+  if (granularity != 0 && length <= static_cast<Size>(-1)/2)
+    {
+    SIZE_T rounded = (static_cast<SIZE_T>(length) + (granularity - 1)) &
+                     ~(granularity - 1);
+    ptr = VirtualAlloc(NULL, rounded,
+                       MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                       PAGE_READWRITE);
+    }
+  if (ptr == 0)
+    {
+    ptr = VirtualAlloc(NULL, static_cast<SIZE_T>(length),
+                       MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    }
+#endif
+
+  return ptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::UnmapLargePages(void *ptr, Size length)
+{
+  if (ptr)
+    {
+#if defined(VTK_DICOM_POSIX_IO)
+    munmap(ptr, static_cast<size_t>(length));
+#elif defined(VTK_DICOM_WIN32_IO)
+    (void)length;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    (void)length;
+#endif
+    }
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMFile::Access(const char *filename, Mode mode)
 {
@@ -502,6 +995,197 @@ int vtkDICOMFile::Remove(const char *filename)
 #endif
 }
 
+//----------------------------------------------------------------------------
+int vtkDICOMFile::Rename(const char *oldname, const char *newname)
+{
+#if defined(VTK_DICOM_WIN32_IO)
+  int errorCode = 0;
+  vtkDICOMFilePath fpath1(oldname);
+  vtkDICOMFilePath fpath2(newname);
+  const wchar_t *wideOldname = fpath1.Wide();
+  const wchar_t *wideNewname = fpath2.Wide();
+  if (wideOldname && wideNewname)
+    {
+    if (!MoveFileExW(wideOldname, wideNewname,
+                     MOVEFILE_REPLACE_EXISTING))
+      {
+      DWORD lastError = GetLastError();
+      if (lastError == ERROR_ACCESS_DENIED ||
+          lastError == ERROR_SHARING_VIOLATION)
+        {
+        errorCode = AccessDenied;
+        }
+      else if (lastError == ERROR_FILE_NOT_FOUND ||
+               lastError == ERROR_PATH_NOT_FOUND)
+        {
+        errorCode = FileNotFound;
+        }
+      else
+        {
+        errorCode = UnknownError;
+        }
+      }
+    }
+  return errorCode;
+#else
+  int errorCode = 0;
+  if (rename(oldname, newname) != 0)
+    {
+    int e = errno;
+    if (e == EACCES || e == EPERM)
+      {
+      errorCode = AccessDenied;
+      }
+    else if (e == ENOENT || e == ENOTDIR)
+      {
+      errorCode = FileNotFound;
+      }
+    else if (e == EISDIR)
+      {
+      errorCode = FileIsDirectory;
+      }
+    else
+      {
+      errorCode = UnknownError;
+      }
+    }
+  return errorCode;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::SyncDirectory(const char *dirname)
+{
+#if defined(VTK_DICOM_POSIX_IO)
+  int fd;
+  while ((fd = open(dirname, O_RDONLY)) == -1)
+    {
+    if (errno != EINTR)
+      {
+      break;
+      }
+    errno = 0;
+    }
+  if (fd == -1)
+    {
+    return false;
+    }
+  int r;
+  while ((r = fsync(fd)) == -1)
+    {
+    if (errno != EINTR)
+      {
+      break;
+      }
+    errno = 0;
+    }
+  close(fd);
+  return (r != -1);
+#else
+  // directory entries cannot be explicitly flushed on this platform
+  (void)dirname;
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::GetFileInfo(
+  const char *filename, Size *size, long long *mtime)
+{
+#ifdef _WIN32
+  bool result = false;
+  vtkDICOMFilePath fpath(filename);
+  const wchar_t *wideFilename = fpath.Wide();
+  if (wideFilename)
+    {
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    if (GetFileAttributesExW(wideFilename, GetFileExInfoStandard, &attr) &&
+        (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+      {
+      *size = (static_cast<Size>(attr.nFileSizeHigh) << 32) |
+              attr.nFileSizeLow;
+      // convert from 100ns intervals since 1601 to the POSIX epoch
+      long long t = (static_cast<long long>(attr.ftLastWriteTime.
+                       dwHighDateTime) << 32) |
+                    attr.ftLastWriteTime.dwLowDateTime;
+      *mtime = t/10000000ll - 11644473600ll;
+      result = true;
+      }
+    }
+  return result;
+#else
+  struct stat fs;
+  if (stat(filename, &fs) != 0 || S_ISDIR(fs.st_mode))
+    {
+    return false;
+    }
+  *size = fs.st_size;
+  *mtime = fs.st_mtime;
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Prefetch(const char *filename, Size length)
+{
+#if defined(VTK_DICOM_POSIX_IO) && defined(POSIX_FADV_WILLNEED)
+  // ask the kernel to read the head of the file into its page cache
+  // in the background, so that a later open-and-read does not have to
+  // wait on the storage device
+  int fd;
+  while ((fd = open(filename, O_RDONLY)) == -1)
+    {
+    if (errno != EINTR)
+      {
+      break;
+      }
+    errno = 0;
+    }
+  if (fd != -1)
+    {
+    posix_fadvise(fd, 0, static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+    close(fd);
+    }
+#else
+  // no readahead facility, the hint is advisory so do nothing
+  (void)filename;
+  (void)length;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::GetDirectoryInfo(const char *dirname, long long *mtime)
+{
+#ifdef _WIN32
+  bool result = false;
+  vtkDICOMFilePath fpath(dirname);
+  const wchar_t *wideDirname = fpath.Wide();
+  if (wideDirname)
+    {
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    if (GetFileAttributesExW(wideDirname, GetFileExInfoStandard, &attr) &&
+        (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+      {
+      // convert from 100ns intervals since 1601 to the POSIX epoch
+      long long t = (static_cast<long long>(attr.ftLastWriteTime.
+                       dwHighDateTime) << 32) |
+                    attr.ftLastWriteTime.dwLowDateTime;
+      *mtime = t/10000000ll - 11644473600ll;
+      result = true;
+      }
+    }
+  return result;
+#else
+  struct stat fs;
+  if (stat(dirname, &fs) != 0 || !S_ISDIR(fs.st_mode))
+    {
+    return false;
+    }
+  *mtime = fs.st_mtime;
+  return true;
+#endif
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMFile::SameFile(const char *file1, const char *file2)
 {
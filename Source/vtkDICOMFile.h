@@ -39,6 +39,21 @@ public:
     Out
   };
 
+  //! Access pattern hints for the operating system.
+  enum Hint
+  {
+    NoHint,      // use the default readahead policy
+    Sequential,  // the file will be read from beginning to end
+    WholeFile    // the whole file will be read immediately
+  };
+
+  //! I/O scheduling priorities.
+  enum Priority
+  {
+    PriorityInteractive,  // reads preempt background reads
+    PriorityBackground    // reads yield to interactive reads
+  };
+
   //! Error codes.
   enum Code
   {
@@ -57,9 +72,12 @@ public:
   //@{
   //! Construct the file object.
   /*!
-   *  The Mode can be "In" or "Out" (read or write).
+   *  The Mode can be "In" or "Out" (read or write).  An access
+   *  pattern hint can also be given, so that the operating system
+   *  can tune its readahead for the way the file will be read.
    */
   vtkDICOMFile(const char *filename, Mode mode);
+  vtkDICOMFile(const char *filename, Mode mode, Hint hint);
 
   //! Destruct the object and close the file.
   ~vtkDICOMFile();
@@ -83,12 +101,45 @@ public:
    */
   size_t Write(const unsigned char *data, size_t size);
 
+  //! Write data from two buffers to a file.
+  /*!
+   *  This is equivalent to writing the first buffer followed by the
+   *  second buffer, except that on some platforms both buffers are
+   *  written with a single system call.  The total number of bytes
+   *  written will be returned.
+   */
+  size_t WriteV(const unsigned char *data1, size_t size1,
+                const unsigned char *data2, size_t size2);
+
   //! Go to a specific location in the file.
   /*!
    *  The return value is false if an error occurred.
    */
   bool SetPosition(Size offset);
 
+  //! Flush the data that was written to the storage device.
+  /*!
+   *  This does not return until the operating system has committed
+   *  the file's data to the storage device.  It is not called by
+   *  Close(), so a file that needs durability guarantees must be
+   *  flushed explicitly.  The return value is false if an error
+   *  occurred.
+   */
+  bool Sync();
+
+  //! Map the first "length" bytes of the file into memory (read-only).
+  /*!
+   *  The file must have been opened for input.  The returned pointer
+   *  remains valid until Unmap() or Close() is called.  A return value
+   *  of NULL indicates that mapping is unsupported on this platform or
+   *  that the mapping failed, in which case the caller should fall back
+   *  to using Read().
+   */
+  const unsigned char *Map(Size length);
+
+  //! Release a mapping that was created by Map().
+  void Unmap();
+
   //! Check the size of the file, returns ULLONG_MAX on error.
   Size GetSize();
 
@@ -97,6 +148,20 @@ public:
 
   //! Return an error indicator (zero if no error).
   int GetError() { return this->Error; }
+
+  //! Set the I/O scheduling priority (default: PriorityInteractive).
+  /*!
+   *  While any interactive read is in progress, background reads wait
+   *  for it to complete, and if a background byte rate has been set
+   *  with SetBackgroundByteRate(), the background reads are further
+   *  throttled to that rate.  This keeps a background scan of a large
+   *  archive from starving an interactive load that is in progress
+   *  in the same process.
+   */
+  void SetPriority(int priority) { this->IOPriority = priority; }
+
+  //! Get the I/O scheduling priority.
+  int GetPriority() { return this->IOPriority; }
   //@}
 
   //@{
@@ -116,6 +181,108 @@ public:
    */
   static int Remove(const char *filename);
 
+  //! Rename the specified file (static method).
+  /*!
+   *  If a file with the new name already exists, then it will be
+   *  replaced.  On POSIX file systems the rename is atomic, so any
+   *  other process will see either the old file or the new file,
+   *  never a missing or partially written file.  The return value
+   *  is zero if successful, otherwise an error code is returned.
+   */
+  static int Rename(const char *oldname, const char *newname);
+
+  //! Flush a directory to the storage device (static method).
+  /*!
+   *  After files within a directory have been created, renamed, or
+   *  removed, this commits those directory entries to the storage
+   *  device.  On platforms where directories cannot be explicitly
+   *  flushed, this is a no-op that returns true.  The return value
+   *  is false if an error occurred.
+   */
+  static bool SyncDirectory(const char *dirname);
+
+  //! Get the size and modification time of a file (static method).
+  /*!
+   *  The modification time is given in seconds since the POSIX epoch.
+   *  The return value is false if the file is inaccessible, in which
+   *  case the size and time are left unchanged.
+   */
+  static bool GetFileInfo(const char *filename, Size *size,
+                          long long *mtime);
+
+  //! Hint that the head of a file will soon be read (static method).
+  /*!
+   *  This advises the operating system to read the first "length"
+   *  bytes of the file into its cache in the background, so that a
+   *  subsequent open and read of the file's header does not have to
+   *  wait on the storage device.  Loops that parse the headers of
+   *  many small files can issue a batch of these hints ahead of the
+   *  parsing, overlapping the parsing with the device reads.  The
+   *  hint is purely advisory, and on platforms without a readahead
+   *  facility it does nothing at all.
+   */
+  static void Prefetch(const char *filename, Size length);
+
+  //! Allocate file-backed scratch memory (static method).
+  /*!
+   *  This creates a scratch file of the given length in the specified
+   *  directory (or in the system temporary directory, if the name is
+   *  null) and maps it into memory for reading and writing.  Use it
+   *  to hold data that may be too large for physical memory: the
+   *  operating system pages the data to and from the disk as needed.
+   *  The scratch file itself is unnamed (or marked delete-on-close),
+   *  so it is reclaimed automatically when the mapping is released,
+   *  even if the process exits without releasing it.  The return
+   *  value is null if the mapping could not be created.  Release the
+   *  memory with UnmapScratchFile().
+   */
+  static void *MapScratchFile(const char *dirname, Size length);
+
+  //! Release memory that was allocated by MapScratchFile().
+  static void UnmapScratchFile(void *ptr, Size length);
+
+  //! Allocate memory backed by large pages (static method).
+  /*!
+   *  This allocates anonymous memory for a large buffer and asks the
+   *  operating system to back it with large ("huge") pages, which
+   *  reduces address-translation overhead when the buffer is swept
+   *  by decoding, rescaling, or reformatting passes.  The request is
+   *  only a hint: on Linux the range is marked with MADV_HUGEPAGE
+   *  and the kernel substitutes ordinary pages if huge pages are not
+   *  available, while on Windows explicit large pages are tried
+   *  first and ordinary pages are used if the process lacks the
+   *  lock-memory privilege.  The return value is null if no memory
+   *  could be allocated, or if the platform has no suitable
+   *  allocator.  Release the memory with UnmapLargePages().
+   */
+  static void *MapLargePages(Size length);
+
+  //! Release memory that was allocated by MapLargePages().
+  static void UnmapLargePages(void *ptr, Size length);
+
+  //! Get the modification time of a directory (static method).
+  /*!
+   *  The modification time is given in seconds since the POSIX epoch,
+   *  and it changes whenever an entry is added to, removed from, or
+   *  renamed within the directory.  The return value is false if the
+   *  path is inaccessible or is not a directory, in which case the
+   *  time is left unchanged.
+   */
+  static bool GetDirectoryInfo(const char *dirname, long long *mtime);
+
+  //! Set the byte rate for background reads (static method).
+  /*!
+   *  Background reads draw from a process-wide token bucket that is
+   *  refilled at this rate, so the total rate of all reads done at
+   *  PriorityBackground stays near the given number of bytes per
+   *  second.  A rate of zero (the default) disables the throttle,
+   *  although background reads still yield to interactive reads.
+   */
+  static void SetBackgroundByteRate(double bytesPerSecond);
+
+  //! Get the byte rate for background reads (static method).
+  static double GetBackgroundByteRate();
+
   //! Check if two files are the same.
   /*!
    *  This does not check that the filenames are the same.  Instead,
@@ -127,13 +294,22 @@ public:
   //@}
 
 private:
+  //! Open the file, shared by the constructors.
+  void Open(const char *filename, Mode mode, Hint hint);
+
 #ifdef VTK_DICOM_POSIX_IO
   int Handle;
 #else
   void *Handle;
 #endif
+#ifdef VTK_DICOM_WIN32_IO
+  void *MapHandle;
+#endif
+  void *MapAddress;
+  Size MapLength;
   int Error;
   bool Eof;
+  int IOPriority;
 };
 
 #endif /* vtkDICOMFile_h */
@@ -47,6 +47,9 @@ struct vtkDICOMFileDirectory::Entry
   std::string Name;
   unsigned short Flags;
   unsigned short Mask;
+  unsigned long long Size;
+  long long MTime;
+  bool HasInfo;
 };
 
 //----------------------------------------------------------------------------
@@ -97,7 +100,22 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const char *dirname)
           {
           flags |= TypeDirectory;
           }
-        this->AddEntry(name, flags, (TypeSymlink | TypeDirectory));
+        this->AddEntry(name, flags, (TypeSymlink | TypeDirectory | TypeHidden));
+        if ((flags & TypeDirectory) == 0)
+          {
+          // the find data already holds the size and time, so store
+          // them rather than forcing a stat if they are needed later
+          int j = this->NumberOfFiles - 1;
+          this->Entries[j].Size =
+            (static_cast<unsigned long long>(fileData.nFileSizeHigh) << 32) |
+            fileData.nFileSizeLow;
+          // convert from 100ns intervals since 1601 to the POSIX epoch
+          long long t = (static_cast<long long>(
+            fileData.ftLastWriteTime.dwHighDateTime) << 32) |
+            fileData.ftLastWriteTime.dwLowDateTime;
+          this->Entries[j].MTime = t/10000000ll - 11644473600ll;
+          this->Entries[j].HasInfo = true;
+          }
         }
       while (FindNextFileW(h, &fileData));
       code = GetLastError();
@@ -146,7 +164,34 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const char *dirname)
       {
       if (strcmp(d->d_name, ".") != 0 && strcmp(d->d_name, "..") != 0)
         {
-        this->AddEntry(d->d_name, 0, 0);
+        unsigned int flags = 0;
+        unsigned int mask = 0;
+#ifdef DT_UNKNOWN
+        // take the file type from the directory entry itself, where
+        // available, so that IsDirectory() and IsSymlink() do not have
+        // to do a separate stat() for every file in the directory
+        if (d->d_type == DT_DIR)
+          {
+          flags |= TypeDirectory;
+          mask |= (TypeSymlink | TypeDirectory);
+          }
+        else if (d->d_type == DT_LNK)
+          {
+          // the type of the link target is still unknown
+          flags |= TypeSymlink;
+          mask |= TypeSymlink;
+          }
+        else if (d->d_type != DT_UNKNOWN)
+          {
+          mask |= (TypeSymlink | TypeDirectory);
+          }
+#endif
+#ifndef __APPLE__
+        // there is no hidden attribute to check for (files whose names
+        // begin with a dot are handled by the caller, not flagged here)
+        mask |= TypeHidden;
+#endif
+        this->AddEntry(d->d_name, flags, mask);
         }
       }
     closedir(dir);
@@ -226,6 +271,36 @@ bool vtkDICOMFileDirectory::IsHidden(int i)
   return ((this->Entries[i].Flags & TypeHidden) != 0);
 }
 
+//----------------------------------------------------------------------------
+unsigned long long vtkDICOMFileDirectory::GetSize(int i)
+{
+  if (i < 0 || i >= this->NumberOfFiles)
+    {
+    return static_cast<unsigned long long>(-1);
+    }
+  if (!this->Entries[i].HasInfo)
+    {
+    this->GetEntryInfo(i);
+    }
+
+  return this->Entries[i].Size;
+}
+
+//----------------------------------------------------------------------------
+long long vtkDICOMFileDirectory::GetLastModified(int i)
+{
+  if (i < 0 || i >= this->NumberOfFiles)
+    {
+    return -1;
+    }
+  if (!this->Entries[i].HasInfo)
+    {
+    this->GetEntryInfo(i);
+    }
+
+  return this->Entries[i].MTime;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMFileDirectory::AddEntry(
   const char *name, unsigned short flags, unsigned short mask)
@@ -249,6 +324,9 @@ void vtkDICOMFileDirectory::AddEntry(
   this->Entries[n].Name = name;
   this->Entries[n].Flags = flags;
   this->Entries[n].Mask= mask;
+  this->Entries[n].Size = static_cast<unsigned long long>(-1);
+  this->Entries[n].MTime = -1;
+  this->Entries[n].HasInfo = false;
 
   this->NumberOfFiles++;
 }
@@ -288,6 +366,22 @@ void vtkDICOMFileDirectory::StatEntry(int)
 }
 #endif
 
+//----------------------------------------------------------------------------
+void vtkDICOMFileDirectory::GetEntryInfo(int i)
+{
+  vtkDICOMFile::Size size;
+  long long mtime;
+  vtkDICOMFilePath path(this->Name);
+  path.PushBack(this->Entries[i].Name);
+  if (vtkDICOMFile::GetFileInfo(path.AsString().c_str(), &size, &mtime))
+    {
+    this->Entries[i].Size = size;
+    this->Entries[i].MTime = mtime;
+    }
+  // even upon failure, do not stat the same file twice
+  this->Entries[i].HasInfo = true;
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMFileDirectory::Create(const char *name)
 {
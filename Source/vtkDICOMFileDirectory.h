@@ -67,6 +67,20 @@ public:
 
   //! Check if the list entry has an attribute that marks it as hidden.
   bool IsHidden(int i);
+
+  //! Get the size of a file in the directory, in bytes.
+  /*!
+   *  If the entry is a directory, or if the size could not be
+   *  determined, then the largest possible value is returned.
+   */
+  unsigned long long GetSize(int i);
+
+  //! Get the last time that a file in the directory was modified.
+  /*!
+   *  The time is given in seconds since the POSIX epoch.  The return
+   *  value is -1 if the time could not be determined.
+   */
+  long long GetLastModified(int i);
   //@}
 
   //@{
@@ -86,6 +100,9 @@ private:
   //! Stat a file to set flags
   void StatEntry(int i);
 
+  //! Get the size and modification time for a file.
+  void GetEntryInfo(int i);
+
   struct Entry;
   static const unsigned int TypeDirectory = 1;
   static const unsigned int TypeSymlink = 2;
@@ -505,11 +505,30 @@ std::string vtkDICOMFilePath::GetRealPath() const
 //----------------------------------------------------------------------------
 void vtkDICOMFilePath::PushBack(const std::string& second)
 {
+#ifndef _WIN32
+  // On UNIX, joining paths is a simple concatenation, so do it in
+  // place rather than building a temporary string with Join() and
+  // then assigning it: a directory scan calls PushBack() and
+  // PopBack() once per file, and this way the same buffer is
+  // reused for every file.
+  if (this->Path.length() == 0)
+    {
+    this->Path = second;
+    }
+  else if (second.length() == 0 || !IsSeparator(second[0]))
+    {
+    if (!IsSeparator(this->Path[this->Path.length()-1]))
+      {
+      this->Path.push_back(this->Separator);
+      }
+    this->Path.append(second);
+    StripTrailingSlash(&this->Path);
+    }
+#else
   if (this->Path.length() == 0 || RootLength(second) == 0)
     {
     this->Path = this->Join(second);
     }
-#ifdef _WIN32
   else if (this->Path.length() == 4 && HasExtendedPrefix(this->Path))
     {
     this->Path = this->Join(second);
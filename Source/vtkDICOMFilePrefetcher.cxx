@@ -0,0 +1,227 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMFilePrefetcher.h"
+#include "vtkDICOMFile.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkStringArray.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+vtkStandardNewMacro(vtkDICOMFilePrefetcher);
+vtkCxxSetObjectMacro(vtkDICOMFilePrefetcher,FileNames,vtkStringArray);
+
+//----------------------------------------------------------------------------
+namespace {
+
+// the values that ClaimFile uses to signal that no index was claimed
+const int PREFETCH_WAIT = -1; // the read-ahead bound was reached
+const int PREFETCH_DONE = -2; // the end of the list was reached
+
+// sleep briefly while waiting for the consumer to advance
+void vtkDICOMFilePrefetcherSleep()
+{
+#ifdef _WIN32
+  Sleep(1);
+#else
+  struct timespec ts = { 0, 1000000 }; // one millisecond
+  nanosleep(&ts, 0);
+#endif
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// this friendship class allows the I/O threads to call the protected
+// methods of the prefetcher
+class vtkDICOMFilePrefetcherFriendship
+{
+public:
+  static int ClaimFile(vtkDICOMFilePrefetcher *self)
+    {
+    return self->ClaimFile();
+    }
+
+  static void PrefetchFile(vtkDICOMFilePrefetcher *self, int idx)
+    {
+    self->PrefetchFile(idx);
+    }
+};
+
+//----------------------------------------------------------------------------
+// the method that is executed by each of the I/O threads
+static VTK_THREAD_RETURN_TYPE vtkDICOMFilePrefetcherThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMFilePrefetcher *self =
+    static_cast<vtkDICOMFilePrefetcher *>(ti->UserData);
+
+  while (*(ti->ActiveFlag))
+    {
+    int idx = vtkDICOMFilePrefetcherFriendship::ClaimFile(self);
+    if (idx == PREFETCH_DONE)
+      {
+      break;
+      }
+    else if (idx == PREFETCH_WAIT)
+      {
+      // the read-ahead bound was reached, wait for the consumer
+      vtkDICOMFilePrefetcherSleep();
+      }
+    else
+      {
+      vtkDICOMFilePrefetcherFriendship::PrefetchFile(self, idx);
+      }
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFilePrefetcher::vtkDICOMFilePrefetcher()
+{
+  this->FileNames = 0;
+  this->Threader = vtkMultiThreader::New();
+  this->Lock = new vtkSimpleCriticalSection;
+  this->NumberOfThreads = 2;
+  this->ReadAheadCount = 8;
+  this->NextIndex = 0;
+  this->CurrentIndex = 0;
+  this->ActiveThreads = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFilePrefetcher::~vtkDICOMFilePrefetcher()
+{
+  this->Stop();
+
+  if (this->FileNames)
+    {
+    this->FileNames->Delete();
+    }
+  this->Threader->Delete();
+  delete this->Lock;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilePrefetcher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileNames: " << this->FileNames << "\n";
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "ReadAheadCount: " << this->ReadAheadCount << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilePrefetcher::Start()
+{
+  this->Stop();
+
+  if (this->FileNames == 0 ||
+      this->FileNames->GetNumberOfValues() == 0)
+    {
+    return;
+    }
+
+  this->NextIndex = 0;
+  this->CurrentIndex = 0;
+
+  int n = this->NumberOfThreads;
+  n = (n > 0 ? n : 1);
+  n = (n < 16 ? n : 16);
+  vtkIdType m = this->FileNames->GetNumberOfValues();
+  n = (static_cast<vtkIdType>(n) < m ? n : static_cast<int>(m));
+
+  for (int i = 0; i < n; i++)
+    {
+    this->ThreadIds[i] = this->Threader->SpawnThread(
+      &vtkDICOMFilePrefetcherThread, this);
+    }
+  this->ActiveThreads = n;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilePrefetcher::Stop()
+{
+  for (int i = 0; i < this->ActiveThreads; i++)
+    {
+    this->Threader->TerminateThread(this->ThreadIds[i]);
+    }
+  this->ActiveThreads = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilePrefetcher::SetCurrentIndex(int idx)
+{
+  this->Lock->Lock();
+  this->CurrentIndex = idx;
+  this->Lock->Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFilePrefetcher::ClaimFile()
+{
+  int n = static_cast<int>(this->FileNames->GetNumberOfValues());
+  int idx = PREFETCH_DONE;
+
+  this->Lock->Lock();
+  if (this->NextIndex < n)
+    {
+    if (this->ReadAheadCount > 0 &&
+        this->NextIndex > this->CurrentIndex + this->ReadAheadCount)
+      {
+      idx = PREFETCH_WAIT;
+      }
+    else
+      {
+      idx = this->NextIndex++;
+      }
+    }
+  this->Lock->Unlock();
+
+  return idx;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilePrefetcher::PrefetchFile(int idx)
+{
+  std::string fileName = this->FileNames->GetValue(idx);
+
+  vtkDICOMFile infile(fileName.c_str(), vtkDICOMFile::In);
+  if (infile.GetError())
+    {
+    return;
+    }
+
+  // read the whole file, simply to pull it into the page cache,
+  // the consumer will do its own reads once the data is resident
+  unsigned char buffer[65536];
+  while (!infile.EndOfFile())
+    {
+    size_t m = infile.Read(buffer, sizeof(buffer));
+    if (m == 0)
+      {
+      break;
+      }
+    }
+  infile.Close();
+}
@@ -0,0 +1,123 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMFilePrefetcher_h
+#define vtkDICOMFilePrefetcher_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkStringArray;
+class vtkMultiThreader;
+class vtkSimpleCriticalSection;
+class vtkDICOMFilePrefetcherFriendship;
+
+//! An asynchronous read-ahead for series of files.
+/*!
+ *  When a series of DICOM files is read one file at a time, every file
+ *  must be opened and read before it can be decoded, and on network
+ *  file systems the latency of these round trips can dominate the total
+ *  read time.  This class spawns a small pool of I/O threads that read
+ *  an ordered list of files ahead of the consumer, pulling the data
+ *  into the operating system's page cache so that the consumer's own
+ *  reads do not stall.  The consumer reports its position in the list
+ *  with SetCurrentIndex(), and the threads stay no more than
+ *  ReadAheadCount files ahead of that position.
+ */
+class VTKDICOM_EXPORT vtkDICOMFilePrefetcher : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMFilePrefetcher *New();
+  vtkTypeMacro(vtkDICOMFilePrefetcher, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //@{
+  //! Set the ordered list of files to prefetch.
+  /*!
+   *  The list must not be modified while prefetching is in progress.
+   */
+  void SetFileNames(vtkStringArray *);
+  vtkStringArray *GetFileNames() { return this->FileNames; }
+  //@}
+
+  //@{
+  //! The number of I/O threads to spawn (default: two).
+  /*!
+   *  A small number of threads is usually enough, since the threads
+   *  spend nearly all of their time waiting on the file system.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  int GetNumberOfThreads() { return this->NumberOfThreads; }
+
+  //! How many files to read ahead of the consumer (default: eight).
+  /*!
+   *  This bounds the amount of data pulled into the page cache beyond
+   *  the consumer's position.  A value of zero removes the bound, so
+   *  the whole list is read as fast as the file system allows.
+   */
+  vtkSetMacro(ReadAheadCount, int);
+  int GetReadAheadCount() { return this->ReadAheadCount; }
+  //@}
+
+  //@{
+  //! Start the I/O threads.
+  /*!
+   *  Prefetching begins at the start of the file list.  If prefetching
+   *  is already in progress, it is stopped and restarted.
+   */
+  void Start();
+
+  //! Report the index of the file the consumer is currently reading.
+  /*!
+   *  This releases the I/O threads to read further down the list.
+   */
+  void SetCurrentIndex(int idx);
+
+  //! Stop the I/O threads, returning after they have exited.
+  void Stop();
+  //@}
+
+protected:
+  vtkDICOMFilePrefetcher();
+  ~vtkDICOMFilePrefetcher();
+
+  //! Claim the next file to prefetch, or a negative value if
+  //! no file can be claimed yet (see the cxx file for details).
+  int ClaimFile();
+
+  //! Read the file with the given index to warm the page cache.
+  void PrefetchFile(int idx);
+
+  vtkStringArray *FileNames;
+  vtkMultiThreader *Threader;
+  vtkSimpleCriticalSection *Lock;
+  int NumberOfThreads;
+  int ReadAheadCount;
+  int NextIndex;    // guarded by Lock
+  int CurrentIndex; // guarded by Lock
+  int ThreadIds[16];
+  int ActiveThreads;
+
+private:
+  friend class vtkDICOMFilePrefetcherFriendship;
+
+  vtkDICOMFilePrefetcher(const vtkDICOMFilePrefetcher&);  // Not implemented.
+  void operator=(const vtkDICOMFilePrefetcher&);  // Not implemented.
+};
+
+#endif // vtkDICOMFilePrefetcher_h
@@ -27,6 +27,8 @@
 #include <vtkErrorCode.h>
 #include <vtkCommand.h>
 #include <vtkUnsignedShortArray.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
 
 #include <string>
 #include <vector>
@@ -78,6 +80,209 @@ class vtkDICOMFileSorter::FileInfoVectorList
 {
 };
 
+//----------------------------------------------------------------------------
+// Support for parallel sorting.
+
+namespace {
+
+// the results of parsing one file, filled in by a worker thread
+struct vtkDICOMFileSorterScanSlot
+{
+  vtkDICOMValue StudyUID;
+  vtkDICOMValue SeriesUID;
+  vtkDICOMValue InstanceUID;
+  unsigned int InstanceNumber;
+  int AccessCode;
+  bool PixelDataFound;
+  unsigned long ErrorCode;
+};
+
+// the state that is shared by all of the parsing threads
+struct vtkDICOMFileSorterScanInfo
+{
+  vtkStringArray *Input;
+  std::vector<vtkDICOMFileSorterScanSlot> *Slots;
+  vtkIdType NumberOfFiles;
+  vtkIdType NextIndex; // guarded by Lock
+  vtkSimpleCriticalSection Lock;
+};
+
+// the method executed by each parsing thread, each worker owns its own
+// parser and claims files from a shared queue until all are done
+VTK_THREAD_RETURN_TYPE vtkDICOMFileSorterThreadScan(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMFileSorterScanInfo *info =
+    static_cast<vtkDICOMFileSorterScanInfo *>(ti->UserData);
+
+  vtkSmartPointer<vtkUnsignedShortArray> groups =
+    vtkSmartPointer<vtkUnsignedShortArray>::New();
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+
+  groups->InsertNextValue(0x0008);
+  groups->InsertNextValue(0x0020);
+  parser->SetMetaData(meta);
+  parser->SetGroups(groups);
+
+  for (;;)
+    {
+    info->Lock.Lock();
+    vtkIdType j = info->NextIndex++;
+    info->Lock.Unlock();
+    if (j >= info->NumberOfFiles)
+      {
+      break;
+      }
+
+    vtkDICOMFileSorterScanSlot& slot = (*info->Slots)[j];
+    const std::string& fileName = info->Input->GetValue(j);
+
+    slot.AccessCode =
+      vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+    if (slot.AccessCode != 0)
+      {
+      continue;
+      }
+
+    meta->Initialize();
+    parser->SetFileName(fileName.c_str());
+    parser->Update();
+    slot.PixelDataFound = (parser->GetPixelDataFound() != 0);
+    slot.ErrorCode = parser->GetErrorCode();
+    slot.StudyUID = meta->GetAttributeValue(DC::StudyInstanceUID);
+    slot.SeriesUID = meta->GetAttributeValue(DC::SeriesInstanceUID);
+    slot.InstanceUID = meta->GetAttributeValue(DC::SOPInstanceUID);
+    slot.InstanceNumber =
+      meta->GetAttributeValue(DC::InstanceNumber).AsUnsignedInt();
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// compute an FNV-1a hash of a UID string, starting from the given
+// hash value so that hashes of several strings can be chained
+unsigned int vtkDICOMFileSorterHashUID(unsigned int h, const char *uid)
+{
+  if (uid)
+    {
+    while (*uid != '\0')
+      {
+      h = (h ^ static_cast<unsigned char>(*uid++))*16777619u;
+      }
+    }
+  return h;
+}
+
+// one study/series grouping of the files, the UID pointers refer to
+// values held by the file info array
+struct vtkDICOMFileSorterGroup
+{
+  const char *StudyUID;
+  const char *SeriesUID;
+  vtkIdType FirstIndex;
+  vtkIdType Rank;
+};
+
+// order the groups the same way that the sequential code orders its
+// series list: by StudyInstanceUID and SeriesInstanceUID, descending,
+// which is the order produced by the sequential insertion
+struct vtkDICOMFileSorterCompareGroups
+{
+  bool operator()(const vtkDICOMFileSorterGroup& g1,
+                  const vtkDICOMFileSorterGroup& g2) const
+  {
+    int c = vtkDICOMUtilities::CompareUIDs(g1.StudyUID, g2.StudyUID);
+    if (c != 0)
+      {
+      return (c > 0);
+      }
+    c = vtkDICOMUtilities::CompareUIDs(g1.SeriesUID, g2.SeriesUID);
+    if (c != 0)
+      {
+      return (c > 0);
+      }
+    // only files without a series UID can tie, they go into one
+    // single-file series each with later files before earlier files
+    return (g1.FirstIndex > g2.FirstIndex);
+  }
+};
+
+// apply the group comparator to indices into the group vector
+struct vtkDICOMFileSorterCompareGroupIndices
+{
+  const std::vector<vtkDICOMFileSorterGroup> *Groups;
+
+  vtkDICOMFileSorterCompareGroupIndices(
+    const std::vector<vtkDICOMFileSorterGroup> *g) : Groups(g) {}
+
+  bool operator()(vtkIdType g1, vtkIdType g2) const
+  {
+    return vtkDICOMFileSorterCompareGroups()(
+      (*this->Groups)[g1], (*this->Groups)[g2]);
+  }
+};
+
+// the compact fixed-size key that is used to sort the files, the
+// group rank encodes the study and series ordering so that the sort
+// comparator never has to compare UID strings
+struct vtkDICOMFileSorterSortKey
+{
+  vtkIdType Group;
+  unsigned int InstanceNumber;
+  vtkIdType Index;
+};
+
+// order the keys by group rank, and within a series by InstanceNumber
+// with ties broken by input position
+struct vtkDICOMFileSorterCompareKeys
+{
+  bool operator()(const vtkDICOMFileSorterSortKey& k1,
+                  const vtkDICOMFileSorterSortKey& k2) const
+  {
+    if (k1.Group != k2.Group)
+      {
+      return (k1.Group < k2.Group);
+      }
+    if (k1.InstanceNumber != k2.InstanceNumber)
+      {
+      return (k1.InstanceNumber < k2.InstanceNumber);
+      }
+    return (k1.Index < k2.Index);
+  }
+};
+
+// the state that is shared by all of the sorting threads
+struct vtkDICOMFileSorterSortInfo
+{
+  vtkDICOMFileSorterSortKey *Keys;
+  vtkIdType NumberOfKeys;
+};
+
+// the method executed by each sorting thread, each worker sorts its
+// own contiguous range of the key array (the ranges are merged on the
+// calling thread afterwards)
+VTK_THREAD_RETURN_TYPE vtkDICOMFileSorterThreadSort(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMFileSorterSortInfo *info =
+    static_cast<vtkDICOMFileSorterSortInfo *>(ti->UserData);
+
+  vtkIdType n = info->NumberOfKeys;
+  vtkIdType start = n*ti->ThreadID/ti->NumberOfThreads;
+  vtkIdType end = n*(ti->ThreadID + 1)/ti->NumberOfThreads;
+  std::sort(info->Keys + start, info->Keys + end,
+            vtkDICOMFileSorterCompareKeys());
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // anonymous namespace
+
 //----------------------------------------------------------------------------
 vtkDICOMFileSorter::vtkDICOMFileSorter()
 {
@@ -90,6 +295,8 @@ vtkDICOMFileSorter::vtkDICOMFileSorter()
   this->ErrorCode = 0;
   this->InternalFileName = 0;
   this->RequirePixelData = 1;
+  this->ParallelSorting = 0;
+  this->NumberOfSortingThreads = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -124,6 +331,10 @@ void vtkDICOMFileSorter::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "RequirePixelData: "
      << (this->RequirePixelData ? "On\n" : "Off\n");
+  os << indent << "ParallelSorting: "
+     << (this->ParallelSorting ? "On\n" : "Off\n");
+  os << indent << "NumberOfSortingThreads: "
+     << this->NumberOfSortingThreads << "\n";
 
   os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
   os << indent << "NumberOfStudies: " << this->GetNumberOfStudies() << "\n";
@@ -226,6 +437,14 @@ void vtkDICOMFileSorter::AddSeriesFileNames(int study, vtkStringArray *files)
 //----------------------------------------------------------------------------
 void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
 {
+  if (this->ParallelSorting && input->GetNumberOfValues() > 1)
+    {
+    FileInfoVectorList sortedFiles;
+    this->SortFilesInParallel(input, sortedFiles);
+    this->OutputSortedFiles(sortedFiles);
+    return;
+    }
+
   vtkSmartPointer<vtkUnsignedShortArray> groups =
     vtkSmartPointer<vtkUnsignedShortArray>::New();
   vtkSmartPointer<vtkDICOMMetaData> meta =
@@ -337,6 +556,258 @@ void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
       }
     }
 
+  this->OutputSortedFiles(sortedFiles);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileSorter::SortFilesInParallel(
+  vtkStringArray *input, FileInfoVectorList& sortedFiles)
+{
+  vtkIdType numberOfStrings = input->GetNumberOfValues();
+
+  // parse the metadata of the files with a pool of worker threads
+  std::vector<vtkDICOMFileSorterScanSlot> slots(numberOfStrings);
+
+  vtkDICOMFileSorterScanInfo scanInfo;
+  scanInfo.Input = input;
+  scanInfo.Slots = &slots;
+  scanInfo.NumberOfFiles = numberOfStrings;
+  scanInfo.NextIndex = 0;
+
+  vtkMultiThreader *threader = vtkMultiThreader::New();
+  if (this->NumberOfSortingThreads > 0)
+    {
+    threader->SetNumberOfThreads(this->NumberOfSortingThreads);
+    }
+  if (threader->GetNumberOfThreads() > numberOfStrings)
+    {
+    threader->SetNumberOfThreads(static_cast<int>(numberOfStrings));
+    }
+  int numThreads = threader->GetNumberOfThreads();
+
+  threader->SetSingleMethod(&vtkDICOMFileSorterThreadScan, &scanInfo);
+  threader->SingleMethodExecute();
+
+  // report errors and skip unusable files in input order, exactly as
+  // the sequential code does
+  std::vector<FileInfo> files;
+  files.reserve(numberOfStrings);
+  for (vtkIdType j = 0; j < numberOfStrings; j++)
+    {
+    vtkDICOMFileSorterScanSlot& slot = slots[j];
+    const std::string& fileName = input->GetValue(j);
+    this->SetInternalFileName(fileName.c_str());
+
+    if (slot.AccessCode == vtkDICOMFile::FileIsDirectory)
+      {
+      // Skip anything that is a directory
+      continue;
+      }
+    else if (slot.AccessCode != 0)
+      {
+      const char *errText = "Can't open the file ";
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      if (slot.AccessCode == vtkDICOMFile::AccessDenied)
+        {
+        errText = "No permission to read the file ";
+        }
+      else if (slot.AccessCode == vtkDICOMFile::FileNotFound)
+        {
+        errText = "File not found ";
+        }
+      else if (slot.AccessCode == vtkDICOMFile::ImpossiblePath)
+        {
+        errText = "Bad file path ";
+        }
+      vtkErrorMacro("SortFiles: " << errText << this->InternalFileName);
+      continue;
+      }
+
+    if (!slot.PixelDataFound)
+      {
+      if (!this->ErrorCode)
+        {
+        this->ErrorCode = slot.ErrorCode;
+        }
+      if (this->ErrorCode || this->RequirePixelData)
+        {
+        continue;
+        }
+      }
+
+    FileInfo fileInfo;
+    fileInfo.FileName = fileName;
+    fileInfo.StudyUID = slot.StudyUID;
+    fileInfo.SeriesUID = slot.SeriesUID;
+    fileInfo.InstanceUID = slot.InstanceUID;
+    fileInfo.InstanceNumber = slot.InstanceNumber;
+    files.push_back(fileInfo);
+    }
+
+  // group the files by StudyInstanceUID and SeriesInstanceUID with a
+  // hash table, so that the full UID strings only have to be compared
+  // when two files land in the same bucket
+  vtkIdType n = static_cast<vtkIdType>(files.size());
+  std::vector<vtkDICOMFileSorterGroup> groups;
+  std::vector<vtkDICOMFileSorterSortKey> keys(n);
+
+  // the table is kept at most half full to keep the probes short
+  unsigned int tableSize = 512;
+  while (tableSize < 2*static_cast<unsigned int>(n))
+    {
+    tableSize *= 2;
+    }
+  std::vector<vtkIdType> table(tableSize, -1);
+  unsigned int tableMask = tableSize - 1;
+
+  for (vtkIdType i = 0; i < n; i++)
+    {
+    const char *studyUID = files[i].StudyUID.GetCharData();
+    const char *seriesUID = files[i].SeriesUID.GetCharData();
+    vtkIdType g = -1;
+
+    if (seriesUID != 0)
+      {
+      unsigned int h = vtkDICOMFileSorterHashUID(2166136261u, studyUID);
+      h = vtkDICOMFileSorterHashUID(h, seriesUID);
+      unsigned int b = (h & tableMask);
+      while (table[b] >= 0)
+        {
+        const vtkDICOMFileSorterGroup& group = groups[table[b]];
+        if (vtkDICOMUtilities::CompareUIDs(group.StudyUID, studyUID) == 0 &&
+            vtkDICOMUtilities::CompareUIDs(group.SeriesUID, seriesUID) == 0)
+          {
+          g = table[b];
+          break;
+          }
+        b = ((b + 1) & tableMask);
+        }
+      if (g < 0)
+        {
+        g = static_cast<vtkIdType>(groups.size());
+        table[b] = g;
+        }
+      }
+    else
+      {
+      // files without a series UID go into one series each, so each
+      // of them becomes a group of its own
+      g = static_cast<vtkIdType>(groups.size());
+      }
+
+    if (g == static_cast<vtkIdType>(groups.size()))
+      {
+      vtkDICOMFileSorterGroup group;
+      group.StudyUID = studyUID;
+      group.SeriesUID = seriesUID;
+      group.FirstIndex = i;
+      group.Rank = 0;
+      groups.push_back(group);
+      }
+
+    keys[i].Group = g;
+    keys[i].InstanceNumber = files[i].InstanceNumber;
+    keys[i].Index = i;
+    }
+
+  // order the groups, and replace the group of each key with the rank
+  // of that group, so that sorting the keys sorts the files
+  vtkIdType numberOfGroups = static_cast<vtkIdType>(groups.size());
+  if (numberOfGroups > 1)
+    {
+    std::vector<vtkIdType> order(numberOfGroups);
+    for (vtkIdType g = 0; g < numberOfGroups; g++)
+      {
+      order[g] = g;
+      }
+    std::sort(order.begin(), order.end(),
+              vtkDICOMFileSorterCompareGroupIndices(&groups));
+    for (vtkIdType r = 0; r < numberOfGroups; r++)
+      {
+      groups[order[r]].Rank = r;
+      }
+    for (vtkIdType i = 0; i < n; i++)
+      {
+      keys[i].Group = groups[keys[i].Group].Rank;
+      }
+    }
+
+  if (numThreads > 1 && n > 1)
+    {
+    // each thread sorts one contiguous range of the key array
+    if (numThreads > n)
+      {
+      numThreads = static_cast<int>(n);
+      threader->SetNumberOfThreads(numThreads);
+      }
+
+    vtkDICOMFileSorterSortInfo sortInfo;
+    sortInfo.Keys = &keys[0];
+    sortInfo.NumberOfKeys = n;
+
+    threader->SetSingleMethod(&vtkDICOMFileSorterThreadSort, &sortInfo);
+    threader->SingleMethodExecute();
+
+    // merge the sorted ranges pairwise until only one range remains
+    std::vector<vtkIdType> bounds(numThreads + 1);
+    for (int t = 0; t <= numThreads; t++)
+      {
+      bounds[t] = n*t/numThreads;
+      }
+    while (bounds.size() > 2)
+      {
+      std::vector<vtkIdType> merged;
+      merged.push_back(bounds[0]);
+      size_t t = 1;
+      while (t + 1 < bounds.size())
+        {
+        std::inplace_merge(
+          keys.begin() + bounds[t-1], keys.begin() + bounds[t],
+          keys.begin() + bounds[t+1], vtkDICOMFileSorterCompareKeys());
+        merged.push_back(bounds[t+1]);
+        t += 2;
+        }
+      if (t < bounds.size())
+        {
+        merged.push_back(bounds[t]);
+        }
+      bounds.swap(merged);
+      }
+    }
+  else if (n > 1)
+    {
+    std::sort(keys.begin(), keys.end(), vtkDICOMFileSorterCompareKeys());
+    }
+
+  threader->Delete();
+
+  // split the sorted keys into series: consecutive files belong to
+  // the same series if they are in the same group (files without a
+  // series UID went into single-file groups of their own)
+  vtkIdType i = 0;
+  while (i < n)
+    {
+    vtkIdType seriesEnd = i + 1;
+    while (seriesEnd < n && keys[seriesEnd].Group == keys[i].Group)
+      {
+      seriesEnd++;
+      }
+
+    std::vector<FileInfo> newSeries;
+    newSeries.reserve(seriesEnd - i);
+    for (; i < seriesEnd; i++)
+      {
+      newSeries.push_back(files[keys[i].Index]);
+      }
+    sortedFiles.push_back(newSeries);
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileSorter::OutputSortedFiles(FileInfoVectorList& sortedFiles)
+{
+  FileInfoVectorList::iterator li;
+
   // Sort each series by InstanceNumber
   int studyCount = 0;
 
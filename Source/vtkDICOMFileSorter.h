@@ -107,6 +107,30 @@ public:
   int GetRequirePixelData() { return this->RequirePixelData; }
   //@}
 
+  //@{
+  //! Sort the files with multiple threads (default: Off).
+  /*!
+   *  When this option is on, the metadata of the files is parsed by a
+   *  pool of worker threads, and the files are then ordered through a
+   *  concurrent sort of compact per-file keys.  The sorted output is
+   *  identical to the output of the sequential sort.
+   */
+  vtkSetMacro(ParallelSorting, int);
+  vtkBooleanMacro(ParallelSorting, int);
+  int GetParallelSorting() { return this->ParallelSorting; }
+  //@}
+
+  //@{
+  //! The number of threads to use while sorting (default: 0).
+  /*!
+   *  If this is zero, then the number of threads will be equal to the
+   *  number of processors.  This option has no effect unless
+   *  ParallelSorting is on.
+   */
+  vtkSetMacro(NumberOfSortingThreads, int);
+  int GetNumberOfSortingThreads() { return this->NumberOfSortingThreads; }
+  //@}
+
 protected:
   vtkDICOMFileSorter();
   ~vtkDICOMFileSorter();
@@ -115,6 +139,8 @@ protected:
   vtkStringArray *InputFileNames;
   vtkStringArray *OutputFileNames;
   int RequirePixelData;
+  int ParallelSorting;
+  int NumberOfSortingThreads;
 
   vtkTimeStamp UpdateTime;
   unsigned long ErrorCode;
@@ -154,6 +180,19 @@ private:
   struct FileInfo;
   class FileInfoVectorList;
 
+  //! Parse the files and fill sortedFiles, using multiple threads.
+  /*!
+   *  The metadata is parsed by a pool of worker threads, and then the
+   *  files are ordered by a concurrent sort of compact per-file keys.
+   *  The resulting list is identical to the list that the sequential
+   *  code in SortFiles produces.
+   */
+  void SortFilesInParallel(
+    vtkStringArray *input, FileInfoVectorList& sortedFiles);
+
+  //! Split the sorted series list into the output series and studies.
+  void OutputSortedFiles(FileInfoVectorList& sortedFiles);
+
   StringArrayVector *Series;
   vtkIntArray *Studies;
 
@@ -0,0 +1,282 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMFilterChain.h"
+#include "vtkDICOMMetaData.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedImageAlgorithm.h"
+#include "vtkImageData.h"
+#include "vtkInformationVector.h"
+#include "vtkInformation.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkTrivialProducer.h"
+#include "vtkSmartPointer.h"
+#include "vtkVersion.h"
+
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMFilterChain);
+
+//----------------------------------------------------------------------------
+// The filters that make up the chain.
+
+class vtkDICOMFilterChain::FilterVector
+  : public std::vector<vtkSmartPointer<vtkThreadedImageAlgorithm> >
+{
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMFilterChain::vtkDICOMFilterChain()
+{
+  this->SlabMemoryLimit = 16777216;
+  this->Filters = new FilterVector;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFilterChain::~vtkDICOMFilterChain()
+{
+  delete this->Filters;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilterChain::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfFilters: " << this->GetNumberOfFilters() << "\n";
+  os << indent << "SlabMemoryLimit: " << this->SlabMemoryLimit << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilterChain::AddFilter(vtkThreadedImageAlgorithm *filter)
+{
+  this->Filters->push_back(filter);
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFilterChain::RemoveAllFilters()
+{
+  if (!this->Filters->empty())
+    {
+    this->Filters->clear();
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFilterChain::GetNumberOfFilters()
+{
+  return static_cast<int>(this->Filters->size());
+}
+
+//----------------------------------------------------------------------------
+vtkThreadedImageAlgorithm *vtkDICOMFilterChain::GetFilter(int i)
+{
+  vtkThreadedImageAlgorithm *filter = 0;
+  if (i >= 0 && i < static_cast<int>(this->Filters->size()))
+    {
+    filter = (*this->Filters)[i];
+    }
+  return filter;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFilterChain::RequestInformation(
+  vtkInformation* request,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  // copy the meta data and the input information to the output
+  if (!this->Superclass::RequestInformation(
+        request, inputVector, outputVector))
+    {
+    return 0;
+    }
+
+  if (this->Filters->empty())
+    {
+    return 1;
+    }
+
+  // connect the filters to each other, with our own input connection
+  // feeding the first filter in the chain
+  size_t n = this->Filters->size();
+  (*this->Filters)[0]->SetInputConnection(this->GetInputConnection(0, 0));
+  for (size_t i = 1; i < n; i++)
+    {
+    (*this->Filters)[i]->SetInputConnection(
+      (*this->Filters)[i-1]->GetOutputPort());
+    }
+
+  // run the information pass of the chain, and copy the information
+  // that the chain produces to our own output
+  vtkAlgorithm *last = (*this->Filters)[n-1];
+  last->UpdateInformation();
+  vtkInformation *chainInfo =
+    last->GetExecutive()->GetOutputInformation(0);
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+
+  outInfo->CopyEntry(
+    chainInfo, vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT());
+  outInfo->CopyEntry(chainInfo, vtkDataObject::SPACING());
+  outInfo->CopyEntry(chainInfo, vtkDataObject::ORIGIN());
+  outInfo->CopyEntry(chainInfo, META_DATA());
+  outInfo->CopyEntry(chainInfo, PATIENT_MATRIX());
+
+  vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(
+    chainInfo, vtkDataObject::FIELD_ASSOCIATION_POINTS,
+    vtkDataSetAttributes::SCALARS);
+  if (scalarInfo)
+    {
+    int scalarType = scalarInfo->Get(vtkDataObject::FIELD_ARRAY_TYPE());
+    int numComponents = 1;
+    if (scalarInfo->Has(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()))
+      {
+      numComponents =
+        scalarInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS());
+      }
+    vtkDataObject::SetPointDataActiveScalarInfo(
+      outInfo, scalarType, numComponents);
+    }
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFilterChain::RequestUpdateExtent(
+  vtkInformation*,
+  vtkInformationVector** inputVector,
+  vtkInformationVector*)
+{
+  // the chain streams slabs internally, so the whole input is needed
+  // no matter what output extent was requested
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  int extent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent, 6);
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFilterChain::RequestData(
+  vtkInformation*,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+
+  vtkImageData *inData = vtkImageData::SafeDownCast(
+    inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkImageData *outData = vtkImageData::SafeDownCast(
+    outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  // copy the meta data to the output data
+  this->CopyMetaDataToOutputData(outInfo, outData);
+
+  if (this->Filters->empty())
+    {
+    // with an empty chain, pass the input through unchanged
+    outData->ShallowCopy(inData);
+    return 1;
+    }
+
+  // give the chain a shallow copy of the input data, so that the slab
+  // updates re-execute only the filters in the chain and never reach
+  // back into the upstream pipeline
+  vtkSmartPointer<vtkImageData> inCopy =
+    vtkSmartPointer<vtkImageData>::New();
+  inCopy->ShallowCopy(inData);
+
+  // attach the meta data, so that the filters in the chain can find it
+  vtkInformation *metaInfo = this->GetMetaDataInformation(
+    inputVector, 0, 0);
+  inCopy->GetInformation()->CopyEntry(metaInfo, META_DATA());
+  inCopy->GetInformation()->CopyEntry(metaInfo, PATIENT_MATRIX());
+
+  vtkSmartPointer<vtkTrivialProducer> producer =
+    vtkSmartPointer<vtkTrivialProducer>::New();
+  producer->SetOutput(inCopy);
+  vtkThreadedImageAlgorithm *first = (*this->Filters)[0];
+  first->SetInputConnection(producer->GetOutputPort());
+
+  // allocate the output
+  int extent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
+#if VTK_MAJOR_VERSION >= 6
+  this->AllocateOutputData(outData, outInfo, extent);
+#else
+  this->AllocateOutputData(outData, extent);
+#endif
+
+  // compute the size of one slice of the largest intermediate result,
+  // and from it, the number of slices per slab
+  vtkIdType sliceSize = inData->GetNumberOfScalarComponents();
+  sliceSize *= inData->GetScalarSize();
+  vtkIdType outSliceSize = outData->GetNumberOfScalarComponents();
+  outSliceSize *= outData->GetScalarSize();
+  sliceSize = (outSliceSize > sliceSize ? outSliceSize : sliceSize);
+  sliceSize *= (extent[1] - extent[0] + 1);
+  sliceSize *= (extent[3] - extent[2] + 1);
+  int slabSize = 1;
+  if (sliceSize > 0 && this->SlabMemoryLimit > sliceSize)
+    {
+    vtkIdType maxSlices = this->SlabMemoryLimit/sliceSize;
+    slabSize = (maxSlices > VTK_INT_MAX
+                ? VTK_INT_MAX : static_cast<int>(maxSlices));
+    }
+
+  // push the data through the chain in slabs, and copy each finished
+  // slab into the output
+  vtkAlgorithm *last = (*this->Filters)[this->Filters->size() - 1];
+  vtkStreamingDemandDrivenPipeline *exec =
+    vtkStreamingDemandDrivenPipeline::SafeDownCast(last->GetExecutive());
+  exec->UpdateInformation();
+  vtkInformation *chainInfo = exec->GetOutputInformation(0);
+
+  int numSlabs = (extent[5] - extent[4])/slabSize + 1;
+  int slabExtent[6];
+  for (int slab = 0; slab < numSlabs && !this->AbortExecute; slab++)
+    {
+    slabExtent[0] = extent[0];
+    slabExtent[1] = extent[1];
+    slabExtent[2] = extent[2];
+    slabExtent[3] = extent[3];
+    slabExtent[4] = extent[4] + slab*slabSize;
+    slabExtent[5] = slabExtent[4] + slabSize - 1;
+    if (slabExtent[5] > extent[5])
+      {
+      slabExtent[5] = extent[5];
+      }
+
+    chainInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), slabExtent, 6);
+    exec->PropagateUpdateExtent(0);
+    exec->UpdateData(0);
+
+    vtkImageData *slabData = vtkImageData::SafeDownCast(
+      last->GetOutputDataObject(0));
+    outData->CopyAndCastFrom(slabData, slabExtent);
+
+    this->UpdateProgress((slab + 1.0)/numSlabs);
+    }
+
+  // release the reference to the input data
+  first->SetInputConnection(0, static_cast<vtkAlgorithmOutput *>(0));
+
+  return 1;
+}
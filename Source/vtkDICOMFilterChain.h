@@ -0,0 +1,102 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// .NAME vtkDICOMFilterChain - Run a chain of image filters in one pass
+// .SECTION Description
+// This filter runs a chain of image filters over its input without
+// allowing each filter in the chain to produce a full-sized volume as
+// its intermediate result.  Instead, the data is pushed through the
+// chain in slabs that are small enough to stay resident in the CPU
+// cache, so that the full volume is only read once at the head of the
+// chain and written once at its tail.  The filters that are added to
+// the chain must support streaming, which is true of all the filters
+// in VTK-DICOM.  The DICOM meta data is carried through the chain in
+// the usual way.
+
+#ifndef vtkDICOMFilterChain_h
+#define vtkDICOMFilterChain_h
+
+#include "vtkDICOMAlgorithm.h"
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkThreadedImageAlgorithm;
+
+//----------------------------------------------------------------------------
+class VTKDICOM_EXPORT vtkDICOMFilterChain : public vtkDICOMAlgorithm
+{
+public:
+  vtkTypeMacro(vtkDICOMFilterChain, vtkDICOMAlgorithm);
+
+  // Description:
+  // Static method for construction.
+  static vtkDICOMFilterChain *New();
+
+  // Description:
+  // Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  // Description:
+  // Add a filter to the end of the chain.
+  // The filters execute in the order that they were added.  The state
+  // of each filter must be fully configured before this object updates.
+  void AddFilter(vtkThreadedImageAlgorithm *filter);
+
+  // Description:
+  // Remove all of the filters from the chain.
+  // With an empty chain, the input is passed through unchanged.
+  void RemoveAllFilters();
+
+  // Description:
+  // Get the number of filters in the chain, or get one of the filters.
+  int GetNumberOfFilters();
+  vtkThreadedImageAlgorithm *GetFilter(int i);
+
+  // Description:
+  // Set the maximum size of the intermediate results, in bytes.
+  // The volume is pushed through the chain in slabs no larger than
+  // this limit (default: 16 MiB).  The limit should be chosen so that
+  // a slab can stay resident in the CPU cache between the filters.
+  vtkSetMacro(SlabMemoryLimit, vtkIdType);
+  vtkGetMacro(SlabMemoryLimit, vtkIdType);
+
+protected:
+  vtkDICOMFilterChain();
+  ~vtkDICOMFilterChain();
+
+  virtual int RequestInformation(
+    vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector);
+
+  virtual int RequestUpdateExtent(
+    vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector);
+
+  virtual int RequestData(
+    vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector);
+
+  // Description:
+  // The maximum size of the intermediate results, in bytes.
+  vtkIdType SlabMemoryLimit;
+
+  // Description:
+  // The filters that make up the chain.
+  class FilterVector;
+  FilterVector *Filters;
+
+private:
+  vtkDICOMFilterChain(const vtkDICOMFilterChain&);  // Not implemented.
+  void operator=(const vtkDICOMFilterChain&);  // Not implemented.
+};
+
+#endif // vtkDICOMFilterChain_h
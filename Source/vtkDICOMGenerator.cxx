@@ -40,14 +40,35 @@
 #endif
 
 vtkCxxSetObjectMacro(vtkDICOMGenerator,PatientMatrix,vtkMatrix4x4);
-vtkCxxSetObjectMacro(vtkDICOMGenerator,SourceMetaData,vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMGenerator,UIDGenerator,vtkDICOMUIDGenerator);
 
+//----------------------------------------------------------------------------
+void vtkDICOMGenerator::SetSourceMetaData(vtkDICOMMetaData *meta)
+{
+  if (this->SourceMetaData != meta)
+    {
+    // the cached adapter refers to the old source meta data
+    delete this->SourceAdapter;
+    this->SourceAdapter = 0;
+    if (this->SourceMetaData)
+      {
+      this->SourceMetaData->UnRegister(this);
+      }
+    this->SourceMetaData = meta;
+    if (meta)
+      {
+      meta->Register(this);
+      }
+    this->Modified();
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMGenerator::vtkDICOMGenerator()
 {
   this->MetaData = 0;
   this->SourceMetaData = 0;
+  this->SourceAdapter = 0;
   this->UIDGenerator = 0;
   this->MultiFrame = 0;
   this->OriginAtBottom = 1;
@@ -105,6 +126,7 @@ vtkDICOMGenerator::~vtkDICOMGenerator()
     {
     this->UIDGenerator->Delete();
     }
+  delete this->SourceAdapter;
   if (this->SourceMetaData)
     {
     this->SourceMetaData->Delete();
@@ -127,6 +149,16 @@ vtkDICOMMetaData *vtkDICOMGenerator::GetSourceMetaData()
   return this->SourceMetaData;
 }
 
+//----------------------------------------------------------------------------
+vtkDICOMMetaDataAdapter *vtkDICOMGenerator::GetSourceAdapter()
+{
+  if (this->SourceAdapter == 0)
+    {
+    this->SourceAdapter = new vtkDICOMMetaDataAdapter(this->SourceMetaData);
+    }
+  return this->SourceAdapter;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMGenerator::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -774,6 +806,11 @@ void vtkDICOMGenerator::InitializeMetaData(vtkInformation *info)
   this->MetaData = vtkDICOMMetaData::New();
   vtkDICOMMetaData *meta = this->MetaData;
 
+  // rebuild the cached source adapter, in case the source meta data
+  // object was modified since the last run
+  delete this->SourceAdapter;
+  this->SourceAdapter = 0;
+
   // get the scalar type
   vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(
     info, vtkDataObject::FIELD_ASSOCIATION_POINTS,
@@ -876,10 +913,10 @@ bool vtkDICOMGenerator::CopyRequiredAttributes(
   if (source && source == this->SourceMetaData && this->SourceInstanceArray &&
       source->HasAttribute(DC::PerFrameFunctionalGroupsSequence))
     {
+    vtkDICOMMetaDataAdapter *sourceAdapter = this->GetSourceAdapter();
     while (*tags != DC::ItemDelimitationItem)
       {
       vtkDICOMTag tag = *tags++;
-      vtkDICOMMetaDataAdapter sourceAdapter(source);
       bool nonevalid = true;
       int n = meta->GetNumberOfInstances();
       for (int i = 0; i < n; i++)
@@ -961,10 +998,10 @@ bool vtkDICOMGenerator::CopyOptionalAttributes(
   if (source && source == this->SourceMetaData && this->SourceInstanceArray &&
       source->HasAttribute(DC::PerFrameFunctionalGroupsSequence))
     {
+    vtkDICOMMetaDataAdapter *sourceAdapter = this->GetSourceAdapter();
     while (*tags != DC::ItemDelimitationItem)
       {
       vtkDICOMTag tag = *tags++;
-      vtkDICOMMetaDataAdapter sourceAdapter(source);
       int n = meta->GetNumberOfInstances();
       for (int i = 0; i < n; i++)
         {
@@ -1494,7 +1531,7 @@ bool vtkDICOMGenerator::GenerateImagePlaneModule(vtkDICOMMetaData *source)
     // use the original value if possible, to avoid surprises
     if (this->SourceInstanceArray && source == this->SourceMetaData && source)
       {
-      vtkDICOMMetaDataAdapter sourceAdapter(source);
+      vtkDICOMMetaDataAdapter *sourceAdapter = this->GetSourceAdapter();
       if (sourceAdapter->HasAttribute(DC::SliceLocation))
         {
         int j = this->SourceInstanceArray->GetComponent(i, 0);
@@ -1511,7 +1548,7 @@ bool vtkDICOMGenerator::GenerateImagePlaneModule(vtkDICOMMetaData *source)
   double thickness = 0;
   if (this->SourceInstanceArray && source == this->SourceMetaData && source)
     {
-    vtkDICOMMetaDataAdapter sourceAdapter(source);
+    vtkDICOMMetaDataAdapter *sourceAdapter = this->GetSourceAdapter();
     thickness = sourceAdapter->GetAttributeValue(
       0, DC::SliceThickness).AsDouble();
     }
@@ -1759,6 +1796,243 @@ bool vtkDICOMGenerator::GenerateMultiFrameModule(vtkDICOMMetaData *)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMGenerator::GenerateMultiFrameFunctionalGroupsModule(
+  vtkDICOMMetaData *source, const vtkDICOMItem& sharedGroups)
+{
+  double spacing[3], origin[3];
+  double matrix[16];
+  this->ComputeAdjustedMatrix(matrix, origin, spacing);
+
+  int nframes = this->NumberOfFrames;
+  int timeSlices = 1;
+  if (!this->TimeAsVector && this->Dimensions[3] > 0)
+    {
+    timeSlices = this->Dimensions[3];
+    }
+  int numTimeSlots = (this->Dimensions[3] > 0 ? this->Dimensions[3] : 1);
+
+  // remove attributes that conflict with this module
+  vtkDICOMMetaData *meta = this->MetaData;
+  meta->RemoveAttribute(DC::PixelAspectRatio);
+  meta->RemoveAttribute(DC::PatientOrientation);
+
+  meta->SetAttributeValue(DC::NumberOfFrames, nframes);
+
+  // the original SliceThickness should be used if it is still valid,
+  // i.e. if the slices are original slices rather than reformatted.
+  double thickness = 0;
+  if (this->SourceInstanceArray && source == this->SourceMetaData && source)
+    {
+    vtkDICOMMetaDataAdapter *sourceAdapter = this->GetSourceAdapter();
+    thickness = sourceAdapter->GetAttributeValue(
+      0, DC::SliceThickness).AsDouble();
+    }
+  if (thickness <= 0)
+    {
+    thickness = fabs(spacing[2]);
+    }
+
+  // the pixel measures are common to all frames
+  vtkDICOMItem pixelMeasures;
+  pixelMeasures.SetAttributeValue(
+    DC::PixelSpacing,
+    vtkDICOMValue(vtkDICOMVR::DS, spacing, 2));
+  pixelMeasures.SetAttributeValue(DC::SliceThickness, thickness);
+  pixelMeasures.SetAttributeValue(
+    DC::SpacingBetweenSlices, fabs(spacing[2]));
+
+  // the orientation is common to all frames of the volume
+  double position[3], orientation[6];
+  vtkDICOMGenerator::ComputePositionAndOrientation(
+    origin, matrix, position, orientation);
+  vtkDICOMItem planeOrientation;
+  planeOrientation.SetAttributeValue(
+    DC::ImageOrientationPatient,
+    vtkDICOMValue(vtkDICOMVR::DS, orientation, 6));
+
+  vtkDICOMItem sharedItem;
+  vtkDICOMSequence pixelMeasuresSeq;
+  pixelMeasuresSeq.AddItem(pixelMeasures);
+  sharedItem.SetAttributeValue(
+    DC::PixelMeasuresSequence, pixelMeasuresSeq);
+  vtkDICOMSequence planeOrientationSeq;
+  planeOrientationSeq.AddItem(planeOrientation);
+  sharedItem.SetAttributeValue(
+    DC::PlaneOrientationSequence, planeOrientationSeq);
+
+  // merge in the modality-specific shared functional groups
+  vtkDICOMDataElementIterator iter;
+  for (iter = sharedGroups.Begin(); iter != sharedGroups.End(); ++iter)
+    {
+    sharedItem.SetAttributeValue(iter->GetTag(), iter->GetValue());
+    }
+
+  vtkDICOMSequence sharedSeq;
+  sharedSeq.AddItem(sharedItem);
+  meta->SetAttributeValue(DC::SharedFunctionalGroupsSequence, sharedSeq);
+
+  // a default window/level is provided unless the modality supplied
+  // a pixel value transformation with its shared groups
+  bool setWindow =
+    (this->RangeArray != 0 &&
+     !sharedGroups.GetAttributeValue(
+       DC::PixelValueTransformationSequence).IsValid() &&
+     (this->ScalarType == VTK_SHORT ||
+      this->ScalarType == VTK_UNSIGNED_SHORT));
+
+  // generate the per-frame functional groups
+  vtkDICOMSequence perFrameSeq;
+  double zorigin = origin[2];
+  for (int f = 0; f < nframes; f++)
+    {
+    int sliceIdx = this->SliceIndexArray->GetComponent(0, f);
+    int componentIdx = this->ComponentIndexArray->GetComponent(0, f);
+    // remove the time from the slice index
+    int stackIdx = sliceIdx / timeSlices;
+    int timeIdx = sliceIdx % timeSlices;
+    if (this->TimeAsVector && this->Dimensions[3] > 0)
+      {
+      int nvector = (this->Dimensions[4] > 0 ? this->Dimensions[4] : 1);
+      timeIdx = componentIdx / nvector;
+      }
+
+    // the frame content group places the frame in the dimensions
+    vtkDICOMItem frameContent;
+    frameContent.SetAttributeValue(DC::StackID, "1");
+    frameContent.SetAttributeValue(DC::InStackPositionNumber, stackIdx + 1);
+    int indices[2];
+    indices[0] = stackIdx + 1;
+    size_t nindices = 1;
+    if (numTimeSlots > 1)
+      {
+      frameContent.SetAttributeValue(
+        DC::TemporalPositionIndex, timeIdx + 1);
+      indices[nindices++] = timeIdx + 1;
+      }
+    frameContent.SetAttributeValue(
+      DC::DimensionIndexValues,
+      vtkDICOMValue(vtkDICOMVR::UL, indices, nindices));
+
+    // the plane position group gives the position of the frame
+    origin[2] = zorigin + stackIdx*spacing[2];
+    vtkDICOMGenerator::ComputePositionAndOrientation(
+      origin, matrix, position, orientation);
+    vtkDICOMItem planePosition;
+    planePosition.SetAttributeValue(
+      DC::ImagePositionPatient,
+      vtkDICOMValue(vtkDICOMVR::DS, position, 3));
+
+    vtkDICOMItem frameItem;
+    vtkDICOMSequence frameContentSeq;
+    frameContentSeq.AddItem(frameContent);
+    frameItem.SetAttributeValue(DC::FrameContentSequence, frameContentSeq);
+    vtkDICOMSequence planePositionSeq;
+    planePositionSeq.AddItem(planePosition);
+    frameItem.SetAttributeValue(
+      DC::PlanePositionSequence, planePositionSeq);
+
+    if (setWindow)
+      {
+      int lowVal = this->RangeArray->GetComponent(f, 2);
+      int highVal = this->RangeArray->GetComponent(f, 3);
+      // set a limit on how tight the window can be
+      if (highVal - lowVal < 20)
+        {
+        highVal = lowVal + 20;
+        }
+      // make sure that WindowCenter will be an integer
+      if ((highVal - lowVal) % 2 != 0)
+        {
+        if (lowVal > 0)
+          {
+          lowVal--;
+          }
+        else
+          {
+          highVal--;
+          }
+        }
+      vtkDICOMItem frameVOILUT;
+      frameVOILUT.SetAttributeValue(
+        DC::WindowCenter, 0.5*(highVal + lowVal));
+      frameVOILUT.SetAttributeValue(
+        DC::WindowWidth, 1.0*(highVal - lowVal));
+      vtkDICOMSequence frameVOILUTSeq;
+      frameVOILUTSeq.AddItem(frameVOILUT);
+      frameItem.SetAttributeValue(
+        DC::FrameVOILUTSequence, frameVOILUTSeq);
+      }
+
+    perFrameSeq.AddItem(frameItem);
+    }
+
+  meta->SetAttributeValue(
+    DC::PerFrameFunctionalGroupsSequence, perFrameSeq);
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMGenerator::GenerateMultiFrameDimensionModule()
+{
+  vtkDICOMMetaData *meta = this->MetaData;
+  std::string uid = this->GenerateUID(DC::DimensionOrganizationUID);
+
+  vtkDICOMItem organization;
+  organization.SetAttributeValue(DC::DimensionOrganizationUID, uid);
+  vtkDICOMSequence organizationSeq;
+  organizationSeq.AddItem(organization);
+  meta->SetAttributeValue(
+    DC::DimensionOrganizationSequence, organizationSeq);
+
+  // the frames are indexed by their position in the stack, and by
+  // their temporal position if the data has a time dimension
+  vtkDICOMSequence dimensionSeq;
+  vtkDICOMItem stackDim;
+  stackDim.SetAttributeValue(DC::DimensionOrganizationUID, uid);
+  stackDim.SetAttributeValue(
+    DC::DimensionIndexPointer,
+    vtkDICOMValue(vtkDICOMVR::AT, vtkDICOMTag(DC::InStackPositionNumber)));
+  stackDim.SetAttributeValue(
+    DC::FunctionalGroupPointer,
+    vtkDICOMValue(vtkDICOMVR::AT, vtkDICOMTag(DC::FrameContentSequence)));
+  dimensionSeq.AddItem(stackDim);
+  if (this->Dimensions[3] > 1)
+    {
+    vtkDICOMItem timeDim;
+    timeDim.SetAttributeValue(DC::DimensionOrganizationUID, uid);
+    timeDim.SetAttributeValue(
+      DC::DimensionIndexPointer,
+      vtkDICOMValue(vtkDICOMVR::AT, vtkDICOMTag(DC::TemporalPositionIndex)));
+    timeDim.SetAttributeValue(
+      DC::FunctionalGroupPointer,
+      vtkDICOMValue(vtkDICOMVR::AT, vtkDICOMTag(DC::FrameContentSequence)));
+    dimensionSeq.AddItem(timeDim);
+    }
+  meta->SetAttributeValue(DC::DimensionIndexSequence, dimensionSeq);
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMGenerator::GenerateAcquisitionContextModule(
+  vtkDICOMMetaData *source)
+{
+  // the sequence is mandatory, but it is permitted to be empty
+  vtkDICOMMetaData *meta = this->MetaData;
+  meta->SetAttributeValue(
+    DC::AcquisitionContextSequence, vtkDICOMValue(vtkDICOMVR::SQ));
+
+  // optional and conditional: direct copy of values with no checks
+  static const DC::EnumType optional[] = {
+    DC::AcquisitionContextDescription,
+    DC::ItemDelimitationItem
+  };
+
+  return this->CopyOptionalAttributes(optional, source);
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMGenerator::GenerateDeviceModule(vtkDICOMMetaData *source)
 {
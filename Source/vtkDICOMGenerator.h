@@ -24,6 +24,7 @@ class vtkMatrix4x4;
 class vtkInformation;
 class vtkStringArray;
 class vtkDICOMMetaData;
+class vtkDICOMMetaDataAdapter;
 class vtkDICOMItem;
 class vtkDICOMUIDGenerator;
 
@@ -293,6 +294,23 @@ protected:
   //! Generate The DICOM Multi-frame Module.
   virtual bool GenerateMultiFrameModule(vtkDICOMMetaData *source);
 
+  //! Generate The DICOM Multi-frame Functional Groups Module.
+  /*!
+   *  This generates the shared and per-frame functional groups for
+   *  the enhanced multi-frame IODs.  Modality-specific functional
+   *  groups that are common to all frames can be supplied with the
+   *  sharedGroups item, they will be merged into the single item of
+   *  the SharedFunctionalGroupsSequence.
+   */
+  virtual bool GenerateMultiFrameFunctionalGroupsModule(
+    vtkDICOMMetaData *source, const vtkDICOMItem& sharedGroups);
+
+  //! Generate The DICOM Multi-frame Dimension Module.
+  virtual bool GenerateMultiFrameDimensionModule();
+
+  //! Generate The DICOM Acquisition Context Module.
+  virtual bool GenerateAcquisitionContextModule(vtkDICOMMetaData *source);
+
   //! Generate The DICOM Device Module.
   virtual bool GenerateDeviceModule(vtkDICOMMetaData *source);
 
@@ -367,6 +385,17 @@ protected:
   virtual void MatchInstances(vtkDICOMMetaData *source);
   //@}
 
+  //@{
+  //! Get an adapter for the source meta data, creating it on first use.
+  /*!
+   *  The adapter is cached for the duration of the generation run,
+   *  because constructing one indexes the functional groups of an
+   *  enhanced multi-frame source.  The cache is discarded whenever
+   *  the source meta data is set.
+   */
+  vtkDICOMMetaDataAdapter *GetSourceAdapter();
+  //@}
+
   //@{
   //! Initialize the meta data and compute the slice index array.
   /*!
@@ -383,6 +412,9 @@ protected:
   //! The source meta data.
   vtkDICOMMetaData *SourceMetaData;
 
+  //! The cached adapter for the source meta data.
+  vtkDICOMMetaDataAdapter *SourceAdapter;
+
   //! The UID generator.
   vtkDICOMUIDGenerator *UIDGenerator;
 
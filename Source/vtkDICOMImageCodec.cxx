@@ -15,86 +15,26 @@
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMUtilities.h"
 
-#include <stddef.h>
-
-//----------------------------------------------------------------------------
-const char *vtkDICOMImageCodec::UIDs[16] = {
-  "1.2.840.10008.1.2.1",     // LittleEndian
-  "1.2.840.10008.1.2.2",     // BigEndian
-  "1.2.840.10008.1.2.5",     // RLE
-  "1.2.840.10008.1.2.4.50",  // JPEGBaseline
-  "1.2.840.10008.1.2.4.51",  // JPEGExtended
-  "1.2.840.10008.1.2.4.57",  // JPEGLossless
-  "1.2.840.10008.1.2.4.70",  // JPEGPrediction
-  "1.2.840.10008.1.2.4.80",  // JPEGLS
-  "1.2.840.10008.1.2.4.81",  // JPEGLSConstrained
-  "1.2.840.10008.1.2.4.90",  // JPEG2K
-  "1.2.840.10008.1.2.4.91",  // JPEG2KLossless
-  "1.2.840.10008.1.2.4.100", // MPEG2ML
-  "1.2.840.10008.1.2.4.101", // MPEG2HL
-  "1.2.840.10008.1.2.4.102", // MPEG2HP
-  "1.2.840.10008.1.2.4.103", // MPEG2BD
-  0
-};
-
-//----------------------------------------------------------------------------
-vtkDICOMImageCodec::ImageFormat::ImageFormat(vtkDICOMMetaData *meta)
-{
-  this->Rows = meta->GetAttributeValue(DC::Rows).AsInt();
-  this->Columns = meta->GetAttributeValue(DC::Columns).AsInt();
-  this->BitsAllocated = meta->GetAttributeValue(DC::BitsAllocated).AsInt();
-  this->BitsStored = meta->GetAttributeValue(DC::BitsStored).AsInt();
-  this->PixelRepresentation =
-    meta->GetAttributeValue(DC::PixelRepresentation).AsInt();
-  this->SamplesPerPixel =
-    meta->GetAttributeValue(DC::SamplesPerPixel).AsInt();
-  this->PlanarConfiguration =
-    meta->GetAttributeValue(DC::PlanarConfiguration).AsInt();
-  const char *lossy =
-    meta->GetAttributeValue(DC::AllowLossyCompression).GetCharData();
-  this->AllowLossyCompression = (lossy && strncmp(lossy, "YES", 3) == 0);
-}
+#include "vtkMultiThreader.h"
 
-//----------------------------------------------------------------------------
-vtkDICOMImageCodec::vtkDICOMImageCodec(const std::string& tsyntax)
-{
-  int key = 255;
-  const char *ts = tsyntax.c_str();
-
-  for (int i = 0; i < NumberOfCodecs; i++)
-    {
-    if (strcmp(ts, vtkDICOMImageCodec::UIDs[i]) == 0)
-      {
-      key = i;
-      break;
-      }
-    }
-
-  this->Key = static_cast<unsigned char>(key);
-}
-
-//----------------------------------------------------------------------------
-std::string vtkDICOMImageCodec::GetTransferSyntaxUID() const
-{
-  const char *result = "";
-
-  if (this->Key < NumberOfCodecs)
-    {
-    result = vtkDICOMImageCodec::UIDs[this->Key];
-    }
+#include <stddef.h>
 
-  return result;
-}
+namespace {
 
 //----------------------------------------------------------------------------
-int vtkDICOMImageCodec::DecodeRLE(
-  const ImageFormat& image,
+// Decode a subset of the RLE segments of one fragment: the segments
+// decoded are "segment", "segment + stride", "segment + 2*stride", and
+// so on.  Each segment writes to a distinct byte plane of the output,
+// so disjoint subsets can be decoded concurrently.
+int vtkDICOMImageCodecRLESegments(
+  const vtkDICOMImageCodec::ImageFormat& image,
   const unsigned char *source, size_t sourceSize,
-  unsigned char *dest, size_t destSize)
+  unsigned char *dest, size_t destSize,
+  unsigned int segment, unsigned int stride)
 {
   const unsigned char *inPtr = source;
   unsigned char *outPtr = dest;
-  int errorCode = NoError;
+  int errorCode = vtkDICOMImageCodec::NoError;
 
   // get the number of segments and the segment size
   unsigned int n = vtkDICOMUtilities::UnpackUnsignedInt(inPtr);
@@ -117,8 +57,8 @@ int vtkDICOMImageCodec::DecodeRLE(
   endiancheck.c[0] = 1;
   endiancheck.c[1] = 0;
 
-  // loop over all RLE segments
-  for (unsigned int i = 0; i < n; i++)
+  // loop over the requested subset of the RLE segments
+  for (unsigned int i = segment; i < n; i += stride)
     {
     // sample position in pixel
     unsigned int s = i / bps;
@@ -196,7 +136,7 @@ int vtkDICOMImageCodec::DecodeRLE(
     if (remaining > 0)
       {
       // short read, clear remainder of dest
-      errorCode = MissingData;
+      errorCode = vtkDICOMImageCodec::MissingData;
       do
         {
         *dp = 0;
@@ -209,6 +149,427 @@ int vtkDICOMImageCodec::DecodeRLE(
   return errorCode;
 }
 
+//----------------------------------------------------------------------------
+// The information that is passed to the RLE decode threads.
+struct vtkDICOMImageCodecRLEThreadStruct
+{
+  const vtkDICOMImageCodec::ImageFormat *Image;
+  const unsigned char *const *Sources;
+  const size_t *SourceSizes;
+  size_t NumberOfFragments;
+  unsigned int SegmentsPerFrame;
+  unsigned char *Dest;
+  size_t FragmentSize;
+  int *ErrorCodes;
+  const int *AbortFlag;
+};
+
+//----------------------------------------------------------------------------
+// The table of decoders that have been registered at run time.
+vtkDICOMImageCodec::DecodeFunction
+vtkDICOMImageCodecDecoders[vtkDICOMImageCodec::NumberOfCodecs];
+
+//----------------------------------------------------------------------------
+// The table of reduced-resolution decoders registered at run time.
+vtkDICOMImageCodec::ReducedDecodeFunction
+vtkDICOMImageCodecReducedDecoders[vtkDICOMImageCodec::NumberOfCodecs];
+
+//----------------------------------------------------------------------------
+// The thread method: the work units are all (fragment, segment) pairs,
+// dealt out to the threads round-robin.  The stride passed down to the
+// segment decoder makes this correct even if a fragment declares a
+// different segment count than was computed from the image format.
+VTK_THREAD_RETURN_TYPE vtkDICOMImageCodecRLEThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *threadInfo =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMImageCodecRLEThreadStruct *info =
+    static_cast<vtkDICOMImageCodecRLEThreadStruct *>(threadInfo->UserData);
+  int threadId = threadInfo->ThreadID;
+  int threadCount = threadInfo->NumberOfThreads;
+
+  int errorCode = vtkDICOMImageCodec::NoError;
+  size_t totalUnits = info->NumberOfFragments*info->SegmentsPerFrame;
+  for (size_t u = threadId; u < totalUnits; u += threadCount)
+    {
+    // poll the abort flag between work units, so that an abandoned
+    // read releases its decode threads promptly
+    if (info->AbortFlag && *info->AbortFlag)
+      {
+      errorCode = vtkDICOMImageCodec::AbortedDecode;
+      break;
+      }
+    size_t f = u / info->SegmentsPerFrame;
+    unsigned int i = static_cast<unsigned int>(u % info->SegmentsPerFrame);
+    int e = vtkDICOMImageCodecRLESegments(
+      *info->Image, info->Sources[f], info->SourceSizes[f],
+      info->Dest + f*info->FragmentSize, info->FragmentSize,
+      i, info->SegmentsPerFrame);
+    if (e != vtkDICOMImageCodec::NoError)
+      {
+      errorCode = e;
+      }
+    }
+  info->ErrorCodes[threadId] = errorCode;
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+// Encode one RLE segment into its own buffer.  The buffer is allocated
+// here and must be freed by the caller with delete [].  The size that is
+// returned does not include the pad byte that odd-length segments need
+// when they are assembled into a fragment.
+void vtkDICOMImageCodecEncodeRLESegment(
+  const signed char *cp, unsigned int inInc,
+  unsigned short rowlen, size_t numrows,
+  unsigned char **segP, size_t *segSizeP)
+{
+  size_t segReserve = 4000;
+  unsigned char *seg = new unsigned char[segReserve];
+  signed char *dp = reinterpret_cast<signed char *>(seg);
+  size_t segSize = 0;
+
+  for (size_t j = 0; j < numrows; j++)
+    {
+    const signed char *ep = cp + rowlen*inInc;
+    while (cp != ep)
+      {
+      short maxcount = 128;
+      ptrdiff_t remainder = (ep - cp)/inInc;
+      maxcount = (remainder < maxcount ? remainder : maxcount);
+      short counter = maxcount;
+      const signed char *sp = cp;
+
+      // count repeated characters
+      signed char prev = *cp;
+      if (inInc == 1)
+        {
+        // the bytes of this segment are contiguous, so long runs can
+        // be skipped eight bytes at a time with one wide comparison
+        vtkTypeUInt64 wide = static_cast<unsigned char>(prev);
+        wide |= wide << 8;
+        wide |= wide << 16;
+        wide |= wide << 32;
+        while (counter > 8)
+          {
+          vtkTypeUInt64 w;
+          memcpy(&w, cp + 1, 8);
+          if (w != wide)
+            {
+            break;
+            }
+          cp += 8;
+          counter -= 8;
+          }
+        }
+      do
+        {
+        cp += inInc;
+        }
+      while (--counter != 0 && *cp == prev);
+
+      if (maxcount - counter > 1)
+        {
+        // negative count for repeating
+        counter = -(maxcount - counter - 1);
+        }
+      else if (counter > 0)
+        {
+        // count non-repeated bytes until a triplicate found
+        signed char pprev;
+        do
+          {
+          pprev = prev;
+          prev = *cp;
+          cp += inInc;
+          }
+        while (--counter != 0 && (*cp != prev || prev != pprev));
+
+        // positive count for literal
+        counter = maxcount - counter - 1;
+
+        // remove repeats at the end that can join with next run
+        if (remainder > counter + 1 && *cp == prev)
+          {
+          short reps = 1 + (prev == pprev);
+          reps = (reps < counter ? reps : counter);
+          counter -= reps;
+          cp -= reps*inInc;
+          }
+
+        // increment for the next offset into the segment
+        segSize += counter;
+        }
+
+      // at least two bytes are always written to the segment
+      segSize += 2;
+
+      // check whether the segment buffer is large enough
+      if (segSize > segReserve)
+        {
+        segReserve *= 2;
+        unsigned char *newseg = new unsigned char[segReserve];
+        size_t size = dp-reinterpret_cast<signed char *>(seg);
+        memcpy(newseg, seg, size);
+        delete [] seg;
+        seg = newseg;
+        dp = reinterpret_cast<signed char *>(seg + size);
+        }
+
+      // write the results
+      *dp++ = counter;
+      do
+        {
+        *dp++ = *sp;
+        sp += inInc;
+        }
+      while (--counter >= 0);
+      }
+    }
+
+  *segP = seg;
+  *segSizeP = segSize;
+}
+
+//----------------------------------------------------------------------------
+// The information that is passed to the RLE encode threads.
+struct vtkDICOMImageCodecRLEEncodeThreadStruct
+{
+  const signed char *const *Sources;
+  unsigned int InputIncrement;
+  unsigned short RowLength;
+  size_t NumberOfRows;
+  unsigned int NumberOfSegments;
+  unsigned char **Segments;
+  size_t *SegmentSizes;
+};
+
+//----------------------------------------------------------------------------
+// The thread method: the work units are the RLE segments, dealt out to
+// the threads round-robin.  Each segment is encoded into its own buffer,
+// because the size of a segment is not known until it has been encoded.
+VTK_THREAD_RETURN_TYPE vtkDICOMImageCodecRLEEncodeThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *threadInfo =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMImageCodecRLEEncodeThreadStruct *info =
+    static_cast<vtkDICOMImageCodecRLEEncodeThreadStruct *>(
+      threadInfo->UserData);
+  unsigned int threadId = threadInfo->ThreadID;
+  unsigned int threadCount = threadInfo->NumberOfThreads;
+
+  for (unsigned int i = threadId; i < info->NumberOfSegments;
+       i += threadCount)
+    {
+    vtkDICOMImageCodecEncodeRLESegment(
+      info->Sources[i], info->InputIncrement,
+      info->RowLength, info->NumberOfRows,
+      &info->Segments[i], &info->SegmentSizes[i]);
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+const char *vtkDICOMImageCodec::UIDs[16] = {
+  "1.2.840.10008.1.2.1",     // LittleEndian
+  "1.2.840.10008.1.2.2",     // BigEndian
+  "1.2.840.10008.1.2.5",     // RLE
+  "1.2.840.10008.1.2.4.50",  // JPEGBaseline
+  "1.2.840.10008.1.2.4.51",  // JPEGExtended
+  "1.2.840.10008.1.2.4.57",  // JPEGLossless
+  "1.2.840.10008.1.2.4.70",  // JPEGPrediction
+  "1.2.840.10008.1.2.4.80",  // JPEGLS
+  "1.2.840.10008.1.2.4.81",  // JPEGLSConstrained
+  "1.2.840.10008.1.2.4.90",  // JPEG2K
+  "1.2.840.10008.1.2.4.91",  // JPEG2KLossless
+  "1.2.840.10008.1.2.4.100", // MPEG2ML
+  "1.2.840.10008.1.2.4.101", // MPEG2HL
+  "1.2.840.10008.1.2.4.102", // MPEG2HP
+  "1.2.840.10008.1.2.4.103", // MPEG2BD
+  0
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMImageCodec::ImageFormat::ImageFormat(vtkDICOMMetaData *meta)
+{
+  this->Rows = meta->GetAttributeValue(DC::Rows).AsInt();
+  this->Columns = meta->GetAttributeValue(DC::Columns).AsInt();
+  this->BitsAllocated = meta->GetAttributeValue(DC::BitsAllocated).AsInt();
+  this->BitsStored = meta->GetAttributeValue(DC::BitsStored).AsInt();
+  this->PixelRepresentation =
+    meta->GetAttributeValue(DC::PixelRepresentation).AsInt();
+  this->SamplesPerPixel =
+    meta->GetAttributeValue(DC::SamplesPerPixel).AsInt();
+  this->PlanarConfiguration =
+    meta->GetAttributeValue(DC::PlanarConfiguration).AsInt();
+  const char *lossy =
+    meta->GetAttributeValue(DC::AllowLossyCompression).GetCharData();
+  this->AllowLossyCompression = (lossy && strncmp(lossy, "YES", 3) == 0);
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMImageCodec::vtkDICOMImageCodec(const std::string& tsyntax)
+{
+  int key = 255;
+  const char *ts = tsyntax.c_str();
+
+  for (int i = 0; i < NumberOfCodecs; i++)
+    {
+    if (strcmp(ts, vtkDICOMImageCodec::UIDs[i]) == 0)
+      {
+      key = i;
+      break;
+      }
+    }
+
+  this->Key = static_cast<unsigned char>(key);
+  this->AbortFlag = 0;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMImageCodec::GetTransferSyntaxUID() const
+{
+  const char *result = "";
+
+  if (this->Key < NumberOfCodecs)
+    {
+    result = vtkDICOMImageCodec::UIDs[this->Key];
+    }
+
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMImageCodec::RegisterDecoder(int key, DecodeFunction decoder)
+{
+  if (key >= 0 && key < NumberOfCodecs)
+    {
+    vtkDICOMImageCodecDecoders[key] = decoder;
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMImageCodec::DecodeFunction vtkDICOMImageCodec::GetDecoder(int key)
+{
+  DecodeFunction decoder = 0;
+  if (key >= 0 && key < NumberOfCodecs)
+    {
+    decoder = vtkDICOMImageCodecDecoders[key];
+    }
+  return decoder;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMImageCodec::RegisterReducedDecoder(
+  int key, ReducedDecodeFunction decoder)
+{
+  if (key >= 0 && key < NumberOfCodecs)
+    {
+    vtkDICOMImageCodecReducedDecoders[key] = decoder;
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMImageCodec::ReducedDecodeFunction
+vtkDICOMImageCodec::GetReducedDecoder(int key)
+{
+  ReducedDecodeFunction decoder = 0;
+  if (key >= 0 && key < NumberOfCodecs)
+    {
+    decoder = vtkDICOMImageCodecReducedDecoders[key];
+    }
+  return decoder;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::DecodeRLE(
+  const ImageFormat& image,
+  const unsigned char *source, size_t sourceSize,
+  unsigned char *dest, size_t destSize)
+{
+  return vtkDICOMImageCodecRLESegments(
+    image, source, sourceSize, dest, destSize, 0, 1);
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::DecodeRLEFragments(
+  const ImageFormat& image,
+  const unsigned char *const *sources, const size_t *sourceSizes,
+  size_t numFragments,
+  unsigned char *dest, size_t destSize, const int *abortFlag)
+{
+  int errorCode = NoError;
+
+  // compute the expected number of segments per frame, which sets the
+  // granularity at which the work is divided between the threads
+  unsigned int spp = image.SamplesPerPixel;
+  spp = (spp == 0 ? 1 : spp);
+  unsigned int bps = (image.BitsAllocated + 7)/8;
+  bps = (bps == 0 ? 1 : bps);
+  unsigned int n = spp*bps;
+  n = (n == 0 || n > 15 ? 1 : n);
+
+  size_t totalUnits = numFragments*n;
+  if (totalUnits > 1 && numFragments*destSize >= 65536)
+    {
+    // decode the (fragment, segment) work units concurrently
+    vtkDICOMImageCodecRLEThreadStruct info;
+    info.Image = &image;
+    info.Sources = sources;
+    info.SourceSizes = sourceSizes;
+    info.NumberOfFragments = numFragments;
+    info.SegmentsPerFrame = n;
+    info.Dest = dest;
+    info.FragmentSize = destSize;
+    info.AbortFlag = abortFlag;
+
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    int threadCount = threader->GetNumberOfThreads();
+    threadCount = (totalUnits < static_cast<size_t>(threadCount) ?
+                   static_cast<int>(totalUnits) : threadCount);
+    int *errorCodes = new int[threadCount];
+    info.ErrorCodes = errorCodes;
+
+    threader->SetNumberOfThreads(threadCount);
+    threader->SetSingleMethod(&vtkDICOMImageCodecRLEThread, &info);
+    threader->SingleMethodExecute();
+    threader->Delete();
+
+    for (int t = 0; t < threadCount; t++)
+      {
+      if (errorCodes[t] != NoError)
+        {
+        errorCode = errorCodes[t];
+        }
+      }
+    delete [] errorCodes;
+    }
+  else
+    {
+    // too little work to benefit from threads
+    for (size_t f = 0; f < numFragments; f++)
+      {
+      if (abortFlag && *abortFlag)
+        {
+        errorCode = AbortedDecode;
+        break;
+        }
+      int e = vtkDICOMImageCodecRLESegments(
+        image, sources[f], sourceSizes[f], dest + f*destSize, destSize, 0, 1);
+      if (e != NoError)
+        {
+        errorCode = e;
+        }
+      }
+    }
+
+  return errorCode;
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMImageCodec::EncodeRLE(
   const ImageFormat& image,
@@ -241,19 +602,6 @@ int vtkDICOMImageCodec::EncodeRLE(
   size_t segInc = (image.PlanarConfiguration ? segmentSize : 1);
   segInc *= bps;
 
-  // allocate the destination buffer
-  size_t destReserve = 4000;
-  unsigned char *dest = new unsigned char[destReserve];
-
-  // write the table
-  vtkDICOMUtilities::PackUnsignedInt(n, dest);
-  for (unsigned int i = 0; i < 15; i++)
-    {
-    vtkDICOMUtilities::PackUnsignedInt(0, dest + 4*(i + 1));
-    }
-
-  // the offset to the first segment
-  unsigned int offset = 64;
   unsigned short rowlen = image.Columns;
   size_t numrows = sourceSize/(n*rowlen);
 
@@ -262,12 +610,10 @@ int vtkDICOMImageCodec::EncodeRLE(
   endiancheck.c[0] = 1;
   endiancheck.c[1] = 0;
 
-  // loop over all RLE segments
-  // write the segments
+  // compute the input position of each segment
+  const signed char *sources[15];
   for (unsigned int i = 0; i < n; i++)
     {
-    // write the offset into the table
-    vtkDICOMUtilities::PackUnsignedInt(offset, dest + 4*(i + 1));
     // sample position in pixel
     unsigned int s = i / bps;
     // byte position in sample
@@ -278,94 +624,74 @@ int vtkDICOMImageCodec::EncodeRLE(
       {
       inOffset = s*segInc + (bps - b - 1);
       }
-    const signed char *cp =
-      reinterpret_cast<const signed char *>(source + inOffset);
-    signed char *dp = reinterpret_cast<signed char *>(dest + offset);
-
-    for (size_t j = 0; j < numrows; j++)
-      {
-      const signed char *ep = cp + rowlen*inInc;
-      while (cp != ep)
-        {
-        short maxcount = 128;
-        ptrdiff_t remainder = (ep - cp)/inInc;
-        maxcount = (remainder < maxcount ? remainder : maxcount);
-        short counter = maxcount;
-        const signed char *sp = cp;
-
-        // count repeated characters
-        signed char prev = *cp;
-        do
-          {
-          cp += inInc;
-          }
-        while (--counter != 0 && *cp == prev);
-
-        if (maxcount - counter > 1)
-          {
-          // negative count for repeating
-          counter = -(maxcount - counter - 1);
-          }
-        else if (counter > 0)
-          {
-          // count non-repeated bytes until a triplicate found
-          signed char pprev;
-          do
-            {
-            pprev = prev;
-            prev = *cp;
-            cp += inInc;
-            }
-          while (--counter != 0 && (*cp != prev || prev != pprev));
-
-          // positive count for literal
-          counter = maxcount - counter - 1;
-
-          // remove repeats at the end that can join with next run
-          if (remainder > counter + 1 && *cp == prev)
-            {
-            short reps = 1 + (prev == pprev);
-            reps = (reps < counter ? reps : counter);
-            counter -= reps;
-            cp -= reps*inInc;
-            }
+    sources[i] = reinterpret_cast<const signed char *>(source + inOffset);
+    }
 
-          // increment for the next offset into the destination
-          offset += counter;
-          }
+  // encode each segment into its own buffer
+  unsigned char *segments[15];
+  size_t segmentSizes[15];
 
-        // at least two bytes are always written to destination
-        offset += 2;
+  if (n > 1 && sourceSize >= 65536)
+    {
+    // the segments are independent streams, encode them concurrently
+    vtkDICOMImageCodecRLEEncodeThreadStruct info;
+    info.Sources = sources;
+    info.InputIncrement = inInc;
+    info.RowLength = rowlen;
+    info.NumberOfRows = numrows;
+    info.NumberOfSegments = n;
+    info.Segments = segments;
+    info.SegmentSizes = segmentSizes;
+
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    int threadCount = threader->GetNumberOfThreads();
+    threadCount = (n < static_cast<unsigned int>(threadCount) ?
+                   static_cast<int>(n) : threadCount);
+    threader->SetNumberOfThreads(threadCount);
+    threader->SetSingleMethod(&vtkDICOMImageCodecRLEEncodeThread, &info);
+    threader->SingleMethodExecute();
+    threader->Delete();
+    }
+  else
+    {
+    // too little work to benefit from threads
+    for (unsigned int i = 0; i < n; i++)
+      {
+      vtkDICOMImageCodecEncodeRLESegment(
+        sources[i], inInc, rowlen, numrows, &segments[i], &segmentSizes[i]);
+      }
+    }
 
-        // check whether destination buffer is large enough
-        if (offset > destReserve)
-          {
-          destReserve *= 2;
-          unsigned char *newdest = new unsigned char[destReserve];
-          size_t size = dp-reinterpret_cast<signed char *>(dest);
-          memcpy(newdest, dest, size);
-          delete [] dest;
-          dest = newdest;
-          dp = reinterpret_cast<signed char *>(dest + size);
-          }
+  // the segments follow the 64-byte table in the fragment, and each
+  // segment is padded to an even number of bytes
+  size_t destSize = 64;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    destSize += segmentSizes[i] + (segmentSizes[i] & 1);
+    }
+  unsigned char *dest = new unsigned char[destSize];
 
-        // write the results
-        *dp++ = counter;
-        do
-          {
-          *dp++ = *sp;
-          sp += inInc;
-          }
-        while (--counter >= 0);
-        }
-      }
+  // write the table
+  vtkDICOMUtilities::PackUnsignedInt(n, dest);
+  for (unsigned int i = 0; i < 15; i++)
+    {
+    vtkDICOMUtilities::PackUnsignedInt(0, dest + 4*(i + 1));
+    }
 
+  // write the segments
+  unsigned int offset = 64;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    // write the offset into the table
+    vtkDICOMUtilities::PackUnsignedInt(offset, dest + 4*(i + 1));
+    memcpy(dest + offset, segments[i], segmentSizes[i]);
+    offset += static_cast<unsigned int>(segmentSizes[i]);
     // add a pad byte to the segment if needed
     if ((offset & 1) != 0)
       {
-      offset++;
-      *dp = 0;
+      dest[offset++] = 0;
       }
+    delete [] segments[i];
     }
 
   *destP = dest;
@@ -397,6 +723,55 @@ int vtkDICOMImageCodec::Decode(
     {
     code = DecodeRLE(image, source, sourceSize, dest, destSize);
     }
+  else
+    {
+    DecodeFunction decoder = vtkDICOMImageCodec::GetDecoder(this->Key);
+    if (decoder)
+      {
+      code = decoder(image, source, sourceSize, dest, destSize);
+      }
+    }
+
+  return code;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::DecodeFragments(
+  const ImageFormat& image,
+  const unsigned char *const *sources, const size_t *sourceSizes,
+  size_t numFragments,
+  unsigned char *dest, size_t destSize) const
+{
+  int code = MissingCodec;
+  if (this->Key == RLE)
+    {
+    code = DecodeRLEFragments(
+      image, sources, sourceSizes, numFragments, dest, destSize,
+      this->AbortFlag);
+    }
+  else
+    {
+    DecodeFunction decoder = vtkDICOMImageCodec::GetDecoder(this->Key);
+    if (decoder)
+      {
+      // decode serially, registered decoders might not be thread-safe
+      code = NoError;
+      for (size_t f = 0; f < numFragments; f++)
+        {
+        if (this->AbortFlag && *this->AbortFlag)
+          {
+          code = AbortedDecode;
+          break;
+          }
+        int e = decoder(image, sources[f], sourceSizes[f],
+                        dest + f*destSize, destSize);
+        if (e != NoError)
+          {
+          code = e;
+          }
+        }
+      }
+    }
 
   return code;
 }
@@ -54,7 +54,8 @@ public:
     MissingCodec,
     BadPixelFormat,
     MissingData,
-    UnknownError
+    UnknownError,
+    AbortedDecode
   };
 
   //! A struct to store basic image information for a codec
@@ -78,13 +79,14 @@ public:
 
   //@{
   //! Construct an object for the default codec (little endian uncompressed).
-  vtkDICOMImageCodec() : Key(0) {}
+  vtkDICOMImageCodec() : Key(0), AbortFlag(0) {}
 
   //! Construct a codec object from the given code.
   /*!
    *  The code can be any of the enumerated code values.
    */
-  vtkDICOMImageCodec(int k) : Key(static_cast<unsigned char>(k)) {}
+  vtkDICOMImageCodec(int k) :
+    Key(static_cast<unsigned char>(k)), AbortFlag(0) {}
 
   //! Get a codec for the specified transfer syntax UID.
   /*!
@@ -105,6 +107,22 @@ public:
   unsigned char GetKey() const { return this->Key; }
   //@}
 
+  //@{
+  //! Provide a flag that can cancel a decode in progress (default: none).
+  /*!
+   *  The flag is polled between the frames of DecodeFragments() (and
+   *  between the segments of RLE frames), so an abandoned read can
+   *  stop a large multi-frame decode with a latency of at most one
+   *  frame or segment.  When the flag becomes nonzero, no more work
+   *  is started and AbortedDecode is returned; frames that were not
+   *  yet decoded are left undefined.  The caller retains ownership of
+   *  the flag, which is typically the AbortExecute flag of a reader.
+   *  Pass a null pointer to make the decode uninterruptible again.
+   */
+  void SetAbortFlag(const int *flag) { this->AbortFlag = flag; }
+  const int *GetAbortFlag() const { return this->AbortFlag; }
+  //@}
+
   //@{
   //! Decode a compressed image into the given destination buffer.
   /*!
@@ -116,6 +134,20 @@ public:
              const unsigned char *source, size_t sourceSize,
              unsigned char *dest, size_t destSize) const;
 
+  //! Decode a series of compressed fragments into consecutive frames.
+  /*!
+   *  Each fragment is decoded into a frame of destSize bytes, so the
+   *  destination must be numFragments*destSize bytes in size.  The
+   *  fragments, and for RLE the segments within each fragment, are
+   *  independent of each other and are decoded concurrently in multiple
+   *  threads when the amount of data makes that worthwhile.  On error,
+   *  the error code is returned, and on success, zero is returned.
+   */
+  int DecodeFragments(const ImageFormat& image,
+                      const unsigned char *const *sources,
+                      const size_t *sourceSizes, size_t numFragments,
+                      unsigned char *dest, size_t destSize) const;
+
   //! Encode a compressed image, and return an allocated destination buffer.
   /*!
    *  The caller has the responsibility of calling "delete []" on the returned
@@ -126,6 +158,66 @@ public:
              unsigned char **dest, size_t *destSize) const;
   //@}
 
+  //@{
+  //! A function that decodes one compressed frame into a buffer.
+  /*!
+   *  The function must decompress the frame in the source buffer and
+   *  write the result directly into the destination buffer, which will
+   *  be destSize bytes in size.  It must return one of the ErrorCode
+   *  values (zero on success).
+   */
+  typedef int (*DecodeFunction)(
+    const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char *dest, size_t destSize);
+
+  //! Register a decoder for one of the enumerated codecs.
+  /*!
+   *  This allows decoders for codecs that are not built in, such as
+   *  JPEGBaseline, JPEGLossless, JPEGLS, or JPEG2K, to be supplied at
+   *  run time.  A registered decoder is used by Decode() and
+   *  DecodeFragments(), and writes decompressed frames directly into
+   *  the buffer provided by the caller.  Registering a null pointer
+   *  removes the decoder for that codec.  Registration is not guarded
+   *  by a lock, so decoders should be registered before any files are
+   *  read.
+   */
+  static void RegisterDecoder(int key, DecodeFunction decoder);
+
+  //! Get the decoder registered for a codec, or a null pointer.
+  static DecodeFunction GetDecoder(int key);
+  //@}
+
+  //@{
+  //! A function that decodes one frame at reduced resolution.
+  /*!
+   *  This is like DecodeFunction, except that the frame is decimated
+   *  as it is decoded: only every "stride"th row and column is written
+   *  to the destination, which holds ceil(Rows/stride) by
+   *  ceil(Columns/stride) pixels and is destSize bytes in size.
+   *  Codecs with an embedded multi-resolution representation (such as
+   *  JPEG 2000) can satisfy this by decoding a lower resolution level
+   *  rather than by skipping pixels.
+   */
+  typedef int (*ReducedDecodeFunction)(
+    const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char *dest, size_t destSize, int stride);
+
+  //! Register a reduced-resolution decoder for one of the codecs.
+  /*!
+   *  A reduced-resolution decoder is used by vtkDICOMReader when a
+   *  preview resolution has been requested.  If no reduced decoder
+   *  is registered for a codec, then the frames are decoded at full
+   *  resolution and decimated afterwards.  Registering a null pointer
+   *  removes the reduced decoder for that codec.
+   */
+  static void RegisterReducedDecoder(int key, ReducedDecodeFunction decoder);
+
+  //! Get the reduced-resolution decoder for a codec, or a null pointer.
+  static ReducedDecodeFunction GetReducedDecoder(int key);
+  //@}
+
   //@{
   bool operator==(vtkDICOMImageCodec b) const { return (this->Key == b.Key); }
   bool operator!=(vtkDICOMImageCodec b) const { return (this->Key != b.Key); }
@@ -137,6 +229,7 @@ public:
 
 private:
   unsigned char Key;
+  const int *AbortFlag;
   static const char *UIDs[16];
 
   static int DecodeRLE(
@@ -144,6 +237,12 @@ private:
     const unsigned char *source, size_t sourceSize,
     unsigned char *dest, size_t destSize);
 
+  static int DecodeRLEFragments(
+    const ImageFormat& image,
+    const unsigned char *const *sources, const size_t *sourceSizes,
+    size_t numFragments,
+    unsigned char *dest, size_t destSize, const int *abortFlag);
+
   static int EncodeRLE(
     const ImageFormat& image,
     const unsigned char *source, size_t sourceSize,
@@ -18,10 +18,21 @@
 
 #include <assert.h>
 
+#include <algorithm>
+#include <vector>
+
 //----------------------------------------------------------------------------
 // For use by methods that must return an invalid value
 const vtkDICOMValue vtkDICOMItem::InvalidValue;
 
+//----------------------------------------------------------------------------
+// Order data element pointers by tag, for use with stable_sort.
+static bool vtkDICOMItemCompareElements(
+  const vtkDICOMDataElement *e1, const vtkDICOMDataElement *e2)
+{
+  return (e1->GetTag() < e2->GetTag());
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMItem::vtkDICOMItem(vtkDICOMMetaData *meta)
 {
@@ -65,23 +76,15 @@ vtkDICOMDataElement *vtkDICOMItem::NewDataElement(vtkDICOMDataElement **iter)
 {
   int n = this->L->NumberOfDataElements;
 
-  // if no data elements yet, then allocate four
-  if (this->L->DataElements == 0)
-    {
-    this->L->DataElements = new vtkDICOMDataElement[4];
-    }
-  // if n is a power of two, double allocated space
-  else if (n >= 4 && (n & (n-1)) == 0)
+  // grow the allocation whenever it is full, doubling each time
+  if (n == this->L->Capacity)
     {
-    // but first check if a free element exists
-    do { --n; } while (n > 0 && this->L->DataElements[n].Next != 0);
-
-    if (this->L->DataElements[n].Next != 0)
+    int m = (n < 4 ? 4 : 2*n);
+    vtkDICOMDataElement *oldptr = this->L->DataElements;
+    this->L->DataElements = new vtkDICOMDataElement[m];
+    this->L->Capacity = m;
+    if (n > 0)
       {
-      // make a new, larger list
-      n = this->L->NumberOfDataElements;
-      vtkDICOMDataElement *oldptr = this->L->DataElements;
-      this->L->DataElements = new vtkDICOMDataElement[2*n];
       vtkDICOMItem::CopyDataElements(
         this->L->Head.Next, &this->L->Tail, this->L);
       if (iter)
@@ -93,8 +96,8 @@ vtkDICOMDataElement *vtkDICOMItem::NewDataElement(vtkDICOMDataElement **iter)
         while (tptr != &this->L->Tail);
         *iter = nptr;
         }
-      delete [] oldptr;
       }
+    delete [] oldptr;
     }
 
   return &this->L->DataElements[n];
@@ -113,6 +116,7 @@ void vtkDICOMItem::CopyList(const List *o, List *t)
 {
   t->ByteOffset = o->ByteOffset;
   t->Delimited = o->Delimited;
+  t->NumberOfDataElements = o->NumberOfDataElements;
 
   int n = o->NumberOfDataElements;
   if (n > 0)
@@ -129,6 +133,7 @@ void vtkDICOMItem::CopyList(const List *o, List *t)
     // allocate a minimum of 4 elements
     if (m < 4) { m = 4; }
     t->DataElements = new vtkDICOMDataElement[m];
+    t->Capacity = m;
     vtkDICOMItem::CopyDataElements(o->Head.Next, &o->Tail, t);
     }
 }
@@ -157,7 +162,7 @@ void vtkDICOMItem::CopyDataElements(
 }
 
 //----------------------------------------------------------------------------
-vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
+void vtkDICOMItem::MakeUnique()
 {
   // make a container if we don't have one yet
   if (this->L == 0)
@@ -174,6 +179,12 @@ vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
     this->Clear();
     this->L = t;
     }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
+{
+  this->MakeUnique();
 
   // find the insert location in the linked list
   vtkDICOMDataElement *tptr = &this->L->Tail;
@@ -375,6 +386,122 @@ void vtkDICOMItem::SetAttributeValue(vtkDICOMTag tag, const std::string& v)
   this->SetAttributeValue(vtkDICOMTagPath(tag), v);
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMItem::Reserve(int n)
+{
+  this->MakeUnique();
+
+  if (n > this->L->Capacity)
+    {
+    vtkDICOMDataElement *oldptr = this->L->DataElements;
+    this->L->DataElements = new vtkDICOMDataElement[n];
+    this->L->Capacity = n;
+    if (this->L->NumberOfDataElements > 0)
+      {
+      vtkDICOMItem::CopyDataElements(
+        this->L->Head.Next, &this->L->Tail, this->L);
+      }
+    delete [] oldptr;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMItem::AppendAttributeValue(
+  vtkDICOMTag tag, const vtkDICOMValue& v)
+{
+  if (!v.IsValid())
+    {
+    // invalid values are simply not added
+    return;
+    }
+
+  this->MakeUnique();
+
+  // append at the tail, Sort() will move the element into place
+  vtkDICOMDataElement *tptr = this->L->Tail.Prev;
+  vtkDICOMDataElement *e = this->NewDataElement(&tptr);
+  e->Tag = tag;
+  e->Value = v;
+  e->Prev = tptr;
+  e->Next = tptr->Next;
+  e->Prev->Next = e;
+  e->Next->Prev = e;
+  this->L->NumberOfDataElements++;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMItem::Sort()
+{
+  if (this->L == 0 || this->L->NumberOfDataElements < 2)
+    {
+    return;
+    }
+
+  this->MakeUnique();
+
+  // gather the elements in their current order
+  size_t n = this->L->NumberOfDataElements;
+  std::vector<vtkDICOMDataElement *> elems;
+  elems.reserve(n);
+  for (vtkDICOMDataElement *ep = this->L->Head.Next;
+       ep != &this->L->Tail; ep = ep->Next)
+    {
+    elems.push_back(ep);
+    }
+
+  // check the order first, items are often built in sorted order
+  size_t k = 1;
+  while (k < n && elems[k-1]->Tag < elems[k]->Tag) { k++; }
+  if (k == n)
+    {
+    return;
+    }
+
+  std::stable_sort(elems.begin(), elems.end(),
+                   vtkDICOMItemCompareElements);
+
+  // copy out the sorted tags and values (the values are cheap to
+  // copy, since they are reference counted), keeping only the value
+  // that was appended last whenever a tag appears more than once
+  std::vector<vtkDICOMTag> tags;
+  std::vector<vtkDICOMValue> values;
+  tags.reserve(n);
+  values.reserve(n);
+  for (size_t i = 0; i < n; i++)
+    {
+    if (i+1 < n && elems[i+1]->Tag == elems[i]->Tag)
+      {
+      continue;
+      }
+    tags.push_back(elems[i]->Tag);
+    values.push_back(elems[i]->Value);
+    }
+
+  // write the elements back in sorted order and relink the list
+  size_t m = tags.size();
+  vtkDICOMDataElement *dp = this->L->DataElements;
+  for (size_t i = 0; i < m; i++)
+    {
+    dp[i].Tag = tags[i];
+    dp[i].Value = values[i];
+    dp[i].Next = &dp[i+1];
+    dp[i].Prev = &dp[i-1];
+    }
+  // clear any slots that held values for duplicated tags
+  for (size_t i = m; i < n; i++)
+    {
+    dp[i].Tag = vtkDICOMTag();
+    dp[i].Value = vtkDICOMValue();
+    dp[i].Next = 0;
+    dp[i].Prev = 0;
+    }
+  dp[0].Prev = &this->L->Head;
+  dp[m-1].Next = &this->L->Tail;
+  this->L->Head.Next = &dp[0];
+  this->L->Tail.Prev = &dp[m-1];
+  this->L->NumberOfDataElements = static_cast<int>(m);
+}
+
 //----------------------------------------------------------------------------
 const vtkDICOMValue &vtkDICOMItem::GetAttributeValue(
   vtkDICOMTag tag) const
@@ -41,6 +41,7 @@ private:
     vtkDICOMDataElement Tail;
     vtkDICOMReferenceCount ReferenceCount;
     int NumberOfDataElements;
+    int Capacity;
     vtkDICOMDataElement *DataElements;
     unsigned int ByteOffset;
     bool Delimited;
@@ -48,7 +49,7 @@ private:
     vtkDICOMVR VRForXS;
 
     List() : Head(), Tail(), ReferenceCount(1),
-             NumberOfDataElements(0), DataElements(0),
+             NumberOfDataElements(0), Capacity(0), DataElements(0),
              ByteOffset(0), Delimited(false),
              CharacterSet(vtkDICOMCharacterSet::ISO_IR_6),
              VRForXS(vtkDICOMVR::US) {}
@@ -102,6 +103,17 @@ public:
     return (this->L == 0 || this->L->Delimited != 0); }
   //@}
 
+  //@{
+  //! Exchange the contents of this item with another item.
+  /*!
+   *  Unlike assignment, this is a constant-time operation that does
+   *  not modify the reference counts.  Use it to transfer an item into
+   *  a container when the original is no longer needed.
+   */
+  void Swap(vtkDICOMItem& o) {
+    List *t = this->L; this->L = o.L; o.L = t; }
+  //@}
+
   //@{
   //! Add a data element to this item.
   /*!
@@ -126,6 +138,36 @@ public:
   void SetAttributeValue(const vtkDICOMTagPath& tag, const std::string& v);
   //@}
 
+  //@{
+  //! Reserve storage for the given number of data elements.
+  /*!
+   *  Use this before adding a known number of attributes, so that
+   *  the element storage is allocated just once instead of being
+   *  repeatedly doubled while the item grows.
+   */
+  void Reserve(int n);
+
+  //! Add a data element without maintaining sorted order.
+  /*!
+   *  This appends the data element at the end of the item rather
+   *  than inserting it at its sorted position, so that an item can
+   *  be built from n attributes with O(n) cost even when the
+   *  attributes do not arrive in ascending order by tag.  After
+   *  the last attribute has been appended, Sort() must be called
+   *  before the item is used, since every other method requires
+   *  the elements to be in sorted order.
+   */
+  void AppendAttributeValue(vtkDICOMTag tag, const vtkDICOMValue& v);
+
+  //! Sort the data elements into ascending order by tag.
+  /*!
+   *  This finalizes an item that was built with AppendAttributeValue().
+   *  If the same tag was appended more than once, only the value that
+   *  was appended last is kept.
+   */
+  void Sort();
+  //@}
+
   //@{
   //! Get a data element from this item.
   const vtkDICOMValue &GetAttributeValue(vtkDICOMTag tag) const;
@@ -214,6 +256,7 @@ public:
 
 private:
   void FreeList();
+  void MakeUnique();
   vtkDICOMDataElement *NewDataElement(vtkDICOMDataElement **iter);
   static void CopyList(const List *o, List *t);
   static void CopyDataElements(
@@ -350,32 +350,54 @@ void vtkDICOMLookupTable::BuildImagePalette(
 
   if (maxValue > minValue)
     {
-    // Generate the lookup table
+    // Generate the lookup table, expanding one channel at a time so
+    // that the inner loops are free of branches
+    int total = maxValue - minValue + 1;
     this->SetRange(minValue, maxValue);
-    this->SetNumberOfColors(maxValue - minValue + 1);
-    unsigned char *cptr = this->WritePointer(0, maxValue - minValue + 1);
-    for (int i = minValue; i <= maxValue; i++)
+    this->SetNumberOfColors(total);
+    unsigned char *cptr = this->WritePointer(0, total);
+    for (int j = 0; j < 4; j++)
       {
-      double rgba[4] = { 0.0, 0.0, 0.0, 1.0 };
-      for (int j = 0; j < 4; j++)
+      unsigned char *op = cptr + j;
+      if (spp[j] == 0 && cpp[j] == 0)
         {
-        int k = i - firstValue[j];
-        k = (i >= firstValue[j] ? k : 0);
-        k = (i <= lastValue[j] ? k : lastValue[j] - firstValue[j]);
-        if (spp[j])
+        // no data for this channel, alpha defaults to opaque
+        unsigned char c = (j == 3 ? 255 : 0);
+        for (int i = 0; i < total; i++)
           {
-          rgba[j] = spp[j][k] / divisor[j];
+          op[4*i] = c;
           }
-        else if (cpp[j])
+        continue;
+        }
+      double scale = 255.0/divisor[j];
+      int lo = firstValue[j] - minValue;
+      int hi = lastValue[j] - minValue + 1;
+      if (spp[j])
+        {
+        for (int i = lo; i < hi; i++)
           {
-          rgba[j] = cpp[j][k] / divisor[j];
+          op[4*i] = static_cast<unsigned char>(spp[j][i - lo]*scale + 0.5);
           }
         }
-      cptr[0] = static_cast<unsigned char>(rgba[0]*255.0 + 0.5);
-      cptr[1] = static_cast<unsigned char>(rgba[1]*255.0 + 0.5);
-      cptr[2] = static_cast<unsigned char>(rgba[2]*255.0 + 0.5);
-      cptr[3] = static_cast<unsigned char>(rgba[3]*255.0 + 0.5);
-      cptr += 4;
+      else
+        {
+        for (int i = lo; i < hi; i++)
+          {
+          op[4*i] = static_cast<unsigned char>(cpp[j][i - lo]*scale + 0.5);
+          }
+        }
+      // entries below the first mapped pixel value clamp to the first
+      // table entry, entries above the last clamp to the last entry
+      unsigned char head = op[4*lo];
+      unsigned char tail = op[4*(hi - 1)];
+      for (int i = 0; i < lo; i++)
+        {
+        op[4*i] = head;
+        }
+      for (int i = hi; i < total; i++)
+        {
+        op[4*i] = tail;
+        }
       }
     }
   this->Modified();
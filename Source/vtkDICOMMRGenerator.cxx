@@ -197,6 +197,150 @@ bool vtkDICOMMRGenerator::GenerateMRImageModule(vtkDICOMMetaData *source)
           this->CopyOptionalAttributes(optional, source));
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMMRGenerator::GenerateEnhancedMRImageModule(
+  vtkDICOMMetaData *source)
+{
+  // ImageType is specialized from GeneralImageModule: for enhanced MR
+  // it has four mandatory values, where the third value is the image
+  // flavor and the fourth value is the derived pixel contrast
+  vtkDICOMMetaData *meta = this->MetaData;
+  vtkDICOMValue imageType;
+  if (source)
+    {
+    imageType = source->GetAttributeValue(DC::ImageType);
+    }
+  if (imageType.GetNumberOfValues() != 4)
+    {
+    imageType = vtkDICOMValue(
+      vtkDICOMVR::CS, "DERIVED\\SECONDARY\\OTHER\\NONE");
+    }
+  meta->SetAttributeValue(DC::ImageType, imageType);
+
+  // these are mandatory for the enhanced image modules
+  meta->SetAttributeValue(DC::PixelPresentation, "MONOCHROME");
+  meta->SetAttributeValue(DC::VolumetricProperties, "VOLUME");
+  meta->SetAttributeValue(DC::VolumeBasedCalculationTechnique, "NONE");
+  meta->SetAttributeValue(DC::BurnedInAnnotation, "NO");
+  meta->SetAttributeValue(DC::LossyImageCompression, "00");
+  meta->SetAttributeValue(DC::PresentationLUTShape, "IDENTITY");
+
+  // required items: use simple read/write validation
+  static const DC::EnumType required[] = {
+    DC::AcquisitionNumber,
+    DC::AcquisitionDateTime,
+    DC::ItemDelimitationItem
+  };
+
+  // optional and conditional: direct copy of values with no checks
+  static const DC::EnumType optional[] = {
+    DC::AcquisitionDuration, // 1C
+    DC::ContentQualification,
+    DC::ResonantNucleus,
+    DC::ImageComments,
+    DC::AnatomicRegionSequence,
+    DC::PrimaryAnatomicStructureSequence,
+    DC::ItemDelimitationItem
+  };
+
+  return (this->CopyRequiredAttributes(required, source) &&
+          this->CopyOptionalAttributes(optional, source));
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMRGenerator::GenerateEnhancedMRInstance(vtkInformation *info)
+{
+  this->SetPixelRestrictions(
+    RepresentationSigned | RepresentationUnsigned,
+    BitsStored12 | BitsStored16,
+    1);
+
+  const char *SOPClass = "1.2.840.10008.5.1.4.1.1.4.1";
+  this->InitializeMetaData(info);
+
+  vtkDICOMMetaData *source = this->SourceMetaData;
+  if (!this->GenerateSOPCommonModule(source, SOPClass) ||
+      !this->GeneratePatientModule(source) ||
+      !this->GenerateClinicalTrialSubjectModule(source) ||
+      !this->GenerateGeneralStudyModule(source) ||
+      !this->GeneratePatientStudyModule(source) ||
+      !this->GenerateClinicalTrialStudyModule(source) ||
+      !this->GenerateGeneralSeriesModule(source) ||
+      !this->GenerateFrameOfReferenceModule(source) ||
+      !this->GenerateClinicalTrialSeriesModule(source) ||
+      !this->GenerateGeneralEquipmentModule(source) ||
+      !this->GenerateGeneralImageModule(source) ||
+      !this->GenerateImagePixelModule(source) ||
+      !this->GenerateContrastBolusModule(source) ||
+      !this->GenerateDeviceModule(source) ||
+      !this->GenerateSpecimenModule(source) ||
+      !this->GenerateMRSeriesModule(source) ||
+      !this->GenerateEnhancedMRImageModule(source) ||
+      !this->GenerateAcquisitionContextModule(source) ||
+      !this->GenerateMultiFrameDimensionModule())
+    {
+    return false;
+    }
+
+  // the frame type repeats the image type for every frame
+  vtkDICOMMetaData *meta = this->MetaData;
+  vtkDICOMItem frameType;
+  frameType.SetAttributeValue(
+    DC::FrameType, meta->GetAttributeValue(DC::ImageType));
+  frameType.SetAttributeValue(DC::PixelPresentation, "MONOCHROME");
+  frameType.SetAttributeValue(DC::VolumetricProperties, "VOLUME");
+  frameType.SetAttributeValue(
+    DC::VolumeBasedCalculationTechnique, "NONE");
+  frameType.SetAttributeValue(DC::ComplexImageComponent, "MAGNITUDE");
+  frameType.SetAttributeValue(DC::AcquisitionContrast, "UNKNOWN");
+  vtkDICOMSequence frameTypeSeq;
+  frameTypeSeq.AddItem(frameType);
+
+  vtkDICOMItem sharedGroups;
+  sharedGroups.SetAttributeValue(
+    DC::MRImageFrameTypeSequence, frameTypeSeq);
+
+  // carry the echo and timing parameters over from the source
+  if (source)
+    {
+    const vtkDICOMValue& te = source->GetAttributeValue(DC::EchoTime);
+    if (te.IsValid())
+      {
+      vtkDICOMItem echo;
+      echo.SetAttributeValue(DC::EffectiveEchoTime, te.AsDouble());
+      vtkDICOMSequence echoSeq;
+      echoSeq.AddItem(echo);
+      sharedGroups.SetAttributeValue(DC::MREchoSequence, echoSeq);
+      }
+
+    vtkDICOMItem timing;
+    static const DC::EnumType timingTags[] = {
+      DC::RepetitionTime,
+      DC::FlipAngle,
+      DC::EchoTrainLength,
+      DC::ItemDelimitationItem
+    };
+    for (int i = 0; timingTags[i] != DC::ItemDelimitationItem; i++)
+      {
+      const vtkDICOMValue& v = source->GetAttributeValue(timingTags[i]);
+      if (v.IsValid())
+        {
+        timing.SetAttributeValue(timingTags[i], v);
+        }
+      }
+    if (!timing.IsEmpty())
+      {
+      vtkDICOMSequence timingSeq;
+      timingSeq.AddItem(timing);
+      sharedGroups.SetAttributeValue(
+        DC::MRTimingAndRelatedParametersSequence, timingSeq);
+      }
+    }
+
+  return this->GenerateMultiFrameFunctionalGroupsModule(
+    source, sharedGroups);
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMMRGenerator::GenerateMRInstance(vtkInformation *info)
 {
@@ -241,8 +385,7 @@ bool vtkDICOMMRGenerator::GenerateInstance(vtkInformation *info)
 {
   if (this->MultiFrame)
     {
-    vtkErrorMacro("Enhanced Multi-Frame MR is not yet supported.");
-    return false;
+    return this->GenerateEnhancedMRInstance(info);
     }
 
   return this->GenerateMRInstance(info);
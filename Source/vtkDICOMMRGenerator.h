@@ -24,6 +24,7 @@
  *  are being written out as derived images after being processed.
  *  The specific IOD classes supported are as follows:
  *  - MR Image, 1.2.840.10008.5.1.4.1.1.4
+ *  - Enhanced MR Image, 1.2.840.10008.5.1.4.1.1.4.1
  */
 class VTKDICOM_EXPORT vtkDICOMMRGenerator : public vtkDICOMGenerator
 {
@@ -53,9 +54,15 @@ protected:
   //! Generate the Image Module.
   virtual bool GenerateMRImageModule(vtkDICOMMetaData *source);
 
+  //! Generate the Enhanced MR Image Module.
+  virtual bool GenerateEnhancedMRImageModule(vtkDICOMMetaData *source);
+
   //! Instantiate a DICOM Secondary Capture Image object.
   virtual bool GenerateMRInstance(vtkInformation *info);
 
+  //! Instantiate a DICOM Enhanced MR Image object.
+  virtual bool GenerateEnhancedMRInstance(vtkInformation *info);
+
 private:
   vtkDICOMMRGenerator(const vtkDICOMMRGenerator&);  // Not implemented.
   void operator=(const vtkDICOMMRGenerator&);  // Not implemented.
@@ -0,0 +1,216 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMMemoryGovernor.h"
+
+#include <vtkSimpleCriticalSection.h>
+
+// The lock that guards all of the static members of the governor.
+// The release callbacks are always invoked with this lock released.
+static vtkSimpleCriticalSection vtkDICOMMemoryGovernorLock;
+
+vtkTypeInt64 vtkDICOMMemoryGovernor::MemoryBudget;
+vtkTypeInt64 vtkDICOMMemoryGovernor::MemoryInUse;
+vtkDICOMMemoryGovernor::Client *vtkDICOMMemoryGovernor::Head;
+vtkDICOMMemoryGovernor::Client *vtkDICOMMemoryGovernor::Tail;
+unsigned int vtkDICOMMemoryGovernor::PassCounter;
+
+//----------------------------------------------------------------------------
+// Each registered client is a node in a doubly-linked list that is kept
+// ordered from the most recently active to the least recently active.
+struct vtkDICOMMemoryGovernor::Client
+{
+  ReleaseFunction Func;
+  void *Data;
+  vtkTypeInt64 Bytes;
+  unsigned int Pass;
+  bool InCallback;
+  Client *Prev;
+  Client *Next;
+};
+
+//----------------------------------------------------------------------------
+void vtkDICOMMemoryGovernor::SetMemoryBudget(vtkTypeInt64 bytes)
+{
+  vtkDICOMMemoryGovernorLock.Lock();
+  vtkDICOMMemoryGovernor::MemoryBudget = bytes;
+  if (bytes > 0 && vtkDICOMMemoryGovernor::MemoryInUse > bytes)
+    {
+    vtkDICOMMemoryGovernor::ApplyPressure(0);
+    }
+  vtkDICOMMemoryGovernorLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMMemoryGovernor::GetMemoryBudget()
+{
+  vtkDICOMMemoryGovernorLock.Lock();
+  vtkTypeInt64 bytes = vtkDICOMMemoryGovernor::MemoryBudget;
+  vtkDICOMMemoryGovernorLock.Unlock();
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMMemoryGovernor::GetMemoryInUse()
+{
+  vtkDICOMMemoryGovernorLock.Lock();
+  vtkTypeInt64 bytes = vtkDICOMMemoryGovernor::MemoryInUse;
+  vtkDICOMMemoryGovernorLock.Unlock();
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+void *vtkDICOMMemoryGovernor::AddClient(ReleaseFunction func, void *data)
+{
+  Client *c = new Client;
+  c->Func = func;
+  c->Data = data;
+  c->Bytes = 0;
+  c->Pass = 0;
+  c->InCallback = false;
+
+  vtkDICOMMemoryGovernorLock.Lock();
+  c->Prev = 0;
+  c->Next = vtkDICOMMemoryGovernor::Head;
+  if (vtkDICOMMemoryGovernor::Head)
+    {
+    vtkDICOMMemoryGovernor::Head->Prev = c;
+    }
+  else
+    {
+    vtkDICOMMemoryGovernor::Tail = c;
+    }
+  vtkDICOMMemoryGovernor::Head = c;
+  vtkDICOMMemoryGovernorLock.Unlock();
+
+  return c;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMemoryGovernor::RemoveClient(void *client)
+{
+  Client *c = static_cast<Client *>(client);
+
+  vtkDICOMMemoryGovernorLock.Lock();
+  // if another thread is inside this client's release callback, wait
+  // for the callback to return before unlinking the client, so that
+  // the caller can safely destroy the data the callback operates on
+  while (c->InCallback)
+    {
+    vtkDICOMMemoryGovernorLock.Unlock();
+    vtkDICOMMemoryGovernorLock.Lock();
+    }
+  vtkDICOMMemoryGovernor::MemoryInUse -= c->Bytes;
+  c->Bytes = 0;
+  if (c->Prev)
+    {
+    c->Prev->Next = c->Next;
+    }
+  else
+    {
+    vtkDICOMMemoryGovernor::Head = c->Next;
+    }
+  if (c->Next)
+    {
+    c->Next->Prev = c->Prev;
+    }
+  else
+    {
+    vtkDICOMMemoryGovernor::Tail = c->Prev;
+    }
+  vtkDICOMMemoryGovernorLock.Unlock();
+
+  delete c;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMemoryGovernor::RecordAllocation(void *client, vtkTypeInt64 bytes)
+{
+  Client *c = static_cast<Client *>(client);
+
+  vtkDICOMMemoryGovernorLock.Lock();
+  c->Bytes += bytes;
+  vtkDICOMMemoryGovernor::MemoryInUse += bytes;
+  // move this client to the head of the list, it is now the most
+  // recently active client
+  if (c != vtkDICOMMemoryGovernor::Head)
+    {
+    c->Prev->Next = c->Next;
+    if (c->Next)
+      {
+      c->Next->Prev = c->Prev;
+      }
+    else
+      {
+      vtkDICOMMemoryGovernor::Tail = c->Prev;
+      }
+    c->Prev = 0;
+    c->Next = vtkDICOMMemoryGovernor::Head;
+    vtkDICOMMemoryGovernor::Head->Prev = c;
+    vtkDICOMMemoryGovernor::Head = c;
+    }
+  if (vtkDICOMMemoryGovernor::MemoryBudget > 0 &&
+      vtkDICOMMemoryGovernor::MemoryInUse >
+        vtkDICOMMemoryGovernor::MemoryBudget)
+    {
+    vtkDICOMMemoryGovernor::ApplyPressure(c);
+    }
+  vtkDICOMMemoryGovernorLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMemoryGovernor::RecordFree(void *client, vtkTypeInt64 bytes)
+{
+  Client *c = static_cast<Client *>(client);
+
+  vtkDICOMMemoryGovernorLock.Lock();
+  c->Bytes -= bytes;
+  vtkDICOMMemoryGovernor::MemoryInUse -= bytes;
+  vtkDICOMMemoryGovernorLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMemoryGovernor::ApplyPressure(Client *requester)
+{
+  // each pass asks each client at most once, so that the loop always
+  // terminates even if the clients cannot release enough memory
+  unsigned int pass = ++vtkDICOMMemoryGovernor::PassCounter;
+
+  while (vtkDICOMMemoryGovernor::MemoryInUse >
+         vtkDICOMMemoryGovernor::MemoryBudget)
+    {
+    // find the least recently active client that has memory to give
+    // and has not yet been asked during this pass (the requester is
+    // skipped, it manages its own budget)
+    Client *c = vtkDICOMMemoryGovernor::Tail;
+    while (c != 0 && (c == requester || c->Pass == pass ||
+                      c->InCallback || c->Bytes <= 0))
+      {
+      c = c->Prev;
+      }
+    if (c == 0)
+      {
+      break;
+      }
+    c->Pass = pass;
+    c->InCallback = true;
+    vtkTypeInt64 excess = (vtkDICOMMemoryGovernor::MemoryInUse -
+                           vtkDICOMMemoryGovernor::MemoryBudget);
+    // the callback will call RecordFree(), so release the lock (the
+    // client pointer stays valid, RemoveClient() waits on InCallback)
+    vtkDICOMMemoryGovernorLock.Unlock();
+    c->Func(c->Data, excess);
+    vtkDICOMMemoryGovernorLock.Lock();
+    c->InCallback = false;
+    }
+}
@@ -0,0 +1,114 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMMemoryGovernor_h
+#define vtkDICOMMemoryGovernor_h
+
+#include <vtkSystemIncludes.h>
+#include "vtkDICOMModule.h" // For export macro
+
+//! A library-wide budget for discardable memory.
+/*!
+ *  When several readers, writers, and directory scanners run in the
+ *  same process, each of their caches stays within its own budget but
+ *  their sum can still exceed the memory that is available to the
+ *  process.  The governor tracks the total size of all registered
+ *  caches against one configurable budget, and when the budget is
+ *  exceeded, it asks the least recently active caches to release
+ *  memory until the total is back under the budget.
+ *
+ *  A cache registers itself with AddClient(), reports the memory it
+ *  acquires and releases with RecordAllocation() and RecordFree(),
+ *  and provides a callback through which the governor can ask it to
+ *  release memory.  The callback is invoked without any governor lock
+ *  held, but it can be invoked from whatever thread caused the budget
+ *  to be exceeded, so a cache must guard its own data structures if
+ *  it registers with the governor.
+ *
+ *  The default budget is zero, which disables the governor: clients
+ *  can register and record allocations, but no release callbacks are
+ *  ever invoked.
+ */
+class VTKDICOM_EXPORT vtkDICOMMemoryGovernor
+{
+public:
+  //! A callback that asks a client to release some of its memory.
+  /*!
+   *  The first argument is the data pointer that was given to
+   *  AddClient(), and the second argument is the number of bytes by
+   *  which the budget is currently exceeded.  The callback should
+   *  release up to that many bytes (it may release less, e.g. if its
+   *  cache is already empty) and report what it released with
+   *  RecordFree().
+   */
+  typedef void (*ReleaseFunction)(void *data, vtkTypeInt64 bytes);
+
+  //@{
+  //! Set the total budget, in bytes, for all registered clients.
+  /*!
+   *  If the recorded allocations exceed this budget, then clients
+   *  are asked to release memory, starting with the client that has
+   *  least recently recorded an allocation.  A budget of zero (the
+   *  default) means that memory use is unlimited.
+   */
+  static void SetMemoryBudget(vtkTypeInt64 bytes);
+  static vtkTypeInt64 GetMemoryBudget();
+
+  //! Get the total of all recorded allocations, in bytes.
+  static vtkTypeInt64 GetMemoryInUse();
+  //@}
+
+  //@{
+  //! Register a client, returns an opaque handle for the client.
+  /*!
+   *  The data pointer is passed to the release callback.  The client
+   *  must be removed before the callback and data become invalid.
+   */
+  static void *AddClient(ReleaseFunction func, void *data);
+
+  //! Remove a client, forgetting any memory it had recorded.
+  /*!
+   *  If a release callback to this client is in progress on another
+   *  thread, this method waits for the callback to return, so after
+   *  it returns the caller can safely destroy the client's data.
+   */
+  static void RemoveClient(void *client);
+  //@}
+
+  //@{
+  //! Record that a client has acquired the given number of bytes.
+  /*!
+   *  This marks the client as the most recently active client, and
+   *  if the total goes over the budget, release callbacks to other
+   *  clients are invoked before this method returns.
+   */
+  static void RecordAllocation(void *client, vtkTypeInt64 bytes);
+
+  //! Record that a client has released the given number of bytes.
+  static void RecordFree(void *client, vtkTypeInt64 bytes);
+  //@}
+
+private:
+  struct Client;
+
+  //! Ask idle clients to release memory, called with the lock held.
+  static void ApplyPressure(Client *requester);
+
+  static vtkTypeInt64 MemoryBudget;
+  static vtkTypeInt64 MemoryInUse;
+  static Client *Head;
+  static Client *Tail;
+  static unsigned int PassCounter;
+};
+
+#endif /* vtkDICOMMemoryGovernor_h */
@@ -18,18 +18,54 @@
 
 #include <vtkObjectFactory.h>
 #include <vtkMatrix4x4.h>
+#include <vtkSimpleCriticalSection.h>
 #include <vtkAbstractArray.h>
 #include <vtkIntArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkStringArray.h>
 
 #include <assert.h>
+#include <string.h>
+#include <map>
 #include <vector>
 #include <utility>
 
+#include <new>
+
 vtkStandardNewMacro(vtkDICOMMetaData);
 
-// The hash table size, must be a power of two
+// The initial hash table size, must be a power of two
 #define METADATA_HASH_SIZE 512
 
+// The number of data elements per pool block
+#define METADATA_POOL_SIZE 256
+
+//----------------------------------------------------------------------------
+// A singly-linked list of blocks of raw storage, the data elements
+// are carved out of these blocks so that they sit close together in
+// memory and can be freed all at once.
+struct vtkDICOMMetaData::PoolBlock
+{
+  PoolBlock *Next;
+};
+
+//----------------------------------------------------------------------------
+// The cache of values that have been converted to UTF-8, keyed on the
+// address of the stored value so that shared values convert only once.
+struct vtkDICOMMetaData::UTF8CacheType
+  : public std::map<const vtkDICOMValue *, std::string>
+{
+};
+
+//----------------------------------------------------------------------------
+// The cache of private dictionaries that have been resolved from the
+// creator elements, keyed on the tag key of the creator element.  This
+// saves hashing the creator string for every private tag lookup.
+struct vtkDICOMMetaData::CreatorDictCacheType
+  : public std::map<unsigned int, vtkDICOMDictionary::Dict *>
+{
+};
+
 //----------------------------------------------------------------------------
 // Constructor
 vtkDICOMMetaData::vtkDICOMMetaData()
@@ -37,18 +73,26 @@ vtkDICOMMetaData::vtkDICOMMetaData()
   this->NumberOfInstances = 1;
   this->NumberOfDataElements = 0;
   this->Table = NULL;
+  this->TableSize = 0;
+  this->Pool = NULL;
+  this->PoolPtr = NULL;
+  this->PoolRemaining = 0;
   this->Head.Prev = NULL;
   this->Head.Next = &this->Tail;
   this->Tail.Prev = &this->Head;
   this->Tail.Next = NULL;
   this->FileIndexArray = NULL;
   this->FrameIndexArray = NULL;
+  this->UTF8Cache = NULL;
+  this->CreatorDictCache = NULL;
+  this->CacheLock = new vtkSimpleCriticalSection;
 }
 
 // Destructor
 vtkDICOMMetaData::~vtkDICOMMetaData()
 {
   this->Clear();
+  delete this->CacheLock;
   if (this->FileIndexArray)
     {
     this->FileIndexArray->Delete();
@@ -62,23 +106,102 @@ vtkDICOMMetaData::~vtkDICOMMetaData()
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::Clear()
 {
-  vtkDICOMDataElement **htable = this->Table;
+  // destroy the elements that hold values, all other pooled elements
+  // are empty and do not need their destructors to be called
+  vtkDICOMDataElement *dptr = this->Head.Next;
+  while (dptr != &this->Tail)
+    {
+    vtkDICOMDataElement *next = dptr->Next;
+    dptr->~vtkDICOMDataElement();
+    dptr = next;
+    }
 
-  if (htable)
+  // free the pooled storage en masse
+  PoolBlock *block = this->Pool;
+  while (block)
     {
-    for (unsigned int i = 0; i < METADATA_HASH_SIZE; i++)
-      {
-      delete [] htable[i];
-      }
-    delete [] htable;
+    PoolBlock *next = block->Next;
+    delete [] reinterpret_cast<char *>(block);
+    block = next;
     }
 
+  delete [] this->Table;
+
+  delete this->UTF8Cache;
+  this->UTF8Cache = NULL;
+
+  delete this->CreatorDictCache;
+  this->CreatorDictCache = NULL;
+
   this->NumberOfDataElements = 0;
   this->Table = NULL;
+  this->TableSize = 0;
+  this->Pool = NULL;
+  this->PoolPtr = NULL;
+  this->PoolRemaining = 0;
   this->Head.Next = &this->Tail;
   this->Tail.Prev = &this->Head;
 }
 
+//----------------------------------------------------------------------------
+vtkDICOMDataElement *vtkDICOMMetaData::PoolAllocate(unsigned int n)
+{
+  if (n > this->PoolRemaining)
+    {
+    unsigned int m = METADATA_POOL_SIZE;
+    m = (n > m ? n : m);
+    char *raw = new char[sizeof(PoolBlock) + m*sizeof(vtkDICOMDataElement)];
+    PoolBlock *block = reinterpret_cast<PoolBlock *>(raw);
+    block->Next = this->Pool;
+    this->Pool = block;
+    this->PoolPtr = reinterpret_cast<vtkDICOMDataElement *>(
+      raw + sizeof(PoolBlock));
+    this->PoolRemaining = m;
+    }
+
+  vtkDICOMDataElement *ptr = this->PoolPtr;
+  this->PoolPtr += n;
+  this->PoolRemaining -= n;
+
+  for (unsigned int i = 0; i < n; i++)
+    {
+    new(&ptr[i]) vtkDICOMDataElement();
+    }
+
+  return ptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::RehashTable(unsigned int n)
+{
+  TableEntry *htable = new TableEntry[n];
+  for (unsigned int j = 0; j < n; j++)
+    {
+    htable[j].Element = NULL;
+    }
+
+  // re-insert the entries from the old table
+  unsigned int m = n - 1;
+  TableEntry *optr = this->Table;
+  TableEntry *optrEnd = optr + this->TableSize;
+  for (; optr != optrEnd; optr++)
+    {
+    if (optr->Element != 0)
+      {
+      unsigned int i = (optr->Tag.ComputeHash() & m);
+      while (htable[i].Element != 0)
+        {
+        i = ((i + 1) & m);
+        }
+      htable[i] = *optr;
+      }
+    }
+
+  delete [] this->Table;
+  this->Table = htable;
+  this->TableSize = n;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::Initialize()
 {
@@ -150,34 +273,53 @@ void vtkDICOMMetaData::SetFrameIndexArray(vtkIntArray *a)
 // Erase an element from the hash table
 void vtkDICOMMetaData::RemoveAttribute(vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
-  unsigned int i = (tag.ComputeHash() & m);
-  vtkDICOMDataElement **htable = this->Table;
-  vtkDICOMDataElement *hptr;
+  TableEntry *htable = this->Table;
 
-  if (htable && (hptr = htable[i]) != NULL)
+  if (htable)
     {
-    while (hptr->Next != 0)
+    unsigned int m = this->TableSize - 1;
+    unsigned int i = (tag.ComputeHash() & m);
+
+    while (htable[i].Element != 0)
       {
-      if (hptr->Tag == tag)
+      if (htable[i].Tag == tag)
         {
+        vtkDICOMDataElement *hptr = htable[i].Element;
         // remove from the linked list
         hptr->Next->Prev = hptr->Prev;
         hptr->Prev->Next = hptr->Next;
-        // remove from the hash table
-        hptr[0] = hptr[1];
-        while (hptr->Next != 0)
+        // the pooled storage is reclaimed when Clear() is called,
+        // but the value must be released now
+        hptr->~vtkDICOMDataElement();
+        // remove from the hash table, shifting the entries that
+        // follow backwards to keep the probe sequences intact
+        unsigned int j = i;
+        for (;;)
           {
-          // adjust links as necessary
-          hptr->Prev->Next = hptr;
-          hptr->Next->Prev = hptr;
-          hptr++;
-          hptr[0] = hptr[1];
+          j = ((j + 1) & m);
+          if (htable[j].Element == 0)
+            {
+            break;
+            }
+          unsigned int k = (htable[j].Tag.ComputeHash() & m);
+          // move entry "j" only if slot "i" lies on its probe path
+          if ((j > i) ? (k <= i || k > j) : (k <= i && k > j))
+            {
+            htable[i] = htable[j];
+            i = j;
+            }
           }
+        htable[i].Element = 0;
         this->NumberOfDataElements--;
+        // the removed value might be in the UTF-8 cache, and it
+        // might be a creator element that was resolved
+        delete this->UTF8Cache;
+        this->UTF8Cache = NULL;
+        delete this->CreatorDictCache;
+        this->CreatorDictCache = NULL;
         break;
         }
-      hptr++;
+      i = ((i + 1) & m);
       }
     }
 }
@@ -187,20 +329,19 @@ void vtkDICOMMetaData::RemoveAttribute(vtkDICOMTag tag)
 vtkDICOMDataElement *vtkDICOMMetaData::FindDataElement(
   vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
-  unsigned int i = (tag.ComputeHash() & m);
-  vtkDICOMDataElement **htable = this->Table;
-  vtkDICOMDataElement *hptr;
+  TableEntry *htable = this->Table;
 
-  if (htable && (hptr = htable[i]) != NULL)
+  if (htable)
     {
-    while (hptr->Next != 0)
+    unsigned int m = this->TableSize - 1;
+    unsigned int i = (tag.ComputeHash() & m);
+    while (htable[i].Element != 0)
       {
-      if (hptr->Tag == tag)
+      if (htable[i].Tag == tag)
         {
-        return hptr;
+        return htable[i].Element;
         }
-      hptr++;
+      i = ((i + 1) & m);
       }
     }
 
@@ -280,6 +421,84 @@ const vtkDICOMValue &vtkDICOMMetaData::GetAttributeValue(
   return (vptr ? *vptr : this->Tail.Value);
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaData::GetAttributeValues(vtkDICOMTag tag, vtkAbstractArray *a)
+{
+  int n = this->NumberOfInstances;
+  vtkDICOMDataElement *e = this->FindDataElement(tag);
+  // if the element is per-instance, vptr is its array of values
+  const vtkDICOMValue *vptr = 0;
+  if (e)
+    {
+    vptr = e->GetValue().GetMultiplexData();
+    }
+
+  if (vtkStringArray *sa = vtkStringArray::SafeDownCast(a))
+    {
+    sa->SetNumberOfValues(n);
+    if (vptr)
+      {
+      for (int i = 0; i < n; i++)
+        {
+        sa->SetValue(i, vptr[i].AsUTF8String());
+        }
+      }
+    else
+      {
+      // convert the shared value just once, then replicate it
+      std::string s = (e ? e->GetValue().AsUTF8String() : std::string());
+      for (int i = 0; i < n; i++)
+        {
+        sa->SetValue(i, s);
+        }
+      }
+    }
+  else if (vtkDoubleArray *da = vtkDoubleArray::SafeDownCast(a))
+    {
+    da->SetNumberOfValues(n);
+    if (vptr)
+      {
+      for (int i = 0; i < n; i++)
+        {
+        da->SetValue(i, vptr[i].AsDouble());
+        }
+      }
+    else
+      {
+      double d = (e ? e->GetValue().AsDouble() : 0.0);
+      for (int i = 0; i < n; i++)
+        {
+        da->SetValue(i, d);
+        }
+      }
+    }
+  else if (vtkIntArray *ia = vtkIntArray::SafeDownCast(a))
+    {
+    ia->SetNumberOfValues(n);
+    if (vptr)
+      {
+      for (int i = 0; i < n; i++)
+        {
+        ia->SetValue(i, vptr[i].AsInt());
+        }
+      }
+    else
+      {
+      int d = (e ? e->GetValue().AsInt() : 0);
+      for (int i = 0; i < n; i++)
+        {
+        ia->SetValue(i, d);
+        }
+      }
+    }
+  else
+    {
+    return false;
+    }
+
+  return (e != 0);
+}
+
 //----------------------------------------------------------------------------
 const vtkDICOMValue &vtkDICOMMetaData::GetAttributeValue(
   const vtkDICOMTagPath &tagpath)
@@ -296,6 +515,94 @@ const vtkDICOMValue &vtkDICOMMetaData::GetAttributeValue(
   return (vptr ? *vptr : this->Tail.Value);
 }
 
+//----------------------------------------------------------------------------
+const vtkDICOMItem *vtkDICOMMetaData::FindItem(
+  const vtkDICOMTagPath &tagpath)
+{
+  return this->FindItem(0, tagpath);
+}
+
+//----------------------------------------------------------------------------
+const vtkDICOMItem *vtkDICOMMetaData::FindItem(
+  int idx, const vtkDICOMTagPath &tagpath)
+{
+  const vtkDICOMItem *item = 0;
+  vtkDICOMTagPath path = tagpath;
+
+  if (path.HasTail())
+    {
+    const vtkDICOMValue *vptr = this->FindAttributeValue(idx, path.GetHead());
+    while (vptr != 0 && vptr->IsValid())
+      {
+      // descend one level into the sequence
+      unsigned int i = path.GetIndex();
+      const vtkDICOMItem *items = vptr->GetSequenceData();
+      if (items == 0 || i >= vptr->GetNumberOfValues())
+        {
+        break;
+        }
+      path = path.GetTail();
+      if (!path.HasTail())
+        {
+        // the item that contains the final tag of the path
+        item = &items[i];
+        break;
+        }
+      vptr = &items[i].GetAttributeValue(path.GetHead());
+      }
+    }
+
+  return item;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMMetaData::GetAttributeValueAsUTF8(vtkDICOMTag tag)
+{
+  return this->GetAttributeValueAsUTF8(0, tag);
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMMetaData::GetAttributeValueAsUTF8(
+  int idx, vtkDICOMTag tag)
+{
+  const vtkDICOMValue *vptr = this->FindAttributeValue(idx, tag);
+  if (vptr == 0)
+    {
+    return std::string();
+    }
+  return this->ConvertValueToUTF8(vptr);
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMMetaData::ConvertValueToUTF8(const vtkDICOMValue *vptr)
+{
+  if (vptr->GetCharacterSet() == vtkDICOMCharacterSet::ISO_IR_6)
+    {
+    // no conversion is needed for plain ASCII
+    return vptr->AsString();
+    }
+
+  // the cache is shared by concurrent reader threads, so it is
+  // guarded: this is the only lock on any of the retrieval paths
+  this->CacheLock->Lock();
+  if (this->UTF8Cache == 0)
+    {
+    this->UTF8Cache = new UTF8CacheType;
+    }
+
+  UTF8CacheType::iterator iter = this->UTF8Cache->find(vptr);
+  if (iter == this->UTF8Cache->end())
+    {
+    iter = this->UTF8Cache->insert(
+      std::make_pair(vptr, vptr->AsUTF8String())).first;
+    }
+
+  std::string s = iter->second;
+  this->CacheLock->Unlock();
+
+  return s;
+}
+
 //----------------------------------------------------------------------------
 const vtkDICOMValue &vtkDICOMMetaData::GetAttributeValue(
   int idx, int frame, const vtkDICOMTagPath &tagpath)
@@ -436,62 +743,52 @@ int vtkDICOMMetaData::GetFrameIndex(int sliceIdx, int compIdx, int numComp)
 vtkDICOMDataElement *vtkDICOMMetaData::FindDataElementOrInsert(
   vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
-  unsigned int i = (tag.ComputeHash() & m);
-  vtkDICOMDataElement **htable = this->Table;
-  vtkDICOMDataElement *hptr;
+  // the element might replace a value that is in the UTF-8 cache,
+  // and it might be a creator element that was resolved
+  delete this->UTF8Cache;
+  this->UTF8Cache = NULL;
+  delete this->CreatorDictCache;
+  this->CreatorDictCache = NULL;
+
+  TableEntry *htable = this->Table;
 
   if (htable == NULL)
     {
     // allocate the hash table
-    m = METADATA_HASH_SIZE;
-    htable = new vtkDICOMDataElement *[METADATA_HASH_SIZE];
+    unsigned int n = METADATA_HASH_SIZE;
+    htable = new TableEntry[n];
     this->Table = htable;
-    do { *htable++ = NULL; } while (--m);
+    this->TableSize = n;
+    for (unsigned int j = 0; j < n; j++)
+      {
+      htable[j].Element = NULL;
+      }
+    }
+  else if (4*static_cast<unsigned int>(this->NumberOfDataElements + 1) >
+           3*this->TableSize)
+    {
+    // grow the table when it becomes three-quarters full, so that
+    // the linear probe sequences stay short
+    this->RehashTable(2*this->TableSize);
     htable = this->Table;
     }
 
-  hptr = htable[i];
+  unsigned int m = this->TableSize - 1;
+  unsigned int i = (tag.ComputeHash() & m);
 
-  if (hptr == NULL)
+  while (htable[i].Element != 0)
     {
-    hptr = new vtkDICOMDataElement[4];
-    htable[i] = hptr;
-    }
-  else if (hptr->Next != 0)
-    {
-    // see if item is already there
-    unsigned int n = 0;
-    do
-      {
-      if (hptr->Tag == tag)
-        {
-        return hptr;
-        }
-      n++;
-      hptr++;
-      }
-    while (hptr->Next != 0);
-
-    // if n+1 is a power of two, double allocated space
-    if (n > 2 && (n & (n+1)) == 0)
+    if (htable[i].Tag == tag)
       {
-      vtkDICOMDataElement *oldptr = htable[i];
-      hptr = new vtkDICOMDataElement[2*(n+1)];
-      htable[i] = hptr;
-      // copy the old list
-      for (unsigned int j = 0; j < n; j++)
-        {
-        *hptr = oldptr[j];
-        // link the new element into the list
-        hptr->Next->Prev = hptr;
-        hptr->Prev->Next = hptr;
-        hptr++;
-        }
-      delete [] oldptr;
+      return htable[i].Element;
       }
+    i = ((i + 1) & m);
     }
 
+  vtkDICOMDataElement *hptr = this->PoolAllocate(1);
+  htable[i].Tag = tag;
+  htable[i].Element = hptr;
+
   // insert into the linked list
   vtkDICOMDataElement *tptr = &this->Tail;
   do
@@ -569,7 +866,7 @@ int vtkDICOMMetaData::FindItemsOrInsert(
         sptr[i] = *vptr;
         }
       }
-    *vptr = l;
+    vptr->Swap(l);
     sptr = &sptr[idx];
     }
   else
@@ -742,7 +1039,7 @@ void vtkDICOMMetaData::SetAttributeValue(
         sptr[i] = *vptr;
         }
       }
-    *vptr = l;
+    vptr->Swap(l);
     }
   else if (!vptr->IsValid())
     {
@@ -897,6 +1194,46 @@ void vtkDICOMMetaData::SetAttributeValue(
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::CollapseEqualValues()
+{
+  for (vtkDICOMDataElement *dptr = this->Head.Next;
+       dptr != &this->Tail; dptr = dptr->Next)
+    {
+    vtkDICOMValue *vptr = &dptr->Value;
+    vtkDICOMValue *sptr = vtkDICOMValueFriendMetaData::GetMultiplex(vptr);
+    if (sptr == 0)
+      {
+      continue;
+      }
+
+    // check whether the instances all have equal values
+    int n = this->NumberOfInstances;
+    int i = 1;
+    while (i < n && sptr[i] == sptr[0])
+      {
+      i++;
+      }
+    if (i == n)
+      {
+      // collapse the multiplex into a single shared value
+      vtkDICOMValue l = sptr[0];
+      vptr->Swap(l);
+      }
+    else
+      {
+      // make runs of equal values share their storage
+      for (i = 1; i < n; i++)
+        {
+        if (sptr[i] == sptr[i-1])
+          {
+          sptr[i] = sptr[i-1];
+          }
+        }
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMValue vtkDICOMMetaData::MakeValueWithSpecificCharacterSet(
   vtkDICOMVR vr, const std::string& v)
@@ -921,38 +1258,535 @@ void vtkDICOMMetaData::CopyAttributes(vtkDICOMMetaData *o)
 
   if (o != 0 && o != this)
     {
-    vtkDICOMDataElement **otable = o->Table;
+    TableEntry *otable = o->Table;
     if (otable != 0)
       {
       const vtkDICOMDataElement *iter = o->Head.Next;
       const vtkDICOMDataElement *iterEnd = &o->Tail;
       while (iter != iterEnd)
         {
-        // if this is a per-instance element, then make a copy of it
+        // per-instance elements can only be copied if the instance
+        // counts match, all other elements can always be copied
         const vtkDICOMValue *vptr = iter->Value.GetMultiplexData();
-        if (vptr == 0)
+        if (vptr == 0 || this->NumberOfInstances == o->NumberOfInstances)
           {
+          // the value is referenced rather than copied, a private copy
+          // is only made if the element is modified (copy-on-write)
           vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
           e->Tag = iter->Tag;
           e->Value = iter->Value;
           }
-        else if (this->NumberOfInstances == o->NumberOfInstances)
-          {
-          vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
-          e->Tag = iter->Tag;
-          vtkDICOMValue *nvptr = e->Value.AllocateMultiplexData(
-            iter->Value.GetVR(), this->NumberOfInstances);
-          for (int i = 0; i < this->NumberOfInstances; i++)
-            {
-            nvptr[i] = vptr[i];
-            }
-          }
         iter = iter->Next;
         }
       }
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::CopyInstanceRange(
+  vtkDICOMMetaData *o, int first, int count)
+{
+  if (o == 0 || o == this)
+    {
+    return;
+    }
+
+  // clamp the range to the instances that the source actually has
+  if (first < 0)
+    {
+    first = 0;
+    }
+  if (count > o->NumberOfInstances - first)
+    {
+    count = o->NumberOfInstances - first;
+    }
+
+  this->Initialize();
+  if (count < 1)
+    {
+    return;
+    }
+  this->NumberOfInstances = count;
+
+  const vtkDICOMDataElement *iter = o->Head.Next;
+  const vtkDICOMDataElement *iterEnd = &o->Tail;
+  while (iter != iterEnd)
+    {
+    const vtkDICOMValue *vptr = iter->Value.GetMultiplexData();
+    if (vptr == 0)
+      {
+      // the element has one value for all instances: reference it
+      vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
+      e->Tag = iter->Tag;
+      e->Value = iter->Value;
+      }
+    else if (count == 1)
+      {
+      // a single instance does not need a multiplex
+      if (vptr[first].IsValid())
+        {
+        vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
+        e->Tag = iter->Tag;
+        e->Value = vptr[first];
+        }
+      }
+    else
+      {
+      // reference the values for the requested instances, the
+      // underlying storage is shared until a value is modified
+      vtkDICOMValue l;
+      vtkDICOMValue *sptr = l.AllocateMultiplexData(
+        iter->Value.GetVR(), count);
+      bool valid = false;
+      for (int i = 0; i < count; i++)
+        {
+        sptr[i] = vptr[first + i];
+        valid |= sptr[i].IsValid();
+        }
+      if (valid)
+        {
+        vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
+        e->Tag = iter->Tag;
+        e->Value = l;
+        }
+      }
+    iter = iter->Next;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::Diff(
+  vtkDICOMMetaData *o, std::vector<vtkDICOMTag> *tags)
+{
+  tags->clear();
+
+  if (o == 0 || o == this)
+    {
+    return;
+    }
+
+  // both element lists are sorted on the tag, so they can be walked
+  // together, and the values compared without any string conversion
+  // (shared values compare by pointer, all others by raw bytes)
+  const vtkDICOMDataElement *a = this->Head.Next;
+  const vtkDICOMDataElement *aEnd = &this->Tail;
+  const vtkDICOMDataElement *b = o->Head.Next;
+  const vtkDICOMDataElement *bEnd = &o->Tail;
+
+  while (a != aEnd || b != bEnd)
+    {
+    if (b == bEnd || (a != aEnd && a->Tag < b->Tag))
+      {
+      // tag is only present in this object
+      tags->push_back(a->Tag);
+      a = a->Next;
+      }
+    else if (a == aEnd || b->Tag < a->Tag)
+      {
+      // tag is only present in the other object
+      tags->push_back(b->Tag);
+      b = b->Next;
+      }
+    else
+      {
+      if (!(a->Value == b->Value))
+        {
+        tags->push_back(a->Tag);
+        }
+      a = a->Next;
+      b = b->Next;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+unsigned long long vtkDICOMMetaData::Hash()
+{
+  // combine the element hashes with 64-bit FNV-1a
+  unsigned long long h = 14695981039346656037ULL;
+
+  const vtkDICOMDataElement *iter = this->Head.Next;
+  const vtkDICOMDataElement *iterEnd = &this->Tail;
+  while (iter != iterEnd)
+    {
+    unsigned short g[2];
+    g[0] = iter->Tag.GetGroup();
+    g[1] = iter->Tag.GetElement();
+    unsigned long long e = iter->Value.Hash();
+    const unsigned char *cp = reinterpret_cast<const unsigned char *>(g);
+    for (size_t i = 0; i < sizeof(g); i++)
+      {
+      h = (h ^ cp[i])*1099511628211ULL;
+      }
+    cp = reinterpret_cast<const unsigned char *>(&e);
+    for (size_t i = 0; i < sizeof(e); i++)
+      {
+      h = (h ^ cp[i])*1099511628211ULL;
+      }
+    iter = iter->Next;
+    }
+
+  return h;
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+// append raw bytes to the serialized form of a snapshot
+void vtkDICOMMetaDataSnapshotAppend(
+  std::vector<unsigned char>& buf, const void *data, size_t n)
+{
+  const unsigned char *cp = static_cast<const unsigned char *>(data);
+  buf.insert(buf.end(), cp, cp + n);
+}
+
+void vtkDICOMMetaDataSnapshotValue(
+  std::vector<unsigned char>& buf, const vtkDICOMValue& v);
+
+// append one sequence item: the attribute count, then for each
+// attribute the tag followed by the serialized value
+void vtkDICOMMetaDataSnapshotItem(
+  std::vector<unsigned char>& buf, const vtkDICOMItem& item)
+{
+  unsigned int n = static_cast<unsigned int>(item.GetNumberOfDataElements());
+  vtkDICOMMetaDataSnapshotAppend(buf, &n, 4);
+  vtkDICOMDataElementIterator iter;
+  for (iter = item.Begin(); iter != item.End(); ++iter)
+    {
+    unsigned short g = iter->GetTag().GetGroup();
+    unsigned short el = iter->GetTag().GetElement();
+    vtkDICOMMetaDataSnapshotAppend(buf, &g, 2);
+    vtkDICOMMetaDataSnapshotAppend(buf, &el, 2);
+    vtkDICOMMetaDataSnapshotValue(buf, iter->GetValue());
+    }
+}
+
+// append one value: the VR and character set, followed by the item
+// count and the items for a sequence, the tag count and the tags for
+// an attribute tag value, or the byte count and the raw data bytes
+// for everything else
+void vtkDICOMMetaDataSnapshotValue(
+  std::vector<unsigned char>& buf, const vtkDICOMValue& v)
+{
+  vtkDICOMVR vr = v.GetVR();
+  vtkDICOMMetaDataSnapshotAppend(buf, vr.GetText(), 2);
+  unsigned char cs = v.GetCharacterSet().GetKey();
+  vtkDICOMMetaDataSnapshotAppend(buf, &cs, 1);
+
+  int t = vr.GetType();
+  if (t == VTK_DICOM_ITEM)
+    {
+    unsigned int m = static_cast<unsigned int>(v.GetNumberOfValues());
+    vtkDICOMMetaDataSnapshotAppend(buf, &m, 4);
+    const vtkDICOMItem *items = v.GetSequenceData();
+    for (unsigned int i = 0; i < m; i++)
+      {
+      vtkDICOMMetaDataSnapshotItem(buf, items[i]);
+      }
+    }
+  else if (t == VTK_DICOM_TAG)
+    {
+    unsigned int m = static_cast<unsigned int>(v.GetNumberOfValues());
+    vtkDICOMMetaDataSnapshotAppend(buf, &m, 4);
+    const vtkDICOMTag *tags = v.GetTagData();
+    for (unsigned int i = 0; i < m; i++)
+      {
+      unsigned short g = tags[i].GetGroup();
+      unsigned short el = tags[i].GetElement();
+      vtkDICOMMetaDataSnapshotAppend(buf, &g, 2);
+      vtkDICOMMetaDataSnapshotAppend(buf, &el, 2);
+      }
+    }
+  else
+    {
+    const void *dp = 0;
+    switch (t)
+      {
+      case VTK_CHAR:
+        dp = v.GetCharData();
+        break;
+      case VTK_UNSIGNED_CHAR:
+        dp = v.GetUnsignedCharData();
+        break;
+      case VTK_SHORT:
+        dp = v.GetShortData();
+        break;
+      case VTK_UNSIGNED_SHORT:
+        dp = v.GetUnsignedShortData();
+        break;
+      case VTK_INT:
+        dp = v.GetIntData();
+        break;
+      case VTK_UNSIGNED_INT:
+        dp = v.GetUnsignedIntData();
+        break;
+      case VTK_FLOAT:
+        dp = v.GetFloatData();
+        break;
+      case VTK_DOUBLE:
+        dp = v.GetDoubleData();
+        break;
+      }
+    unsigned int vl = v.GetVL();
+    if (dp == 0)
+      {
+      vl = 0;
+      }
+    vtkDICOMMetaDataSnapshotAppend(buf, &vl, 4);
+    if (vl != 0)
+      {
+      vtkDICOMMetaDataSnapshotAppend(buf, dp, vl);
+      }
+    }
+}
+
+bool vtkDICOMMetaDataSnapshotReadValue(
+  const unsigned char **cpp, const unsigned char *ep, vtkDICOMValue *v);
+
+// read one sequence item, advancing *cpp past the bytes consumed,
+// the return value is false if the snapshot is malformed
+bool vtkDICOMMetaDataSnapshotReadItem(
+  const unsigned char **cpp, const unsigned char *ep, vtkDICOMItem *item)
+{
+  const unsigned char *cp = *cpp;
+  if (ep - cp < 4) { return false; }
+  unsigned int n;
+  memcpy(&n, cp, 4);
+  *cpp = cp + 4;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    cp = *cpp;
+    if (ep - cp < 4) { return false; }
+    unsigned short g, el;
+    memcpy(&g, cp, 2);
+    memcpy(&el, cp + 2, 2);
+    *cpp = cp + 4;
+    vtkDICOMValue v;
+    if (!vtkDICOMMetaDataSnapshotReadValue(cpp, ep, &v))
+      {
+      return false;
+      }
+    item->SetAttributeValue(vtkDICOMTag(g, el), v);
+    }
+  return true;
+}
+
+// read one value, advancing *cpp past the bytes consumed
+bool vtkDICOMMetaDataSnapshotReadValue(
+  const unsigned char **cpp, const unsigned char *ep, vtkDICOMValue *v)
+{
+  const unsigned char *cp = *cpp;
+  if (ep - cp < 3) { return false; }
+  char vrtext[2] = { static_cast<char>(cp[0]),
+                     static_cast<char>(cp[1]) };
+  vtkDICOMVR vr(vrtext);
+  vtkDICOMCharacterSet cs(cp[2]);
+  cp += 3;
+  if (!vr.IsValid())
+    {
+    return false;
+    }
+
+  int t = vr.GetType();
+  if (t == VTK_DICOM_ITEM)
+    {
+    if (ep - cp < 4) { return false; }
+    unsigned int m;
+    memcpy(&m, cp, 4);
+    cp += 4;
+    // each item needs at least four bytes for its attribute count
+    if (static_cast<size_t>(ep - cp) < 4*static_cast<size_t>(m))
+      {
+      return false;
+      }
+    *cpp = cp;
+    vtkDICOMItem *items = v->AllocateSequenceData(vr, m);
+    for (unsigned int i = 0; i < m; i++)
+      {
+      if (!vtkDICOMMetaDataSnapshotReadItem(cpp, ep, &items[i]))
+        {
+        return false;
+        }
+      }
+    return true;
+    }
+  else if (t == VTK_DICOM_TAG)
+    {
+    if (ep - cp < 4) { return false; }
+    unsigned int m;
+    memcpy(&m, cp, 4);
+    cp += 4;
+    if (static_cast<size_t>(ep - cp) < 4*static_cast<size_t>(m))
+      {
+      return false;
+      }
+    vtkDICOMTag *tags = v->AllocateTagData(vr, m);
+    for (unsigned int i = 0; i < m; i++)
+      {
+      unsigned short g, el;
+      memcpy(&g, cp, 2);
+      memcpy(&el, cp + 2, 2);
+      cp += 4;
+      tags[i] = vtkDICOMTag(g, el);
+      }
+    *cpp = cp;
+    return true;
+    }
+
+  if (ep - cp < 4) { return false; }
+  unsigned int vl;
+  memcpy(&vl, cp, 4);
+  cp += 4;
+  if (static_cast<size_t>(ep - cp) < vl)
+    {
+    return false;
+    }
+  switch (t)
+    {
+    case VTK_CHAR:
+      {
+      char *p = v->AllocateCharData(vr, cs, vl);
+      memcpy(p, cp, vl);
+      v->ComputeNumberOfValuesForCharData();
+      }
+      break;
+    case VTK_UNSIGNED_CHAR:
+      memcpy(v->AllocateUnsignedCharData(vr, vl), cp, vl);
+      break;
+    case VTK_SHORT:
+      memcpy(v->AllocateShortData(vr, vl/2), cp, vl);
+      break;
+    case VTK_UNSIGNED_SHORT:
+      memcpy(v->AllocateUnsignedShortData(vr, vl/2), cp, vl);
+      break;
+    case VTK_INT:
+      memcpy(v->AllocateIntData(vr, vl/4), cp, vl);
+      break;
+    case VTK_UNSIGNED_INT:
+      memcpy(v->AllocateUnsignedIntData(vr, vl/4), cp, vl);
+      break;
+    case VTK_FLOAT:
+      memcpy(v->AllocateFloatData(vr, vl/4), cp, vl);
+      break;
+    case VTK_DOUBLE:
+      memcpy(v->AllocateDoubleData(vr, vl/8), cp, vl);
+      break;
+    }
+  *cpp = cp + vl;
+  return true;
+}
+
+// the magic number and version for the snapshot format, stored in
+// native byte order so that the version also acts as a byte-order
+// check
+const char vtkDICOMMetaDataSnapshotMagic[8] = {
+  'V', 'T', 'K', 'D', 'C', 'M', 'S', 'S'
+};
+const unsigned int vtkDICOMMetaDataSnapshotVersion = 1;
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::SaveSnapshot(std::vector<unsigned char> *snapshot)
+{
+  std::vector<unsigned char>& buf = *snapshot;
+  buf.clear();
+  vtkDICOMMetaDataSnapshotAppend(buf, vtkDICOMMetaDataSnapshotMagic, 8);
+  vtkDICOMMetaDataSnapshotAppend(buf, &vtkDICOMMetaDataSnapshotVersion, 4);
+  int ni = this->NumberOfInstances;
+  vtkDICOMMetaDataSnapshotAppend(buf, &ni, 4);
+  int ne = this->NumberOfDataElements;
+  vtkDICOMMetaDataSnapshotAppend(buf, &ne, 4);
+
+  vtkDICOMDataElementIterator iter;
+  for (iter = this->Begin(); iter != this->End(); ++iter)
+    {
+    unsigned short g = iter->GetTag().GetGroup();
+    unsigned short el = iter->GetTag().GetElement();
+    vtkDICOMMetaDataSnapshotAppend(buf, &g, 2);
+    vtkDICOMMetaDataSnapshotAppend(buf, &el, 2);
+    unsigned char perInstance = iter->IsPerInstance();
+    vtkDICOMMetaDataSnapshotAppend(buf, &perInstance, 1);
+    if (perInstance)
+      {
+      const vtkDICOMValue *vptr = iter->GetValue().GetMultiplexData();
+      for (int i = 0; i < ni; i++)
+        {
+        vtkDICOMMetaDataSnapshotValue(buf, vptr[i]);
+        }
+      }
+    else
+      {
+      vtkDICOMMetaDataSnapshotValue(buf, iter->GetValue());
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaData::LoadSnapshot(const unsigned char *data, size_t size)
+{
+  if (size < 20 ||
+      memcmp(data, vtkDICOMMetaDataSnapshotMagic, 8) != 0 ||
+      memcmp(data + 8, &vtkDICOMMetaDataSnapshotVersion, 4) != 0)
+    {
+    return false;
+    }
+
+  int ni, ne;
+  memcpy(&ni, data + 12, 4);
+  memcpy(&ne, data + 16, 4);
+  if (ni < 1 || ne < 0)
+    {
+    return false;
+    }
+
+  this->Initialize();
+  this->NumberOfInstances = ni;
+
+  const unsigned char *cp = data + 20;
+  const unsigned char *ep = data + size;
+  for (int j = 0; j < ne; j++)
+    {
+    if (ep - cp < 5)
+      {
+      this->Initialize();
+      return false;
+      }
+    unsigned short g, el;
+    memcpy(&g, cp, 2);
+    memcpy(&el, cp + 2, 2);
+    unsigned char perInstance = cp[4];
+    cp += 5;
+    vtkDICOMTag tag(g, el);
+    int m = (perInstance ? ni : 1);
+    for (int i = 0; i < m; i++)
+      {
+      vtkDICOMValue v;
+      if (!vtkDICOMMetaDataSnapshotReadValue(&cp, ep, &v))
+        {
+        this->Initialize();
+        return false;
+        }
+      if (perInstance)
+        {
+        this->SetAttributeValue(i, tag, v);
+        }
+      else
+        {
+        this->SetAttributeValue(tag, v);
+        }
+      }
+    }
+
+  if (cp != ep)
+    {
+    this->Initialize();
+    return false;
+    }
+
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::ShallowCopy(vtkDataObject *source)
 {
@@ -1146,17 +1980,62 @@ vtkDICOMDictEntry vtkDICOMMetaData::FindDictEntry(vtkDICOMTag tag)
   unsigned short element = tag.GetElement();
 
   // note that there is similar code in vtkDICOMItem
-  const char *dict = 0;
   if ((group & 1) != 0 && element > 0x00ffu)
     {
     unsigned short creatorElement = (element >> 8);
     element &= 0x00ffu;
     tag = vtkDICOMTag(group, element);
     vtkDICOMTag creatorTag(group, creatorElement);
-    dict = this->GetAttributeValue(creatorTag).GetCharData();
+
+    // the dictionary for each creator slot is cached, so that the
+    // creator string is hashed only once per data set (the cache is
+    // guarded because concurrent reader threads share it)
+    unsigned int slot = ((static_cast<unsigned int>(group) << 16) |
+                         creatorElement);
+    this->CacheLock->Lock();
+    if (this->CreatorDictCache)
+      {
+      CreatorDictCacheType::iterator iter =
+        this->CreatorDictCache->find(slot);
+      if (iter != this->CreatorDictCache->end())
+        {
+        vtkDICOMDictionary::Dict *dict = iter->second;
+        this->CacheLock->Unlock();
+        if (dict == 0)
+          {
+          // no dictionary is registered for this creator
+          return vtkDICOMDictEntry();
+          }
+        return vtkDICOMDictionary::FindDictEntryInDict(tag, dict);
+        }
+      }
+    this->CacheLock->Unlock();
+
+    const char *creator = this->GetAttributeValue(creatorTag).GetCharData();
+    if (creator)
+      {
+      vtkDICOMDictionary::Dict *dict =
+        vtkDICOMDictionary::FindPrivateDict(creator);
+      this->CacheLock->Lock();
+      if (this->CreatorDictCache == 0)
+        {
+        this->CreatorDictCache = new CreatorDictCacheType;
+        }
+      this->CreatorDictCache->insert(std::make_pair(slot, dict));
+      this->CacheLock->Unlock();
+      if (dict == 0)
+        {
+        // no dictionary is registered for this creator
+        return vtkDICOMDictEntry();
+        }
+      return vtkDICOMDictionary::FindDictEntryInDict(tag, dict);
+      }
+
+    // no creator element, search the standard dictionary
+    return vtkDICOMDictionary::FindDictEntry(tag, 0);
     }
 
-  return vtkDICOMDictionary::FindDictEntry(tag, dict);
+  return vtkDICOMDictionary::FindDictEntry(tag, 0);
 }
 
 //----------------------------------------------------------------------------
@@ -16,11 +16,14 @@
 
 #include <vtkDataObject.h>
 #include <vtkStdString.h> // For std::string
+#include <vector> // For std::vector
 #include "vtkDICOMModule.h" // For export macro
 #include "vtkDICOMDataElement.h" // For method parameter
 #include "vtkDICOMDictEntry.h" // For method parameter
 
+class vtkAbstractArray;
 class vtkIntArray;
+class vtkSimpleCriticalSection;
 class vtkDICOMTagPath;
 
 //! A container class for DICOM metadata.
@@ -28,6 +31,16 @@ class vtkDICOMTagPath;
  *  The vtkDICOMMetaData object stores DICOM metadata in a hash table
  *  for efficient access.  One vtkDICOMMetaData object can store the
  *  metadata for a series of DICOM images.
+ *
+ *  Thread safety: once the object has been populated, any number of
+ *  threads can retrieve attributes concurrently without any locking,
+ *  as long as no thread modifies the object.  The retrieval methods
+ *  only ever read the element table, and the reference counting
+ *  inside the stored values is atomic, so no external mutex and no
+ *  per-thread copy of the metadata is needed.  The only mutable state
+ *  on the retrieval paths is the pair of internal caches for UTF-8
+ *  conversion and for private dictionaries, and those are guarded by
+ *  a short internal lock of their own.
  */
 class VTKDICOM_EXPORT vtkDICOMMetaData : public vtkDataObject
 {
@@ -120,6 +133,36 @@ public:
   const vtkDICOMValue &GetAttributeValue(int idx, const vtkDICOMTagPath &p);
   //@}
 
+  //@{
+  //! Resolve a tag path to the item that contains the final tag.
+  /*!
+   *  A caller that needs several attributes from the same nested item,
+   *  or the same attribute from the item for every frame, can resolve
+   *  the path once and then query the returned item directly instead
+   *  of walking down through the sequences again for every query.
+   *  The return value is null if the path cannot be resolved, and the
+   *  returned pointer is only valid until the meta data is modified.
+   */
+  const vtkDICOMItem *FindItem(const vtkDICOMTagPath &p);
+  const vtkDICOMItem *FindItem(int idx, const vtkDICOMTagPath &p);
+  //@}
+
+  //@{
+  //! Get the values of an attribute for all instances at once.
+  /*!
+   *  This fills the given array with one value per instance, which is
+   *  much cheaper than looking the attribute up once per instance when
+   *  the meta data holds a large series.  The array must be either a
+   *  vtkStringArray, a vtkDoubleArray, or a vtkIntArray, and it will
+   *  be resized to the number of instances.  If the attribute is not
+   *  per-instance, its value is converted once and then replicated.
+   *  The return value is false if the attribute is missing or if the
+   *  array is not of a supported type, in which case the array is
+   *  filled with empty strings or with zeros.
+   */
+  bool GetAttributeValues(vtkDICOMTag tag, vtkAbstractArray *a);
+  //@}
+
   //@{
   //! Get an attribute value for the specified file and frame index.
   /*!
@@ -137,6 +180,31 @@ public:
     int idx, int frame, const vtkDICOMTagPath &p);
   //@}
 
+  //@{
+  //! Get an attribute value as UTF-8 encoded text.
+  /*!
+   *  This is equivalent to calling AsUTF8String() on the value, but
+   *  the converted text is cached within the meta data object, keyed
+   *  on the identity of the stored value, so the character set
+   *  conversion is only performed once no matter how many times the
+   *  value is retrieved.  This matters when a value that is shared by
+   *  every instance in a series, such as PatientName, is written out
+   *  once per instance.  The cache is discarded whenever an attribute
+   *  is added or removed.  The cache has its own internal lock, so
+   *  these methods are safe to call from concurrent reader threads.
+   */
+  std::string GetAttributeValueAsUTF8(vtkDICOMTag tag);
+  std::string GetAttributeValueAsUTF8(int idx, vtkDICOMTag tag);
+  //@}
+
+  //! Convert a value stored in this data set to UTF-8, with caching.
+  /*!
+   *  The pointer must be to a value stored within this meta data
+   *  object or within one of its sequence items.  The converted text
+   *  is cached in the same cache that GetAttributeValueAsUTF8() uses.
+   */
+  std::string ConvertValueToUTF8(const vtkDICOMValue *vptr);
+
   //@{
   //! Get the file index for the given image slice and component.
   /*!
@@ -210,6 +278,21 @@ public:
   void SetAttributeValue(const vtkDICOMTagPath& tag, const std::string& v);
   //@}
 
+  //@{
+  //! Share storage between instances whose values are equal.
+  /*!
+   *  When per-instance values are set one instance at a time, each
+   *  instance gets its own copy of the value even if the values are
+   *  equal, because equality cannot be known in advance.  This method
+   *  collapses every attribute whose per-instance values are all
+   *  equal into a single shared value, and makes runs of equal values
+   *  within the remaining attributes share their storage.  It is
+   *  useful after collation of per-file attributes into one data set,
+   *  where most attribute values repeat across the instances.
+   */
+  void CollapseEqualValues();
+  //@}
+
   //@{
   //! Resolve a private tag, or return (ffff,ffff) if not resolved.
   /*!
@@ -278,6 +361,74 @@ public:
   void CopyAttributes(vtkDICOMMetaData *source);
   //@}
 
+  //@{
+  //! Copy a range of instances from another MetaData object.
+  /*!
+   *  This initializes the object, sets its NumberOfInstances to count,
+   *  and copies instances [first, first+count) of the source into it.
+   *  The values are referenced rather than copied (a private copy is
+   *  only made if an element is modified), so slicing a large series
+   *  into shards is cheap regardless of the size of the metadata.
+   *  Use this to give each of several reader processes the metadata
+   *  for just its own subset of the files in the series.
+   */
+  void CopyInstanceRange(vtkDICOMMetaData *source, int first, int count);
+  //@}
+
+  //@{
+  //! Compare with another MetaData object, and get the differing tags.
+  /*!
+   *  The element lists of the two objects are walked together in tag
+   *  order and the raw bytes of the values are compared directly, with
+   *  no conversion to strings, so this is far cheaper than comparing
+   *  the attributes one at a time through the attribute access methods.
+   *  Every tag whose value differs between the two objects is appended
+   *  to the vector, including tags that are present in only one of the
+   *  two objects.  A data element with per-instance values differs if
+   *  the value of any instance differs.  Only top-level tags are
+   *  reported: if attributes nested within a sequence differ, then the
+   *  tag of the sequence itself is reported.
+   */
+  void Diff(vtkDICOMMetaData *other, std::vector<vtkDICOMTag> *tags);
+
+  //! Compute a 64-bit hash over all of the data elements.
+  /*!
+   *  The hash combines the tags with the per-element hashes computed
+   *  by vtkDICOMValue::Hash().  Two objects with different hashes are
+   *  certainly different, and two objects with equal hashes are almost
+   *  certainly identical, so a stored digest can stand in for a full
+   *  comparison when checking whether a data set has changed.  The
+   *  digest depends on the byte order of the host, so it should only
+   *  be compared to digests computed on the same architecture.
+   */
+  unsigned long long Hash();
+  //@}
+
+  //@{
+  //! Save the metadata as a compact binary snapshot.
+  /*!
+   *  The snapshot is a flat, versioned serialization of the element
+   *  table: the value buffers are copied into it verbatim, in native
+   *  byte order, so saving and loading run at memcpy speed instead of
+   *  going through a full DICOM encode and parse.  All attributes are
+   *  stored, including per-instance values and nested sequences.  Use
+   *  this to persist a parsed data set, or to hand it to another
+   *  process on the same machine.
+   */
+  void SaveSnapshot(std::vector<unsigned char> *snapshot);
+
+  //! Restore the metadata from a binary snapshot.
+  /*!
+   *  This replaces the contents of this object with the instances
+   *  and attributes that were stored by SaveSnapshot().  The return
+   *  value is false if the snapshot is truncated or malformed, or if
+   *  it was written by a different version of the format or by a
+   *  machine with a different byte order, in which case this object
+   *  is left empty.
+   */
+  bool LoadSnapshot(const unsigned char *data, size_t size);
+  //@}
+
   //@{
   //! DataObject interface function.
   void ShallowCopy(vtkDataObject *source);
@@ -310,11 +461,40 @@ protected:
     int idx, const vtkDICOMTagPath& tagpath);
 
 private:
+  //! A block of pooled storage for the data elements.
+  struct PoolBlock;
+
+  //! Allocate an array of "n" elements from the per-dataset pool.
+  /*!
+   *  The elements are default-constructed in place.  The storage is
+   *  not released until Clear() is called, at which point all of the
+   *  pool blocks are freed en masse.
+   */
+  vtkDICOMDataElement *PoolAllocate(unsigned int n);
+
+  //! An entry in the hash table, the Tag is kept in the entry so
+  //! that the linear probe does not have to touch the elements.
+  struct TableEntry
+  {
+    vtkDICOMTag Tag;
+    vtkDICOMDataElement *Element;
+  };
+
+  //! Grow the hash table to the given size and re-insert the entries.
+  void RehashTable(unsigned int n);
+
   //! The number of DICOM files.
   int NumberOfInstances;
 
-  //! The lookup table for the metadata.
-  vtkDICOMDataElement **Table;
+  //! The lookup table for the metadata, it uses open addressing
+  //! with linear probing so that lookups stay within a cache line.
+  TableEntry *Table;
+  unsigned int TableSize;
+
+  //! The pooled storage that holds the data elements.
+  PoolBlock *Pool;
+  vtkDICOMDataElement *PoolPtr;
+  unsigned int PoolRemaining;
 
   //! Links to the first data element.
   vtkDICOMDataElement Head;
@@ -331,6 +511,17 @@ private:
   //! An array to map slices and components to frames.
   vtkIntArray *FrameIndexArray;
 
+  //! A cache of values that were converted to UTF-8.
+  struct UTF8CacheType;
+  UTF8CacheType *UTF8Cache;
+
+  //! A cache of the private dictionary for each creator element.
+  struct CreatorDictCacheType;
+  CreatorDictCacheType *CreatorDictCache;
+
+  //! The lock that guards the two caches for concurrent readers.
+  vtkSimpleCriticalSection *CacheLock;
+
   vtkDICOMMetaData(const vtkDICOMMetaData&);  // Not implemented.
   void operator=(const vtkDICOMMetaData&);  // Not implemented.
 };
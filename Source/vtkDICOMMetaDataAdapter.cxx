@@ -15,8 +15,126 @@
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMDictionary.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMSequence.h"
 #include "vtkDICOMTagPath.h"
 
+#include <map>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// A flattened index of the functional group sequences.  For each attribute
+// that appears in the SharedFunctionalGroupsSequence or the
+// PerFrameFunctionalGroupsSequence, it stores the resolved value pointer
+// for every frame, so that the per-frame attribute lookups are simple
+// array reads instead of searches through the nested sequence items.
+class vtkDICOMMetaDataAdapterCache
+{
+public:
+  typedef std::vector<const vtkDICOMValue *> SlotVector;
+  typedef std::map<vtkDICOMTag, SlotVector> MapType;
+
+  //! The index, with one pointer slot per frame for each attribute.
+  MapType Table;
+
+  //! Get the resolved value pointer for one frame, or 0 if not indexed.
+  const vtkDICOMValue *Get(vtkDICOMTag tag, int idx) const;
+
+  //! Set the still-empty slots for frames [lo,hi) of the given attribute.
+  static void SetSlots(
+    MapType& table, vtkDICOMTag tag, const vtkDICOMValue *vptr,
+    size_t lo, size_t hi, size_t n);
+
+  //! Index one functional group item, which applies to frames [lo,hi).
+  /*!
+   *  Attributes found within private sequences of the item are stored
+   *  in privTable rather than in the index, because they must only be
+   *  used if the attribute cannot be found anywhere else.
+   */
+  void AddItem(
+    const vtkDICOMItem& item, size_t lo, size_t hi, size_t n,
+    MapType& privTable);
+};
+
+//----------------------------------------------------------------------------
+const vtkDICOMValue *vtkDICOMMetaDataAdapterCache::Get(
+  vtkDICOMTag tag, int idx) const
+{
+  MapType::const_iterator it = this->Table.find(tag);
+  if (it != this->Table.end())
+    {
+    const SlotVector& slots = it->second;
+    if (slots.size() == 1)
+      {
+      // the attribute resolved identically for all frames
+      return slots[0];
+      }
+    if (idx >= 0 && static_cast<size_t>(idx) < slots.size())
+      {
+      return slots[idx];
+      }
+    }
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaDataAdapterCache::SetSlots(
+  MapType& table, vtkDICOMTag tag, const vtkDICOMValue *vptr,
+  size_t lo, size_t hi, size_t n)
+{
+  SlotVector& slots = table[tag];
+  if (slots.empty())
+    {
+    slots.resize(n, 0);
+    }
+  for (size_t f = lo; f < hi; f++)
+    {
+    if (slots[f] == 0)
+      {
+      slots[f] = vptr;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaDataAdapterCache::AddItem(
+  const vtkDICOMItem& item, size_t lo, size_t hi, size_t n,
+  MapType& privTable)
+{
+  // the attributes of the item itself take precedence over any
+  // attributes found within the sequences that the item contains
+  vtkDICOMDataElementIterator iter = item.Begin();
+  vtkDICOMDataElementIterator iterEnd = item.End();
+  while (iter != iterEnd)
+    {
+    SetSlots(this->Table, iter->GetTag(), &iter->GetValue(), lo, hi, n);
+    ++iter;
+    }
+
+  // search within all the sequences in the item
+  iter = item.Begin();
+  while (iter != iterEnd)
+    {
+    const vtkDICOMValue& u = iter->GetValue();
+    if (u.GetNumberOfValues() == 1)
+      {
+      const vtkDICOMItem *inner = u.GetSequenceData();
+      if (inner)
+        {
+        bool isPrivate = ((iter->GetTag().GetGroup() & 1) != 0);
+        vtkDICOMDataElementIterator initer = inner->Begin();
+        vtkDICOMDataElementIterator initerEnd = inner->End();
+        while (initer != initerEnd)
+          {
+          SetSlots((isPrivate ? privTable : this->Table),
+                   initer->GetTag(), &initer->GetValue(), lo, hi, n);
+          ++initer;
+          }
+        }
+      }
+    ++iter;
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMMetaDataAdapter::vtkDICOMMetaDataAdapter(vtkDICOMMetaData *meta)
 {
@@ -38,6 +156,7 @@ void vtkDICOMMetaDataAdapter::ConstructionHelper(
   this->PerFrame = 0;
   this->Shared = 0;
   this->NullValue = 0;
+  this->Cache = 0;
   this->NumberOfInstances = 0;
   this->MetaInstance = (i >= 0 ? i : 0);
 
@@ -78,6 +197,8 @@ void vtkDICOMMetaDataAdapter::ConstructionHelper(
       this->MetaInstance, DC::NumberOfFrames).AsInt();
     // an invalid value to return when asked for NumberOfFrames
     this->NullValue = new vtkDICOMValue();
+    // flatten the functional groups for fast per-frame lookups
+    this->BuildCache();
     }
   else if (meta)
     {
@@ -96,87 +217,112 @@ vtkDICOMMetaDataAdapter::~vtkDICOMMetaDataAdapter()
     this->Meta->Delete();
     }
   delete this->NullValue;
+  delete this->Cache;
 }
 
 //----------------------------------------------------------------------------
-const vtkDICOMValue &vtkDICOMMetaDataAdapter::GetAttributeValue(
-  int idx, vtkDICOMTag tag) const
+void vtkDICOMMetaDataAdapter::BuildCache()
 {
-  vtkDICOMMetaData *meta = this->Meta;
+  size_t n = static_cast<size_t>(
+    this->NumberOfInstances > 0 ? this->NumberOfInstances : 0);
+  this->Cache = new vtkDICOMMetaDataAdapterCache;
 
-  if (this->PerFrame)
+  // attributes found within private sequences go into a separate table,
+  // because they are only used if the attribute is not found elsewhere
+  vtkDICOMMetaDataAdapterCache::MapType privTable;
+
+  // index the PerFrameFunctionalGroupsSequence first,
+  // then index the SharedFunctionalGroupsSequence
+  for (int i = 0; i < 2; i++)
     {
-    // if asked for NumberOfFrames, pretend that it isn't set
-    if (tag == DC::NumberOfFrames)
+    const vtkDICOMValue *seq = (i == 0 ? this->PerFrame : this->Shared);
+    vtkDICOMSequence groups(*seq);
+    if (i == 0)
       {
-      return *this->NullValue;
+      // each item applies to one frame, iterate over borrowed views
+      size_t f = 0;
+      for (vtkDICOMSequence::ConstIterator it = groups.begin();
+           it != groups.end() && f < n; ++it, ++f)
+        {
+        this->Cache->AddItem(*it, f, f + 1, n, privTable);
+        }
       }
-
-    // search PerFrameFunctionalGroupsSequence first,
-    // then search SharedFunctionalGroupsSequence
-    const vtkDICOMValue *privateValue = 0;
-    for (int i = 0; i < 2; i++)
+    else if (groups.GetNumberOfItems() > 0)
       {
-      const vtkDICOMValue *seq = this->PerFrame;
-      unsigned int f = idx;
+      // the first item applies to every frame
+      this->Cache->AddItem(*groups.begin(), 0, n, n, privTable);
+      }
+    }
 
-      if (i == 1)
+  // use the private values to fill any slots that are still empty, but
+  // only if the attribute is also missing from the basic data set (the
+  // empty slots for other attributes are left empty, so that the lookup
+  // falls through to the basic data set)
+  vtkDICOMMetaDataAdapterCache::MapType::iterator pt = privTable.begin();
+  for (; pt != privTable.end(); ++pt)
+    {
+    const vtkDICOMValue& v =
+      this->Meta->GetAttributeValue(this->MetaInstance, pt->first);
+    if (!v.IsValid())
+      {
+      vtkDICOMMetaDataAdapterCache::SlotVector& slots =
+        this->Cache->Table[pt->first];
+      if (slots.empty())
         {
-        seq = this->Shared;
-        f = 0;
+        slots.resize(n, 0);
         }
-
-      if (seq && f < seq->GetNumberOfValues())
+      for (size_t f = 0; f < n; f++)
         {
-        // search for the item that matches the frame
-        const vtkDICOMItem *items = seq->GetSequenceData();
-        const vtkDICOMValue &v = items[f].GetAttributeValue(tag);
-        if (v.IsValid())
+        if (slots[f] == 0)
           {
-          return v;
-          }
-        // search within all the sequences in the item
-        vtkDICOMDataElementIterator iter = items[f].Begin();
-        vtkDICOMDataElementIterator iterEnd = items[f].End();
-        while (iter != iterEnd)
-          {
-          const vtkDICOMValue &u = iter->GetValue();
-          if (u.GetNumberOfValues() == 1)
-            {
-            const vtkDICOMItem *item = u.GetSequenceData();
-            if (item)
-              {
-              const vtkDICOMValue &w = item->GetAttributeValue(tag);
-              if (w.IsValid())
-                {
-                if ((iter->GetTag().GetGroup() & 1) == 0)
-                  {
-                  return w;
-                  }
-                else if (privateValue == 0)
-                  {
-                  // if we found the attribute in a private sequence,
-                  // then save but and keep searching to see if it will
-                  // eventually be found somewhere public
-                  privateValue = &w;
-                  }
-                }
-              }
-            }
-          ++iter;
+          slots[f] = pt->second[f];
           }
         }
       }
+    }
 
-    // if it wasn't in a PerFrame or Shared functional group
-    const vtkDICOMValue& v = meta->GetAttributeValue(this->MetaInstance, tag);
-    if (privateValue && !v.IsValid())
+  // shrink the entries that resolved identically for all frames
+  vtkDICOMMetaDataAdapterCache::MapType::iterator it =
+    this->Cache->Table.begin();
+  for (; it != this->Cache->Table.end(); ++it)
+    {
+    vtkDICOMMetaDataAdapterCache::SlotVector& slots = it->second;
+    size_t f = 1;
+    while (f < slots.size() && slots[f] == slots[0])
+      {
+      f++;
+      }
+    if (f > 1 && f == slots.size())
       {
-      // attributes found in private parts of the PerFrame or Shared are
-      // only returned if the attribute could not be found elsewhere
-      return *privateValue;
+      slots.resize(1);
       }
-    return v;
+    }
+}
+
+//----------------------------------------------------------------------------
+const vtkDICOMValue &vtkDICOMMetaDataAdapter::GetAttributeValue(
+  int idx, vtkDICOMTag tag) const
+{
+  vtkDICOMMetaData *meta = this->Meta;
+
+  if (this->PerFrame)
+    {
+    // if asked for NumberOfFrames, pretend that it isn't set
+    if (tag == DC::NumberOfFrames)
+      {
+      return *this->NullValue;
+      }
+
+    // the functional group sequences were flattened into a per-frame
+    // index when the adapter was constructed
+    const vtkDICOMValue *vptr = this->Cache->Get(tag, idx);
+    if (vptr)
+      {
+      return *vptr;
+      }
+
+    // if it wasn't in a PerFrame or Shared functional group
+    return meta->GetAttributeValue(this->MetaInstance, tag);
     }
 
   // if no per-frame data, use file instance
@@ -18,6 +18,7 @@
 #include "vtkDICOMTag.h"
 
 class vtkDICOMMetaData;
+class vtkDICOMMetaDataAdapterCache;
 class vtkDICOMValue;
 
 //! An adapter to make multi-frame data look like multi-file data.
@@ -106,12 +107,21 @@ protected:
   //! Helper function for the constructors.  Set all members.
   void ConstructionHelper(vtkDICOMMetaData *meta, int i);
 
+  //! Flatten the functional groups into a per-frame attribute index.
+  /*!
+   *  This resolves the value pointer for every attribute of every frame
+   *  in one pass, so that the per-frame lookups done afterwards do not
+   *  have to search through the functional group sequences each time.
+   */
+  void BuildCache();
+
 private:
 
   vtkDICOMMetaData *Meta;
   const vtkDICOMValue *PerFrame;
   const vtkDICOMValue *Shared;
   vtkDICOMValue *NullValue;
+  vtkDICOMMetaDataAdapterCache *Cache;
   int NumberOfInstances;
   int MetaInstance;
 };
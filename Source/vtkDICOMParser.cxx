@@ -17,8 +17,19 @@
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMProfiler.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMConfig.h"
+
+// Header for zlib
+#ifdef DICOM_USE_VTKZLIB
+#include "vtk_zlib.h"
+#else
+#include "zlib.h"
+#endif
 
 #include <vtkObjectFactory.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkUnsignedShortArray.h>
 #include <vtkErrorCode.h>
 
@@ -33,6 +44,8 @@ vtkStandardNewMacro(vtkDICOMParser);
 vtkCxxSetObjectMacro(vtkDICOMParser, MetaData, vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMParser, Query, vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMParser, Groups, vtkUnsignedShortArray);
+vtkCxxSetObjectMacro(vtkDICOMParser, OffsetTable, vtkTypeInt64Array);
+vtkCxxSetObjectMacro(vtkDICOMParser, FragmentTable, vtkTypeInt64Array);
 
 /*----------------------------------------------------------------------------
 The top section of this file defines "Decoder" classes that parse the
@@ -77,6 +90,23 @@ public:
     return parser->ParseError(cp, ep, message);
   }
 
+  static void ParseError(vtkDICOMParser *parser,
+    const unsigned char *cp, const unsigned char *ep,
+    int condition, vtkDICOMTag tag)
+  {
+    return parser->ParseError(cp, ep, condition, tag);
+  }
+
+  static unsigned char *GetTagFilter(vtkDICOMParser *parser)
+  {
+    return parser->TagFilterBuffer;
+  }
+
+  static vtkTypeInt64Array *GetOffsetTable(vtkDICOMParser *parser)
+  {
+    return parser->OffsetTable;
+  }
+
 };
 
 namespace {
@@ -358,6 +388,32 @@ public:
   // for instances in the series that were already parsed.
   void HandleMissingAttributes(vtkDICOMTag tag);
 
+  // Set the tag presence filter bits for a decoded element tag.
+  void FilterTag(vtkDICOMTag tag)
+  {
+    if (this->TagFilter)
+      {
+      unsigned int bits[3];
+      vtkDICOMParser::TagFilterBits(tag, bits);
+      this->TagFilter[bits[0] >> 3] |= (1 << (bits[0] & 7));
+      this->TagFilter[bits[1] >> 3] |= (1 << (bits[1] & 7));
+      this->TagFilter[bits[2] >> 3] |= (1 << (bits[2] & 7));
+      }
+  }
+
+  // Record the byte range of a top-level element in the offset table.
+  void OffsetElement(vtkDICOMTag tag, size_t start, size_t end)
+  {
+    if (this->OffsetTable && this->Item == 0)
+      {
+      unsigned int key = tag.GetGroup();
+      key = (key << 16) | tag.GetElement();
+      this->OffsetTable->InsertNextValue(static_cast<vtkTypeInt64>(key));
+      this->OffsetTable->InsertNextValue(static_cast<vtkTypeInt64>(start));
+      this->OffsetTable->InsertNextValue(static_cast<vtkTypeInt64>(end));
+      }
+  }
+
   // Advance the query iterator (this->Query) to the given tag,
   // and set this->QueryMatched to false if any unmatched query keys
   // were found, unless the keys support universal matching (i.e. the
@@ -367,12 +423,22 @@ public:
   // Returns true if the query contains the given tag.
   bool QueryContains(vtkDICOMTag tag);
 
+  // Returns true if the query contains any tag in the given group.
+  // Unlike QueryContains, this does not advance the query iterator,
+  // so it can be used to test a group before skipping over it.
+  bool QueryContainsGroup(unsigned short g);
+
   // Returns true if the value matches the query.
   bool QueryMatches(const vtkDICOMValue& v);
 
   // Returns true if all queries have matched so far.
   bool GetQueryMatched() { return this->QueryMatched; }
 
+  // Stop parsing as soon as the query is known to have failed.
+  // A failed match at the top level of the data set can never be
+  // recovered from, so the remainder of the file can be skipped.
+  void SetBailOnQueryFailure(bool b) { this->BailOnQueryFailure = b; }
+
   // Finish the query (check for unused keys that must match).
   bool FinishQuery();
 
@@ -381,8 +447,13 @@ protected:
   DecoderBase(vtkDICOMParser *parser, vtkDICOMMetaData *data, int idx) :
     Parser(parser), BaseContext(data,idx), Item(0), MetaData(data),
     Index(idx), ImplicitVR(false),
-    HasQuery(false), QueryMatched(false),
-    LastVL(0) { this->Context = &this->BaseContext; }
+    HasQuery(false), QueryMatched(false), BailOnQueryFailure(false),
+    LastVL(0) {
+    this->Context = &this->BaseContext;
+    this->TagFilter =
+      vtkDICOMParserInternalFriendship::GetTagFilter(parser);
+    this->OffsetTable =
+      vtkDICOMParserInternalFriendship::GetOffsetTable(parser); }
 
   // an internal implicit little-endian decoder
   DefaultDecoder *ImplicitLE;
@@ -403,6 +474,11 @@ protected:
   // the query to apply while reading the data
   bool HasQuery;
   bool QueryMatched;
+  bool BailOnQueryFailure;
+  // the tag presence filter to accumulate, or NULL
+  unsigned char *TagFilter;
+  // the element offset table to fill while parsing, or NULL
+  vtkTypeInt64Array *OffsetTable;
   vtkDICOMDataElementIterator Query;
   vtkDICOMDataElementIterator QueryEnd;
   vtkDICOMDataElementIterator QuerySave;
@@ -842,6 +918,17 @@ bool DecoderBase::QueryContains(vtkDICOMTag tag)
   return false;
 }
 
+//----------------------------------------------------------------------------
+bool DecoderBase::QueryContainsGroup(unsigned short g)
+{
+  vtkDICOMDataElementIterator iter = this->Query;
+  while (iter != this->QueryEnd && iter->GetTag().GetGroup() < g)
+    {
+    ++iter;
+    }
+  return (iter != this->QueryEnd && iter->GetTag().GetGroup() == g);
+}
+
 //----------------------------------------------------------------------------
 bool DecoderBase::QueryMatches(const vtkDICOMValue& v)
 {
@@ -1107,7 +1194,7 @@ size_t Decoder<E>::ReadElementHead(
       if (!this->CheckBuffer(cp, ep, 4))
         {
         vtkDICOMParserInternalFriendship::ParseError(this->Parser, cp, ep,
-          "Unexpected end of file.");
+          vtkDICOMParser::UnexpectedEndOfFile, tag);
         return 0;
         }
       vl = Decoder<E>::GetInt32(cp);
@@ -1145,7 +1232,7 @@ size_t Decoder<E>::ReadElementValue(
       if (!this->CheckBuffer(cp, ep, 8))
         {
         vtkDICOMParserInternalFriendship::ParseError(this->Parser, cp, ep,
-          "Unexpected end of file.");
+          vtkDICOMParser::UnexpectedEndOfFile, this->LastTag);
         return 0;
         }
       unsigned short g1 = Decoder<E>::GetInt16(cp);
@@ -1153,7 +1240,7 @@ size_t Decoder<E>::ReadElementValue(
       if (g1 != HxFFFE || (e1 != HxE000 && e1 != HxE0DD))
         {
         vtkDICOMParserInternalFriendship::ParseError(this->Parser, cp, ep,
-          "Encapsulated object is missing (FFFE,E000) tag.");
+          vtkDICOMParser::MissingItemTag, this->LastTag);
         return 0;
         }
 
@@ -1166,7 +1253,7 @@ size_t Decoder<E>::ReadElementValue(
       {
       // only UN, OB, and SQ can have unknown length
       vtkDICOMParserInternalFriendship::ParseError(this->Parser, cp, ep,
-        "Illegal item length FFFFFFFF encountered.");
+        vtkDICOMParser::IllegalValueLength, this->LastTag);
       return 0;
       }
     }
@@ -1180,7 +1267,7 @@ size_t Decoder<E>::ReadElementValue(
     if (static_cast<vtkTypeInt64>(vl) > bytesRemaining)
       {
       vtkDICOMParserInternalFriendship::ParseError(this->Parser, cp, ep,
-        "Item length exceeds the bytes remaining in file.");
+        vtkDICOMParser::ValueTooLarge, this->LastTag);
       return 0;
       }
     }
@@ -1189,20 +1276,29 @@ size_t Decoder<E>::ReadElementValue(
     {
     case VTK_CHAR:
       {
-      char *ptr;
+      vtkDICOMCharacterSet cs;
       if (vr.HasSpecificCharacterSet() &&
           this->LastTag > DC::SpecificCharacterSet)
         {
-        ptr = v.AllocateCharData(vr, this->Context->GetCharacterSet(), vl);
+        cs = this->Context->GetCharacterSet();
+        }
+      if (vl <= 24 && static_cast<size_t>(ep - cp) >= vl)
+        {
+        // short text values repeat endlessly in DICOM data sets, so
+        // they are drawn from a shared table instead of allocated
+        v = vtkDICOMValue::Intern(
+          vr, cs, reinterpret_cast<const char *>(cp), vl);
+        cp += vl;
+        l = vl;
         }
       else
         {
-        ptr = v.AllocateCharData(vr, vl);
+        char *ptr = v.AllocateCharData(vr, cs, vl);
+        l = this->ReadData(cp, ep, ptr, vl);
+        // AllocateCharData makes room for terminal null
+        if (l == 0 || ptr[l-1] != '\0') { ptr[l] = '\0'; }
+        v.ComputeNumberOfValuesForCharData();
         }
-      l = this->ReadData(cp, ep, ptr, vl);
-      // AllocateCharData makes room for terminal null
-      if (l == 0 || ptr[l-1] != '\0') { ptr[l] = '\0'; }
-      v.ComputeNumberOfValuesForCharData();
       }
       break;
     case VTK_UNSIGNED_CHAR:
@@ -1357,20 +1453,15 @@ size_t Decoder<E>::ReadElementValue(
           break;
           }
         }
+      v = seq;
       if (vl != HxFFFFFFFF)
         {
         // if vl != 0xffffffff, then the sequence was fixed-size rather
-        // than delimited, so let's make our own fixed-size sequence and
-        // copy all of the items into it
-        size_t n = seq.GetNumberOfItems();
-        vtkDICOMSequence seq2(n);
-        for (size_t i = 0; i < n; i++)
-          {
-          seq2.SetItem(i, seq.GetItem(i));
-          }
-        seq = seq2;
+        // than delimited, so mark it as such (clear seq first so that
+        // the value is not shared when it is modified)
+        seq.Clear();
+        v.MarkSequenceAsFixedSize();
         }
-      v = seq;
 
       // reset the tag and VR as we step out of the sequence
       this->LastTag = tag;
@@ -1397,8 +1488,9 @@ bool Decoder<E>::ReadElements(
 
   while (tl < static_cast<size_t>(l) || l == HxFFFFFFFF)
     {
-    // read the tag
+    // read the tag, noting its byte offset for the offset table
     if (!this->CheckBuffer(cp, ep, 8)) { break; }
+    size_t start = this->GetByteOffset(cp, ep);
     unsigned short g = Decoder<E>::GetInt16(cp);
     unsigned short e = Decoder<E>::GetInt16(cp + 2);
     vtkDICOMTag tag(g,e);
@@ -1424,6 +1516,42 @@ bool Decoder<E>::ReadElements(
     // break if delimiter found
     if (!readGroup && tag == delimiter) { break; }
 
+    // accumulate the tag presence filter, if one was requested
+    if (g != HxFFFE)
+      {
+      this->FilterTag(tag);
+      }
+
+    // if a group length element is present and the query contains no
+    // keys in its group, use its value to hop over the whole group
+    // instead of decoding it element by element (the group length is
+    // checked against the remaining bytes, and a value that fails the
+    // check falls back to the element-by-element skip); the hop is
+    // not taken while a tag presence filter or an offset table is
+    // being accumulated, because those must visit every tag
+    if (this->TagFilter == 0 && this->OffsetTable == 0 &&
+        this->HasQuery && e == 0x0000 && vl == 4 && !readGroup &&
+        g != 0x0002 && g < 0x7fe0 && !this->QueryContainsGroup(g))
+      {
+      if (!this->CheckBuffer(cp, ep, 4)) { return false; }
+      unsigned int gl = Decoder<E>::GetInt32(cp);
+      cp += 4;
+      tl += 4;
+      if (gl != HxFFFFFFFF && (gl & 1) == 0 &&
+          (l == HxFFFFFFFF ||
+           (tl <= static_cast<size_t>(l) &&
+            static_cast<size_t>(gl) <= static_cast<size_t>(l) - tl)) &&
+          static_cast<vtkTypeInt64>(gl) <=
+            vtkDICOMParserInternalFriendship::GetBytesRemaining(
+              this->Parser, cp, ep))
+        {
+        size_t sl = this->SkipData(cp, ep, gl);
+        if (sl != static_cast<size_t>(gl)) { return false; }
+        tl += sl;
+        }
+      continue;
+      }
+
     // skip the value if this tag is not in the query
     if (this->HasQuery && !this->QueryContains(tag))
       {
@@ -1458,6 +1586,7 @@ bool Decoder<E>::ReadElements(
             }
           }
         }
+      this->OffsetElement(tag, start, this->GetByteOffset(cp, ep));
       continue;
       }
 
@@ -1510,6 +1639,9 @@ bool Decoder<E>::ReadElements(
       this->HandleMissingAttributes(tag);
       }
 
+    // record the extent of the element in the offset table
+    this->OffsetElement(tag, start, this->GetByteOffset(cp, ep));
+
     /*
     cout << tag << " " << vr << " " << vl << " " << v;
     vtkDICOMDictEntry entry;
@@ -1524,6 +1656,13 @@ bool Decoder<E>::ReadElements(
     if (this->HasQuery && !this->QueryMatches(v))
       {
       this->QueryMatched = false;
+      // a mismatch at the top level of the data set is permanent,
+      // whereas a mismatch within a sequence item might still be
+      // matched by one of the other items of the sequence
+      if (this->BailOnQueryFailure && this->Item == 0)
+        {
+        break;
+        }
       }
     }
 
@@ -1711,20 +1850,47 @@ vtkDICOMParser::vtkDICOMParser()
   this->BytesRead = 0;
   this->FileOffset = 0;
   this->FileSize = 0;
+  this->StartOffset = 0;
   this->Buffer = NULL;
+  this->MapBuffer = NULL;
+  this->InputBuffer = NULL;
+  this->InputBufferSize = 0;
+  this->TagFilterBuffer = NULL;
+  this->ComputeDigest = 0;
+  this->Digest = 0;
+  this->DigestLength = 0;
+  this->OffsetTable = NULL;
+  this->FragmentTable = NULL;
+  this->ZStream = NULL;
+  this->ZBuffer = NULL;
+  this->Deflated = false;
+  this->ZAllInput = false;
+  this->ZEnded = false;
   this->BufferSize = 8192;
   this->ChunkSize = 0;
+  this->MemoryMapping = 0;
+  this->WholeFileReads = 0;
+  this->StopAtQueryEnd = 0;
   this->Index = -1;
   this->PixelDataVL = 0;
   this->PixelDataFound = false;
   this->QueryMatched = false;
   this->ErrorCode = 0;
+  this->DeferErrorReporting = 0;
+  this->IOPriority = vtkDICOMFile::PriorityInteractive;
+  this->ConditionCount = 0;
 }
 
 // Destructor
 vtkDICOMParser::~vtkDICOMParser()
 {
+  if (this->Deflated)
+    {
+    this->EndInflate();
+    }
   delete [] this->FileName;
+  delete [] this->Buffer;
+  delete [] this->ZBuffer;
   delete this->QueryItem;
 
   if (this->MetaData)
@@ -1739,6 +1905,14 @@ vtkDICOMParser::~vtkDICOMParser()
     {
     this->Groups->Delete();
     }
+  if (this->OffsetTable)
+    {
+    this->OffsetTable->Delete();
+    }
+  if (this->FragmentTable)
+    {
+    this->FragmentTable->Delete();
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -1757,6 +1931,45 @@ void vtkDICOMParser::SetQueryItem(const vtkDICOMItem& query)
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetInputBuffer(const void *data, vtkTypeInt64 size)
+{
+  const unsigned char *ucp = static_cast<const unsigned char *>(data);
+  if (ucp == 0)
+    {
+    size = 0;
+    }
+  if (this->InputBuffer != ucp || this->InputBufferSize != size)
+    {
+    this->InputBuffer = ucp;
+    this->InputBufferSize = size;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetTagFilterBuffer(unsigned char *buffer)
+{
+  if (this->TagFilterBuffer != buffer)
+    {
+    this->TagFilterBuffer = buffer;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::TagFilterBits(vtkDICOMTag tag, unsigned int bits[3])
+{
+  // multiplicative hashing: one 32-bit hash of the tag provides all
+  // three bit positions (the filter holds 8*TagFilterSize bits)
+  unsigned int h = tag.GetGroup();
+  h = (h << 16) | tag.GetElement();
+  h *= 0x9E3779B1; // prime close to 2^32 divided by the golden ratio
+  bits[0] = (h >> 22);
+  bits[1] = (h >> 12) & 0x3FF;
+  bits[2] = (h >> 2) & 0x3FF;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMParser::SetBufferSize(int size)
 {
@@ -1798,6 +2011,15 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
   this->QueryMatched = (this->Query != 0 || this->QueryItem != 0);
   this->FileOffset = 0;
   this->FileSize = 0;
+  this->ConditionCount = 0;
+  this->Digest = 0;
+  this->DigestLength = 0;
+
+  // if the caller provided a buffer, parse it instead of a file
+  if (this->InputBuffer)
+    {
+    return this->ReadBuffer(data, idx);
+    }
 
   // Check that the file name has been set.
   if (!this->FileName)
@@ -1807,8 +2029,23 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
     return false;
     }
 
-  // Make sure that the file is readable.
-  vtkDICOMFile infile(this->FileName, vtkDICOMFile::In);
+  // time the parse, including the file IO, when profiling
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
+  // Make sure that the file is readable.  The parse always sweeps
+  // the file from front to back, so give the operating system a
+  // hint so that it can tune its readahead accordingly.
+  vtkDICOMFile::Hint hint = vtkDICOMFile::Sequential;
+  if (this->WholeFileReads)
+    {
+    hint = vtkDICOMFile::WholeFile;
+    }
+  vtkDICOMFile infile(this->FileName, vtkDICOMFile::In, hint);
+  infile.SetPriority(this->IOPriority);
   if (infile.GetError())
     {
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
@@ -1827,10 +2064,65 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
 
   this->InputFile = &infile;
   this->FileSize = infile.GetSize();
-  this->Buffer = new unsigned char [this->BufferSize + 8];
+  // when parsing a data set that is embedded within a larger file,
+  // skip ahead to where the data set starts (see SetStartOffset)
+  if (this->StartOffset > 0)
+    {
+    if (this->StartOffset >= this->FileSize ||
+        !infile.SetPosition(
+          static_cast<vtkDICOMFile::Size>(this->StartOffset)))
+      {
+      this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+      vtkErrorMacro("ReadFile: The start offset is past the end of "
+                    << this->FileName);
+      infile.Close();
+      this->InputFile = NULL;
+      return false;
+      }
+    this->FileSize -= this->StartOffset;
+    }
+  this->MapBuffer = NULL;
   this->BytesRead = 0;
   // guard against anyone changing BufferSize while reading
-  this->ChunkSize = this->BufferSize;
+  if (this->ChunkSize != this->BufferSize)
+    {
+    delete [] this->Buffer;
+    this->Buffer = NULL;
+    this->ChunkSize = this->BufferSize;
+    }
+
+  unsigned char *wholeFile = NULL;
+  if (this->MemoryMapping && this->StartOffset == 0)
+    {
+    // parse in place from a memory map, if the system allows it
+    // (an embedded data set is always read through the buffer)
+    this->MapBuffer = infile.Map(this->FileSize);
+    }
+  if (this->MapBuffer == NULL && this->WholeFileReads &&
+      this->FileSize > 0)
+    {
+    // fetch the whole file with a single large read, and then parse
+    // it in place just as if it had been memory-mapped
+    wholeFile = new unsigned char [static_cast<size_t>(this->FileSize)];
+    size_t n = infile.Read(wholeFile, static_cast<size_t>(this->FileSize));
+    if (n > 0)
+      {
+      // a short read means the file shrank after it was sized, so
+      // parse just the bytes that were actually read
+      this->FileSize = n;
+      this->MapBuffer = wholeFile;
+      }
+    else
+      {
+      // let the buffered path report the read error
+      delete [] wholeFile;
+      wholeFile = NULL;
+      }
+    }
+  if (this->MapBuffer == NULL && this->Buffer == NULL)
+    {
+    this->Buffer = new unsigned char [this->ChunkSize + 8];
+    }
 
   const unsigned char *cp = NULL;
   const unsigned char *ep = NULL;
@@ -1852,10 +2144,77 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
   this->ReadMetaHeader(cp, ep, data, idx);
   this->ReadMetaData(cp, ep, data, idx);
 
-  delete [] this->Buffer;
+  // the buffer is kept, so that parsing a series of files through the
+  // same parser does not allocate a new buffer for every file
+  if (this->Deflated)
+    {
+    this->EndInflate();
+    }
+  this->MapBuffer = NULL;
+  delete [] wholeFile;
   infile.Close();
   this->InputFile = NULL;
 
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    vtkDICOMProfiler::EndPhase(
+      this, vtkDICOMProfiler::MetaDataRead, profileStart,
+      static_cast<vtkTypeInt64>(this->BytesRead));
+    }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::ReadBuffer(vtkDICOMMetaData *data, int idx)
+{
+  // time the parse when profiling
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
+  // parse the caller's buffer in place, through the same code path
+  // that is used for memory-mapped files
+  this->InputFile = NULL;
+  this->FileSize = this->InputBufferSize;
+  this->MapBuffer = this->InputBuffer;
+  this->BytesRead = 0;
+
+  const unsigned char *cp = NULL;
+  const unsigned char *ep = NULL;
+  this->FillBuffer(cp, ep);
+
+  // check for the DICM magic number, which might not be present if
+  // the data set came from the network rather than from a file
+  if (ep - cp >= 132 &&
+      cp[128] == 'D' && cp[129] == 'I' && cp[130] == 'C' && cp[131] == 'M')
+    {
+    cp += 132;
+    }
+  else if (ep - cp >= 4 &&
+           cp[0] == 'D' && cp[1] == 'I' && cp[2] == 'C' && cp[3] == 'M')
+    {
+    cp += 4;
+    }
+
+  this->ReadMetaHeader(cp, ep, data, idx);
+  this->ReadMetaData(cp, ep, data, idx);
+
+  if (this->Deflated)
+    {
+    this->EndInflate();
+    }
+  this->MapBuffer = NULL;
+
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    vtkDICOMProfiler::EndPhase(
+      this, vtkDICOMProfiler::MetaDataRead, profileStart,
+      static_cast<vtkTypeInt64>(this->BytesRead));
+    }
+
   return true;
 }
 
@@ -1954,6 +2313,15 @@ bool vtkDICOMParser::ReadMetaData(
     {
     decoder = &decoderBE;
     }
+  else if (tsyntax == "1.2.840.10008.1.2.1.99") // Deflated Explicit LE
+    {
+    // everything after the meta header is a raw deflate stream,
+    // switch the buffer-filling machinery over to inflation
+    if (!this->StartInflate(cp, ep))
+      {
+      return false;
+      }
+    }
 
   // get the Query
   vtkDICOMDataElementIterator iter;
@@ -2059,6 +2427,7 @@ bool vtkDICOMParser::ReadMetaData(
   bool readFailure = false;
   bool queryFailure = (hasQuery && !this->QueryMatched);
   bool bailOnQueryFailure = (meta && meta->GetNumberOfInstances() == 1);
+  decoder->SetBailOnQueryFailure(hasQuery && bailOnQueryFailure);
   while (!foundPixelData && !readFailure &&
          (!queryFailure || !bailOnQueryFailure))
     {
@@ -2076,6 +2445,11 @@ bool vtkDICOMParser::ReadMetaData(
         ++giter;
         }
       found = (giter != groups.end() && *giter == tag.GetGroup());
+      // stop early if all of the requested groups have been passed
+      if (this->StopAtQueryEnd && giter == groups.end())
+        {
+        break;
+        }
       }
 
     // create a delimiter to read/skip only this group
@@ -2136,13 +2510,115 @@ bool vtkDICOMParser::ReadMetaData(
       }
     }
 
+  if (this->FragmentTable && meta && this->PixelDataFound &&
+      this->PixelDataVL == HxFFFFFFFF)
+    {
+    // walk the items of the encapsulated pixel data and record
+    // their byte ranges, so that the compressed fragments can be
+    // spliced into another file without being decoded
+    this->ReadFragmentTable(cp, ep);
+    }
+
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::ReadFragmentTable(
+  const unsigned char* &cp, const unsigned char* &ep)
+{
+  // the items of an encapsulated PixelData element are always
+  // encoded in little-endian byte order
+  for (;;)
+    {
+    if (ep - cp < 8 && !this->FillBuffer(cp, ep))
+      {
+      break;
+      }
+    if (ep - cp < 8)
+      {
+      break;
+      }
+    unsigned short g = static_cast<unsigned short>(cp[0] | (cp[1] << 8));
+    unsigned short e = static_cast<unsigned short>(cp[2] | (cp[3] << 8));
+    unsigned int vl = (static_cast<unsigned int>(cp[4]) |
+                       (static_cast<unsigned int>(cp[5]) << 8) |
+                       (static_cast<unsigned int>(cp[6]) << 16) |
+                       (static_cast<unsigned int>(cp[7]) << 24));
+    cp += 8;
+
+    if (g == HxFFFE && e == HxE0DD)
+      {
+      // the sequence delimiter marks the end of the pixel data
+      return true;
+      }
+    if (g != HxFFFE || e != HxE000 || vl == HxFFFFFFFF)
+      {
+      // not a valid item head
+      break;
+      }
+
+    this->FragmentTable->InsertNextValue(this->GetBytesProcessed(cp, ep));
+    this->FragmentTable->InsertNextValue(static_cast<vtkTypeInt64>(vl));
+
+    // skip over the item value
+    vtkTypeInt64 n = vl;
+    while (n > 0)
+      {
+      vtkTypeInt64 m = ep - cp;
+      if (m == 0)
+        {
+        if (!this->FillBuffer(cp, ep) || cp == ep)
+          {
+          break;
+          }
+        m = ep - cp;
+        }
+      m = (m < n ? m : n);
+      cp += m;
+      n -= m;
+      }
+    if (n > 0)
+      {
+      // the file ended in the middle of the item value
+      break;
+      }
+    }
+
+  // the encapsulation was malformed or truncated, so empty the
+  // table to tell the caller that it cannot be relied upon
+  this->FragmentTable->Initialize();
+  return false;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMParser::FillBuffer(
   const unsigned char* &ucp, const unsigned char* &ep)
 {
+  if (this->Deflated)
+    {
+    return this->FillInflatedBuffer(ucp, ep);
+    }
+
+  if (this->MapBuffer)
+    {
+    // the whole file is mapped, so hand out the full range at once,
+    // any later call means that the data has been exhausted
+    if (this->BytesRead == 0 && this->FileSize > 0)
+      {
+      ucp = this->MapBuffer;
+      ep = this->MapBuffer + this->FileSize;
+      this->BytesRead = this->FileSize;
+      if (this->ComputeDigest)
+        {
+        this->Digest = vtkDICOMUtilities::ComputeCRC32C(
+          this->Digest, ucp, static_cast<size_t>(this->FileSize));
+        this->DigestLength += this->FileSize;
+        }
+      return true;
+      }
+    return false;
+    }
+
   unsigned char *dp = this->Buffer;
   size_t n = ep - ucp;
   const unsigned char *cp = ucp;
@@ -2176,6 +2652,11 @@ bool vtkDICOMParser::FillBuffer(
 
   // get number of chars read
   this->BytesRead += n;
+  if (this->ComputeDigest)
+    {
+    this->Digest = vtkDICOMUtilities::ComputeCRC32C(this->Digest, dp, n);
+    this->DigestLength += n;
+    }
 
   // ep is recycled chars plus newly read chars
   ep = dp + n;
@@ -2184,10 +2665,191 @@ bool vtkDICOMParser::FillBuffer(
   return true;
 }
 
+//----------------------------------------------------------------------------
+// Switch the parser over to the Deflated Explicit VR Little Endian
+// transfer syntax.  The meta header was read raw, and the remainder of
+// the input (whatever is left in the parse buffer, plus whatever has
+// not yet been read from the file) is a raw deflate stream that holds
+// the data set.  After this call, FillBuffer() refills the parse
+// buffer by inflating the stream, and the byte offsets that the parser
+// reports refer to positions within the inflated data set.
+bool vtkDICOMParser::StartInflate(
+  const unsigned char* &cp, const unsigned char* &ep)
+{
+  z_stream *zs = new z_stream;
+  memset(zs, 0, sizeof(z_stream));
+
+  // negative window bits: raw deflate data, without a zlib header
+  if (inflateInit2(zs, -15) != Z_OK)
+    {
+    delete zs;
+    this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+    vtkErrorMacro("StartInflate: could not allocate the inflate state");
+    return false;
+    }
+  this->ZStream = zs;
+
+  // the bytes of the stream that are already in memory
+  size_t tail = ep - cp;
+
+  if (this->MapBuffer)
+    {
+    // the whole compressed input is already in memory
+    zs->next_in = const_cast<unsigned char *>(cp);
+    zs->avail_in = static_cast<unsigned int>(tail);
+    this->ZAllInput = true;
+    }
+  else
+    {
+    // compressed input is read from the file in chunks, starting
+    // with the unparsed tail of the current buffer
+    if (this->ZBuffer == NULL)
+      {
+      this->ZBuffer = new unsigned char [this->ChunkSize + 8];
+      }
+    if (tail != 0)
+      {
+      memcpy(this->ZBuffer, cp, tail);
+      }
+    zs->next_in = this->ZBuffer;
+    zs->avail_in = static_cast<unsigned int>(tail);
+    this->ZAllInput = false;
+    }
+
+  // from here on, BytesRead counts inflated bytes, continuing from
+  // the raw offset at which the deflate stream begins
+  this->BytesRead = this->GetBytesProcessed(cp, ep);
+
+  // inflation always goes through the parse buffer, even if the
+  // compressed input was memory-mapped
+  if (this->ChunkSize != this->BufferSize)
+    {
+    delete [] this->Buffer;
+    this->Buffer = NULL;
+    this->ChunkSize = this->BufferSize;
+    }
+  if (this->Buffer == NULL)
+    {
+    this->Buffer = new unsigned char [this->ChunkSize + 8];
+    }
+
+  cp = this->Buffer;
+  ep = this->Buffer;
+  this->ZEnded = false;
+  this->Deflated = true;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::FillInflatedBuffer(
+  const unsigned char* &ucp, const unsigned char* &ep)
+{
+  z_stream *zs = static_cast<z_stream *>(this->ZStream);
+
+  unsigned char *dp = this->Buffer;
+  size_t n = ep - ucp;
+  const unsigned char *cp = ucp;
+
+  // number of bytes to inflate
+  size_t nbytes = this->ChunkSize;
+  if (n != 0)
+    {
+    // make sure the inflated data will not overflow the buffer
+    if (n > 8)
+      {
+      nbytes -= (n - 8);
+      }
+    // recycle unused buffer chars to head of buffer
+    do { *dp++ = *cp++; } while (--n);
+    }
+  else if (this->ZEnded)
+    {
+    // if buffer is drained, and the stream has ended, then done
+    return false;
+    }
+
+  zs->next_out = dp;
+  zs->avail_out = static_cast<unsigned int>(nbytes);
+
+  while (zs->avail_out > 0 && !this->ZEnded)
+    {
+    if (zs->avail_in == 0)
+      {
+      // fetch more compressed input, unless it was all in memory
+      size_t m = 0;
+      if (!this->ZAllInput &&
+          !this->InputFile->GetError() &&
+          !this->InputFile->EndOfFile())
+        {
+        m = this->InputFile->Read(this->ZBuffer, this->ChunkSize);
+        if (this->ComputeDigest)
+          {
+          this->Digest = vtkDICOMUtilities::ComputeCRC32C(
+            this->Digest, this->ZBuffer, m);
+          this->DigestLength += m;
+          }
+        }
+      if (m == 0)
+        {
+        // a truncated stream ends where the input ends
+        this->ZEnded = true;
+        break;
+        }
+      zs->next_in = this->ZBuffer;
+      zs->avail_in = static_cast<unsigned int>(m);
+      }
+
+    int code = inflate(zs, Z_NO_FLUSH);
+    if (code == Z_STREAM_END)
+      {
+      this->ZEnded = true;
+      }
+    else if (code != Z_OK)
+      {
+      this->ZEnded = true;
+      this->SetErrorCode(vtkErrorCode::FileFormatError);
+      vtkErrorMacro("FillBuffer: corrupt deflate stream in file "
+                    << (this->FileName ? this->FileName
+                                       : "(input buffer)"));
+      }
+    }
+
+  // get number of chars inflated
+  n = nbytes - zs->avail_out;
+  this->BytesRead += n;
+
+  // ep is recycled chars plus newly inflated chars
+  ep = dp + n;
+  ucp = this->Buffer;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::EndInflate()
+{
+  z_stream *zs = static_cast<z_stream *>(this->ZStream);
+  inflateEnd(zs);
+  delete zs;
+  this->ZStream = NULL;
+  this->Deflated = false;
+  this->ZAllInput = false;
+  this->ZEnded = false;
+}
+
 //----------------------------------------------------------------------------
 vtkTypeInt64 vtkDICOMParser::GetBytesRemaining(
   const unsigned char *cp, const unsigned char *ep)
 {
+  if (this->Deflated)
+    {
+    // the file size gives the compressed size, and the inflated size
+    // is not known until the stream has been fully decompressed, so
+    // no bound can be put on the number of bytes remaining
+    return (static_cast<vtkTypeInt64>(1) << 62);
+    }
+
   return static_cast<vtkTypeInt64>(
     this->FileSize - this->BytesRead + (ep - cp));
 }
@@ -2208,7 +2870,128 @@ void vtkDICOMParser::ParseError(
   this->FileOffset = this->GetBytesProcessed(cp, ep);
   this->SetErrorCode(vtkErrorCode::FileFormatError);
   vtkErrorMacro("At byte offset " << this->FileOffset << " in file "
-                << this->FileName << ": " << message);
+                << (this->FileName ? this->FileName : "(input buffer)")
+                << ": " << message);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::ParseError(
+  const unsigned char* cp, const unsigned char* ep,
+  int condition, vtkDICOMTag tag)
+{
+  // record the condition into the ring, which is cheap enough to do
+  // even for errors that the caller is going to ignore
+  int i = this->ConditionCount % ConditionRingSize;
+  this->Conditions[i] = condition;
+  this->ConditionTags[i] = tag;
+  this->ConditionOffsets[i] = this->GetBytesProcessed(cp, ep);
+  this->ConditionCount++;
+
+  if (this->DeferErrorReporting)
+    {
+    // defer the rendering of the message until someone asks for it
+    this->FileOffset = this->ConditionOffsets[i];
+    this->SetErrorCode(vtkErrorCode::FileFormatError);
+    }
+  else
+    {
+    this->ParseError(cp, ep, vtkDICOMParser::GetConditionText(condition));
+    }
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMParser::ConditionIndex(int i)
+{
+  int n = this->ConditionCount;
+  int m = (n < ConditionRingSize ? n : ConditionRingSize);
+  int j = -1;
+  if (i >= 0 && i < m)
+    {
+    j = i;
+    if (n > ConditionRingSize)
+      {
+      // the ring has wrapped, so the oldest retained condition
+      // sits in the slot that would be overwritten next
+      j = (n + i) % ConditionRingSize;
+      }
+    }
+  return j;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMParser::GetCondition(int i)
+{
+  int j = this->ConditionIndex(i);
+  return (j < 0 ? vtkDICOMParser::NoCondition : this->Conditions[j]);
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMTag vtkDICOMParser::GetConditionTag(int i)
+{
+  int j = this->ConditionIndex(i);
+  return (j < 0 ? vtkDICOMTag() : this->ConditionTags[j]);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMParser::GetConditionOffset(int i)
+{
+  int j = this->ConditionIndex(i);
+  return (j < 0 ? 0 : this->ConditionOffsets[j]);
+}
+
+//----------------------------------------------------------------------------
+const char *vtkDICOMParser::GetConditionText(int condition)
+{
+  const char *text = "Unspecified parse error.";
+  switch (condition)
+    {
+    case vtkDICOMParser::NoCondition:
+      text = "No error.";
+      break;
+    case vtkDICOMParser::UnexpectedEndOfFile:
+      text = "Unexpected end of file.";
+      break;
+    case vtkDICOMParser::MissingItemTag:
+      text = "Encapsulated object is missing (FFFE,E000) tag.";
+      break;
+    case vtkDICOMParser::IllegalValueLength:
+      text = "Illegal item length FFFFFFFF encountered.";
+      break;
+    case vtkDICOMParser::ValueTooLarge:
+      text = "Item length exceeds the bytes remaining in file.";
+      break;
+    }
+  return text;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMParser::GetConditionMessage(int i)
+{
+  std::string s;
+  int j = this->ConditionIndex(i);
+  if (j >= 0)
+    {
+    // render the offset in decimal (printf formats for 64-bit
+    // integers are not portable)
+    char offsetText[24];
+    char *tp = &offsetText[24];
+    *(--tp) = '\0';
+    vtkTypeInt64 offset = this->ConditionOffsets[j];
+    do
+      {
+      *(--tp) = '0' + static_cast<char>(offset % 10);
+      offset /= 10;
+      }
+    while (offset != 0);
+
+    s = "At byte offset ";
+    s += tp;
+    s += " in file ";
+    s += (this->FileName ? this->FileName : "(input buffer)");
+    s += ": ";
+    s += vtkDICOMParser::GetConditionText(this->Conditions[j]);
+    }
+  return s;
 }
 
 //----------------------------------------------------------------------------
@@ -2223,9 +3006,24 @@ void vtkDICOMParser::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PixelDataVL: " << this->PixelDataVL << "\n";
   os << indent << "FileOffset: " << this->FileOffset << "\n";
   os << indent << "FileSize: " << this->FileSize << "\n";
+  os << indent << "StartOffset: " << this->StartOffset << "\n";
   os << indent << "MetaData: " << this->MetaData << "\n";
   os << indent << "Index: " << this->Index << "\n";
   os << indent << "BufferSize: " << this->BufferSize << "\n";
+  os << indent << "MemoryMapping: "
+     << (this->MemoryMapping ? "On\n" : "Off\n");
+  os << indent << "WholeFileReads: "
+     << (this->WholeFileReads ? "On\n" : "Off\n");
+  os << indent << "StopAtQueryEnd: "
+     << (this->StopAtQueryEnd ? "On\n" : "Off\n");
+  os << indent << "ComputeDigest: "
+     << (this->ComputeDigest ? "On\n" : "Off\n");
+  os << indent << "Digest: " << this->Digest << "\n";
+  os << indent << "DigestLength: " << this->DigestLength << "\n";
+  os << indent << "DeferErrorReporting: "
+     << (this->DeferErrorReporting ? "On\n" : "Off\n");
+  os << indent << "IOPriority: " << this->IOPriority << "\n";
+  os << indent << "NumberOfConditions: " << this->ConditionCount << "\n";
   os << indent << "Query: " << this->Query << "\n";
   os << indent << "QueryItem: " << this->QueryItem << "\n";
   os << indent << "QueryMatched: "
@@ -17,10 +17,12 @@
 #include <vtkObject.h>
 #include <vtkStdString.h> // For std::string
 #include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMTag.h" // For vtkDICOMTag
 
 class vtkDICOMFile;
 class vtkDICOMItem;
 class vtkDICOMMetaData;
+class vtkTypeInt64Array;
 class vtkUnsignedShortArray;
 class vtkDICOMParserInternalFriendship;
 
@@ -44,6 +46,23 @@ public:
   //! Print a summary of the contents of this object.
   void PrintSelf(ostream& os, vtkIndent indent);
 
+  //! Error conditions that can be recorded while parsing a file.
+  /*!
+   *  These describe the recoverable oddities that can be encountered
+   *  in a malformed file.  Each condition is recorded together with
+   *  the tag and the file offset at which it occurred, so that an
+   *  error string can be rendered on demand rather than every time
+   *  that a condition occurs (see DeferErrorReporting).
+   */
+  enum Condition
+  {
+    NoCondition,         // no error condition was recorded
+    UnexpectedEndOfFile, // the file ended in the middle of an element
+    MissingItemTag,      // encapsulated data lacks the (FFFE,E000) tag
+    IllegalValueLength,  // undefined length where it is not permitted
+    ValueTooLarge        // value length exceeds the rest of the file
+  };
+
   //@{
   //! Set the file name.
   vtkSetStringMacro(FileName);
@@ -115,6 +134,19 @@ public:
   //! Get the total file length (only valid after Update).
   vtkTypeInt64 GetFileSize() { return this->FileSize; }
 
+  //@{
+  //! Set a byte offset at which to start parsing (default: zero).
+  /*!
+   *  This allows a data set that is embedded within a larger file,
+   *  such as a series bundle (see vtkDICOMBundle), to be parsed in
+   *  place.  The values reported by GetFileOffset() and GetFileSize()
+   *  are relative to the start offset.  Memory mapping is not used
+   *  when a start offset has been set.
+   */
+  vtkSetMacro(StartOffset, vtkTypeInt64);
+  vtkTypeInt64 GetStartOffset() { return this->StartOffset; }
+  //@}
+
   //@{
   //! Set the buffer size, the default is 8192 (8k).
   /*!
@@ -125,6 +157,202 @@ public:
   int GetBufferSize() { return this->BufferSize; }
   //@}
 
+  //@{
+  //! Read the file through a memory map instead of a buffer.
+  /*!
+   *  When this is on, the parser will attempt to memory-map the input
+   *  file and parse the data elements in place, rather than reading
+   *  the file through a small heap buffer.  If the file cannot be
+   *  mapped, the parser silently falls back to buffered reads.
+   */
+  vtkSetMacro(MemoryMapping, int);
+  vtkBooleanMacro(MemoryMapping, int);
+  int GetMemoryMapping() { return this->MemoryMapping; }
+  //@}
+
+  //@{
+  //! Read each file with a single large read call (default: Off).
+  /*!
+   *  When this is on, the parser reads the whole file into memory
+   *  with one read call and parses it in place, instead of pulling
+   *  the file through a small buffer one chunk at a time.  For cold
+   *  files, this allows the operating system to fetch the data with
+   *  one large request rather than many small ones.  This setting
+   *  has no effect if the file was successfully memory-mapped, or
+   *  if an input buffer has been set.
+   */
+  vtkSetMacro(WholeFileReads, int);
+  vtkBooleanMacro(WholeFileReads, int);
+  int GetWholeFileReads() { return this->WholeFileReads; }
+  //@}
+
+  //@{
+  //! Parse a buffer in memory, instead of a file on disk.
+  /*!
+   *  If a buffer is set, then Update() will parse the data set in the
+   *  buffer instead of opening the file named by SetFileName().  This
+   *  makes it possible to extract the metadata from a data set that
+   *  arrived over a network without first spooling it to disk.  The
+   *  buffer must contain the complete metadata, but it can be
+   *  truncated at (or anywhere after) the start of the PixelData.
+   *  The data is parsed in place, and the caller retains ownership
+   *  of the buffer, which must not be freed before Update() returns.
+   *  Pass a null pointer to go back to reading from the file.
+   */
+  void SetInputBuffer(const void *data, vtkTypeInt64 size);
+  const void *GetInputBuffer() { return this->InputBuffer; }
+  vtkTypeInt64 GetInputBufferSize() { return this->InputBufferSize; }
+  //@}
+
+  //@{
+  //! Accumulate a tag presence filter while parsing (default: none).
+  /*!
+   *  Provide a buffer of TagFilterSize bytes into which the parser
+   *  will accumulate a Bloom filter of the element tags that it
+   *  decodes.  For each top-level element, three bits computed from
+   *  the tag (see TagFilterBits) are set in the buffer, so that a
+   *  file can later be ruled out as containing a given tag without
+   *  being opened: if any of the tag's bits are clear, the tag is
+   *  certainly absent, while set bits make the file a candidate.
+   *  The caller must clear the buffer beforehand and retains
+   *  ownership of it.  While a filter is being accumulated, whole
+   *  groups are never hopped over via their group length elements,
+   *  so every top-level tag is visited; however, tags that lie
+   *  beyond the PixelData (or beyond wherever the read stops) are
+   *  not included.  Pass a null pointer to turn accumulation off.
+   */
+  void SetTagFilterBuffer(unsigned char *buffer);
+  unsigned char *GetTagFilterBuffer() { return this->TagFilterBuffer; }
+
+  //! The size, in bytes, of a tag presence filter buffer.
+  enum { TagFilterSize = 128 };
+
+  //! Compute the three filter bit positions for a tag.
+  /*!
+   *  The positions index into the bits of a TagFilterSize-byte
+   *  buffer, where bit i of byte j is numbered 8*j+i.
+   */
+  static void TagFilterBits(vtkDICOMTag tag, unsigned int bits[3]);
+  //@}
+
+  //@{
+  //! Compute a digest of the bytes read while parsing (default: off).
+  /*!
+   *  When this option is on, a CRC-32C checksum (see
+   *  vtkDICOMUtilities::ComputeCRC32C) is folded into the bytes as
+   *  they are read, which costs almost nothing since the bytes are
+   *  passing through the processor anyway.  The digest covers a
+   *  contiguous range of the file that begins at StartOffset: for
+   *  buffered reads the range ends a little past wherever the parse
+   *  stopped (normally the start of the PixelData), while for
+   *  memory-mapped and whole-file reads it covers the entire file,
+   *  so GetDigestLength() must be used to learn how many bytes the
+   *  digest covers, and two digests are only comparable when their
+   *  lengths are equal.  For a deflated data set, the digest covers
+   *  the compressed bytes as they appear in the file.
+   */
+  vtkSetMacro(ComputeDigest, int);
+  vtkBooleanMacro(ComputeDigest, int);
+  vtkGetMacro(ComputeDigest, int);
+
+  //! Get the digest of the bytes read by the last Update().
+  unsigned int GetDigest() { return this->Digest; }
+
+  //! Get the number of bytes that the digest covers.
+  vtkTypeInt64 GetDigestLength() { return this->DigestLength; }
+  //@}
+
+  //@{
+  //! Record the byte range of every top-level element (default: none).
+  /*!
+   *  Provide an array into which the parser will append one tuple
+   *  per top-level data element: the tag packed into a single
+   *  integer as (group << 16) | element, the file offset of the
+   *  start of the element head, and the file offset just past the
+   *  end of the element value.  The recorded ranges cover the file
+   *  meta header and every top-level element before the PixelData,
+   *  in file order; elements nested within sequence items are not
+   *  recorded separately, their bytes belong to the range of the
+   *  sequence that contains them.  The table allows individual
+   *  elements of the file to be rewritten without recompiling it,
+   *  see the PatchFile method of vtkDICOMCompiler.  Parse without
+   *  a query to get complete coverage, since elements that a query
+   *  causes to be hopped over are not recorded.  The caller must
+   *  reset the array beforehand, and should pass a null pointer to
+   *  turn recording off.
+   */
+  void SetOffsetTable(vtkTypeInt64Array *table);
+  vtkTypeInt64Array *GetOffsetTable() { return this->OffsetTable; }
+  //@}
+
+  //@{
+  //! Record the byte ranges of encapsulated fragments (default: none).
+  /*!
+   *  Provide an array into which the parser will append one pair of
+   *  values per item of an encapsulated PixelData element: the file
+   *  offset of the start of the item value (on the same basis as
+   *  GetFileOffset()) and the length of the value in bytes.  The
+   *  first recorded item is the basic offset table, which may have a
+   *  length of zero, and the items that follow it are the compressed
+   *  fragments.  Together with the WriteCompressedFrame method of
+   *  vtkDICOMCompiler, this allows the pixel data of a compressed
+   *  file to be spliced verbatim into a rewritten file without a
+   *  decode and re-encode cycle.  Nothing is recorded when the pixel
+   *  data is not encapsulated, and the table is emptied if the
+   *  encapsulation is malformed.  The caller must reset the array
+   *  beforehand, and should pass a null pointer to turn recording
+   *  off.
+   */
+  void SetFragmentTable(vtkTypeInt64Array *table);
+  vtkTypeInt64Array *GetFragmentTable() { return this->FragmentTable; }
+  //@}
+
+  //@{
+  //! Stop reading the file once the query has been passed (default: Off).
+  /*!
+   *  When this is on and a query has been set, the parser will stop
+   *  reading as soon as the file position passes the last tag group
+   *  that appears in the query, instead of scanning all the way to
+   *  the PixelData.  When the read stops early, GetPixelDataFound()
+   *  and GetFileOffset() refer only to the portion of the file that
+   *  was read.  This also applies to the groups set with SetGroups().
+   */
+  vtkSetMacro(StopAtQueryEnd, int);
+  vtkBooleanMacro(StopAtQueryEnd, int);
+  int GetStopAtQueryEnd() { return this->StopAtQueryEnd; }
+  //@}
+
+  //@{
+  //! Defer the rendering of parse errors into text (default: Off).
+  /*!
+   *  When this is on, recoverable parse errors (bad padding,
+   *  truncated elements, and so on) are recorded as cheap condition
+   *  codes instead of being formatted into strings and reported
+   *  through the VTK error pathway.  The ErrorCode is still set,
+   *  and the recorded conditions can be examined with GetCondition()
+   *  and rendered into text with GetConditionMessage().  Use this
+   *  when scanning large numbers of files whose individual errors
+   *  will usually be ignored.
+   */
+  vtkSetMacro(DeferErrorReporting, int);
+  vtkBooleanMacro(DeferErrorReporting, int);
+  int GetDeferErrorReporting() { return this->DeferErrorReporting; }
+  //@}
+
+  //@{
+  //! The I/O scheduling priority for reads done by this parser.
+  /*!
+   *  Set this to vtkDICOMFile::PriorityBackground for a parser that
+   *  scans files in the background, so that its reads yield to any
+   *  interactive reads that are in progress in the same process (and
+   *  are throttled, if a rate has been set with the static method
+   *  vtkDICOMFile::SetBackgroundByteRate()).  The default is
+   *  vtkDICOMFile::PriorityInteractive.
+   */
+  vtkSetMacro(IOPriority, int);
+  vtkGetMacro(IOPriority, int);
+  //@}
+
   //@{
   //! Read the metadata from the file.
   virtual void Update();
@@ -133,6 +361,42 @@ public:
   unsigned long GetErrorCode() { return this->ErrorCode; }
   //@}
 
+  //@{
+  //! Get the number of error conditions recorded by the last Update().
+  /*!
+   *  Conditions are recorded whether DeferErrorReporting is on or
+   *  off, so this can also be used to check how many parse errors
+   *  contributed to the reported ErrorCode.
+   */
+  int GetNumberOfConditions() { return this->ConditionCount; }
+
+  //! Get one of the recorded error conditions.
+  /*!
+   *  The conditions are stored in a small fixed-size ring, so if
+   *  more conditions occurred than the ring can hold, only the most
+   *  recent ones can be retrieved.  The index runs from zero (the
+   *  oldest retained condition) upwards, and NoCondition is returned
+   *  if the index is out of range.
+   */
+  int GetCondition(int i);
+
+  //! Get the tag that was being parsed when the condition occurred.
+  vtkDICOMTag GetConditionTag(int i);
+
+  //! Get the file offset at which the condition occurred.
+  vtkTypeInt64 GetConditionOffset(int i);
+
+  //! Render one of the recorded conditions as an error message.
+  /*!
+   *  This produces the same text that would have been reported
+   *  through the VTK error pathway if DeferErrorReporting were off.
+   */
+  std::string GetConditionMessage(int i);
+
+  //! Get the message text for a condition code (static method).
+  static const char *GetConditionText(int condition);
+  //@}
+
 protected:
   vtkDICOMParser();
   ~vtkDICOMParser();
@@ -151,6 +415,17 @@ protected:
   virtual bool FillBuffer(
     const unsigned char* &cp, const unsigned char* &ep);
 
+  //! Switch to inflating a deflated data set (see the cxx file).
+  bool StartInflate(
+    const unsigned char* &cp, const unsigned char* &ep);
+
+  //! Fill the buffer by inflating data from the deflate stream.
+  bool FillInflatedBuffer(
+    const unsigned char* &cp, const unsigned char* &ep);
+
+  //! Free the inflate state at the end of a deflated parse.
+  void EndInflate();
+
   //! Get the bytes remaining in the file.
   virtual vtkTypeInt64 GetBytesRemaining(
     const unsigned char *cp, const unsigned char *ep);
@@ -159,12 +434,28 @@ protected:
   virtual void ParseError(
     const unsigned char *cp, const unsigned char *ep, const char *message);
 
+  //! Record an error condition, and report it unless deferred.
+  /*!
+   *  This records the condition code, the current tag, and the file
+   *  offset into the condition ring.  If DeferErrorReporting is off,
+   *  then the condition is also rendered into text and reported
+   *  through the virtual ParseError() method.
+   */
+  void ParseError(const unsigned char *cp, const unsigned char *ep,
+                  int condition, vtkDICOMTag tag);
+
+  //! Convert a condition index into a ring index (or -1 if invalid).
+  int ConditionIndex(int i);
+
   //! Set the error code.
   void SetErrorCode(unsigned long e) { this->ErrorCode = e; }
 
   //! Read the file into the provided metadata object.
   virtual bool ReadFile(vtkDICOMMetaData *data, int idx);
 
+  //! Read the input buffer into the provided metadata object.
+  virtual bool ReadBuffer(vtkDICOMMetaData *data, int idx);
+
   //! Read just the meta header (group 0x0002).
   bool ReadMetaHeader(
     const unsigned char* &cp, const unsigned char* &ep,
@@ -175,6 +466,10 @@ protected:
     const unsigned char* &cp, const unsigned char* &ep,
     vtkDICOMMetaData *data, int idx);
 
+  //! Record the item layout of an encapsulated PixelData value.
+  bool ReadFragmentTable(
+    const unsigned char* &cp, const unsigned char* &ep);
+
   //! Compute the file offset to the current position.
   vtkTypeInt64 GetBytesProcessed(
     const unsigned char* cp, const unsigned char* ep);
@@ -189,15 +484,42 @@ protected:
   vtkTypeInt64 BytesRead;
   vtkTypeInt64 FileOffset;
   vtkTypeInt64 FileSize;
+  vtkTypeInt64 StartOffset;
   unsigned char *Buffer;
+  const unsigned char *MapBuffer;
+  const unsigned char *InputBuffer;
+  vtkTypeInt64 InputBufferSize;
+  unsigned char *TagFilterBuffer;
+  int ComputeDigest;
+  unsigned int Digest;
+  vtkTypeInt64 DigestLength;
+  vtkTypeInt64Array *OffsetTable;
+  vtkTypeInt64Array *FragmentTable;
+  void *ZStream;
+  unsigned char *ZBuffer;
+  bool Deflated;
+  bool ZAllInput;
+  bool ZEnded;
   int BufferSize;
   int ChunkSize;
+  int MemoryMapping;
+  int WholeFileReads;
+  int StopAtQueryEnd;
   int Index;
   unsigned int PixelDataVL;
   bool PixelDataFound;
   bool QueryMatched;
   unsigned long ErrorCode;
 
+  // the ring that error conditions are recorded into
+  enum { ConditionRingSize = 8 };
+  int DeferErrorReporting;
+  int IOPriority;
+  int ConditionCount;
+  int Conditions[ConditionRingSize];
+  vtkDICOMTag ConditionTags[ConditionRingSize];
+  vtkTypeInt64 ConditionOffsets[ConditionRingSize];
+
   // used to share FillBuffer with internal classes
   friend class vtkDICOMParserInternalFriendship;
 
@@ -0,0 +1,119 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMProfiler.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkSimpleCriticalSection.h>
+#include <vtkTimerLog.h>
+
+vtkStandardNewMacro(vtkDICOMProfiler);
+
+bool vtkDICOMProfiler::Enabled;
+double vtkDICOMProfiler::Seconds[vtkDICOMProfiler::NumberOfPhases];
+vtkTypeInt64 vtkDICOMProfiler::Bytes[vtkDICOMProfiler::NumberOfPhases];
+vtkTypeInt64 vtkDICOMProfiler::Count[vtkDICOMProfiler::NumberOfPhases];
+
+// serializes access to the accumulated totals
+static vtkSimpleCriticalSection vtkDICOMProfilerLock;
+
+//----------------------------------------------------------------------------
+void vtkDICOMProfiler::SetEnabled(bool enabled)
+{
+  vtkDICOMProfiler::Enabled = enabled;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMProfiler::Reset()
+{
+  vtkDICOMProfilerLock.Lock();
+  for (int i = 0; i < vtkDICOMProfiler::NumberOfPhases; i++)
+    {
+    vtkDICOMProfiler::Seconds[i] = 0.0;
+    vtkDICOMProfiler::Bytes[i] = 0;
+    vtkDICOMProfiler::Count[i] = 0;
+    }
+  vtkDICOMProfilerLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMProfiler::GetPhaseStatistics(
+  int phase, double *seconds, vtkTypeInt64 *bytes, vtkTypeInt64 *count)
+{
+  double s = 0.0;
+  vtkTypeInt64 b = 0;
+  vtkTypeInt64 c = 0;
+
+  if (phase >= 0 && phase < vtkDICOMProfiler::NumberOfPhases)
+    {
+    vtkDICOMProfilerLock.Lock();
+    s = vtkDICOMProfiler::Seconds[phase];
+    b = vtkDICOMProfiler::Bytes[phase];
+    c = vtkDICOMProfiler::Count[phase];
+    vtkDICOMProfilerLock.Unlock();
+    }
+
+  if (seconds) { *seconds = s; }
+  if (bytes) { *bytes = b; }
+  if (count) { *count = c; }
+}
+
+//----------------------------------------------------------------------------
+double vtkDICOMProfiler::StartPhase()
+{
+  return vtkTimerLog::GetUniversalTime();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMProfiler::EndPhase(
+  vtkObject *caller, int phase, double startTime, vtkTypeInt64 bytes)
+{
+  double t = vtkTimerLog::GetUniversalTime() - startTime;
+
+  vtkDICOMProfilerLock.Lock();
+  vtkDICOMProfiler::Seconds[phase] += t;
+  vtkDICOMProfiler::Bytes[phase] += bytes;
+  vtkDICOMProfiler::Count[phase]++;
+  vtkDICOMProfilerLock.Unlock();
+
+  if (caller)
+    {
+    PhaseReport report;
+    report.Phase = phase;
+    report.Seconds = t;
+    report.Bytes = bytes;
+    caller->InvokeEvent(vtkDICOMProfiler::ReportEvent, &report);
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  static const char *names[vtkDICOMProfiler::NumberOfPhases] = {
+    "DirectoryScan", "MetaDataRead", "PixelDataRead", "FileWrite"
+  };
+
+  os << indent << "Enabled: "
+     << (vtkDICOMProfiler::Enabled ? "On\n" : "Off\n");
+  for (int i = 0; i < vtkDICOMProfiler::NumberOfPhases; i++)
+    {
+    double seconds;
+    vtkTypeInt64 bytes;
+    vtkTypeInt64 count;
+    vtkDICOMProfiler::GetPhaseStatistics(i, &seconds, &bytes, &count);
+    os << indent << names[i] << ": " << seconds << " s, "
+       << bytes << " bytes, " << count << " calls\n";
+    }
+}
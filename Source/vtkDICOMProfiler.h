@@ -0,0 +1,118 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMProfiler_h
+#define vtkDICOMProfiler_h
+
+#include <vtkObject.h>
+#include <vtkCommand.h> // For UserEvent
+#include "vtkDICOMModule.h" // For export macro
+
+//! Opt-in timing instrumentation for the DICOM hot paths.
+/*!
+ *  When profiling is enabled, the classes that do the heavy lifting
+ *  (vtkDICOMParser, vtkDICOMReader, vtkDICOMCompiler, and
+ *  vtkDICOMDirectory) record how much time they spend and how many
+ *  bytes they move in each phase of their work.  The accumulated
+ *  totals can be read back with GetPhaseStatistics(), and each
+ *  completed phase is also announced with a ReportEvent on the object
+ *  that did the work, with a PhaseReport as the call data.  When
+ *  profiling is disabled, which is the default, the only cost at each
+ *  recording site is a single branch.
+ */
+class VTKDICOM_EXPORT vtkDICOMProfiler : public vtkObject
+{
+public:
+  //@{
+  //! VTK new method (for Java and Tcl wrappers)
+  static vtkDICOMProfiler *New();
+
+  //! VTK dynamic type information macro.
+  vtkTypeMacro(vtkDICOMProfiler, vtkObject);
+
+  //! Print a summary of the contents of this object.
+  void PrintSelf(ostream& os, vtkIndent indent);
+  //@}
+
+  //! The phases of the work that are instrumented.
+  enum EnumType
+  {
+    DirectoryScan  = 0, //!< vtkDICOMDirectory, Bytes counts files found
+    MetaDataRead   = 1, //!< vtkDICOMParser, Bytes counts bytes parsed
+    PixelDataRead  = 2, //!< vtkDICOMReader, Bytes counts bytes read
+    FileWrite      = 3, //!< vtkDICOMCompiler, Bytes counts bytes written
+    NumberOfPhases = 4
+  };
+
+  //! The event that is invoked when a phase completes.
+  /*!
+   *  The call data for the event is a pointer to a PhaseReport.
+   */
+  enum { ReportEvent = vtkCommand::UserEvent + 64 };
+
+  //! The information that accompanies a ReportEvent.
+  struct PhaseReport
+  {
+    int Phase;
+    double Seconds;
+    vtkTypeInt64 Bytes;
+  };
+
+  //@{
+  //! Enable or disable the collection of timing information.
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled() { return vtkDICOMProfiler::Enabled; }
+  //@}
+
+  //! Reset all of the accumulated totals to zero.
+  static void Reset();
+
+  //! Get the accumulated totals for one phase.
+  /*!
+   *  The totals are the time spent in the phase, the bytes moved (or,
+   *  for DirectoryScan, the files found), and the number of times the
+   *  phase ran.  They accumulate over all threads and all instances
+   *  of the instrumented classes until Reset() is called.
+   */
+  static void GetPhaseStatistics(
+    int phase, double *seconds, vtkTypeInt64 *bytes, vtkTypeInt64 *count);
+
+  //@{
+  //! Start timing a phase (only call this when profiling is enabled).
+  static double StartPhase();
+
+  //! Finish timing a phase and accumulate the totals.
+  /*!
+   *  If the caller is non-null, a ReportEvent is invoked on it.  Pass
+   *  a null caller from worker threads, because observers must only
+   *  run on the main thread.
+   */
+  static void EndPhase(
+    vtkObject *caller, int phase, double startTime, vtkTypeInt64 bytes);
+  //@}
+
+protected:
+  vtkDICOMProfiler() {}
+  ~vtkDICOMProfiler() {}
+
+  static bool Enabled;
+  static double Seconds[NumberOfPhases];
+  static vtkTypeInt64 Bytes[NumberOfPhases];
+  static vtkTypeInt64 Count[NumberOfPhases];
+
+private:
+  vtkDICOMProfiler(const vtkDICOMProfiler&);  // Not implemented.
+  void operator=(const vtkDICOMProfiler&);  // Not implemented.
+};
+
+#endif /* vtkDICOMProfiler_h */
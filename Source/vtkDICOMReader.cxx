@@ -13,9 +13,13 @@
 =========================================================================*/
 #include "vtkDICOMReader.h"
 #include "vtkDICOMAlgorithm.h"
+#include "vtkDICOMBundle.h"
 #include "vtkDICOMFile.h"
+#include "vtkDICOMFilePrefetcher.h"
+#include "vtkDICOMMemoryGovernor.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMParser.h"
+#include "vtkDICOMProfiler.h"
 #include "vtkDICOMDictionary.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
@@ -39,11 +43,14 @@
 #include "vtkStringArray.h"
 #include "vtkMath.h"
 #include "vtkVariant.h"
+#include "vtkCallbackCommand.h"
 #include "vtkCommand.h"
 #include "vtkErrorCode.h"
 #include "vtkSmartPointer.h"
 #include "vtkVersion.h"
 #include "vtkTypeTraits.h"
+#include "vtkMultiThreader.h"
+#include "vtkSimpleCriticalSection.h"
 
 #if defined(DICOM_USE_DCMTK)
 #ifndef _WIN32
@@ -63,6 +70,7 @@
 #endif
 
 #include <algorithm>
+#include <map>
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
@@ -76,11 +84,253 @@
 vtkStandardNewMacro(vtkDICOMReader);
 vtkCxxSetObjectMacro(vtkDICOMReader,Sorter,vtkDICOMSliceSorter);
 
+//----------------------------------------------------------------------------
+// A least-recently-used cache of decoded slices, so that slices can be
+// served from memory when an update requests them a second time.  Each
+// slice is keyed by its file index and frame index, and holds the final
+// output bytes, i.e. after any rescale, row flip, planar-to-packed, or
+// YBR-to-RGB conversion has been applied.  The cache remembers the
+// modified time of the reader and the size of a slice so that it can
+// be discarded whenever the reader or the geometry changes.  The cache
+// registers with the memory governor, which may ask it to release
+// slices (from any thread) when the library-wide budget is exceeded.
+class vtkDICOMReaderSliceCache
+{
+public:
+  vtkDICOMReaderSliceCache(vtkTypeUInt64 mtime, vtkIdType sliceSize) :
+    MTime(mtime), SliceSize(sliceSize), TotalSize(0), Head(0), Tail(0)
+    {
+    this->Governor = vtkDICOMMemoryGovernor::AddClient(
+      &vtkDICOMReaderSliceCache::Release, this);
+    }
+
+  ~vtkDICOMReaderSliceCache();
+
+  // check that the cached slices are still usable
+  bool IsValid(vtkTypeUInt64 mtime, vtkIdType sliceSize)
+    {
+    return (mtime == this->MTime && sliceSize == this->SliceSize);
+    }
+
+  // copy a slice out of the cache, returns false if it is not present
+  bool Fetch(int fileIdx, int frameIdx, unsigned char *ptr);
+
+  // copy a slice into the cache, evicting old slices to stay within
+  // the budget (given in bytes)
+  void Store(int fileIdx, int frameIdx, const unsigned char *ptr,
+             vtkIdType budget);
+
+private:
+  // the memory governor calls this (possibly from another thread)
+  // to ask the cache to release some of its memory
+  static void Release(void *data, vtkTypeInt64 bytes);
+  // each cached slice is a node in a doubly-linked list that is kept
+  // ordered from the most recently used to the least recently used
+  struct Entry
+  {
+    std::pair<int, int> Key;
+    unsigned char *Data;
+    Entry *Prev;
+    Entry *Next;
+  };
+
+  // unlink an entry and relink it at the head of the list
+  void MoveToHead(Entry *e);
+
+  // drop the least recently used slice, returns false if empty
+  bool EvictOne();
+
+  vtkTypeUInt64 MTime;
+  vtkIdType SliceSize;
+  vtkIdType TotalSize;
+  Entry *Head;
+  Entry *Tail;
+  std::map<std::pair<int, int>, Entry *> Table;
+  // the governor handle, and the lock that the release callback and
+  // the reader thread both take before touching the cache
+  void *Governor;
+  vtkSimpleCriticalSection Lock;
+};
+
+vtkDICOMReaderSliceCache::~vtkDICOMReaderSliceCache()
+{
+  // after this, no release callback can arrive
+  vtkDICOMMemoryGovernor::RemoveClient(this->Governor);
+
+  Entry *e = this->Head;
+  while (e)
+    {
+    Entry *next = e->Next;
+    delete [] e->Data;
+    delete e;
+    e = next;
+    }
+}
+
+void vtkDICOMReaderSliceCache::MoveToHead(Entry *e)
+{
+  if (e != this->Head)
+    {
+    e->Prev->Next = e->Next;
+    if (e->Next)
+      {
+      e->Next->Prev = e->Prev;
+      }
+    else
+      {
+      this->Tail = e->Prev;
+      }
+    e->Prev = 0;
+    e->Next = this->Head;
+    this->Head->Prev = e;
+    this->Head = e;
+    }
+}
+
+bool vtkDICOMReaderSliceCache::EvictOne()
+{
+  Entry *e = this->Tail;
+  if (e == 0)
+    {
+    return false;
+    }
+  this->Tail = e->Prev;
+  if (this->Tail)
+    {
+    this->Tail->Next = 0;
+    }
+  else
+    {
+    this->Head = 0;
+    }
+  this->Table.erase(e->Key);
+  this->TotalSize -= this->SliceSize;
+  delete [] e->Data;
+  delete e;
+  return true;
+}
+
+void vtkDICOMReaderSliceCache::Release(void *data, vtkTypeInt64 bytes)
+{
+  vtkDICOMReaderSliceCache *self =
+    static_cast<vtkDICOMReaderSliceCache *>(data);
+
+  vtkTypeInt64 freed = 0;
+  self->Lock.Lock();
+  while (freed < bytes && self->EvictOne())
+    {
+    freed += self->SliceSize;
+    }
+  self->Lock.Unlock();
+
+  if (freed > 0)
+    {
+    vtkDICOMMemoryGovernor::RecordFree(self->Governor, freed);
+    }
+}
+
+bool vtkDICOMReaderSliceCache::Fetch(
+  int fileIdx, int frameIdx, unsigned char *ptr)
+{
+  bool found = false;
+  this->Lock.Lock();
+  std::map<std::pair<int, int>, Entry *>::iterator iter =
+    this->Table.find(std::make_pair(fileIdx, frameIdx));
+  if (iter != this->Table.end())
+    {
+    Entry *e = iter->second;
+    memcpy(ptr, e->Data, this->SliceSize);
+    this->MoveToHead(e);
+    found = true;
+    }
+  this->Lock.Unlock();
+  return found;
+}
+
+void vtkDICOMReaderSliceCache::Store(
+  int fileIdx, int frameIdx, const unsigned char *ptr, vtkIdType budget)
+{
+  vtkTypeInt64 freed = 0;
+  bool stored = false;
+
+  this->Lock.Lock();
+  std::map<std::pair<int, int>, Entry *>::iterator iter =
+    this->Table.find(std::make_pair(fileIdx, frameIdx));
+  if (iter != this->Table.end())
+    {
+    Entry *e = iter->second;
+    memcpy(e->Data, ptr, this->SliceSize);
+    this->MoveToHead(e);
+    }
+  else if (this->SliceSize <= budget)
+    {
+    // evict the least recently used slices to make room
+    while (this->TotalSize + this->SliceSize > budget && this->EvictOne())
+      {
+      freed += this->SliceSize;
+      }
+
+    Entry *e = new Entry;
+    e->Key = std::make_pair(fileIdx, frameIdx);
+    e->Data = new unsigned char[this->SliceSize];
+    memcpy(e->Data, ptr, this->SliceSize);
+    e->Prev = 0;
+    e->Next = this->Head;
+    if (this->Head)
+      {
+      this->Head->Prev = e;
+      }
+    else
+      {
+      this->Tail = e;
+      }
+    this->Head = e;
+    this->Table.insert(std::make_pair(e->Key, e));
+    this->TotalSize += this->SliceSize;
+    stored = true;
+    }
+  this->Lock.Unlock();
+
+  // report to the governor with the cache unlocked, because the
+  // governor may respond by calling Release() on other caches
+  if (freed > 0)
+    {
+    vtkDICOMMemoryGovernor::RecordFree(this->Governor, freed);
+    }
+  if (stored)
+    {
+    vtkDICOMMemoryGovernor::RecordAllocation(this->Governor, this->SliceSize);
+    }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMReader::vtkDICOMReader()
 {
   this->AutoYBRToRGB = 1;
   this->NeedsYBRToRGB = 0;
+  this->ParallelDecoding = 0;
+  this->NumberOfDecodingThreads = 0;
+  this->NUMAFirstTouch = 0;
+  this->Prefetching = 0;
+  this->ProgressiveLoading = 0;
+  this->PrioritySlice = -1;
+  this->SliceCaching = 0;
+  this->SliceCacheSize = 256;
+  this->SliceCache = 0;
+  this->ComputeScalarRange = 0;
+  this->DecodedScalarRange[0] = 0.0;
+  this->DecodedScalarRange[1] = -1.0;
+  this->DecodedHistogram = vtkTypeInt64Array::New();
+  this->DecodedHistogramBinWidth = 1.0;
+  this->DecodedHistogramOrigin = 0.0;
+  this->OutputMemory = 0;
+  this->OutputMemorySize = 0;
+  this->OutputComponentOffset = 0;
+  this->OutputTotalComponents = 0;
+  this->FileBackedOutput = 0;
+  this->ScratchDirectory = 0;
+  this->HugePages = 0;
+  this->IOPriority = vtkDICOMFile::PriorityInteractive;
   this->AutoRescale = 1;
   this->NeedsRescale = 0;
   this->RescaleSlope = 1.0;
@@ -91,9 +341,17 @@ vtkDICOMReader::vtkDICOMReader()
   this->FrameIndexArray = vtkIntArray::New();
   this->StackIDs = vtkStringArray::New();
   this->FileOffsetArray = 0;
+  this->BundleIndex = 0;
+  this->PreParsedMetaData = 0;
+  this->PreParsedOffsets = 0;
   this->MetaData = vtkDICOMMetaData::New();
   this->PatientMatrix = vtkMatrix4x4::New();
   this->MemoryRowOrder = vtkDICOMReader::BottomUp;
+  this->DesiredResolution = 0;
+  this->ResolutionStride = 1;
+  this->Demosaic = 0;
+  this->MosaicSize = 0;
+  this->MosaicGrid = 1;
   this->NumberOfPackedComponents = 1;
   this->NumberOfPlanarComponents = 1;
   this->Sorting = 1;
@@ -114,6 +372,7 @@ vtkDICOMReader::vtkDICOMReader()
 #endif
 
   this->MedicalImageProperties = 0;
+  this->MedicalImagePropertiesUpToDate = false;
 
 #ifdef DICOM_USE_DCMTK
   DJDecoderRegistration::registerCodecs();
@@ -143,6 +402,18 @@ vtkDICOMReader::~vtkDICOMReader()
     {
     this->FileOffsetArray->Delete();
     }
+  if (this->BundleIndex)
+    {
+    this->BundleIndex->Delete();
+    }
+  if (this->PreParsedMetaData)
+    {
+    this->PreParsedMetaData->UnRegister(this);
+    }
+  if (this->PreParsedOffsets)
+    {
+    this->PreParsedOffsets->UnRegister(this);
+    }
   if (this->FileIndexArray)
     {
     this->FileIndexArray->Delete();
@@ -167,6 +438,12 @@ vtkDICOMReader::~vtkDICOMReader()
     {
     this->MedicalImageProperties->Delete();
     }
+  delete this->SliceCache;
+  if (this->DecodedHistogram)
+    {
+    this->DecodedHistogram->Delete();
+    }
+  delete [] this->ScratchDirectory;
 }
 
 //----------------------------------------------------------------------------
@@ -241,6 +518,125 @@ void vtkDICOMReader::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "MemoryRowOrder: "
      << this->GetMemoryRowOrderAsString() << "\n";
+
+  os << indent << "DesiredResolution: " << this->DesiredResolution << "\n";
+  os << indent << "ResolutionStride: " << this->ResolutionStride << "\n";
+
+  os << indent << "Demosaic: "
+     << (this->Demosaic ? "On\n" : "Off\n");
+  os << indent << "MosaicSize: " << this->MosaicSize << "\n";
+
+  os << indent << "ParallelDecoding: "
+     << (this->ParallelDecoding ? "On\n" : "Off\n");
+  os << indent << "NumberOfDecodingThreads: "
+     << this->NumberOfDecodingThreads << "\n";
+  os << indent << "NUMAFirstTouch: "
+     << (this->NUMAFirstTouch ? "On\n" : "Off\n");
+  os << indent << "Prefetching: "
+     << (this->Prefetching ? "On\n" : "Off\n");
+  os << indent << "ProgressiveLoading: "
+     << (this->ProgressiveLoading ? "On\n" : "Off\n");
+  os << indent << "PrioritySlice: " << this->PrioritySlice << "\n";
+  os << indent << "SliceCaching: "
+     << (this->SliceCaching ? "On\n" : "Off\n");
+  os << indent << "SliceCacheSize: " << this->SliceCacheSize << "\n";
+  os << indent << "ComputeScalarRange: "
+     << (this->ComputeScalarRange ? "On\n" : "Off\n");
+  os << indent << "OutputMemory: " << this->OutputMemory << "\n";
+  os << indent << "OutputMemorySize: " << this->OutputMemorySize << "\n";
+  os << indent << "OutputComponentOffset: "
+     << this->OutputComponentOffset << "\n";
+  os << indent << "OutputTotalComponents: "
+     << this->OutputTotalComponents << "\n";
+  os << indent << "FileBackedOutput: " << this->FileBackedOutput << "\n";
+  os << indent << "ScratchDirectory: "
+     << (this->ScratchDirectory ? this->ScratchDirectory : "(NULL)") << "\n";
+  os << indent << "HugePages: " << (this->HugePages ? "On\n" : "Off\n");
+  os << indent << "IOPriority: " << this->IOPriority << "\n";
+  os << indent << "PreParsedMetaData: " << this->PreParsedMetaData << "\n";
+  os << indent << "PreParsedOffsets: " << this->PreParsedOffsets << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetDesiredResolution(int resolution)
+{
+  if (resolution < 0)
+    {
+    resolution = 0;
+    }
+  if (this->DesiredResolution != resolution)
+    {
+    this->DesiredResolution = resolution;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputMemory(void *ptr, vtkIdType size)
+{
+  if (ptr == 0)
+    {
+    size = 0;
+    }
+  if (this->OutputMemory != ptr || this->OutputMemorySize != size)
+    {
+    this->OutputMemory = ptr;
+    this->OutputMemorySize = size;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputComponentInterleave(int offset, int total)
+{
+  if (offset < 0)
+    {
+    offset = 0;
+    }
+  if (total <= 0)
+    {
+    offset = 0;
+    total = 0;
+    }
+  if (this->OutputComponentOffset != offset ||
+      this->OutputTotalComponents != total)
+    {
+    this->OutputComponentOffset = offset;
+    this->OutputTotalComponents = total;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetPreParsedData(
+  vtkDICOMMetaData *meta, vtkTypeInt64Array *offsets)
+{
+  if (this->PreParsedMetaData != meta)
+    {
+    if (this->PreParsedMetaData)
+      {
+      this->PreParsedMetaData->UnRegister(this);
+      }
+    this->PreParsedMetaData = meta;
+    if (this->PreParsedMetaData)
+      {
+      this->PreParsedMetaData->Register(this);
+      }
+    this->Modified();
+    }
+  if (this->PreParsedOffsets != offsets)
+    {
+    if (this->PreParsedOffsets)
+      {
+      this->PreParsedOffsets->UnRegister(this);
+      }
+    this->PreParsedOffsets = offsets;
+    if (this->PreParsedOffsets)
+      {
+      this->PreParsedOffsets->Register(this);
+      }
+    this->Modified();
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -321,6 +717,12 @@ int vtkDICOMReader::CanReadFile(const char *filename)
 {
   vtkDebugMacro("Opening DICOM file " << filename);
 
+  // a series bundle can be read as if it were a single file
+  if (vtkDICOMBundle::TestHeader(filename))
+    {
+    return 1;
+    }
+
   vtkDICOMErrorSilencer *command = vtkDICOMErrorSilencer::New();
   vtkSmartPointer<vtkDICOMParser> parser =
     vtkSmartPointer<vtkDICOMParser>::New();
@@ -337,8 +739,140 @@ int vtkDICOMReader::CanReadFile(const char *filename)
 }
 
 //----------------------------------------------------------------------------
-namespace {
+// accumulate the minimum and maximum of n contiguous values into a
+// range whose initial state may be invalid (minimum above maximum)
+template<class T>
+void vtkDICOMReaderRangeOf(const T *ptr, size_t n, double range[2])
+{
+  if (n != 0)
+    {
+    T tmin = ptr[0];
+    T tmax = ptr[0];
+    for (size_t i = 1; i < n; i++)
+      {
+      T t = ptr[i];
+      tmin = (t < tmin ? t : tmin);
+      tmax = (t > tmax ? t : tmax);
+      }
+    if (range[0] > range[1])
+      {
+      range[0] = tmin;
+      range[1] = tmax;
+      }
+    else
+      {
+      range[0] = (tmin < range[0] ? tmin : range[0]);
+      range[1] = (tmax > range[1] ? tmax : range[1]);
+      }
+    }
+}
+
+// accumulate a histogram whose bins are (1 << shift) wide, starting
+// at origin; the caller sizes the histogram so that every possible
+// value of type T falls into a valid bin
+template<class T>
+void vtkDICOMReaderHistogramOf(
+  const T *ptr, size_t n, int shift, int origin, vtkTypeInt64 *histo)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+    histo[(static_cast<int>(ptr[i]) - origin) >> shift]++;
+    }
+}
+
+// accumulate range and histogram for values of the given scalar type,
+// the histogram pointer may be null and is only used for the 8-bit
+// and 16-bit integer types
+void vtkDICOMReaderAccumulate(
+  const void *ptr, size_t n, int scalarType, double range[2],
+  int shift, int origin, vtkTypeInt64 *histo)
+{
+  switch (scalarType)
+    {
+    case VTK_SIGNED_CHAR:
+    case VTK_CHAR:
+      vtkDICOMReaderRangeOf(static_cast<const signed char *>(ptr),
+                            n, range);
+      if (histo)
+        {
+        vtkDICOMReaderHistogramOf(static_cast<const signed char *>(ptr),
+                                  n, shift, origin, histo);
+        }
+      break;
+    case VTK_UNSIGNED_CHAR:
+      vtkDICOMReaderRangeOf(static_cast<const unsigned char *>(ptr),
+                            n, range);
+      if (histo)
+        {
+        vtkDICOMReaderHistogramOf(static_cast<const unsigned char *>(ptr),
+                                  n, shift, origin, histo);
+        }
+      break;
+    case VTK_SHORT:
+      vtkDICOMReaderRangeOf(static_cast<const short *>(ptr), n, range);
+      if (histo)
+        {
+        vtkDICOMReaderHistogramOf(static_cast<const short *>(ptr),
+                                  n, shift, origin, histo);
+        }
+      break;
+    case VTK_UNSIGNED_SHORT:
+      vtkDICOMReaderRangeOf(static_cast<const unsigned short *>(ptr),
+                            n, range);
+      if (histo)
+        {
+        vtkDICOMReaderHistogramOf(static_cast<const unsigned short *>(ptr),
+                                  n, shift, origin, histo);
+        }
+      break;
+    case VTK_INT:
+      vtkDICOMReaderRangeOf(static_cast<const int *>(ptr), n, range);
+      break;
+    case VTK_UNSIGNED_INT:
+      vtkDICOMReaderRangeOf(static_cast<const unsigned int *>(ptr),
+                            n, range);
+      break;
+    case VTK_FLOAT:
+      vtkDICOMReaderRangeOf(static_cast<const float *>(ptr), n, range);
+      break;
+    case VTK_DOUBLE:
+      vtkDICOMReaderRangeOf(static_cast<const double *>(ptr), n, range);
+      break;
+    }
+}
 
+// choose the histogram layout for a scalar type: 256 bins of width
+// one for 8-bit data, 4096 bins of width 16 for 16-bit data, and no
+// histogram for any other type
+int vtkDICOMReaderHistogramBins(int scalarType, int *shift, int *origin)
+{
+  int bins = 0;
+  *shift = 0;
+  *origin = 0;
+  switch (scalarType)
+    {
+    case VTK_SIGNED_CHAR:
+    case VTK_CHAR:
+      bins = 256;
+      *origin = -128;
+      break;
+    case VTK_UNSIGNED_CHAR:
+      bins = 256;
+      break;
+    case VTK_SHORT:
+      bins = 4096;
+      *shift = 4;
+      *origin = -32768;
+      break;
+    case VTK_UNSIGNED_SHORT:
+      bins = 4096;
+      *shift = 4;
+      break;
+    }
+  return bins;
+}
+
+//----------------------------------------------------------------------------
 // a simple struct to provide info for each frame to be read
 struct vtkDICOMReaderFrameInfo
 {
@@ -350,17 +884,167 @@ struct vtkDICOMReaderFrameInfo
     FrameIndex(i), SliceIndex(j), ComponentIndex(k) {}
 };
 
+// a record of the scratch-file mapping that backs an output array
+struct vtkDICOMReaderScratchInfo
+{
+  void *Pointer;
+  vtkIdType Size;
+};
+
+// called when a file-backed output array is deleted, in order to
+// release the mapping (which also reclaims the scratch file)
+static void vtkDICOMReaderScratchDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  vtkDICOMReaderScratchInfo *sinfo =
+    static_cast<vtkDICOMReaderScratchInfo *>(clientData);
+  vtkDICOMFile::UnmapScratchFile(sinfo->Pointer, sinfo->Size);
+  delete sinfo;
+}
+
+// called when a large-page output array is deleted, in order to
+// return the memory to the operating system
+static void vtkDICOMReaderLargePagesDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  vtkDICOMReaderScratchInfo *sinfo =
+    static_cast<vtkDICOMReaderScratchInfo *>(clientData);
+  vtkDICOMFile::UnmapLargePages(sinfo->Pointer, sinfo->Size);
+  delete sinfo;
+}
+
 // a simple struct to provide info for each file to be read
 struct vtkDICOMReaderFileInfo
 {
   int FileIndex;
   int FramesInFile; // total frames in file
+  std::string FileName;
   std::vector<vtkDICOMReaderFrameInfo> Frames; // the frames to read
+  double Range[2]; // the range of the decoded values
+  std::vector<vtkTypeInt64> Histogram; // histogram of the values
 
-  vtkDICOMReaderFileInfo(int i, int n) : FileIndex(i), FramesInFile(n) {}
+  vtkDICOMReaderFileInfo(int i, int n) : FileIndex(i), FramesInFile(n) {
+    this->Range[0] = 0.0; this->Range[1] = -1.0; }
 };
 
-} // end anonymous namespace
+// a description of the update extent, shared by all decoding threads
+struct vtkDICOMReaderUpdateInfo
+{
+  vtkDICOMReader *Reader;
+  std::vector<vtkDICOMReaderFileInfo> *Files;
+  unsigned char *DataPtr;
+  int Extent[6];
+  vtkIdType PixelSize;
+  vtkIdType SliceSize;
+  vtkIdType FilePixelSize;
+  vtkIdType FileRowSize;
+  vtkIdType FilePlaneSize;
+  vtkIdType FileFrameSize;
+  int NumPlanes;
+  int NeedsYBR;
+  bool FlipImage;
+  bool PlanarToPacked;
+  bool Parallel;
+  bool FirstTouch;
+  bool ComputeRange;
+  int ScalarType;
+  int ScalarSize;
+  int HistogramBins;
+  int HistogramShift;
+  int HistogramOrigin;
+  // per-thread counts of completed files: each thread writes only its
+  // own slot, and the slots are a cache line apart so that the counts
+  // can be updated and sampled without any locking
+  vtkIdType FilesDone[VTK_MAX_THREADS][8];
+};
+
+// this friendship class allows the decoding threads to use exactly
+// one protected method of vtkDICOMReader
+class vtkDICOMReaderUpdateFriendship
+{
+public:
+  static bool ReadOneFile(vtkDICOMReader *reader,
+    vtkDICOMReaderFileInfo *file, vtkDICOMReaderUpdateInfo *info)
+    {
+    return reader->ReadOneFileForUpdate(file, info);
+    }
+};
+
+// the method that is executed by each of the decoding threads,
+// the files are dealt out to the threads round-robin
+static VTK_THREAD_RETURN_TYPE vtkDICOMReaderThreadUpdate(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMReaderUpdateInfo *info =
+    static_cast<vtkDICOMReaderUpdateInfo *>(ti->UserData);
+  vtkDICOMReader *reader = info->Reader;
+  std::vector<vtkDICOMReaderFileInfo>& files = *info->Files;
+  size_t n = files.size();
+
+  vtkIdType count = 0;
+  int lastPercent = -1;
+
+  // by default the files are dealt out round-robin, but with
+  // first-touch placement each thread takes a contiguous slab so
+  // that it owns a contiguous range of the output volume
+  size_t start = ti->ThreadID;
+  size_t end = n;
+  size_t step = ti->NumberOfThreads;
+  if (info->FirstTouch)
+    {
+    start = (n*ti->ThreadID)/ti->NumberOfThreads;
+    end = (n*(ti->ThreadID + 1))/ti->NumberOfThreads;
+    step = 1;
+
+    // write to every page of this thread's own output range before
+    // decoding begins, so that on systems with first-touch page
+    // placement the pages land on this thread's own NUMA node
+    const size_t pageSize = 4096;
+    for (size_t idx = start; idx < end; idx++)
+      {
+      std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
+      for (size_t f = 0; f < frames.size(); f++)
+        {
+        unsigned char *dp = info->DataPtr +
+          (frames[f].SliceIndex - info->Extent[4])*info->SliceSize;
+        unsigned char *dpEnd = dp + info->SliceSize;
+        for (; dp < dpEnd; dp += pageSize)
+          {
+          *dp = 0;
+          }
+        }
+      }
+    }
+
+  for (size_t idx = start; idx < end; idx += step)
+    {
+    if (reader->GetAbortExecute()) { break; }
+
+    vtkDICOMReaderUpdateFriendship::ReadOneFile(reader, &files[idx], info);
+
+    info->FilesDone[ti->ThreadID][0] = ++count;
+
+    // only the first thread reports progress, and only when the
+    // total progress has advanced by at least one percent
+    if (ti->ThreadID == 0)
+      {
+      vtkIdType done = 0;
+      for (int tid = 0; tid < ti->NumberOfThreads; tid++)
+        {
+        done += info->FilesDone[tid][0];
+        }
+      int percent = static_cast<int>((done*100)/n);
+      if (percent != lastPercent)
+        {
+        lastPercent = percent;
+        reader->UpdateProgress(0.01*percent);
+        }
+      }
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
 
 //----------------------------------------------------------------------------
 void vtkDICOMReader::SortFiles(vtkIntArray *files, vtkIntArray *frames)
@@ -542,6 +1226,33 @@ int vtkDICOMReader::RequestInformation(
   // Clear the error indicator.
   this->SetErrorCode(vtkErrorCode::NoError);
 
+  // Check whether the named file is a series bundle, which holds the
+  // data sets of a whole series behind a byte-range index, so that the
+  // series can be loaded with a single file open.
+  if (this->BundleIndex)
+    {
+    this->BundleIndex->Delete();
+    this->BundleIndex = 0;
+    }
+  if (this->FileNames == 0 && this->FileName &&
+      vtkDICOMBundle::TestHeader(this->FileName))
+    {
+    vtkDICOMBundle *bundle = vtkDICOMBundle::New();
+    bundle->SetFileName(this->FileName);
+    bool indexRead = bundle->ReadIndex();
+    if (indexRead)
+      {
+      this->BundleIndex = bundle->GetIndex();
+      this->BundleIndex->Register(this);
+      }
+    bundle->Delete();
+    if (!indexRead)
+      {
+      this->SetErrorCode(vtkErrorCode::FileFormatError);
+      return false;
+      }
+    }
+
   // How many files are to be loaded?
   if (this->FileNames)
     {
@@ -549,6 +1260,13 @@ int vtkDICOMReader::RequestInformation(
     this->DataExtent[4] = 0;
     this->DataExtent[5] = static_cast<int>(numFileNames - 1);
     }
+  else if (this->BundleIndex)
+    {
+    // every data set in the bundle counts as one file
+    this->DataExtent[4] = 0;
+    this->DataExtent[5] = static_cast<int>(
+      this->BundleIndex->GetNumberOfTuples() - 1);
+    }
   else if (this->FileName)
     {
     this->DataExtent[4] = 0;
@@ -594,6 +1312,7 @@ int vtkDICOMReader::RequestInformation(
   // Parser reads just the meta data, not the pixel data.
   this->Parser = vtkDICOMParser::New();
   this->Parser->SetMetaData(this->MetaData);
+  this->Parser->SetIOPriority(this->IOPriority);
   this->Parser->AddObserver(
     vtkCommand::ErrorEvent, this, &vtkDICOMReader::RelayError);
 
@@ -602,10 +1321,32 @@ int vtkDICOMReader::RequestInformation(
   this->FileOffsetArray->SetNumberOfComponents(2);
   this->FileOffsetArray->SetNumberOfTuples(numFiles);
 
-  for (int idx = 0; idx < numFiles; idx++)
+  // If metadata that was already parsed from these files was supplied
+  // with SetPreParsedData(), and it covers every file, then use it
+  // instead of parsing the file headers all over again.
+  bool preParsed = (this->BundleIndex == 0 &&
+                    this->PreParsedMetaData != 0 &&
+                    this->PreParsedOffsets != 0 &&
+                    this->PreParsedMetaData->GetNumberOfInstances() ==
+                      numFiles &&
+                    this->PreParsedOffsets->GetNumberOfComponents() == 2 &&
+                    this->PreParsedOffsets->GetNumberOfTuples() == numFiles);
+
+  if (preParsed)
+    {
+    this->MetaData->DeepCopy(this->PreParsedMetaData);
+    this->FileOffsetArray->DeepCopy(this->PreParsedOffsets);
+    }
+
+  for (int idx = 0; idx < numFiles && !preParsed; idx++)
     {
     this->ComputeInternalFileName(this->DataExtent[4] + idx);
     this->Parser->SetFileName(this->InternalFileName);
+    if (this->BundleIndex)
+      {
+      // skip ahead to where this data set starts within the bundle
+      this->Parser->SetStartOffset(this->BundleIndex->GetValue(2*idx));
+      }
     this->Parser->SetIndex(idx);
     this->Parser->Update();
 
@@ -618,6 +1359,15 @@ int vtkDICOMReader::RequestInformation(
     vtkTypeInt64 offset[2];
     offset[0] = this->Parser->GetFileOffset();
     offset[1] = this->Parser->GetFileSize();
+    if (this->BundleIndex)
+      {
+      // make the offsets absolute within the bundle file, with the
+      // second component marking the end of this data set
+      vtkTypeInt64 range[2];
+      this->BundleIndex->GetTupleValue(idx, range);
+      offset[0] += range[0];
+      offset[1] = range[0] + range[1];
+      }
     this->FileOffsetArray->SetTupleValue(idx, offset);
     }
 
@@ -647,15 +1397,100 @@ int vtkDICOMReader::RequestInformation(
     return false;
     }
 
-  // Set the indexing arrays for the meta data
-  this->MetaData->SetFileIndexArray(this->FileIndexArray);
-  this->MetaData->SetFrameIndexArray(this->FrameIndexArray);
-
-  // Get the file and frame for the first slice
-  int fileIndex = this->FileIndexArray->GetComponent(0, 0);
-  int frameIndex = this->FrameIndexArray->GetComponent(0, 0);
-
-  // image dimensions
+  // Detect Siemens mosaic files, which pack a rectangular grid of
+  // slices into each stored image (see the Demosaic option).  Each
+  // tile of the grid is presented as if it were a frame of the file,
+  // so that it gets its own slice of the output.
+  this->MosaicSize = 0;
+  this->MosaicGrid = 1;
+  if (this->Demosaic && this->DesiredResolution <= 0 &&
+      this->FileIndexArray->GetNumberOfComponents() == 1)
+    {
+    int mFile = this->FileIndexArray->GetComponent(0, 0);
+    vtkDICOMTag mtag(0xFFFF, 0xFFFF);
+    int numTiles = 0;
+    std::string imageType = this->MetaData->GetAttributeValue(
+      mFile, DC::ImageType).AsString();
+    if (imageType.find("MOSAIC") != std::string::npos)
+      {
+      // the tile count is stored in the Siemens private attributes
+      mtag = this->MetaData->ResolvePrivateTag(
+        vtkDICOMTag(0x0019, 0x000A), "SIEMENS MR HEADER");
+      if (mtag == vtkDICOMTag(0xFFFF, 0xFFFF))
+        {
+        mtag = this->MetaData->ResolvePrivateTag(
+          vtkDICOMTag(0x0021, 0x0001), "SIEMENS MR SDI 02");
+        }
+      if (mtag != vtkDICOMTag(0xFFFF, 0xFFFF))
+        {
+        numTiles = this->MetaData->GetAttributeValue(mFile, mtag).AsInt();
+        }
+      }
+    if (numTiles > 1 &&
+        this->MetaData->GetAttributeValue(
+          mFile, DC::NumberOfFrames).AsInt() <= 1 &&
+        this->MetaData->GetAttributeValue(
+          mFile, DC::SamplesPerPixel).AsInt() <= 1)
+      {
+      // the tiles are packed into the smallest square grid that holds
+      // them, the unused cells at the end of the grid are blank
+      int grid = 1;
+      while (grid*grid < numTiles)
+        {
+        grid++;
+        }
+      int mCols = this->MetaData->GetAttributeValue(
+        mFile, DC::Columns).AsInt();
+      int mRows = this->MetaData->GetAttributeValue(
+        mFile, DC::Rows).AsInt();
+      // every file of the series must be the same kind of mosaic
+      bool uniform = (mCols % grid == 0 && mRows % grid == 0);
+      vtkIdType numVolumes = this->FileIndexArray->GetNumberOfTuples();
+      for (vtkIdType v = 1; v < numVolumes && uniform; v++)
+        {
+        int vFile = this->FileIndexArray->GetComponent(v, 0);
+        uniform = (this->MetaData->GetAttributeValue(
+                     vFile, mtag).AsInt() == numTiles);
+        }
+      if (uniform)
+        {
+        this->MosaicSize = numTiles;
+        this->MosaicGrid = grid;
+        // expand the index arrays so that each tile gets a slice,
+        // with the tiles of each mosaic kept contiguous so that a
+        // time series becomes a sequence of complete volumes
+        vtkIntArray *tileFiles = vtkIntArray::New();
+        vtkIntArray *tileFrames = vtkIntArray::New();
+        tileFiles->SetNumberOfValues(numVolumes*numTiles);
+        tileFrames->SetNumberOfValues(numVolumes*numTiles);
+        vtkIdType tIdx = 0;
+        for (vtkIdType v = 0; v < numVolumes; v++)
+          {
+          int vFile = this->FileIndexArray->GetComponent(v, 0);
+          for (int t = 0; t < numTiles; t++)
+            {
+            tileFiles->SetValue(tIdx, vFile);
+            tileFrames->SetValue(tIdx, t);
+            tIdx++;
+            }
+          }
+        this->FileIndexArray->DeepCopy(tileFiles);
+        this->FrameIndexArray->DeepCopy(tileFrames);
+        tileFiles->Delete();
+        tileFrames->Delete();
+        }
+      }
+    }
+
+  // Set the indexing arrays for the meta data
+  this->MetaData->SetFileIndexArray(this->FileIndexArray);
+  this->MetaData->SetFrameIndexArray(this->FrameIndexArray);
+
+  // Get the file and frame for the first slice
+  int fileIndex = this->FileIndexArray->GetComponent(0, 0);
+  int frameIndex = this->FrameIndexArray->GetComponent(0, 0);
+
+  // image dimensions
   int columns = this->MetaData->GetAttributeValue(
     fileIndex, DC::Columns).AsInt();
   int rows = this->MetaData->GetAttributeValue(
@@ -663,6 +1498,28 @@ int vtkDICOMReader::RequestInformation(
   int slices = static_cast<int>(
     this->FileIndexArray->GetNumberOfTuples());
 
+  // each tile of a mosaic becomes its own slice
+  if (this->MosaicSize > 1)
+    {
+    columns /= this->MosaicGrid;
+    rows /= this->MosaicGrid;
+    }
+
+  // when a preview was requested, choose the smallest integer stride
+  // that brings the image within the desired resolution
+  this->ResolutionStride = 1;
+  if (this->DesiredResolution > 0)
+    {
+    int dim = (columns > rows ? columns : rows);
+    if (dim > this->DesiredResolution)
+      {
+      this->ResolutionStride =
+        (dim + this->DesiredResolution - 1)/this->DesiredResolution;
+      }
+    columns = (columns + this->ResolutionStride - 1)/this->ResolutionStride;
+    rows = (rows + this->ResolutionStride - 1)/this->ResolutionStride;
+    }
+
   int extent[6];
   extent[0] = 0;
   extent[1] = columns - 1;
@@ -732,6 +1589,31 @@ int vtkDICOMReader::RequestInformation(
       }
     }
 
+  // a decimated preview has proportionately larger pixels
+  if (this->ResolutionStride > 1)
+    {
+    this->DataSpacing[0] *= this->ResolutionStride;
+    this->DataSpacing[1] *= this->ResolutionStride;
+    }
+
+  // the positions of mosaic files give the spacing between the
+  // volumes of a time series, not the spacing between slices, so
+  // the stated slice spacing is used instead
+  if (this->MosaicSize > 1)
+    {
+    double zspacing = this->MetaData->GetAttributeValue(
+      fileIndex, frameIndex, DC::SpacingBetweenSlices).AsDouble();
+    if (zspacing <= 0)
+      {
+      zspacing = this->MetaData->GetAttributeValue(
+        fileIndex, frameIndex, DC::SliceThickness).AsDouble();
+      }
+    if (zspacing > 0)
+      {
+      this->DataSpacing[2] = zspacing;
+      }
+    }
+
   // offset is part of the transform, so set origin to zero
   this->DataOrigin[0] = 0.0;
   this->DataOrigin[1] = 0.0;
@@ -907,6 +1789,19 @@ int vtkDICOMReader::RequestInformation(
       vtkMath::Normalize(&orient[0]);
       vtkMath::Normalize(&orient[3]);
 
+      if (this->MosaicSize > 1)
+        {
+        // the stored position of a mosaic is for the full mosaic
+        // canvas, but the slice is tile-sized and centered within
+        // the canvas, so shift to the corner of the centered tile
+        double cx = 0.5*columns*(this->MosaicGrid - 1)*this->DataSpacing[0];
+        double cy = 0.5*rows*(this->MosaicGrid - 1)*this->DataSpacing[1];
+        for (int ii = 0; ii < 3; ii++)
+          {
+          point[ii] += orient[ii]*cx + orient[3+ii]*cy;
+          }
+        }
+
       if (this->MemoryRowOrder == vtkDICOMReader::BottomUp)
         {
         // calculate position of point at lower left
@@ -996,11 +1891,10 @@ int vtkDICOMReader::RequestInformation(
     this->PatientMatrix->Identity();
     }
 
-  // Set the medical image properties
-  if (this->MedicalImageProperties)
-    {
-    this->UpdateMedicalImageProperties();
-    }
+  // The medical image properties are rebuilt on the next request,
+  // since most pipelines never ask for them and the string
+  // formatting that they require is not cheap
+  this->MedicalImagePropertiesUpToDate = false;
 
   // Set the output information.
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
@@ -1023,29 +1917,122 @@ int vtkDICOMReader::RequestInformation(
 namespace {
 
 //----------------------------------------------------------------------------
-// this rescales a series of data values
+// byte-swap a single data value
+inline unsigned char vtkDICOMReaderSwap(unsigned char u)
+{
+  return u;
+}
+
+inline unsigned short vtkDICOMReaderSwap(unsigned short u)
+{
+  return static_cast<unsigned short>((u << 8) | (u >> 8));
+}
+
+inline unsigned int vtkDICOMReaderSwap(unsigned int u)
+{
+  return ((u << 24) | ((u << 8) & 0xff0000u) |
+          ((u >> 8) & 0xff00u) | (u >> 24));
+}
+
+//----------------------------------------------------------------------------
+// check whether the slope and intercept are integers that map every
+// possible value of type T onto a value that is representable as a T,
+// in which case the rescale can be done with pure integer arithmetic
+// and no clamping
+template<class T>
+bool vtkDICOMReaderRescaleIsExact(double m, double b, int *mi, int *bi)
+{
+  double minval = vtkTypeTraits<T>::Min();
+  double maxval = vtkTypeTraits<T>::Max();
+  *mi = 0;
+  *bi = 0;
+  if (sizeof(T) <= 2 &&
+      minval*m + b >= minval && minval*m + b <= maxval &&
+      maxval*m + b >= minval && maxval*m + b <= maxval)
+    {
+    *mi = static_cast<int>(m);
+    *bi = static_cast<int>(b);
+    return (*mi == m && *bi == b);
+    }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// this rescales a series of data values, the loops are indexed and
+// branch-free so that the compiler is able to vectorize them
 template<class T>
 void vtkDICOMReaderRescaleBuffer(T *p, double m, double b, size_t bytecount)
 {
   size_t n = bytecount/sizeof(T);
   if (n > 0 && (m != 1.0 || b != 0.0))
     {
-    double minval = vtkTypeTraits<T>::Min();
-    double maxval = vtkTypeTraits<T>::Max();
-    do
+    int mi, bi;
+    if (vtkDICOMReaderRescaleIsExact<T>(m, b, &mi, &bi))
       {
-      double val = (*p)*m + b;
-      if (val < minval)
+      for (size_t i = 0; i < n; i++)
         {
-        val = minval;
+        p[i] = static_cast<T>(p[i]*mi + bi);
         }
-      if (val > maxval)
+      }
+    else
+      {
+      double minval = vtkTypeTraits<T>::Min();
+      double maxval = vtkTypeTraits<T>::Max();
+      for (size_t i = 0; i < n; i++)
         {
-        val = maxval;
+        double val = p[i]*m + b;
+        val = (val > minval ? val : minval);
+        val = (val < maxval ? val : maxval);
+        // round half away from zero, like vtkMath::Round
+        val += (val >= 0 ? 0.5 : -0.5);
+        p[i] = static_cast<T>(val);
         }
-      *p++ = static_cast<T>(vtkMath::Round(val));
       }
-    while (--n);
+    }
+}
+
+//----------------------------------------------------------------------------
+// byte-swap the data values and rescale them in a single pass, this is
+// used in place of vtkByteSwap so that data with the opposite endianness
+// does not have to be swept over twice, U is the unsigned type that is
+// the same size as T
+template<class T, class U>
+void vtkDICOMReaderSwapRescaleBuffer(
+  T *p, double m, double b, size_t bytecount)
+{
+  U *u = reinterpret_cast<U *>(p);
+  size_t n = bytecount/sizeof(T);
+  if (m == 1.0 && b == 0.0)
+    {
+    for (size_t i = 0; i < n; i++)
+      {
+      u[i] = vtkDICOMReaderSwap(u[i]);
+      }
+    return;
+    }
+
+  int mi, bi;
+  if (vtkDICOMReaderRescaleIsExact<T>(m, b, &mi, &bi))
+    {
+    for (size_t i = 0; i < n; i++)
+      {
+      T v = static_cast<T>(vtkDICOMReaderSwap(u[i]));
+      p[i] = static_cast<T>(v*mi + bi);
+      }
+    }
+  else
+    {
+    double minval = vtkTypeTraits<T>::Min();
+    double maxval = vtkTypeTraits<T>::Max();
+    for (size_t i = 0; i < n; i++)
+      {
+      T v = static_cast<T>(vtkDICOMReaderSwap(u[i]));
+      double val = v*m + b;
+      val = (val > minval ? val : minval);
+      val = (val < maxval ? val : maxval);
+      val += (val >= 0 ? 0.5 : -0.5);
+      p[i] = static_cast<T>(val);
+      }
     }
 }
 
@@ -1054,6 +2041,14 @@ void vtkDICOMReaderRescaleBuffer(T *p, double m, double b, size_t bytecount)
 //----------------------------------------------------------------------------
 void vtkDICOMReader::RescaleBuffer(
   int fileIdx, int frameIdx, void *buffer, vtkIdType bufferSize)
+{
+  this->RescaleBuffer(fileIdx, frameIdx, buffer, bufferSize, false);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::RescaleBuffer(
+  int fileIdx, int frameIdx, void *buffer, vtkIdType bufferSize,
+  bool swapBytes)
 {
   vtkDICOMMetaData *meta = this->MetaData;
   double m = meta->GetAttributeValue(
@@ -1074,6 +2069,7 @@ void vtkDICOMReader::RescaleBuffer(
 
   if (bitsAllocated <= 8)
     {
+    // swapping individual bytes is a no-op
     if (pixelRep == 0)
       {
       vtkDICOMReaderRescaleBuffer(
@@ -1089,26 +2085,58 @@ void vtkDICOMReader::RescaleBuffer(
     {
     if (pixelRep == 0)
       {
-      vtkDICOMReaderRescaleBuffer(
-        static_cast<unsigned short *>(buffer), m, b, bufferSize);
+      if (swapBytes)
+        {
+        vtkDICOMReaderSwapRescaleBuffer<unsigned short, unsigned short>(
+          static_cast<unsigned short *>(buffer), m, b, bufferSize);
+        }
+      else
+        {
+        vtkDICOMReaderRescaleBuffer(
+          static_cast<unsigned short *>(buffer), m, b, bufferSize);
+        }
       }
     else
       {
-      vtkDICOMReaderRescaleBuffer(
-        static_cast<short *>(buffer), m, b, bufferSize);
+      if (swapBytes)
+        {
+        vtkDICOMReaderSwapRescaleBuffer<short, unsigned short>(
+          static_cast<short *>(buffer), m, b, bufferSize);
+        }
+      else
+        {
+        vtkDICOMReaderRescaleBuffer(
+          static_cast<short *>(buffer), m, b, bufferSize);
+        }
       }
     }
   else if (bitsAllocated <= 32)
     {
     if (pixelRep == 0)
       {
-      vtkDICOMReaderRescaleBuffer(
-        static_cast<unsigned int *>(buffer), m, b, bufferSize);
+      if (swapBytes)
+        {
+        vtkDICOMReaderSwapRescaleBuffer<unsigned int, unsigned int>(
+          static_cast<unsigned int *>(buffer), m, b, bufferSize);
+        }
+      else
+        {
+        vtkDICOMReaderRescaleBuffer(
+          static_cast<unsigned int *>(buffer), m, b, bufferSize);
+        }
       }
     else
       {
-      vtkDICOMReaderRescaleBuffer(
-        static_cast<int *>(buffer), m, b, bufferSize);
+      if (swapBytes)
+        {
+        vtkDICOMReaderSwapRescaleBuffer<int, unsigned int>(
+          static_cast<int *>(buffer), m, b, bufferSize);
+        }
+      else
+        {
+        vtkDICOMReaderRescaleBuffer(
+          static_cast<int *>(buffer), m, b, bufferSize);
+        }
       }
     }
 }
@@ -1168,28 +2196,43 @@ void vtkDICOMReader::YBRToRGB(
 
   if (bufferSize >= 3)
     {
+    // convert the matrix to 16.16 fixed point, so that the loop uses
+    // only integer arithmetic with a branch-free body that compilers
+    // can vectorize (the coefficients are exact to within 2**-16, so
+    // the output can differ from exact conversion by at most one level)
+    int c[3][3];
+    for (int i = 0; i < 3; i++)
+      {
+      for (int j = 0; j < 3; j++)
+        {
+        c[i][j] = vtkMath::Floor(matrix[i][j]*65536.0 + 0.5);
+        }
+      }
+    int iymin = static_cast<int>(ymin);
+    const int half = 32768; // for round-to-nearest before the shift
+
     unsigned char *cp = static_cast<unsigned char *>(buffer);
     vtkIdType n = bufferSize/3;
-    double ybr[3];
-    double rgb[3];
     do
       {
-      ybr[0] = cp[0] - ymin;
-      ybr[1] = cp[1] - 128.0;
-      ybr[2] = cp[2] - 128.0;
+      int y = cp[0] - iymin;
+      int pb = cp[1] - 128;
+      int pr = cp[2] - 128;
 
-      vtkMath::Multiply3x3(matrix, ybr, rgb);
+      int r = (c[0][0]*y + c[0][1]*pb + c[0][2]*pr + half) >> 16;
+      int g = (c[1][0]*y + c[1][1]*pb + c[1][2]*pr + half) >> 16;
+      int b = (c[2][0]*y + c[2][1]*pb + c[2][2]*pr + half) >> 16;
 
-      rgb[0] = (rgb[0] >= 0.0 ? rgb[0] : 0.0);
-      rgb[0] = (rgb[0] <= 255.0 ? rgb[0] : 255.0);
-      rgb[1] = (rgb[1] >= 0.0 ? rgb[1] : 0.0);
-      rgb[1] = (rgb[1] <= 255.0 ? rgb[1] : 255.0);
-      rgb[2] = (rgb[2] >= 0.0 ? rgb[2] : 0.0);
-      rgb[2] = (rgb[2] <= 255.0 ? rgb[2] : 255.0);
+      r = (r > 0 ? r : 0);
+      r = (r < 255 ? r : 255);
+      g = (g > 0 ? g : 0);
+      g = (g < 255 ? g : 255);
+      b = (b > 0 ? b : 0);
+      b = (b < 255 ? b : 255);
 
-      cp[0] = static_cast<unsigned char>(vtkMath::Floor(rgb[0] + 0.5));
-      cp[1] = static_cast<unsigned char>(vtkMath::Floor(rgb[1] + 0.5));
-      cp[2] = static_cast<unsigned char>(vtkMath::Floor(rgb[2] + 0.5));
+      cp[0] = static_cast<unsigned char>(r);
+      cp[1] = static_cast<unsigned char>(g);
+      cp[2] = static_cast<unsigned char>(b);
 
       cp += 3;
       }
@@ -1207,24 +2250,32 @@ void vtkDICOMReader::UnpackBits(
       static_cast<const unsigned char *>(filePtr);
     unsigned char *writePtr =
       static_cast<unsigned char *>(buffer);
-    for (vtkIdType n = bufferSize/2; n > 0; n -= 2)
+    vtkIdType n = bufferSize/2;
+    // unpack the values two-at-a-time (three bytes to four bytes),
+    // with a branch-free loop body that compilers can vectorize
+    for (vtkIdType m = n/2; m > 0; m--)
       {
       unsigned int a1 = readPtr[0];
       unsigned int a2 = readPtr[1];
+      unsigned int a3 = readPtr[2];
       unsigned int b1 = (a1 << 4) | (a2 & 0x0f);
+      unsigned int b2 = ((a3 & 0x0f) << 8) | (a2 & 0xf0) | (a3 >> 4);
       writePtr[0] = static_cast<unsigned char>(b1);
       writePtr[1] = static_cast<unsigned char>(b1 >> 8);
-
-      if (n == 1) { break; }
-
-      unsigned int a3 = readPtr[2];
-      unsigned int b2 = ((a3 & 0x0f) << 8) | (a2 & 0xf0) | (a3 >> 4);
       writePtr[2] = static_cast<unsigned char>(b2);
       writePtr[3] = static_cast<unsigned char>(b2 >> 8);
-
       readPtr += 3;
       writePtr += 4;
       }
+    if ((n & 1) != 0)
+      {
+      // unpack the final unpaired value
+      unsigned int a1 = readPtr[0];
+      unsigned int a2 = readPtr[1];
+      unsigned int b1 = (a1 << 4) | (a2 & 0x0f);
+      writePtr[0] = static_cast<unsigned char>(b1);
+      writePtr[1] = static_cast<unsigned char>(b1 >> 8);
+      }
     }
   else if (bits == 1)
     {
@@ -1232,14 +2283,25 @@ void vtkDICOMReader::UnpackBits(
       static_cast<const unsigned char *>(filePtr);
     unsigned char *writePtr =
       static_cast<unsigned char *>(buffer);
+    // expand each bit into a byte, eight bits at a time: broadcast
+    // the byte across a 64-bit word, isolate one bit per lane with a
+    // mask, and normalize each lane to zero or one (the mask is
+    // chosen so that the store puts bit zero in the first byte on
+    // either byte order)
+#ifdef VTK_WORDS_BIGENDIAN
+    const vtkTypeUInt64 lanes = 0x0102040810204080ull;
+#else
+    const vtkTypeUInt64 lanes = 0x8040201008040201ull;
+#endif
     for (vtkIdType n = bufferSize/8; n > 0; n--)
       {
-      unsigned int a = *readPtr;
-      for (int i = 0; i < 8; i++)
-        {
-        writePtr[i] = (a & 1);
-        a >>= 1;
-        }
+      vtkTypeUInt64 a = *readPtr;
+      a *= 0x0101010101010101ull;
+      a &= lanes;
+      a += 0x7f7f7f7f7f7f7f7full;
+      a &= 0x8080808080808080ull;
+      a >>= 7;
+      memcpy(writePtr, &a, 8);
       readPtr++;
       writePtr += 8;
       }
@@ -1256,6 +2318,165 @@ void vtkDICOMReader::UnpackBits(
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMReader::UnpackBits(
+  const void *filePtr, void *buffer, int bits,
+  vtkIdType first, vtkIdType count, vtkIdType stride)
+{
+  const unsigned char *readPtr =
+    static_cast<const unsigned char *>(filePtr);
+  unsigned char *writePtr =
+    static_cast<unsigned char *>(buffer);
+
+  if (bits == 12)
+    {
+    // unpack every stride'th 12-bit value, indexing directly into the
+    // packed data so the bytes in between are never touched
+    for (vtkIdType i = 0; i < count; i++)
+      {
+      vtkIdType k = first + i*stride;
+      const unsigned char *cp = readPtr + 3*(k >> 1);
+      unsigned int b;
+      if ((k & 1) == 0)
+        {
+        b = (cp[0] << 4) | (cp[1] & 0x0f);
+        }
+      else
+        {
+        b = ((cp[2] & 0x0f) << 8) | (cp[1] & 0xf0) | (cp[2] >> 4);
+        }
+      writePtr[0] = static_cast<unsigned char>(b);
+      writePtr[1] = static_cast<unsigned char>(b >> 8);
+      writePtr += 2;
+      }
+    }
+  else if (bits == 1)
+    {
+    for (vtkIdType i = 0; i < count; i++)
+      {
+      vtkIdType k = first + i*stride;
+      *writePtr++ = ((readPtr[k >> 3] >> (k & 7)) & 1);
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+// Copy every stride'th pixel of a row into a contiguous output row.
+// As for the repack above, the kernels are instantiated per element
+// type and pixel shape and selected once per file, with the elements
+// copied as the widest type that evenly divides the pixel size.
+typedef void (*vtkDICOMReaderDecimateFunction)(
+  unsigned char *outPtr, const unsigned char *inPtr,
+  vtkIdType n, vtkIdType k, int stride);
+
+// the kernel for pixels that are a single element
+template<class T>
+void vtkDICOMReaderDecimate1T(
+  unsigned char *outPtr, const unsigned char *inPtr,
+  vtkIdType n, vtkIdType, int stride)
+{
+  T *op = reinterpret_cast<T *>(outPtr);
+  const T *ip = reinterpret_cast<const T *>(inPtr);
+  do
+    {
+    *op++ = *ip;
+    ip += stride;
+    }
+  while (--n);
+}
+
+// the kernel for pixels that are k elements
+template<class T>
+void vtkDICOMReaderDecimateNT(
+  unsigned char *outPtr, const unsigned char *inPtr,
+  vtkIdType n, vtkIdType k, int stride)
+{
+  T *op = reinterpret_cast<T *>(outPtr);
+  const T *ip = reinterpret_cast<const T *>(inPtr);
+  vtkIdType is = k*stride;
+  do
+    {
+    for (vtkIdType j = 0; j < k; j++) { op[j] = ip[j]; }
+    op += k;
+    ip += is;
+    }
+  while (--n);
+}
+
+// Select the decimation kernel for a file, and return the number of
+// elements per pixel through the second argument.
+vtkDICOMReaderDecimateFunction vtkDICOMReaderGetDecimateFunction(
+  vtkIdType pixelSize, vtkIdType *elementCount)
+{
+  static const vtkDICOMReaderDecimateFunction kernels[3][2] = {
+    { &vtkDICOMReaderDecimate1T<unsigned char>,
+      &vtkDICOMReaderDecimateNT<unsigned char> },
+    { &vtkDICOMReaderDecimate1T<unsigned short>,
+      &vtkDICOMReaderDecimateNT<unsigned short> },
+    { &vtkDICOMReaderDecimate1T<unsigned int>,
+      &vtkDICOMReaderDecimateNT<unsigned int> },
+  };
+
+  int width = 0;
+  vtkIdType k = pixelSize;
+  if ((pixelSize & 3) == 0)
+    {
+    width = 2;
+    k = pixelSize/4;
+    }
+  else if ((pixelSize & 1) == 0)
+    {
+    width = 1;
+    k = pixelSize/2;
+    }
+  *elementCount = k;
+  return kernels[width][k != 1];
+}
+
+//----------------------------------------------------------------------------
+// Decimate a full-resolution frame (or one plane of a frame) into a
+// contiguous reduced-resolution frame.
+void vtkDICOMReaderDecimateFrame(
+  unsigned char *outPtr, const unsigned char *inPtr,
+  int inCols, int inRows, vtkIdType pixelSize, int stride)
+{
+  int outCols = (inCols + stride - 1)/stride;
+  int outRows = (inRows + stride - 1)/stride;
+  vtkIdType inRowSize = inCols*pixelSize;
+  if (outCols <= 0)
+    {
+    return;
+    }
+  vtkIdType k;
+  vtkDICOMReaderDecimateFunction decimate =
+    vtkDICOMReaderGetDecimateFunction(pixelSize, &k);
+  for (int r = 0; r < outRows; r++)
+    {
+    decimate(outPtr, inPtr + r*stride*inRowSize, outCols, k, stride);
+    outPtr += outCols*pixelSize;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Read a block from a file in chunks, polling the abort flag between
+// the chunks so that an abandoned read stops within a bounded time
+// instead of completing one monolithic multi-gigabyte read call.
+size_t vtkDICOMReaderChunkedRead(
+  vtkDICOMFile *infile, unsigned char *buffer, size_t size,
+  const int *abortFlag)
+{
+  size_t total = 0;
+  while (total < size && !(abortFlag && *abortFlag))
+    {
+    size_t chunk = size - total;
+    chunk = (chunk > 2097152 ? 2097152 : chunk); // 2 MiB chunks
+    size_t n = infile->Read(buffer + total, chunk);
+    total += n;
+    if (n < chunk) { break; }
+    }
+  return total;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMReader::ReadFileNative(
   const char *filename, int fileIdx,
@@ -1267,7 +2488,9 @@ bool vtkDICOMReader::ReadFileNative(
   vtkTypeInt64 offset = offsetAndSize[0];
 
   vtkDebugMacro("Opening DICOM file " << filename);
-  vtkDICOMFile infile(filename, vtkDICOMFile::In);
+  // the pixel data is read front-to-back, so hint sequential access
+  vtkDICOMFile infile(filename, vtkDICOMFile::In, vtkDICOMFile::Sequential);
+  infile.SetPriority(this->IOPriority);
 
   if (infile.GetError())
     {
@@ -1296,12 +2519,18 @@ bool vtkDICOMReader::ReadFileNative(
   int bitsAllocated = this->MetaData->GetAttributeValue(
     fileIdx, DC::BitsAllocated).AsInt();
 
+  // for reduced-resolution previews, only every stride'th row and
+  // column of the file is kept (see SetDesiredResolution)
+  int stride = this->ResolutionStride;
+
   size_t readSize = bufferSize;
   size_t resultSize = 0;
-  if (transferSyntax == "1.2.840.10008.1.2.5")
+  vtkDICOMImageCodec codec(transferSyntax);
+  // let an abort cancel a multi-frame decode between frames
+  codec.SetAbortFlag(&this->AbortExecute);
+  if (transferSyntax == "1.2.840.10008.1.2.5" ||
+      vtkDICOMImageCodec::GetDecoder(codec.GetKey()) != 0)
     {
-    vtkDICOMImageCodec codec(transferSyntax);
-
     unsigned int numFrames = this->MetaData->GetAttributeValue(
       fileIdx, DC::NumberOfFrames).AsUnsignedInt();
     numFrames = (numFrames == 0 ? 1 : numFrames);
@@ -1315,12 +2544,16 @@ bool vtkDICOMReader::ReadFileNative(
       }
     unsigned char *rleBuffer = new unsigned char[readSize];
     unsigned char *filePtr = rleBuffer;
-    resultSize = infile.Read(filePtr, readSize);
+    resultSize = vtkDICOMReaderChunkedRead(
+      &infile, filePtr, readSize, &this->AbortExecute);
     size_t bytesRemaining = resultSize;
-    vtkIdType bufferPos = 0;
     vtkIdType frameSize = bufferSize/numFrames;
     bool isOffsetTable = true;
-    while (bytesRemaining >= 8 && bufferPos < bufferSize)
+    // collect the fragments, so that they can be decoded concurrently
+    std::vector<const unsigned char *> fragments;
+    std::vector<size_t> fragmentSizes;
+    while (bytesRemaining >= 8 &&
+           fragments.size() < static_cast<size_t>(numFrames))
       {
       // get the item header
       unsigned int tagkey = vtkDICOMUtilities::UnpackUnsignedInt(filePtr);
@@ -1341,47 +2574,204 @@ bool vtkDICOMReader::ReadFileNative(
       // first item is the offset table
       if (!isOffsetTable)
         {
-        // unpack an RLE fragment
-        codec.Decode(this->MetaData,
-          filePtr, length, buffer + bufferPos, frameSize);
-        bufferPos += frameSize;
+        fragments.push_back(filePtr);
+        fragmentSizes.push_back(length);
         }
       filePtr += length;
       bytesRemaining -= length;
       isOffsetTable = false;
       }
+    if (!fragments.empty() && stride > 1)
+      {
+      // reduced-resolution preview of the compressed frames
+      vtkDICOMImageCodec::ImageFormat image(this->MetaData);
+      int samples = (image.SamplesPerPixel == 0 ? 1 :
+                     image.SamplesPerPixel);
+      int planes = (image.PlanarConfiguration ? samples : 1);
+      vtkIdType pixelBytes = (image.BitsAllocated + 7)/8;
+      pixelBytes *= (image.PlanarConfiguration ? 1 : samples);
+      int fullCols = image.Columns;
+      int fullRows = image.Rows;
+      int outCols = (fullCols + stride - 1)/stride;
+      int outRows = (fullRows + stride - 1)/stride;
+      vtkIdType inPlaneSize =
+        static_cast<vtkIdType>(fullCols)*fullRows*pixelBytes;
+      vtkIdType outPlaneSize =
+        static_cast<vtkIdType>(outCols)*outRows*pixelBytes;
+      vtkDICOMImageCodec::ReducedDecodeFunction reduced =
+        vtkDICOMImageCodec::GetReducedDecoder(codec.GetKey());
+      if (reduced)
+        {
+        // the codec can decode at reduced resolution directly
+        unsigned char *outPtr = buffer;
+        for (size_t f = 0; f < fragments.size(); f++)
+          {
+          if (this->AbortExecute) { break; }
+          reduced(image, fragments[f], fragmentSizes[f],
+                  outPtr, frameSize, stride);
+          outPtr += frameSize;
+          }
+        }
+      else
+        {
+        // decode each frame at full resolution, then decimate it
+        unsigned char *fullFrame = new unsigned char[inPlaneSize*planes];
+        unsigned char *outPtr = buffer;
+        for (size_t f = 0; f < fragments.size(); f++)
+          {
+          if (this->AbortExecute) { break; }
+          codec.Decode(image, fragments[f], fragmentSizes[f],
+                       fullFrame, inPlaneSize*planes);
+          for (int p = 0; p < planes; p++)
+            {
+            vtkDICOMReaderDecimateFrame(
+              outPtr + p*outPlaneSize, fullFrame + p*inPlaneSize,
+              fullCols, fullRows, pixelBytes, stride);
+            }
+          outPtr += frameSize;
+          }
+        delete [] fullFrame;
+        }
+      }
+    else if (!fragments.empty())
+      {
+      // decompress the fragments, one fragment per frame
+      codec.DecodeFragments(this->MetaData,
+        &fragments[0], &fragmentSizes[0], fragments.size(),
+        buffer, frameSize);
+      }
     delete [] rleBuffer;
     }
-  else if (bitsAllocated == 12)
-    {
-    // unpack 12 bits little endian into 16 bits little endian,
-    // the result will have to be swapped if machine is BE (the
-    // swapping is done at the end of this function)
-    readSize = bufferSize/2 + (bufferSize+3)/4;
-    unsigned char *filePtr = buffer + (bufferSize - readSize);
-    resultSize = infile.Read(filePtr, readSize);
-
-    vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
-    }
-  else if (bitsAllocated == 1)
+  else if (bitsAllocated == 12 || bitsAllocated == 1)
     {
-    // unpack 1 bit into 8 bits, source assumed to be either OB
-    // or little endian OW, never big endian OW
-    readSize = (bufferSize + 7)/8;
-    unsigned char *filePtr = buffer + (bufferSize - readSize);
-    resultSize = infile.Read(filePtr, readSize);
+    // unpack 12 bits little endian into 16 bits little endian (the
+    // result will have to be swapped if machine is BE, the swapping
+    // is done at the end of this function), or 1 bit into 8 bits
+    // (source assumed to be either OB or little endian OW, never
+    // big endian OW)
+    if (stride > 1)
+      {
+      // the packed rows are not byte aligned, so all of the packed
+      // bytes are read, but only the kept pixels are unpacked
+      int fullCols = this->MetaData->GetAttributeValue(
+        fileIdx, DC::Columns).AsInt();
+      int fullRows = this->MetaData->GetAttributeValue(
+        fileIdx, DC::Rows).AsInt();
+      unsigned int numFrames = this->MetaData->GetAttributeValue(
+        fileIdx, DC::NumberOfFrames).AsUnsignedInt();
+      numFrames = (numFrames == 0 ? 1 : numFrames);
+      int outCols = (fullCols + stride - 1)/stride;
+      int outRows = (fullRows + stride - 1)/stride;
+      vtkIdType framePixels = static_cast<vtkIdType>(fullCols)*fullRows;
+      if (bitsAllocated == 12)
+        {
+        vtkIdType fullSize = 2*framePixels*numFrames;
+        readSize = fullSize/2 + (fullSize+3)/4;
+        }
+      else
+        {
+        readSize = (framePixels*numFrames + 7)/8;
+        }
+      unsigned char *packedBuffer = new unsigned char[readSize];
+      resultSize = vtkDICOMReaderChunkedRead(
+        &infile, packedBuffer, readSize, &this->AbortExecute);
+      unsigned char *writePtr = buffer;
+      for (unsigned int f = 0; f < numFrames && !this->AbortExecute; f++)
+        {
+        for (int r = 0; r < outRows; r++)
+          {
+          vtkIdType first = f*framePixels +
+            static_cast<vtkIdType>(r)*stride*fullCols;
+          this->UnpackBits(packedBuffer, writePtr, bitsAllocated,
+                           first, outCols, stride);
+          writePtr += (bitsAllocated == 12 ? 2*outCols : outCols);
+          }
+        }
+      delete [] packedBuffer;
+      }
+    else
+      {
+      if (bitsAllocated == 12)
+        {
+        readSize = bufferSize/2 + (bufferSize+3)/4;
+        }
+      else
+        {
+        readSize = (bufferSize + 7)/8;
+        }
+      unsigned char *filePtr = buffer + (bufferSize - readSize);
+      resultSize = vtkDICOMReaderChunkedRead(
+        &infile, filePtr, readSize, &this->AbortExecute);
 
-    vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
-    }
-  else
-    {
-    resultSize = infile.Read(buffer, readSize);
+      vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize,
+                                 bitsAllocated);
+      }
     }
-
-  bool success = true;
-  if (infile.EndOfFile() || resultSize != readSize)
+  else if (stride > 1)
     {
-    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+    // read only the rows that the preview keeps, seeking over the
+    // rows in between, then keep every stride'th pixel of each row
+    int fullCols = this->MetaData->GetAttributeValue(
+      fileIdx, DC::Columns).AsInt();
+    int fullRows = this->MetaData->GetAttributeValue(
+      fileIdx, DC::Rows).AsInt();
+    unsigned int numFrames = this->MetaData->GetAttributeValue(
+      fileIdx, DC::NumberOfFrames).AsUnsignedInt();
+    numFrames = (numFrames == 0 ? 1 : numFrames);
+    int samples = this->MetaData->GetAttributeValue(
+      fileIdx, DC::SamplesPerPixel).AsInt();
+    samples = (samples <= 0 ? 1 : samples);
+    int planar = this->MetaData->GetAttributeValue(
+      fileIdx, DC::PlanarConfiguration).AsInt();
+    int planes = (planar ? samples : 1);
+    vtkIdType pixelBytes = (bitsAllocated + 7)/8;
+    pixelBytes *= (planar ? 1 : samples);
+    int outCols = (fullCols + stride - 1)/stride;
+    int outRows = (fullRows + stride - 1)/stride;
+    vtkIdType inRowSize = fullCols*pixelBytes;
+    vtkIdType totalPlanes = static_cast<vtkIdType>(numFrames)*planes;
+    readSize = static_cast<size_t>(totalPlanes)*outRows*inRowSize;
+    resultSize = 0;
+    unsigned char *rowBuffer = new unsigned char[inRowSize];
+    unsigned char *writePtr = buffer;
+    vtkTypeInt64 planeOffset = offset;
+    vtkTypeInt64 inPlaneSize =
+      static_cast<vtkTypeInt64>(fullRows)*inRowSize;
+    vtkIdType elemCount;
+    vtkDICOMReaderDecimateFunction decimate =
+      vtkDICOMReaderGetDecimateFunction(pixelBytes, &elemCount);
+    totalPlanes = (outCols > 0 ? totalPlanes : 0);
+    for (vtkIdType p = 0; p < totalPlanes && !this->AbortExecute; p++)
+      {
+      for (int r = 0; r < outRows; r++)
+        {
+        if (!infile.SetPosition(planeOffset + r*stride*inRowSize))
+          {
+          break;
+          }
+        resultSize += infile.Read(rowBuffer, inRowSize);
+        decimate(writePtr, rowBuffer, outCols, elemCount, stride);
+        writePtr += outCols*pixelBytes;
+        }
+      planeOffset += inPlaneSize;
+      }
+    delete [] rowBuffer;
+    }
+  else
+    {
+    resultSize = vtkDICOMReaderChunkedRead(
+      &infile, buffer, readSize, &this->AbortExecute);
+    }
+
+  bool success = true;
+  if (this->AbortExecute)
+    {
+    // the load was abandoned, give up quietly
+    success = false;
+    }
+  else if (infile.EndOfFile() || resultSize != readSize)
+    {
+    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
     vtkErrorMacro("DICOM file is truncated, " <<
       (readSize - resultSize) << " bytes are missing.");
     success = false;
@@ -1394,8 +2784,128 @@ bool vtkDICOMReader::ReadFileNative(
     }
   else if (fileBigEndian != memoryBigEndian)
     {
-    int scalarSize = vtkDataArray::GetDataTypeSize(this->DataScalarType);
-    vtkByteSwap::SwapVoidRange(buffer, bufferSize/scalarSize, scalarSize);
+    if (this->NeedsRescale &&
+        this->MetaData->GetAttributeValue(fileIdx, DC::PixelData).IsValid())
+      {
+      // fuse the rescale into the byte-swapping pass, rather than
+      // sweeping over the buffer a second time afterwards
+      unsigned int numFrames = this->MetaData->GetAttributeValue(
+        fileIdx, DC::NumberOfFrames).AsUnsignedInt();
+      numFrames = (numFrames == 0 ? 1 : numFrames);
+      vtkIdType frameSize = bufferSize/numFrames;
+      for (unsigned int f = 0; f < numFrames; f++)
+        {
+        this->RescaleBuffer(fileIdx, static_cast<int>(f),
+                            buffer + f*frameSize, frameSize, true);
+        }
+      }
+    else
+      {
+      int scalarSize = vtkDataArray::GetDataTypeSize(this->DataScalarType);
+      vtkByteSwap::SwapVoidRange(buffer, bufferSize/scalarSize, scalarSize);
+      }
+    }
+
+  infile.Close();
+  return success;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::ReadFrameListNative(
+  const char *filename, int fileIdx, unsigned char *buffer,
+  const int *frameList, int listLength, vtkIdType frameSize)
+{
+  // get the offset to the PixelData in the file
+  vtkTypeInt64 offsetAndSize[2];
+  this->FileOffsetArray->GetTupleValue(fileIdx, offsetAndSize);
+  vtkTypeInt64 offset = offsetAndSize[0];
+
+  vtkDebugMacro("Opening DICOM file " << filename);
+  // the frames are read front-to-back, so hint sequential access
+  vtkDICOMFile infile(filename, vtkDICOMFile::In, vtkDICOMFile::Sequential);
+  infile.SetPriority(this->IOPriority);
+
+  if (infile.GetError())
+    {
+    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    vtkErrorMacro("ReadFrameList: Can't read the file " << filename);
+    return false;
+    }
+
+  // read each contiguous run of listed frames with a single read
+  // call, seeking over the frames that are not in the list
+  bool success = true;
+  int i = 0;
+  while (i < listLength && success)
+    {
+    int j = i + 1;
+    while (j < listLength && frameList[j] == frameList[j-1] + 1)
+      {
+      j++;
+      }
+
+    if (!infile.SetPosition(offset + frameList[i]*frameSize))
+      {
+      this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+      vtkErrorMacro("DICOM file is truncated, some data is missing.");
+      success = false;
+      break;
+      }
+
+    size_t readSize = (j - i)*frameSize;
+    size_t resultSize = vtkDICOMReaderChunkedRead(
+      &infile, buffer + i*frameSize, readSize, &this->AbortExecute);
+
+    if (this->AbortExecute)
+      {
+      // the load was abandoned, give up quietly
+      success = false;
+      break;
+      }
+    if (infile.EndOfFile() || resultSize != readSize)
+      {
+      this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+      vtkErrorMacro("DICOM file is truncated, " <<
+        (readSize - resultSize) << " bytes are missing.");
+      success = false;
+      }
+    else if (infile.GetError())
+      {
+      this->SetErrorCode(vtkErrorCode::FileFormatError);
+      vtkErrorMacro("Error in DICOM file, cannot read.");
+      success = false;
+      }
+
+    i = j;
+    }
+
+  std::string transferSyntax = this->MetaData->GetAttributeValue(
+    fileIdx, DC::TransferSyntaxUID).AsString();
+
+  // this will set endiancheck.s to 1 on big endian architectures
+  union { char c[2]; short s; } endianCheck = { { 0, 1 } };
+  bool memoryBigEndian = (endianCheck.s == 1);
+  bool fileBigEndian = (transferSyntax == "1.2.840.10008.1.2.2" ||
+                        transferSyntax == "1.2.840.113619.5.2");
+
+  if (success && fileBigEndian != memoryBigEndian)
+    {
+    if (this->NeedsRescale &&
+        this->MetaData->GetAttributeValue(fileIdx, DC::PixelData).IsValid())
+      {
+      // fuse the rescale into the byte-swapping pass
+      for (int f = 0; f < listLength; f++)
+        {
+        this->RescaleBuffer(fileIdx, frameList[f],
+                            buffer + f*frameSize, frameSize, true);
+        }
+      }
+    else
+      {
+      int scalarSize = vtkDataArray::GetDataTypeSize(this->DataScalarType);
+      vtkByteSwap::SwapVoidRange(
+        buffer, listLength*frameSize/scalarSize, scalarSize);
+      }
     }
 
   infile.Close();
@@ -1516,9 +3026,473 @@ bool vtkDICOMReader::ReadOneFile(
     return this->ReadFileNative(filename, fileIdx, buffer, bufferSize);
     }
 
+  // syntaxes with a decoder registered at run time are also read natively,
+  // so that the frames are decompressed directly into the output buffer
+  vtkDICOMImageCodec codec(transferSyntax);
+  if (vtkDICOMImageCodec::GetDecoder(codec.GetKey()) != 0)
+    {
+    return this->ReadFileNative(filename, fileIdx, buffer, bufferSize);
+    }
+
+  if (this->ResolutionStride > 1)
+    {
+    // the delegates can only decode whole frames, so for a preview
+    // the file is decoded at full resolution and then decimated
+    int stride = this->ResolutionStride;
+    int fullCols = this->MetaData->GetAttributeValue(
+      fileIdx, DC::Columns).AsInt();
+    int fullRows = this->MetaData->GetAttributeValue(
+      fileIdx, DC::Rows).AsInt();
+    unsigned int numFrames = this->MetaData->GetAttributeValue(
+      fileIdx, DC::NumberOfFrames).AsUnsignedInt();
+    numFrames = (numFrames == 0 ? 1 : numFrames);
+    int samples = this->MetaData->GetAttributeValue(
+      fileIdx, DC::SamplesPerPixel).AsInt();
+    samples = (samples <= 0 ? 1 : samples);
+    int planar = this->MetaData->GetAttributeValue(
+      fileIdx, DC::PlanarConfiguration).AsInt();
+    int planes = (planar ? samples : 1);
+    int bitsAllocated = this->MetaData->GetAttributeValue(
+      fileIdx, DC::BitsAllocated).AsInt();
+    // the delegates unpack 12 bits to 16 and 1 bit to 8
+    vtkIdType pixelBytes = (bitsAllocated + 7)/8;
+    pixelBytes *= (planar ? 1 : samples);
+    int outCols = (fullCols + stride - 1)/stride;
+    int outRows = (fullRows + stride - 1)/stride;
+    vtkIdType inPlaneSize =
+      static_cast<vtkIdType>(fullCols)*fullRows*pixelBytes;
+    vtkIdType outPlaneSize =
+      static_cast<vtkIdType>(outCols)*outRows*pixelBytes;
+    vtkIdType totalPlanes = static_cast<vtkIdType>(numFrames)*planes;
+    unsigned char *fullBuffer =
+      new unsigned char[inPlaneSize*totalPlanes];
+    bool rval = this->ReadFileDelegated(
+      filename, fileIdx, fullBuffer, inPlaneSize*totalPlanes);
+    if (rval)
+      {
+      for (vtkIdType p = 0; p < totalPlanes; p++)
+        {
+        vtkDICOMReaderDecimateFrame(
+          buffer + p*outPlaneSize, fullBuffer + p*inPlaneSize,
+          fullCols, fullRows, pixelBytes, stride);
+        }
+      }
+    delete [] fullBuffer;
+    return rval;
+    }
+
   return this->ReadFileDelegated(filename, fileIdx, buffer, bufferSize);
 }
 
+//----------------------------------------------------------------------------
+// Repack a run of pixels from a contiguous color plane into strided
+// vector components in the output.  The kernels below are instantiated
+// for every combination of element type and pixel shape, and the right
+// kernel is selected once per file, so that the per-pixel loop bodies
+// contain no conditionals.  The element type is the widest type that
+// evenly divides the file pixel size, because the output stride is
+// usually too irregular for the compiler to generate anything better
+// than an element-at-a-time loop.
+typedef void (*vtkDICOMReaderRepackFunction)(
+  unsigned char *outPtr, vtkIdType outStride,
+  const unsigned char *inPtr, vtkIdType n, vtkIdType k);
+
+// the kernel for pixels that are a single element
+template<class T>
+void vtkDICOMReaderRepack1T(
+  unsigned char *outPtr, vtkIdType outStride,
+  const unsigned char *inPtr, vtkIdType n, vtkIdType)
+{
+  T *op = reinterpret_cast<T *>(outPtr);
+  const T *ip = reinterpret_cast<const T *>(inPtr);
+  vtkIdType os = outStride/static_cast<vtkIdType>(sizeof(T));
+  do { *op = *ip++; op += os; } while (--n);
+}
+
+// the kernel for pixels that are k elements
+template<class T>
+void vtkDICOMReaderRepackNT(
+  unsigned char *outPtr, vtkIdType outStride,
+  const unsigned char *inPtr, vtkIdType n, vtkIdType k)
+{
+  T *op = reinterpret_cast<T *>(outPtr);
+  const T *ip = reinterpret_cast<const T *>(inPtr);
+  vtkIdType os = outStride/static_cast<vtkIdType>(sizeof(T));
+  do
+    {
+    for (vtkIdType j = 0; j < k; j++) { op[j] = ip[j]; }
+    ip += k;
+    op += os;
+    }
+  while (--n);
+}
+
+// Select the repack kernel for a file, and return the number of
+// elements per pixel through the second argument.  All offsets into
+// the buffers are multiples of the file pixel size, so only the size
+// has to be checked to guarantee aligned access.
+vtkDICOMReaderRepackFunction vtkDICOMReaderGetRepackFunction(
+  vtkIdType filePixelSize, vtkIdType *elementCount)
+{
+  static const vtkDICOMReaderRepackFunction kernels[3][2] = {
+    { &vtkDICOMReaderRepack1T<unsigned char>,
+      &vtkDICOMReaderRepackNT<unsigned char> },
+    { &vtkDICOMReaderRepack1T<unsigned short>,
+      &vtkDICOMReaderRepackNT<unsigned short> },
+    { &vtkDICOMReaderRepack1T<unsigned int>,
+      &vtkDICOMReaderRepackNT<unsigned int> },
+  };
+
+  int width = 0;
+  vtkIdType k = filePixelSize;
+  if ((filePixelSize & 3) == 0)
+    {
+    width = 2;
+    k = filePixelSize/4;
+    }
+  else if ((filePixelSize & 1) == 0)
+    {
+    width = 1;
+    k = filePixelSize/2;
+    }
+  *elementCount = k;
+  return kernels[width][k != 1];
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::ReadOneFileForUpdate(
+  vtkDICOMReaderFileInfo *fileInfo, vtkDICOMReaderUpdateInfo *info)
+{
+  int fileIdx = fileInfo->FileIndex;
+  int framesInFile = fileInfo->FramesInFile;
+  std::vector<vtkDICOMReaderFrameInfo>& frames = fileInfo->Frames;
+  int numFrames = static_cast<int>(frames.size());
+  const int *extent = info->Extent;
+
+  // Siemens mosaic files pack a grid of tiles into one stored image,
+  // and the index arrays present each tile as a frame of the file
+  bool mosaic = (this->MosaicSize > 1);
+
+  // we need a file buffer if input frames don't match output slices
+  bool needBuffer = (info->PlanarToPacked || mosaic ||
+                     numFrames != framesInFile);
+  for (int sIdx = 0; sIdx < numFrames && !needBuffer; sIdx++)
+    {
+    needBuffer = (sIdx != frames[sIdx].FrameIndex);
+    }
+
+  // when only some of the frames in a multi-frame file are needed,
+  // seek to those frames instead of realizing the whole PixelData,
+  // this is only possible if the frames are uncompressed and aligned
+  // on byte boundaries within the file (and if no reduced-resolution
+  // preview was requested, since ReadFrameListNative computes its
+  // offsets from the full-resolution frame size)
+  int readFrames = framesInFile;
+  std::vector<int> frameList;
+  if (needBuffer && !mosaic && numFrames < framesInFile &&
+      this->ResolutionStride == 1)
+    {
+    std::string transferSyntax = this->MetaData->GetAttributeValue(
+      fileIdx, DC::TransferSyntaxUID).AsString();
+    int bitsAllocated = this->MetaData->GetAttributeValue(
+      fileIdx, DC::BitsAllocated).AsInt();
+    if ((transferSyntax == "1.2.840.10008.1.2"   ||
+         transferSyntax == "1.2.840.10008.1.20"  ||
+         transferSyntax == "1.2.840.10008.1.2.1" ||
+         transferSyntax == "1.2.840.10008.1.2.2" ||
+         transferSyntax == "1.2.840.113619.5.2"  ||
+         transferSyntax == "") &&
+        (bitsAllocated == 8 || bitsAllocated == 16 || bitsAllocated == 32))
+      {
+      // read only the frames that map to the output: when a stack is
+      // selected with DesiredStackID, the frames of the other stacks
+      // are never sought, read, or decoded, even if the stacks are
+      // interleaved frame-by-frame within the file
+      frameList.reserve(numFrames);
+      for (int sIdx = 0; sIdx < numFrames; sIdx++)
+        {
+        frameList.push_back(frames[sIdx].FrameIndex);
+        }
+      std::sort(frameList.begin(), frameList.end());
+      frameList.erase(
+        std::unique(frameList.begin(), frameList.end()), frameList.end());
+      readFrames = static_cast<int>(frameList.size());
+      }
+    }
+
+  // map each frame index to its slot in the read buffer
+  std::vector<int> frameSlot;
+  if (!frameList.empty())
+    {
+    frameSlot.resize(framesInFile, 0);
+    for (int f = 0; f < readFrames; f++)
+      {
+      frameSlot[frameList[f]] = f;
+      }
+    }
+
+  unsigned char *fileBuffer = 0;
+  unsigned char *bufferPtr = 0;
+
+  if (needBuffer)
+    {
+    // allocate a buffer for planar-to-packed conversion
+    fileBuffer = new unsigned char[info->FileFrameSize*readFrames];
+    bufferPtr = fileBuffer;
+    }
+  else
+    {
+    // read directly into the output
+    int sliceIdx = frames[0].SliceIndex;
+    int componentIdx = frames[0].ComponentIndex;
+    bufferPtr = (info->DataPtr +
+                 (sliceIdx - extent[4])*info->SliceSize +
+                 componentIdx*info->FilePixelSize*info->NumPlanes);
+    }
+
+  // ReadOneFile will set NeedsYBRToRGB to false if it does YBR->RGB itself
+  // (note: NeedsYBRToRGB will is ignored unless PhotometricInterpretation
+  // is YBR_FULL* or YBR_PARTIAL*).  This only ever happens for delegated
+  // reads, which are never done in parallel, so when reading in parallel
+  // the flag is set just once beforehand rather than per-file here.
+  if (!info->Parallel)
+    {
+    this->NeedsYBRToRGB = info->NeedsYBR;
+    }
+
+  // time the read when profiling
+  double profileStart = 0.0;
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    profileStart = vtkDICOMProfiler::StartPhase();
+    }
+
+  bool success;
+  if (mosaic)
+    {
+    // read the whole mosaic image, then scatter its tiles into the
+    // frame buffer: each tile row is one contiguous memcpy, so the
+    // mosaic streams through the cache one row at a time
+    int grid = this->MosaicGrid;
+    int tileRows = extent[3] - extent[2] + 1;
+    vtkIdType mosaicRowSize = info->FileRowSize*grid;
+    vtkIdType mosaicSize = mosaicRowSize*tileRows*grid;
+    unsigned char *mosaicBuffer = new unsigned char[mosaicSize];
+    success = this->ReadOneFile(
+      fileInfo->FileName.c_str(), fileIdx, mosaicBuffer, mosaicSize);
+    for (int sIdx = 0; sIdx < numFrames && success; sIdx++)
+      {
+      int tileIdx = frames[sIdx].FrameIndex;
+      const unsigned char *tilePtr =
+        (mosaicBuffer + (tileIdx/grid)*tileRows*mosaicRowSize +
+         (tileIdx % grid)*info->FileRowSize);
+      unsigned char *framePtr = bufferPtr + tileIdx*info->FileFrameSize;
+      for (int yIdx = 0; yIdx < tileRows; yIdx++)
+        {
+        memcpy(framePtr, tilePtr, info->FileRowSize);
+        framePtr += info->FileRowSize;
+        tilePtr += mosaicRowSize;
+        }
+      }
+    delete [] mosaicBuffer;
+    }
+  else if (!frameList.empty())
+    {
+    success = this->ReadFrameListNative(
+      fileInfo->FileName.c_str(), fileIdx, bufferPtr,
+      &frameList[0], readFrames, info->FileFrameSize);
+    }
+  else
+    {
+    success = this->ReadOneFile(fileInfo->FileName.c_str(), fileIdx,
+                                bufferPtr, framesInFile*info->FileFrameSize);
+    }
+
+  if (vtkDICOMProfiler::GetEnabled())
+    {
+    // when reading in parallel this runs on a worker thread, so the
+    // caller is passed as null to suppress the event
+    vtkDICOMProfiler::EndPhase(
+      (info->Parallel ? 0 : this), vtkDICOMProfiler::PixelDataRead,
+      profileStart, readFrames*info->FileFrameSize);
+    }
+
+  if (this->AbortExecute)
+    {
+    // the load was abandoned, skip the processing passes so that
+    // this thread is released promptly
+    delete [] fileBuffer;
+    return false;
+    }
+
+  unsigned char *rowBuffer = 0;
+  if (info->FlipImage)
+    {
+    rowBuffer = new unsigned char[info->FileRowSize];
+    }
+
+  // when the file data had to be byte-swapped, ReadFileNative already
+  // applied the rescale during the swap pass (see RescaleBuffer),
+  // these two transfer syntaxes are always read natively
+  bool rescaleDone = false;
+  if (this->NeedsRescale)
+    {
+    union { char c[2]; short s; } endianCheck = { { 0, 1 } };
+    bool memoryBigEndian = (endianCheck.s == 1);
+    std::string transferSyntax = this->MetaData->GetAttributeValue(
+      fileIdx, DC::TransferSyntaxUID).AsString();
+    bool fileBigEndian = (transferSyntax == "1.2.840.10008.1.2.2" ||
+                          transferSyntax == "1.2.840.113619.5.2");
+    rescaleDone = (fileBigEndian != memoryBigEndian);
+    }
+
+  // first pass: rescale and flip are applied to the frames in-place,
+  // before the frames are repacked into the output
+  for (int sIdx = 0; sIdx < numFrames; sIdx++)
+    {
+    int frameIdx = frames[sIdx].FrameIndex;
+
+    // rescale if Rescale was different for different files
+    if (this->NeedsRescale && !rescaleDone &&
+        this->MetaData->GetAttributeValue(fileIdx, DC::PixelData).IsValid())
+      {
+      this->RescaleBuffer(fileIdx, frameIdx, bufferPtr, info->SliceSize);
+      }
+
+    // flip the data if necessary
+    if (info->FlipImage)
+      {
+      int bufFrame = (frameSlot.empty() ? frameIdx : frameSlot[frameIdx]);
+      unsigned char *planePtr =
+        bufferPtr + bufFrame*info->FileFrameSize;
+      for (int pIdx = 0; pIdx < info->NumPlanes; pIdx++)
+        {
+        int numRows = extent[3] - extent[2] + 1;
+        int halfRows = numRows/2;
+        for (int yIdx = 0; yIdx < halfRows; yIdx++)
+          {
+          unsigned char *row1 = planePtr + yIdx*info->FileRowSize;
+          unsigned char *row2 =
+            planePtr + (numRows-yIdx-1)*info->FileRowSize;
+          memcpy(rowBuffer, row1, info->FileRowSize);
+          memcpy(row1, row2, info->FileRowSize);
+          memcpy(row2, rowBuffer, info->FileRowSize);
+          }
+        planePtr += info->FilePlaneSize;
+        }
+      }
+    }
+
+  // second pass: repack the frames into the output
+  if (info->PlanarToPacked)
+    {
+    // Each output pixel gathers components from every frame, so the
+    // writes for one frame are spread out: with many components per
+    // output pixel (e.g. TimeAsVector with hundreds of time points),
+    // every write lands on a different cache line.  To avoid reloading
+    // those lines for frame after frame, the repacking is blocked: a
+    // run of output pixels small enough to stay in cache is filled
+    // from all of the frames before moving on to the next run.
+    vtkIdType m = info->SliceSize/info->PixelSize; // pixels per slice
+    vtkIdType blockPixels = 131072/info->PixelSize;
+    blockPixels = (blockPixels > 0 ? blockPixels : 1);
+    vtkIdType elemCount;
+    vtkDICOMReaderRepackFunction repack =
+      vtkDICOMReaderGetRepackFunction(info->FilePixelSize, &elemCount);
+    for (vtkIdType blockStart = 0; blockStart < m; blockStart += blockPixels)
+      {
+      vtkIdType blockCount = m - blockStart;
+      blockCount = (blockCount < blockPixels ? blockCount : blockPixels);
+      for (int sIdx = 0; sIdx < numFrames; sIdx++)
+        {
+        int frameIdx = frames[sIdx].FrameIndex;
+        int sliceIdx = frames[sIdx].SliceIndex;
+        int componentIdx = frames[sIdx].ComponentIndex;
+        int bufFrame = (frameSlot.empty() ? frameIdx : frameSlot[frameIdx]);
+        const unsigned char *planePtr =
+          (bufferPtr + bufFrame*info->FileFrameSize +
+           blockStart*info->FilePixelSize);
+        unsigned char *slicePtr =
+          (info->DataPtr + (sliceIdx - extent[4])*info->SliceSize +
+           componentIdx*info->FilePixelSize*info->NumPlanes +
+           blockStart*info->PixelSize);
+        for (int pIdx = 0; pIdx < info->NumPlanes; pIdx++)
+          {
+          repack(slicePtr, info->PixelSize, planePtr, blockCount, elemCount);
+          planePtr += info->FilePlaneSize;
+          slicePtr += info->FilePixelSize;
+          }
+        }
+      }
+    }
+  else
+    {
+    for (int sIdx = 0; sIdx < numFrames; sIdx++)
+      {
+      int frameIdx = frames[sIdx].FrameIndex;
+      int sliceIdx = frames[sIdx].SliceIndex;
+      int componentIdx = frames[sIdx].ComponentIndex;
+      int bufFrame = (frameSlot.empty() ? frameIdx : frameSlot[frameIdx]);
+      unsigned char *planePtr =
+        bufferPtr + bufFrame*info->FileFrameSize;
+      unsigned char *slicePtr =
+        (info->DataPtr + (sliceIdx - extent[4])*info->SliceSize +
+         componentIdx*info->FilePixelSize*info->NumPlanes);
+      for (int pIdx = 0; pIdx < info->NumPlanes; pIdx++)
+        {
+        if (slicePtr != planePtr)
+          {
+          memcpy(slicePtr, planePtr, info->FilePlaneSize);
+          }
+        planePtr += info->FilePlaneSize;
+        }
+      }
+    }
+
+  // third pass: convert to RGB if data was read from file as YUV
+  if (this->NeedsYBRToRGB)
+    {
+    for (int sIdx = 0; sIdx < numFrames; sIdx++)
+      {
+      int frameIdx = frames[sIdx].FrameIndex;
+      int sliceIdx = frames[sIdx].SliceIndex;
+      int componentIdx = frames[sIdx].ComponentIndex;
+      unsigned char *slicePtr =
+        (info->DataPtr + (sliceIdx - extent[4])*info->SliceSize +
+         componentIdx*info->FilePixelSize*info->NumPlanes);
+      this->YBRToRGB(fileIdx, frameIdx, slicePtr, info->SliceSize);
+      }
+    }
+
+  // accumulate the range and histogram of the decoded slices while
+  // the data is still hot in the cache
+  if (info->ComputeRange && success)
+    {
+    vtkTypeInt64 *histo = 0;
+    if (info->HistogramBins > 0)
+      {
+      fileInfo->Histogram.resize(info->HistogramBins, 0);
+      histo = &fileInfo->Histogram[0];
+      }
+    size_t numValues =
+      static_cast<size_t>(info->SliceSize)/info->ScalarSize;
+    for (int sIdx = 0; sIdx < numFrames; sIdx++)
+      {
+      const unsigned char *slicePtr =
+        info->DataPtr + (frames[sIdx].SliceIndex - extent[4])*
+          info->SliceSize;
+      vtkDICOMReaderAccumulate(
+        slicePtr, numValues, info->ScalarType, fileInfo->Range,
+        info->HistogramShift, info->HistogramOrigin, histo);
+      }
+    }
+
+  delete [] rowBuffer;
+  delete [] fileBuffer;
+
+  return success;
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMReader::RequestData(
   vtkInformation* request,
@@ -1545,14 +3519,13 @@ int vtkDICOMReader::RequestData(
 
   int extent[6];
   outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
-  if (this->FileDimensionality == 2)
-    {
-    // limit the number of slices to the requested update extent
-    int uExtent[6];
-    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), uExtent);
-    extent[4] = uExtent[4];
-    extent[5] = uExtent[5];
-    }
+  // limit the number of slices to the requested update extent, for
+  // multi-frame files the frames outside of the update extent are
+  // skipped by seeking within the PixelData element
+  int uExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), uExtent);
+  extent[4] = uExtent[4];
+  extent[5] = uExtent[5];
 
   // make a list of all the files inside the update extent
   std::vector<vtkDICOMReaderFileInfo> files;
@@ -1573,6 +3546,8 @@ int vtkDICOMReader::RequestData(
         int n = this->MetaData->GetAttributeValue(
           fileIdx, DC::NumberOfFrames).AsInt();
         n = (n > 0 ? n : 1);
+        // each tile of a mosaic counts as one frame
+        n = (this->MosaicSize > 1 ? this->MosaicSize : n);
         files.push_back(vtkDICOMReaderFileInfo(fileIdx, n));
         iter = files.end();
         --iter;
@@ -1584,11 +3559,138 @@ int vtkDICOMReader::RequestData(
   // get the data object, allocate memory
   vtkImageData *data =
     static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  // component interleaving is only honored for caller-provided memory
+  bool interleaved = (this->OutputMemory != 0 &&
+                      this->OutputTotalComponents > 0);
+  if (this->OutputMemory == 0 && this->FileBackedOutput)
+    {
+    // allocate the output scalars in a memory-mapped scratch file,
+    // so that a volume larger than physical memory can be decoded
+    // with the operating system paging it to and from the disk
+    vtkIdType numValues = this->NumberOfScalarComponents;
+    numValues *= (extent[1] - extent[0] + 1);
+    numValues *= (extent[3] - extent[2] + 1);
+    numValues *= (extent[5] - extent[4] + 1);
+    vtkIdType numBytes =
+      numValues*vtkDataArray::GetDataTypeSize(this->DataScalarType);
+    void *ptr = vtkDICOMFile::MapScratchFile(
+      this->ScratchDirectory, numBytes);
+    if (ptr)
+      {
+      data->SetExtent(extent);
+      vtkDataArray *scalars =
+        vtkDataArray::CreateDataArray(this->DataScalarType);
+      scalars->SetNumberOfComponents(this->NumberOfScalarComponents);
+      scalars->SetVoidArray(ptr, numValues, 1);
+      // release the mapping when the array is deleted
+      vtkDICOMReaderScratchInfo *sinfo = new vtkDICOMReaderScratchInfo;
+      sinfo->Pointer = ptr;
+      sinfo->Size = numBytes;
+      vtkCallbackCommand *cc = vtkCallbackCommand::New();
+      cc->SetCallback(vtkDICOMReaderScratchDeleted);
+      cc->SetClientData(sinfo);
+      scalars->AddObserver(vtkCommand::DeleteEvent, cc);
+      cc->Delete();
+      data->GetPointData()->SetScalars(scalars);
+      scalars->Delete();
+      }
+    else
+      {
+      vtkWarningMacro("Unable to create a scratch file for "
+                      << numBytes << " bytes, using ordinary memory "
+                      "for the output.");
+#if VTK_MAJOR_VERSION >= 6
+      this->AllocateOutputData(data, outInfo, extent);
+#else
+      this->AllocateOutputData(data, extent);
+#endif
+      }
+    }
+  else if (this->OutputMemory)
+    {
+    // point the output scalars at the buffer the caller provided,
+    // so that the pixels are decoded directly into that buffer
+    int totalComp = this->NumberOfScalarComponents;
+    if (interleaved)
+      {
+      // the buffer holds the components of several series, and this
+      // reader only writes its own stride of each voxel
+      totalComp = this->OutputTotalComponents;
+      if (this->OutputComponentOffset +
+          this->NumberOfScalarComponents > totalComp)
+        {
+        vtkErrorMacro("The component interleave does not fit: offset "
+                      << this->OutputComponentOffset << " plus "
+                      << this->NumberOfScalarComponents << " components"
+                      " exceeds the total of " << totalComp << ".");
+        return false;
+        }
+      }
+    vtkIdType numValues = totalComp;
+    numValues *= (extent[1] - extent[0] + 1);
+    numValues *= (extent[3] - extent[2] + 1);
+    numValues *= (extent[5] - extent[4] + 1);
+    vtkIdType numBytes =
+      numValues*vtkDataArray::GetDataTypeSize(this->DataScalarType);
+    if (this->OutputMemorySize < numBytes)
+      {
+      vtkErrorMacro("The output memory is too small: " << numBytes
+                    << " bytes are needed for the update extent, but only "
+                    << this->OutputMemorySize << " were provided.");
+      return false;
+      }
+    data->SetExtent(extent);
+    vtkDataArray *scalars =
+      vtkDataArray::CreateDataArray(this->DataScalarType);
+    scalars->SetNumberOfComponents(totalComp);
+    scalars->SetVoidArray(this->OutputMemory, numValues, 1);
+    data->GetPointData()->SetScalars(scalars);
+    scalars->Delete();
+    }
+  else
+    {
+    bool allocated = false;
+    if (this->HugePages)
+      {
+      // allocate the output scalars with large-page backing, which
+      // reduces address-translation overhead for very large volumes
+      vtkIdType numValues = this->NumberOfScalarComponents;
+      numValues *= (extent[1] - extent[0] + 1);
+      numValues *= (extent[3] - extent[2] + 1);
+      numValues *= (extent[5] - extent[4] + 1);
+      vtkIdType numBytes =
+        numValues*vtkDataArray::GetDataTypeSize(this->DataScalarType);
+      void *ptr = vtkDICOMFile::MapLargePages(numBytes);
+      if (ptr)
+        {
+        data->SetExtent(extent);
+        vtkDataArray *scalars =
+          vtkDataArray::CreateDataArray(this->DataScalarType);
+        scalars->SetNumberOfComponents(this->NumberOfScalarComponents);
+        scalars->SetVoidArray(ptr, numValues, 1);
+        // release the memory when the array is deleted
+        vtkDICOMReaderScratchInfo *sinfo = new vtkDICOMReaderScratchInfo;
+        sinfo->Pointer = ptr;
+        sinfo->Size = numBytes;
+        vtkCallbackCommand *cc = vtkCallbackCommand::New();
+        cc->SetCallback(vtkDICOMReaderLargePagesDeleted);
+        cc->SetClientData(sinfo);
+        scalars->AddObserver(vtkCommand::DeleteEvent, cc);
+        cc->Delete();
+        data->GetPointData()->SetScalars(scalars);
+        scalars->Delete();
+        allocated = true;
+        }
+      }
+    if (!allocated)
+      {
 #if VTK_MAJOR_VERSION >= 6
-  this->AllocateOutputData(data, outInfo, extent);
+      this->AllocateOutputData(data, outInfo, extent);
 #else
-  this->AllocateOutputData(data, extent);
+      this->AllocateOutputData(data, extent);
 #endif
+      }
+    }
 
   // label the scalars as "PixelData"
   data->GetPointData()->GetScalars()->SetName("PixelData");
@@ -1607,6 +3709,13 @@ int vtkDICOMReader::RequestData(
   int numFileComponents = this->NumberOfPackedComponents;
   int numPlanes = this->NumberOfPlanarComponents;
 
+  if (interleaved)
+    {
+    // step over the components that belong to the other series, the
+    // wider pixel stride below takes care of the rest
+    dataPtr += this->OutputComponentOffset*scalarSize;
+    }
+
   vtkIdType pixelSize = numComponents*scalarSize;
   vtkIdType rowSize = pixelSize*(extent[1] - extent[0] + 1);
   vtkIdType sliceSize = rowSize*(extent[3] - extent[2] + 1);
@@ -1619,141 +3728,371 @@ int vtkDICOMReader::RequestData(
 
   bool flipImage = (this->MemoryRowOrder == vtkDICOMReader::BottomUp);
   bool planarToPacked = (filePixelSize != pixelSize);
-  unsigned char *rowBuffer = 0;
-  if (flipImage)
+
+  // this info is shared with ReadOneFileForUpdate
+  vtkDICOMReaderUpdateInfo updateInfo;
+  updateInfo.Reader = this;
+  updateInfo.Files = &files;
+  updateInfo.DataPtr = dataPtr;
+  for (int eIdx = 0; eIdx < 6; eIdx++)
     {
-    rowBuffer = new unsigned char[fileRowSize];
+    updateInfo.Extent[eIdx] = extent[eIdx];
     }
-  unsigned char *fileBuffer = 0;
-  int framesInPreviousFile = -1;
-
-  // loop through all files in the update extent
-  for (size_t idx = 0; idx < files.size(); idx++)
+  updateInfo.PixelSize = pixelSize;
+  updateInfo.SliceSize = sliceSize;
+  updateInfo.FilePixelSize = filePixelSize;
+  updateInfo.FileRowSize = fileRowSize;
+  updateInfo.FilePlaneSize = filePlaneSize;
+  updateInfo.FileFrameSize = fileFrameSize;
+  updateInfo.NumPlanes = numPlanes;
+  updateInfo.NeedsYBR = (!interleaved &&
+                         this->AutoYBRToRGB &&
+                         numComponents == 3 &&
+                         scalarSize == 1);
+  updateInfo.FlipImage = flipImage;
+  updateInfo.PlanarToPacked = planarToPacked;
+  updateInfo.Parallel = false;
+  updateInfo.FirstTouch = false;
+  // the fused range computation visits whole slices, so it needs
+  // every output slice to come from exactly one file
+  int histogramShift = 0;
+  int histogramOrigin = 0;
+  int histogramBins = vtkDICOMReaderHistogramBins(
+    this->DataScalarType, &histogramShift, &histogramOrigin);
+  bool fusedRange = (this->ComputeScalarRange != 0 &&
+                     nComp == 1 && !planarToPacked);
+  updateInfo.ComputeRange = fusedRange;
+  updateInfo.ScalarType = this->DataScalarType;
+  updateInfo.ScalarSize = scalarSize;
+  updateInfo.HistogramBins = histogramBins;
+  updateInfo.HistogramShift = histogramShift;
+  updateInfo.HistogramOrigin = histogramOrigin;
+  for (int tIdx = 0; tIdx < VTK_MAX_THREADS; tIdx++)
     {
-    if (this->AbortExecute) { break; }
-
-    this->UpdateProgress(static_cast<double>(idx)/
-                         static_cast<double>(files.size()));
-
-    // get the index for this file
-    int fileIdx = files[idx].FileIndex;
-    int framesInFile = files[idx].FramesInFile;
-    std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
-    int numFrames = static_cast<int>(frames.size());
+    updateInfo.FilesDone[tIdx][0] = 0;
+    }
 
-    // we need a file buffer if input frames don't match output slices
-    bool needBuffer = (planarToPacked || numFrames != framesInFile);
-    for (int sIdx = 0; sIdx < numFrames && !needBuffer; sIdx++)
+  // the range and histogram of the slices served from the cache
+  double servedRange[2] = { 0.0, -1.0 };
+  std::vector<vtkTypeInt64> servedHistogram;
+
+  // the slice cache is only used when every output slice comes from
+  // exactly one file, so that each cached slice is a complete and
+  // contiguous piece of the output
+  bool useCache = (this->SliceCaching != 0 && this->SliceCacheSize > 0 &&
+                   nComp == 1 && !interleaved);
+  if (this->SliceCache &&
+      (!useCache ||
+       !this->SliceCache->IsValid(this->GetMTime(), sliceSize)))
+    {
+    // drop the cache if the reader or the geometry has changed
+    delete this->SliceCache;
+    this->SliceCache = 0;
+    }
+  if (useCache)
+    {
+    if (this->SliceCache == 0)
       {
-      needBuffer = (sIdx != frames[sIdx].FrameIndex);
+      this->SliceCache =
+        new vtkDICOMReaderSliceCache(this->GetMTime(), sliceSize);
       }
+    // copy any slices that are present in the cache directly into the
+    // output, and trim them from the list of frames to be read
+    for (size_t idx = 0; idx < files.size(); idx++)
+      {
+      std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
+      size_t f = 0;
+      while (f < frames.size())
+        {
+        unsigned char *slicePtr =
+          dataPtr + (frames[f].SliceIndex - extent[4])*sliceSize;
+        if (this->SliceCache->Fetch(
+              files[idx].FileIndex, frames[f].FrameIndex, slicePtr))
+          {
+          // slices served from the cache are not seen by the fused
+          // range computation, so accumulate them here
+          if (fusedRange)
+            {
+            vtkTypeInt64 *histo = 0;
+            if (histogramBins > 0)
+              {
+              servedHistogram.resize(histogramBins, 0);
+              histo = &servedHistogram[0];
+              }
+            vtkDICOMReaderAccumulate(
+              slicePtr, static_cast<size_t>(sliceSize)/scalarSize,
+              this->DataScalarType, servedRange,
+              histogramShift, histogramOrigin, histo);
+            }
+          frames.erase(frames.begin() + f);
+          }
+        else
+          {
+          f++;
+          }
+        }
+      }
+    // remove the files whose frames all came from the cache
+    size_t idx = 0;
+    while (idx < files.size())
+      {
+      if (files[idx].Frames.empty())
+        {
+        files.erase(files.begin() + idx);
+        }
+      else
+        {
+        idx++;
+        }
+      }
+    }
 
-    unsigned char *bufferPtr = 0;
+  // compute the file names up front, and check whether every file can
+  // be read without delegating to GDCM or DCMTK (the delegates cannot
+  // safely be called from multiple threads)
+  bool allFilesNative = true;
+  for (size_t idx = 0; idx < files.size(); idx++)
+    {
+    this->ComputeInternalFileName(files[idx].FileIndex);
+    files[idx].FileName = this->InternalFileName;
+    std::string transferSyntax = this->MetaData->GetAttributeValue(
+      files[idx].FileIndex, DC::TransferSyntaxUID).AsString();
+    if (!(transferSyntax == "1.2.840.10008.1.2"   ||
+          transferSyntax == "1.2.840.10008.1.20"  ||
+          transferSyntax == "1.2.840.10008.1.2.1" ||
+          transferSyntax == "1.2.840.10008.1.2.2" ||
+          transferSyntax == "1.2.840.10008.1.2.5" ||
+          transferSyntax == "1.2.840.113619.5.2"  ||
+          transferSyntax == ""))
+      {
+      allFilesNative = false;
+      }
+    }
 
-    if (needBuffer)
+  // in progressive mode, decode the files in order of their distance
+  // from the priority slice, so that the region of interest becomes
+  // valid first and the observer can display it immediately; like the
+  // slice cache, this needs every output slice to come from exactly
+  // one file, so that a decoded file is a displayable region
+  bool progressive = (this->ProgressiveLoading != 0 && nComp == 1 &&
+                      files.size() > 1);
+  if (progressive)
+    {
+    int priority = this->PrioritySlice;
+    if (priority < 0)
+      {
+      priority = (extent[4] + extent[5])/2;
+      }
+    std::vector<std::pair<int, size_t> > order(files.size());
+    for (size_t idx = 0; idx < files.size(); idx++)
       {
-      if (numFrames != framesInPreviousFile)
+      std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
+      int dist = VTK_INT_MAX;
+      for (size_t f = 0; f < frames.size(); f++)
         {
-        // allocate a buffer for planar-to-packed conversion
-        delete [] fileBuffer;
-        fileBuffer = new unsigned char[fileFrameSize*framesInFile];
-        framesInPreviousFile = numFrames;
+        int d = frames[f].SliceIndex - priority;
+        d = (d < 0 ? -d : d);
+        dist = (d < dist ? d : dist);
         }
-      bufferPtr = fileBuffer;
+      order[idx] = std::make_pair(dist, idx);
       }
-    else
+    std::sort(order.begin(), order.end());
+    std::vector<vtkDICOMReaderFileInfo> reordered;
+    reordered.reserve(files.size());
+    for (size_t idx = 0; idx < files.size(); idx++)
       {
-      // read directly into the output
-      int sliceIdx = frames[0].SliceIndex;
-      int componentIdx = frames[0].ComponentIndex;
-      bufferPtr = (dataPtr +
-                   (sliceIdx - extent[4])*sliceSize +
-                   componentIdx*filePixelSize*numPlanes);
+      reordered.push_back(files[order[idx].second]);
       }
+    files.swap(reordered);
+    }
 
-    // ReadOneFile will set NeedsYBRToRGB to false if it does YBR->RGB itself
-    // (note: NeedsYBRToRGB will is ignored unless PhotometricInterpretation
-    // is YBR_FULL* or YBR_PARTIAL*)
-    this->NeedsYBRToRGB = (this->AutoYBRToRGB &&
-                           numComponents == 3 &&
-                           scalarSize == 1);
-
-    this->ComputeInternalFileName(fileIdx);
-    this->ReadOneFile(this->InternalFileName, fileIdx,
-                      bufferPtr, framesInFile*fileFrameSize);
+  if (this->ParallelDecoding && allFilesNative && !progressive &&
+      files.size() > 1)
+    {
+    // decode the files with a pool of worker threads, every slice is
+    // written into its own disjoint region of the output
+    updateInfo.Parallel = true;
+    // the first-touch pass writes at page granularity, so it is only
+    // safe when every output slice comes from exactly one file, i.e.
+    // when no two threads can ever write to the same slice
+    updateInfo.FirstTouch = (this->NUMAFirstTouch != 0 && nComp == 1 &&
+                             !interleaved);
+    this->NeedsYBRToRGB = updateInfo.NeedsYBR;
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    if (this->NumberOfDecodingThreads > 0)
+      {
+      threader->SetNumberOfThreads(this->NumberOfDecodingThreads);
+      }
+    if (threader->GetNumberOfThreads() > static_cast<int>(files.size()))
+      {
+      threader->SetNumberOfThreads(static_cast<int>(files.size()));
+      }
+    threader->SetSingleMethod(vtkDICOMReaderThreadUpdate, &updateInfo);
+    threader->SingleMethodExecute();
+    threader->Delete();
+    }
+  else
+    {
+    // optionally read ahead of the loop with background I/O threads
+    // (a bundle is one file, it is prefetched by the OS readahead)
+    vtkDICOMFilePrefetcher *prefetcher = 0;
+    if (this->Prefetching && files.size() > 1 && this->BundleIndex == 0)
+      {
+      vtkStringArray *prefetchNames = vtkStringArray::New();
+      for (size_t idx = 0; idx < files.size(); idx++)
+        {
+        prefetchNames->InsertNextValue(files[idx].FileName);
+        }
+      prefetcher = vtkDICOMFilePrefetcher::New();
+      prefetcher->SetFileNames(prefetchNames);
+      prefetchNames->Delete();
+      prefetcher->Start();
+      }
 
-    // iterate through all frames contained in the file
-    for (int sIdx = 0; sIdx < numFrames; sIdx++)
+    // loop through all files in the update extent
+    int lastPercent = -1;
+    for (size_t idx = 0; idx < files.size(); idx++)
       {
-      int frameIdx = frames[sIdx].FrameIndex;
-      int sliceIdx = frames[sIdx].SliceIndex;
-      int componentIdx = frames[sIdx].ComponentIndex;
-      // go to the correct position in the input
-      unsigned char *framePtr = bufferPtr + frameIdx*fileFrameSize;
-      // go to the correct position in the output
-      unsigned char *slicePtr =
-        (dataPtr + (sliceIdx - extent[4])*sliceSize +
-         componentIdx*filePixelSize*numPlanes);
+      if (this->AbortExecute) { break; }
+
+      // report progress at one percent intervals
+      int percent = static_cast<int>((idx*100)/files.size());
+      if (percent != lastPercent)
+        {
+        lastPercent = percent;
+        this->UpdateProgress(0.01*percent);
+        }
 
-      // rescale if Rescale was different for different files
-      if (this->NeedsRescale &&
-          this->MetaData->GetAttributeValue(fileIdx, DC::PixelData).IsValid())
+      if (prefetcher)
         {
-        this->RescaleBuffer(fileIdx, frameIdx, bufferPtr, sliceSize);
+        prefetcher->SetCurrentIndex(static_cast<int>(idx));
         }
 
-      // iterate through all color planes in the slice
-      unsigned char *planePtr = framePtr;
-      for (int pIdx = 0; pIdx < numPlanes; pIdx++)
+      this->ReadOneFileForUpdate(&files[idx], &updateInfo);
+
+      if (progressive)
         {
-        // flip the data if necessary
-        if (flipImage)
+        // announce the output slices that just became valid
+        std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
+        if (!frames.empty())
           {
-          int numRows = extent[3] - extent[2] + 1;
-          int halfRows = numRows/2;
-          for (int yIdx = 0; yIdx < halfRows; yIdx++)
+          int sliceRange[2];
+          sliceRange[0] = frames[0].SliceIndex;
+          sliceRange[1] = frames[0].SliceIndex;
+          for (size_t f = 1; f < frames.size(); f++)
             {
-            unsigned char *row1 = planePtr + yIdx*fileRowSize;
-            unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
-            memcpy(rowBuffer, row1, fileRowSize);
-            memcpy(row1, row2, fileRowSize);
-            memcpy(row2, rowBuffer, fileRowSize);
+            int s = frames[f].SliceIndex;
+            sliceRange[0] = (s < sliceRange[0] ? s : sliceRange[0]);
+            sliceRange[1] = (s > sliceRange[1] ? s : sliceRange[1]);
             }
+          this->InvokeEvent(
+            vtkDICOMReader::ProgressiveUpdateEvent, sliceRange);
           }
+        }
+      }
 
-        // convert planes into vector components
-        if (planarToPacked)
+    if (prefetcher)
+      {
+      prefetcher->Delete();
+      }
+    }
+
+  if (this->SliceCache && !this->AbortExecute)
+    {
+    // copy the newly decoded slices into the cache
+    vtkIdType budget = this->SliceCacheSize;
+    budget *= 1024*1024;
+    for (size_t idx = 0; idx < files.size(); idx++)
+      {
+      std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
+      for (size_t f = 0; f < frames.size(); f++)
+        {
+        unsigned char *slicePtr =
+          dataPtr + (frames[f].SliceIndex - extent[4])*sliceSize;
+        this->SliceCache->Store(
+          files[idx].FileIndex, frames[f].FrameIndex, slicePtr, budget);
+        }
+      }
+    }
+
+  if (this->ComputeScalarRange && !interleaved)
+    {
+    // combine the ranges and histograms that were accumulated while
+    // the slices were decoded (or served from the cache)
+    double range[2] = { 0.0, -1.0 };
+    std::vector<vtkTypeInt64> histogram;
+    if (histogramBins > 0)
+      {
+      histogram.resize(histogramBins, 0);
+      }
+    if (fusedRange)
+      {
+      for (size_t idx = 0; idx < files.size(); idx++)
+        {
+        const vtkDICOMReaderFileInfo& fileInfo = files[idx];
+        if (fileInfo.Range[0] <= fileInfo.Range[1])
           {
-          const unsigned char *tmpInPtr = planePtr;
-          unsigned char *tmpOutPtr = slicePtr;
-          int m = sliceSize/pixelSize;
-          for (int i = 0; i < m; i++)
+          if (range[0] > range[1])
+            {
+            range[0] = fileInfo.Range[0];
+            range[1] = fileInfo.Range[1];
+            }
+          else
             {
-            vtkIdType n = filePixelSize;
-            do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
-            tmpOutPtr += pixelSize - filePixelSize;
+            range[0] = (fileInfo.Range[0] < range[0] ?
+                        fileInfo.Range[0] : range[0]);
+            range[1] = (fileInfo.Range[1] > range[1] ?
+                        fileInfo.Range[1] : range[1]);
             }
-          slicePtr += filePixelSize;
           }
-        else if (slicePtr != planePtr)
+        for (size_t b = 0; b < fileInfo.Histogram.size(); b++)
           {
-          memcpy(slicePtr, planePtr, filePlaneSize);
+          histogram[b] += fileInfo.Histogram[b];
           }
-
-        planePtr += filePlaneSize;
         }
-
-      // convert to RGB if data was read from file as YUV
-      if (this->NeedsYBRToRGB)
+      if (servedRange[0] <= servedRange[1])
         {
-        this->YBRToRGB(fileIdx, frameIdx, slicePtr, sliceSize);
+        if (range[0] > range[1])
+          {
+          range[0] = servedRange[0];
+          range[1] = servedRange[1];
+          }
+        else
+          {
+          range[0] = (servedRange[0] < range[0] ?
+                      servedRange[0] : range[0]);
+          range[1] = (servedRange[1] > range[1] ?
+                      servedRange[1] : range[1]);
+          }
         }
+      for (size_t b = 0; b < servedHistogram.size(); b++)
+        {
+        histogram[b] += servedHistogram[b];
+        }
+      }
+    else
+      {
+      // when the slices are composed from several files or have been
+      // repacked, sweep the whole output once instead
+      size_t numValues = static_cast<size_t>(sliceSize)/scalarSize;
+      numValues *= (extent[5] - extent[4] + 1);
+      vtkTypeInt64 *histo =
+        (histogramBins > 0 ? &histogram[0] : 0);
+      vtkDICOMReaderAccumulate(
+        dataPtr, numValues, this->DataScalarType, range,
+        histogramShift, histogramOrigin, histo);
+      }
+    this->DecodedScalarRange[0] = range[0];
+    this->DecodedScalarRange[1] = range[1];
+    this->DecodedHistogramBinWidth = (1 << histogramShift);
+    this->DecodedHistogramOrigin = histogramOrigin;
+    this->DecodedHistogram->SetNumberOfValues(histogramBins);
+    for (int b = 0; b < histogramBins; b++)
+      {
+      this->DecodedHistogram->SetValue(b, histogram[b]);
       }
     }
 
-  delete [] rowBuffer;
-  delete [] fileBuffer;
-
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
 
@@ -1796,7 +4135,11 @@ vtkMedicalImageProperties *vtkDICOMReader::GetMedicalImageProperties()
   if (this->MedicalImageProperties == 0)
     {
     this->MedicalImageProperties = vtkMedicalImageProperties::New();
+    }
+  if (!this->MedicalImagePropertiesUpToDate)
+    {
     this->UpdateMedicalImageProperties();
+    this->MedicalImagePropertiesUpToDate = true;
     }
 
   return this->MedicalImageProperties;
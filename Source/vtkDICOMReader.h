@@ -20,6 +20,7 @@
 #define vtkDICOMReader_h
 
 #include <vtkImageReader2.h>
+#include <vtkCommand.h> // For UserEvent
 #include "vtkDICOMModule.h" // For export macro
 
 class vtkIntArray;
@@ -30,6 +31,10 @@ class vtkMedicalImageProperties;
 class vtkDICOMMetaData;
 class vtkDICOMParser;
 class vtkDICOMSliceSorter;
+struct vtkDICOMReaderFileInfo;
+struct vtkDICOMReaderUpdateInfo;
+class vtkDICOMReaderUpdateFriendship;
+class vtkDICOMReaderSliceCache;
 
 //----------------------------------------------------------------------------
 class VTKDICOM_EXPORT vtkDICOMReader : public vtkImageReader2
@@ -172,6 +177,8 @@ public:
 
   // Description:
   // Get a MedicalImageProperties object for this file.
+  // The properties are built from the meta data the first time that
+  // this method is called after the reader has executed.
   vtkMedicalImageProperties *GetMedicalImageProperties();
 
   // Description:
@@ -193,6 +200,286 @@ public:
   int GetMemoryRowOrder() { return this->MemoryRowOrder; }
   const char *GetMemoryRowOrderAsString();
 
+  // Description:
+  // Read and decode the slices in parallel (default: Off).
+  // When this is On, the files that make up the volume are read and
+  // decoded by a pool of worker threads, with every slice written into
+  // its own disjoint region of the output buffer.  The reader falls
+  // back to sequential reading if any of the files must be decompressed
+  // by a delegate library such as GDCM or DCMTK.
+  vtkGetMacro(ParallelDecoding, int);
+  vtkSetMacro(ParallelDecoding, int);
+  vtkBooleanMacro(ParallelDecoding, int);
+
+  // Description:
+  // The number of threads to use for parallel decoding.
+  // The default is zero, which means one thread per processor core.
+  vtkGetMacro(NumberOfDecodingThreads, int);
+  vtkSetMacro(NumberOfDecodingThreads, int);
+
+  // Description:
+  // Keep each decoded slab in memory local to its thread (default: Off).
+  // When this is On, the files are dealt to the parallel decoding
+  // threads as contiguous slabs of the output volume instead of
+  // round-robin, and each thread writes to every page of its own slab
+  // before decoding begins.  On operating systems that place a memory
+  // page on the NUMA node of the first thread that touches it, this
+  // keeps each slab of the volume in the memory that is local to the
+  // thread that decodes it, avoiding the remote-memory traffic that
+  // otherwise limits throughput on multi-socket machines.  It has no
+  // effect unless ParallelDecoding is On, and it is skipped for
+  // volumes whose slices are composed from more than one file, since
+  // those slices have no single owning thread.
+  vtkGetMacro(NUMAFirstTouch, int);
+  vtkSetMacro(NUMAFirstTouch, int);
+  vtkBooleanMacro(NUMAFirstTouch, int);
+
+  // Description:
+  // Read ahead with background I/O threads (default: Off).
+  // When this is On and the files are read sequentially, a small pool
+  // of I/O threads reads the next few files of the series into the
+  // operating system's cache while the current file is being decoded.
+  // This is useful on network file systems, where the latency of each
+  // file access would otherwise stall the reader.  It has no effect
+  // when ParallelDecoding is used.
+  vtkGetMacro(Prefetching, int);
+  vtkSetMacro(Prefetching, int);
+  vtkBooleanMacro(Prefetching, int);
+
+  // Description:
+  // Decode the slices of interest first (default: Off).
+  // When this is On, the files are decoded in order of their distance
+  // from the priority slice instead of from the bottom of the volume
+  // to the top, and the ProgressiveUpdateEvent is invoked after each
+  // file with the inclusive range of output slices that just became
+  // valid as the call data (two ints).  An observer can display the
+  // completed region immediately, so the slices of interest appear
+  // after a single file has been read instead of after the whole
+  // volume.  This mode takes precedence over ParallelDecoding,
+  // because the events must be invoked on the thread that called
+  // Update(), and it is skipped for volumes whose slices are
+  // composed from more than one file.
+  vtkGetMacro(ProgressiveLoading, int);
+  vtkSetMacro(ProgressiveLoading, int);
+  vtkBooleanMacro(ProgressiveLoading, int);
+
+  // Description:
+  // The output slice to decode first (default: -1).
+  // This selects the region of interest for progressive loading.
+  // The default of -1 decodes outward from the middle slice of the
+  // volume.
+  vtkGetMacro(PrioritySlice, int);
+  vtkSetMacro(PrioritySlice, int);
+
+  // Description:
+  // The event invoked as regions of the output become valid.
+  enum { ProgressiveUpdateEvent = vtkCommand::UserEvent + 65 };
+
+  // Description:
+  // Keep recently decoded slices in a memory cache (default: Off).
+  // When this is On, the reader keeps a copy of each decoded slice in
+  // an internal least-recently-used cache, and later updates that
+  // request the same slices are served from the cache instead of
+  // decoding the files again.  This is useful when interactively
+  // scrolling through a compressed series, where the cost of decoding
+  // a slice far exceeds the cost of copying it from memory.  The cache
+  // is discarded whenever the reader is modified, and it is skipped
+  // for volumes whose slices are composed from more than one file.
+  vtkGetMacro(SliceCaching, int);
+  vtkSetMacro(SliceCaching, int);
+  vtkBooleanMacro(SliceCaching, int);
+
+  // Description:
+  // The maximum size of the slice cache in mebibytes (default: 256).
+  // When the cache grows beyond this size, the least recently used
+  // slices are discarded to make room.  The cache also registers
+  // with vtkDICOMMemoryGovernor, so if a library-wide memory budget
+  // has been set, the cache may be shrunk below this size when the
+  // process as a whole comes under memory pressure.  This option has
+  // no effect unless SliceCaching is On.
+  vtkGetMacro(SliceCacheSize, int);
+  vtkSetMacro(SliceCacheSize, int);
+
+  // Description:
+  // Compute the scalar range and histogram while decoding (default: Off).
+  // When this is On, the minimum and maximum scalar value and a coarse
+  // histogram of the data are accumulated while the slices are being
+  // decoded, when the data is still hot in the cache, instead of
+  // requiring a second sweep over the volume.  The results are
+  // available from GetDecodedScalarRange() and GetDecodedHistogram()
+  // after the data has been updated, e.g. for automatically setting
+  // the window and level in a viewer.
+  vtkGetMacro(ComputeScalarRange, int);
+  vtkSetMacro(ComputeScalarRange, int);
+  vtkBooleanMacro(ComputeScalarRange, int);
+
+  // Description:
+  // Get the scalar range that was computed during decoding.
+  // This is only valid after the data has been updated with
+  // ComputeScalarRange On.  If no data was decoded, the range
+  // is invalid, with the minimum above the maximum.
+  vtkGetVector2Macro(DecodedScalarRange, double);
+
+  // Description:
+  // Get the histogram that was computed during decoding.
+  // This is only valid after the data has been updated with
+  // ComputeScalarRange On.  The histogram is computed for 8-bit and
+  // 16-bit integer data only (the array is empty for other scalar
+  // types), with 256 bins for 8-bit data and 4096 bins for 16-bit
+  // data.  Bin "i" counts the values from Origin + i*BinWidth up to
+  // but not including Origin + (i+1)*BinWidth.
+  vtkTypeInt64Array *GetDecodedHistogram() {
+    return this->DecodedHistogram; }
+  vtkGetMacro(DecodedHistogramBinWidth, double);
+  vtkGetMacro(DecodedHistogramOrigin, double);
+
+  // Description:
+  // Supply a pre-allocated buffer to receive the pixel data.
+  // If a buffer is provided, then the output scalars will point at
+  // this buffer rather than at memory that the reader allocates for
+  // itself.  This avoids a full-volume copy when the data has to land
+  // in a special kind of memory, such as the pinned host memory that
+  // a GPU can transfer from asynchronously.  The pixels are written
+  // with the reader's usual packed layout: components vary fastest,
+  // then columns, rows, and slices, for the scalar type and update
+  // extent that the pipeline reports after UpdateInformation().  The
+  // size of the buffer must be given in bytes, and the caller keeps
+  // ownership of the buffer, which must remain valid for as long as
+  // the output of the reader is in use.  Pass a null pointer to make
+  // the reader allocate its own memory again.
+  void SetOutputMemory(void *ptr, vtkIdType size);
+  void *GetOutputMemory() { return this->OutputMemory; }
+  vtkIdType GetOutputMemorySize() { return this->OutputMemorySize; }
+
+  // Description:
+  // Interleave the output into a wider multi-component buffer.
+  // This is used together with SetOutputMemory() when several series
+  // are assembled into a single multi-component volume, e.g. by
+  // vtkDICOMSeriesAssembler: the buffer is laid out with "total"
+  // components per voxel, and this reader decodes its own components
+  // into the stride that starts at component "offset", leaving the
+  // bytes of the other components untouched so that the readers for
+  // the other series can fill them (concurrently, if desired).  The
+  // output data object reports all "total" components.  Set total to
+  // zero (the default) for ordinary, non-interleaved output.  The
+  // slice cache, the automatic YBR conversion, and the decoded
+  // scalar range are not available while interleaving, because they
+  // would touch the bytes that belong to the other series.
+  void SetOutputComponentInterleave(int offset, int total);
+  int GetOutputComponentOffset() { return this->OutputComponentOffset; }
+  int GetOutputTotalComponents() { return this->OutputTotalComponents; }
+
+  // Description:
+  // Back the output with a memory-mapped scratch file (default: off).
+  // When this is on, the reader allocates the output scalars in a
+  // temporary file that is mapped into memory, rather than on the
+  // heap, so that volumes larger than physical memory can be decoded
+  // and then processed with the operating system paging the data to
+  // and from the disk as needed.  The scratch file is created in the
+  // ScratchDirectory (or in the system temporary directory, if no
+  // directory is set) and is reclaimed automatically when the output
+  // data is freed.  If the scratch file cannot be created, then the
+  // reader falls back to ordinary memory with a warning.
+  vtkSetMacro(FileBackedOutput, int);
+  vtkBooleanMacro(FileBackedOutput, int);
+  vtkGetMacro(FileBackedOutput, int);
+
+  // Description:
+  // The directory to create the scratch file in (default: none).
+  // This is only used when FileBackedOutput is on.  Point it at a
+  // disk with enough free space for the full decoded volume.
+  vtkSetStringMacro(ScratchDirectory);
+  vtkGetStringMacro(ScratchDirectory);
+
+  // Description:
+  // Request large ("huge") page backing for the output (default: off).
+  // When this is on, the reader allocates the output scalars with an
+  // allocator that asks the operating system to back the buffer with
+  // large pages, which reduces address-translation overhead when a
+  // multi-gigabyte volume is swept by rescaling, reformatting, or
+  // rendering passes.  The request is a hint: if large pages are not
+  // available, the buffer is silently backed by ordinary pages.  This
+  // option is ignored when OutputMemory or FileBackedOutput is used.
+  vtkSetMacro(HugePages, int);
+  vtkBooleanMacro(HugePages, int);
+  vtkGetMacro(HugePages, int);
+
+  // Description:
+  // The I/O scheduling priority for reads done by this reader.
+  // Set this to vtkDICOMFile::PriorityBackground for a reader that
+  // loads data in the background, so that its reads yield to any
+  // interactive loads that are in progress in the same process (see
+  // vtkDICOMFile for details).  The default is
+  // vtkDICOMFile::PriorityInteractive.
+  vtkSetMacro(IOPriority, int);
+  vtkGetMacro(IOPriority, int);
+
+  // Description:
+  // Supply metadata that was already parsed from the input files.
+  // When vtkDICOMDirectory scans an archive with KeepFileMetaData
+  // turned on, its GetMetaDataForSeries() and GetFileOffsetsForSeries()
+  // methods provide the complete file headers and the offsets of the
+  // pixel data for every file in a series.  Handing them to the reader
+  // with this method lets RequestInformation() skip its own parse of
+  // the file headers, so that each file is only opened once, when its
+  // pixel data is read.  The metadata must have one instance per input
+  // file, in the same order as the file names, and the offset array
+  // must have one two-component tuple per file (offset to pixel data,
+  // file size); if either does not match the number of input files,
+  // then the reader parses the files itself as usual.  Pass null
+  // pointers to restore the default behavior.
+  void SetPreParsedData(vtkDICOMMetaData *meta, vtkTypeInt64Array *offsets);
+  vtkDICOMMetaData *GetPreParsedMetaData() { return this->PreParsedMetaData; }
+  vtkTypeInt64Array *GetPreParsedOffsets() { return this->PreParsedOffsets; }
+
+  // Description:
+  // Request a reduced-resolution preview of the images (default: off).
+  // Set this to the desired size, in pixels, of the larger of the two
+  // in-plane dimensions of the output, e.g. 128 for thumbnails.  The
+  // reader chooses the smallest integer stride that brings the image
+  // within the desired resolution, and keeps only every stride'th
+  // column of every stride'th row while it decodes.  For files
+  // that are not compressed, the skipped rows are never read from disk
+  // and the skipped pixels are never unpacked, so a thumbnail touches
+  // only a small fraction of the pixel data.  Compressed frames are
+  // decoded at full resolution and then decimated, unless a reduced
+  // resolution decoder has been registered with vtkDICOMImageCodec.
+  // The extent reported by the pipeline shrinks accordingly, and the
+  // pixel spacing grows by the stride so that the preview occupies
+  // the same physical space as the full-resolution image.  Set the
+  // resolution to zero to read at full resolution again.
+  void SetDesiredResolution(int resolution);
+  int GetDesiredResolution() { return this->DesiredResolution; }
+
+  // Description:
+  // Get the row and column stride used for the desired resolution.
+  // This is computed during UpdateInformation(), and it will be 1
+  // unless a desired resolution has been set.
+  int GetResolutionStride() { return this->ResolutionStride; }
+
+  // Description:
+  // Unpack Siemens mosaic files into separate slices (default: Off).
+  // Siemens fMRI and diffusion files often pack a rectangular grid of
+  // slices into each stored image (these files have "MOSAIC" in their
+  // ImageType).  When this option is on, such files are detected via
+  // the Siemens private attributes, and each tile of the grid becomes
+  // one slice of the output volume, with the extent, slice spacing,
+  // and patient matrix adjusted to match.  The tiles are unpacked
+  // while each file is read (and by the worker threads, if
+  // ParallelDecoding is on), so no post-pass over the volume or extra
+  // full-volume copy is needed.  Mosaics are not unpacked when a
+  // reduced-resolution preview has been requested, or when the time
+  // dimension is read as scalar components.
+  vtkGetMacro(Demosaic, int);
+  vtkSetMacro(Demosaic, int);
+  vtkBooleanMacro(Demosaic, int);
+
+  // Description:
+  // Get the number of tiles per mosaic, or zero for non-mosaic data.
+  // This is computed during UpdateInformation(), and it is only ever
+  // nonzero if the Demosaic option is on.
+  vtkGetMacro(MosaicSize, int);
+
 protected:
   vtkDICOMReader();
   ~vtkDICOMReader();
@@ -220,12 +507,32 @@ protected:
   void UnpackBits(
     const void *source, void *buffer, vtkIdType bufferSize, int bits);
 
+  // Description:
+  // Unpack a strided subset of the packed values, for previews.
+  // This unpacks "count" values, starting at index "first" within the
+  // packed source data and advancing by "stride" values each time, so
+  // that the packed bytes in between are never touched.
+  void UnpackBits(
+    const void *source, void *buffer, int bits,
+    vtkIdType first, vtkIdType count, vtkIdType stride);
+
   // Description:
   // Read an DICOM file directly.
   virtual bool ReadFileNative(
     const char *filename, int idx,
     unsigned char *buffer, vtkIdType bufferSize);
 
+  // Description:
+  // Read a sorted list of frames from an uncompressed DICOM file,
+  // packing them tightly into the buffer in list order.  Contiguous
+  // runs within the list are read with single read calls and the
+  // frames in between are skipped by seeking, so that satisfying a
+  // partial update extent, or reading one stack of an interleaved
+  // multi-stack file, never realizes the whole PixelData in memory.
+  virtual bool ReadFrameListNative(
+    const char *filename, int idx, unsigned char *buffer,
+    const int *frameList, int listLength, vtkIdType frameSize);
+
   // Description:
   // Read a DICOM file via DCMTK or GDCM.
   virtual bool ReadFileDelegated(
@@ -233,9 +540,22 @@ protected:
     unsigned char *buffer, vtkIdType bufferSize);
 
   // Description:
-  // Rescale the data in the buffer.
+  // Read all of the requested frames of one file of the update extent.
+  // This contains the per-file work that is done once per file when
+  // reading sequentially, or by each worker thread when the
+  // ParallelDecoding option is turned on.
+  virtual bool ReadOneFileForUpdate(
+    vtkDICOMReaderFileInfo *file, vtkDICOMReaderUpdateInfo *info);
+
+  // Description:
+  // Rescale the data in the buffer.  The second signature optionally
+  // byte-swaps the data in the same pass, so that data stored with the
+  // opposite endianness does not have to be swept over twice.
   virtual void RescaleBuffer(
     int fileIdx, int frameIdx, void *buffer, vtkIdType bufferSize);
+  void RescaleBuffer(
+    int fileIdx, int frameIdx, void *buffer, vtkIdType bufferSize,
+    bool swapBytes);
 
   // Description:
   // Convert buffer from YUV to RGB.
@@ -269,6 +589,58 @@ protected:
   // Select whether to sort the files.
   int Sorting;
 
+  // Description:
+  // Select whether to decode the files with multiple threads.
+  int ParallelDecoding;
+  int NumberOfDecodingThreads;
+  int NUMAFirstTouch;
+
+  // Description:
+  // Select whether to read ahead with background I/O threads.
+  int Prefetching;
+
+  // Description:
+  // Select whether to decode the slices of interest first.
+  int ProgressiveLoading;
+  int PrioritySlice;
+
+  // Description:
+  // The cache of recently decoded slices.
+  int SliceCaching;
+  int SliceCacheSize;
+  vtkDICOMReaderSliceCache *SliceCache;
+
+  // Description:
+  // The scalar range and histogram accumulated during decoding.
+  int ComputeScalarRange;
+  double DecodedScalarRange[2];
+  vtkTypeInt64Array *DecodedHistogram;
+  double DecodedHistogramBinWidth;
+  double DecodedHistogramOrigin;
+
+  // Description:
+  // A caller-provided buffer to receive the pixel data.
+  void *OutputMemory;
+  vtkIdType OutputMemorySize;
+
+  // Description:
+  // The component interleave for joint multi-series assembly.
+  int OutputComponentOffset;
+  int OutputTotalComponents;
+
+  // Description:
+  // Whether to back the output with a memory-mapped scratch file.
+  int FileBackedOutput;
+  char *ScratchDirectory;
+
+  // Description:
+  // Whether to request large pages for the output buffer.
+  int HugePages;
+
+  // Description:
+  // The I/O scheduling priority for reads done by this reader.
+  int IOPriority;
+
   // Description:
   // Information for rescaling data to quantitative units.
   double RescaleIntercept;
@@ -284,7 +656,10 @@ protected:
 
   // Description:
   // The MedicalImageProperties, for compatibility with other readers.
+  // The properties are built lazily, on the first call to the Get
+  // method after the meta data has changed.
   vtkMedicalImageProperties *MedicalImageProperties;
+  bool MedicalImagePropertiesUpToDate;
 
   // Description:
   // The parser that is used to read the file.
@@ -298,6 +673,15 @@ protected:
   // The offsets to the pixel data in each file.
   vtkTypeInt64Array *FileOffsetArray;
 
+  // Description:
+  // The byte ranges of the data sets, if the input is a series bundle.
+  vtkTypeInt64Array *BundleIndex;
+
+  // Description:
+  // Metadata and pixel data offsets supplied by SetPreParsedData().
+  vtkDICOMMetaData *PreParsedMetaData;
+  vtkTypeInt64Array *PreParsedOffsets;
+
   // Description:
   // An array to convert slice indices to input files
   vtkIntArray *FileIndexArray;
@@ -314,6 +698,17 @@ protected:
   // The row order to use when storing the data in memory.
   int MemoryRowOrder;
 
+  // Description:
+  // The requested preview resolution, and the stride chosen for it.
+  int DesiredResolution;
+  int ResolutionStride;
+
+  // Description:
+  // The number of tiles per mosaic and the size of the tile grid.
+  int Demosaic;
+  int MosaicSize;
+  int MosaicGrid;
+
   // Description:
   // This indicates that the data must be rescaled.
   int NeedsRescale;
@@ -344,6 +739,9 @@ protected:
   // The stack to load.
   char DesiredStackID[20];
 
+  // used to call ReadOneFileForUpdate from the worker threads
+  friend class vtkDICOMReaderUpdateFriendship;
+
 private:
   vtkDICOMReader(const vtkDICOMReader&);  // Not implemented.
   void operator=(const vtkDICOMReader&);  // Not implemented.
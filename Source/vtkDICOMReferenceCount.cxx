@@ -30,3 +30,12 @@ unsigned int vtkDICOMReferenceCount::operator++()
     InterlockedIncrement(reinterpret_cast<LONG *>(&this->Counter)));
 }
 #endif
+
+#if defined(_WIN32)
+unsigned int vtkDICOMReferenceCount::operator+=(unsigned int x)
+{
+  // InterlockedExchangeAdd returns the previous value of the counter
+  return static_cast<unsigned int>(InterlockedExchangeAdd(
+    reinterpret_cast<LONG *>(&this->Counter), static_cast<LONG>(x))) + x;
+}
+#endif
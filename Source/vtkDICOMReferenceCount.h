@@ -17,11 +17,22 @@
 #include <vtkSystemIncludes.h>
 #include "vtkDICOMModule.h" // For export macro
 
+// The __sync builtins have been provided by gcc since version 4.1,
+// and by clang, so use them even if the build system did not check
+// for them and define VTK_HAVE_SYNC_BUILTINS itself.
+#if !defined(VTK_HAVE_SYNC_BUILTINS) && defined(__GNUC__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+#define VTK_HAVE_SYNC_BUILTINS
+#endif
+
 //! An object for holding an atomic reference count.
 /*!
  *  The vtkDICOMValue class is a reference-counted container.
  *  In order to safely access values from multiple threads, all
  *  operations that modify the reference count must be atomic.
+ *  The count is atomic on Windows and on any compiler that has the
+ *  __sync builtins, which is what allows values to be shared between
+ *  the data sets of concurrent threads without any locking.
  */
 class VTKDICOM_EXPORT vtkDICOMReferenceCount
 {
@@ -31,6 +42,7 @@ public:
 
   unsigned int operator--();
   unsigned int operator++();
+  unsigned int operator+=(unsigned int x);
 
   bool operator==(unsigned int x) const {
     return this->Counter == x; }
@@ -63,5 +75,16 @@ inline unsigned int vtkDICOMReferenceCount::operator++()
 }
 #endif
 
+#if !defined(_WIN32)
+inline unsigned int vtkDICOMReferenceCount::operator+=(unsigned int x)
+{
+#if defined(VTK_HAVE_SYNC_BUILTINS)
+  return __sync_add_and_fetch(&this->Counter, x);
+#else
+  return (this->Counter += x);
+#endif
+}
+#endif
+
 #endif /* vtkDICOMReferenceCount_h */
 // VTK-HeaderTest-Exclude: vtkDICOMReferenceCount.h
@@ -87,6 +87,27 @@ public:
     return this->V.GetSequenceData(); }
   //@}
 
+  //@{
+  //! A pointer-based iterator for the items of a sequence.
+  typedef const vtkDICOMItem *ConstIterator;
+
+  //! Get an iterator for the start of the item array.
+  /*!
+   *  The items of a sequence are stored contiguously, so the iterator
+   *  is simply a pointer into the sequence: advancing it does not copy
+   *  any items or modify any reference counts.  The lowercase naming
+   *  allows a sequence to be traversed with a C++11 range-based for
+   *  loop.  The iterators are invalidated if the sequence is modified.
+   */
+  ConstIterator begin() const {
+    return this->V.GetSequenceData(); }
+
+  //! Get an iterator for the end of the item array.
+  ConstIterator end() const {
+    const vtkDICOMItem *ptr = this->V.GetSequenceData();
+    return (ptr ? ptr + this->V.GetNumberOfValues() : 0); }
+  //@}
+
   //@{
   //! Copy constructor.
   vtkDICOMSequence(const vtkDICOMSequence& o) : V(o.V) {}
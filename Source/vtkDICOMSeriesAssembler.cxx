@@ -0,0 +1,384 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMSeriesAssembler.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMReader.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkDataArray.h>
+#include <vtkExecutive.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkMatrix4x4.h>
+#include <vtkMultiThreader.h>
+#include <vtkPointData.h>
+#include <vtkSimpleCriticalSection.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkStringArray.h>
+
+#include <math.h>
+
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMSeriesAssembler);
+
+//----------------------------------------------------------------------------
+// one added series: its file list, its reader, and the component
+// stride of the shared volume that it decodes into
+struct vtkDICOMSeriesAssemblerSeries
+{
+  vtkStringArray *FileNames;
+  vtkDICOMReader *Reader;
+  int ComponentOffset;
+  int NumberOfComponents;
+};
+
+class vtkDICOMSeriesAssemblerInternals
+{
+public:
+  std::vector<vtkDICOMSeriesAssemblerSeries> Series;
+};
+
+//----------------------------------------------------------------------------
+// this friendship class allows the worker threads to call the
+// protected methods of the assembler
+class vtkDICOMSeriesAssemblerFriendship
+{
+public:
+  static vtkIdType ClaimSeries(vtkDICOMSeriesAssembler *self)
+    {
+    return self->ClaimSeries();
+    }
+
+  static bool AssembleSeries(vtkDICOMSeriesAssembler *self, vtkIdType i)
+    {
+    return self->AssembleSeries(i);
+    }
+};
+
+//----------------------------------------------------------------------------
+// the method that is executed by each of the worker threads
+static VTK_THREAD_RETURN_TYPE vtkDICOMSeriesAssemblerThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMSeriesAssembler *self =
+    static_cast<vtkDICOMSeriesAssembler *>(ti->UserData);
+
+  for (;;)
+    {
+    vtkIdType i = vtkDICOMSeriesAssemblerFriendship::ClaimSeries(self);
+    if (i < 0)
+      {
+      break;
+      }
+    vtkDICOMSeriesAssemblerFriendship::AssembleSeries(self, i);
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMSeriesAssembler::vtkDICOMSeriesAssembler()
+{
+  this->Internals = new vtkDICOMSeriesAssemblerInternals;
+  this->Threader = vtkMultiThreader::New();
+  this->Lock = new vtkSimpleCriticalSection;
+  this->Output = 0;
+  this->PatientMatrix = vtkMatrix4x4::New();
+  this->NumberOfThreads = 4;
+  this->Tolerance = 1e-3;
+  this->NextIndex = 0;
+  this->FailedCount = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMSeriesAssembler::~vtkDICOMSeriesAssembler()
+{
+  this->RemoveAllSeries();
+  delete this->Internals;
+  this->Threader->Delete();
+  delete this->Lock;
+  if (this->Output)
+    {
+    this->Output->Delete();
+    }
+  this->PatientMatrix->Delete();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesAssembler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "Tolerance: " << this->Tolerance << "\n";
+  os << indent << "NumberOfSeries: "
+     << this->Internals->Series.size() << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMSeriesAssembler::AddSeries(vtkStringArray *fileNames)
+{
+  vtkDICOMSeriesAssemblerSeries series;
+  series.FileNames = fileNames;
+  series.Reader = 0;
+  series.ComponentOffset = 0;
+  series.NumberOfComponents = 0;
+  fileNames->Register(this);
+  this->Internals->Series.push_back(series);
+  return static_cast<vtkIdType>(this->Internals->Series.size() - 1);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesAssembler::RemoveAllSeries()
+{
+  std::vector<vtkDICOMSeriesAssemblerSeries>& series =
+    this->Internals->Series;
+  for (size_t i = 0; i < series.size(); i++)
+    {
+    series[i].FileNames->Delete();
+    if (series[i].Reader)
+      {
+      series[i].Reader->Delete();
+      }
+    }
+  series.clear();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMSeriesAssembler::GetNumberOfSeries()
+{
+  return static_cast<vtkIdType>(this->Internals->Series.size());
+}
+
+//----------------------------------------------------------------------------
+vtkImageData *vtkDICOMSeriesAssembler::GetOutput()
+{
+  return this->Output;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMMetaData *vtkDICOMSeriesAssembler::GetMetaDataForSeries(vtkIdType i)
+{
+  std::vector<vtkDICOMSeriesAssemblerSeries>& series =
+    this->Internals->Series;
+  if (i < 0 || static_cast<size_t>(i) >= series.size() ||
+      series[i].Reader == 0)
+    {
+    return 0;
+    }
+  return series[i].Reader->GetMetaData();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMSeriesAssembler::GetComponentOffsetForSeries(vtkIdType i)
+{
+  std::vector<vtkDICOMSeriesAssemblerSeries>& series =
+    this->Internals->Series;
+  if (i < 0 || static_cast<size_t>(i) >= series.size())
+    {
+    return 0;
+    }
+  return series[i].ComponentOffset;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMSeriesAssembler::PrepareVolume()
+{
+  std::vector<vtkDICOMSeriesAssemblerSeries>& series =
+    this->Internals->Series;
+
+  // read the headers of every series, and check that the geometry of
+  // each one matches the geometry of the first
+  int extent[6] = { 0, 0, 0, 0, 0, 0 };
+  double spacing[3] = { 1.0, 1.0, 1.0 };
+  double origin[3] = { 0.0, 0.0, 0.0 };
+  int scalarType = 0;
+  int totalComp = 0;
+
+  for (size_t i = 0; i < series.size(); i++)
+    {
+    vtkDICOMReader *reader = series[i].Reader;
+    if (reader == 0)
+      {
+      reader = vtkDICOMReader::New();
+      series[i].Reader = reader;
+      }
+    reader->SetFileNames(series[i].FileNames);
+    reader->UpdateInformation();
+    if (reader->GetErrorCode() != 0)
+      {
+      vtkErrorMacro("Unable to read the header of series " << i << ".");
+      return false;
+      }
+    vtkInformation *info =
+      reader->GetExecutive()->GetOutputInformation(0);
+
+    if (i == 0)
+      {
+      info->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+      info->Get(vtkDataObject::SPACING(), spacing);
+      info->Get(vtkDataObject::ORIGIN(), origin);
+      scalarType = reader->GetDataScalarType();
+      this->PatientMatrix->DeepCopy(reader->GetPatientMatrix());
+      }
+    else
+      {
+      int e[6];
+      double s[3];
+      double o[3];
+      info->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), e);
+      info->Get(vtkDataObject::SPACING(), s);
+      info->Get(vtkDataObject::ORIGIN(), o);
+      bool match = (reader->GetDataScalarType() == scalarType);
+      for (int j = 0; j < 6 && match; j++)
+        {
+        match = (e[j] == extent[j]);
+        }
+      for (int j = 0; j < 3 && match; j++)
+        {
+        match = (fabs(s[j] - spacing[j]) <= this->Tolerance &&
+                 fabs(o[j] - origin[j]) <= this->Tolerance);
+        }
+      vtkMatrix4x4 *m = reader->GetPatientMatrix();
+      for (int j = 0; j < 16 && match; j++)
+        {
+        match = (fabs(m->GetElement(j / 4, j % 4) -
+                      this->PatientMatrix->GetElement(j / 4, j % 4))
+                 <= this->Tolerance);
+        }
+      if (!match)
+        {
+        vtkErrorMacro("The geometry of series " << i << " does not match"
+                      " the geometry of the first series.");
+        return false;
+        }
+      }
+
+    series[i].ComponentOffset = totalComp;
+    series[i].NumberOfComponents = reader->GetNumberOfScalarComponents();
+    totalComp += series[i].NumberOfComponents;
+    }
+
+  // allocate one volume that is wide enough for every series
+  vtkIdType numVoxels = (extent[1] - extent[0] + 1);
+  numVoxels *= (extent[3] - extent[2] + 1);
+  numVoxels *= (extent[5] - extent[4] + 1);
+
+  if (this->Output)
+    {
+    this->Output->Delete();
+    }
+  this->Output = vtkImageData::New();
+  this->Output->SetExtent(extent);
+  this->Output->SetSpacing(spacing);
+  this->Output->SetOrigin(origin);
+
+  vtkDataArray *scalars = vtkDataArray::CreateDataArray(scalarType);
+  scalars->SetNumberOfComponents(totalComp);
+  scalars->SetNumberOfTuples(numVoxels);
+  scalars->SetName("PixelData");
+  this->Output->GetPointData()->SetScalars(scalars);
+  scalars->Delete();
+
+  // point every reader at its own component stride of the volume
+  vtkIdType numBytes = numVoxels;
+  numBytes *= totalComp;
+  numBytes *= vtkDataArray::GetDataTypeSize(scalarType);
+  void *ptr = scalars->GetVoidPointer(0);
+  for (size_t i = 0; i < series.size(); i++)
+    {
+    series[i].Reader->SetOutputMemory(ptr, numBytes);
+    series[i].Reader->SetOutputComponentInterleave(
+      series[i].ComponentOffset, totalComp);
+    }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMSeriesAssembler::Assemble()
+{
+  std::vector<vtkDICOMSeriesAssemblerSeries>& series =
+    this->Internals->Series;
+
+  if (series.empty())
+    {
+    vtkErrorMacro("No series have been added.");
+    return false;
+    }
+
+  if (!this->PrepareVolume())
+    {
+    return false;
+    }
+
+  this->NextIndex = 0;
+  this->FailedCount = 0;
+
+  // decode all of the series in parallel, each one writes its own
+  // disjoint bytes of the shared volume
+  int n = this->NumberOfThreads;
+  n = (n > 0 ? n : 1);
+  if (static_cast<size_t>(n) > series.size())
+    {
+    n = static_cast<int>(series.size());
+    }
+  this->Threader->SetNumberOfThreads(n);
+  this->Threader->SetSingleMethod(&vtkDICOMSeriesAssemblerThread, this);
+  this->Threader->SingleMethodExecute();
+
+  if (this->FailedCount != 0)
+    {
+    vtkErrorMacro("Unable to read " << this->FailedCount
+                  << " of the series.");
+    return false;
+    }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMSeriesAssembler::ClaimSeries()
+{
+  vtkIdType n = static_cast<vtkIdType>(this->Internals->Series.size());
+  vtkIdType idx = -1;
+
+  this->Lock->Lock();
+  if (this->NextIndex < n)
+    {
+    idx = this->NextIndex++;
+    }
+  this->Lock->Unlock();
+
+  return idx;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMSeriesAssembler::AssembleSeries(vtkIdType i)
+{
+  vtkDICOMReader *reader = this->Internals->Series[i].Reader;
+  reader->Update();
+
+  bool success = (reader->GetErrorCode() == 0);
+  if (!success)
+    {
+    this->Lock->Lock();
+    this->FailedCount++;
+    this->Lock->Unlock();
+    }
+
+  return success;
+}
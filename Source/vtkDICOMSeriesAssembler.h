@@ -0,0 +1,151 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMSeriesAssembler_h
+#define vtkDICOMSeriesAssembler_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkStringArray;
+class vtkImageData;
+class vtkMatrix4x4;
+class vtkMultiThreader;
+class vtkSimpleCriticalSection;
+class vtkDICOMMetaData;
+class vtkDICOMSeriesAssemblerInternals;
+class vtkDICOMSeriesAssemblerFriendship;
+
+//! Assemble several series into one multi-component volume.
+/*!
+ *  Acquisitions such as multi-echo MR arrive as separate series that
+ *  share a common geometry and differ only in one parameter.  Loading
+ *  them with one reader per series and then concatenating the results
+ *  costs an extra full copy of the data and serializes the decoding.
+ *  This class accepts the sorted file lists of several series, checks
+ *  that their geometry is consistent, and then decodes all of them in
+ *  parallel directly into a single multi-component vtkImageData, with
+ *  each series writing its own component stride of the shared buffer,
+ *  so that no concatenation pass is needed.
+ */
+class VTKDICOM_EXPORT vtkDICOMSeriesAssembler : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMSeriesAssembler *New();
+  vtkTypeMacro(vtkDICOMSeriesAssembler, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //@{
+  //! Add a series, given its sorted list of files.
+  /*!
+   *  The value that is returned identifies the series in the other
+   *  methods of this class.  The components of the assembled volume
+   *  follow the order in which the series were added.  The file name
+   *  array must not be modified until the volume has been assembled.
+   */
+  vtkIdType AddSeries(vtkStringArray *fileNames);
+
+  //! Remove all of the series, and release the readers.
+  void RemoveAllSeries();
+
+  //! The number of series that have been added.
+  vtkIdType GetNumberOfSeries();
+  //@}
+
+  //@{
+  //! The number of worker threads to use (default: four).
+  vtkSetMacro(NumberOfThreads, int);
+  int GetNumberOfThreads() { return this->NumberOfThreads; }
+  //@}
+
+  //@{
+  //! The tolerance for the geometry checks (default: 0.001).
+  /*!
+   *  The spacing, origin, and orientation of every series must match
+   *  those of the first series to within this tolerance, and the
+   *  extents and scalar types must match exactly.
+   */
+  vtkSetMacro(Tolerance, double);
+  vtkGetMacro(Tolerance, double);
+  //@}
+
+  //@{
+  //! Assemble the added series into one volume.
+  /*!
+   *  This checks the geometry of the series against each other, then
+   *  decodes all of them in parallel into the shared output volume,
+   *  and blocks until the decoding is done.  It returns false if the
+   *  geometry is inconsistent or if any of the series could not be
+   *  read.
+   */
+  bool Assemble();
+
+  //! The assembled volume (only valid after Assemble() succeeds).
+  vtkImageData *GetOutput();
+
+  //! The patient matrix of the assembled volume.
+  vtkMatrix4x4 *GetPatientMatrix() { return this->PatientMatrix; }
+  //@}
+
+  //@{
+  //! Get the meta data of one of the assembled series.
+  /*!
+   *  This is only valid after Assemble(), and only until the series
+   *  are removed.
+   */
+  vtkDICOMMetaData *GetMetaDataForSeries(vtkIdType i);
+
+  //! Get the first output component that a series was decoded into.
+  /*!
+   *  A series with more than one component per pixel occupies this
+   *  component and the ones that follow it.
+   */
+  int GetComponentOffsetForSeries(vtkIdType i);
+  //@}
+
+protected:
+  vtkDICOMSeriesAssembler();
+  ~vtkDICOMSeriesAssembler();
+
+  //! Check the series geometry and allocate the shared volume.
+  bool PrepareVolume();
+
+  //! Claim the next series to decode, or a negative value if none remain.
+  vtkIdType ClaimSeries();
+
+  //! Decode one series into its component stride of the shared volume.
+  bool AssembleSeries(vtkIdType i);
+
+  vtkDICOMSeriesAssemblerInternals *Internals;
+  vtkMultiThreader *Threader;
+  vtkSimpleCriticalSection *Lock;
+  vtkImageData *Output;
+  vtkMatrix4x4 *PatientMatrix;
+  int NumberOfThreads;
+  double Tolerance;
+  vtkIdType NextIndex;   // guarded by Lock
+  vtkIdType FailedCount; // guarded by Lock
+
+private:
+  friend class vtkDICOMSeriesAssemblerFriendship;
+
+  vtkDICOMSeriesAssembler(const vtkDICOMSeriesAssembler&);  // Not implemented.
+  void operator=(const vtkDICOMSeriesAssembler&);  // Not implemented.
+};
+
+#endif // vtkDICOMSeriesAssembler_h
@@ -0,0 +1,445 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMSeriesPrefetcher.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMReader.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkMultiThreader.h>
+#include <vtkSimpleCriticalSection.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+vtkStandardNewMacro(vtkDICOMSeriesPrefetcher);
+
+//----------------------------------------------------------------------------
+namespace {
+
+// sleep briefly while waiting for a series to be queued
+void vtkDICOMSeriesPrefetcherSleep()
+{
+#ifdef _WIN32
+  Sleep(1);
+#else
+  struct timespec ts = { 0, 1000000 }; // one millisecond
+  nanosleep(&ts, 0);
+#endif
+}
+
+// everything that is known about one queued series
+struct vtkDICOMSeriesPrefetcherTicket
+{
+  vtkSmartPointer<vtkStringArray> Files;
+  int Level;
+  int Status;
+  vtkSmartPointer<vtkDICOMMetaData> Meta;
+  vtkSmartPointer<vtkTypeInt64Array> Offsets;
+  vtkSmartPointer<vtkDICOMReader> Reader;
+};
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// the tickets (indexed by the series identifier) and the queue order,
+// both guarded by the prefetcher's lock
+class vtkDICOMSeriesPrefetcherInternals
+{
+public:
+  std::vector<vtkDICOMSeriesPrefetcherTicket> Tickets;
+  std::deque<vtkIdType> Queue;
+};
+
+//----------------------------------------------------------------------------
+// this friendship class allows the worker thread to call the protected
+// methods of the prefetcher
+class vtkDICOMSeriesPrefetcherFriendship
+{
+public:
+  static vtkIdType ClaimSeries(vtkDICOMSeriesPrefetcher *self)
+    {
+    return self->ClaimSeries();
+    }
+
+  static void WarmSeries(vtkDICOMSeriesPrefetcher *self, vtkIdType id)
+    {
+    self->WarmSeries(id);
+    }
+};
+
+//----------------------------------------------------------------------------
+// the method that is executed by the worker thread
+static VTK_THREAD_RETURN_TYPE vtkDICOMSeriesPrefetcherThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMSeriesPrefetcher *self =
+    static_cast<vtkDICOMSeriesPrefetcher *>(ti->UserData);
+
+  while (*(ti->ActiveFlag))
+    {
+    vtkIdType id = vtkDICOMSeriesPrefetcherFriendship::ClaimSeries(self);
+    if (id < 0)
+      {
+      // the queue is empty, wait for a series to be queued
+      vtkDICOMSeriesPrefetcherSleep();
+      }
+    else
+      {
+      vtkDICOMSeriesPrefetcherFriendship::WarmSeries(self, id);
+      }
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMSeriesPrefetcher::vtkDICOMSeriesPrefetcher()
+{
+  this->Internals = new vtkDICOMSeriesPrefetcherInternals;
+  this->Threader = vtkMultiThreader::New();
+  this->Lock = new vtkSimpleCriticalSection;
+  this->ThreadId = -1;
+  this->ThreadActive = false;
+  this->Stopping = false;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMSeriesPrefetcher::~vtkDICOMSeriesPrefetcher()
+{
+  this->Stop();
+
+  this->Threader->Delete();
+  delete this->Lock;
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  this->Lock->Lock();
+  os << indent << "NumberOfQueuedSeries: "
+     << this->Internals->Queue.size() << "\n";
+  this->Lock->Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMSeriesPrefetcher::QueueSeries(
+  vtkStringArray *fileNames, int level)
+{
+  if (fileNames == 0 || fileNames->GetNumberOfValues() == 0)
+    {
+    return -1;
+    }
+
+  vtkDICOMSeriesPrefetcherTicket t;
+  t.Files = fileNames;
+  t.Level = level;
+  t.Status = vtkDICOMSeriesPrefetcher::Queued;
+
+  this->Lock->Lock();
+  vtkIdType id = static_cast<vtkIdType>(this->Internals->Tickets.size());
+  this->Internals->Tickets.push_back(t);
+  this->Internals->Queue.push_back(id);
+  this->Lock->Unlock();
+
+  return id;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::PromoteSeries(vtkIdType id)
+{
+  this->Lock->Lock();
+  std::deque<vtkIdType>& queue = this->Internals->Queue;
+  for (size_t i = 0; i < queue.size(); i++)
+    {
+    if (queue[i] == id)
+      {
+      queue.erase(queue.begin() + i);
+      queue.push_front(id);
+      break;
+      }
+    }
+  this->Lock->Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMSeriesPrefetcher::GetSeriesStatus(vtkIdType id)
+{
+  int status = -1;
+
+  this->Lock->Lock();
+  if (id >= 0 &&
+      id < static_cast<vtkIdType>(this->Internals->Tickets.size()))
+    {
+    const vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+    if (t.Files != 0)
+      {
+      status = t.Status;
+      }
+    }
+  this->Lock->Unlock();
+
+  return status;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::ReleaseSeries(vtkIdType id)
+{
+  this->Lock->Lock();
+  if (id >= 0 &&
+      id < static_cast<vtkIdType>(this->Internals->Tickets.size()))
+    {
+    vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+    t.Files = 0;
+    t.Meta = 0;
+    t.Offsets = 0;
+    t.Reader = 0;
+    }
+  this->Lock->Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMMetaData *vtkDICOMSeriesPrefetcher::GetMetaDataForSeries(vtkIdType id)
+{
+  vtkDICOMMetaData *meta = 0;
+
+  this->Lock->Lock();
+  if (id >= 0 &&
+      id < static_cast<vtkIdType>(this->Internals->Tickets.size()))
+    {
+    const vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+    if (t.Status == vtkDICOMSeriesPrefetcher::Warm)
+      {
+      meta = t.Meta;
+      }
+    }
+  this->Lock->Unlock();
+
+  return meta;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64Array *vtkDICOMSeriesPrefetcher::GetFileOffsetsForSeries(
+  vtkIdType id)
+{
+  vtkTypeInt64Array *offsets = 0;
+
+  this->Lock->Lock();
+  if (id >= 0 &&
+      id < static_cast<vtkIdType>(this->Internals->Tickets.size()))
+    {
+    const vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+    if (t.Status == vtkDICOMSeriesPrefetcher::Warm)
+      {
+      offsets = t.Offsets;
+      }
+    }
+  this->Lock->Unlock();
+
+  return offsets;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMReader *vtkDICOMSeriesPrefetcher::GetReaderForSeries(vtkIdType id)
+{
+  vtkDICOMReader *reader = 0;
+
+  this->Lock->Lock();
+  if (id >= 0 &&
+      id < static_cast<vtkIdType>(this->Internals->Tickets.size()))
+    {
+    const vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+    if (t.Status == vtkDICOMSeriesPrefetcher::Warm)
+      {
+      reader = t.Reader;
+      }
+    }
+  this->Lock->Unlock();
+
+  return reader;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::Start()
+{
+  this->Stop();
+
+  this->Stopping = false;
+  this->ThreadId = this->Threader->SpawnThread(
+    &vtkDICOMSeriesPrefetcherThread, this);
+  this->ThreadActive = true;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::Stop()
+{
+  if (this->ThreadActive)
+    {
+    // ask the worker to abandon the series it is warming, so that
+    // TerminateThread() does not have to wait for a long decode
+    this->Lock->Lock();
+    this->Stopping = true;
+    this->Lock->Unlock();
+
+    this->Threader->TerminateThread(this->ThreadId);
+    this->ThreadActive = false;
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMSeriesPrefetcher::ClaimSeries()
+{
+  vtkIdType id = -1;
+
+  this->Lock->Lock();
+  std::deque<vtkIdType>& queue = this->Internals->Queue;
+  while (!queue.empty())
+    {
+    vtkIdType next = queue.front();
+    queue.pop_front();
+    vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[next];
+    // a released series has no files and is silently dropped
+    if (t.Files != 0 && t.Status == vtkDICOMSeriesPrefetcher::Queued)
+      {
+      t.Status = vtkDICOMSeriesPrefetcher::Warming;
+      id = next;
+      break;
+      }
+    }
+  this->Lock->Unlock();
+
+  return id;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMSeriesPrefetcher::WarmSeries(vtkIdType id)
+{
+  // snapshot the ticket, the results are applied at the end
+  this->Lock->Lock();
+  vtkSmartPointer<vtkStringArray> files =
+    this->Internals->Tickets[id].Files;
+  int level = this->Internals->Tickets[id].Level;
+  this->Lock->Unlock();
+
+  vtkIdType n = files->GetNumberOfValues();
+  bool good = true;
+  bool stopped = false;
+
+  // first, read the files to pull them into the page cache (this
+  // also covers the pixel data, which the parse does not touch)
+  for (vtkIdType i = 0; i < n && !stopped; i++)
+    {
+    vtkDICOMFile infile(files->GetValue(i).c_str(), vtkDICOMFile::In);
+    if (infile.GetError())
+      {
+      continue;
+      }
+    infile.SetPriority(vtkDICOMFile::PriorityBackground);
+    unsigned char buffer[65536];
+    while (!infile.EndOfFile())
+      {
+      size_t m = infile.Read(buffer, sizeof(buffer));
+      if (m == 0)
+        {
+        break;
+        }
+      }
+    infile.Close();
+
+    this->Lock->Lock();
+    stopped = this->Stopping;
+    this->Lock->Unlock();
+    }
+
+  // second, pre-parse the headers for the reader handoff
+  vtkSmartPointer<vtkDICOMMetaData> meta;
+  vtkSmartPointer<vtkTypeInt64Array> offsets;
+  if (!stopped && level >= vtkDICOMSeriesPrefetcher::MetaDataParse)
+    {
+    meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    meta->SetNumberOfInstances(static_cast<int>(n));
+    offsets = vtkSmartPointer<vtkTypeInt64Array>::New();
+    offsets->SetNumberOfComponents(2);
+    offsets->SetNumberOfTuples(n);
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser->SetMetaData(meta);
+    parser->SetIOPriority(vtkDICOMFile::PriorityBackground);
+    for (vtkIdType i = 0; i < n && good && !stopped; i++)
+      {
+      parser->SetIndex(static_cast<int>(i));
+      parser->SetFileName(files->GetValue(i).c_str());
+      parser->Update();
+      if (parser->GetErrorCode() != 0)
+        {
+        good = false;
+        break;
+        }
+      vtkTypeInt64 range[2];
+      range[0] = parser->GetFileOffset();
+      range[1] = parser->GetFileSize();
+      offsets->SetTupleValue(i, range);
+
+      this->Lock->Lock();
+      stopped = this->Stopping;
+      this->Lock->Unlock();
+      }
+    }
+
+  // third, decode every slice into a reader with a warm slice cache
+  vtkSmartPointer<vtkDICOMReader> reader;
+  if (good && !stopped && level >= vtkDICOMSeriesPrefetcher::SliceDecode)
+    {
+    reader = vtkSmartPointer<vtkDICOMReader>::New();
+    reader->SetFileNames(files);
+    reader->SetPreParsedData(meta, offsets);
+    reader->SetIOPriority(vtkDICOMFile::PriorityBackground);
+    reader->SliceCachingOn();
+    reader->Update();
+    good = (reader->GetErrorCode() == 0);
+    }
+
+  this->Lock->Lock();
+  vtkDICOMSeriesPrefetcherTicket& t = this->Internals->Tickets[id];
+  if (stopped)
+    {
+    // put the series back so a restarted worker picks it up first
+    t.Status = vtkDICOMSeriesPrefetcher::Queued;
+    this->Internals->Queue.push_front(id);
+    }
+  else
+    {
+    t.Meta = meta;
+    t.Offsets = offsets;
+    t.Reader = reader;
+    t.Status = (good ? vtkDICOMSeriesPrefetcher::Warm
+                     : vtkDICOMSeriesPrefetcher::Failed);
+    }
+  this->Lock->Unlock();
+}
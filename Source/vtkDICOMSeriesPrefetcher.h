@@ -0,0 +1,164 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2015 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMSeriesPrefetcher_h
+#define vtkDICOMSeriesPrefetcher_h
+
+#include <vtkObject.h>
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkStringArray;
+class vtkTypeInt64Array;
+class vtkMultiThreader;
+class vtkSimpleCriticalSection;
+class vtkDICOMMetaData;
+class vtkDICOMReader;
+class vtkDICOMSeriesPrefetcherInternals;
+class vtkDICOMSeriesPrefetcherFriendship;
+
+//! Warm series in the background before they are opened.
+/*!
+ *  A series browser usually has a good idea of which series the user
+ *  will open next, for example the next series in the study list.
+ *  This class accepts hints in the form of series file lists (e.g.
+ *  from vtkDICOMDirectory::GetFileNamesForSeries()) and warms them on
+ *  a background thread at background I/O priority, so that when one
+ *  of the hinted series is actually opened, the reader finds warm
+ *  data instead of cold storage.
+ *
+ *  Each queued series is warmed to a requested level: FileReadAhead
+ *  reads the files to pull them into the operating system's page
+ *  cache, MetaDataParse additionally pre-parses the headers into a
+ *  metadata object and offset array that can be handed to
+ *  vtkDICOMReader::SetPreParsedData(), and SliceDecode additionally
+ *  decodes the whole series with a reader whose slice cache is
+ *  enabled, so that the first display of any slice is a cache hit.
+ *
+ *  The worker thread runs until Stop() is called, so series can be
+ *  queued at any time as the user moves through the browser.
+ */
+class VTKDICOM_EXPORT vtkDICOMSeriesPrefetcher : public vtkObject
+{
+public:
+  //@{
+  //! Static method for construction.
+  static vtkDICOMSeriesPrefetcher *New();
+  vtkTypeMacro(vtkDICOMSeriesPrefetcher, vtkObject);
+  //@}
+
+  //! Print information about this object.
+  virtual void PrintSelf(ostream& os, vtkIndent indent);
+
+  //! How thoroughly a queued series is to be warmed.
+  enum WarmLevel
+  {
+    FileReadAhead,  // pull the files into the page cache
+    MetaDataParse,  // also pre-parse the file headers
+    SliceDecode     // also decode the slices into a warm reader
+  };
+
+  //! The state of a queued series.
+  enum WarmStatus
+  {
+    Queued,   // waiting for the worker thread
+    Warming,  // being warmed right now
+    Warm,     // warmed to the requested level
+    Failed    // could not be read
+  };
+
+  //@{
+  //! Add a series to the queue, given its sorted list of files.
+  /*!
+   *  The level is one of the WarmLevel constants.  The identifier
+   *  that is returned is used to check on the series and to retrieve
+   *  the warmed results.  The file name array is registered, so the
+   *  caller does not have to keep its own reference.
+   */
+  vtkIdType QueueSeries(vtkStringArray *fileNames, int level);
+
+  //! Move a series to the front of the queue.
+  /*!
+   *  Call this when a hint becomes more likely, for example when the
+   *  user selects the series that the hint anticipated.
+   */
+  void PromoteSeries(vtkIdType id);
+
+  //! Get the WarmStatus of a series, or -1 if the id is unknown.
+  int GetSeriesStatus(vtkIdType id);
+
+  //! Discard the results of a series to reclaim its memory.
+  void ReleaseSeries(vtkIdType id);
+  //@}
+
+  //@{
+  //! Get the pre-parsed metadata of a warm series.
+  /*!
+   *  Only available at MetaDataParse level or above.  Together with
+   *  the offsets, this can be handed to a reader with
+   *  vtkDICOMReader::SetPreParsedData() so that opening the series
+   *  does not re-parse the headers.  Returns null if the series is
+   *  not warm yet, or was not warmed to that level.
+   */
+  vtkDICOMMetaData *GetMetaDataForSeries(vtkIdType id);
+  vtkTypeInt64Array *GetFileOffsetsForSeries(vtkIdType id);
+
+  //! Get the warm reader of a series, at SliceDecode level.
+  /*!
+   *  The reader has already decoded every slice of the series into
+   *  its least-recently-used slice cache, so updates for individual
+   *  slices are served from memory.  The reader belongs to the
+   *  prefetcher until the series is released; the caller should
+   *  register it if it is to be kept longer.
+   */
+  vtkDICOMReader *GetReaderForSeries(vtkIdType id);
+  //@}
+
+  //@{
+  //! Start the worker thread.
+  /*!
+   *  Series can be queued before or after the thread is started.
+   */
+  void Start();
+
+  //! Stop the worker thread, returning after it has exited.
+  /*!
+   *  The results that have already been warmed remain available.
+   */
+  void Stop();
+  //@}
+
+protected:
+  vtkDICOMSeriesPrefetcher();
+  ~vtkDICOMSeriesPrefetcher();
+
+  //! Claim the next queued series, or a negative value if none.
+  vtkIdType ClaimSeries();
+
+  //! Warm one series to its requested level.
+  void WarmSeries(vtkIdType id);
+
+  vtkDICOMSeriesPrefetcherInternals *Internals;
+  vtkMultiThreader *Threader;
+  vtkSimpleCriticalSection *Lock;
+  int ThreadId;
+  bool ThreadActive;
+  bool Stopping; // guarded by Lock
+
+private:
+  friend class vtkDICOMSeriesPrefetcherFriendship;
+
+  vtkDICOMSeriesPrefetcher(const vtkDICOMSeriesPrefetcher&); // Not implemented.
+  void operator=(const vtkDICOMSeriesPrefetcher&);  // Not implemented.
+};
+
+#endif // vtkDICOMSeriesPrefetcher_h
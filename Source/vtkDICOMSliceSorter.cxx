@@ -188,11 +188,15 @@ const vtkDICOMValue& vtkDICOMSliceSorterGetFrameAttributeValue(
   const vtkDICOMSequence& frameSeq, const vtkDICOMSequence& sharedSeq,
   unsigned int i, vtkDICOMTag stag, vtkDICOMTag vtag)
 {
-  const vtkDICOMValue& v =
-    frameSeq.GetAttributeValue(i, vtkDICOMTagPath(stag, 0, vtag));
-  if (v.IsValid())
+  // borrow a view of the item, rather than copying it
+  if (i < frameSeq.GetNumberOfItems())
     {
-    return v;
+    const vtkDICOMValue& v =
+      frameSeq.begin()[i].GetAttributeValue(vtkDICOMTagPath(stag, 0, vtag));
+    if (v.IsValid())
+      {
+      return v;
+      }
     }
   return sharedSeq.GetAttributeValue(0, vtkDICOMTagPath(stag, 0, vtag));
 }
@@ -753,18 +757,29 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
 
         if (timeSlotVector.IsValid() || sliceVector.IsValid())
           {
-          // tomographic NM
+          // tomographic NM: extract the frame vectors in one pass,
+          // rather than converting one element per loop iteration
+          std::vector<double> timeSlots(timeSlotVector.GetNumberOfValues());
+          if (timeSlots.size() > 0)
+            {
+            timeSlotVector.GetValues(&timeSlots[0], timeSlots.size());
+            }
+          std::vector<int> slices(sliceVector.GetNumberOfValues());
+          if (slices.size() > 0)
+            {
+            sliceVector.GetValues(&slices[0], slices.size());
+            }
           for (int k = 0; k < numberOfFrames; k++)
             {
             double t = 0.0;
             double frameloc = location;
-            if (k < static_cast<int>(timeSlotVector.GetNumberOfValues()))
+            if (k < static_cast<int>(timeSlots.size()))
               {
-              t = (timeSlotVector.GetDouble(k) - 1.0)*frameTimeSpacing;
+              t = (timeSlots[k] - 1.0)*frameTimeSpacing;
               }
-            if (k < static_cast<int>(sliceVector.GetNumberOfValues()))
+            if (k < static_cast<int>(slices.size()))
               {
-              position = sliceVector.GetInt(k) - 1;
+              position = slices[k] - 1;
               frameloc += position*spacingSign;
               }
             info.push_back(
@@ -773,21 +788,31 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
           }
         else
           {
-          // CINE
+          // CINE: extract the frame vectors in one pass, as above
+          std::vector<double> frameTimes(timeVector.GetNumberOfValues());
+          if (frameTimes.size() > 0)
+            {
+            timeVector.GetValues(&frameTimes[0], frameTimes.size());
+            }
+          std::vector<double> frameLocations(locationVector.GetNumberOfValues());
+          if (frameLocations.size() > 0)
+            {
+            locationVector.GetValues(&frameLocations[0], frameLocations.size());
+            }
           double t = 0.0;
           for (int k = 0; k < numberOfFrames; k++)
             {
             if (k > 0)
               {
-              if (k < static_cast<int>(timeVector.GetNumberOfValues()))
+              if (k < static_cast<int>(frameTimes.size()))
                 {
-                frameTimeSpacing = timeVector.GetDouble(k);
+                frameTimeSpacing = frameTimes[k];
                 }
               t += frameTimeSpacing;
               }
-            if (k < static_cast<int>(locationVector.GetNumberOfValues()))
+            if (k < static_cast<int>(frameLocations.size()))
               {
-              location = locationVector.GetDouble(k);
+              location = frameLocations[k];
               location /= spacingBetweenSlices;
               }
             info.push_back(
@@ -1028,6 +1053,16 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
 //----------------------------------------------------------------------------
 void vtkDICOMSliceSorter::Update()
 {
+  // only redo the sort if the meta data or a sort option has changed,
+  // computing the per-frame locations is expensive for large series
+  if (this->UpdateTime.GetMTime() > this->GetMTime() &&
+      (this->MetaData == 0 ||
+       this->UpdateTime.GetMTime() > this->MetaData->GetMTime()))
+    {
+    return;
+    }
+
   this->StackIDs->Initialize();
   this->SortFiles(this->FileIndexArray, this->FrameIndexArray);
+  this->UpdateTime.Modified();
 }
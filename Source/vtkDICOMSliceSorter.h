@@ -130,6 +130,10 @@ public:
 
   //@{
   //! Update the arrays.
+  /*!
+   *  The sort is only recomputed if the meta data or one of the sort
+   *  options has changed since the previous call to Update().
+   */
   void Update();
   //@}
 
@@ -173,6 +177,10 @@ protected:
   int ReverseSlices;
   double SliceSpacing;
 
+  // Description:
+  // The time of the most recent sort.
+  vtkTimeStamp UpdateTime;
+
 private:
   vtkDICOMSliceSorter(const vtkDICOMSliceSorter&);  // Not implemented.
   void operator=(const vtkDICOMSliceSorter&);  // Not implemented.
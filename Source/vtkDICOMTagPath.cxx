@@ -42,7 +42,9 @@ bool vtkDICOMTagPath::operator==(const vtkDICOMTagPath& b) const
           this->Index == b.Index &&
           this->Tail == b.Tail &&
           this->Index2 == b.Index2 &&
-          this->Tail2 == b.Tail2);
+          this->Tail2 == b.Tail2 &&
+          this->Index3 == b.Index3 &&
+          this->Tail3 == b.Tail3);
 }
 
 //----------------------------------------------------------------------------
@@ -62,7 +64,11 @@ bool vtkDICOMTagPath::operator<(const vtkDICOMTagPath& b) const
               (this->Tail == b.Tail &&
                (this->Index2 < b.Index2 ||
                 (this->Index2 == b.Index2 &&
-                 (this->Tail2 < b.Tail2)))))))));
+                 (this->Tail2 < b.Tail2 ||
+                  (this->Tail2 == b.Tail2 &&
+                   (this->Index3 < b.Index3 ||
+                    (this->Index3 == b.Index3 &&
+                     (this->Tail3 < b.Tail3)))))))))))));
 }
 
 //----------------------------------------------------------------------------
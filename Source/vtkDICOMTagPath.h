@@ -21,28 +21,42 @@
 //! A tag path for digging values out of sequence items.
 /*!
  *  The tag path makes it easier to access data elements that are
- *  buried within sequences.  In the interest of creating a simple
- *  and efficient implementation, it can go at most two levels deep.
+ *  buried within sequences.  The storage for the path is fixed-size
+ *  and kept within the object itself, so that constructing or copying
+ *  a path never allocates from the heap.  It can go at most three
+ *  levels deep, which is sufficient for all of the IODs defined by
+ *  the DICOM standard.
  */
 class VTKDICOM_EXPORT vtkDICOMTagPath
 {
 public:
   //@{
   //! Construct a tag path with an empty head and tail.
-  vtkDICOMTagPath() : Head(), Index(0), Tail(), Index2(0), Tail2() {}
+  vtkDICOMTagPath() : Head(), Index(0), Tail(), Index2(0), Tail2(),
+    Index3(0), Tail3() {}
 
   //! Construct a tag path from a sequence tag, item index, and item tag.
   vtkDICOMTagPath(vtkDICOMTag seqTag, unsigned int i, vtkDICOMTag tag) :
-    Head(seqTag), Index(i), Tail(tag), Index2(0), Tail2() {}
+    Head(seqTag), Index(i), Tail(tag), Index2(0), Tail2(),
+    Index3(0), Tail3() {}
 
   //! Construct a tag path that goes two levels deep.
   vtkDICOMTagPath(vtkDICOMTag seqTag, unsigned int i, vtkDICOMTag tag,
                   unsigned int j, vtkDICOMTag tag2) :
-    Head(seqTag), Index(i), Tail(tag), Index2(j), Tail2(tag2) {}
+    Head(seqTag), Index(i), Tail(tag), Index2(j), Tail2(tag2),
+    Index3(0), Tail3() {}
+
+  //! Construct a tag path that goes three levels deep.
+  vtkDICOMTagPath(vtkDICOMTag seqTag, unsigned int i, vtkDICOMTag tag,
+                  unsigned int j, vtkDICOMTag tag2,
+                  unsigned int k, vtkDICOMTag tag3) :
+    Head(seqTag), Index(i), Tail(tag), Index2(j), Tail2(tag2),
+    Index3(k), Tail3(tag3) {}
 
   //! Construct a tag path from just a single tag.
   explicit vtkDICOMTagPath(vtkDICOMTag tag) :
-    Head(tag), Index(0), Tail(), Index2(0), Tail2() {}
+    Head(tag), Index(0), Tail(), Index2(0), Tail2(),
+    Index3(0), Tail3() {}
   //@}
 
   //@{
@@ -60,7 +74,8 @@ public:
 
   //! Get the remainder of the path.
   vtkDICOMTagPath GetTail() const {
-    return vtkDICOMTagPath(this->Tail, this->Index2, this->Tail2); }
+    return vtkDICOMTagPath(this->Tail, this->Index2, this->Tail2,
+                           this->Index3, this->Tail3); }
   //@}
 
   //@{
@@ -78,6 +93,8 @@ private:
   vtkDICOMTag Tail;
   unsigned int Index2;
   vtkDICOMTag Tail2;
+  unsigned int Index3;
+  vtkDICOMTag Tail3;
 };
 
 VTKDICOM_EXPORT ostream& operator<<(ostream& o, const vtkDICOMTagPath& a);
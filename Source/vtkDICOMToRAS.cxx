@@ -16,6 +16,7 @@
 
 #include "vtkImageData.h"
 #include "vtkMatrix4x4.h"
+#include "vtkPointData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -23,6 +24,8 @@
 #include "vtkSmartPointer.h"
 #include "vtkTemplateAliasMacro.h"
 
+#include <string.h>
+
 vtkStandardNewMacro(vtkDICOMToRAS);
 vtkCxxSetObjectMacro(vtkDICOMToRAS, PatientMatrix, vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkDICOMToRAS, RASMatrix, vtkMatrix4x4);
@@ -451,6 +454,47 @@ int vtkDICOMToRAS::RequestData(
     outMatrix->DeepCopy(this->Matrix);
     }
 
+  // if no reordering of the voxels is needed, then the conversion is a
+  // pure change of metadata and the scalars can be passed through to the
+  // output without copying them
+  if (this->ReorderColumns == 0 && this->ReorderRows == 0)
+    {
+    vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+    vtkInformation *outInfo = outputVector->GetInformationObject(0);
+    vtkImageData *input =
+      vtkImageData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+    vtkImageData *output =
+      static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+    int inExt[6], outExt[6];
+    input->GetExtent(inExt);
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+
+    // the sizes will always match, but check to be safe
+    bool sameSize = true;
+    for (int i = 0; i < 3; i++)
+      {
+      sameSize &= (inExt[2*i + 1] - inExt[2*i] ==
+                   outExt[2*i + 1] - outExt[2*i]);
+      }
+
+    if (sameSize)
+      {
+      output->CopyStructure(input);
+      output->SetExtent(outExt);
+      if (outInfo->Has(vtkDataObject::SPACING()))
+        {
+        output->SetSpacing(outInfo->Get(vtkDataObject::SPACING()));
+        }
+      if (outInfo->Has(vtkDataObject::ORIGIN()))
+        {
+        output->SetOrigin(outInfo->Get(vtkDataObject::ORIGIN()));
+        }
+      output->GetPointData()->PassData(input->GetPointData());
+      return 1;
+      }
+    }
+
   return this->Superclass::RequestData(request, inputVector, outputVector);
 }
 
@@ -513,7 +557,14 @@ void vtkDICOMToRASExecute(
       progressCount++;
 
       const T *inPtrX = inPtrY;
-      if (numComponents == 1)
+      if (inIncX == numComponents)
+        {
+        // rows are not flipped, copy each row as a single block
+        size_t rowSize = static_cast<size_t>(sizeX)*numComponents;
+        memcpy(outPtr, inPtrX, rowSize*sizeof(T));
+        outPtr += rowSize;
+        }
+      else if (numComponents == 1)
         {
         for (int i = 0; i < sizeX; i++)
           {
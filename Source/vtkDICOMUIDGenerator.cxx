@@ -14,6 +14,7 @@
 #include "vtkDICOMUIDGenerator.h"
 
 #include "vtkDICOMFile.h"
+#include "vtkDICOMReferenceCount.h"
 #include "vtkDICOMUtilities.h"
 
 #include <vtkObjectFactory.h>
@@ -59,6 +60,7 @@ vtkDICOMUIDGeneratorInitializer::~vtkDICOMUIDGeneratorInitializer()
 vtkDICOMUIDGenerator::vtkDICOMUIDGenerator()
 {
   this->UIDPrefix = NULL;
+  this->DerivationKey = NULL;
 }
 
 //----------------------------------------------------------------------------
@@ -73,6 +75,9 @@ void vtkDICOMUIDGenerator::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "UIDPrefix: "
      << (this->UIDPrefix ? this->UIDPrefix : "(NULL)") << "\n";
+  // the key is a secret, so only print whether it has been set
+  os << indent << "DerivationKey: "
+     << (this->DerivationKey ? "(set)" : "(NULL)") << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -101,6 +106,27 @@ void vtkDICOMUIDGenerator::SetUIDPrefix(const char *uid)
     }
 }
 
+//----------------------------------------------------------------------------
+const char *vtkDICOMUIDGenerator::GetDerivationKey()
+{
+  return (this->DerivationKey ? this->DerivationKey : "");
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMUIDGenerator::SetDerivationKey(const char *key)
+{
+  if (key)
+    {
+    this->DerivationKey = this->DerivationKeyStore;
+    strncpy(this->DerivationKey, key, 63);
+    this->DerivationKey[63] = '\0';
+    }
+  else
+    {
+    this->DerivationKey = NULL;
+    }
+}
+
 //----------------------------------------------------------------------------
 namespace {
 
@@ -408,6 +434,120 @@ void vtkGeneratePrefixedUID(
     }
 }
 
+// rotate a 64-bit word left by b bits
+inline vtkTypeUInt64 vtkUIDHashRotate(vtkTypeUInt64 x, int b)
+{
+  return (x << b) | (x >> (64 - b));
+}
+
+// one round of the SipHash mixing function
+inline void vtkUIDHashRound(
+  vtkTypeUInt64& v0, vtkTypeUInt64& v1,
+  vtkTypeUInt64& v2, vtkTypeUInt64& v3)
+{
+  v0 += v1; v1 = vtkUIDHashRotate(v1, 13); v1 ^= v0;
+  v0 = vtkUIDHashRotate(v0, 32);
+  v2 += v3; v3 = vtkUIDHashRotate(v3, 16); v3 ^= v2;
+  v0 += v3; v3 = vtkUIDHashRotate(v3, 21); v3 ^= v0;
+  v2 += v1; v1 = vtkUIDHashRotate(v1, 17); v1 ^= v2;
+  v2 = vtkUIDHashRotate(v2, 32);
+}
+
+// compute a 128-bit keyed hash of a string (SipHash-2-4, with the
+// standard modification for producing 128 bits of output)
+void vtkComputeKeyedHash(
+  const char *key, const char *data, unsigned char digest[16])
+{
+  // fold the key string into the 128-bit hash key
+  unsigned char kb[16];
+  memset(kb, '\0', 16);
+  size_t kn = strlen(key);
+  for (size_t ki = 0; ki < kn; ki++)
+    {
+    kb[ki & 0x0f] = static_cast<unsigned char>(kb[ki & 0x0f] ^ key[ki]);
+    }
+
+  // load the two halves of the key as little-endian words
+  vtkTypeUInt64 k0 = 0;
+  vtkTypeUInt64 k1 = 0;
+  for (int kj = 7; kj >= 0; --kj)
+    {
+    k0 = (k0 << 8) | kb[kj];
+    k1 = (k1 << 8) | kb[8 + kj];
+    }
+
+  const vtkTypeUInt64 c0 =
+    (static_cast<vtkTypeUInt64>(0x736f6d65u) << 32) | 0x70736575u;
+  const vtkTypeUInt64 c1 =
+    (static_cast<vtkTypeUInt64>(0x646f7261u) << 32) | 0x6e646f6du;
+  const vtkTypeUInt64 c2 =
+    (static_cast<vtkTypeUInt64>(0x6c796765u) << 32) | 0x6e657261u;
+  const vtkTypeUInt64 c3 =
+    (static_cast<vtkTypeUInt64>(0x74656462u) << 32) | 0x79746573u;
+
+  vtkTypeUInt64 v0 = k0 ^ c0;
+  vtkTypeUInt64 v1 = k1 ^ c1 ^ 0xee; // marks the 128-bit output variant
+  vtkTypeUInt64 v2 = k0 ^ c2;
+  vtkTypeUInt64 v3 = k1 ^ c3;
+
+  // compress the data in 8-byte little-endian blocks, the final
+  // (short) block carries the data length in its high byte
+  size_t n = strlen(data);
+  const unsigned char *dp = reinterpret_cast<const unsigned char *>(data);
+  size_t i = 0;
+  for (;;)
+    {
+    vtkTypeUInt64 m = 0;
+    if (i + 8 <= n)
+      {
+      for (int j = 7; j >= 0; --j)
+        {
+        m = (m << 8) | dp[i + j];
+        }
+      }
+    else
+      {
+      for (size_t j = n - i; j > 0; --j)
+        {
+        m = (m << 8) | dp[i + j - 1];
+        }
+      m |= static_cast<vtkTypeUInt64>(n & 0xff) << 56;
+      }
+
+    v3 ^= m;
+    vtkUIDHashRound(v0, v1, v2, v3);
+    vtkUIDHashRound(v0, v1, v2, v3);
+    v0 ^= m;
+
+    if (i + 8 > n)
+      {
+      break;
+      }
+    i += 8;
+    }
+
+  // finalization, producing two 64-bit output words
+  v2 ^= 0xee;
+  for (int f = 0; f < 4; f++)
+    {
+    vtkUIDHashRound(v0, v1, v2, v3);
+    }
+  vtkTypeUInt64 h0 = v0 ^ v1 ^ v2 ^ v3;
+
+  v1 ^= 0xdd;
+  for (int f = 0; f < 4; f++)
+    {
+    vtkUIDHashRound(v0, v1, v2, v3);
+    }
+  vtkTypeUInt64 h1 = v0 ^ v1 ^ v2 ^ v3;
+
+  for (int j = 0; j < 8; j++)
+    {
+    digest[j] = static_cast<unsigned char>(h0 >> (8*j));
+    digest[8 + j] = static_cast<unsigned char>(h1 >> (8*j));
+    }
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -444,6 +584,40 @@ std::string vtkDICOMUIDGenerator::GenerateUID(vtkDICOMTag tag)
   return uid;
 }
 
+//----------------------------------------------------------------------------
+std::string vtkDICOMUIDGenerator::GenerateDerivedUID(
+  vtkDICOMTag tag, const std::string& sourceUID)
+{
+  const char *prefix = this->GetUIDPrefix();
+  char uid[64];
+
+  // in place of random bytes, use a keyed hash of the source UID so
+  // that the derivation is deterministic and draws no system entropy
+  unsigned char r[16];
+  vtkComputeKeyedHash(this->GetDerivationKey(), sourceUID.c_str(), r);
+
+  if (prefix[0] == '\0' ||
+      (prefix[0] == '2' && prefix[1] == '.' && prefix[2] == '2' &&
+       prefix[3] == '5' && (prefix[4] == '.' || prefix[4] == '\0')))
+    {
+    // convert to a hex uuid
+    char uuid[40];
+    vtkConvertRandomToUUID(r, uuid);
+
+    // convert the hex uuid into a DICOM UID with root 2.25
+    vtkConvertUUIDToUID(uuid, uid);
+    }
+  else
+    {
+    // after prefix, add a "UID type" digit followed by hash digits
+    vtkIdType m = vtkRandomBytesForPrefix(prefix);
+    char d = vtkDICOMTagToDigit(tag);
+    vtkGeneratePrefixedUID(r, m, prefix, d, uid);
+    }
+
+  return uid;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
 {
@@ -501,6 +675,91 @@ void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
   delete [] r;
 }
 
+//----------------------------------------------------------------------------
+// The process-wide counter used to reserve blocks of sequential UIDs.
+static vtkDICOMReferenceCount vtkDICOMUIDGeneratorSequence;
+
+//----------------------------------------------------------------------------
+void vtkDICOMUIDGenerator::GenerateSequentialUIDs(
+  vtkDICOMTag tag, vtkIdType n, char *uids)
+{
+  if (n <= 0)
+    {
+    return;
+    }
+
+  const char *prefix = this->GetUIDPrefix();
+  if (prefix[0] == '\0' ||
+      (prefix[0] == '2' && prefix[1] == '.' && prefix[2] == '2' &&
+       prefix[3] == '5' && (prefix[4] == '.' || prefix[4] == '\0')))
+    {
+    // sequential UIDs always take the prefixed form, so if no root
+    // was set, use "2.25" as an ordinary root for the random stem
+    prefix = "2.25";
+    }
+
+  // reserve a contiguous block of the shared counter, this atomic
+  // addition is the only synchronization between concurrent callers
+  unsigned int last = (vtkDICOMUIDGeneratorSequence +=
+                       static_cast<unsigned int>(n));
+  unsigned int first = last - static_cast<unsigned int>(n) + 1;
+
+  // choose the size of the random stem so that the prefix, the "UID
+  // type" digit, the stem, a dot, and ten digits of sequence number
+  // all fit within the 64 chars of a UID
+  size_t plen = strlen(prefix);
+  if (plen > 0 && prefix[plen-1] != '.')
+    {
+    plen++;
+    }
+  vtkIdType m = 4; // use 32 bit random number
+  if (plen + 30 <= 52)
+    {
+    m = 12; // use 96 bit random number
+    }
+  else if (plen + 21 <= 52)
+    {
+    m = 8; // use 64 bit random number
+    }
+
+  // generate one random stem for the entire block
+  unsigned char r[16];
+  vtkGenerateRandomBytes(r, m);
+  char d = vtkDICOMTagToDigit(tag);
+  char stem[64];
+  vtkGeneratePrefixedUID(r, m, prefix, d, stem);
+  size_t slen = strlen(stem);
+
+  for (vtkIdType i = 0; i < n; i++)
+    {
+    char *uid = uids + i*64;
+    memcpy(uid, stem, slen);
+    uid[slen] = '.';
+
+    // format the sequence number for this uid
+    unsigned int x = first + static_cast<unsigned int>(i);
+    char digits[12];
+    char *dp = digits + 11;
+    *dp = '\0';
+    do
+      {
+      *(--dp) = static_cast<char>('0' + x % 10);
+      x /= 10;
+      }
+    while (x != 0);
+
+    size_t j = slen + 1;
+    while (*dp != '\0' && j < 63)
+      {
+      uid[j++] = *dp++;
+      }
+    while (j < 64)
+      {
+      uid[j++] = '\0';
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMUIDGenerator::SetDefault(vtkDICOMUIDGenerator *uidgen)
 {
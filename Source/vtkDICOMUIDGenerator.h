@@ -61,6 +61,20 @@ public:
   const char *GetUIDPrefix();
   //@}
 
+  //@{
+  //! Set a key for generating deterministic hash-derived UIDs.
+  /*!
+   *  The key is mixed into the hash that GenerateDerivedUID() computes
+   *  from the source UID.  Use a key that is secret to your organization,
+   *  so that a third party cannot confirm a suspected source UID by
+   *  hashing it themselves.  Changing the key changes every derived UID.
+   */
+  void SetDerivationKey(const char *key);
+
+  //! Get the key used for hash-derived UIDs.
+  const char *GetDerivationKey();
+  //@}
+
   //@{
   //! Generate a UID for the provided tag.
   /*
@@ -79,6 +93,35 @@ public:
    *  GenerateUID() repeatedly.
    */
   virtual void GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids);
+
+  //! Generate a contiguous block of UIDs into caller-provided storage.
+  /*!
+   *  The buffer must provide 64 chars for each of the n UIDs, and
+   *  each UID will be null-terminated within its own 64-char slot.
+   *  All UIDs in the block share a random stem, followed by a sequence
+   *  number taken from a process-wide atomic counter, so the block is
+   *  reserved with a single atomic addition and concurrent callers do
+   *  not serialize against each other.  No per-UID heap allocation is
+   *  performed, and the UIDs are generated in sorted order.  The UIDs
+   *  always take the prefixed form: if no UID prefix has been set,
+   *  then "2.25" is used as an ordinary root rather than as the root
+   *  for a UUID-derived UID.
+   */
+  virtual void GenerateSequentialUIDs(vtkDICOMTag tag, vtkIdType n,
+                                      char *uids);
+
+  //! Derive a UID from an existing UID via a keyed hash.
+  /*!
+   *  Unlike GenerateUID(), this method is deterministic: the same
+   *  source UID, derivation key, and prefix always produce the same
+   *  output UID, so a de-identification job that is re-run, or that is
+   *  split into parallel shards, maps each source UID to the same
+   *  replacement every time.  No entropy is drawn from the operating
+   *  system, so no system calls are made and the cost per UID is
+   *  constant.
+   */
+  virtual std::string GenerateDerivedUID(vtkDICOMTag tag,
+                                         const std::string& sourceUID);
   //@}
 
   //@{
@@ -99,6 +142,8 @@ protected:
 
   char *UIDPrefix;
   char UIDPrefixStore[64];
+  char *DerivationKey;
+  char DerivationKeyStore[64];
   static vtkDICOMUIDGenerator *Default;
 
 private:
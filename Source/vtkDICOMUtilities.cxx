@@ -26,6 +26,13 @@
 #include <string.h>
 #include <ctype.h>
 
+// needed for the hardware CRC instructions
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 // needed for gettimeofday
 #ifndef _WIN32
 #include <time.h>
@@ -487,6 +494,73 @@ void vtkDICOMUtilities::SetImplementationVersionName(const char *name)
   vtkDICOMUtilities::ImplementationVersionName[16] = '\0';
 }
 
+//----------------------------------------------------------------------------
+unsigned int vtkDICOMUtilities::ComputeCRC32C(
+  unsigned int crc, const void *data, size_t l)
+{
+  const unsigned char *cp = static_cast<const unsigned char *>(data);
+  crc = ~crc;
+
+#if defined(__SSE4_2__)
+#if defined(__x86_64__) || defined(_M_X64)
+  while (l >= 8)
+    {
+    unsigned long long word;
+    memcpy(&word, cp, 8);
+    crc = static_cast<unsigned int>(
+      _mm_crc32_u64(crc, word));
+    cp += 8;
+    l -= 8;
+    }
+#endif
+  while (l > 0)
+    {
+    crc = _mm_crc32_u8(crc, *cp++);
+    --l;
+    }
+#elif defined(__ARM_FEATURE_CRC32)
+  while (l >= 8)
+    {
+    unsigned long long word;
+    memcpy(&word, cp, 8);
+    crc = __crc32cd(crc, word);
+    cp += 8;
+    l -= 8;
+    }
+  while (l > 0)
+    {
+    crc = __crc32cb(crc, *cp++);
+    --l;
+    }
+#else
+  // table-driven fallback: the table is filled in on first use, and
+  // since the fill is idempotent, a race between first callers on
+  // different threads is harmless
+  static unsigned int table[256];
+  static volatile bool tableReady = false;
+  if (!tableReady)
+    {
+    for (unsigned int i = 0; i < 256; i++)
+      {
+      unsigned int r = i;
+      for (int j = 0; j < 8; j++)
+        {
+        r = (r >> 1) ^ (0x82f63b78U & (0U - (r & 1)));
+        }
+      table[i] = r;
+      }
+    tableReady = true;
+    }
+  while (l > 0)
+    {
+    crc = table[(crc ^ *cp++) & 0xff] ^ (crc >> 8);
+    --l;
+    }
+#endif
+
+  return ~crc;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMUtilities::PatternMatches(
     const char *pattern, size_t pl,
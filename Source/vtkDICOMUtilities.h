@@ -161,6 +161,21 @@ public:
     cp[3] = static_cast<unsigned char>(i >> 24); }
   //@}
 
+  //@{
+  //! Fold a stream of bytes into a CRC-32C checksum.
+  /*!
+   *  Pass zero as the initial checksum, and pass the result of one
+   *  call as the initial checksum of the next call to continue the
+   *  checksum across several buffers.  The CRC-32C (Castagnoli)
+   *  polynomial is used because commodity processors can compute it
+   *  in hardware: the crc32 instructions of SSE4.2 on x86 and of the
+   *  CRC extension on ARM are used when the compiler makes them
+   *  available, with a table-driven computation as the fallback.
+   */
+  static unsigned int ComputeCRC32C(
+    unsigned int crc, const void *data, size_t l);
+  //@}
+
   //@{
   //! Return true if the pattern matches the given string (utf-8).
   /*!
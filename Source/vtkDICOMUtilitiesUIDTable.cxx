@@ -12,7 +12,7 @@ struct UIDTableEntry
   unsigned short Size;
   unsigned short First;
   unsigned short CID;
-  const char *Name;
+  unsigned short Name; // offset into UIDNameTable (zero if no name)
 };
 
 const UIDTableEntry UIDTable[] = {
@@ -32,18 +32,15 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 2374, 2, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.1
-  "Verification SOP Class" },
-{ 58, 6, 1, 0, // 1.2.840.10008.1.2
-  "Implicit VR Little Endian" },
+{ 0, 0, 0, 0, 1 }, // 1.2.840.10008.1.1
+{ 58, 6, 1, 0, 24 }, // 1.2.840.10008.1.2
 { 124, 1, 10, 0, 0 },
 { 125, 2, 1, 0, 0 },
 { 147, 4, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.9 (Retired)
-  "Basic Study Content Notification SOP Class" },
+{ 0, 0, 0, 0, 50 }, // 1.2.840.10008.1.9 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -54,8 +51,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 151, 2, 1, 0, // 1.2.840.10008.1.20 (Retired)
-  "Papyrus 3 Implicit VR Little Endian" },
+{ 151, 2, 1, 0, 93 }, // 1.2.840.10008.1.20 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -75,61 +71,37 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 155, 1, 1, 0, // 1.2.840.10008.1.40
-  "Procedural Event Logging SOP Class" },
+{ 155, 1, 1, 0, 129 }, // 1.2.840.10008.1.40
 { 0, 0, 0, 0, 0 },
-{ 156, 1, 1, 0, // 1.2.840.10008.1.42
-  "Substance Administration Logging SOP Class" },
-{ 64, 1, 99, 0, // 1.2.840.10008.1.2.1
-  "Explicit VR Little Endian" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.2 (Retired)
-  "Explicit VR Big Endian" },
+{ 156, 1, 1, 0, 164 }, // 1.2.840.10008.1.42
+{ 64, 1, 99, 0, 207 }, // 1.2.840.10008.1.2.1
+{ 0, 0, 0, 0, 233 }, // 1.2.840.10008.1.2.2 (Retired)
 { 0, 0, 0, 0, 0 },
 { 65, 57, 50, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.5
-  "RLE Lossless" },
+{ 0, 0, 0, 0, 256 }, // 1.2.840.10008.1.2.5
 { 122, 2, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.1.99
-  "Deflated Explicit VR Little Endian" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.50
-  "JPEG Baseline (Process 1)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.51
-  "JPEG Extended (Process 2 & 4)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.52 (Retired)
-  "JPEG Extended (Process 3 & 5)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.53 (Retired)
-  "JPEG Spectral Selection, Non-Hierarchical (Process 6 & 8)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.54 (Retired)
-  "JPEG Spectral Selection, Non-Hierarchical (Process 7 & 9)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.55 (Retired)
-  "JPEG Full Progression, Non-Hierarchical (Process 10 & 12)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.56 (Retired)
-  "JPEG Full Progression, Non-Hierarchical (Process 11 & 13)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.57
-  "JPEG Lossless, Non-Hierarchical (Process 14)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.58 (Retired)
-  "JPEG Lossless, Non-Hierarchical (Process 15)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.59 (Retired)
-  "JPEG Extended, Hierarchical (Process 16 & 18)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.60 (Retired)
-  "JPEG Extended, Hierarchical (Process 17 & 19)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.61 (Retired)
-  "JPEG Spectral Selection, Hierarchical (Process 20 & 22)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.62 (Retired)
-  "JPEG Spectral Selection, Hierarchical (Process 21 & 23)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.63 (Retired)
-  "JPEG Full Progression, Hierarchical (Process 24 & 26)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.64 (Retired)
-  "JPEG Full Progression, Hierarchical (Process 25 & 27)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.65 (Retired)
-  "JPEG Lossless, Hierarchical (Process 28)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.66 (Retired)
-  "JPEG Lossless, Hierarchical (Process 29)" },
+{ 0, 0, 0, 0, 269 }, // 1.2.840.10008.1.2.1.99
+{ 0, 0, 0, 0, 304 }, // 1.2.840.10008.1.2.4.50
+{ 0, 0, 0, 0, 330 }, // 1.2.840.10008.1.2.4.51
+{ 0, 0, 0, 0, 360 }, // 1.2.840.10008.1.2.4.52 (Retired)
+{ 0, 0, 0, 0, 390 }, // 1.2.840.10008.1.2.4.53 (Retired)
+{ 0, 0, 0, 0, 448 }, // 1.2.840.10008.1.2.4.54 (Retired)
+{ 0, 0, 0, 0, 506 }, // 1.2.840.10008.1.2.4.55 (Retired)
+{ 0, 0, 0, 0, 564 }, // 1.2.840.10008.1.2.4.56 (Retired)
+{ 0, 0, 0, 0, 622 }, // 1.2.840.10008.1.2.4.57
+{ 0, 0, 0, 0, 667 }, // 1.2.840.10008.1.2.4.58 (Retired)
+{ 0, 0, 0, 0, 712 }, // 1.2.840.10008.1.2.4.59 (Retired)
+{ 0, 0, 0, 0, 758 }, // 1.2.840.10008.1.2.4.60 (Retired)
+{ 0, 0, 0, 0, 804 }, // 1.2.840.10008.1.2.4.61 (Retired)
+{ 0, 0, 0, 0, 860 }, // 1.2.840.10008.1.2.4.62 (Retired)
+{ 0, 0, 0, 0, 916 }, // 1.2.840.10008.1.2.4.63 (Retired)
+{ 0, 0, 0, 0, 970 }, // 1.2.840.10008.1.2.4.64 (Retired)
+{ 0, 0, 0, 0, 1024 }, // 1.2.840.10008.1.2.4.65 (Retired)
+{ 0, 0, 0, 0, 1065 }, // 1.2.840.10008.1.2.4.66 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.70
-  "JPEG Lossless, Non-Hierarchical, First-Order Prediction (Process 14 [Selection Value 1])" },
+{ 0, 0, 0, 0, 1106 }, // 1.2.840.10008.1.2.4.70
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -139,10 +111,8 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.80
-  "JPEG-LS Lossless Image Compression" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.81
-  "JPEG-LS Lossy (Near-Lossless) Image Compression" },
+{ 0, 0, 0, 0, 1195 }, // 1.2.840.10008.1.2.4.80
+{ 0, 0, 0, 0, 1230 }, // 1.2.840.10008.1.2.4.81
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -151,104 +121,58 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.90
-  "JPEG 2000 Image Compression (Lossless Only)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.91
-  "JPEG 2000 Image Compression" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.92
-  "JPEG 2000 Part 2 Multi-component Image Compression (Lossless Only)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.93
-  "JPEG 2000 Part 2 Multi-component Image Compression" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.94
-  "JPIP Referenced" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.95
-  "JPIP Referenced Deflate" },
+{ 0, 0, 0, 0, 1278 }, // 1.2.840.10008.1.2.4.90
+{ 0, 0, 0, 0, 1322 }, // 1.2.840.10008.1.2.4.91
+{ 0, 0, 0, 0, 1350 }, // 1.2.840.10008.1.2.4.92
+{ 0, 0, 0, 0, 1417 }, // 1.2.840.10008.1.2.4.93
+{ 0, 0, 0, 0, 1468 }, // 1.2.840.10008.1.2.4.94
+{ 0, 0, 0, 0, 1484 }, // 1.2.840.10008.1.2.4.95
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.100
-  "MPEG2 Main Profile @ Main Level" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.101
-  "MPEG2 Main Profile @ High Level" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.102
-  "MPEG-4 AVC/H.264 High Profile / Level 4.1" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.103
-  "MPEG-4 AVC/H.264 BD-compatible High Profile / Level 4.1" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.104
-  "MPEG-4 AVC/H.264 High Profile / Level 4.2 For 2D Video" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.105
-  "MPEG-4 AVC/H.264 High Profile / Level 4.2 For 3D Video" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.4.106
-  "MPEG-4 AVC/H.264 Stereo High Profile / Level 4.2" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.6.1
-  "RFC 2557 MIME encapsulation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.2.6.2
-  "XML Encoding" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.3.10
-  "Media Storage Directory Storage" },
+{ 0, 0, 0, 0, 1508 }, // 1.2.840.10008.1.2.4.100
+{ 0, 0, 0, 0, 1540 }, // 1.2.840.10008.1.2.4.101
+{ 0, 0, 0, 0, 1572 }, // 1.2.840.10008.1.2.4.102
+{ 0, 0, 0, 0, 1614 }, // 1.2.840.10008.1.2.4.103
+{ 0, 0, 0, 0, 1670 }, // 1.2.840.10008.1.2.4.104
+{ 0, 0, 0, 0, 1725 }, // 1.2.840.10008.1.2.4.105
+{ 0, 0, 0, 0, 1780 }, // 1.2.840.10008.1.2.4.106
+{ 0, 0, 0, 0, 1829 }, // 1.2.840.10008.1.2.6.1
+{ 0, 0, 0, 0, 1857 }, // 1.2.840.10008.1.2.6.2
+{ 0, 0, 0, 0, 1870 }, // 1.2.840.10008.1.3.10
 { 127, 18, 1, 0, 0 },
 { 145, 2, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.1
-  "Talairach Brain Atlas Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.2
-  "SPM2 T1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.3
-  "SPM2 T2 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.4
-  "SPM2 PD Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.5
-  "SPM2 EPI Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.6
-  "SPM2 FIL T1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.7
-  "SPM2 PET Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.8
-  "SPM2 TRANSM Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.9
-  "SPM2 SPECT Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.10
-  "SPM2 GRAY Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.11
-  "SPM2 WHITE Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.12
-  "SPM2 CSF Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.13
-  "SPM2 BRAINMASK Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.14
-  "SPM2 AVG305T1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.15
-  "SPM2 AVG152T1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.16
-  "SPM2 AVG152T2 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.17
-  "SPM2 AVG152PD Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.1.18
-  "SPM2 SINGLESUBJT1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.2.1
-  "ICBM 452 T1 Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.4.2.2
-  "ICBM Single Subject MRI Frame of Reference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.5.1
-  "Hot Iron Color Palette SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.5.2
-  "PET Color Palette SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.5.3
-  "Hot Metal Blue Color Palette SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.5.4
-  "PET 20 Step Color Palette SOP Instance" },
-{ 153, 1, 1, 0, // 1.2.840.10008.1.20.1
-  "Storage Commitment Push Model SOP Class" },
-{ 154, 1, 1, 0, // 1.2.840.10008.1.20.2 (Retired)
-  "Storage Commitment Pull Model SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.20.1.1
-  "Storage Commitment Push Model SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.20.2.1 (Retired)
-  "Storage Commitment Pull Model SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.40.1
-  "Procedural Event Logging SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.1.42.1
-  "Substance Administration Logging SOP Instance" },
+{ 0, 0, 0, 0, 1902 }, // 1.2.840.10008.1.4.1.1
+{ 0, 0, 0, 0, 1943 }, // 1.2.840.10008.1.4.1.2
+{ 0, 0, 0, 0, 1970 }, // 1.2.840.10008.1.4.1.3
+{ 0, 0, 0, 0, 1997 }, // 1.2.840.10008.1.4.1.4
+{ 0, 0, 0, 0, 2024 }, // 1.2.840.10008.1.4.1.5
+{ 0, 0, 0, 0, 2052 }, // 1.2.840.10008.1.4.1.6
+{ 0, 0, 0, 0, 2083 }, // 1.2.840.10008.1.4.1.7
+{ 0, 0, 0, 0, 2111 }, // 1.2.840.10008.1.4.1.8
+{ 0, 0, 0, 0, 2142 }, // 1.2.840.10008.1.4.1.9
+{ 0, 0, 0, 0, 2172 }, // 1.2.840.10008.1.4.1.10
+{ 0, 0, 0, 0, 2201 }, // 1.2.840.10008.1.4.1.11
+{ 0, 0, 0, 0, 2231 }, // 1.2.840.10008.1.4.1.12
+{ 0, 0, 0, 0, 2259 }, // 1.2.840.10008.1.4.1.13
+{ 0, 0, 0, 0, 2293 }, // 1.2.840.10008.1.4.1.14
+{ 0, 0, 0, 0, 2326 }, // 1.2.840.10008.1.4.1.15
+{ 0, 0, 0, 0, 2359 }, // 1.2.840.10008.1.4.1.16
+{ 0, 0, 0, 0, 2392 }, // 1.2.840.10008.1.4.1.17
+{ 0, 0, 0, 0, 2425 }, // 1.2.840.10008.1.4.1.18
+{ 0, 0, 0, 0, 2462 }, // 1.2.840.10008.1.4.2.1
+{ 0, 0, 0, 0, 2493 }, // 1.2.840.10008.1.4.2.2
+{ 0, 0, 0, 0, 2536 }, // 1.2.840.10008.1.5.1
+{ 0, 0, 0, 0, 2572 }, // 1.2.840.10008.1.5.2
+{ 0, 0, 0, 0, 2603 }, // 1.2.840.10008.1.5.3
+{ 0, 0, 0, 0, 2645 }, // 1.2.840.10008.1.5.4
+{ 153, 1, 1, 0, 2684 }, // 1.2.840.10008.1.20.1
+{ 154, 1, 1, 0, 2724 }, // 1.2.840.10008.1.20.2 (Retired)
+{ 0, 0, 0, 0, 2764 }, // 1.2.840.10008.1.20.1.1
+{ 0, 0, 0, 0, 2807 }, // 1.2.840.10008.1.20.2.1 (Retired)
+{ 0, 0, 0, 0, 2850 }, // 1.2.840.10008.1.40.1
+{ 0, 0, 0, 0, 2888 }, // 1.2.840.10008.1.42.1
 { 168, 1, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -260,143 +184,93 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 169, 6, 4, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.6.1
-  "DICOM UID Registry" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.4
-  "DICOM Controlled Terminology" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.5
-  "Adult Mouse Anatomy Ontology" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.6
-  "Uberon Ontology" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.7
-  "Integrated Taxonomic Information System (ITIS) Taxonomic Serial Number (TSN)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.8
-  "Mouse Genome Initiative (MGI)" },
-{ 0, 0, 0, 0, // 1.2.840.10008.2.16.9
-  "PubChem Compound CID" },
+{ 0, 0, 0, 0, 2934 }, // 1.2.840.10008.2.6.1
+{ 0, 0, 0, 0, 2953 }, // 1.2.840.10008.2.16.4
+{ 0, 0, 0, 0, 2982 }, // 1.2.840.10008.2.16.5
+{ 0, 0, 0, 0, 3011 }, // 1.2.840.10008.2.16.6
+{ 0, 0, 0, 0, 3027 }, // 1.2.840.10008.2.16.7
+{ 0, 0, 0, 0, 3104 }, // 1.2.840.10008.2.16.8
+{ 0, 0, 0, 0, 3134 }, // 1.2.840.10008.2.16.9
 { 176, 2, 1, 0, 0 },
 { 178, 1, 1, 0, 0 },
 { 179, 6, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.1.1
-  "DICOM Application Context Name" },
+{ 0, 0, 0, 0, 3155 }, // 1.2.840.10008.3.1.1.1
 { 185, 4, 1, 0, 0 },
 { 189, 1, 1, 0, 0 },
 { 190, 5, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 195, 5, 1, 0, 0 },
 { 200, 1, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.1.1 (Retired)
-  "Detached Patient Management SOP Class" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.1.4 (Retired)
-  "Detached Patient Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.2.1 (Retired)
-  "Detached Visit Management SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.3.1 (Retired)
-  "Detached Study Management SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.3.2 (Retired)
-  "Study Component Management SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.3.3
-  "Modality Performed Procedure Step SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.3.4
-  "Modality Performed Procedure Step Retrieve SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.3.5
-  "Modality Performed Procedure Step Notification SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.5.1 (Retired)
-  "Detached Results Management SOP Class" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.5.4 (Retired)
-  "Detached Results Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.5.5 (Retired)
-  "Detached Study Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.3.1.2.6.1 (Retired)
-  "Detached Interpretation Management SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.4.2
-  "Storage Service Class" },
+{ 0, 0, 0, 0, 3186 }, // 1.2.840.10008.3.1.2.1.1 (Retired)
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 3224 }, // 1.2.840.10008.3.1.2.1.4 (Retired)
+{ 0, 0, 0, 0, 3267 }, // 1.2.840.10008.3.1.2.2.1 (Retired)
+{ 0, 0, 0, 0, 3303 }, // 1.2.840.10008.3.1.2.3.1 (Retired)
+{ 0, 0, 0, 0, 3339 }, // 1.2.840.10008.3.1.2.3.2 (Retired)
+{ 0, 0, 0, 0, 3376 }, // 1.2.840.10008.3.1.2.3.3
+{ 0, 0, 0, 0, 3420 }, // 1.2.840.10008.3.1.2.3.4
+{ 0, 0, 0, 0, 3473 }, // 1.2.840.10008.3.1.2.3.5
+{ 0, 0, 0, 0, 3530 }, // 1.2.840.10008.3.1.2.5.1 (Retired)
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 3568 }, // 1.2.840.10008.3.1.2.5.4 (Retired)
+{ 0, 0, 0, 0, 3611 }, // 1.2.840.10008.3.1.2.5.5 (Retired)
+{ 0, 0, 0, 0, 3652 }, // 1.2.840.10008.3.1.2.6.1 (Retired)
+{ 0, 0, 0, 0, 3697 }, // 1.2.840.10008.4.2
 { 203, 4, 1, 0, 0 },
 { 207, 40, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 255, 45, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.1
-  "Basic Film Session SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.2
-  "Basic Film Box SOP Class" },
+{ 0, 0, 0, 0, 3719 }, // 1.2.840.10008.5.1.1.1
+{ 0, 0, 0, 0, 3748 }, // 1.2.840.10008.5.1.1.2
 { 0, 0, 0, 0, 0 },
-{ 247, 2, 1, 0, // 1.2.840.10008.5.1.1.4
-  "Basic Grayscale Image Box SOP Class" },
+{ 247, 2, 1, 0, 3773 }, // 1.2.840.10008.5.1.1.4
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 249, 1, 1, 0, // 1.2.840.10008.5.1.1.9
-  "Basic Grayscale Print Management Meta SOP Class" },
+{ 249, 1, 1, 0, 3809 }, // 1.2.840.10008.5.1.1.9
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.14
-  "Print Job SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.15
-  "Basic Annotation Box SOP Class" },
-{ 250, 1, 376, 0, // 1.2.840.10008.5.1.1.16
-  "Printer SOP Class" },
-{ 251, 1, 376, 0, // 1.2.840.10008.5.1.1.17
-  "Printer SOP Instance" },
-{ 252, 1, 1, 0, // 1.2.840.10008.5.1.1.18
-  "Basic Color Print Management Meta SOP Class" },
+{ 0, 0, 0, 0, 3857 }, // 1.2.840.10008.5.1.1.14
+{ 0, 0, 0, 0, 3877 }, // 1.2.840.10008.5.1.1.15
+{ 250, 1, 376, 0, 3908 }, // 1.2.840.10008.5.1.1.16
+{ 251, 1, 376, 0, 3926 }, // 1.2.840.10008.5.1.1.17
+{ 252, 1, 1, 0, 3947 }, // 1.2.840.10008.5.1.1.18
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.22
-  "VOI LUT Box SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.23
-  "Presentation LUT SOP Class" },
-{ 253, 1, 1, 0, // 1.2.840.10008.5.1.1.24 (Retired)
-  "Image Overlay Box SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.25 (Retired)
-  "Print Queue SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.26 (Retired)
-  "Print Queue Management SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.27 (Retired)
-  "Stored Print Storage SOP Class" },
+{ 0, 0, 0, 0, 3991 }, // 1.2.840.10008.5.1.1.22
+{ 0, 0, 0, 0, 4013 }, // 1.2.840.10008.5.1.1.23
+{ 253, 1, 1, 0, 4040 }, // 1.2.840.10008.5.1.1.24 (Retired)
+{ 0, 0, 0, 0, 4068 }, // 1.2.840.10008.5.1.1.25 (Retired)
+{ 0, 0, 0, 0, 4093 }, // 1.2.840.10008.5.1.1.26 (Retired)
+{ 0, 0, 0, 0, 4126 }, // 1.2.840.10008.5.1.1.27 (Retired)
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.29 (Retired)
-  "Hardcopy Grayscale Image Storage SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.30 (Retired)
-  "Hardcopy Color Image Storage SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.31 (Retired)
-  "Pull Print Request SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.32 (Retired)
-  "Pull Stored Print Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.33
-  "Media Creation Management SOP Class UID" },
+{ 0, 0, 0, 0, 4157 }, // 1.2.840.10008.5.1.1.29 (Retired)
+{ 0, 0, 0, 0, 4200 }, // 1.2.840.10008.5.1.1.30 (Retired)
+{ 0, 0, 0, 0, 4239 }, // 1.2.840.10008.5.1.1.31 (Retired)
+{ 0, 0, 0, 0, 4268 }, // 1.2.840.10008.5.1.1.32 (Retired)
+{ 0, 0, 0, 0, 4312 }, // 1.2.840.10008.5.1.1.33
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 254, 1, 1, 0, // 1.2.840.10008.5.1.1.40
-  "Display System SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.4.1
-  "Basic Color Image Box SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.4.2 (Retired)
-  "Referenced Image Box SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.9.1 (Retired)
-  "Referenced Grayscale Print Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.16.376
-  "Printer Configuration Retrieval SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.17.376
-  "Printer Configuration Retrieval SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.18.1 (Retired)
-  "Referenced Color Print Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.24.1 (Retired)
-  "Basic Print Image Overlay Box SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.1.40.1
-  "Display System SOP Instance" },
+{ 254, 1, 1, 0, 4352 }, // 1.2.840.10008.5.1.1.40
+{ 0, 0, 0, 0, 4377 }, // 1.2.840.10008.5.1.1.4.1
+{ 0, 0, 0, 0, 4409 }, // 1.2.840.10008.5.1.1.4.2 (Retired)
+{ 0, 0, 0, 0, 4440 }, // 1.2.840.10008.5.1.1.9.1 (Retired)
+{ 0, 0, 0, 0, 4493 }, // 1.2.840.10008.5.1.1.16.376
+{ 0, 0, 0, 0, 4535 }, // 1.2.840.10008.5.1.1.17.376
+{ 0, 0, 0, 0, 4580 }, // 1.2.840.10008.5.1.1.18.1 (Retired)
+{ 0, 0, 0, 0, 4629 }, // 1.2.840.10008.5.1.1.24.1 (Retired)
+{ 0, 0, 0, 0, 4669 }, // 1.2.840.10008.5.1.1.40.1
 { 300, 2, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -427,12 +301,9 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.31
-  "Modality Worklist Information Model - FIND" },
-{ 1179, 3, 1, 0, // 1.2.840.10008.5.1.4.32 (Retired)
-  "General Purpose Worklist Management Meta SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.33
-  "Instance Availability Notification SOP Class" },
+{ 0, 0, 0, 0, 4697 }, // 1.2.840.10008.5.1.4.31
+{ 1179, 3, 1, 0, 4740 }, // 1.2.840.10008.5.1.4.32 (Retired)
+{ 0, 0, 0, 0, 4791 }, // 1.2.840.10008.5.1.4.33
 { 1182, 10, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -440,37 +311,24 @@ const UIDTableEntry UIDTable[] = {
 { 1204, 4, 1, 0, 0 },
 { 1208, 4, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.41
-  "Product Characteristics Query SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.42
-  "Substance Approval Query SOP Class" },
+{ 0, 0, 0, 0, 4836 }, // 1.2.840.10008.5.1.4.41
+{ 0, 0, 0, 0, 4876 }, // 1.2.840.10008.5.1.4.42
 { 1212, 4, 1, 0, 0 },
 { 1216, 4, 1, 0, 0 },
 { 1220, 4, 1, 0, 0 },
 { 302, 601, 1, 0, 0 },
 { 1162, 5, 1, 0, 0 },
-{ 903, 3, 1, 0, // 1.2.840.10008.5.1.4.1.1.1
-  "Computed Radiography Image Storage" },
-{ 909, 2, 1, 0, // 1.2.840.10008.5.1.4.1.1.2
-  "CT Image Storage" },
-{ 911, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.3 (Retired)
-  "Ultrasound Multi-frame Image Storage" },
-{ 912, 4, 1, 0, // 1.2.840.10008.5.1.4.1.1.4
-  "MR Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.5 (Retired)
-  "Nuclear Medicine Image Storage" },
-{ 916, 2, 1, 0, // 1.2.840.10008.5.1.4.1.1.6 (Retired)
-  "Ultrasound Image Storage" },
-{ 918, 4, 1, 0, // 1.2.840.10008.5.1.4.1.1.7
-  "Secondary Capture Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.8 (Retired)
-  "Standalone Overlay Storage" },
-{ 922, 6, 1, 0, // 1.2.840.10008.5.1.4.1.1.9 (Retired)
-  "Standalone Curve Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.10 (Retired)
-  "Standalone Modality LUT Storage" },
-{ 937, 7, 1, 0, // 1.2.840.10008.5.1.4.1.1.11 (Retired)
-  "Standalone VOI LUT Storage" },
+{ 903, 3, 1, 0, 4911 }, // 1.2.840.10008.5.1.4.1.1.1
+{ 909, 2, 1, 0, 4946 }, // 1.2.840.10008.5.1.4.1.1.2
+{ 911, 1, 1, 0, 4963 }, // 1.2.840.10008.5.1.4.1.1.3 (Retired)
+{ 912, 4, 1, 0, 5000 }, // 1.2.840.10008.5.1.4.1.1.4
+{ 0, 0, 0, 0, 5017 }, // 1.2.840.10008.5.1.4.1.1.5 (Retired)
+{ 916, 2, 1, 0, 5048 }, // 1.2.840.10008.5.1.4.1.1.6 (Retired)
+{ 918, 4, 1, 0, 5073 }, // 1.2.840.10008.5.1.4.1.1.7
+{ 0, 0, 0, 0, 5105 }, // 1.2.840.10008.5.1.4.1.1.8 (Retired)
+{ 922, 6, 1, 0, 5132 }, // 1.2.840.10008.5.1.4.1.1.9 (Retired)
+{ 0, 0, 0, 0, 5157 }, // 1.2.840.10008.5.1.4.1.1.10 (Retired)
+{ 937, 7, 1, 0, 5189 }, // 1.2.840.10008.5.1.4.1.1.11 (Retired)
 { 944, 77, 1, 0, 0 },
 { 1023, 1, 1, 0, 0 },
 { 1029, 2, 1, 0, 0 },
@@ -479,8 +337,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.20
-  "Nuclear Medicine Image Storage" },
+{ 0, 0, 0, 0, 5017 }, // 1.2.840.10008.5.1.4.1.1.20
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -490,8 +347,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.30
-  "Parametric Map Storage" },
+{ 0, 0, 0, 0, 5216 }, // 1.2.840.10008.5.1.4.1.1.30
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -501,8 +357,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.40 (Retired)
-  "1.2.840.10008.5.1.4.1.1.40" },
+{ 0, 0, 0, 0, 5239 }, // 1.2.840.10008.5.1.4.1.1.40 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -528,10 +383,8 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 1031, 6, 1, 0, // 1.2.840.10008.5.1.4.1.1.66
-  "Raw Data Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.67
-  "Real World Value Mapping Storage" },
+{ 1031, 6, 1, 0, 5266 }, // 1.2.840.10008.5.1.4.1.1.66
+{ 0, 0, 0, 0, 5283 }, // 1.2.840.10008.5.1.4.1.1.67
 { 1037, 2, 1, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -592,14 +445,10 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 1142, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.128
-  "Positron Emission Tomography Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.129 (Retired)
-  "Standalone PET Curve Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.130
-  "Enhanced PET Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.131
-  "Basic Structured Display Storage" },
+{ 1142, 1, 1, 0, 5316 }, // 1.2.840.10008.5.1.4.1.1.128
+{ 0, 0, 0, 0, 5359 }, // 1.2.840.10008.5.1.4.1.1.129 (Retired)
+{ 0, 0, 0, 0, 5388 }, // 1.2.840.10008.5.1.4.1.1.130
+{ 0, 0, 0, 0, 5415 }, // 1.2.840.10008.5.1.4.1.1.131
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1070,89 +919,50 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 1160, 2, 1, 0, 0 },
-{ 906, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.1.1
-  "Digital X-Ray Image Storage - For Presentation" },
-{ 907, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.1.2
-  "Digital Mammography X-Ray Image Storage - For Presentation" },
-{ 908, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.1.3
-  "Digital Intra-Oral X-Ray Image Storage - For Presentation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.1.1.1
-  "Digital X-Ray Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.1.2.1
-  "Digital Mammography X-Ray Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.1.3.1
-  "Digital Intra-Oral X-Ray Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.2.1
-  "Enhanced CT Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.2.2
-  "Legacy Converted Enhanced CT Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.3.1
-  "Ultrasound Multi-frame Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.4.1
-  "Enhanced MR Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.4.2
-  "MR Spectroscopy Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.4.3
-  "Enhanced MR Color Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.4.4
-  "Legacy Converted Enhanced MR Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.6.1
-  "Ultrasound Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.6.2
-  "Enhanced US Volume Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.7.1
-  "Multi-frame Single Bit Secondary Capture Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.7.2
-  "Multi-frame Grayscale Byte Secondary Capture Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.7.3
-  "Multi-frame Grayscale Word Secondary Capture Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.7.4
-  "Multi-frame True Color Secondary Capture Image Storage" },
-{ 928, 3, 1, 0, // 1.2.840.10008.5.1.4.1.1.9.1 (Retired)
-  "Waveform Storage - Trial" },
+{ 906, 1, 1, 0, 5448 }, // 1.2.840.10008.5.1.4.1.1.1.1
+{ 907, 1, 1, 0, 5495 }, // 1.2.840.10008.5.1.4.1.1.1.2
+{ 908, 1, 1, 0, 5554 }, // 1.2.840.10008.5.1.4.1.1.1.3
+{ 0, 0, 0, 0, 5612 }, // 1.2.840.10008.5.1.4.1.1.1.1.1
+{ 0, 0, 0, 0, 5657 }, // 1.2.840.10008.5.1.4.1.1.1.2.1
+{ 0, 0, 0, 0, 5714 }, // 1.2.840.10008.5.1.4.1.1.1.3.1
+{ 0, 0, 0, 0, 5770 }, // 1.2.840.10008.5.1.4.1.1.2.1
+{ 0, 0, 0, 0, 5796 }, // 1.2.840.10008.5.1.4.1.1.2.2
+{ 0, 0, 0, 0, 4963 }, // 1.2.840.10008.5.1.4.1.1.3.1
+{ 0, 0, 0, 0, 5839 }, // 1.2.840.10008.5.1.4.1.1.4.1
+{ 0, 0, 0, 0, 5865 }, // 1.2.840.10008.5.1.4.1.1.4.2
+{ 0, 0, 0, 0, 5889 }, // 1.2.840.10008.5.1.4.1.1.4.3
+{ 0, 0, 0, 0, 5921 }, // 1.2.840.10008.5.1.4.1.1.4.4
+{ 0, 0, 0, 0, 5048 }, // 1.2.840.10008.5.1.4.1.1.6.1
+{ 0, 0, 0, 0, 5964 }, // 1.2.840.10008.5.1.4.1.1.6.2
+{ 0, 0, 0, 0, 5991 }, // 1.2.840.10008.5.1.4.1.1.7.1
+{ 0, 0, 0, 0, 6046 }, // 1.2.840.10008.5.1.4.1.1.7.2
+{ 0, 0, 0, 0, 6105 }, // 1.2.840.10008.5.1.4.1.1.7.3
+{ 0, 0, 0, 0, 6164 }, // 1.2.840.10008.5.1.4.1.1.7.4
+{ 928, 3, 1, 0, 6219 }, // 1.2.840.10008.5.1.4.1.1.9.1 (Retired)
 { 931, 1, 1, 0, 0 },
 { 932, 1, 1, 0, 0 },
 { 933, 2, 1, 0, 0 },
 { 935, 1, 1, 0, 0 },
 { 936, 1, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.1.1
-  "12-lead ECG Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.1.2
-  "General ECG Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.1.3
-  "Ambulatory ECG Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.2.1
-  "Hemodynamic Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.3.1
-  "Cardiac Electrophysiology Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.4.1
-  "Basic Voice Audio Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.4.2
-  "General Audio Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.5.1
-  "Arterial Pulse Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.9.6.1
-  "Respiratory Waveform Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.1
-  "Grayscale Softcopy Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.2
-  "Color Softcopy Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.3
-  "Pseudo-Color Softcopy Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.4
-  "Blending Softcopy Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.5
-  "XA/XRF Grayscale Softcopy Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.6
-  "Grayscale Planar MPR Volumetric Presentation State Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.11.7
-  "Compositing Planar MPR Volumetric Presentation State Storage" },
-{ 1021, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.12.1
-  "X-Ray Angiographic Image Storage" },
-{ 1022, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.12.2
-  "X-Ray Radiofluoroscopic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.12.3 (Retired)
-  "X-Ray Angiographic Bi-Plane Image Storage" },
+{ 0, 0, 0, 0, 6244 }, // 1.2.840.10008.5.1.4.1.1.9.1.1
+{ 0, 0, 0, 0, 6273 }, // 1.2.840.10008.5.1.4.1.1.9.1.2
+{ 0, 0, 0, 0, 6302 }, // 1.2.840.10008.5.1.4.1.1.9.1.3
+{ 0, 0, 0, 0, 6334 }, // 1.2.840.10008.5.1.4.1.1.9.2.1
+{ 0, 0, 0, 0, 6363 }, // 1.2.840.10008.5.1.4.1.1.9.3.1
+{ 0, 0, 0, 0, 6406 }, // 1.2.840.10008.5.1.4.1.1.9.4.1
+{ 0, 0, 0, 0, 6441 }, // 1.2.840.10008.5.1.4.1.1.9.4.2
+{ 0, 0, 0, 0, 6472 }, // 1.2.840.10008.5.1.4.1.1.9.5.1
+{ 0, 0, 0, 0, 6504 }, // 1.2.840.10008.5.1.4.1.1.9.6.1
+{ 0, 0, 0, 0, 6533 }, // 1.2.840.10008.5.1.4.1.1.11.1
+{ 0, 0, 0, 0, 6579 }, // 1.2.840.10008.5.1.4.1.1.11.2
+{ 0, 0, 0, 0, 6621 }, // 1.2.840.10008.5.1.4.1.1.11.3
+{ 0, 0, 0, 0, 6670 }, // 1.2.840.10008.5.1.4.1.1.11.4
+{ 0, 0, 0, 0, 6715 }, // 1.2.840.10008.5.1.4.1.1.11.5
+{ 0, 0, 0, 0, 6768 }, // 1.2.840.10008.5.1.4.1.1.11.6
+{ 0, 0, 0, 0, 6827 }, // 1.2.840.10008.5.1.4.1.1.11.7
+{ 1021, 1, 1, 0, 6888 }, // 1.2.840.10008.5.1.4.1.1.12.1
+{ 1022, 1, 1, 0, 6921 }, // 1.2.840.10008.5.1.4.1.1.12.2
+{ 0, 0, 0, 0, 6959 }, // 1.2.840.10008.5.1.4.1.1.12.3 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1226,116 +1036,65 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.12.77 (Retired)
-  "1.2.840.10008.5.1.4.1.1.12.77" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.12.1.1
-  "Enhanced XA Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.12.2.1
-  "Enhanced XRF Image Storage" },
+{ 0, 0, 0, 0, 7001 }, // 1.2.840.10008.5.1.4.1.1.12.77 (Retired)
+{ 0, 0, 0, 0, 7031 }, // 1.2.840.10008.5.1.4.1.1.12.1.1
+{ 0, 0, 0, 0, 7057 }, // 1.2.840.10008.5.1.4.1.1.12.2.1
 { 1024, 5, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.13.1.1
-  "X-Ray 3D Angiographic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.13.1.2
-  "X-Ray 3D Craniofacial Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.13.1.3
-  "Breast Tomosynthesis Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.13.1.4
-  "Breast Projection X-Ray Image Storage - For Presentation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.13.1.5
-  "Breast Projection X-Ray Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.14.1
-  "Intravascular Optical Coherence Tomography Image Storage - For Presentation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.14.2
-  "Intravascular Optical Coherence Tomography Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.1
-  "Spatial Registration Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.2
-  "Spatial Fiducials Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.3
-  "Deformable Spatial Registration Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.4
-  "Segmentation Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.5
-  "Surface Segmentation Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.66.6
-  "Tractography Results Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.68.1
-  "Surface Scan Mesh Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.68.2
-  "Surface Scan Point Cloud Storage" },
-{ 1041, 6, 1, 0, // 1.2.840.10008.5.1.4.1.1.77.1 (Retired)
-  "VL Image Storage - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.2 (Retired)
-  "VL Multi-frame Image Storage - Trial" },
-{ 1047, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.77.1.1
-  "VL Endoscopic Image Storage" },
-{ 1048, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.77.1.2
-  "VL Microscopic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.3
-  "VL Slide-Coordinates Microscopic Image Storage" },
-{ 1049, 1, 1, 0, // 1.2.840.10008.5.1.4.1.1.77.1.4
-  "VL Photographic Image Storage" },
+{ 0, 0, 0, 0, 7084 }, // 1.2.840.10008.5.1.4.1.1.13.1.1
+{ 0, 0, 0, 0, 7120 }, // 1.2.840.10008.5.1.4.1.1.13.1.2
+{ 0, 0, 0, 0, 7156 }, // 1.2.840.10008.5.1.4.1.1.13.1.3
+{ 0, 0, 0, 0, 7191 }, // 1.2.840.10008.5.1.4.1.1.13.1.4
+{ 0, 0, 0, 0, 7248 }, // 1.2.840.10008.5.1.4.1.1.13.1.5
+{ 0, 0, 0, 0, 7303 }, // 1.2.840.10008.5.1.4.1.1.14.1
+{ 0, 0, 0, 0, 7379 }, // 1.2.840.10008.5.1.4.1.1.14.2
+{ 0, 0, 0, 0, 7453 }, // 1.2.840.10008.5.1.4.1.1.66.1
+{ 0, 0, 0, 0, 7482 }, // 1.2.840.10008.5.1.4.1.1.66.2
+{ 0, 0, 0, 0, 7508 }, // 1.2.840.10008.5.1.4.1.1.66.3
+{ 0, 0, 0, 0, 7548 }, // 1.2.840.10008.5.1.4.1.1.66.4
+{ 0, 0, 0, 0, 7569 }, // 1.2.840.10008.5.1.4.1.1.66.5
+{ 0, 0, 0, 0, 7598 }, // 1.2.840.10008.5.1.4.1.1.66.6
+{ 0, 0, 0, 0, 7627 }, // 1.2.840.10008.5.1.4.1.1.68.1
+{ 0, 0, 0, 0, 7653 }, // 1.2.840.10008.5.1.4.1.1.68.2
+{ 1041, 6, 1, 0, 7686 }, // 1.2.840.10008.5.1.4.1.1.77.1 (Retired)
+{ 0, 0, 0, 0, 7711 }, // 1.2.840.10008.5.1.4.1.1.77.2 (Retired)
+{ 1047, 1, 1, 0, 7748 }, // 1.2.840.10008.5.1.4.1.1.77.1.1
+{ 1048, 1, 1, 0, 7776 }, // 1.2.840.10008.5.1.4.1.1.77.1.2
+{ 0, 0, 0, 0, 7805 }, // 1.2.840.10008.5.1.4.1.1.77.1.3
+{ 1049, 1, 1, 0, 7852 }, // 1.2.840.10008.5.1.4.1.1.77.1.4
 { 1050, 6, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.6
-  "VL Whole Slide Microscopy Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.1.1
-  "Video Endoscopic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.2.1
-  "Video Microscopic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.4.1
-  "Video Photographic Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.1
-  "Ophthalmic Photography 8 Bit Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.2
-  "Ophthalmic Photography 16 Bit Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.3
-  "Stereometric Relationship Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.4
-  "Ophthalmic Tomography Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.5
-  "Wide Field Ophthalmic Photography Stereographic Projection Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.77.1.5.6
-  "Wide Field Ophthalmic Photography 3D Coordinates Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.1
-  "Lensometry Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.2
-  "Autorefraction Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.3
-  "Keratometry Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.4
-  "Subjective Refraction Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.5
-  "Visual Acuity Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.6
-  "Spectacle Prescription Report Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.7
-  "Ophthalmic Axial Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.78.8
-  "Intraocular Lens Calculations Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.79.1
-  "Macular Grid Thickness and Volume Report Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.80.1
-  "Ophthalmic Visual Field Static Perimetry Measurements Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.81.1
-  "Ophthalmic Thickness Map Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.82.1
-  "Corneal Topography Map Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.1 (Retired)
-  "Text SR Storage - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.2 (Retired)
-  "Audio SR Storage - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.3 (Retired)
-  "Detail SR Storage - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.4 (Retired)
-  "Comprehensive SR Storage - Trial" },
+{ 0, 0, 0, 0, 7882 }, // 1.2.840.10008.5.1.4.1.1.77.1.6
+{ 0, 0, 0, 0, 7922 }, // 1.2.840.10008.5.1.4.1.1.77.1.1.1
+{ 0, 0, 0, 0, 7953 }, // 1.2.840.10008.5.1.4.1.1.77.1.2.1
+{ 0, 0, 0, 0, 7985 }, // 1.2.840.10008.5.1.4.1.1.77.1.4.1
+{ 0, 0, 0, 0, 8018 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.1
+{ 0, 0, 0, 0, 8061 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.2
+{ 0, 0, 0, 0, 8105 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.3
+{ 0, 0, 0, 0, 8139 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.4
+{ 0, 0, 0, 0, 8175 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.5
+{ 0, 0, 0, 0, 8248 }, // 1.2.840.10008.5.1.4.1.1.77.1.5.6
+{ 0, 0, 0, 0, 8311 }, // 1.2.840.10008.5.1.4.1.1.78.1
+{ 0, 0, 0, 0, 8343 }, // 1.2.840.10008.5.1.4.1.1.78.2
+{ 0, 0, 0, 0, 8379 }, // 1.2.840.10008.5.1.4.1.1.78.3
+{ 0, 0, 0, 0, 8412 }, // 1.2.840.10008.5.1.4.1.1.78.4
+{ 0, 0, 0, 0, 8455 }, // 1.2.840.10008.5.1.4.1.1.78.5
+{ 0, 0, 0, 0, 8490 }, // 1.2.840.10008.5.1.4.1.1.78.6
+{ 0, 0, 0, 0, 8528 }, // 1.2.840.10008.5.1.4.1.1.78.7
+{ 0, 0, 0, 0, 8566 }, // 1.2.840.10008.5.1.4.1.1.78.8
+{ 0, 0, 0, 0, 8604 }, // 1.2.840.10008.5.1.4.1.1.79.1
+{ 0, 0, 0, 0, 8653 }, // 1.2.840.10008.5.1.4.1.1.80.1
+{ 0, 0, 0, 0, 8715 }, // 1.2.840.10008.5.1.4.1.1.81.1
+{ 0, 0, 0, 0, 8748 }, // 1.2.840.10008.5.1.4.1.1.82.1
+{ 0, 0, 0, 0, 8779 }, // 1.2.840.10008.5.1.4.1.1.88.1 (Retired)
+{ 0, 0, 0, 0, 8803 }, // 1.2.840.10008.5.1.4.1.1.88.2 (Retired)
+{ 0, 0, 0, 0, 8828 }, // 1.2.840.10008.5.1.4.1.1.88.3 (Retired)
+{ 0, 0, 0, 0, 8854 }, // 1.2.840.10008.5.1.4.1.1.88.4 (Retired)
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.11
-  "Basic Text SR Storage" },
+{ 0, 0, 0, 0, 8887 }, // 1.2.840.10008.5.1.4.1.1.88.11
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1346,8 +1105,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.22
-  "Enhanced SR Storage" },
+{ 0, 0, 0, 0, 8909 }, // 1.2.840.10008.5.1.4.1.1.88.22
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1358,18 +1116,14 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.33
-  "Comprehensive SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.34
-  "Comprehensive 3D SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.35
-  "Extensible SR Storage" },
+{ 0, 0, 0, 0, 8929 }, // 1.2.840.10008.5.1.4.1.1.88.33
+{ 0, 0, 0, 0, 8954 }, // 1.2.840.10008.5.1.4.1.1.88.34
+{ 0, 0, 0, 0, 8982 }, // 1.2.840.10008.5.1.4.1.1.88.35
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.40
-  "Procedure Log Storage" },
+{ 0, 0, 0, 0, 9004 }, // 1.2.840.10008.5.1.4.1.1.88.40
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1379,8 +1133,7 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.50
-  "Mammography CAD SR Storage" },
+{ 0, 0, 0, 0, 9026 }, // 1.2.840.10008.5.1.4.1.1.88.50
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -1389,1467 +1142,744 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.59
-  "Key Object Selection Document Storage" },
+{ 0, 0, 0, 0, 9053 }, // 1.2.840.10008.5.1.4.1.1.88.59
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.65
-  "Chest CAD SR Storage" },
+{ 0, 0, 0, 0, 9091 }, // 1.2.840.10008.5.1.4.1.1.88.65
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.67
-  "X-Ray Radiation Dose SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.68
-  "Radiopharmaceutical Radiation Dose SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.69
-  "Colon CAD SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.70
-  "Implantation Plan SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.88.71
-  "Acquisition Context SR Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.90.1
-  "Content Assessment Results Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.104.1
-  "Encapsulated PDF Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.104.2
-  "Encapsulated CDA Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.128.1
-  "Legacy Converted Enhanced PET Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.1
-  "RT Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.2
-  "RT Dose Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.3
-  "RT Structure Set Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.4
-  "RT Beams Treatment Record Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.5
-  "RT Plan Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.6
-  "RT Brachy Treatment Record Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.7
-  "RT Treatment Summary Record Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.8
-  "RT Ion Plan Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.481.9
-  "RT Ion Beams Treatment Record Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.1
-  "DICOS CT Image Storage" },
+{ 0, 0, 0, 0, 9112 }, // 1.2.840.10008.5.1.4.1.1.88.67
+{ 0, 0, 0, 0, 9144 }, // 1.2.840.10008.5.1.4.1.1.88.68
+{ 0, 0, 0, 0, 9190 }, // 1.2.840.10008.5.1.4.1.1.88.69
+{ 0, 0, 0, 0, 9211 }, // 1.2.840.10008.5.1.4.1.1.88.70
+{ 0, 0, 0, 0, 9240 }, // 1.2.840.10008.5.1.4.1.1.88.71
+{ 0, 0, 0, 0, 9271 }, // 1.2.840.10008.5.1.4.1.1.90.1
+{ 0, 0, 0, 0, 9306 }, // 1.2.840.10008.5.1.4.1.1.104.1
+{ 0, 0, 0, 0, 9331 }, // 1.2.840.10008.5.1.4.1.1.104.2
+{ 0, 0, 0, 0, 9356 }, // 1.2.840.10008.5.1.4.1.1.128.1
+{ 0, 0, 0, 0, 9400 }, // 1.2.840.10008.5.1.4.1.1.481.1
+{ 0, 0, 0, 0, 9417 }, // 1.2.840.10008.5.1.4.1.1.481.2
+{ 0, 0, 0, 0, 9433 }, // 1.2.840.10008.5.1.4.1.1.481.3
+{ 0, 0, 0, 0, 9458 }, // 1.2.840.10008.5.1.4.1.1.481.4
+{ 0, 0, 0, 0, 9492 }, // 1.2.840.10008.5.1.4.1.1.481.5
+{ 0, 0, 0, 0, 9508 }, // 1.2.840.10008.5.1.4.1.1.481.6
+{ 0, 0, 0, 0, 9543 }, // 1.2.840.10008.5.1.4.1.1.481.7
+{ 0, 0, 0, 0, 9579 }, // 1.2.840.10008.5.1.4.1.1.481.8
+{ 0, 0, 0, 0, 9599 }, // 1.2.840.10008.5.1.4.1.1.481.9
+{ 0, 0, 0, 0, 9637 }, // 1.2.840.10008.5.1.4.1.1.501.1
 { 1158, 2, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.3
-  "DICOS Threat Detection Report Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.4
-  "DICOS 2D AIT Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.5
-  "DICOS 3D AIT Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.6
-  "DICOS Quadrupole Resonance (QR) Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.2.1
-  "DICOS Digital X-Ray Image Storage - For Presentation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.501.2.2
-  "DICOS Digital X-Ray Image Storage - For Processing" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.601.1
-  "Eddy Current Image Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.1.601.2
-  "Eddy Current Multi-frame Image Storage" },
+{ 0, 0, 0, 0, 9660 }, // 1.2.840.10008.5.1.4.1.1.501.3
+{ 0, 0, 0, 0, 9698 }, // 1.2.840.10008.5.1.4.1.1.501.4
+{ 0, 0, 0, 0, 9719 }, // 1.2.840.10008.5.1.4.1.1.501.5
+{ 0, 0, 0, 0, 9740 }, // 1.2.840.10008.5.1.4.1.1.501.6
+{ 0, 0, 0, 0, 9780 }, // 1.2.840.10008.5.1.4.1.1.501.2.1
+{ 0, 0, 0, 0, 9833 }, // 1.2.840.10008.5.1.4.1.1.501.2.2
+{ 0, 0, 0, 0, 9884 }, // 1.2.840.10008.5.1.4.1.1.601.1
+{ 0, 0, 0, 0, 9911 }, // 1.2.840.10008.5.1.4.1.1.601.2
 { 1167, 3, 1, 0, 0 },
 { 1170, 3, 1, 0, 0 },
 { 1173, 3, 1, 0, 0 },
 { 1176, 2, 2, 0, 0 },
 { 1178, 1, 3, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.1.1
-  "Patient Root Query/Retrieve Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.1.2
-  "Patient Root Query/Retrieve Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.1.3
-  "Patient Root Query/Retrieve Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.2.1
-  "Study Root Query/Retrieve Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.2.2
-  "Study Root Query/Retrieve Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.2.3
-  "Study Root Query/Retrieve Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.3.1 (Retired)
-  "Patient/Study Only Query/Retrieve Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.3.2 (Retired)
-  "Patient/Study Only Query/Retrieve Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.3.3 (Retired)
-  "Patient/Study Only Query/Retrieve Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.4.2
-  "Composite Instance Root Retrieve - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.4.3
-  "Composite Instance Root Retrieve - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.1.2.5.3
-  "Composite Instance Retrieve Without Bulk Data - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.32.1 (Retired)
-  "General Purpose Worklist Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.32.2 (Retired)
-  "General Purpose Scheduled Procedure Step SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.32.3 (Retired)
-  "General Purpose Performed Procedure Step SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.1 (Retired)
-  "RT Beams Delivery Instruction Storage - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.2 (Retired)
-  "RT Conventional Machine Verification - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.3 (Retired)
-  "RT Ion Machine Verification - Trial" },
-{ 1192, 4, 1, 0, // 1.2.840.10008.5.1.4.34.4 (Retired)
-  "Unified Worklist and Procedure Step Service Class - Trial" },
-{ 1196, 1, 1, 0, // 1.2.840.10008.5.1.4.34.5
-  "UPS Global Subscription SOP Instance" },
-{ 1197, 4, 1, 0, // 1.2.840.10008.5.1.4.34.6
-  "Unified Worklist and Procedure Step Service Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.7
-  "RT Beams Delivery Instruction Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.8
-  "RT Conventional Machine Verification" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.9
-  "RT Ion Machine Verification" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.10
-  "RT Brachy Application Setup Delivery Instruction Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.4.1 (Retired)
-  "Unified Procedure Step - Push SOP Class - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.4.2 (Retired)
-  "Unified Procedure Step - Watch SOP Class - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.4.3 (Retired)
-  "Unified Procedure Step - Pull SOP Class - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.4.4 (Retired)
-  "Unified Procedure Step - Event SOP Class - Trial" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.5.1
-  "UPS Filtered Global Subscription SOP Instance" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.6.1
-  "Unified Procedure Step - Push SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.6.2
-  "Unified Procedure Step - Watch SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.6.3
-  "Unified Procedure Step - Pull SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.34.6.4
-  "Unified Procedure Step - Event SOP Class" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.37.1
-  "General Relevant Patient Information Query" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.37.2
-  "Breast Imaging Relevant Patient Information Query" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.37.3
-  "Cardiac Relevant Patient Information Query" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.38.1
-  "Hanging Protocol Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.38.2
-  "Hanging Protocol Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.38.3
-  "Hanging Protocol Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.38.4
-  "Hanging Protocol Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.39.1
-  "Color Palette Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.39.2
-  "Color Palette Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.39.3
-  "Color Palette Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.39.4
-  "Color Palette Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.43.1
-  "Generic Implant Template Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.43.2
-  "Generic Implant Template Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.43.3
-  "Generic Implant Template Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.43.4
-  "Generic Implant Template Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.44.1
-  "Implant Assembly Template Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.44.2
-  "Implant Assembly Template Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.44.3
-  "Implant Assembly Template Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.44.4
-  "Implant Assembly Template Information Model - GET" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.45.1
-  "Implant Template Group Storage" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.45.2
-  "Implant Template Group Information Model - FIND" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.45.3
-  "Implant Template Group Information Model - MOVE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.5.1.4.45.4
-  "Implant Template Group Information Model - GET" },
+{ 0, 0, 0, 0, 9950 }, // 1.2.840.10008.5.1.4.1.2.1.1
+{ 0, 0, 0, 0, 10003 }, // 1.2.840.10008.5.1.4.1.2.1.2
+{ 0, 0, 0, 0, 10056 }, // 1.2.840.10008.5.1.4.1.2.1.3
+{ 0, 0, 0, 0, 10108 }, // 1.2.840.10008.5.1.4.1.2.2.1
+{ 0, 0, 0, 0, 10159 }, // 1.2.840.10008.5.1.4.1.2.2.2
+{ 0, 0, 0, 0, 10210 }, // 1.2.840.10008.5.1.4.1.2.2.3
+{ 0, 0, 0, 0, 10260 }, // 1.2.840.10008.5.1.4.1.2.3.1 (Retired)
+{ 0, 0, 0, 0, 10319 }, // 1.2.840.10008.5.1.4.1.2.3.2 (Retired)
+{ 0, 0, 0, 0, 10378 }, // 1.2.840.10008.5.1.4.1.2.3.3 (Retired)
+{ 0, 0, 0, 0, 10436 }, // 1.2.840.10008.5.1.4.1.2.4.2
+{ 0, 0, 0, 0, 10476 }, // 1.2.840.10008.5.1.4.1.2.4.3
+{ 0, 0, 0, 0, 10515 }, // 1.2.840.10008.5.1.4.1.2.5.3
+{ 0, 0, 0, 0, 10567 }, // 1.2.840.10008.5.1.4.32.1 (Retired)
+{ 0, 0, 0, 0, 10617 }, // 1.2.840.10008.5.1.4.32.2 (Retired)
+{ 0, 0, 0, 0, 10668 }, // 1.2.840.10008.5.1.4.32.3 (Retired)
+{ 0, 0, 0, 0, 10719 }, // 1.2.840.10008.5.1.4.34.1 (Retired)
+{ 0, 0, 0, 0, 10765 }, // 1.2.840.10008.5.1.4.34.2 (Retired)
+{ 0, 0, 0, 0, 10810 }, // 1.2.840.10008.5.1.4.34.3 (Retired)
+{ 1192, 4, 1, 0, 10846 }, // 1.2.840.10008.5.1.4.34.4 (Retired)
+{ 1196, 1, 1, 0, 10904 }, // 1.2.840.10008.5.1.4.34.5
+{ 1197, 4, 1, 0, 10941 }, // 1.2.840.10008.5.1.4.34.6
+{ 0, 0, 0, 0, 10991 }, // 1.2.840.10008.5.1.4.34.7
+{ 0, 0, 0, 0, 11029 }, // 1.2.840.10008.5.1.4.34.8
+{ 0, 0, 0, 0, 11066 }, // 1.2.840.10008.5.1.4.34.9
+{ 0, 0, 0, 0, 11094 }, // 1.2.840.10008.5.1.4.34.10
+{ 0, 0, 0, 0, 11151 }, // 1.2.840.10008.5.1.4.34.4.1 (Retired)
+{ 0, 0, 0, 0, 11199 }, // 1.2.840.10008.5.1.4.34.4.2 (Retired)
+{ 0, 0, 0, 0, 11248 }, // 1.2.840.10008.5.1.4.34.4.3 (Retired)
+{ 0, 0, 0, 0, 11296 }, // 1.2.840.10008.5.1.4.34.4.4 (Retired)
+{ 0, 0, 0, 0, 11345 }, // 1.2.840.10008.5.1.4.34.5.1
+{ 0, 0, 0, 0, 11391 }, // 1.2.840.10008.5.1.4.34.6.1
+{ 0, 0, 0, 0, 11431 }, // 1.2.840.10008.5.1.4.34.6.2
+{ 0, 0, 0, 0, 11472 }, // 1.2.840.10008.5.1.4.34.6.3
+{ 0, 0, 0, 0, 11512 }, // 1.2.840.10008.5.1.4.34.6.4
+{ 0, 0, 0, 0, 11553 }, // 1.2.840.10008.5.1.4.37.1
+{ 0, 0, 0, 0, 11596 }, // 1.2.840.10008.5.1.4.37.2
+{ 0, 0, 0, 0, 11646 }, // 1.2.840.10008.5.1.4.37.3
+{ 0, 0, 0, 0, 11689 }, // 1.2.840.10008.5.1.4.38.1
+{ 0, 0, 0, 0, 11714 }, // 1.2.840.10008.5.1.4.38.2
+{ 0, 0, 0, 0, 11756 }, // 1.2.840.10008.5.1.4.38.3
+{ 0, 0, 0, 0, 11798 }, // 1.2.840.10008.5.1.4.38.4
+{ 0, 0, 0, 0, 11839 }, // 1.2.840.10008.5.1.4.39.1
+{ 0, 0, 0, 0, 11861 }, // 1.2.840.10008.5.1.4.39.2
+{ 0, 0, 0, 0, 11900 }, // 1.2.840.10008.5.1.4.39.3
+{ 0, 0, 0, 0, 11939 }, // 1.2.840.10008.5.1.4.39.4
+{ 0, 0, 0, 0, 11977 }, // 1.2.840.10008.5.1.4.43.1
+{ 0, 0, 0, 0, 12010 }, // 1.2.840.10008.5.1.4.43.2
+{ 0, 0, 0, 0, 12060 }, // 1.2.840.10008.5.1.4.43.3
+{ 0, 0, 0, 0, 12110 }, // 1.2.840.10008.5.1.4.43.4
+{ 0, 0, 0, 0, 12159 }, // 1.2.840.10008.5.1.4.44.1
+{ 0, 0, 0, 0, 12193 }, // 1.2.840.10008.5.1.4.44.2
+{ 0, 0, 0, 0, 12244 }, // 1.2.840.10008.5.1.4.44.3
+{ 0, 0, 0, 0, 12295 }, // 1.2.840.10008.5.1.4.44.4
+{ 0, 0, 0, 0, 12345 }, // 1.2.840.10008.5.1.4.45.1
+{ 0, 0, 0, 0, 12376 }, // 1.2.840.10008.5.1.4.45.2
+{ 0, 0, 0, 0, 12424 }, // 1.2.840.10008.5.1.4.45.3
+{ 0, 0, 0, 0, 12472 }, // 1.2.840.10008.5.1.4.45.4
 { 1225, 1120, 1, 0, 0 },
-{ 0, 0, 0, 2, // 1.2.840.10008.6.1.1
-  "Anatomic Modifier" },
-{ 0, 0, 0, 4, // 1.2.840.10008.6.1.2
-  "Anatomic Region" },
-{ 0, 0, 0, 5, // 1.2.840.10008.6.1.3
-  "Transducer Approach" },
-{ 0, 0, 0, 6, // 1.2.840.10008.6.1.4
-  "Transducer Orientation" },
-{ 0, 0, 0, 7, // 1.2.840.10008.6.1.5
-  "Ultrasound Beam Path" },
-{ 0, 0, 0, 8, // 1.2.840.10008.6.1.6
-  "Angiographic Interventional Devices" },
-{ 0, 0, 0, 9, // 1.2.840.10008.6.1.7
-  "Image Guided Therapeutic Procedures" },
-{ 0, 0, 0, 10, // 1.2.840.10008.6.1.8
-  "Interventional Drug" },
-{ 0, 0, 0, 11, // 1.2.840.10008.6.1.9
-  "Route of Administration" },
-{ 0, 0, 0, 12, // 1.2.840.10008.6.1.10
-  "Radiographic Contrast Agent" },
-{ 0, 0, 0, 13, // 1.2.840.10008.6.1.11
-  "Radiographic Contrast Agent Ingredient" },
-{ 0, 0, 0, 18, // 1.2.840.10008.6.1.12
-  "Isotopes in Radiopharmaceuticals" },
-{ 0, 0, 0, 19, // 1.2.840.10008.6.1.13
-  "Patient Orientation" },
-{ 0, 0, 0, 20, // 1.2.840.10008.6.1.14
-  "Patient Orientation Modifier" },
-{ 0, 0, 0, 21, // 1.2.840.10008.6.1.15
-  "Patient Equipment Relationship" },
-{ 0, 0, 0, 23, // 1.2.840.10008.6.1.16
-  "Cranio-Caudad Angulation" },
-{ 0, 0, 0, 25, // 1.2.840.10008.6.1.17
-  "Radiopharmaceuticals" },
-{ 0, 0, 0, 26, // 1.2.840.10008.6.1.18
-  "Nuclear Medicine Projections" },
-{ 0, 0, 0, 29, // 1.2.840.10008.6.1.19
-  "Acquisition Modality" },
-{ 0, 0, 0, 30, // 1.2.840.10008.6.1.20
-  "DICOM Devices" },
-{ 0, 0, 0, 31, // 1.2.840.10008.6.1.21
-  "Abstract Priors" },
-{ 0, 0, 0, 42, // 1.2.840.10008.6.1.22
-  "Numeric Value Qualifier" },
-{ 0, 0, 0, 82, // 1.2.840.10008.6.1.23
-  "Units of Measurement" },
-{ 0, 0, 0, 83, // 1.2.840.10008.6.1.24
-  "Units for Real World Value Mapping" },
-{ 0, 0, 0, 220, // 1.2.840.10008.6.1.25
-  "Level of Significance" },
-{ 0, 0, 0, 221, // 1.2.840.10008.6.1.26
-  "Measurement Range Concepts" },
-{ 0, 0, 0, 222, // 1.2.840.10008.6.1.27
-  "Normality Codes" },
-{ 0, 0, 0, 223, // 1.2.840.10008.6.1.28
-  "Normal Range Values" },
-{ 0, 0, 0, 224, // 1.2.840.10008.6.1.29
-  "Selection Method" },
-{ 0, 0, 0, 225, // 1.2.840.10008.6.1.30
-  "Measurement Uncertainty Concepts" },
-{ 0, 0, 0, 226, // 1.2.840.10008.6.1.31
-  "Population Statistical Descriptors" },
-{ 0, 0, 0, 227, // 1.2.840.10008.6.1.32
-  "Sample Statistical Descriptors" },
-{ 0, 0, 0, 228, // 1.2.840.10008.6.1.33
-  "Equation or Table" },
-{ 0, 0, 0, 230, // 1.2.840.10008.6.1.34
-  "Yes-No" },
-{ 0, 0, 0, 240, // 1.2.840.10008.6.1.35
-  "Present-Absent" },
-{ 0, 0, 0, 242, // 1.2.840.10008.6.1.36
-  "Normal-Abnormal" },
-{ 0, 0, 0, 244, // 1.2.840.10008.6.1.37
-  "Laterality" },
-{ 0, 0, 0, 250, // 1.2.840.10008.6.1.38
-  "Positive-Negative" },
-{ 0, 0, 0, 251, // 1.2.840.10008.6.1.39
-  "Severity of Complication" },
-{ 0, 0, 0, 270, // 1.2.840.10008.6.1.40
-  "Observer Type" },
-{ 0, 0, 0, 271, // 1.2.840.10008.6.1.41
-  "Observation Subject Class" },
-{ 0, 0, 0, 3000, // 1.2.840.10008.6.1.42
-  "Audio Channel Source" },
-{ 0, 0, 0, 3001, // 1.2.840.10008.6.1.43
-  "ECG Leads" },
-{ 0, 0, 0, 3003, // 1.2.840.10008.6.1.44
-  "Hemodynamic Waveform Sources" },
-{ 0, 0, 0, 3010, // 1.2.840.10008.6.1.45
-  "Cardiovascular Anatomic Locations" },
-{ 0, 0, 0, 3011, // 1.2.840.10008.6.1.46
-  "Electrophysiology Anatomic Locations" },
-{ 0, 0, 0, 3014, // 1.2.840.10008.6.1.47
-  "Coronary Artery Segments" },
-{ 0, 0, 0, 3015, // 1.2.840.10008.6.1.48
-  "Coronary Arteries" },
-{ 0, 0, 0, 3019, // 1.2.840.10008.6.1.49
-  "Cardiovascular Anatomic Location Modifiers" },
-{ 0, 0, 0, 3082, // 1.2.840.10008.6.1.50 (Retired)
-  "Cardiology Units of Measurement" },
-{ 0, 0, 0, 3090, // 1.2.840.10008.6.1.51
-  "Time Synchronization Channel Types" },
-{ 0, 0, 0, 3101, // 1.2.840.10008.6.1.52
-  "Cardiac Procedural State Values" },
-{ 0, 0, 0, 3240, // 1.2.840.10008.6.1.53
-  "Electrophysiology Measurement Functions and Techniques" },
-{ 0, 0, 0, 3241, // 1.2.840.10008.6.1.54
-  "Hemodynamic Measurement Techniques" },
-{ 0, 0, 0, 3250, // 1.2.840.10008.6.1.55
-  "Catheterization Procedure Phase" },
-{ 0, 0, 0, 3254, // 1.2.840.10008.6.1.56
-  "Electrophysiology Procedure Phase" },
-{ 0, 0, 0, 3261, // 1.2.840.10008.6.1.57
-  "Stress Protocols" },
-{ 0, 0, 0, 3262, // 1.2.840.10008.6.1.58
-  "ECG Patient State Values" },
-{ 0, 0, 0, 3263, // 1.2.840.10008.6.1.59
-  "Electrode Placement Values" },
-{ 0, 0, 0, 3264, // 1.2.840.10008.6.1.60 (Retired)
-  "XYZ Electrode Placement Values" },
-{ 0, 0, 0, 3271, // 1.2.840.10008.6.1.61
-  "Hemodynamic Physiological Challenges" },
-{ 0, 0, 0, 3335, // 1.2.840.10008.6.1.62
-  "ECG Annotations" },
-{ 0, 0, 0, 3337, // 1.2.840.10008.6.1.63
-  "Hemodynamic Annotations" },
-{ 0, 0, 0, 3339, // 1.2.840.10008.6.1.64
-  "Electrophysiology Annotations" },
-{ 0, 0, 0, 3400, // 1.2.840.10008.6.1.65
-  "Procedure Log Titles" },
-{ 0, 0, 0, 3401, // 1.2.840.10008.6.1.66
-  "Types of Log Notes" },
-{ 0, 0, 0, 3402, // 1.2.840.10008.6.1.67
-  "Patient Status and Events" },
-{ 0, 0, 0, 3403, // 1.2.840.10008.6.1.68
-  "Percutaneous Entry" },
-{ 0, 0, 0, 3404, // 1.2.840.10008.6.1.69
-  "Staff Actions" },
-{ 0, 0, 0, 3405, // 1.2.840.10008.6.1.70
-  "Procedure Action Values" },
-{ 0, 0, 0, 3406, // 1.2.840.10008.6.1.71
-  "Non-coronary Transcatheter Interventions" },
-{ 0, 0, 0, 3407, // 1.2.840.10008.6.1.72
-  "Purpose of Reference to Object" },
-{ 0, 0, 0, 3408, // 1.2.840.10008.6.1.73
-  "Actions With Consumables" },
-{ 0, 0, 0, 3409, // 1.2.840.10008.6.1.74
-  "Administration of Drugs/Contrast" },
-{ 0, 0, 0, 3410, // 1.2.840.10008.6.1.75
-  "Numeric Parameters of Drugs/Contrast" },
-{ 0, 0, 0, 3411, // 1.2.840.10008.6.1.76
-  "Intracoronary Devices" },
-{ 0, 0, 0, 3412, // 1.2.840.10008.6.1.77
-  "Intervention Actions and Status" },
-{ 0, 0, 0, 3413, // 1.2.840.10008.6.1.78
-  "Adverse Outcomes" },
-{ 0, 0, 0, 3414, // 1.2.840.10008.6.1.79
-  "Procedure Urgency" },
-{ 0, 0, 0, 3415, // 1.2.840.10008.6.1.80
-  "Cardiac Rhythms" },
-{ 0, 0, 0, 3416, // 1.2.840.10008.6.1.81
-  "Respiration Rhythms" },
-{ 0, 0, 0, 3418, // 1.2.840.10008.6.1.82
-  "Lesion Risk" },
-{ 0, 0, 0, 3419, // 1.2.840.10008.6.1.83
-  "Findings Titles" },
-{ 0, 0, 0, 3421, // 1.2.840.10008.6.1.84
-  "Procedure Action" },
-{ 0, 0, 0, 3422, // 1.2.840.10008.6.1.85
-  "Device Use Actions" },
-{ 0, 0, 0, 3423, // 1.2.840.10008.6.1.86
-  "Numeric Device Characteristics" },
-{ 0, 0, 0, 3425, // 1.2.840.10008.6.1.87
-  "Intervention Parameters" },
-{ 0, 0, 0, 3426, // 1.2.840.10008.6.1.88
-  "Consumables Parameters" },
-{ 0, 0, 0, 3427, // 1.2.840.10008.6.1.89
-  "Equipment Events" },
-{ 0, 0, 0, 3428, // 1.2.840.10008.6.1.90
-  "Imaging Procedures" },
-{ 0, 0, 0, 3429, // 1.2.840.10008.6.1.91
-  "Catheterization Devices" },
-{ 0, 0, 0, 3430, // 1.2.840.10008.6.1.92
-  "DateTime Qualifiers" },
-{ 0, 0, 0, 3440, // 1.2.840.10008.6.1.93
-  "Peripheral Pulse Locations" },
-{ 0, 0, 0, 3441, // 1.2.840.10008.6.1.94
-  "Patient Assessments" },
-{ 0, 0, 0, 3442, // 1.2.840.10008.6.1.95
-  "Peripheral Pulse Methods" },
-{ 0, 0, 0, 3446, // 1.2.840.10008.6.1.96
-  "Skin Condition" },
-{ 0, 0, 0, 3448, // 1.2.840.10008.6.1.97
-  "Airway Assessment" },
-{ 0, 0, 0, 3451, // 1.2.840.10008.6.1.98
-  "Calibration Objects" },
-{ 0, 0, 0, 3452, // 1.2.840.10008.6.1.99
-  "Calibration Methods" },
-{ 0, 0, 0, 3453, // 1.2.840.10008.6.1.100
-  "Cardiac Volume Methods" },
-{ 0, 0, 0, 3455, // 1.2.840.10008.6.1.101
-  "Index Methods" },
-{ 0, 0, 0, 3456, // 1.2.840.10008.6.1.102
-  "Sub-segment Methods" },
-{ 0, 0, 0, 3458, // 1.2.840.10008.6.1.103
-  "Contour Realignment" },
-{ 0, 0, 0, 3460, // 1.2.840.10008.6.1.104
-  "Circumferential Extent" },
-{ 0, 0, 0, 3461, // 1.2.840.10008.6.1.105
-  "Regional Extent" },
-{ 0, 0, 0, 3462, // 1.2.840.10008.6.1.106
-  "Chamber Identification" },
-{ 0, 0, 0, 3465, // 1.2.840.10008.6.1.107
-  "QA Reference Methods" },
-{ 0, 0, 0, 3466, // 1.2.840.10008.6.1.108
-  "Plane Identification" },
-{ 0, 0, 0, 3467, // 1.2.840.10008.6.1.109
-  "Ejection Fraction" },
-{ 0, 0, 0, 3468, // 1.2.840.10008.6.1.110
-  "ED Volume" },
-{ 0, 0, 0, 3469, // 1.2.840.10008.6.1.111
-  "ES Volume" },
-{ 0, 0, 0, 3470, // 1.2.840.10008.6.1.112
-  "Vessel Lumen Cross-sectional Area Calculation Methods" },
-{ 0, 0, 0, 3471, // 1.2.840.10008.6.1.113
-  "Estimated Volumes" },
-{ 0, 0, 0, 3472, // 1.2.840.10008.6.1.114
-  "Cardiac Contraction Phase" },
-{ 0, 0, 0, 3480, // 1.2.840.10008.6.1.115
-  "IVUS Procedure Phases" },
-{ 0, 0, 0, 3481, // 1.2.840.10008.6.1.116
-  "IVUS Distance Measurements" },
-{ 0, 0, 0, 3482, // 1.2.840.10008.6.1.117
-  "IVUS Area Measurements" },
-{ 0, 0, 0, 3483, // 1.2.840.10008.6.1.118
-  "IVUS Longitudinal Measurements" },
-{ 0, 0, 0, 3484, // 1.2.840.10008.6.1.119
-  "IVUS Indices and Ratios" },
-{ 0, 0, 0, 3485, // 1.2.840.10008.6.1.120
-  "IVUS Volume Measurements" },
-{ 0, 0, 0, 3486, // 1.2.840.10008.6.1.121
-  "Vascular Measurement Sites" },
-{ 0, 0, 0, 3487, // 1.2.840.10008.6.1.122
-  "Intravascular Volumetric Regions" },
-{ 0, 0, 0, 3488, // 1.2.840.10008.6.1.123
-  "Min/Max/Mean" },
-{ 0, 0, 0, 3489, // 1.2.840.10008.6.1.124
-  "Calcium Distribution" },
-{ 0, 0, 0, 3491, // 1.2.840.10008.6.1.125
-  "IVUS Lesion Morphologies" },
-{ 0, 0, 0, 3492, // 1.2.840.10008.6.1.126
-  "Vascular Dissection Classifications" },
-{ 0, 0, 0, 3493, // 1.2.840.10008.6.1.127
-  "IVUS Relative Stenosis Severities" },
-{ 0, 0, 0, 3494, // 1.2.840.10008.6.1.128
-  "IVUS Non Morphological Findings" },
-{ 0, 0, 0, 3495, // 1.2.840.10008.6.1.129
-  "IVUS Plaque Composition" },
-{ 0, 0, 0, 3496, // 1.2.840.10008.6.1.130
-  "IVUS Fiducial Points" },
-{ 0, 0, 0, 3497, // 1.2.840.10008.6.1.131
-  "IVUS Arterial Morphology" },
-{ 0, 0, 0, 3500, // 1.2.840.10008.6.1.132
-  "Pressure Units" },
-{ 0, 0, 0, 3502, // 1.2.840.10008.6.1.133
-  "Hemodynamic Resistance Units" },
-{ 0, 0, 0, 3503, // 1.2.840.10008.6.1.134
-  "Indexed Hemodynamic Resistance Units" },
-{ 0, 0, 0, 3510, // 1.2.840.10008.6.1.135
-  "Catheter Size Units" },
-{ 0, 0, 0, 3515, // 1.2.840.10008.6.1.136
-  "Specimen Collection" },
-{ 0, 0, 0, 3520, // 1.2.840.10008.6.1.137
-  "Blood Source Type" },
-{ 0, 0, 0, 3524, // 1.2.840.10008.6.1.138
-  "Blood Gas Pressures" },
-{ 0, 0, 0, 3525, // 1.2.840.10008.6.1.139
-  "Blood Gas Content" },
-{ 0, 0, 0, 3526, // 1.2.840.10008.6.1.140
-  "Blood Gas Saturation" },
-{ 0, 0, 0, 3527, // 1.2.840.10008.6.1.141
-  "Blood Base Excess" },
-{ 0, 0, 0, 3528, // 1.2.840.10008.6.1.142
-  "Blood pH" },
-{ 0, 0, 0, 3529, // 1.2.840.10008.6.1.143
-  "Arterial / Venous Content" },
-{ 0, 0, 0, 3530, // 1.2.840.10008.6.1.144
-  "Oxygen Administration Actions" },
-{ 0, 0, 0, 3531, // 1.2.840.10008.6.1.145
-  "Oxygen Administration" },
-{ 0, 0, 0, 3550, // 1.2.840.10008.6.1.146
-  "Circulatory Support Actions" },
-{ 0, 0, 0, 3551, // 1.2.840.10008.6.1.147
-  "Ventilation Actions" },
-{ 0, 0, 0, 3552, // 1.2.840.10008.6.1.148
-  "Pacing Actions" },
-{ 0, 0, 0, 3553, // 1.2.840.10008.6.1.149
-  "Circulatory Support" },
-{ 0, 0, 0, 3554, // 1.2.840.10008.6.1.150
-  "Ventilation" },
-{ 0, 0, 0, 3555, // 1.2.840.10008.6.1.151
-  "Pacing" },
-{ 0, 0, 0, 3560, // 1.2.840.10008.6.1.152
-  "Blood Pressure Methods" },
-{ 0, 0, 0, 3600, // 1.2.840.10008.6.1.153
-  "Relative Times" },
-{ 0, 0, 0, 3602, // 1.2.840.10008.6.1.154
-  "Hemodynamic Patient State" },
-{ 0, 0, 0, 3604, // 1.2.840.10008.6.1.155
-  "Arterial Lesion Locations" },
-{ 0, 0, 0, 3606, // 1.2.840.10008.6.1.156
-  "Arterial Source Locations" },
-{ 0, 0, 0, 3607, // 1.2.840.10008.6.1.157
-  "Venous Source Locations" },
-{ 0, 0, 0, 3608, // 1.2.840.10008.6.1.158
-  "Atrial Source Locations" },
-{ 0, 0, 0, 3609, // 1.2.840.10008.6.1.159
-  "Ventricular Source Locations" },
-{ 0, 0, 0, 3610, // 1.2.840.10008.6.1.160
-  "Gradient Source Locations" },
-{ 0, 0, 0, 3611, // 1.2.840.10008.6.1.161
-  "Pressure Measurements" },
-{ 0, 0, 0, 3612, // 1.2.840.10008.6.1.162
-  "Blood Velocity Measurements" },
-{ 0, 0, 0, 3613, // 1.2.840.10008.6.1.163
-  "Hemodynamic Time Measurements" },
-{ 0, 0, 0, 3614, // 1.2.840.10008.6.1.164
-  "Valve Areas, Non-mitral" },
-{ 0, 0, 0, 3615, // 1.2.840.10008.6.1.165
-  "Valve Areas" },
-{ 0, 0, 0, 3616, // 1.2.840.10008.6.1.166
-  "Hemodynamic Period Measurements" },
-{ 0, 0, 0, 3617, // 1.2.840.10008.6.1.167
-  "Valve Flows" },
-{ 0, 0, 0, 3618, // 1.2.840.10008.6.1.168
-  "Hemodynamic Flows" },
-{ 0, 0, 0, 3619, // 1.2.840.10008.6.1.169
-  "Hemodynamic Resistance Measurements" },
-{ 0, 0, 0, 3620, // 1.2.840.10008.6.1.170
-  "Hemodynamic Ratios" },
-{ 0, 0, 0, 3621, // 1.2.840.10008.6.1.171
-  "Fractional Flow Reserve" },
-{ 0, 0, 0, 3627, // 1.2.840.10008.6.1.172
-  "Measurement Type" },
-{ 0, 0, 0, 3628, // 1.2.840.10008.6.1.173
-  "Cardiac Output Methods" },
-{ 0, 0, 0, 3629, // 1.2.840.10008.6.1.174
-  "Procedure Intent" },
-{ 0, 0, 0, 3630, // 1.2.840.10008.6.1.175
-  "Cardiovascular Anatomic Locations" },
-{ 0, 0, 0, 3640, // 1.2.840.10008.6.1.176
-  "Hypertension" },
-{ 0, 0, 0, 3641, // 1.2.840.10008.6.1.177
-  "Hemodynamic Assessments" },
-{ 0, 0, 0, 3642, // 1.2.840.10008.6.1.178
-  "Degree Findings" },
-{ 0, 0, 0, 3651, // 1.2.840.10008.6.1.179
-  "Hemodynamic Measurement Phase" },
-{ 0, 0, 0, 3663, // 1.2.840.10008.6.1.180
-  "Body Surface Area Equations" },
-{ 0, 0, 0, 3664, // 1.2.840.10008.6.1.181
-  "Oxygen Consumption Equations and Tables" },
-{ 0, 0, 0, 3666, // 1.2.840.10008.6.1.182
-  "P50 Equations" },
-{ 0, 0, 0, 3667, // 1.2.840.10008.6.1.183
-  "Framingham Scores" },
-{ 0, 0, 0, 3668, // 1.2.840.10008.6.1.184
-  "Framingham Tables" },
-{ 0, 0, 0, 3670, // 1.2.840.10008.6.1.185
-  "ECG Procedure Types" },
-{ 0, 0, 0, 3671, // 1.2.840.10008.6.1.186
-  "Reason for ECG Exam" },
-{ 0, 0, 0, 3672, // 1.2.840.10008.6.1.187
-  "Pacemakers" },
-{ 0, 0, 0, 3673, // 1.2.840.10008.6.1.188 (Retired)
-  "Diagnosis" },
-{ 0, 0, 0, 3675, // 1.2.840.10008.6.1.189 (Retired)
-  "Other Filters" },
-{ 0, 0, 0, 3676, // 1.2.840.10008.6.1.190
-  "Lead Measurement Technique" },
-{ 0, 0, 0, 3677, // 1.2.840.10008.6.1.191
-  "Summary Codes ECG" },
-{ 0, 0, 0, 3678, // 1.2.840.10008.6.1.192
-  "QT Correction Algorithms" },
-{ 0, 0, 0, 3679, // 1.2.840.10008.6.1.193 (Retired)
-  "ECG Morphology Descriptions" },
-{ 0, 0, 0, 3680, // 1.2.840.10008.6.1.194
-  "ECG Lead Noise Descriptions" },
-{ 0, 0, 0, 3681, // 1.2.840.10008.6.1.195 (Retired)
-  "ECG Lead Noise Modifiers" },
-{ 0, 0, 0, 3682, // 1.2.840.10008.6.1.196 (Retired)
-  "Probability" },
-{ 0, 0, 0, 3683, // 1.2.840.10008.6.1.197 (Retired)
-  "Modifiers" },
-{ 0, 0, 0, 3684, // 1.2.840.10008.6.1.198 (Retired)
-  "Trend" },
-{ 0, 0, 0, 3685, // 1.2.840.10008.6.1.199 (Retired)
-  "Conjunctive Terms" },
-{ 0, 0, 0, 3686, // 1.2.840.10008.6.1.200 (Retired)
-  "ECG Interpretive Statements" },
-{ 0, 0, 0, 3687, // 1.2.840.10008.6.1.201
-  "Electrophysiology Waveform Durations" },
-{ 0, 0, 0, 3688, // 1.2.840.10008.6.1.202
-  "Electrophysiology Waveform Voltages" },
-{ 0, 0, 0, 3700, // 1.2.840.10008.6.1.203
-  "Cath Diagnosis" },
-{ 0, 0, 0, 3701, // 1.2.840.10008.6.1.204
-  "Cardiac Valves and Tracts" },
-{ 0, 0, 0, 3703, // 1.2.840.10008.6.1.205
-  "Wall Motion" },
-{ 0, 0, 0, 3704, // 1.2.840.10008.6.1.206
-  "Myocardium Wall Morphology Findings" },
-{ 0, 0, 0, 3705, // 1.2.840.10008.6.1.207
-  "Chamber Size" },
-{ 0, 0, 0, 3706, // 1.2.840.10008.6.1.208
-  "Overall Contractility" },
-{ 0, 0, 0, 3707, // 1.2.840.10008.6.1.209
-  "VSD Description" },
-{ 0, 0, 0, 3709, // 1.2.840.10008.6.1.210
-  "Aortic Root Description" },
-{ 0, 0, 0, 3710, // 1.2.840.10008.6.1.211
-  "Coronary Dominance" },
-{ 0, 0, 0, 3711, // 1.2.840.10008.6.1.212
-  "Valvular Abnormalities" },
-{ 0, 0, 0, 3712, // 1.2.840.10008.6.1.213
-  "Vessel Descriptors" },
-{ 0, 0, 0, 3713, // 1.2.840.10008.6.1.214
-  "TIMI Flow Characteristics" },
-{ 0, 0, 0, 3714, // 1.2.840.10008.6.1.215
-  "Thrombus" },
-{ 0, 0, 0, 3715, // 1.2.840.10008.6.1.216
-  "Lesion Margin" },
-{ 0, 0, 0, 3716, // 1.2.840.10008.6.1.217
-  "Severity" },
-{ 0, 0, 0, 3717, // 1.2.840.10008.6.1.218
-  "Myocardial Wall Segments" },
-{ 0, 0, 0, 3718, // 1.2.840.10008.6.1.219
-  "Myocardial Wall Segments in Projection" },
-{ 0, 0, 0, 3719, // 1.2.840.10008.6.1.220
-  "Canadian Clinical Classification" },
-{ 0, 0, 0, 3720, // 1.2.840.10008.6.1.221 (Retired)
-  "Cardiac History Dates" },
-{ 0, 0, 0, 3721, // 1.2.840.10008.6.1.222
-  "Cardiovascular Surgeries" },
-{ 0, 0, 0, 3722, // 1.2.840.10008.6.1.223
-  "Diabetic Therapy" },
-{ 0, 0, 0, 3723, // 1.2.840.10008.6.1.224
-  "MI Types" },
-{ 0, 0, 0, 3724, // 1.2.840.10008.6.1.225
-  "Smoking History" },
-{ 0, 0, 0, 3726, // 1.2.840.10008.6.1.226
-  "Indications for Coronary Intervention" },
-{ 0, 0, 0, 3727, // 1.2.840.10008.6.1.227
-  "Indications for Catheterization" },
-{ 0, 0, 0, 3728, // 1.2.840.10008.6.1.228
-  "Cath Findings" },
-{ 0, 0, 0, 3729, // 1.2.840.10008.6.1.229
-  "Admission Status" },
-{ 0, 0, 0, 3730, // 1.2.840.10008.6.1.230
-  "Insurance Payor" },
-{ 0, 0, 0, 3733, // 1.2.840.10008.6.1.231
-  "Primary Cause of Death" },
-{ 0, 0, 0, 3735, // 1.2.840.10008.6.1.232
-  "Acute Coronary Syndrome Time Period" },
-{ 0, 0, 0, 3736, // 1.2.840.10008.6.1.233
-  "NYHA Classification" },
-{ 0, 0, 0, 3737, // 1.2.840.10008.6.1.234
-  "Non-invasive Test - Ischemia" },
-{ 0, 0, 0, 3738, // 1.2.840.10008.6.1.235
-  "Pre-Cath Angina Type" },
-{ 0, 0, 0, 3739, // 1.2.840.10008.6.1.236
-  "Cath Procedure Type" },
-{ 0, 0, 0, 3740, // 1.2.840.10008.6.1.237
-  "Thrombolytic Administration" },
-{ 0, 0, 0, 3741, // 1.2.840.10008.6.1.238
-  "Medication Administration, Lab Visit" },
-{ 0, 0, 0, 3742, // 1.2.840.10008.6.1.239
-  "Medication Administration, PCI" },
-{ 0, 0, 0, 3743, // 1.2.840.10008.6.1.240
-  "Clopidogrel/Ticlopidine Administration" },
-{ 0, 0, 0, 3744, // 1.2.840.10008.6.1.241
-  "EF Testing Method" },
-{ 0, 0, 0, 3745, // 1.2.840.10008.6.1.242
-  "Calculation Method" },
-{ 0, 0, 0, 3746, // 1.2.840.10008.6.1.243
-  "Percutaneous Entry Site" },
-{ 0, 0, 0, 3747, // 1.2.840.10008.6.1.244
-  "Percutaneous Closure" },
-{ 0, 0, 0, 3748, // 1.2.840.10008.6.1.245
-  "Angiographic EF Testing Method" },
-{ 0, 0, 0, 3749, // 1.2.840.10008.6.1.246
-  "PCI Procedure Result" },
-{ 0, 0, 0, 3750, // 1.2.840.10008.6.1.247
-  "Previously Dilated Lesion" },
-{ 0, 0, 0, 3752, // 1.2.840.10008.6.1.248
-  "Guidewire Crossing" },
-{ 0, 0, 0, 3754, // 1.2.840.10008.6.1.249
-  "Vascular Complications" },
-{ 0, 0, 0, 3755, // 1.2.840.10008.6.1.250
-  "Cath Complications" },
-{ 0, 0, 0, 3756, // 1.2.840.10008.6.1.251
-  "Cardiac Patient Risk Factors" },
-{ 0, 0, 0, 3757, // 1.2.840.10008.6.1.252
-  "Cardiac Diagnostic Procedures" },
-{ 0, 0, 0, 3758, // 1.2.840.10008.6.1.253
-  "Cardiovascular Family History" },
-{ 0, 0, 0, 3760, // 1.2.840.10008.6.1.254
-  "Hypertension Therapy" },
-{ 0, 0, 0, 3761, // 1.2.840.10008.6.1.255
-  "Antilipemic Agents" },
-{ 0, 0, 0, 3762, // 1.2.840.10008.6.1.256
-  "Antiarrhythmic Agents" },
-{ 0, 0, 0, 3764, // 1.2.840.10008.6.1.257
-  "Myocardial Infarction Therapies" },
-{ 0, 0, 0, 3769, // 1.2.840.10008.6.1.258
-  "Concern Types" },
-{ 0, 0, 0, 3770, // 1.2.840.10008.6.1.259
-  "Problem Status" },
-{ 0, 0, 0, 3772, // 1.2.840.10008.6.1.260
-  "Health Status" },
-{ 0, 0, 0, 3773, // 1.2.840.10008.6.1.261
-  "Use Status" },
-{ 0, 0, 0, 3774, // 1.2.840.10008.6.1.262
-  "Social History" },
-{ 0, 0, 0, 3777, // 1.2.840.10008.6.1.263
-  "Implanted Devices" },
-{ 0, 0, 0, 3802, // 1.2.840.10008.6.1.264
-  "Plaque Structures" },
-{ 0, 0, 0, 3804, // 1.2.840.10008.6.1.265
-  "Stenosis Measurement Methods" },
-{ 0, 0, 0, 3805, // 1.2.840.10008.6.1.266
-  "Stenosis Types" },
-{ 0, 0, 0, 3806, // 1.2.840.10008.6.1.267
-  "Stenosis Shape" },
-{ 0, 0, 0, 3807, // 1.2.840.10008.6.1.268
-  "Volume Measurement Methods" },
-{ 0, 0, 0, 3808, // 1.2.840.10008.6.1.269
-  "Aneurysm Types" },
-{ 0, 0, 0, 3809, // 1.2.840.10008.6.1.270
-  "Associated Conditions" },
-{ 0, 0, 0, 3810, // 1.2.840.10008.6.1.271
-  "Vascular Morphology" },
-{ 0, 0, 0, 3813, // 1.2.840.10008.6.1.272
-  "Stent Findings" },
-{ 0, 0, 0, 3814, // 1.2.840.10008.6.1.273
-  "Stent Composition" },
-{ 0, 0, 0, 3815, // 1.2.840.10008.6.1.274
-  "Source of Vascular Finding" },
-{ 0, 0, 0, 3817, // 1.2.840.10008.6.1.275
-  "Vascular Sclerosis Types" },
-{ 0, 0, 0, 3820, // 1.2.840.10008.6.1.276
-  "Non-invasive Vascular Procedures" },
-{ 0, 0, 0, 3821, // 1.2.840.10008.6.1.277
-  "Papillary Muscle Included/Excluded" },
-{ 0, 0, 0, 3823, // 1.2.840.10008.6.1.278
-  "Respiratory Status" },
-{ 0, 0, 0, 3826, // 1.2.840.10008.6.1.279
-  "Heart Rhythm" },
-{ 0, 0, 0, 3827, // 1.2.840.10008.6.1.280
-  "Vessel Segments" },
-{ 0, 0, 0, 3829, // 1.2.840.10008.6.1.281
-  "Pulmonary Arteries" },
-{ 0, 0, 0, 3831, // 1.2.840.10008.6.1.282
-  "Stenosis Length" },
-{ 0, 0, 0, 3832, // 1.2.840.10008.6.1.283
-  "Stenosis Grade" },
-{ 0, 0, 0, 3833, // 1.2.840.10008.6.1.284
-  "Cardiac Ejection Fraction" },
-{ 0, 0, 0, 3835, // 1.2.840.10008.6.1.285
-  "Cardiac Volume Measurements" },
-{ 0, 0, 0, 3836, // 1.2.840.10008.6.1.286
-  "Time-based Perfusion Measurements" },
-{ 0, 0, 0, 3837, // 1.2.840.10008.6.1.287
-  "Fiducial Feature" },
-{ 0, 0, 0, 3838, // 1.2.840.10008.6.1.288
-  "Diameter Derivation" },
-{ 0, 0, 0, 3839, // 1.2.840.10008.6.1.289
-  "Coronary Veins" },
-{ 0, 0, 0, 3840, // 1.2.840.10008.6.1.290
-  "Pulmonary Veins" },
-{ 0, 0, 0, 3843, // 1.2.840.10008.6.1.291
-  "Myocardial Subsegment" },
-{ 0, 0, 0, 4005, // 1.2.840.10008.6.1.292
-  "Partial View Section for Mammography" },
-{ 0, 0, 0, 4009, // 1.2.840.10008.6.1.293
-  "DX Anatomy Imaged" },
-{ 0, 0, 0, 4010, // 1.2.840.10008.6.1.294
-  "DX View" },
-{ 0, 0, 0, 4011, // 1.2.840.10008.6.1.295
-  "DX View Modifier" },
-{ 0, 0, 0, 4012, // 1.2.840.10008.6.1.296
-  "Projection Eponymous Name" },
-{ 0, 0, 0, 4013, // 1.2.840.10008.6.1.297
-  "Anatomic Region for Mammography" },
-{ 0, 0, 0, 4014, // 1.2.840.10008.6.1.298
-  "View for Mammography" },
-{ 0, 0, 0, 4015, // 1.2.840.10008.6.1.299
-  "View Modifier for Mammography" },
-{ 0, 0, 0, 4016, // 1.2.840.10008.6.1.300
-  "Anatomic Region for Intra-oral Radiography" },
-{ 0, 0, 0, 4017, // 1.2.840.10008.6.1.301
-  "Anatomic Region Modifier for Intra-oral Radiography" },
-{ 0, 0, 0, 4018, // 1.2.840.10008.6.1.302
-  "Primary Anatomic Structure for Intra-oral Radiography (Permanent Dentition - Designation of Teeth)" },
-{ 0, 0, 0, 4019, // 1.2.840.10008.6.1.303
-  "Primary Anatomic Structure for Intra-oral Radiography (Deciduous Dentition - Designation of Teeth)" },
-{ 0, 0, 0, 4020, // 1.2.840.10008.6.1.304
-  "PET Radionuclide" },
-{ 0, 0, 0, 4021, // 1.2.840.10008.6.1.305
-  "PET Radiopharmaceutical" },
-{ 0, 0, 0, 4028, // 1.2.840.10008.6.1.306
-  "Craniofacial Anatomic Regions" },
-{ 0, 0, 0, 4030, // 1.2.840.10008.6.1.307
-  "CT, MR and PET Anatomy Imaged" },
-{ 0, 0, 0, 4031, // 1.2.840.10008.6.1.308
-  "Common Anatomic Regions" },
-{ 0, 0, 0, 4032, // 1.2.840.10008.6.1.309
-  "MR Spectroscopy Metabolites" },
-{ 0, 0, 0, 4033, // 1.2.840.10008.6.1.310
-  "MR Proton Spectroscopy Metabolites" },
-{ 0, 0, 0, 4040, // 1.2.840.10008.6.1.311
-  "Endoscopy Anatomic Regions" },
-{ 0, 0, 0, 4042, // 1.2.840.10008.6.1.312
-  "XA/XRF Anatomy Imaged" },
-{ 0, 0, 0, 4050, // 1.2.840.10008.6.1.313
-  "Drug or Contrast Agent Characteristics" },
-{ 0, 0, 0, 4051, // 1.2.840.10008.6.1.314
-  "General Devices" },
-{ 0, 0, 0, 4052, // 1.2.840.10008.6.1.315
-  "Phantom Devices" },
-{ 0, 0, 0, 4200, // 1.2.840.10008.6.1.316
-  "Ophthalmic Imaging Agent" },
-{ 0, 0, 0, 4201, // 1.2.840.10008.6.1.317
-  "Patient Eye Movement Command" },
-{ 0, 0, 0, 4202, // 1.2.840.10008.6.1.318
-  "Ophthalmic Photography Acquisition Device" },
-{ 0, 0, 0, 4203, // 1.2.840.10008.6.1.319
-  "Ophthalmic Photography Illumination" },
-{ 0, 0, 0, 4204, // 1.2.840.10008.6.1.320
-  "Ophthalmic Filter" },
-{ 0, 0, 0, 4205, // 1.2.840.10008.6.1.321
-  "Ophthalmic Lens" },
-{ 0, 0, 0, 4206, // 1.2.840.10008.6.1.322
-  "Ophthalmic Channel Description" },
-{ 0, 0, 0, 4207, // 1.2.840.10008.6.1.323
-  "Ophthalmic Image Position" },
-{ 0, 0, 0, 4208, // 1.2.840.10008.6.1.324
-  "Mydriatic Agent" },
-{ 0, 0, 0, 4209, // 1.2.840.10008.6.1.325
-  "Ophthalmic Anatomic Structure Imaged" },
-{ 0, 0, 0, 4210, // 1.2.840.10008.6.1.326
-  "Ophthalmic Tomography Acquisition Device" },
-{ 0, 0, 0, 4211, // 1.2.840.10008.6.1.327
-  "Ophthalmic OCT Anatomic Structure Imaged" },
-{ 0, 0, 0, 5000, // 1.2.840.10008.6.1.328
-  "Languages" },
-{ 0, 0, 0, 5001, // 1.2.840.10008.6.1.329
-  "Countries" },
-{ 0, 0, 0, 6000, // 1.2.840.10008.6.1.330
-  "Overall Breast Composition" },
-{ 0, 0, 0, 6001, // 1.2.840.10008.6.1.331
-  "Overall Breast Composition from BI-RADS(R)" },
-{ 0, 0, 0, 6002, // 1.2.840.10008.6.1.332
-  "Change Since Last Mammogram or Prior Surgery" },
-{ 0, 0, 0, 6003, // 1.2.840.10008.6.1.333
-  "Change Since Last Mammogram or Prior Surgery from BI-RADS(R)" },
-{ 0, 0, 0, 6004, // 1.2.840.10008.6.1.334
-  "Mammography Characteristics of Shape" },
-{ 0, 0, 0, 6005, // 1.2.840.10008.6.1.335
-  "Characteristics of Shape from BI-RADS(R)" },
-{ 0, 0, 0, 6006, // 1.2.840.10008.6.1.336
-  "Mammography Characteristics of Margin" },
-{ 0, 0, 0, 6007, // 1.2.840.10008.6.1.337
-  "Characteristics of Margin from BI-RADS(R)" },
-{ 0, 0, 0, 6008, // 1.2.840.10008.6.1.338
-  "Density Modifier" },
-{ 0, 0, 0, 6009, // 1.2.840.10008.6.1.339
-  "Density Modifier from BI-RADS(R)" },
-{ 0, 0, 0, 6010, // 1.2.840.10008.6.1.340
-  "Mammography Calcification Types" },
-{ 0, 0, 0, 6011, // 1.2.840.10008.6.1.341
-  "Calcification Types from BI-RADS(R)" },
-{ 0, 0, 0, 6012, // 1.2.840.10008.6.1.342
-  "Calcification Distribution Modifier" },
-{ 0, 0, 0, 6013, // 1.2.840.10008.6.1.343
-  "Calcification Distribution Modifier from BI-RADS(R)" },
-{ 0, 0, 0, 6014, // 1.2.840.10008.6.1.344
-  "Mammography Single Image Finding" },
-{ 0, 0, 0, 6015, // 1.2.840.10008.6.1.345
-  "Single Image Finding from BI-RADS(R)" },
-{ 0, 0, 0, 6016, // 1.2.840.10008.6.1.346
-  "Mammography Composite Feature" },
-{ 0, 0, 0, 6017, // 1.2.840.10008.6.1.347
-  "Composite Feature from BI-RADS(R)" },
-{ 0, 0, 0, 6018, // 1.2.840.10008.6.1.348
-  "Clockface Location or Region" },
-{ 0, 0, 0, 6019, // 1.2.840.10008.6.1.349
-  "Clockface Location or Region from BI-RADS(R)" },
-{ 0, 0, 0, 6020, // 1.2.840.10008.6.1.350
-  "Quadrant Location" },
-{ 0, 0, 0, 6021, // 1.2.840.10008.6.1.351
-  "Quadrant Location from BI-RADS(R)" },
-{ 0, 0, 0, 6022, // 1.2.840.10008.6.1.352
-  "Side" },
-{ 0, 0, 0, 6023, // 1.2.840.10008.6.1.353
-  "Side from BI-RADS(R)" },
-{ 0, 0, 0, 6024, // 1.2.840.10008.6.1.354
-  "Depth" },
-{ 0, 0, 0, 6025, // 1.2.840.10008.6.1.355
-  "Depth from BI-RADS(R)" },
-{ 0, 0, 0, 6026, // 1.2.840.10008.6.1.356
-  "Mammography Assessment" },
-{ 0, 0, 0, 6027, // 1.2.840.10008.6.1.357
-  "Assessment from BI-RADS(R)" },
-{ 0, 0, 0, 6028, // 1.2.840.10008.6.1.358
-  "Mammography Recommended Follow-up" },
-{ 0, 0, 0, 6029, // 1.2.840.10008.6.1.359
-  "Recommended Follow-up from BI-RADS(R)" },
-{ 0, 0, 0, 6030, // 1.2.840.10008.6.1.360
-  "Mammography Pathology Codes" },
-{ 0, 0, 0, 6031, // 1.2.840.10008.6.1.361
-  "Benign Pathology Codes from BI-RADS(R)" },
-{ 0, 0, 0, 6032, // 1.2.840.10008.6.1.362
-  "High Risk Lesions Pathology Codes from BI-RADS(R)" },
-{ 0, 0, 0, 6033, // 1.2.840.10008.6.1.363
-  "Malignant Pathology Codes from BI-RADS(R)" },
-{ 0, 0, 0, 6034, // 1.2.840.10008.6.1.364
-  "Intended Use of CAD Output" },
-{ 0, 0, 0, 6035, // 1.2.840.10008.6.1.365
-  "Composite Feature Relations" },
-{ 0, 0, 0, 6036, // 1.2.840.10008.6.1.366
-  "Scope of Feature" },
-{ 0, 0, 0, 6037, // 1.2.840.10008.6.1.367
-  "Mammography Quantitative Temporal Difference Type" },
-{ 0, 0, 0, 6038, // 1.2.840.10008.6.1.368
-  "Mammography Qualitative Temporal Difference Type" },
-{ 0, 0, 0, 6039, // 1.2.840.10008.6.1.369
-  "Nipple Characteristic" },
-{ 0, 0, 0, 6040, // 1.2.840.10008.6.1.370
-  "Non-lesion Object Type" },
-{ 0, 0, 0, 6041, // 1.2.840.10008.6.1.371
-  "Mammography Image Quality Finding" },
-{ 0, 0, 0, 6042, // 1.2.840.10008.6.1.372
-  "Status of Results" },
-{ 0, 0, 0, 6043, // 1.2.840.10008.6.1.373
-  "Types of Mammography CAD Analysis" },
-{ 0, 0, 0, 6044, // 1.2.840.10008.6.1.374
-  "Types of Image Quality Assessment" },
-{ 0, 0, 0, 6045, // 1.2.840.10008.6.1.375
-  "Mammography Types of Quality Control Standard" },
-{ 0, 0, 0, 6046, // 1.2.840.10008.6.1.376
-  "Units of Follow-up Interval" },
-{ 0, 0, 0, 6047, // 1.2.840.10008.6.1.377
-  "CAD Processing and Findings Summary" },
-{ 0, 0, 0, 6048, // 1.2.840.10008.6.1.378
-  "CAD Operating Point Axis Label" },
-{ 0, 0, 0, 6050, // 1.2.840.10008.6.1.379
-  "Breast Procedure Reported" },
-{ 0, 0, 0, 6051, // 1.2.840.10008.6.1.380
-  "Breast Procedure Reason" },
-{ 0, 0, 0, 6052, // 1.2.840.10008.6.1.381
-  "Breast Imaging Report Section Title" },
-{ 0, 0, 0, 6053, // 1.2.840.10008.6.1.382
-  "Breast Imaging Report Elements" },
-{ 0, 0, 0, 6054, // 1.2.840.10008.6.1.383
-  "Breast Imaging Findings" },
-{ 0, 0, 0, 6055, // 1.2.840.10008.6.1.384
-  "Breast Clinical Finding or Indicated Problem" },
-{ 0, 0, 0, 6056, // 1.2.840.10008.6.1.385
-  "Associated Findings for Breast" },
-{ 0, 0, 0, 6057, // 1.2.840.10008.6.1.386
-  "Ductography Findings for Breast" },
-{ 0, 0, 0, 6058, // 1.2.840.10008.6.1.387
-  "Procedure Modifiers for Breast" },
-{ 0, 0, 0, 6059, // 1.2.840.10008.6.1.388
-  "Breast Implant Types" },
-{ 0, 0, 0, 6060, // 1.2.840.10008.6.1.389
-  "Breast Biopsy Techniques" },
-{ 0, 0, 0, 6061, // 1.2.840.10008.6.1.390
-  "Breast Imaging Procedure Modifiers" },
-{ 0, 0, 0, 6062, // 1.2.840.10008.6.1.391
-  "Interventional Procedure Complications" },
-{ 0, 0, 0, 6063, // 1.2.840.10008.6.1.392
-  "Interventional Procedure Results" },
-{ 0, 0, 0, 6064, // 1.2.840.10008.6.1.393
-  "Ultrasound Findings for Breast" },
-{ 0, 0, 0, 6065, // 1.2.840.10008.6.1.394
-  "Instrument Approach" },
-{ 0, 0, 0, 6066, // 1.2.840.10008.6.1.395
-  "Target Confirmation" },
-{ 0, 0, 0, 6067, // 1.2.840.10008.6.1.396
-  "Fluid Color" },
-{ 0, 0, 0, 6068, // 1.2.840.10008.6.1.397
-  "Tumor Stages From AJCC" },
-{ 0, 0, 0, 6069, // 1.2.840.10008.6.1.398
-  "Nottingham Combined Histologic Grade" },
-{ 0, 0, 0, 6070, // 1.2.840.10008.6.1.399
-  "Bloom-Richardson Histologic Grade" },
-{ 0, 0, 0, 6071, // 1.2.840.10008.6.1.400
-  "Histologic Grading Method" },
-{ 0, 0, 0, 6072, // 1.2.840.10008.6.1.401
-  "Breast Implant Findings" },
-{ 0, 0, 0, 6080, // 1.2.840.10008.6.1.402
-  "Gynecological Hormones" },
-{ 0, 0, 0, 6081, // 1.2.840.10008.6.1.403
-  "Breast Cancer Risk Factors" },
-{ 0, 0, 0, 6082, // 1.2.840.10008.6.1.404
-  "Gynecological Procedures" },
-{ 0, 0, 0, 6083, // 1.2.840.10008.6.1.405
-  "Procedures for Breast" },
-{ 0, 0, 0, 6084, // 1.2.840.10008.6.1.406
-  "Mammoplasty Procedures" },
-{ 0, 0, 0, 6085, // 1.2.840.10008.6.1.407
-  "Therapies for Breast" },
-{ 0, 0, 0, 6086, // 1.2.840.10008.6.1.408
-  "Menopausal Phase" },
-{ 0, 0, 0, 6087, // 1.2.840.10008.6.1.409
-  "General Risk Factors" },
-{ 0, 0, 0, 6088, // 1.2.840.10008.6.1.410
-  "OB-GYN Maternal Risk Factors" },
-{ 0, 0, 0, 6089, // 1.2.840.10008.6.1.411
-  "Substances" },
-{ 0, 0, 0, 6090, // 1.2.840.10008.6.1.412
-  "Relative Usage, Exposure Amount" },
-{ 0, 0, 0, 6091, // 1.2.840.10008.6.1.413
-  "Relative Frequency of Event Values" },
-{ 0, 0, 0, 6092, // 1.2.840.10008.6.1.414
-  "Quantitative Concepts for Usage, Exposure" },
-{ 0, 0, 0, 6093, // 1.2.840.10008.6.1.415
-  "Qualitative Concepts for Usage, Exposure Amount" },
-{ 0, 0, 0, 6094, // 1.2.840.10008.6.1.416
-  "Qualitative Concepts for Usage, Exposure Frequency" },
-{ 0, 0, 0, 6095, // 1.2.840.10008.6.1.417
-  "Numeric Properties of Procedures" },
-{ 0, 0, 0, 6096, // 1.2.840.10008.6.1.418
-  "Pregnancy Status" },
-{ 0, 0, 0, 6097, // 1.2.840.10008.6.1.419
-  "Side of Family" },
-{ 0, 0, 0, 6100, // 1.2.840.10008.6.1.420
-  "Chest Component Categories" },
-{ 0, 0, 0, 6101, // 1.2.840.10008.6.1.421
-  "Chest Finding or Feature" },
-{ 0, 0, 0, 6102, // 1.2.840.10008.6.1.422
-  "Chest Finding or Feature Modifier" },
-{ 0, 0, 0, 6103, // 1.2.840.10008.6.1.423
-  "Abnormal Lines Finding or Feature" },
-{ 0, 0, 0, 6104, // 1.2.840.10008.6.1.424
-  "Abnormal Opacity Finding or Feature" },
-{ 0, 0, 0, 6105, // 1.2.840.10008.6.1.425
-  "Abnormal Lucency Finding or Feature" },
-{ 0, 0, 0, 6106, // 1.2.840.10008.6.1.426
-  "Abnormal Texture Finding or Feature" },
-{ 0, 0, 0, 6107, // 1.2.840.10008.6.1.427
-  "Width Descriptor" },
-{ 0, 0, 0, 6108, // 1.2.840.10008.6.1.428
-  "Chest Anatomic Structure Abnormal Distribution" },
-{ 0, 0, 0, 6109, // 1.2.840.10008.6.1.429
-  "Radiographic Anatomy Finding or Feature" },
-{ 0, 0, 0, 6110, // 1.2.840.10008.6.1.430
-  "Lung Anatomy Finding or Feature" },
-{ 0, 0, 0, 6111, // 1.2.840.10008.6.1.431
-  "Bronchovascular Anatomy Finding or Feature" },
-{ 0, 0, 0, 6112, // 1.2.840.10008.6.1.432
-  "Pleura Anatomy Finding or Feature" },
-{ 0, 0, 0, 6113, // 1.2.840.10008.6.1.433
-  "Mediastinum Anatomy Finding or Feature" },
-{ 0, 0, 0, 6114, // 1.2.840.10008.6.1.434
-  "Osseous Anatomy Finding or Feature" },
-{ 0, 0, 0, 6115, // 1.2.840.10008.6.1.435
-  "Osseous Anatomy Modifiers" },
-{ 0, 0, 0, 6116, // 1.2.840.10008.6.1.436
-  "Muscular Anatomy" },
-{ 0, 0, 0, 6117, // 1.2.840.10008.6.1.437
-  "Vascular Anatomy" },
-{ 0, 0, 0, 6118, // 1.2.840.10008.6.1.438
-  "Size Descriptor" },
-{ 0, 0, 0, 6119, // 1.2.840.10008.6.1.439
-  "Chest Border Shape" },
-{ 0, 0, 0, 6120, // 1.2.840.10008.6.1.440
-  "Chest Border Definition" },
-{ 0, 0, 0, 6121, // 1.2.840.10008.6.1.441
-  "Chest Orientation Descriptor" },
-{ 0, 0, 0, 6122, // 1.2.840.10008.6.1.442
-  "Chest Content Descriptor" },
-{ 0, 0, 0, 6123, // 1.2.840.10008.6.1.443
-  "Chest Opacity Descriptor" },
-{ 0, 0, 0, 6124, // 1.2.840.10008.6.1.444
-  "Location in Chest" },
-{ 0, 0, 0, 6125, // 1.2.840.10008.6.1.445
-  "General Chest Location" },
-{ 0, 0, 0, 6126, // 1.2.840.10008.6.1.446
-  "Location in Lung" },
-{ 0, 0, 0, 6127, // 1.2.840.10008.6.1.447
-  "Segment Location in Lung" },
-{ 0, 0, 0, 6128, // 1.2.840.10008.6.1.448
-  "Chest Distribution Descriptor" },
-{ 0, 0, 0, 6129, // 1.2.840.10008.6.1.449
-  "Chest Site Involvement" },
-{ 0, 0, 0, 6130, // 1.2.840.10008.6.1.450
-  "Severity Descriptor" },
-{ 0, 0, 0, 6131, // 1.2.840.10008.6.1.451
-  "Chest Texture Descriptor" },
-{ 0, 0, 0, 6132, // 1.2.840.10008.6.1.452
-  "Chest Calcification Descriptor" },
-{ 0, 0, 0, 6133, // 1.2.840.10008.6.1.453
-  "Chest Quantitative Temporal Difference Type" },
-{ 0, 0, 0, 6134, // 1.2.840.10008.6.1.454
-  "Chest Qualitative Temporal Difference Type" },
-{ 0, 0, 0, 6135, // 1.2.840.10008.6.1.455
-  "Image Quality Finding" },
-{ 0, 0, 0, 6136, // 1.2.840.10008.6.1.456
-  "Chest Types of Quality Control Standard" },
-{ 0, 0, 0, 6137, // 1.2.840.10008.6.1.457
-  "Types of CAD Analysis" },
-{ 0, 0, 0, 6138, // 1.2.840.10008.6.1.458
-  "Chest Non-lesion Object Type" },
-{ 0, 0, 0, 6139, // 1.2.840.10008.6.1.459
-  "Non-lesion Modifiers" },
-{ 0, 0, 0, 6140, // 1.2.840.10008.6.1.460
-  "Calculation Methods" },
-{ 0, 0, 0, 6141, // 1.2.840.10008.6.1.461
-  "Attenuation Coefficient Measurements" },
-{ 0, 0, 0, 6142, // 1.2.840.10008.6.1.462
-  "Calculated Value" },
-{ 0, 0, 0, 6143, // 1.2.840.10008.6.1.463
-  "Lesion Response" },
-{ 0, 0, 0, 6144, // 1.2.840.10008.6.1.464
-  "RECIST Defined Lesion Response" },
-{ 0, 0, 0, 6145, // 1.2.840.10008.6.1.465
-  "Baseline Category" },
-{ 0, 0, 0, 6151, // 1.2.840.10008.6.1.466
-  "Background Echotexture" },
-{ 0, 0, 0, 6152, // 1.2.840.10008.6.1.467
-  "Orientation" },
-{ 0, 0, 0, 6153, // 1.2.840.10008.6.1.468
-  "Lesion Boundary" },
-{ 0, 0, 0, 6154, // 1.2.840.10008.6.1.469
-  "Echo Pattern" },
-{ 0, 0, 0, 6155, // 1.2.840.10008.6.1.470
-  "Posterior Acoustic Features" },
-{ 0, 0, 0, 6157, // 1.2.840.10008.6.1.471
-  "Vascularity" },
-{ 0, 0, 0, 6158, // 1.2.840.10008.6.1.472
-  "Correlation to Other Findings" },
-{ 0, 0, 0, 6159, // 1.2.840.10008.6.1.473
-  "Malignancy Type" },
-{ 0, 0, 0, 6160, // 1.2.840.10008.6.1.474
-  "Breast Primary Tumor Assessment From AJCC" },
-{ 0, 0, 0, 6161, // 1.2.840.10008.6.1.475
-  "Clinical Regional Lymph Node Assessment for Breast" },
-{ 0, 0, 0, 6162, // 1.2.840.10008.6.1.476
-  "Assessment of Metastasis for Breast" },
-{ 0, 0, 0, 6163, // 1.2.840.10008.6.1.477
-  "Menstrual Cycle Phase" },
-{ 0, 0, 0, 6164, // 1.2.840.10008.6.1.478
-  "Time Intervals" },
-{ 0, 0, 0, 6165, // 1.2.840.10008.6.1.479
-  "Breast Linear Measurements" },
-{ 0, 0, 0, 6166, // 1.2.840.10008.6.1.480
-  "CAD Geometry Secondary Graphical Representation" },
-{ 0, 0, 0, 7000, // 1.2.840.10008.6.1.481
-  "Diagnostic Imaging Report Document Titles" },
-{ 0, 0, 0, 7001, // 1.2.840.10008.6.1.482
-  "Diagnostic Imaging Report Headings" },
-{ 0, 0, 0, 7002, // 1.2.840.10008.6.1.483
-  "Diagnostic Imaging Report Elements" },
-{ 0, 0, 0, 7003, // 1.2.840.10008.6.1.484
-  "Diagnostic Imaging Report Purposes of Reference" },
-{ 0, 0, 0, 7004, // 1.2.840.10008.6.1.485
-  "Waveform Purposes of Reference" },
-{ 0, 0, 0, 7005, // 1.2.840.10008.6.1.486
-  "Contributing Equipment Purposes of Reference" },
-{ 0, 0, 0, 7006, // 1.2.840.10008.6.1.487
-  "SR Document Purposes of Reference" },
-{ 0, 0, 0, 7007, // 1.2.840.10008.6.1.488
-  "Signature Purpose" },
-{ 0, 0, 0, 7008, // 1.2.840.10008.6.1.489
-  "Media Import" },
-{ 0, 0, 0, 7010, // 1.2.840.10008.6.1.490
-  "Key Object Selection Document Title" },
-{ 0, 0, 0, 7011, // 1.2.840.10008.6.1.491
-  "Rejected for Quality Reasons" },
-{ 0, 0, 0, 7012, // 1.2.840.10008.6.1.492
-  "Best in Set" },
-{ 0, 0, 0, 7020, // 1.2.840.10008.6.1.493
-  "Document Titles" },
-{ 0, 0, 0, 7100, // 1.2.840.10008.6.1.494
-  "RCS Registration Method Type" },
-{ 0, 0, 0, 7101, // 1.2.840.10008.6.1.495
-  "Brain Atlas Fiducials" },
-{ 0, 0, 0, 7150, // 1.2.840.10008.6.1.496
-  "Segmentation Property Categories" },
-{ 0, 0, 0, 7151, // 1.2.840.10008.6.1.497
-  "Segmentation Property Types" },
-{ 0, 0, 0, 7152, // 1.2.840.10008.6.1.498
-  "Cardiac Structure Segmentation Types" },
-{ 0, 0, 0, 7153, // 1.2.840.10008.6.1.499
-  "CNS Tissue Segmentation Types" },
-{ 0, 0, 0, 7154, // 1.2.840.10008.6.1.500
-  "Abdominal Organ Segmentation Types" },
-{ 0, 0, 0, 7155, // 1.2.840.10008.6.1.501
-  "Thoracic Tissue Segmentation Types" },
-{ 0, 0, 0, 7156, // 1.2.840.10008.6.1.502
-  "Vascular Tissue Segmentation Types" },
-{ 0, 0, 0, 7157, // 1.2.840.10008.6.1.503
-  "Device Segmentation Types" },
-{ 0, 0, 0, 7158, // 1.2.840.10008.6.1.504
-  "Artifact Segmentation Types" },
-{ 0, 0, 0, 7159, // 1.2.840.10008.6.1.505
-  "Lesion Segmentation Types" },
-{ 0, 0, 0, 7160, // 1.2.840.10008.6.1.506
-  "Pelvic Organ Segmentation Types" },
-{ 0, 0, 0, 7161, // 1.2.840.10008.6.1.507
-  "Physiology Segmentation Types" },
-{ 0, 0, 0, 7201, // 1.2.840.10008.6.1.508
-  "Referenced Image Purposes of Reference" },
-{ 0, 0, 0, 7202, // 1.2.840.10008.6.1.509
-  "Source Image Purposes of Reference" },
-{ 0, 0, 0, 7203, // 1.2.840.10008.6.1.510
-  "Image Derivation" },
-{ 0, 0, 0, 7205, // 1.2.840.10008.6.1.511
-  "Purpose of Reference to Alternate Representation" },
-{ 0, 0, 0, 7210, // 1.2.840.10008.6.1.512
-  "Related Series Purposes of Reference" },
-{ 0, 0, 0, 7250, // 1.2.840.10008.6.1.513
-  "Multi-Frame Subset Type" },
-{ 0, 0, 0, 7450, // 1.2.840.10008.6.1.514
-  "Person Roles" },
-{ 0, 0, 0, 7451, // 1.2.840.10008.6.1.515
-  "Family Member" },
-{ 0, 0, 0, 7452, // 1.2.840.10008.6.1.516
-  "Organizational Roles" },
-{ 0, 0, 0, 7453, // 1.2.840.10008.6.1.517
-  "Performing Roles" },
-{ 0, 0, 0, 7454, // 1.2.840.10008.6.1.518
-  "Animal Taxonomic Rank Values" },
-{ 0, 0, 0, 7455, // 1.2.840.10008.6.1.519
-  "Sex" },
-{ 0, 0, 0, 7456, // 1.2.840.10008.6.1.520
-  "Units of Measure for Age" },
-{ 0, 0, 0, 7460, // 1.2.840.10008.6.1.521
-  "Units of Linear Measurement" },
-{ 0, 0, 0, 7461, // 1.2.840.10008.6.1.522
-  "Units of Area Measurement" },
-{ 0, 0, 0, 7462, // 1.2.840.10008.6.1.523
-  "Units of Volume Measurement" },
-{ 0, 0, 0, 7470, // 1.2.840.10008.6.1.524
-  "Linear Measurements" },
-{ 0, 0, 0, 7471, // 1.2.840.10008.6.1.525
-  "Area Measurements" },
-{ 0, 0, 0, 7472, // 1.2.840.10008.6.1.526
-  "Volume Measurements" },
-{ 0, 0, 0, 7473, // 1.2.840.10008.6.1.527
-  "General Area Calculation Methods" },
-{ 0, 0, 0, 7474, // 1.2.840.10008.6.1.528
-  "General Volume Calculation Methods" },
-{ 0, 0, 0, 7480, // 1.2.840.10008.6.1.529
-  "Breed" },
-{ 0, 0, 0, 7481, // 1.2.840.10008.6.1.530
-  "Breed Registry" },
-{ 0, 0, 0, 9231, // 1.2.840.10008.6.1.531
-  "Workitem Definition" },
-{ 0, 0, 0, 9232, // 1.2.840.10008.6.1.532 (Retired)
-  "Non-DICOM Output Types" },
-{ 0, 0, 0, 9300, // 1.2.840.10008.6.1.533
-  "Procedure Discontinuation Reasons" },
-{ 0, 0, 0, 10000, // 1.2.840.10008.6.1.534
-  "Scope of Accumulation" },
-{ 0, 0, 0, 10001, // 1.2.840.10008.6.1.535
-  "UID Types" },
-{ 0, 0, 0, 10002, // 1.2.840.10008.6.1.536
-  "Irradiation Event Types" },
-{ 0, 0, 0, 10003, // 1.2.840.10008.6.1.537
-  "Equipment Plane Identification" },
-{ 0, 0, 0, 10004, // 1.2.840.10008.6.1.538
-  "Fluoro Modes" },
-{ 0, 0, 0, 10006, // 1.2.840.10008.6.1.539
-  "X-Ray Filter Materials" },
-{ 0, 0, 0, 10007, // 1.2.840.10008.6.1.540
-  "X-Ray Filter Types" },
-{ 0, 0, 0, 10008, // 1.2.840.10008.6.1.541
-  "Dose Related Distance Measurements" },
-{ 0, 0, 0, 10009, // 1.2.840.10008.6.1.542
-  "Measured/Calculated" },
-{ 0, 0, 0, 10010, // 1.2.840.10008.6.1.543
-  "Dose Measurement Devices" },
-{ 0, 0, 0, 10011, // 1.2.840.10008.6.1.544
-  "Effective Dose Evaluation Method" },
-{ 0, 0, 0, 10013, // 1.2.840.10008.6.1.545
-  "CT Acquisition Type" },
-{ 0, 0, 0, 10014, // 1.2.840.10008.6.1.546
-  "Contrast Imaging Technique" },
-{ 0, 0, 0, 10015, // 1.2.840.10008.6.1.547
-  "CT Dose Reference Authorities" },
-{ 0, 0, 0, 10016, // 1.2.840.10008.6.1.548
-  "Anode Target Material" },
-{ 0, 0, 0, 10017, // 1.2.840.10008.6.1.549
-  "X-Ray Grid" },
-{ 0, 0, 0, 12001, // 1.2.840.10008.6.1.550
-  "Ultrasound Protocol Types" },
-{ 0, 0, 0, 12002, // 1.2.840.10008.6.1.551
-  "Ultrasound Protocol Stage Types" },
-{ 0, 0, 0, 12003, // 1.2.840.10008.6.1.552
-  "OB-GYN Dates" },
-{ 0, 0, 0, 12004, // 1.2.840.10008.6.1.553
-  "Fetal Biometry Ratios" },
-{ 0, 0, 0, 12005, // 1.2.840.10008.6.1.554
-  "Fetal Biometry Measurements" },
-{ 0, 0, 0, 12006, // 1.2.840.10008.6.1.555
-  "Fetal Long Bones Biometry Measurements" },
-{ 0, 0, 0, 12007, // 1.2.840.10008.6.1.556
-  "Fetal Cranium" },
-{ 0, 0, 0, 12008, // 1.2.840.10008.6.1.557
-  "OB-GYN Amniotic Sac" },
-{ 0, 0, 0, 12009, // 1.2.840.10008.6.1.558
-  "Early Gestation Biometry Measurements" },
-{ 0, 0, 0, 12011, // 1.2.840.10008.6.1.559
-  "Ultrasound Pelvis and Uterus" },
-{ 0, 0, 0, 12012, // 1.2.840.10008.6.1.560
-  "OB Equations and Tables" },
-{ 0, 0, 0, 12013, // 1.2.840.10008.6.1.561
-  "Gestational Age Equations and Tables" },
-{ 0, 0, 0, 12014, // 1.2.840.10008.6.1.562
-  "OB Fetal Body Weight Equations and Tables" },
-{ 0, 0, 0, 12015, // 1.2.840.10008.6.1.563
-  "Fetal Growth Equations and Tables" },
-{ 0, 0, 0, 12016, // 1.2.840.10008.6.1.564
-  "Estimated Fetal Weight Percentile Equations and Tables" },
-{ 0, 0, 0, 12017, // 1.2.840.10008.6.1.565
-  "Growth Distribution Rank" },
-{ 0, 0, 0, 12018, // 1.2.840.10008.6.1.566
-  "OB-GYN Summary" },
-{ 0, 0, 0, 12019, // 1.2.840.10008.6.1.567
-  "OB-GYN Fetus Summary" },
-{ 0, 0, 0, 12101, // 1.2.840.10008.6.1.568
-  "Vascular Summary" },
-{ 0, 0, 0, 12102, // 1.2.840.10008.6.1.569
-  "Temporal Periods Relating to Procedure or Therapy" },
-{ 0, 0, 0, 12103, // 1.2.840.10008.6.1.570
-  "Vascular Ultrasound Anatomic Location" },
-{ 0, 0, 0, 12104, // 1.2.840.10008.6.1.571
-  "Extracranial Arteries" },
-{ 0, 0, 0, 12105, // 1.2.840.10008.6.1.572
-  "Intracranial Cerebral Vessels" },
-{ 0, 0, 0, 12106, // 1.2.840.10008.6.1.573
-  "Intracranial Cerebral Vessels (Unilateral)" },
-{ 0, 0, 0, 12107, // 1.2.840.10008.6.1.574
-  "Upper Extremity Arteries" },
-{ 0, 0, 0, 12108, // 1.2.840.10008.6.1.575
-  "Upper Extremity Veins" },
-{ 0, 0, 0, 12109, // 1.2.840.10008.6.1.576
-  "Lower Extremity Arteries" },
-{ 0, 0, 0, 12110, // 1.2.840.10008.6.1.577
-  "Lower Extremity Veins" },
-{ 0, 0, 0, 12111, // 1.2.840.10008.6.1.578
-  "Abdominal Arteries (Lateral)" },
-{ 0, 0, 0, 12112, // 1.2.840.10008.6.1.579
-  "Abdominal Arteries (Unilateral)" },
-{ 0, 0, 0, 12113, // 1.2.840.10008.6.1.580
-  "Abdominal Veins (Lateral)" },
-{ 0, 0, 0, 12114, // 1.2.840.10008.6.1.581
-  "Abdominal Veins (Unilateral)" },
-{ 0, 0, 0, 12115, // 1.2.840.10008.6.1.582
-  "Renal Vessels" },
-{ 0, 0, 0, 12116, // 1.2.840.10008.6.1.583
-  "Vessel Segment Modifiers" },
-{ 0, 0, 0, 12117, // 1.2.840.10008.6.1.584
-  "Vessel Branch Modifiers" },
-{ 0, 0, 0, 12119, // 1.2.840.10008.6.1.585
-  "Vascular Ultrasound Property" },
-{ 0, 0, 0, 12120, // 1.2.840.10008.6.1.586
-  "Blood Velocity Measurements by Ultrasound" },
-{ 0, 0, 0, 12121, // 1.2.840.10008.6.1.587
-  "Vascular Indices and Ratios" },
-{ 0, 0, 0, 12122, // 1.2.840.10008.6.1.588
-  "Other Vascular Properties" },
-{ 0, 0, 0, 12123, // 1.2.840.10008.6.1.589
-  "Carotid Ratios" },
-{ 0, 0, 0, 12124, // 1.2.840.10008.6.1.590
-  "Renal Ratios" },
-{ 0, 0, 0, 12140, // 1.2.840.10008.6.1.591
-  "Pelvic Vasculature Anatomical Location" },
-{ 0, 0, 0, 12141, // 1.2.840.10008.6.1.592
-  "Fetal Vasculature Anatomical Location" },
-{ 0, 0, 0, 12200, // 1.2.840.10008.6.1.593
-  "Echocardiography Left Ventricle" },
-{ 0, 0, 0, 12201, // 1.2.840.10008.6.1.594
-  "Left Ventricle Linear" },
-{ 0, 0, 0, 12202, // 1.2.840.10008.6.1.595
-  "Left Ventricle Volume" },
-{ 0, 0, 0, 12203, // 1.2.840.10008.6.1.596
-  "Left Ventricle Other" },
-{ 0, 0, 0, 12204, // 1.2.840.10008.6.1.597
-  "Echocardiography Right Ventricle" },
-{ 0, 0, 0, 12205, // 1.2.840.10008.6.1.598
-  "Echocardiography Left Atrium" },
-{ 0, 0, 0, 12206, // 1.2.840.10008.6.1.599
-  "Echocardiography Right Atrium" },
-{ 0, 0, 0, 12207, // 1.2.840.10008.6.1.600
-  "Echocardiography Mitral Valve" },
-{ 0, 0, 0, 12208, // 1.2.840.10008.6.1.601
-  "Echocardiography Tricuspid Valve" },
-{ 0, 0, 0, 12209, // 1.2.840.10008.6.1.602
-  "Echocardiography Pulmonic Valve" },
-{ 0, 0, 0, 12210, // 1.2.840.10008.6.1.603
-  "Echocardiography Pulmonary Artery" },
-{ 0, 0, 0, 12211, // 1.2.840.10008.6.1.604
-  "Echocardiography Aortic Valve" },
-{ 0, 0, 0, 12212, // 1.2.840.10008.6.1.605
-  "Echocardiography Aorta" },
-{ 0, 0, 0, 12214, // 1.2.840.10008.6.1.606
-  "Echocardiography Pulmonary Veins" },
-{ 0, 0, 0, 12215, // 1.2.840.10008.6.1.607
-  "Echocardiography Vena Cavae" },
-{ 0, 0, 0, 12216, // 1.2.840.10008.6.1.608
-  "Echocardiography Hepatic Veins" },
-{ 0, 0, 0, 12217, // 1.2.840.10008.6.1.609
-  "Echocardiography Cardiac Shunt" },
-{ 0, 0, 0, 12218, // 1.2.840.10008.6.1.610
-  "Echocardiography Congenital" },
-{ 0, 0, 0, 12219, // 1.2.840.10008.6.1.611
-  "Pulmonary Vein Modifiers" },
-{ 0, 0, 0, 12220, // 1.2.840.10008.6.1.612
-  "Echocardiography Common Measurements" },
-{ 0, 0, 0, 12221, // 1.2.840.10008.6.1.613
-  "Flow Direction" },
-{ 0, 0, 0, 12222, // 1.2.840.10008.6.1.614
-  "Orifice Flow Properties" },
-{ 0, 0, 0, 12223, // 1.2.840.10008.6.1.615
-  "Echocardiography Stroke Volume Origin" },
-{ 0, 0, 0, 12224, // 1.2.840.10008.6.1.616
-  "Ultrasound Image Modes" },
-{ 0, 0, 0, 12226, // 1.2.840.10008.6.1.617
-  "Echocardiography Image View" },
-{ 0, 0, 0, 12227, // 1.2.840.10008.6.1.618
-  "Echocardiography Measurement Method" },
-{ 0, 0, 0, 12228, // 1.2.840.10008.6.1.619
-  "Echocardiography Volume Methods" },
-{ 0, 0, 0, 12229, // 1.2.840.10008.6.1.620
-  "Echocardiography Area Methods" },
-{ 0, 0, 0, 12230, // 1.2.840.10008.6.1.621
-  "Gradient Methods" },
-{ 0, 0, 0, 12231, // 1.2.840.10008.6.1.622
-  "Volume Flow Methods" },
-{ 0, 0, 0, 12232, // 1.2.840.10008.6.1.623
-  "Myocardium Mass Methods" },
-{ 0, 0, 0, 12233, // 1.2.840.10008.6.1.624
-  "Cardiac Phase" },
-{ 0, 0, 0, 12234, // 1.2.840.10008.6.1.625
-  "Respiration State" },
-{ 0, 0, 0, 12235, // 1.2.840.10008.6.1.626
-  "Mitral Valve Anatomic Sites" },
-{ 0, 0, 0, 12236, // 1.2.840.10008.6.1.627
-  "Echo Anatomic Sites" },
-{ 0, 0, 0, 12237, // 1.2.840.10008.6.1.628
-  "Echocardiography Anatomic Site Modifiers" },
-{ 0, 0, 0, 12238, // 1.2.840.10008.6.1.629
-  "Wall Motion Scoring Schemes" },
-{ 0, 0, 0, 12239, // 1.2.840.10008.6.1.630
-  "Cardiac Output Properties" },
-{ 0, 0, 0, 12240, // 1.2.840.10008.6.1.631
-  "Left Ventricle Area" },
-{ 0, 0, 0, 12241, // 1.2.840.10008.6.1.632
-  "Tricuspid Valve Finding Sites" },
-{ 0, 0, 0, 12242, // 1.2.840.10008.6.1.633
-  "Aortic Valve Finding Sites" },
-{ 0, 0, 0, 12243, // 1.2.840.10008.6.1.634
-  "Left Ventricle Finding Sites" },
-{ 0, 0, 0, 12244, // 1.2.840.10008.6.1.635
-  "Congenital Finding Sites" },
-{ 0, 0, 0, 7162, // 1.2.840.10008.6.1.636
-  "Surface Processing Algorithm Families" },
-{ 0, 0, 0, 3207, // 1.2.840.10008.6.1.637
-  "Stress Test Procedure Phases" },
-{ 0, 0, 0, 3778, // 1.2.840.10008.6.1.638
-  "Stages" },
+{ 0, 0, 0, 2, 12519 }, // 1.2.840.10008.6.1.1
+{ 0, 0, 0, 4, 12537 }, // 1.2.840.10008.6.1.2
+{ 0, 0, 0, 5, 12553 }, // 1.2.840.10008.6.1.3
+{ 0, 0, 0, 6, 12573 }, // 1.2.840.10008.6.1.4
+{ 0, 0, 0, 7, 12596 }, // 1.2.840.10008.6.1.5
+{ 0, 0, 0, 8, 12617 }, // 1.2.840.10008.6.1.6
+{ 0, 0, 0, 9, 12653 }, // 1.2.840.10008.6.1.7
+{ 0, 0, 0, 10, 12689 }, // 1.2.840.10008.6.1.8
+{ 0, 0, 0, 11, 12709 }, // 1.2.840.10008.6.1.9
+{ 0, 0, 0, 12, 12733 }, // 1.2.840.10008.6.1.10
+{ 0, 0, 0, 13, 12761 }, // 1.2.840.10008.6.1.11
+{ 0, 0, 0, 18, 12800 }, // 1.2.840.10008.6.1.12
+{ 0, 0, 0, 19, 12833 }, // 1.2.840.10008.6.1.13
+{ 0, 0, 0, 20, 12853 }, // 1.2.840.10008.6.1.14
+{ 0, 0, 0, 21, 12882 }, // 1.2.840.10008.6.1.15
+{ 0, 0, 0, 23, 12913 }, // 1.2.840.10008.6.1.16
+{ 0, 0, 0, 25, 12938 }, // 1.2.840.10008.6.1.17
+{ 0, 0, 0, 26, 12959 }, // 1.2.840.10008.6.1.18
+{ 0, 0, 0, 29, 12988 }, // 1.2.840.10008.6.1.19
+{ 0, 0, 0, 30, 13009 }, // 1.2.840.10008.6.1.20
+{ 0, 0, 0, 31, 13023 }, // 1.2.840.10008.6.1.21
+{ 0, 0, 0, 42, 13039 }, // 1.2.840.10008.6.1.22
+{ 0, 0, 0, 82, 13063 }, // 1.2.840.10008.6.1.23
+{ 0, 0, 0, 83, 13084 }, // 1.2.840.10008.6.1.24
+{ 0, 0, 0, 220, 13119 }, // 1.2.840.10008.6.1.25
+{ 0, 0, 0, 221, 13141 }, // 1.2.840.10008.6.1.26
+{ 0, 0, 0, 222, 13168 }, // 1.2.840.10008.6.1.27
+{ 0, 0, 0, 223, 13184 }, // 1.2.840.10008.6.1.28
+{ 0, 0, 0, 224, 13204 }, // 1.2.840.10008.6.1.29
+{ 0, 0, 0, 225, 13221 }, // 1.2.840.10008.6.1.30
+{ 0, 0, 0, 226, 13254 }, // 1.2.840.10008.6.1.31
+{ 0, 0, 0, 227, 13289 }, // 1.2.840.10008.6.1.32
+{ 0, 0, 0, 228, 13320 }, // 1.2.840.10008.6.1.33
+{ 0, 0, 0, 230, 13338 }, // 1.2.840.10008.6.1.34
+{ 0, 0, 0, 240, 13345 }, // 1.2.840.10008.6.1.35
+{ 0, 0, 0, 242, 13360 }, // 1.2.840.10008.6.1.36
+{ 0, 0, 0, 244, 13376 }, // 1.2.840.10008.6.1.37
+{ 0, 0, 0, 250, 13387 }, // 1.2.840.10008.6.1.38
+{ 0, 0, 0, 251, 13405 }, // 1.2.840.10008.6.1.39
+{ 0, 0, 0, 270, 13430 }, // 1.2.840.10008.6.1.40
+{ 0, 0, 0, 271, 13444 }, // 1.2.840.10008.6.1.41
+{ 0, 0, 0, 3000, 13470 }, // 1.2.840.10008.6.1.42
+{ 0, 0, 0, 3001, 13491 }, // 1.2.840.10008.6.1.43
+{ 0, 0, 0, 3003, 13501 }, // 1.2.840.10008.6.1.44
+{ 0, 0, 0, 3010, 13530 }, // 1.2.840.10008.6.1.45
+{ 0, 0, 0, 3011, 13564 }, // 1.2.840.10008.6.1.46
+{ 0, 0, 0, 3014, 13601 }, // 1.2.840.10008.6.1.47
+{ 0, 0, 0, 3015, 13626 }, // 1.2.840.10008.6.1.48
+{ 0, 0, 0, 3019, 13644 }, // 1.2.840.10008.6.1.49
+{ 0, 0, 0, 3082, 13687 }, // 1.2.840.10008.6.1.50 (Retired)
+{ 0, 0, 0, 3090, 13719 }, // 1.2.840.10008.6.1.51
+{ 0, 0, 0, 3101, 13754 }, // 1.2.840.10008.6.1.52
+{ 0, 0, 0, 3240, 13786 }, // 1.2.840.10008.6.1.53
+{ 0, 0, 0, 3241, 13841 }, // 1.2.840.10008.6.1.54
+{ 0, 0, 0, 3250, 13876 }, // 1.2.840.10008.6.1.55
+{ 0, 0, 0, 3254, 13908 }, // 1.2.840.10008.6.1.56
+{ 0, 0, 0, 3261, 13942 }, // 1.2.840.10008.6.1.57
+{ 0, 0, 0, 3262, 13959 }, // 1.2.840.10008.6.1.58
+{ 0, 0, 0, 3263, 13984 }, // 1.2.840.10008.6.1.59
+{ 0, 0, 0, 3264, 14011 }, // 1.2.840.10008.6.1.60 (Retired)
+{ 0, 0, 0, 3271, 14042 }, // 1.2.840.10008.6.1.61
+{ 0, 0, 0, 3335, 14079 }, // 1.2.840.10008.6.1.62
+{ 0, 0, 0, 3337, 14095 }, // 1.2.840.10008.6.1.63
+{ 0, 0, 0, 3339, 14119 }, // 1.2.840.10008.6.1.64
+{ 0, 0, 0, 3400, 14149 }, // 1.2.840.10008.6.1.65
+{ 0, 0, 0, 3401, 14170 }, // 1.2.840.10008.6.1.66
+{ 0, 0, 0, 3402, 14189 }, // 1.2.840.10008.6.1.67
+{ 0, 0, 0, 3403, 14215 }, // 1.2.840.10008.6.1.68
+{ 0, 0, 0, 3404, 14234 }, // 1.2.840.10008.6.1.69
+{ 0, 0, 0, 3405, 14248 }, // 1.2.840.10008.6.1.70
+{ 0, 0, 0, 3406, 14272 }, // 1.2.840.10008.6.1.71
+{ 0, 0, 0, 3407, 14313 }, // 1.2.840.10008.6.1.72
+{ 0, 0, 0, 3408, 14344 }, // 1.2.840.10008.6.1.73
+{ 0, 0, 0, 3409, 14369 }, // 1.2.840.10008.6.1.74
+{ 0, 0, 0, 3410, 14402 }, // 1.2.840.10008.6.1.75
+{ 0, 0, 0, 3411, 14439 }, // 1.2.840.10008.6.1.76
+{ 0, 0, 0, 3412, 14461 }, // 1.2.840.10008.6.1.77
+{ 0, 0, 0, 3413, 14493 }, // 1.2.840.10008.6.1.78
+{ 0, 0, 0, 3414, 14510 }, // 1.2.840.10008.6.1.79
+{ 0, 0, 0, 3415, 14528 }, // 1.2.840.10008.6.1.80
+{ 0, 0, 0, 3416, 14544 }, // 1.2.840.10008.6.1.81
+{ 0, 0, 0, 3418, 14564 }, // 1.2.840.10008.6.1.82
+{ 0, 0, 0, 3419, 14576 }, // 1.2.840.10008.6.1.83
+{ 0, 0, 0, 3421, 14592 }, // 1.2.840.10008.6.1.84
+{ 0, 0, 0, 3422, 14609 }, // 1.2.840.10008.6.1.85
+{ 0, 0, 0, 3423, 14628 }, // 1.2.840.10008.6.1.86
+{ 0, 0, 0, 3425, 14659 }, // 1.2.840.10008.6.1.87
+{ 0, 0, 0, 3426, 14683 }, // 1.2.840.10008.6.1.88
+{ 0, 0, 0, 3427, 14706 }, // 1.2.840.10008.6.1.89
+{ 0, 0, 0, 3428, 14723 }, // 1.2.840.10008.6.1.90
+{ 0, 0, 0, 3429, 14742 }, // 1.2.840.10008.6.1.91
+{ 0, 0, 0, 3430, 14766 }, // 1.2.840.10008.6.1.92
+{ 0, 0, 0, 3440, 14786 }, // 1.2.840.10008.6.1.93
+{ 0, 0, 0, 3441, 14813 }, // 1.2.840.10008.6.1.94
+{ 0, 0, 0, 3442, 14833 }, // 1.2.840.10008.6.1.95
+{ 0, 0, 0, 3446, 14858 }, // 1.2.840.10008.6.1.96
+{ 0, 0, 0, 3448, 14873 }, // 1.2.840.10008.6.1.97
+{ 0, 0, 0, 3451, 14891 }, // 1.2.840.10008.6.1.98
+{ 0, 0, 0, 3452, 14911 }, // 1.2.840.10008.6.1.99
+{ 0, 0, 0, 3453, 14931 }, // 1.2.840.10008.6.1.100
+{ 0, 0, 0, 3455, 14954 }, // 1.2.840.10008.6.1.101
+{ 0, 0, 0, 3456, 14968 }, // 1.2.840.10008.6.1.102
+{ 0, 0, 0, 3458, 14988 }, // 1.2.840.10008.6.1.103
+{ 0, 0, 0, 3460, 15008 }, // 1.2.840.10008.6.1.104
+{ 0, 0, 0, 3461, 15031 }, // 1.2.840.10008.6.1.105
+{ 0, 0, 0, 3462, 15047 }, // 1.2.840.10008.6.1.106
+{ 0, 0, 0, 3465, 15070 }, // 1.2.840.10008.6.1.107
+{ 0, 0, 0, 3466, 15091 }, // 1.2.840.10008.6.1.108
+{ 0, 0, 0, 3467, 15112 }, // 1.2.840.10008.6.1.109
+{ 0, 0, 0, 3468, 15130 }, // 1.2.840.10008.6.1.110
+{ 0, 0, 0, 3469, 15140 }, // 1.2.840.10008.6.1.111
+{ 0, 0, 0, 3470, 15150 }, // 1.2.840.10008.6.1.112
+{ 0, 0, 0, 3471, 15204 }, // 1.2.840.10008.6.1.113
+{ 0, 0, 0, 3472, 15222 }, // 1.2.840.10008.6.1.114
+{ 0, 0, 0, 3480, 15248 }, // 1.2.840.10008.6.1.115
+{ 0, 0, 0, 3481, 15270 }, // 1.2.840.10008.6.1.116
+{ 0, 0, 0, 3482, 15297 }, // 1.2.840.10008.6.1.117
+{ 0, 0, 0, 3483, 15320 }, // 1.2.840.10008.6.1.118
+{ 0, 0, 0, 3484, 15351 }, // 1.2.840.10008.6.1.119
+{ 0, 0, 0, 3485, 15375 }, // 1.2.840.10008.6.1.120
+{ 0, 0, 0, 3486, 15400 }, // 1.2.840.10008.6.1.121
+{ 0, 0, 0, 3487, 15427 }, // 1.2.840.10008.6.1.122
+{ 0, 0, 0, 3488, 15460 }, // 1.2.840.10008.6.1.123
+{ 0, 0, 0, 3489, 15473 }, // 1.2.840.10008.6.1.124
+{ 0, 0, 0, 3491, 15494 }, // 1.2.840.10008.6.1.125
+{ 0, 0, 0, 3492, 15519 }, // 1.2.840.10008.6.1.126
+{ 0, 0, 0, 3493, 15555 }, // 1.2.840.10008.6.1.127
+{ 0, 0, 0, 3494, 15589 }, // 1.2.840.10008.6.1.128
+{ 0, 0, 0, 3495, 15621 }, // 1.2.840.10008.6.1.129
+{ 0, 0, 0, 3496, 15645 }, // 1.2.840.10008.6.1.130
+{ 0, 0, 0, 3497, 15666 }, // 1.2.840.10008.6.1.131
+{ 0, 0, 0, 3500, 15691 }, // 1.2.840.10008.6.1.132
+{ 0, 0, 0, 3502, 15706 }, // 1.2.840.10008.6.1.133
+{ 0, 0, 0, 3503, 15735 }, // 1.2.840.10008.6.1.134
+{ 0, 0, 0, 3510, 15772 }, // 1.2.840.10008.6.1.135
+{ 0, 0, 0, 3515, 15792 }, // 1.2.840.10008.6.1.136
+{ 0, 0, 0, 3520, 15812 }, // 1.2.840.10008.6.1.137
+{ 0, 0, 0, 3524, 15830 }, // 1.2.840.10008.6.1.138
+{ 0, 0, 0, 3525, 15850 }, // 1.2.840.10008.6.1.139
+{ 0, 0, 0, 3526, 15868 }, // 1.2.840.10008.6.1.140
+{ 0, 0, 0, 3527, 15889 }, // 1.2.840.10008.6.1.141
+{ 0, 0, 0, 3528, 15907 }, // 1.2.840.10008.6.1.142
+{ 0, 0, 0, 3529, 15916 }, // 1.2.840.10008.6.1.143
+{ 0, 0, 0, 3530, 15942 }, // 1.2.840.10008.6.1.144
+{ 0, 0, 0, 3531, 15972 }, // 1.2.840.10008.6.1.145
+{ 0, 0, 0, 3550, 15994 }, // 1.2.840.10008.6.1.146
+{ 0, 0, 0, 3551, 16022 }, // 1.2.840.10008.6.1.147
+{ 0, 0, 0, 3552, 16042 }, // 1.2.840.10008.6.1.148
+{ 0, 0, 0, 3553, 16057 }, // 1.2.840.10008.6.1.149
+{ 0, 0, 0, 3554, 16077 }, // 1.2.840.10008.6.1.150
+{ 0, 0, 0, 3555, 16089 }, // 1.2.840.10008.6.1.151
+{ 0, 0, 0, 3560, 16096 }, // 1.2.840.10008.6.1.152
+{ 0, 0, 0, 3600, 16119 }, // 1.2.840.10008.6.1.153
+{ 0, 0, 0, 3602, 16134 }, // 1.2.840.10008.6.1.154
+{ 0, 0, 0, 3604, 16160 }, // 1.2.840.10008.6.1.155
+{ 0, 0, 0, 3606, 16186 }, // 1.2.840.10008.6.1.156
+{ 0, 0, 0, 3607, 16212 }, // 1.2.840.10008.6.1.157
+{ 0, 0, 0, 3608, 16236 }, // 1.2.840.10008.6.1.158
+{ 0, 0, 0, 3609, 16260 }, // 1.2.840.10008.6.1.159
+{ 0, 0, 0, 3610, 16289 }, // 1.2.840.10008.6.1.160
+{ 0, 0, 0, 3611, 16315 }, // 1.2.840.10008.6.1.161
+{ 0, 0, 0, 3612, 16337 }, // 1.2.840.10008.6.1.162
+{ 0, 0, 0, 3613, 16365 }, // 1.2.840.10008.6.1.163
+{ 0, 0, 0, 3614, 16395 }, // 1.2.840.10008.6.1.164
+{ 0, 0, 0, 3615, 16419 }, // 1.2.840.10008.6.1.165
+{ 0, 0, 0, 3616, 16431 }, // 1.2.840.10008.6.1.166
+{ 0, 0, 0, 3617, 16463 }, // 1.2.840.10008.6.1.167
+{ 0, 0, 0, 3618, 16475 }, // 1.2.840.10008.6.1.168
+{ 0, 0, 0, 3619, 16493 }, // 1.2.840.10008.6.1.169
+{ 0, 0, 0, 3620, 16529 }, // 1.2.840.10008.6.1.170
+{ 0, 0, 0, 3621, 16548 }, // 1.2.840.10008.6.1.171
+{ 0, 0, 0, 3627, 16572 }, // 1.2.840.10008.6.1.172
+{ 0, 0, 0, 3628, 16589 }, // 1.2.840.10008.6.1.173
+{ 0, 0, 0, 3629, 16612 }, // 1.2.840.10008.6.1.174
+{ 0, 0, 0, 3630, 13530 }, // 1.2.840.10008.6.1.175
+{ 0, 0, 0, 3640, 16629 }, // 1.2.840.10008.6.1.176
+{ 0, 0, 0, 3641, 16642 }, // 1.2.840.10008.6.1.177
+{ 0, 0, 0, 3642, 16666 }, // 1.2.840.10008.6.1.178
+{ 0, 0, 0, 3651, 16682 }, // 1.2.840.10008.6.1.179
+{ 0, 0, 0, 3663, 16712 }, // 1.2.840.10008.6.1.180
+{ 0, 0, 0, 3664, 16740 }, // 1.2.840.10008.6.1.181
+{ 0, 0, 0, 3666, 16780 }, // 1.2.840.10008.6.1.182
+{ 0, 0, 0, 3667, 16794 }, // 1.2.840.10008.6.1.183
+{ 0, 0, 0, 3668, 16812 }, // 1.2.840.10008.6.1.184
+{ 0, 0, 0, 3670, 16830 }, // 1.2.840.10008.6.1.185
+{ 0, 0, 0, 3671, 16850 }, // 1.2.840.10008.6.1.186
+{ 0, 0, 0, 3672, 16870 }, // 1.2.840.10008.6.1.187
+{ 0, 0, 0, 3673, 16881 }, // 1.2.840.10008.6.1.188 (Retired)
+{ 0, 0, 0, 3675, 16891 }, // 1.2.840.10008.6.1.189 (Retired)
+{ 0, 0, 0, 3676, 16905 }, // 1.2.840.10008.6.1.190
+{ 0, 0, 0, 3677, 16932 }, // 1.2.840.10008.6.1.191
+{ 0, 0, 0, 3678, 16950 }, // 1.2.840.10008.6.1.192
+{ 0, 0, 0, 3679, 16975 }, // 1.2.840.10008.6.1.193 (Retired)
+{ 0, 0, 0, 3680, 17003 }, // 1.2.840.10008.6.1.194
+{ 0, 0, 0, 3681, 17031 }, // 1.2.840.10008.6.1.195 (Retired)
+{ 0, 0, 0, 3682, 17056 }, // 1.2.840.10008.6.1.196 (Retired)
+{ 0, 0, 0, 3683, 17068 }, // 1.2.840.10008.6.1.197 (Retired)
+{ 0, 0, 0, 3684, 17078 }, // 1.2.840.10008.6.1.198 (Retired)
+{ 0, 0, 0, 3685, 17084 }, // 1.2.840.10008.6.1.199 (Retired)
+{ 0, 0, 0, 3686, 17102 }, // 1.2.840.10008.6.1.200 (Retired)
+{ 0, 0, 0, 3687, 17130 }, // 1.2.840.10008.6.1.201
+{ 0, 0, 0, 3688, 17167 }, // 1.2.840.10008.6.1.202
+{ 0, 0, 0, 3700, 17203 }, // 1.2.840.10008.6.1.203
+{ 0, 0, 0, 3701, 17218 }, // 1.2.840.10008.6.1.204
+{ 0, 0, 0, 3703, 17244 }, // 1.2.840.10008.6.1.205
+{ 0, 0, 0, 3704, 17256 }, // 1.2.840.10008.6.1.206
+{ 0, 0, 0, 3705, 17292 }, // 1.2.840.10008.6.1.207
+{ 0, 0, 0, 3706, 17305 }, // 1.2.840.10008.6.1.208
+{ 0, 0, 0, 3707, 17327 }, // 1.2.840.10008.6.1.209
+{ 0, 0, 0, 3709, 17343 }, // 1.2.840.10008.6.1.210
+{ 0, 0, 0, 3710, 17367 }, // 1.2.840.10008.6.1.211
+{ 0, 0, 0, 3711, 17386 }, // 1.2.840.10008.6.1.212
+{ 0, 0, 0, 3712, 17409 }, // 1.2.840.10008.6.1.213
+{ 0, 0, 0, 3713, 17428 }, // 1.2.840.10008.6.1.214
+{ 0, 0, 0, 3714, 17454 }, // 1.2.840.10008.6.1.215
+{ 0, 0, 0, 3715, 17463 }, // 1.2.840.10008.6.1.216
+{ 0, 0, 0, 3716, 17477 }, // 1.2.840.10008.6.1.217
+{ 0, 0, 0, 3717, 17486 }, // 1.2.840.10008.6.1.218
+{ 0, 0, 0, 3718, 17511 }, // 1.2.840.10008.6.1.219
+{ 0, 0, 0, 3719, 17550 }, // 1.2.840.10008.6.1.220
+{ 0, 0, 0, 3720, 17583 }, // 1.2.840.10008.6.1.221 (Retired)
+{ 0, 0, 0, 3721, 17605 }, // 1.2.840.10008.6.1.222
+{ 0, 0, 0, 3722, 17630 }, // 1.2.840.10008.6.1.223
+{ 0, 0, 0, 3723, 17647 }, // 1.2.840.10008.6.1.224
+{ 0, 0, 0, 3724, 17656 }, // 1.2.840.10008.6.1.225
+{ 0, 0, 0, 3726, 17672 }, // 1.2.840.10008.6.1.226
+{ 0, 0, 0, 3727, 17710 }, // 1.2.840.10008.6.1.227
+{ 0, 0, 0, 3728, 17742 }, // 1.2.840.10008.6.1.228
+{ 0, 0, 0, 3729, 17756 }, // 1.2.840.10008.6.1.229
+{ 0, 0, 0, 3730, 17773 }, // 1.2.840.10008.6.1.230
+{ 0, 0, 0, 3733, 17789 }, // 1.2.840.10008.6.1.231
+{ 0, 0, 0, 3735, 17812 }, // 1.2.840.10008.6.1.232
+{ 0, 0, 0, 3736, 17848 }, // 1.2.840.10008.6.1.233
+{ 0, 0, 0, 3737, 17868 }, // 1.2.840.10008.6.1.234
+{ 0, 0, 0, 3738, 17897 }, // 1.2.840.10008.6.1.235
+{ 0, 0, 0, 3739, 17918 }, // 1.2.840.10008.6.1.236
+{ 0, 0, 0, 3740, 17938 }, // 1.2.840.10008.6.1.237
+{ 0, 0, 0, 3741, 17966 }, // 1.2.840.10008.6.1.238
+{ 0, 0, 0, 3742, 18003 }, // 1.2.840.10008.6.1.239
+{ 0, 0, 0, 3743, 18034 }, // 1.2.840.10008.6.1.240
+{ 0, 0, 0, 3744, 18073 }, // 1.2.840.10008.6.1.241
+{ 0, 0, 0, 3745, 18091 }, // 1.2.840.10008.6.1.242
+{ 0, 0, 0, 3746, 18110 }, // 1.2.840.10008.6.1.243
+{ 0, 0, 0, 3747, 18134 }, // 1.2.840.10008.6.1.244
+{ 0, 0, 0, 3748, 18155 }, // 1.2.840.10008.6.1.245
+{ 0, 0, 0, 3749, 18186 }, // 1.2.840.10008.6.1.246
+{ 0, 0, 0, 3750, 18207 }, // 1.2.840.10008.6.1.247
+{ 0, 0, 0, 3752, 18233 }, // 1.2.840.10008.6.1.248
+{ 0, 0, 0, 3754, 18252 }, // 1.2.840.10008.6.1.249
+{ 0, 0, 0, 3755, 18275 }, // 1.2.840.10008.6.1.250
+{ 0, 0, 0, 3756, 18294 }, // 1.2.840.10008.6.1.251
+{ 0, 0, 0, 3757, 18323 }, // 1.2.840.10008.6.1.252
+{ 0, 0, 0, 3758, 18353 }, // 1.2.840.10008.6.1.253
+{ 0, 0, 0, 3760, 18383 }, // 1.2.840.10008.6.1.254
+{ 0, 0, 0, 3761, 18404 }, // 1.2.840.10008.6.1.255
+{ 0, 0, 0, 3762, 18423 }, // 1.2.840.10008.6.1.256
+{ 0, 0, 0, 3764, 18445 }, // 1.2.840.10008.6.1.257
+{ 0, 0, 0, 3769, 18477 }, // 1.2.840.10008.6.1.258
+{ 0, 0, 0, 3770, 18491 }, // 1.2.840.10008.6.1.259
+{ 0, 0, 0, 3772, 18506 }, // 1.2.840.10008.6.1.260
+{ 0, 0, 0, 3773, 18520 }, // 1.2.840.10008.6.1.261
+{ 0, 0, 0, 3774, 18531 }, // 1.2.840.10008.6.1.262
+{ 0, 0, 0, 3777, 18546 }, // 1.2.840.10008.6.1.263
+{ 0, 0, 0, 3802, 18564 }, // 1.2.840.10008.6.1.264
+{ 0, 0, 0, 3804, 18582 }, // 1.2.840.10008.6.1.265
+{ 0, 0, 0, 3805, 18611 }, // 1.2.840.10008.6.1.266
+{ 0, 0, 0, 3806, 18626 }, // 1.2.840.10008.6.1.267
+{ 0, 0, 0, 3807, 18641 }, // 1.2.840.10008.6.1.268
+{ 0, 0, 0, 3808, 18668 }, // 1.2.840.10008.6.1.269
+{ 0, 0, 0, 3809, 18683 }, // 1.2.840.10008.6.1.270
+{ 0, 0, 0, 3810, 18705 }, // 1.2.840.10008.6.1.271
+{ 0, 0, 0, 3813, 18725 }, // 1.2.840.10008.6.1.272
+{ 0, 0, 0, 3814, 18740 }, // 1.2.840.10008.6.1.273
+{ 0, 0, 0, 3815, 18758 }, // 1.2.840.10008.6.1.274
+{ 0, 0, 0, 3817, 18785 }, // 1.2.840.10008.6.1.275
+{ 0, 0, 0, 3820, 18810 }, // 1.2.840.10008.6.1.276
+{ 0, 0, 0, 3821, 18843 }, // 1.2.840.10008.6.1.277
+{ 0, 0, 0, 3823, 18878 }, // 1.2.840.10008.6.1.278
+{ 0, 0, 0, 3826, 18897 }, // 1.2.840.10008.6.1.279
+{ 0, 0, 0, 3827, 18910 }, // 1.2.840.10008.6.1.280
+{ 0, 0, 0, 3829, 18926 }, // 1.2.840.10008.6.1.281
+{ 0, 0, 0, 3831, 18945 }, // 1.2.840.10008.6.1.282
+{ 0, 0, 0, 3832, 18961 }, // 1.2.840.10008.6.1.283
+{ 0, 0, 0, 3833, 18976 }, // 1.2.840.10008.6.1.284
+{ 0, 0, 0, 3835, 19002 }, // 1.2.840.10008.6.1.285
+{ 0, 0, 0, 3836, 19030 }, // 1.2.840.10008.6.1.286
+{ 0, 0, 0, 3837, 19064 }, // 1.2.840.10008.6.1.287
+{ 0, 0, 0, 3838, 19081 }, // 1.2.840.10008.6.1.288
+{ 0, 0, 0, 3839, 19101 }, // 1.2.840.10008.6.1.289
+{ 0, 0, 0, 3840, 19116 }, // 1.2.840.10008.6.1.290
+{ 0, 0, 0, 3843, 19132 }, // 1.2.840.10008.6.1.291
+{ 0, 0, 0, 4005, 19154 }, // 1.2.840.10008.6.1.292
+{ 0, 0, 0, 4009, 19191 }, // 1.2.840.10008.6.1.293
+{ 0, 0, 0, 4010, 19209 }, // 1.2.840.10008.6.1.294
+{ 0, 0, 0, 4011, 19217 }, // 1.2.840.10008.6.1.295
+{ 0, 0, 0, 4012, 19234 }, // 1.2.840.10008.6.1.296
+{ 0, 0, 0, 4013, 19260 }, // 1.2.840.10008.6.1.297
+{ 0, 0, 0, 4014, 19292 }, // 1.2.840.10008.6.1.298
+{ 0, 0, 0, 4015, 19313 }, // 1.2.840.10008.6.1.299
+{ 0, 0, 0, 4016, 19343 }, // 1.2.840.10008.6.1.300
+{ 0, 0, 0, 4017, 19386 }, // 1.2.840.10008.6.1.301
+{ 0, 0, 0, 4018, 19438 }, // 1.2.840.10008.6.1.302
+{ 0, 0, 0, 4019, 19537 }, // 1.2.840.10008.6.1.303
+{ 0, 0, 0, 4020, 19636 }, // 1.2.840.10008.6.1.304
+{ 0, 0, 0, 4021, 19653 }, // 1.2.840.10008.6.1.305
+{ 0, 0, 0, 4028, 19677 }, // 1.2.840.10008.6.1.306
+{ 0, 0, 0, 4030, 19707 }, // 1.2.840.10008.6.1.307
+{ 0, 0, 0, 4031, 19737 }, // 1.2.840.10008.6.1.308
+{ 0, 0, 0, 4032, 19761 }, // 1.2.840.10008.6.1.309
+{ 0, 0, 0, 4033, 19789 }, // 1.2.840.10008.6.1.310
+{ 0, 0, 0, 4040, 19824 }, // 1.2.840.10008.6.1.311
+{ 0, 0, 0, 4042, 19851 }, // 1.2.840.10008.6.1.312
+{ 0, 0, 0, 4050, 19873 }, // 1.2.840.10008.6.1.313
+{ 0, 0, 0, 4051, 19912 }, // 1.2.840.10008.6.1.314
+{ 0, 0, 0, 4052, 19928 }, // 1.2.840.10008.6.1.315
+{ 0, 0, 0, 4200, 19944 }, // 1.2.840.10008.6.1.316
+{ 0, 0, 0, 4201, 19969 }, // 1.2.840.10008.6.1.317
+{ 0, 0, 0, 4202, 19998 }, // 1.2.840.10008.6.1.318
+{ 0, 0, 0, 4203, 20040 }, // 1.2.840.10008.6.1.319
+{ 0, 0, 0, 4204, 20076 }, // 1.2.840.10008.6.1.320
+{ 0, 0, 0, 4205, 20094 }, // 1.2.840.10008.6.1.321
+{ 0, 0, 0, 4206, 20110 }, // 1.2.840.10008.6.1.322
+{ 0, 0, 0, 4207, 20141 }, // 1.2.840.10008.6.1.323
+{ 0, 0, 0, 4208, 20167 }, // 1.2.840.10008.6.1.324
+{ 0, 0, 0, 4209, 20183 }, // 1.2.840.10008.6.1.325
+{ 0, 0, 0, 4210, 20220 }, // 1.2.840.10008.6.1.326
+{ 0, 0, 0, 4211, 20261 }, // 1.2.840.10008.6.1.327
+{ 0, 0, 0, 5000, 20302 }, // 1.2.840.10008.6.1.328
+{ 0, 0, 0, 5001, 20312 }, // 1.2.840.10008.6.1.329
+{ 0, 0, 0, 6000, 20322 }, // 1.2.840.10008.6.1.330
+{ 0, 0, 0, 6001, 20349 }, // 1.2.840.10008.6.1.331
+{ 0, 0, 0, 6002, 20392 }, // 1.2.840.10008.6.1.332
+{ 0, 0, 0, 6003, 20437 }, // 1.2.840.10008.6.1.333
+{ 0, 0, 0, 6004, 20498 }, // 1.2.840.10008.6.1.334
+{ 0, 0, 0, 6005, 20535 }, // 1.2.840.10008.6.1.335
+{ 0, 0, 0, 6006, 20576 }, // 1.2.840.10008.6.1.336
+{ 0, 0, 0, 6007, 20614 }, // 1.2.840.10008.6.1.337
+{ 0, 0, 0, 6008, 20656 }, // 1.2.840.10008.6.1.338
+{ 0, 0, 0, 6009, 20673 }, // 1.2.840.10008.6.1.339
+{ 0, 0, 0, 6010, 20706 }, // 1.2.840.10008.6.1.340
+{ 0, 0, 0, 6011, 20738 }, // 1.2.840.10008.6.1.341
+{ 0, 0, 0, 6012, 20774 }, // 1.2.840.10008.6.1.342
+{ 0, 0, 0, 6013, 20810 }, // 1.2.840.10008.6.1.343
+{ 0, 0, 0, 6014, 20862 }, // 1.2.840.10008.6.1.344
+{ 0, 0, 0, 6015, 20895 }, // 1.2.840.10008.6.1.345
+{ 0, 0, 0, 6016, 20932 }, // 1.2.840.10008.6.1.346
+{ 0, 0, 0, 6017, 20962 }, // 1.2.840.10008.6.1.347
+{ 0, 0, 0, 6018, 20996 }, // 1.2.840.10008.6.1.348
+{ 0, 0, 0, 6019, 21025 }, // 1.2.840.10008.6.1.349
+{ 0, 0, 0, 6020, 21070 }, // 1.2.840.10008.6.1.350
+{ 0, 0, 0, 6021, 21088 }, // 1.2.840.10008.6.1.351
+{ 0, 0, 0, 6022, 21122 }, // 1.2.840.10008.6.1.352
+{ 0, 0, 0, 6023, 21127 }, // 1.2.840.10008.6.1.353
+{ 0, 0, 0, 6024, 21148 }, // 1.2.840.10008.6.1.354
+{ 0, 0, 0, 6025, 21154 }, // 1.2.840.10008.6.1.355
+{ 0, 0, 0, 6026, 21176 }, // 1.2.840.10008.6.1.356
+{ 0, 0, 0, 6027, 21199 }, // 1.2.840.10008.6.1.357
+{ 0, 0, 0, 6028, 21226 }, // 1.2.840.10008.6.1.358
+{ 0, 0, 0, 6029, 21260 }, // 1.2.840.10008.6.1.359
+{ 0, 0, 0, 6030, 21298 }, // 1.2.840.10008.6.1.360
+{ 0, 0, 0, 6031, 21326 }, // 1.2.840.10008.6.1.361
+{ 0, 0, 0, 6032, 21365 }, // 1.2.840.10008.6.1.362
+{ 0, 0, 0, 6033, 21415 }, // 1.2.840.10008.6.1.363
+{ 0, 0, 0, 6034, 21457 }, // 1.2.840.10008.6.1.364
+{ 0, 0, 0, 6035, 21484 }, // 1.2.840.10008.6.1.365
+{ 0, 0, 0, 6036, 21512 }, // 1.2.840.10008.6.1.366
+{ 0, 0, 0, 6037, 21529 }, // 1.2.840.10008.6.1.367
+{ 0, 0, 0, 6038, 21579 }, // 1.2.840.10008.6.1.368
+{ 0, 0, 0, 6039, 21628 }, // 1.2.840.10008.6.1.369
+{ 0, 0, 0, 6040, 21650 }, // 1.2.840.10008.6.1.370
+{ 0, 0, 0, 6041, 21673 }, // 1.2.840.10008.6.1.371
+{ 0, 0, 0, 6042, 21707 }, // 1.2.840.10008.6.1.372
+{ 0, 0, 0, 6043, 21725 }, // 1.2.840.10008.6.1.373
+{ 0, 0, 0, 6044, 21759 }, // 1.2.840.10008.6.1.374
+{ 0, 0, 0, 6045, 21793 }, // 1.2.840.10008.6.1.375
+{ 0, 0, 0, 6046, 21839 }, // 1.2.840.10008.6.1.376
+{ 0, 0, 0, 6047, 21867 }, // 1.2.840.10008.6.1.377
+{ 0, 0, 0, 6048, 21903 }, // 1.2.840.10008.6.1.378
+{ 0, 0, 0, 6050, 21934 }, // 1.2.840.10008.6.1.379
+{ 0, 0, 0, 6051, 21960 }, // 1.2.840.10008.6.1.380
+{ 0, 0, 0, 6052, 21984 }, // 1.2.840.10008.6.1.381
+{ 0, 0, 0, 6053, 22020 }, // 1.2.840.10008.6.1.382
+{ 0, 0, 0, 6054, 22051 }, // 1.2.840.10008.6.1.383
+{ 0, 0, 0, 6055, 22075 }, // 1.2.840.10008.6.1.384
+{ 0, 0, 0, 6056, 22120 }, // 1.2.840.10008.6.1.385
+{ 0, 0, 0, 6057, 22151 }, // 1.2.840.10008.6.1.386
+{ 0, 0, 0, 6058, 22183 }, // 1.2.840.10008.6.1.387
+{ 0, 0, 0, 6059, 22214 }, // 1.2.840.10008.6.1.388
+{ 0, 0, 0, 6060, 22235 }, // 1.2.840.10008.6.1.389
+{ 0, 0, 0, 6061, 22260 }, // 1.2.840.10008.6.1.390
+{ 0, 0, 0, 6062, 22295 }, // 1.2.840.10008.6.1.391
+{ 0, 0, 0, 6063, 22334 }, // 1.2.840.10008.6.1.392
+{ 0, 0, 0, 6064, 22367 }, // 1.2.840.10008.6.1.393
+{ 0, 0, 0, 6065, 22398 }, // 1.2.840.10008.6.1.394
+{ 0, 0, 0, 6066, 22418 }, // 1.2.840.10008.6.1.395
+{ 0, 0, 0, 6067, 22438 }, // 1.2.840.10008.6.1.396
+{ 0, 0, 0, 6068, 22450 }, // 1.2.840.10008.6.1.397
+{ 0, 0, 0, 6069, 22473 }, // 1.2.840.10008.6.1.398
+{ 0, 0, 0, 6070, 22510 }, // 1.2.840.10008.6.1.399
+{ 0, 0, 0, 6071, 22544 }, // 1.2.840.10008.6.1.400
+{ 0, 0, 0, 6072, 22570 }, // 1.2.840.10008.6.1.401
+{ 0, 0, 0, 6080, 22594 }, // 1.2.840.10008.6.1.402
+{ 0, 0, 0, 6081, 22617 }, // 1.2.840.10008.6.1.403
+{ 0, 0, 0, 6082, 22644 }, // 1.2.840.10008.6.1.404
+{ 0, 0, 0, 6083, 22669 }, // 1.2.840.10008.6.1.405
+{ 0, 0, 0, 6084, 22691 }, // 1.2.840.10008.6.1.406
+{ 0, 0, 0, 6085, 22714 }, // 1.2.840.10008.6.1.407
+{ 0, 0, 0, 6086, 22735 }, // 1.2.840.10008.6.1.408
+{ 0, 0, 0, 6087, 22752 }, // 1.2.840.10008.6.1.409
+{ 0, 0, 0, 6088, 22773 }, // 1.2.840.10008.6.1.410
+{ 0, 0, 0, 6089, 22802 }, // 1.2.840.10008.6.1.411
+{ 0, 0, 0, 6090, 22813 }, // 1.2.840.10008.6.1.412
+{ 0, 0, 0, 6091, 22845 }, // 1.2.840.10008.6.1.413
+{ 0, 0, 0, 6092, 22880 }, // 1.2.840.10008.6.1.414
+{ 0, 0, 0, 6093, 22922 }, // 1.2.840.10008.6.1.415
+{ 0, 0, 0, 6094, 22970 }, // 1.2.840.10008.6.1.416
+{ 0, 0, 0, 6095, 23021 }, // 1.2.840.10008.6.1.417
+{ 0, 0, 0, 6096, 23054 }, // 1.2.840.10008.6.1.418
+{ 0, 0, 0, 6097, 23071 }, // 1.2.840.10008.6.1.419
+{ 0, 0, 0, 6100, 23086 }, // 1.2.840.10008.6.1.420
+{ 0, 0, 0, 6101, 23113 }, // 1.2.840.10008.6.1.421
+{ 0, 0, 0, 6102, 23138 }, // 1.2.840.10008.6.1.422
+{ 0, 0, 0, 6103, 23172 }, // 1.2.840.10008.6.1.423
+{ 0, 0, 0, 6104, 23206 }, // 1.2.840.10008.6.1.424
+{ 0, 0, 0, 6105, 23242 }, // 1.2.840.10008.6.1.425
+{ 0, 0, 0, 6106, 23278 }, // 1.2.840.10008.6.1.426
+{ 0, 0, 0, 6107, 23314 }, // 1.2.840.10008.6.1.427
+{ 0, 0, 0, 6108, 23331 }, // 1.2.840.10008.6.1.428
+{ 0, 0, 0, 6109, 23378 }, // 1.2.840.10008.6.1.429
+{ 0, 0, 0, 6110, 23418 }, // 1.2.840.10008.6.1.430
+{ 0, 0, 0, 6111, 23450 }, // 1.2.840.10008.6.1.431
+{ 0, 0, 0, 6112, 23493 }, // 1.2.840.10008.6.1.432
+{ 0, 0, 0, 6113, 23527 }, // 1.2.840.10008.6.1.433
+{ 0, 0, 0, 6114, 23566 }, // 1.2.840.10008.6.1.434
+{ 0, 0, 0, 6115, 23601 }, // 1.2.840.10008.6.1.435
+{ 0, 0, 0, 6116, 23627 }, // 1.2.840.10008.6.1.436
+{ 0, 0, 0, 6117, 23644 }, // 1.2.840.10008.6.1.437
+{ 0, 0, 0, 6118, 23661 }, // 1.2.840.10008.6.1.438
+{ 0, 0, 0, 6119, 23677 }, // 1.2.840.10008.6.1.439
+{ 0, 0, 0, 6120, 23696 }, // 1.2.840.10008.6.1.440
+{ 0, 0, 0, 6121, 23720 }, // 1.2.840.10008.6.1.441
+{ 0, 0, 0, 6122, 23749 }, // 1.2.840.10008.6.1.442
+{ 0, 0, 0, 6123, 23774 }, // 1.2.840.10008.6.1.443
+{ 0, 0, 0, 6124, 23799 }, // 1.2.840.10008.6.1.444
+{ 0, 0, 0, 6125, 23817 }, // 1.2.840.10008.6.1.445
+{ 0, 0, 0, 6126, 23840 }, // 1.2.840.10008.6.1.446
+{ 0, 0, 0, 6127, 23857 }, // 1.2.840.10008.6.1.447
+{ 0, 0, 0, 6128, 23882 }, // 1.2.840.10008.6.1.448
+{ 0, 0, 0, 6129, 23912 }, // 1.2.840.10008.6.1.449
+{ 0, 0, 0, 6130, 23935 }, // 1.2.840.10008.6.1.450
+{ 0, 0, 0, 6131, 23955 }, // 1.2.840.10008.6.1.451
+{ 0, 0, 0, 6132, 23980 }, // 1.2.840.10008.6.1.452
+{ 0, 0, 0, 6133, 24011 }, // 1.2.840.10008.6.1.453
+{ 0, 0, 0, 6134, 24055 }, // 1.2.840.10008.6.1.454
+{ 0, 0, 0, 6135, 24098 }, // 1.2.840.10008.6.1.455
+{ 0, 0, 0, 6136, 24120 }, // 1.2.840.10008.6.1.456
+{ 0, 0, 0, 6137, 24160 }, // 1.2.840.10008.6.1.457
+{ 0, 0, 0, 6138, 24182 }, // 1.2.840.10008.6.1.458
+{ 0, 0, 0, 6139, 24211 }, // 1.2.840.10008.6.1.459
+{ 0, 0, 0, 6140, 24232 }, // 1.2.840.10008.6.1.460
+{ 0, 0, 0, 6141, 24252 }, // 1.2.840.10008.6.1.461
+{ 0, 0, 0, 6142, 24289 }, // 1.2.840.10008.6.1.462
+{ 0, 0, 0, 6143, 24306 }, // 1.2.840.10008.6.1.463
+{ 0, 0, 0, 6144, 24322 }, // 1.2.840.10008.6.1.464
+{ 0, 0, 0, 6145, 24353 }, // 1.2.840.10008.6.1.465
+{ 0, 0, 0, 6151, 24371 }, // 1.2.840.10008.6.1.466
+{ 0, 0, 0, 6152, 24394 }, // 1.2.840.10008.6.1.467
+{ 0, 0, 0, 6153, 24406 }, // 1.2.840.10008.6.1.468
+{ 0, 0, 0, 6154, 24422 }, // 1.2.840.10008.6.1.469
+{ 0, 0, 0, 6155, 24435 }, // 1.2.840.10008.6.1.470
+{ 0, 0, 0, 6157, 24463 }, // 1.2.840.10008.6.1.471
+{ 0, 0, 0, 6158, 24475 }, // 1.2.840.10008.6.1.472
+{ 0, 0, 0, 6159, 24505 }, // 1.2.840.10008.6.1.473
+{ 0, 0, 0, 6160, 24521 }, // 1.2.840.10008.6.1.474
+{ 0, 0, 0, 6161, 24563 }, // 1.2.840.10008.6.1.475
+{ 0, 0, 0, 6162, 24614 }, // 1.2.840.10008.6.1.476
+{ 0, 0, 0, 6163, 24650 }, // 1.2.840.10008.6.1.477
+{ 0, 0, 0, 6164, 24672 }, // 1.2.840.10008.6.1.478
+{ 0, 0, 0, 6165, 24687 }, // 1.2.840.10008.6.1.479
+{ 0, 0, 0, 6166, 24714 }, // 1.2.840.10008.6.1.480
+{ 0, 0, 0, 7000, 24762 }, // 1.2.840.10008.6.1.481
+{ 0, 0, 0, 7001, 24804 }, // 1.2.840.10008.6.1.482
+{ 0, 0, 0, 7002, 24839 }, // 1.2.840.10008.6.1.483
+{ 0, 0, 0, 7003, 24874 }, // 1.2.840.10008.6.1.484
+{ 0, 0, 0, 7004, 24922 }, // 1.2.840.10008.6.1.485
+{ 0, 0, 0, 7005, 24953 }, // 1.2.840.10008.6.1.486
+{ 0, 0, 0, 7006, 24998 }, // 1.2.840.10008.6.1.487
+{ 0, 0, 0, 7007, 25032 }, // 1.2.840.10008.6.1.488
+{ 0, 0, 0, 7008, 25050 }, // 1.2.840.10008.6.1.489
+{ 0, 0, 0, 7010, 25063 }, // 1.2.840.10008.6.1.490
+{ 0, 0, 0, 7011, 25099 }, // 1.2.840.10008.6.1.491
+{ 0, 0, 0, 7012, 25128 }, // 1.2.840.10008.6.1.492
+{ 0, 0, 0, 7020, 25140 }, // 1.2.840.10008.6.1.493
+{ 0, 0, 0, 7100, 25156 }, // 1.2.840.10008.6.1.494
+{ 0, 0, 0, 7101, 25185 }, // 1.2.840.10008.6.1.495
+{ 0, 0, 0, 7150, 25207 }, // 1.2.840.10008.6.1.496
+{ 0, 0, 0, 7151, 25240 }, // 1.2.840.10008.6.1.497
+{ 0, 0, 0, 7152, 25268 }, // 1.2.840.10008.6.1.498
+{ 0, 0, 0, 7153, 25305 }, // 1.2.840.10008.6.1.499
+{ 0, 0, 0, 7154, 25335 }, // 1.2.840.10008.6.1.500
+{ 0, 0, 0, 7155, 25370 }, // 1.2.840.10008.6.1.501
+{ 0, 0, 0, 7156, 25405 }, // 1.2.840.10008.6.1.502
+{ 0, 0, 0, 7157, 25440 }, // 1.2.840.10008.6.1.503
+{ 0, 0, 0, 7158, 25466 }, // 1.2.840.10008.6.1.504
+{ 0, 0, 0, 7159, 25494 }, // 1.2.840.10008.6.1.505
+{ 0, 0, 0, 7160, 25520 }, // 1.2.840.10008.6.1.506
+{ 0, 0, 0, 7161, 25552 }, // 1.2.840.10008.6.1.507
+{ 0, 0, 0, 7201, 25582 }, // 1.2.840.10008.6.1.508
+{ 0, 0, 0, 7202, 25621 }, // 1.2.840.10008.6.1.509
+{ 0, 0, 0, 7203, 25656 }, // 1.2.840.10008.6.1.510
+{ 0, 0, 0, 7205, 25673 }, // 1.2.840.10008.6.1.511
+{ 0, 0, 0, 7210, 25722 }, // 1.2.840.10008.6.1.512
+{ 0, 0, 0, 7250, 25759 }, // 1.2.840.10008.6.1.513
+{ 0, 0, 0, 7450, 25783 }, // 1.2.840.10008.6.1.514
+{ 0, 0, 0, 7451, 25796 }, // 1.2.840.10008.6.1.515
+{ 0, 0, 0, 7452, 25810 }, // 1.2.840.10008.6.1.516
+{ 0, 0, 0, 7453, 25831 }, // 1.2.840.10008.6.1.517
+{ 0, 0, 0, 7454, 25848 }, // 1.2.840.10008.6.1.518
+{ 0, 0, 0, 7455, 25877 }, // 1.2.840.10008.6.1.519
+{ 0, 0, 0, 7456, 25881 }, // 1.2.840.10008.6.1.520
+{ 0, 0, 0, 7460, 25906 }, // 1.2.840.10008.6.1.521
+{ 0, 0, 0, 7461, 25934 }, // 1.2.840.10008.6.1.522
+{ 0, 0, 0, 7462, 25960 }, // 1.2.840.10008.6.1.523
+{ 0, 0, 0, 7470, 25988 }, // 1.2.840.10008.6.1.524
+{ 0, 0, 0, 7471, 26008 }, // 1.2.840.10008.6.1.525
+{ 0, 0, 0, 7472, 26026 }, // 1.2.840.10008.6.1.526
+{ 0, 0, 0, 7473, 26046 }, // 1.2.840.10008.6.1.527
+{ 0, 0, 0, 7474, 26079 }, // 1.2.840.10008.6.1.528
+{ 0, 0, 0, 7480, 26114 }, // 1.2.840.10008.6.1.529
+{ 0, 0, 0, 7481, 26120 }, // 1.2.840.10008.6.1.530
+{ 0, 0, 0, 9231, 26135 }, // 1.2.840.10008.6.1.531
+{ 0, 0, 0, 9232, 26155 }, // 1.2.840.10008.6.1.532 (Retired)
+{ 0, 0, 0, 9300, 26178 }, // 1.2.840.10008.6.1.533
+{ 0, 0, 0, 10000, 26212 }, // 1.2.840.10008.6.1.534
+{ 0, 0, 0, 10001, 26234 }, // 1.2.840.10008.6.1.535
+{ 0, 0, 0, 10002, 26244 }, // 1.2.840.10008.6.1.536
+{ 0, 0, 0, 10003, 26268 }, // 1.2.840.10008.6.1.537
+{ 0, 0, 0, 10004, 26299 }, // 1.2.840.10008.6.1.538
+{ 0, 0, 0, 10006, 26312 }, // 1.2.840.10008.6.1.539
+{ 0, 0, 0, 10007, 26335 }, // 1.2.840.10008.6.1.540
+{ 0, 0, 0, 10008, 26354 }, // 1.2.840.10008.6.1.541
+{ 0, 0, 0, 10009, 26389 }, // 1.2.840.10008.6.1.542
+{ 0, 0, 0, 10010, 26409 }, // 1.2.840.10008.6.1.543
+{ 0, 0, 0, 10011, 26434 }, // 1.2.840.10008.6.1.544
+{ 0, 0, 0, 10013, 26467 }, // 1.2.840.10008.6.1.545
+{ 0, 0, 0, 10014, 26487 }, // 1.2.840.10008.6.1.546
+{ 0, 0, 0, 10015, 26514 }, // 1.2.840.10008.6.1.547
+{ 0, 0, 0, 10016, 26544 }, // 1.2.840.10008.6.1.548
+{ 0, 0, 0, 10017, 26566 }, // 1.2.840.10008.6.1.549
+{ 0, 0, 0, 12001, 26577 }, // 1.2.840.10008.6.1.550
+{ 0, 0, 0, 12002, 26603 }, // 1.2.840.10008.6.1.551
+{ 0, 0, 0, 12003, 26635 }, // 1.2.840.10008.6.1.552
+{ 0, 0, 0, 12004, 26648 }, // 1.2.840.10008.6.1.553
+{ 0, 0, 0, 12005, 26670 }, // 1.2.840.10008.6.1.554
+{ 0, 0, 0, 12006, 26698 }, // 1.2.840.10008.6.1.555
+{ 0, 0, 0, 12007, 26737 }, // 1.2.840.10008.6.1.556
+{ 0, 0, 0, 12008, 26751 }, // 1.2.840.10008.6.1.557
+{ 0, 0, 0, 12009, 26771 }, // 1.2.840.10008.6.1.558
+{ 0, 0, 0, 12011, 26809 }, // 1.2.840.10008.6.1.559
+{ 0, 0, 0, 12012, 26838 }, // 1.2.840.10008.6.1.560
+{ 0, 0, 0, 12013, 26862 }, // 1.2.840.10008.6.1.561
+{ 0, 0, 0, 12014, 26899 }, // 1.2.840.10008.6.1.562
+{ 0, 0, 0, 12015, 26941 }, // 1.2.840.10008.6.1.563
+{ 0, 0, 0, 12016, 26975 }, // 1.2.840.10008.6.1.564
+{ 0, 0, 0, 12017, 27030 }, // 1.2.840.10008.6.1.565
+{ 0, 0, 0, 12018, 27055 }, // 1.2.840.10008.6.1.566
+{ 0, 0, 0, 12019, 27070 }, // 1.2.840.10008.6.1.567
+{ 0, 0, 0, 12101, 27091 }, // 1.2.840.10008.6.1.568
+{ 0, 0, 0, 12102, 27108 }, // 1.2.840.10008.6.1.569
+{ 0, 0, 0, 12103, 27158 }, // 1.2.840.10008.6.1.570
+{ 0, 0, 0, 12104, 27196 }, // 1.2.840.10008.6.1.571
+{ 0, 0, 0, 12105, 27218 }, // 1.2.840.10008.6.1.572
+{ 0, 0, 0, 12106, 27248 }, // 1.2.840.10008.6.1.573
+{ 0, 0, 0, 12107, 27291 }, // 1.2.840.10008.6.1.574
+{ 0, 0, 0, 12108, 27316 }, // 1.2.840.10008.6.1.575
+{ 0, 0, 0, 12109, 27338 }, // 1.2.840.10008.6.1.576
+{ 0, 0, 0, 12110, 27363 }, // 1.2.840.10008.6.1.577
+{ 0, 0, 0, 12111, 27385 }, // 1.2.840.10008.6.1.578
+{ 0, 0, 0, 12112, 27414 }, // 1.2.840.10008.6.1.579
+{ 0, 0, 0, 12113, 27446 }, // 1.2.840.10008.6.1.580
+{ 0, 0, 0, 12114, 27472 }, // 1.2.840.10008.6.1.581
+{ 0, 0, 0, 12115, 27501 }, // 1.2.840.10008.6.1.582
+{ 0, 0, 0, 12116, 27515 }, // 1.2.840.10008.6.1.583
+{ 0, 0, 0, 12117, 27540 }, // 1.2.840.10008.6.1.584
+{ 0, 0, 0, 12119, 27564 }, // 1.2.840.10008.6.1.585
+{ 0, 0, 0, 12120, 27593 }, // 1.2.840.10008.6.1.586
+{ 0, 0, 0, 12121, 27635 }, // 1.2.840.10008.6.1.587
+{ 0, 0, 0, 12122, 27663 }, // 1.2.840.10008.6.1.588
+{ 0, 0, 0, 12123, 27689 }, // 1.2.840.10008.6.1.589
+{ 0, 0, 0, 12124, 27704 }, // 1.2.840.10008.6.1.590
+{ 0, 0, 0, 12140, 27717 }, // 1.2.840.10008.6.1.591
+{ 0, 0, 0, 12141, 27756 }, // 1.2.840.10008.6.1.592
+{ 0, 0, 0, 12200, 27794 }, // 1.2.840.10008.6.1.593
+{ 0, 0, 0, 12201, 27826 }, // 1.2.840.10008.6.1.594
+{ 0, 0, 0, 12202, 27848 }, // 1.2.840.10008.6.1.595
+{ 0, 0, 0, 12203, 27870 }, // 1.2.840.10008.6.1.596
+{ 0, 0, 0, 12204, 27891 }, // 1.2.840.10008.6.1.597
+{ 0, 0, 0, 12205, 27924 }, // 1.2.840.10008.6.1.598
+{ 0, 0, 0, 12206, 27953 }, // 1.2.840.10008.6.1.599
+{ 0, 0, 0, 12207, 27983 }, // 1.2.840.10008.6.1.600
+{ 0, 0, 0, 12208, 28013 }, // 1.2.840.10008.6.1.601
+{ 0, 0, 0, 12209, 28046 }, // 1.2.840.10008.6.1.602
+{ 0, 0, 0, 12210, 28078 }, // 1.2.840.10008.6.1.603
+{ 0, 0, 0, 12211, 28112 }, // 1.2.840.10008.6.1.604
+{ 0, 0, 0, 12212, 28142 }, // 1.2.840.10008.6.1.605
+{ 0, 0, 0, 12214, 28165 }, // 1.2.840.10008.6.1.606
+{ 0, 0, 0, 12215, 28198 }, // 1.2.840.10008.6.1.607
+{ 0, 0, 0, 12216, 28226 }, // 1.2.840.10008.6.1.608
+{ 0, 0, 0, 12217, 28257 }, // 1.2.840.10008.6.1.609
+{ 0, 0, 0, 12218, 28288 }, // 1.2.840.10008.6.1.610
+{ 0, 0, 0, 12219, 28316 }, // 1.2.840.10008.6.1.611
+{ 0, 0, 0, 12220, 28341 }, // 1.2.840.10008.6.1.612
+{ 0, 0, 0, 12221, 28378 }, // 1.2.840.10008.6.1.613
+{ 0, 0, 0, 12222, 28393 }, // 1.2.840.10008.6.1.614
+{ 0, 0, 0, 12223, 28417 }, // 1.2.840.10008.6.1.615
+{ 0, 0, 0, 12224, 28455 }, // 1.2.840.10008.6.1.616
+{ 0, 0, 0, 12226, 28478 }, // 1.2.840.10008.6.1.617
+{ 0, 0, 0, 12227, 28506 }, // 1.2.840.10008.6.1.618
+{ 0, 0, 0, 12228, 28542 }, // 1.2.840.10008.6.1.619
+{ 0, 0, 0, 12229, 28574 }, // 1.2.840.10008.6.1.620
+{ 0, 0, 0, 12230, 28604 }, // 1.2.840.10008.6.1.621
+{ 0, 0, 0, 12231, 28621 }, // 1.2.840.10008.6.1.622
+{ 0, 0, 0, 12232, 28641 }, // 1.2.840.10008.6.1.623
+{ 0, 0, 0, 12233, 28665 }, // 1.2.840.10008.6.1.624
+{ 0, 0, 0, 12234, 28679 }, // 1.2.840.10008.6.1.625
+{ 0, 0, 0, 12235, 28697 }, // 1.2.840.10008.6.1.626
+{ 0, 0, 0, 12236, 28725 }, // 1.2.840.10008.6.1.627
+{ 0, 0, 0, 12237, 28745 }, // 1.2.840.10008.6.1.628
+{ 0, 0, 0, 12238, 28786 }, // 1.2.840.10008.6.1.629
+{ 0, 0, 0, 12239, 28814 }, // 1.2.840.10008.6.1.630
+{ 0, 0, 0, 12240, 28840 }, // 1.2.840.10008.6.1.631
+{ 0, 0, 0, 12241, 28860 }, // 1.2.840.10008.6.1.632
+{ 0, 0, 0, 12242, 28890 }, // 1.2.840.10008.6.1.633
+{ 0, 0, 0, 12243, 28917 }, // 1.2.840.10008.6.1.634
+{ 0, 0, 0, 12244, 28946 }, // 1.2.840.10008.6.1.635
+{ 0, 0, 0, 7162, 28971 }, // 1.2.840.10008.6.1.636
+{ 0, 0, 0, 3207, 29009 }, // 1.2.840.10008.6.1.637
+{ 0, 0, 0, 3778, 29038 }, // 1.2.840.10008.6.1.638
+{ 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
@@ -2945,911 +1975,1884 @@ const UIDTableEntry UIDTable[] = {
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
 { 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 252, 29045 }, // 1.2.840.10008.6.1.735
+{ 0, 0, 0, 3016, 29067 }, // 1.2.840.10008.6.1.736
+{ 0, 0, 0, 3083, 29091 }, // 1.2.840.10008.6.1.737
+{ 0, 0, 0, 3102, 29114 }, // 1.2.840.10008.6.1.738
+{ 0, 0, 0, 3106, 29126 }, // 1.2.840.10008.6.1.739
+{ 0, 0, 0, 3107, 29151 }, // 1.2.840.10008.6.1.740
+{ 0, 0, 0, 3108, 29187 }, // 1.2.840.10008.6.1.741
+{ 0, 0, 0, 3110, 29205 }, // 1.2.840.10008.6.1.742
+{ 0, 0, 0, 3111, 29234 }, // 1.2.840.10008.6.1.743
+{ 0, 0, 0, 3112, 29274 }, // 1.2.840.10008.6.1.744
+{ 0, 0, 0, 3113, 29297 }, // 1.2.840.10008.6.1.745
+{ 0, 0, 0, 3114, 29324 }, // 1.2.840.10008.6.1.746
+{ 0, 0, 0, 3115, 29338 }, // 1.2.840.10008.6.1.747
+{ 0, 0, 0, 3116, 29368 }, // 1.2.840.10008.6.1.748
+{ 0, 0, 0, 3117, 29393 }, // 1.2.840.10008.6.1.749
+{ 0, 0, 0, 3118, 29424 }, // 1.2.840.10008.6.1.750
+{ 0, 0, 0, 3119, 29438 }, // 1.2.840.10008.6.1.751
+{ 0, 0, 0, 3120, 29450 }, // 1.2.840.10008.6.1.752
+{ 0, 0, 0, 3121, 29469 }, // 1.2.840.10008.6.1.753
+{ 0, 0, 0, 3122, 29490 }, // 1.2.840.10008.6.1.754
+{ 0, 0, 0, 3200, 29514 }, // 1.2.840.10008.6.1.755
+{ 0, 0, 0, 3201, 29536 }, // 1.2.840.10008.6.1.756
+{ 0, 0, 0, 3202, 29564 }, // 1.2.840.10008.6.1.757
+{ 0, 0, 0, 3203, 29575 }, // 1.2.840.10008.6.1.758
+{ 0, 0, 0, 3204, 29592 }, // 1.2.840.10008.6.1.759
+{ 0, 0, 0, 3205, 29606 }, // 1.2.840.10008.6.1.760
+{ 0, 0, 0, 3206, 29650 }, // 1.2.840.10008.6.1.761
 { 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 252, // 1.2.840.10008.6.1.735
-  "S-M-L Size Descriptor" },
-{ 0, 0, 0, 3016, // 1.2.840.10008.6.1.736
-  "Major Coronary Arteries" },
-{ 0, 0, 0, 3083, // 1.2.840.10008.6.1.737
-  "Units of Radioactivity" },
-{ 0, 0, 0, 3102, // 1.2.840.10008.6.1.738
-  "Rest-Stress" },
-{ 0, 0, 0, 3106, // 1.2.840.10008.6.1.739
-  "PET Cardiology Protocols" },
-{ 0, 0, 0, 3107, // 1.2.840.10008.6.1.740
-  "PET Cardiology Radiopharmaceuticals" },
-{ 0, 0, 0, 3108, // 1.2.840.10008.6.1.741
-  "NM/PET Procedures" },
-{ 0, 0, 0, 3110, // 1.2.840.10008.6.1.742
-  "Nuclear Cardiology Protocols" },
-{ 0, 0, 0, 3111, // 1.2.840.10008.6.1.743
-  "Nuclear Cardiology Radiopharmaceuticals" },
-{ 0, 0, 0, 3112, // 1.2.840.10008.6.1.744
-  "Attenuation Correction" },
-{ 0, 0, 0, 3113, // 1.2.840.10008.6.1.745
-  "Types of Perfusion Defects" },
-{ 0, 0, 0, 3114, // 1.2.840.10008.6.1.746
-  "Study Quality" },
-{ 0, 0, 0, 3115, // 1.2.840.10008.6.1.747
-  "Stress Imaging Quality Issues" },
-{ 0, 0, 0, 3116, // 1.2.840.10008.6.1.748
-  "NM Extracardiac Findings" },
-{ 0, 0, 0, 3117, // 1.2.840.10008.6.1.749
-  "Attenuation Correction Methods" },
-{ 0, 0, 0, 3118, // 1.2.840.10008.6.1.750
-  "Level of Risk" },
-{ 0, 0, 0, 3119, // 1.2.840.10008.6.1.751
-  "LV Function" },
-{ 0, 0, 0, 3120, // 1.2.840.10008.6.1.752
-  "Perfusion Findings" },
-{ 0, 0, 0, 3121, // 1.2.840.10008.6.1.753
-  "Perfusion Morphology" },
-{ 0, 0, 0, 3122, // 1.2.840.10008.6.1.754
-  "Ventricular Enlargement" },
-{ 0, 0, 0, 3200, // 1.2.840.10008.6.1.755
-  "Stress Test Procedure" },
-{ 0, 0, 0, 3201, // 1.2.840.10008.6.1.756
-  "Indications for Stress Test" },
-{ 0, 0, 0, 3202, // 1.2.840.10008.6.1.757
-  "Chest Pain" },
-{ 0, 0, 0, 3203, // 1.2.840.10008.6.1.758
-  "Exerciser Device" },
-{ 0, 0, 0, 3204, // 1.2.840.10008.6.1.759
-  "Stress Agents" },
-{ 0, 0, 0, 3205, // 1.2.840.10008.6.1.760
-  "Indications for Pharmacological Stress Test" },
-{ 0, 0, 0, 3206, // 1.2.840.10008.6.1.761
-  "Non-invasive Cardiac Imaging Procedures" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 3208, // 1.2.840.10008.6.1.763
-  "Summary Codes Exercise ECG" },
-{ 0, 0, 0, 3209, // 1.2.840.10008.6.1.764
-  "Summary Codes Stress Imaging" },
-{ 0, 0, 0, 3210, // 1.2.840.10008.6.1.765
-  "Speed of Response" },
-{ 0, 0, 0, 3211, // 1.2.840.10008.6.1.766
-  "BP Response" },
-{ 0, 0, 0, 3212, // 1.2.840.10008.6.1.767
-  "Treadmill Speed" },
-{ 0, 0, 0, 3213, // 1.2.840.10008.6.1.768
-  "Stress Hemodynamic Findings" },
-{ 0, 0, 0, 3215, // 1.2.840.10008.6.1.769
-  "Perfusion Finding Method" },
-{ 0, 0, 0, 3217, // 1.2.840.10008.6.1.770
-  "Comparison Finding" },
-{ 0, 0, 0, 3220, // 1.2.840.10008.6.1.771
-  "Stress Symptoms" },
-{ 0, 0, 0, 3221, // 1.2.840.10008.6.1.772
-  "Stress Test Termination Reasons" },
-{ 0, 0, 0, 3227, // 1.2.840.10008.6.1.773
-  "QTc Measurements" },
-{ 0, 0, 0, 3228, // 1.2.840.10008.6.1.774
-  "ECG Timing Measurements" },
-{ 0, 0, 0, 3229, // 1.2.840.10008.6.1.775
-  "ECG Axis Measurements" },
-{ 0, 0, 0, 3230, // 1.2.840.10008.6.1.776
-  "ECG Findings" },
-{ 0, 0, 0, 3231, // 1.2.840.10008.6.1.777
-  "ST Segment Findings" },
-{ 0, 0, 0, 3232, // 1.2.840.10008.6.1.778
-  "ST Segment Location" },
-{ 0, 0, 0, 3233, // 1.2.840.10008.6.1.779
-  "ST Segment Morphology" },
-{ 0, 0, 0, 3234, // 1.2.840.10008.6.1.780
-  "Ectopic Beat Morphology" },
-{ 0, 0, 0, 3235, // 1.2.840.10008.6.1.781
-  "Perfusion Comparison Findings" },
-{ 0, 0, 0, 3236, // 1.2.840.10008.6.1.782
-  "Tolerance Comparison Findings" },
-{ 0, 0, 0, 3237, // 1.2.840.10008.6.1.783
-  "Wall Motion Comparison Findings" },
-{ 0, 0, 0, 3238, // 1.2.840.10008.6.1.784
-  "Stress Scoring Scales" },
-{ 0, 0, 0, 3239, // 1.2.840.10008.6.1.785
-  "Perceived Exertion Scales" },
-{ 0, 0, 0, 3463, // 1.2.840.10008.6.1.786
-  "Ventricle Identification" },
-{ 0, 0, 0, 6200, // 1.2.840.10008.6.1.787
-  "Colon Overall Assessment" },
-{ 0, 0, 0, 6201, // 1.2.840.10008.6.1.788
-  "Colon Finding or Feature" },
-{ 0, 0, 0, 6202, // 1.2.840.10008.6.1.789
-  "Colon Finding or Feature Modifier" },
-{ 0, 0, 0, 6203, // 1.2.840.10008.6.1.790
-  "Colon Non-lesion Object Type" },
-{ 0, 0, 0, 6204, // 1.2.840.10008.6.1.791
-  "Anatomic Non-colon Findings" },
-{ 0, 0, 0, 6205, // 1.2.840.10008.6.1.792
-  "Clockface Location for Colon" },
-{ 0, 0, 0, 6206, // 1.2.840.10008.6.1.793
-  "Recumbent Patient Orientation for Colon" },
-{ 0, 0, 0, 6207, // 1.2.840.10008.6.1.794
-  "Colon Quantitative Temporal Difference Type" },
-{ 0, 0, 0, 6208, // 1.2.840.10008.6.1.795
-  "Colon Types of Quality Control Standard" },
-{ 0, 0, 0, 6209, // 1.2.840.10008.6.1.796
-  "Colon Morphology Descriptor" },
-{ 0, 0, 0, 6210, // 1.2.840.10008.6.1.797
-  "Location in Intestinal Tract" },
-{ 0, 0, 0, 6211, // 1.2.840.10008.6.1.798
-  "Colon CAD Material Description" },
-{ 0, 0, 0, 6212, // 1.2.840.10008.6.1.799
-  "Calculated Value for Colon Findings" },
-{ 0, 0, 0, 4214, // 1.2.840.10008.6.1.800
-  "Ophthalmic Horizontal Directions" },
-{ 0, 0, 0, 4215, // 1.2.840.10008.6.1.801
-  "Ophthalmic Vertical Directions" },
-{ 0, 0, 0, 4216, // 1.2.840.10008.6.1.802
-  "Ophthalmic Visual Acuity Type" },
-{ 0, 0, 0, 3004, // 1.2.840.10008.6.1.803
-  "Arterial Pulse Waveform" },
-{ 0, 0, 0, 3005, // 1.2.840.10008.6.1.804
-  "Respiration Waveform" },
-{ 0, 0, 0, 12030, // 1.2.840.10008.6.1.805
-  "Ultrasound Contrast/Bolus Agents" },
-{ 0, 0, 0, 12031, // 1.2.840.10008.6.1.806
-  "Protocol Interval Events" },
-{ 0, 0, 0, 12032, // 1.2.840.10008.6.1.807
-  "Transducer Scan Pattern" },
-{ 0, 0, 0, 12033, // 1.2.840.10008.6.1.808
-  "Ultrasound Transducer Geometry" },
-{ 0, 0, 0, 12034, // 1.2.840.10008.6.1.809
-  "Ultrasound Transducer Beam Steering" },
-{ 0, 0, 0, 12035, // 1.2.840.10008.6.1.810
-  "Ultrasound Transducer Application" },
-{ 0, 0, 0, 50, // 1.2.840.10008.6.1.811
-  "Instance Availability Status" },
-{ 0, 0, 0, 9301, // 1.2.840.10008.6.1.812
-  "Modality PPS Discontinuation Reasons" },
-{ 0, 0, 0, 9302, // 1.2.840.10008.6.1.813
-  "Media Import PPS Discontinuation Reasons" },
-{ 0, 0, 0, 7482, // 1.2.840.10008.6.1.814
-  "DX Anatomy Imaged for Animals" },
-{ 0, 0, 0, 7483, // 1.2.840.10008.6.1.815
-  "Common Anatomic Regions for Animals" },
-{ 0, 0, 0, 7484, // 1.2.840.10008.6.1.816
-  "DX View for Animals" },
-{ 0, 0, 0, 7030, // 1.2.840.10008.6.1.817
-  "Institutional Departments, Units and Services" },
-{ 0, 0, 0, 7009, // 1.2.840.10008.6.1.818
-  "Purpose of Reference to Predecessor Report" },
-{ 0, 0, 0, 4220, // 1.2.840.10008.6.1.819
-  "Visual Fixation Quality During Acquisition" },
-{ 0, 0, 0, 4221, // 1.2.840.10008.6.1.820
-  "Visual Fixation Quality Problem" },
-{ 0, 0, 0, 4222, // 1.2.840.10008.6.1.821
-  "Ophthalmic Macular Grid Problem" },
-{ 0, 0, 0, 5002, // 1.2.840.10008.6.1.822
-  "Organizations" },
-{ 0, 0, 0, 7486, // 1.2.840.10008.6.1.823
-  "Mixed Breeds" },
-{ 0, 0, 0, 7040, // 1.2.840.10008.6.1.824
-  "Broselow-Luten Pediatric Size Categories" },
-{ 0, 0, 0, 7042, // 1.2.840.10008.6.1.825
-  "Calcium Scoring Patient Size Categories" },
-{ 0, 0, 0, 12245, // 1.2.840.10008.6.1.826
-  "Cardiac Ultrasound Report Titles" },
-{ 0, 0, 0, 12246, // 1.2.840.10008.6.1.827
-  "Cardiac Ultrasound Indication for Study" },
-{ 0, 0, 0, 12247, // 1.2.840.10008.6.1.828
-  "Pediatric, Fetal and Congenital Cardiac Surgical Interventions" },
-{ 0, 0, 0, 12248, // 1.2.840.10008.6.1.829
-  "Cardiac Ultrasound Summary Codes" },
-{ 0, 0, 0, 12249, // 1.2.840.10008.6.1.830
-  "Cardiac Ultrasound Fetal Summary Codes" },
-{ 0, 0, 0, 12250, // 1.2.840.10008.6.1.831
-  "Cardiac Ultrasound Common Linear Measurements" },
-{ 0, 0, 0, 12251, // 1.2.840.10008.6.1.832
-  "Cardiac Ultrasound Linear Valve Measurements" },
-{ 0, 0, 0, 12252, // 1.2.840.10008.6.1.833
-  "Cardiac Ultrasound Cardiac Function" },
-{ 0, 0, 0, 12253, // 1.2.840.10008.6.1.834
-  "Cardiac Ultrasound Area Measurements" },
-{ 0, 0, 0, 12254, // 1.2.840.10008.6.1.835
-  "Cardiac Ultrasound Hemodynamic Measurements" },
-{ 0, 0, 0, 12255, // 1.2.840.10008.6.1.836
-  "Cardiac Ultrasound Myocardium Measurements" },
-{ 0, 0, 0, 0, // 1.2.840.10008.6.1.837
-  "1.2.840.10008.6.1.838" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 12258, // 1.2.840.10008.6.1.839
-  "Cardiac Ultrasound Right Ventricle" },
-{ 0, 0, 0, 12259, // 1.2.840.10008.6.1.840
-  "Cardiac Ultrasound Ventricles Measurements" },
-{ 0, 0, 0, 12260, // 1.2.840.10008.6.1.841
-  "Cardiac Ultrasound Pulmonary Artery" },
-{ 0, 0, 0, 12261, // 1.2.840.10008.6.1.842
-  "Cardiac Ultrasound Pulmonary Vein" },
-{ 0, 0, 0, 12262, // 1.2.840.10008.6.1.843
-  "Cardiac Ultrasound Pulmonary Valve" },
-{ 0, 0, 0, 12263, // 1.2.840.10008.6.1.844
-  "Cardiac Ultrasound Venous Return Pulmonary Measurements" },
-{ 0, 0, 0, 12264, // 1.2.840.10008.6.1.845
-  "Cardiac Ultrasound Venous Return Systemic Measurements" },
-{ 0, 0, 0, 12265, // 1.2.840.10008.6.1.846
-  "Cardiac Ultrasound Atria and Atrial Septum Measurements" },
-{ 0, 0, 0, 12266, // 1.2.840.10008.6.1.847
-  "Cardiac Ultrasound Mitral Valve" },
-{ 0, 0, 0, 12267, // 1.2.840.10008.6.1.848
-  "Cardiac Ultrasound Tricuspid Valve" },
-{ 0, 0, 0, 12268, // 1.2.840.10008.6.1.849
-  "Cardiac Ultrasound Atrioventricular Valves Measurements" },
-{ 0, 0, 0, 12269, // 1.2.840.10008.6.1.850
-  "Cardiac Ultrasound Interventricular Septum Measurements" },
-{ 0, 0, 0, 12270, // 1.2.840.10008.6.1.851
-  "Cardiac Ultrasound Aortic Valve" },
-{ 0, 0, 0, 12271, // 1.2.840.10008.6.1.852
-  "Cardiac Ultrasound Outflow Tracts Measurements" },
-{ 0, 0, 0, 12272, // 1.2.840.10008.6.1.853
-  "Cardiac Ultrasound Semilunar Valves, Annulate and Sinuses Measurements" },
-{ 0, 0, 0, 12273, // 1.2.840.10008.6.1.854
-  "Cardiac Ultrasound Aortic Sinotubular Junction" },
-{ 0, 0, 0, 12274, // 1.2.840.10008.6.1.855
-  "Cardiac Ultrasound Aorta Measurements" },
-{ 0, 0, 0, 12275, // 1.2.840.10008.6.1.856
-  "Cardiac Ultrasound Coronary Arteries Measurements" },
-{ 0, 0, 0, 12276, // 1.2.840.10008.6.1.857
-  "Cardiac Ultrasound Aorto Pulmonary Connections Measurements" },
-{ 0, 0, 0, 12277, // 1.2.840.10008.6.1.858
-  "Cardiac Ultrasound Pericardium and Pleura Measurements" },
-{ 0, 0, 0, 12279, // 1.2.840.10008.6.1.859
-  "Cardiac Ultrasound Fetal General Measurements" },
-{ 0, 0, 0, 12280, // 1.2.840.10008.6.1.860
-  "Cardiac Ultrasound Target Sites" },
-{ 0, 0, 0, 12281, // 1.2.840.10008.6.1.861
-  "Cardiac Ultrasound Target Site Modifiers" },
-{ 0, 0, 0, 12282, // 1.2.840.10008.6.1.862
-  "Cardiac Ultrasound Venous Return Systemic Finding Sites" },
-{ 0, 0, 0, 12283, // 1.2.840.10008.6.1.863
-  "Cardiac Ultrasound Venous Return Pulmonary Finding Sites" },
-{ 0, 0, 0, 12284, // 1.2.840.10008.6.1.864
-  "Cardiac Ultrasound Atria and Atrial Septum Finding Sites" },
-{ 0, 0, 0, 12285, // 1.2.840.10008.6.1.865
-  "Cardiac Ultrasound Atrioventricular Valves Finding Sites" },
-{ 0, 0, 0, 12286, // 1.2.840.10008.6.1.866
-  "Cardiac Ultrasound Interventricular Septum Finding Sites" },
-{ 0, 0, 0, 12287, // 1.2.840.10008.6.1.867
-  "Cardiac Ultrasound Ventricles Finding Sites" },
-{ 0, 0, 0, 12288, // 1.2.840.10008.6.1.868
-  "Cardiac Ultrasound Outflow Tracts Finding Sites" },
-{ 0, 0, 0, 12289, // 1.2.840.10008.6.1.869
-  "Cardiac Ultrasound Semilunar Valves, Annulus and Sinuses Finding Sites" },
-{ 0, 0, 0, 12290, // 1.2.840.10008.6.1.870
-  "Cardiac Ultrasound Pulmonary Arteries Finding Sites" },
-{ 0, 0, 0, 12291, // 1.2.840.10008.6.1.871
-  "Cardiac Ultrasound Aorta Finding Sites" },
-{ 0, 0, 0, 12292, // 1.2.840.10008.6.1.872
-  "Cardiac Ultrasound Coronary Arteries Finding Sites" },
-{ 0, 0, 0, 12293, // 1.2.840.10008.6.1.873
-  "Cardiac Ultrasound Aortopulmonary Connections Finding Sites" },
-{ 0, 0, 0, 12294, // 1.2.840.10008.6.1.874
-  "Cardiac Ultrasound Pericardium and Pleura Finding Sites" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 4230, // 1.2.840.10008.6.1.876
-  "Ophthalmic Ultrasound Axial Measurements Type" },
-{ 0, 0, 0, 4231, // 1.2.840.10008.6.1.877
-  "Lens Status" },
-{ 0, 0, 0, 4232, // 1.2.840.10008.6.1.878
-  "Vitreous Status" },
-{ 0, 0, 0, 4233, // 1.2.840.10008.6.1.879
-  "Ophthalmic Axial Length Measurements Segment Names" },
-{ 0, 0, 0, 4234, // 1.2.840.10008.6.1.880
-  "Refractive Surgery Types" },
-{ 0, 0, 0, 4235, // 1.2.840.10008.6.1.881
-  "Keratometry Descriptors" },
-{ 0, 0, 0, 4236, // 1.2.840.10008.6.1.882
-  "IOL Calculation Formula" },
-{ 0, 0, 0, 4237, // 1.2.840.10008.6.1.883
-  "Lens Constant Type" },
-{ 0, 0, 0, 4238, // 1.2.840.10008.6.1.884
-  "Refractive Error Types" },
-{ 0, 0, 0, 4239, // 1.2.840.10008.6.1.885
-  "Anterior Chamber Depth Definition" },
-{ 0, 0, 0, 4240, // 1.2.840.10008.6.1.886
-  "Ophthalmic Measurement or Calculation Data Source" },
-{ 0, 0, 0, 4241, // 1.2.840.10008.6.1.887
-  "Ophthalmic Axial Length Selection Method" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 4243, // 1.2.840.10008.6.1.889
-  "Ophthalmic Quality Metric Type" },
-{ 0, 0, 0, 4244, // 1.2.840.10008.6.1.890
-  "Ophthalmic Agent Concentration Units" },
-{ 0, 0, 0, 91, // 1.2.840.10008.6.1.891
-  "Functional Condition Present During Acquisition" },
-{ 0, 0, 0, 92, // 1.2.840.10008.6.1.892
-  "Joint Position During Acquisition" },
-{ 0, 0, 0, 93, // 1.2.840.10008.6.1.893
-  "Joint Positioning Method" },
-{ 0, 0, 0, 94, // 1.2.840.10008.6.1.894
-  "Physical Force Applied During Acquisition" },
-{ 0, 0, 0, 3690, // 1.2.840.10008.6.1.895
-  "ECG Control Variables Numeric" },
-{ 0, 0, 0, 3691, // 1.2.840.10008.6.1.896
-  "ECG Control Variables Text" },
-{ 0, 0, 0, 8120, // 1.2.840.10008.6.1.897
-  "WSI Referenced Image Purposes of Reference" },
-{ 0, 0, 0, 8121, // 1.2.840.10008.6.1.898
-  "Microscopy Lens Type" },
-{ 0, 0, 0, 8122, // 1.2.840.10008.6.1.899
-  "Microscopy Illuminator and Sensor Color" },
-{ 0, 0, 0, 8123, // 1.2.840.10008.6.1.900
-  "Microscopy Illumination Method" },
-{ 0, 0, 0, 8124, // 1.2.840.10008.6.1.901
-  "Microscopy Filter" },
-{ 0, 0, 0, 8125, // 1.2.840.10008.6.1.902
-  "Microscopy Illuminator Type" },
-{ 0, 0, 0, 400, // 1.2.840.10008.6.1.903
-  "Audit Event ID" },
-{ 0, 0, 0, 401, // 1.2.840.10008.6.1.904
-  "Audit Event Type Code" },
-{ 0, 0, 0, 402, // 1.2.840.10008.6.1.905
-  "Audit Active Participant Role ID Code" },
-{ 0, 0, 0, 403, // 1.2.840.10008.6.1.906
-  "Security Alert Type Code" },
-{ 0, 0, 0, 404, // 1.2.840.10008.6.1.907
-  "Audit Participant Object ID Type Code" },
-{ 0, 0, 0, 405, // 1.2.840.10008.6.1.908
-  "Media Type Code" },
-{ 0, 0, 0, 4250, // 1.2.840.10008.6.1.909
-  "Visual Field Static Perimetry Test Patterns" },
-{ 0, 0, 0, 4251, // 1.2.840.10008.6.1.910
-  "Visual Field Static Perimetry Test Strategies" },
-{ 0, 0, 0, 4252, // 1.2.840.10008.6.1.911
-  "Visual Field Static Perimetry Screening Test Modes" },
-{ 0, 0, 0, 4253, // 1.2.840.10008.6.1.912
-  "Visual Field Static Perimetry Fixation Strategy" },
-{ 0, 0, 0, 4254, // 1.2.840.10008.6.1.913
-  "Visual Field Static Perimetry Test Analysis Results" },
-{ 0, 0, 0, 4255, // 1.2.840.10008.6.1.914
-  "Visual Field Illumination Color" },
-{ 0, 0, 0, 4256, // 1.2.840.10008.6.1.915
-  "Visual Field Procedure Modifier" },
-{ 0, 0, 0, 4257, // 1.2.840.10008.6.1.916
-  "Visual Field Global Index Name" },
-{ 0, 0, 0, 7180, // 1.2.840.10008.6.1.917
-  "Abstract Multi-dimensional Image Model Component Semantics" },
-{ 0, 0, 0, 7181, // 1.2.840.10008.6.1.918
-  "Abstract Multi-dimensional Image Model Component Units" },
-{ 0, 0, 0, 7182, // 1.2.840.10008.6.1.919
-  "Abstract Multi-dimensional Image Model Dimension Semantics" },
-{ 0, 0, 0, 7183, // 1.2.840.10008.6.1.920
-  "Abstract Multi-dimensional Image Model Dimension Units" },
-{ 0, 0, 0, 7184, // 1.2.840.10008.6.1.921
-  "Abstract Multi-dimensional Image Model Axis Direction" },
-{ 0, 0, 0, 7185, // 1.2.840.10008.6.1.922
-  "Abstract Multi-dimensional Image Model Axis Orientation" },
-{ 0, 0, 0, 7186, // 1.2.840.10008.6.1.923
-  "Abstract Multi-dimensional Image Model Qualitative Dimension Sample Semantics" },
-{ 0, 0, 0, 7320, // 1.2.840.10008.6.1.924
-  "Planning Methods" },
-{ 0, 0, 0, 7050, // 1.2.840.10008.6.1.925
-  "De-identification Method" },
-{ 0, 0, 0, 12118, // 1.2.840.10008.6.1.926
-  "Measurement Orientation" },
-{ 0, 0, 0, 3689, // 1.2.840.10008.6.1.927
-  "ECG Global Waveform Durations" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 3692, // 1.2.840.10008.6.1.930
-  "ICDs" },
-{ 0, 0, 0, 9241, // 1.2.840.10008.6.1.931
-  "Radiotherapy General Workitem Definition" },
-{ 0, 0, 0, 9242, // 1.2.840.10008.6.1.932
-  "Radiotherapy Acquisition Workitem Definition" },
-{ 0, 0, 0, 9243, // 1.2.840.10008.6.1.933
-  "Radiotherapy Registration Workitem Definition" },
-{ 0, 0, 0, 3850, // 1.2.840.10008.6.1.934
-  "Intravascular OCT Flush Agent" },
-{ 0, 0, 0, 10022, // 1.2.840.10008.6.1.935
-  "Label Types" },
-{ 0, 0, 0, 4260, // 1.2.840.10008.6.1.936
-  "Ophthalmic Mapping Units for Real World Value Mapping" },
-{ 0, 0, 0, 4261, // 1.2.840.10008.6.1.937
-  "Ophthalmic Mapping Acquisition Method" },
-{ 0, 0, 0, 4262, // 1.2.840.10008.6.1.938
-  "Retinal Thickness Definition" },
-{ 0, 0, 0, 4263, // 1.2.840.10008.6.1.939
-  "Ophthalmic Thickness Map Value Type" },
-{ 0, 0, 0, 4264, // 1.2.840.10008.6.1.940
-  "Ophthalmic Map Purposes of Reference" },
-{ 0, 0, 0, 4265, // 1.2.840.10008.6.1.941
-  "Ophthalmic Thickness Deviation Categories" },
-{ 0, 0, 0, 4266, // 1.2.840.10008.6.1.942
-  "Ophthalmic Anatomic Structure Reference Point" },
-{ 0, 0, 0, 3104, // 1.2.840.10008.6.1.943
-  "Cardiac Synchronization Technique" },
-{ 0, 0, 0, 8130, // 1.2.840.10008.6.1.944
-  "Staining Protocols" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 10023, // 1.2.840.10008.6.1.947
-  "Size Specific Dose Estimation Method for CT" },
-{ 0, 0, 0, 8131, // 1.2.840.10008.6.1.948
-  "Pathology Imaging Protocols" },
-{ 0, 0, 0, 8132, // 1.2.840.10008.6.1.949
-  "Magnification Selection" },
-{ 0, 0, 0, 8133, // 1.2.840.10008.6.1.950
-  "Tissue Selection" },
-{ 0, 0, 0, 7464, // 1.2.840.10008.6.1.951
-  "General Region of Interest Measurement Modifiers" },
-{ 0, 0, 0, 7465, // 1.2.840.10008.6.1.952
-  "Measurements Derived From Multiple ROI Measurements" },
-{ 0, 0, 0, 8201, // 1.2.840.10008.6.1.953
-  "Surface Scan Acquisition Types" },
-{ 0, 0, 0, 8202, // 1.2.840.10008.6.1.954
-  "Surface Scan Mode Types" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 8203, // 1.2.840.10008.6.1.956
-  "Surface Scan Registration Method Types" },
-{ 0, 0, 0, 27, // 1.2.840.10008.6.1.957
-  "Basic Cardiac Views" },
-{ 0, 0, 0, 10033, // 1.2.840.10008.6.1.958
-  "CT Reconstruction Algorithm" },
-{ 0, 0, 0, 10030, // 1.2.840.10008.6.1.959
-  "Detector Types" },
-{ 0, 0, 0, 10031, // 1.2.840.10008.6.1.960
-  "CR/DR Mechanical Configuration" },
-{ 0, 0, 0, 10032, // 1.2.840.10008.6.1.961
-  "Projection X-Ray Acquisition Device Types" },
-{ 0, 0, 0, 7165, // 1.2.840.10008.6.1.962
-  "Abstract Segmentation Types" },
-{ 0, 0, 0, 7166, // 1.2.840.10008.6.1.963
-  "Common Tissue Segmentation Types" },
-{ 0, 0, 0, 7167, // 1.2.840.10008.6.1.964
-  "Peripheral Nervous System Segmentation Types" },
-{ 0, 0, 0, 4267, // 1.2.840.10008.6.1.965
-  "Corneal Topography Mapping Units for Real World Value Mapping" },
-{ 0, 0, 0, 4268, // 1.2.840.10008.6.1.966
-  "Corneal Topography Map Value Type" },
-{ 0, 0, 0, 7140, // 1.2.840.10008.6.1.967
-  "Brain Structures for Volumetric Measurements" },
-{ 0, 0, 0, 7220, // 1.2.840.10008.6.1.968
-  "RT Dose Derivation" },
-{ 0, 0, 0, 7221, // 1.2.840.10008.6.1.969
-  "RT Dose Purpose of Reference" },
-{ 0, 0, 0, 7215, // 1.2.840.10008.6.1.970
-  "Spectroscopy Purpose of Reference" },
-{ 0, 0, 0, 9250, // 1.2.840.10008.6.1.971
-  "Scheduled Processing Parameter Concept Codes for RT Treatment" },
-{ 0, 0, 0, 10040, // 1.2.840.10008.6.1.972
-  "Radiopharmaceutical Organ Dose Reference Authority" },
-{ 0, 0, 0, 10041, // 1.2.840.10008.6.1.973
-  "Source of Radioisotope Activity Information" },
-{ 0, 0, 0, 0, 0 },
-{ 0, 0, 0, 10043, // 1.2.840.10008.6.1.975
-  "Intravenous Extravasation Symptoms" },
-{ 0, 0, 0, 10044, // 1.2.840.10008.6.1.976
-  "Radiosensitive Organs" },
-{ 0, 0, 0, 10045, // 1.2.840.10008.6.1.977
-  "Radiopharmaceutical Patient State" },
-{ 0, 0, 0, 10046, // 1.2.840.10008.6.1.978
-  "GFR Measurements" },
-{ 0, 0, 0, 10047, // 1.2.840.10008.6.1.979
-  "GFR Measurement Methods" },
-{ 0, 0, 0, 8300, // 1.2.840.10008.6.1.980
-  "Visual Evaluation Methods" },
-{ 0, 0, 0, 8301, // 1.2.840.10008.6.1.981
-  "Test Pattern Codes" },
-{ 0, 0, 0, 8302, // 1.2.840.10008.6.1.982
-  "Measurement Pattern Codes" },
-{ 0, 0, 0, 8303, // 1.2.840.10008.6.1.983
-  "Display Device Type" },
-{ 0, 0, 0, 85, // 1.2.840.10008.6.1.984
-  "SUV Units" },
-{ 0, 0, 0, 4100, // 1.2.840.10008.6.1.985
-  "T1 Measurement Methods" },
-{ 0, 0, 0, 4101, // 1.2.840.10008.6.1.986
-  "Tracer Kinetic Models" },
-{ 0, 0, 0, 4102, // 1.2.840.10008.6.1.987
-  "Perfusion Measurement Methods" },
-{ 0, 0, 0, 4103, // 1.2.840.10008.6.1.988
-  "Arterial Input Function Measurement Methods" },
-{ 0, 0, 0, 4104, // 1.2.840.10008.6.1.989
-  "Bolus Arrival Time Derivation Methods" },
-{ 0, 0, 0, 4105, // 1.2.840.10008.6.1.990
-  "Perfusion Analysis Methods" },
-{ 0, 0, 0, 4106, // 1.2.840.10008.6.1.991
-  "Quantitative Methods used for Perfusion And Tracer Kinetic Models" },
-{ 0, 0, 0, 4107, // 1.2.840.10008.6.1.992
-  "Tracer Kinetic Model Parameters" },
-{ 0, 0, 0, 4108, // 1.2.840.10008.6.1.993
-  "Perfusion Model Parameters" },
-{ 0, 0, 0, 4109, // 1.2.840.10008.6.1.994
-  "Model-Independent Dynamic Contrast Analysis Parameters" },
-{ 0, 0, 0, 4110, // 1.2.840.10008.6.1.995
-  "Tracer Kinetic Modeling Covariates" },
-{ 0, 0, 0, 4111, // 1.2.840.10008.6.1.996
-  "Contrast Characteristics" },
-{ 0, 0, 0, 7021, // 1.2.840.10008.6.1.997
-  "Measurement Report Document Titles" },
-{ 0, 0, 0, 100, // 1.2.840.10008.6.1.998
-  "Quantitative Diagnostic Imaging Procedures" },
-{ 0, 0, 0, 7466, // 1.2.840.10008.6.1.999
-  "PET Region of Interest Measurements" },
-{ 0, 0, 0, 7467, // 1.2.840.10008.6.1.1000
-  "Grey Level Co-occurrence Matrix Measurements" },
-{ 0, 0, 0, 7468, // 1.2.840.10008.6.1.1001
-  "Texture Measurements" },
-{ 0, 0, 0, 6146, // 1.2.840.10008.6.1.1002
-  "Time Point Types" },
-{ 0, 0, 0, 7469, // 1.2.840.10008.6.1.1003
-  "Generic Intensity and Size Measurements" },
-{ 0, 0, 0, 6147, // 1.2.840.10008.6.1.1004
-  "Response Criteria" },
-{ 0, 0, 0, 12020, // 1.2.840.10008.6.1.1005
-  "Fetal Biometry Anatomic Sites" },
-{ 0, 0, 0, 12021, // 1.2.840.10008.6.1.1006
-  "Fetal Long Bone Anatomic Sites" },
-{ 0, 0, 0, 12022, // 1.2.840.10008.6.1.1007
-  "Fetal Cranium Anatomic Sites" },
-{ 0, 0, 0, 12023, // 1.2.840.10008.6.1.1008
-  "Pelvis and Uterus Anatomic Sites" },
-{ 0, 0, 0, 7222, // 1.2.840.10008.6.1.1009
-  "Parametric Map Derivation Image Purpose of Reference" },
-{ 0, 0, 0, 9000, // 1.2.840.10008.6.1.1010
-  "Physical Quantity Descriptors" },
-{ 0, 0, 0, 7600, // 1.2.840.10008.6.1.1011
-  "Lymph Node Anatomic Sites" },
-{ 0, 0, 0, 7601, // 1.2.840.10008.6.1.1012
-  "Head and Neck Cancer Anatomic Sites" },
-{ 0, 0, 0, 7701, // 1.2.840.10008.6.1.1013
-  "Fiber Tracts In Brainstem" },
-{ 0, 0, 0, 7702, // 1.2.840.10008.6.1.1014
-  "Projection and Thalamic Fibers" },
-{ 0, 0, 0, 7703, // 1.2.840.10008.6.1.1015
-  "Association Fibers" },
-{ 0, 0, 0, 7704, // 1.2.840.10008.6.1.1016
-  "Limbic System Tracts" },
-{ 0, 0, 0, 7705, // 1.2.840.10008.6.1.1017
-  "Commissural Fibers" },
-{ 0, 0, 0, 7706, // 1.2.840.10008.6.1.1018
-  "Cranial Nerves" },
-{ 0, 0, 0, 7707, // 1.2.840.10008.6.1.1019
-  "Spinal Cord Fibers" },
-{ 0, 0, 0, 7710, // 1.2.840.10008.6.1.1020
-  "Tractography Anatomic Sites" },
-{ 0, 0, 0, 4025, // 1.2.840.10008.6.1.1021
-  "Primary Anatomic Structure for Intra-oral Radiography" },
-{ 0, 0, 0, 4026, // 1.2.840.10008.6.1.1022
-  "Primary Anatomic Structure for Intra-oral and Craniofacial Radiography" },
-{ 0, 0, 0, 9401, // 1.2.840.10008.6.1.1023
-  "IEC61217 Device Position Parameters" },
-{ 0, 0, 0, 9402, // 1.2.840.10008.6.1.1024
-  "IEC61217 Gantry Position Parameters" },
-{ 0, 0, 0, 9403, // 1.2.840.10008.6.1.1025
-  "IEC61217 Patient Support Position Parameters" },
-{ 0, 0, 0, 7035, // 1.2.840.10008.6.1.1026
-  "Actionable Finding Classification" },
-{ 0, 0, 0, 7036, // 1.2.840.10008.6.1.1027
-  "Image Quality Assessment" },
-{ 0, 0, 0, 10050, // 1.2.840.10008.6.1.1028
-  "Summary Radiation Exposure Quantities" },
-{ 0, 0, 0, 4245, // 1.2.840.10008.6.1.1029
-  "Wide Field Ophthalmic Photography Transformation Method" },
-{ 0, 0, 0, 84, // 1.2.840.10008.6.1.1030
-  "PET Units" },
-{ 0, 0, 0, 7300, // 1.2.840.10008.6.1.1031
-  "Implant Materials" },
-{ 0, 0, 0, 7301, // 1.2.840.10008.6.1.1032
-  "Intervention Types" },
-{ 0, 0, 0, 7302, // 1.2.840.10008.6.1.1033
-  "Implant Templates View Orientations" },
-{ 0, 0, 0, 7303, // 1.2.840.10008.6.1.1034
-  "Implant Templates Modified View Orientations" },
-{ 0, 0, 0, 7304, // 1.2.840.10008.6.1.1035
-  "Implant Target Anatomy" },
-{ 0, 0, 0, 7305, // 1.2.840.10008.6.1.1036
-  "Implant Planning Landmarks" },
-{ 0, 0, 0, 7306, // 1.2.840.10008.6.1.1037
-  "Human Hip Implant Planning Landmarks" },
-{ 0, 0, 0, 7307, // 1.2.840.10008.6.1.1038
-  "Implant Component Types" },
-{ 0, 0, 0, 7308, // 1.2.840.10008.6.1.1039
-  "Human Hip Implant Component Types" },
-{ 0, 0, 0, 7309, // 1.2.840.10008.6.1.1040
-  "Human Trauma Implant Component Types" },
-{ 0, 0, 0, 7310, // 1.2.840.10008.6.1.1041
-  "Implant Fixation Method" },
-{ 0, 0, 0, 7445, // 1.2.840.10008.6.1.1042
-  "Device Participating Roles" },
-{ 0, 0, 0, 8101, // 1.2.840.10008.6.1.1043
-  "Container Types" },
-{ 0, 0, 0, 8102, // 1.2.840.10008.6.1.1044
-  "Container Component Types" },
-{ 0, 0, 0, 8103, // 1.2.840.10008.6.1.1045
-  "Anatomic Pathology Specimen Types" },
-{ 0, 0, 0, 8104, // 1.2.840.10008.6.1.1046
-  "Breast Tissue Specimen Types" },
-{ 0, 0, 0, 8109, // 1.2.840.10008.6.1.1047
-  "Specimen Collection Procedure" },
-{ 0, 0, 0, 8110, // 1.2.840.10008.6.1.1048
-  "Specimen Sampling Procedure" },
-{ 0, 0, 0, 8111, // 1.2.840.10008.6.1.1049
-  "Specimen Preparation Procedure" },
-{ 0, 0, 0, 8112, // 1.2.840.10008.6.1.1050
-  "Specimen Stains" },
-{ 0, 0, 0, 8113, // 1.2.840.10008.6.1.1051
-  "Specimen Preparation Steps" },
-{ 0, 0, 0, 8114, // 1.2.840.10008.6.1.1052
-  "Specimen Fixatives" },
-{ 0, 0, 0, 8115, // 1.2.840.10008.6.1.1053
-  "Specimen Embedding Media" },
-{ 0, 0, 0, 10020, // 1.2.840.10008.6.1.1054
-  "Source of Projection X-Ray Dose Information" },
-{ 0, 0, 0, 10021, // 1.2.840.10008.6.1.1055
-  "Source of CT Dose Information" },
-{ 0, 0, 0, 10025, // 1.2.840.10008.6.1.1056
-  "Radiation Dose Reference Points" },
-{ 0, 0, 0, 501, // 1.2.840.10008.6.1.1057
-  "Volumetric View Description" },
-{ 0, 0, 0, 502, // 1.2.840.10008.6.1.1058
-  "Volumetric View Modifier" },
-{ 0, 0, 0, 7260, // 1.2.840.10008.6.1.1059
-  "Diffusion Acquisition Value Types" },
-{ 0, 0, 0, 7261, // 1.2.840.10008.6.1.1060
-  "Diffusion Model Value Types" },
-{ 0, 0, 0, 7262, // 1.2.840.10008.6.1.1061
-  "Diffusion Tractography Algorithm Families" },
-{ 0, 0, 0, 7263, // 1.2.840.10008.6.1.1062
-  "Diffusion Tractography Measurement Types" },
-{ 0, 0, 0, 7490, // 1.2.840.10008.6.1.1063
-  "Research Animal Source Registries" },
-{ 0, 0, 0, 231, // 1.2.840.10008.6.1.1064
-  "Yes-No Only" },
-{ 0, 0, 0, 601, // 1.2.840.10008.6.1.1065
-  "Biosafety Levels" },
-{ 0, 0, 0, 602, // 1.2.840.10008.6.1.1066
-  "Biosafety Control Reasons" },
-{ 0, 0, 0, 7457, // 1.2.840.10008.6.1.1067
-  "Sex - Male Female or Both" },
-{ 0, 0, 0, 603, // 1.2.840.10008.6.1.1068
-  "Animal Room Types" },
-{ 0, 0, 0, 604, // 1.2.840.10008.6.1.1069
-  "Device Reuse" },
-{ 0, 0, 0, 605, // 1.2.840.10008.6.1.1070
-  "Animal Bedding Material" },
-{ 0, 0, 0, 606, // 1.2.840.10008.6.1.1071
-  "Animal Shelter Types" },
-{ 0, 0, 0, 607, // 1.2.840.10008.6.1.1072
-  "Animal Feed Types" },
-{ 0, 0, 0, 608, // 1.2.840.10008.6.1.1073
-  "Animal Feed Sources" },
-{ 0, 0, 0, 609, // 1.2.840.10008.6.1.1074
-  "Animal Feeding Methods" },
-{ 0, 0, 0, 610, // 1.2.840.10008.6.1.1075
-  "Water Types" },
-{ 0, 0, 0, 611, // 1.2.840.10008.6.1.1076
-  "Anesthesia Category Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 612, // 1.2.840.10008.6.1.1077
-  "Anesthesia Category Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 613, // 1.2.840.10008.6.1.1078
-  "Anesthesia Induction Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 614, // 1.2.840.10008.6.1.1079
-  "Anesthesia Induction Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 615, // 1.2.840.10008.6.1.1080
-  "Anesthesia Maintenance Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 616, // 1.2.840.10008.6.1.1081
-  "Anesthesia Maintenance Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 617, // 1.2.840.10008.6.1.1082
-  "Airway Management Method Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 618, // 1.2.840.10008.6.1.1083
-  "Airway Management Method Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 619, // 1.2.840.10008.6.1.1084
-  "Airway Management Sub-Method Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 620, // 1.2.840.10008.6.1.1085
-  "Airway Management Sub-Method Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 621, // 1.2.840.10008.6.1.1086
-  "Medication Type Code Type for Small Animal Anesthesia" },
-{ 0, 0, 0, 622, // 1.2.840.10008.6.1.1087
-  "Medication Type Code Type from Anesthesia Quality Initiative (AQI)" },
-{ 0, 0, 0, 623, // 1.2.840.10008.6.1.1088
-  "Medication for Small Animal Anesthesia" },
-{ 0, 0, 0, 624, // 1.2.840.10008.6.1.1089
-  "Inhalational Anesthesia Agents for Small Animal Anesthesia" },
-{ 0, 0, 0, 625, // 1.2.840.10008.6.1.1090
-  "Injectable Anesthesia Agents for Small Animal Anesthesia" },
-{ 0, 0, 0, 626, // 1.2.840.10008.6.1.1091
-  "Premedication Agents for Small Animal Anesthesia" },
-{ 0, 0, 0, 627, // 1.2.840.10008.6.1.1092
-  "Neuromuscular Blocking Agents for Small Animal Anesthesia" },
-{ 0, 0, 0, 628, // 1.2.840.10008.6.1.1093
-  "Ancillary Medications for Small Animal Anesthesia" },
-{ 0, 0, 0, 629, // 1.2.840.10008.6.1.1094
-  "Carrier Gases for Small Animal Anesthesia" },
-{ 0, 0, 0, 630, // 1.2.840.10008.6.1.1095
-  "Local Anesthetics for Small Animal Anesthesia" },
-{ 0, 0, 0, 631, // 1.2.840.10008.6.1.1096
-  "Phase of Procedure Requiring Anesthesia" },
-{ 0, 0, 0, 632, // 1.2.840.10008.6.1.1097
-  "Phase of Surgical Procedure Requiring Anesthesia" },
-{ 0, 0, 0, 633, // 1.2.840.10008.6.1.1098
-  "Phase of Imaging Procedure Requiring Anesthesia" },
-{ 0, 0, 0, 634, // 1.2.840.10008.6.1.1099
-  "Phase of Animal Handling" },
-{ 0, 0, 0, 635, // 1.2.840.10008.6.1.1100
-  "Heating Method" },
-{ 0, 0, 0, 636, // 1.2.840.10008.6.1.1101
-  "Temperature Sensor Device Component Type for Small Animal Procedures" },
-{ 0, 0, 0, 637, // 1.2.840.10008.6.1.1102
-  "Exogenous Substance Types" },
-{ 0, 0, 0, 638, // 1.2.840.10008.6.1.1103
-  "Exogenous Substance" },
-{ 0, 0, 0, 639, // 1.2.840.10008.6.1.1104
-  "Tumor Graft Histologic Type" },
-{ 0, 0, 0, 640, // 1.2.840.10008.6.1.1105
-  "Fibrils" },
-{ 0, 0, 0, 641, // 1.2.840.10008.6.1.1106
-  "Viruses" },
-{ 0, 0, 0, 642, // 1.2.840.10008.6.1.1107
-  "Cytokines" },
-{ 0, 0, 0, 643, // 1.2.840.10008.6.1.1108
-  "Toxins" },
-{ 0, 0, 0, 644, // 1.2.840.10008.6.1.1109
-  "Exogenous Substance Administration Sites" },
-{ 0, 0, 0, 645, // 1.2.840.10008.6.1.1110
-  "Exogenous Substance Tissue of Origin" },
-{ 0, 0, 0, 646, // 1.2.840.10008.6.1.1111
-  "Preclinical Small Animal Imaging Procedures" },
-{ 0, 0, 0, 647, // 1.2.840.10008.6.1.1112
-  "Position Reference Indicator for Frame of Reference" },
-{ 0, 0, 0, 241, // 1.2.840.10008.6.1.1113
-  "Present-Absent Only" },
-{ 0, 0, 0, 10024, // 1.2.840.10008.6.1.1114
-  "Water Equivalent Diameter Method" },
-{ 0, 0, 0, 7022, // 1.2.840.10008.6.1.1115
-  "Radiotherapy Purposes of Reference" },
-{ 0, 0, 0, 701, // 1.2.840.10008.6.1.1116
-  "Content Assessment Types" },
-{ 0, 0, 0, 702, // 1.2.840.10008.6.1.1117
-  "RT Content Assessment Types" },
-{ 0, 0, 0, 703, // 1.2.840.10008.6.1.1118
-  "Basis of Assessment" },
-{ 0, 0, 0, 7449, // 1.2.840.10008.6.1.1119
-  "Reader Specialty" },
-{ 0, 0, 0, 9233, // 1.2.840.10008.6.1.1120
-  "Requested Report Types" },
+{ 0, 0, 0, 3208, 29690 }, // 1.2.840.10008.6.1.763
+{ 0, 0, 0, 3209, 29717 }, // 1.2.840.10008.6.1.764
+{ 0, 0, 0, 3210, 29746 }, // 1.2.840.10008.6.1.765
+{ 0, 0, 0, 3211, 29764 }, // 1.2.840.10008.6.1.766
+{ 0, 0, 0, 3212, 29776 }, // 1.2.840.10008.6.1.767
+{ 0, 0, 0, 3213, 29792 }, // 1.2.840.10008.6.1.768
+{ 0, 0, 0, 3215, 29820 }, // 1.2.840.10008.6.1.769
+{ 0, 0, 0, 3217, 29845 }, // 1.2.840.10008.6.1.770
+{ 0, 0, 0, 3220, 29864 }, // 1.2.840.10008.6.1.771
+{ 0, 0, 0, 3221, 29880 }, // 1.2.840.10008.6.1.772
+{ 0, 0, 0, 3227, 29912 }, // 1.2.840.10008.6.1.773
+{ 0, 0, 0, 3228, 29929 }, // 1.2.840.10008.6.1.774
+{ 0, 0, 0, 3229, 29953 }, // 1.2.840.10008.6.1.775
+{ 0, 0, 0, 3230, 29975 }, // 1.2.840.10008.6.1.776
+{ 0, 0, 0, 3231, 29988 }, // 1.2.840.10008.6.1.777
+{ 0, 0, 0, 3232, 30008 }, // 1.2.840.10008.6.1.778
+{ 0, 0, 0, 3233, 30028 }, // 1.2.840.10008.6.1.779
+{ 0, 0, 0, 3234, 30050 }, // 1.2.840.10008.6.1.780
+{ 0, 0, 0, 3235, 30074 }, // 1.2.840.10008.6.1.781
+{ 0, 0, 0, 3236, 30104 }, // 1.2.840.10008.6.1.782
+{ 0, 0, 0, 3237, 30134 }, // 1.2.840.10008.6.1.783
+{ 0, 0, 0, 3238, 30166 }, // 1.2.840.10008.6.1.784
+{ 0, 0, 0, 3239, 30188 }, // 1.2.840.10008.6.1.785
+{ 0, 0, 0, 3463, 30214 }, // 1.2.840.10008.6.1.786
+{ 0, 0, 0, 6200, 30239 }, // 1.2.840.10008.6.1.787
+{ 0, 0, 0, 6201, 30264 }, // 1.2.840.10008.6.1.788
+{ 0, 0, 0, 6202, 30289 }, // 1.2.840.10008.6.1.789
+{ 0, 0, 0, 6203, 30323 }, // 1.2.840.10008.6.1.790
+{ 0, 0, 0, 6204, 30352 }, // 1.2.840.10008.6.1.791
+{ 0, 0, 0, 6205, 30380 }, // 1.2.840.10008.6.1.792
+{ 0, 0, 0, 6206, 30409 }, // 1.2.840.10008.6.1.793
+{ 0, 0, 0, 6207, 30449 }, // 1.2.840.10008.6.1.794
+{ 0, 0, 0, 6208, 30493 }, // 1.2.840.10008.6.1.795
+{ 0, 0, 0, 6209, 30533 }, // 1.2.840.10008.6.1.796
+{ 0, 0, 0, 6210, 30561 }, // 1.2.840.10008.6.1.797
+{ 0, 0, 0, 6211, 30590 }, // 1.2.840.10008.6.1.798
+{ 0, 0, 0, 6212, 30621 }, // 1.2.840.10008.6.1.799
+{ 0, 0, 0, 4214, 30657 }, // 1.2.840.10008.6.1.800
+{ 0, 0, 0, 4215, 30690 }, // 1.2.840.10008.6.1.801
+{ 0, 0, 0, 4216, 30721 }, // 1.2.840.10008.6.1.802
+{ 0, 0, 0, 3004, 30751 }, // 1.2.840.10008.6.1.803
+{ 0, 0, 0, 3005, 30775 }, // 1.2.840.10008.6.1.804
+{ 0, 0, 0, 12030, 30796 }, // 1.2.840.10008.6.1.805
+{ 0, 0, 0, 12031, 30829 }, // 1.2.840.10008.6.1.806
+{ 0, 0, 0, 12032, 30854 }, // 1.2.840.10008.6.1.807
+{ 0, 0, 0, 12033, 30878 }, // 1.2.840.10008.6.1.808
+{ 0, 0, 0, 12034, 30909 }, // 1.2.840.10008.6.1.809
+{ 0, 0, 0, 12035, 30945 }, // 1.2.840.10008.6.1.810
+{ 0, 0, 0, 50, 30979 }, // 1.2.840.10008.6.1.811
+{ 0, 0, 0, 9301, 31008 }, // 1.2.840.10008.6.1.812
+{ 0, 0, 0, 9302, 31045 }, // 1.2.840.10008.6.1.813
+{ 0, 0, 0, 7482, 31086 }, // 1.2.840.10008.6.1.814
+{ 0, 0, 0, 7483, 31116 }, // 1.2.840.10008.6.1.815
+{ 0, 0, 0, 7484, 31152 }, // 1.2.840.10008.6.1.816
+{ 0, 0, 0, 7030, 31172 }, // 1.2.840.10008.6.1.817
+{ 0, 0, 0, 7009, 31218 }, // 1.2.840.10008.6.1.818
+{ 0, 0, 0, 4220, 31261 }, // 1.2.840.10008.6.1.819
+{ 0, 0, 0, 4221, 31304 }, // 1.2.840.10008.6.1.820
+{ 0, 0, 0, 4222, 31336 }, // 1.2.840.10008.6.1.821
+{ 0, 0, 0, 5002, 31368 }, // 1.2.840.10008.6.1.822
+{ 0, 0, 0, 7486, 31382 }, // 1.2.840.10008.6.1.823
+{ 0, 0, 0, 7040, 31395 }, // 1.2.840.10008.6.1.824
+{ 0, 0, 0, 7042, 31436 }, // 1.2.840.10008.6.1.825
+{ 0, 0, 0, 12245, 31476 }, // 1.2.840.10008.6.1.826
+{ 0, 0, 0, 12246, 31509 }, // 1.2.840.10008.6.1.827
+{ 0, 0, 0, 12247, 31549 }, // 1.2.840.10008.6.1.828
+{ 0, 0, 0, 12248, 31612 }, // 1.2.840.10008.6.1.829
+{ 0, 0, 0, 12249, 31645 }, // 1.2.840.10008.6.1.830
+{ 0, 0, 0, 12250, 31684 }, // 1.2.840.10008.6.1.831
+{ 0, 0, 0, 12251, 31730 }, // 1.2.840.10008.6.1.832
+{ 0, 0, 0, 12252, 31775 }, // 1.2.840.10008.6.1.833
+{ 0, 0, 0, 12253, 31811 }, // 1.2.840.10008.6.1.834
+{ 0, 0, 0, 12254, 31848 }, // 1.2.840.10008.6.1.835
+{ 0, 0, 0, 12255, 31892 }, // 1.2.840.10008.6.1.836
+{ 0, 0, 0, 0, 31935 }, // 1.2.840.10008.6.1.837
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 12258, 31957 }, // 1.2.840.10008.6.1.839
+{ 0, 0, 0, 12259, 31992 }, // 1.2.840.10008.6.1.840
+{ 0, 0, 0, 12260, 32035 }, // 1.2.840.10008.6.1.841
+{ 0, 0, 0, 12261, 32071 }, // 1.2.840.10008.6.1.842
+{ 0, 0, 0, 12262, 32105 }, // 1.2.840.10008.6.1.843
+{ 0, 0, 0, 12263, 32140 }, // 1.2.840.10008.6.1.844
+{ 0, 0, 0, 12264, 32196 }, // 1.2.840.10008.6.1.845
+{ 0, 0, 0, 12265, 32251 }, // 1.2.840.10008.6.1.846
+{ 0, 0, 0, 12266, 32307 }, // 1.2.840.10008.6.1.847
+{ 0, 0, 0, 12267, 32339 }, // 1.2.840.10008.6.1.848
+{ 0, 0, 0, 12268, 32374 }, // 1.2.840.10008.6.1.849
+{ 0, 0, 0, 12269, 32430 }, // 1.2.840.10008.6.1.850
+{ 0, 0, 0, 12270, 32486 }, // 1.2.840.10008.6.1.851
+{ 0, 0, 0, 12271, 32518 }, // 1.2.840.10008.6.1.852
+{ 0, 0, 0, 12272, 32565 }, // 1.2.840.10008.6.1.853
+{ 0, 0, 0, 12273, 32636 }, // 1.2.840.10008.6.1.854
+{ 0, 0, 0, 12274, 32683 }, // 1.2.840.10008.6.1.855
+{ 0, 0, 0, 12275, 32721 }, // 1.2.840.10008.6.1.856
+{ 0, 0, 0, 12276, 32771 }, // 1.2.840.10008.6.1.857
+{ 0, 0, 0, 12277, 32831 }, // 1.2.840.10008.6.1.858
+{ 0, 0, 0, 12279, 32886 }, // 1.2.840.10008.6.1.859
+{ 0, 0, 0, 12280, 32932 }, // 1.2.840.10008.6.1.860
+{ 0, 0, 0, 12281, 32964 }, // 1.2.840.10008.6.1.861
+{ 0, 0, 0, 12282, 33005 }, // 1.2.840.10008.6.1.862
+{ 0, 0, 0, 12283, 33061 }, // 1.2.840.10008.6.1.863
+{ 0, 0, 0, 12284, 33118 }, // 1.2.840.10008.6.1.864
+{ 0, 0, 0, 12285, 33175 }, // 1.2.840.10008.6.1.865
+{ 0, 0, 0, 12286, 33232 }, // 1.2.840.10008.6.1.866
+{ 0, 0, 0, 12287, 33289 }, // 1.2.840.10008.6.1.867
+{ 0, 0, 0, 12288, 33333 }, // 1.2.840.10008.6.1.868
+{ 0, 0, 0, 12289, 33381 }, // 1.2.840.10008.6.1.869
+{ 0, 0, 0, 12290, 33452 }, // 1.2.840.10008.6.1.870
+{ 0, 0, 0, 12291, 33504 }, // 1.2.840.10008.6.1.871
+{ 0, 0, 0, 12292, 33543 }, // 1.2.840.10008.6.1.872
+{ 0, 0, 0, 12293, 33594 }, // 1.2.840.10008.6.1.873
+{ 0, 0, 0, 12294, 33654 }, // 1.2.840.10008.6.1.874
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 4230, 33710 }, // 1.2.840.10008.6.1.876
+{ 0, 0, 0, 4231, 33756 }, // 1.2.840.10008.6.1.877
+{ 0, 0, 0, 4232, 33768 }, // 1.2.840.10008.6.1.878
+{ 0, 0, 0, 4233, 33784 }, // 1.2.840.10008.6.1.879
+{ 0, 0, 0, 4234, 33835 }, // 1.2.840.10008.6.1.880
+{ 0, 0, 0, 4235, 33860 }, // 1.2.840.10008.6.1.881
+{ 0, 0, 0, 4236, 33884 }, // 1.2.840.10008.6.1.882
+{ 0, 0, 0, 4237, 33908 }, // 1.2.840.10008.6.1.883
+{ 0, 0, 0, 4238, 33927 }, // 1.2.840.10008.6.1.884
+{ 0, 0, 0, 4239, 33950 }, // 1.2.840.10008.6.1.885
+{ 0, 0, 0, 4240, 33984 }, // 1.2.840.10008.6.1.886
+{ 0, 0, 0, 4241, 34034 }, // 1.2.840.10008.6.1.887
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 4243, 34075 }, // 1.2.840.10008.6.1.889
+{ 0, 0, 0, 4244, 34106 }, // 1.2.840.10008.6.1.890
+{ 0, 0, 0, 91, 34143 }, // 1.2.840.10008.6.1.891
+{ 0, 0, 0, 92, 34191 }, // 1.2.840.10008.6.1.892
+{ 0, 0, 0, 93, 34225 }, // 1.2.840.10008.6.1.893
+{ 0, 0, 0, 94, 34250 }, // 1.2.840.10008.6.1.894
+{ 0, 0, 0, 3690, 34292 }, // 1.2.840.10008.6.1.895
+{ 0, 0, 0, 3691, 34322 }, // 1.2.840.10008.6.1.896
+{ 0, 0, 0, 8120, 34349 }, // 1.2.840.10008.6.1.897
+{ 0, 0, 0, 8121, 34392 }, // 1.2.840.10008.6.1.898
+{ 0, 0, 0, 8122, 34413 }, // 1.2.840.10008.6.1.899
+{ 0, 0, 0, 8123, 34453 }, // 1.2.840.10008.6.1.900
+{ 0, 0, 0, 8124, 34484 }, // 1.2.840.10008.6.1.901
+{ 0, 0, 0, 8125, 34502 }, // 1.2.840.10008.6.1.902
+{ 0, 0, 0, 400, 34530 }, // 1.2.840.10008.6.1.903
+{ 0, 0, 0, 401, 34545 }, // 1.2.840.10008.6.1.904
+{ 0, 0, 0, 402, 34567 }, // 1.2.840.10008.6.1.905
+{ 0, 0, 0, 403, 34605 }, // 1.2.840.10008.6.1.906
+{ 0, 0, 0, 404, 34630 }, // 1.2.840.10008.6.1.907
+{ 0, 0, 0, 405, 34668 }, // 1.2.840.10008.6.1.908
+{ 0, 0, 0, 4250, 34684 }, // 1.2.840.10008.6.1.909
+{ 0, 0, 0, 4251, 34728 }, // 1.2.840.10008.6.1.910
+{ 0, 0, 0, 4252, 34774 }, // 1.2.840.10008.6.1.911
+{ 0, 0, 0, 4253, 34825 }, // 1.2.840.10008.6.1.912
+{ 0, 0, 0, 4254, 34873 }, // 1.2.840.10008.6.1.913
+{ 0, 0, 0, 4255, 34925 }, // 1.2.840.10008.6.1.914
+{ 0, 0, 0, 4256, 34957 }, // 1.2.840.10008.6.1.915
+{ 0, 0, 0, 4257, 34989 }, // 1.2.840.10008.6.1.916
+{ 0, 0, 0, 7180, 35020 }, // 1.2.840.10008.6.1.917
+{ 0, 0, 0, 7181, 35079 }, // 1.2.840.10008.6.1.918
+{ 0, 0, 0, 7182, 35134 }, // 1.2.840.10008.6.1.919
+{ 0, 0, 0, 7183, 35193 }, // 1.2.840.10008.6.1.920
+{ 0, 0, 0, 7184, 35248 }, // 1.2.840.10008.6.1.921
+{ 0, 0, 0, 7185, 35302 }, // 1.2.840.10008.6.1.922
+{ 0, 0, 0, 7186, 35358 }, // 1.2.840.10008.6.1.923
+{ 0, 0, 0, 7320, 35436 }, // 1.2.840.10008.6.1.924
+{ 0, 0, 0, 7050, 35453 }, // 1.2.840.10008.6.1.925
+{ 0, 0, 0, 12118, 35478 }, // 1.2.840.10008.6.1.926
+{ 0, 0, 0, 3689, 35502 }, // 1.2.840.10008.6.1.927
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 3692, 35532 }, // 1.2.840.10008.6.1.930
+{ 0, 0, 0, 9241, 35537 }, // 1.2.840.10008.6.1.931
+{ 0, 0, 0, 9242, 35578 }, // 1.2.840.10008.6.1.932
+{ 0, 0, 0, 9243, 35623 }, // 1.2.840.10008.6.1.933
+{ 0, 0, 0, 3850, 35669 }, // 1.2.840.10008.6.1.934
+{ 0, 0, 0, 10022, 35699 }, // 1.2.840.10008.6.1.935
+{ 0, 0, 0, 4260, 35711 }, // 1.2.840.10008.6.1.936
+{ 0, 0, 0, 4261, 35765 }, // 1.2.840.10008.6.1.937
+{ 0, 0, 0, 4262, 35803 }, // 1.2.840.10008.6.1.938
+{ 0, 0, 0, 4263, 35832 }, // 1.2.840.10008.6.1.939
+{ 0, 0, 0, 4264, 35868 }, // 1.2.840.10008.6.1.940
+{ 0, 0, 0, 4265, 35905 }, // 1.2.840.10008.6.1.941
+{ 0, 0, 0, 4266, 35947 }, // 1.2.840.10008.6.1.942
+{ 0, 0, 0, 3104, 35993 }, // 1.2.840.10008.6.1.943
+{ 0, 0, 0, 8130, 36027 }, // 1.2.840.10008.6.1.944
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 10023, 36046 }, // 1.2.840.10008.6.1.947
+{ 0, 0, 0, 8131, 36090 }, // 1.2.840.10008.6.1.948
+{ 0, 0, 0, 8132, 36118 }, // 1.2.840.10008.6.1.949
+{ 0, 0, 0, 8133, 36142 }, // 1.2.840.10008.6.1.950
+{ 0, 0, 0, 7464, 36159 }, // 1.2.840.10008.6.1.951
+{ 0, 0, 0, 7465, 36208 }, // 1.2.840.10008.6.1.952
+{ 0, 0, 0, 8201, 36260 }, // 1.2.840.10008.6.1.953
+{ 0, 0, 0, 8202, 36291 }, // 1.2.840.10008.6.1.954
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 8203, 36315 }, // 1.2.840.10008.6.1.956
+{ 0, 0, 0, 27, 36354 }, // 1.2.840.10008.6.1.957
+{ 0, 0, 0, 10033, 36374 }, // 1.2.840.10008.6.1.958
+{ 0, 0, 0, 10030, 36402 }, // 1.2.840.10008.6.1.959
+{ 0, 0, 0, 10031, 36417 }, // 1.2.840.10008.6.1.960
+{ 0, 0, 0, 10032, 36448 }, // 1.2.840.10008.6.1.961
+{ 0, 0, 0, 7165, 36490 }, // 1.2.840.10008.6.1.962
+{ 0, 0, 0, 7166, 36518 }, // 1.2.840.10008.6.1.963
+{ 0, 0, 0, 7167, 36551 }, // 1.2.840.10008.6.1.964
+{ 0, 0, 0, 4267, 36596 }, // 1.2.840.10008.6.1.965
+{ 0, 0, 0, 4268, 36658 }, // 1.2.840.10008.6.1.966
+{ 0, 0, 0, 7140, 36692 }, // 1.2.840.10008.6.1.967
+{ 0, 0, 0, 7220, 36737 }, // 1.2.840.10008.6.1.968
+{ 0, 0, 0, 7221, 36756 }, // 1.2.840.10008.6.1.969
+{ 0, 0, 0, 7215, 36785 }, // 1.2.840.10008.6.1.970
+{ 0, 0, 0, 9250, 36819 }, // 1.2.840.10008.6.1.971
+{ 0, 0, 0, 10040, 36881 }, // 1.2.840.10008.6.1.972
+{ 0, 0, 0, 10041, 36932 }, // 1.2.840.10008.6.1.973
+{ 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 10043, 36976 }, // 1.2.840.10008.6.1.975
+{ 0, 0, 0, 10044, 37011 }, // 1.2.840.10008.6.1.976
+{ 0, 0, 0, 10045, 37033 }, // 1.2.840.10008.6.1.977
+{ 0, 0, 0, 10046, 37067 }, // 1.2.840.10008.6.1.978
+{ 0, 0, 0, 10047, 37084 }, // 1.2.840.10008.6.1.979
+{ 0, 0, 0, 8300, 37108 }, // 1.2.840.10008.6.1.980
+{ 0, 0, 0, 8301, 37134 }, // 1.2.840.10008.6.1.981
+{ 0, 0, 0, 8302, 37153 }, // 1.2.840.10008.6.1.982
+{ 0, 0, 0, 8303, 37179 }, // 1.2.840.10008.6.1.983
+{ 0, 0, 0, 85, 37199 }, // 1.2.840.10008.6.1.984
+{ 0, 0, 0, 4100, 37209 }, // 1.2.840.10008.6.1.985
+{ 0, 0, 0, 4101, 37232 }, // 1.2.840.10008.6.1.986
+{ 0, 0, 0, 4102, 37254 }, // 1.2.840.10008.6.1.987
+{ 0, 0, 0, 4103, 37284 }, // 1.2.840.10008.6.1.988
+{ 0, 0, 0, 4104, 37328 }, // 1.2.840.10008.6.1.989
+{ 0, 0, 0, 4105, 37366 }, // 1.2.840.10008.6.1.990
+{ 0, 0, 0, 4106, 37393 }, // 1.2.840.10008.6.1.991
+{ 0, 0, 0, 4107, 37459 }, // 1.2.840.10008.6.1.992
+{ 0, 0, 0, 4108, 37491 }, // 1.2.840.10008.6.1.993
+{ 0, 0, 0, 4109, 37518 }, // 1.2.840.10008.6.1.994
+{ 0, 0, 0, 4110, 37573 }, // 1.2.840.10008.6.1.995
+{ 0, 0, 0, 4111, 37608 }, // 1.2.840.10008.6.1.996
+{ 0, 0, 0, 7021, 37633 }, // 1.2.840.10008.6.1.997
+{ 0, 0, 0, 100, 37668 }, // 1.2.840.10008.6.1.998
+{ 0, 0, 0, 7466, 37711 }, // 1.2.840.10008.6.1.999
+{ 0, 0, 0, 7467, 37747 }, // 1.2.840.10008.6.1.1000
+{ 0, 0, 0, 7468, 37792 }, // 1.2.840.10008.6.1.1001
+{ 0, 0, 0, 6146, 37813 }, // 1.2.840.10008.6.1.1002
+{ 0, 0, 0, 7469, 37830 }, // 1.2.840.10008.6.1.1003
+{ 0, 0, 0, 6147, 37870 }, // 1.2.840.10008.6.1.1004
+{ 0, 0, 0, 12020, 37888 }, // 1.2.840.10008.6.1.1005
+{ 0, 0, 0, 12021, 37918 }, // 1.2.840.10008.6.1.1006
+{ 0, 0, 0, 12022, 37949 }, // 1.2.840.10008.6.1.1007
+{ 0, 0, 0, 12023, 37978 }, // 1.2.840.10008.6.1.1008
+{ 0, 0, 0, 7222, 38011 }, // 1.2.840.10008.6.1.1009
+{ 0, 0, 0, 9000, 38064 }, // 1.2.840.10008.6.1.1010
+{ 0, 0, 0, 7600, 38094 }, // 1.2.840.10008.6.1.1011
+{ 0, 0, 0, 7601, 38120 }, // 1.2.840.10008.6.1.1012
+{ 0, 0, 0, 7701, 38156 }, // 1.2.840.10008.6.1.1013
+{ 0, 0, 0, 7702, 38182 }, // 1.2.840.10008.6.1.1014
+{ 0, 0, 0, 7703, 38213 }, // 1.2.840.10008.6.1.1015
+{ 0, 0, 0, 7704, 38232 }, // 1.2.840.10008.6.1.1016
+{ 0, 0, 0, 7705, 38253 }, // 1.2.840.10008.6.1.1017
+{ 0, 0, 0, 7706, 38272 }, // 1.2.840.10008.6.1.1018
+{ 0, 0, 0, 7707, 38287 }, // 1.2.840.10008.6.1.1019
+{ 0, 0, 0, 7710, 38306 }, // 1.2.840.10008.6.1.1020
+{ 0, 0, 0, 4025, 38334 }, // 1.2.840.10008.6.1.1021
+{ 0, 0, 0, 4026, 38388 }, // 1.2.840.10008.6.1.1022
+{ 0, 0, 0, 9401, 38459 }, // 1.2.840.10008.6.1.1023
+{ 0, 0, 0, 9402, 38495 }, // 1.2.840.10008.6.1.1024
+{ 0, 0, 0, 9403, 38531 }, // 1.2.840.10008.6.1.1025
+{ 0, 0, 0, 7035, 38576 }, // 1.2.840.10008.6.1.1026
+{ 0, 0, 0, 7036, 38610 }, // 1.2.840.10008.6.1.1027
+{ 0, 0, 0, 10050, 38635 }, // 1.2.840.10008.6.1.1028
+{ 0, 0, 0, 4245, 38673 }, // 1.2.840.10008.6.1.1029
+{ 0, 0, 0, 84, 38729 }, // 1.2.840.10008.6.1.1030
+{ 0, 0, 0, 7300, 38739 }, // 1.2.840.10008.6.1.1031
+{ 0, 0, 0, 7301, 38757 }, // 1.2.840.10008.6.1.1032
+{ 0, 0, 0, 7302, 38776 }, // 1.2.840.10008.6.1.1033
+{ 0, 0, 0, 7303, 38812 }, // 1.2.840.10008.6.1.1034
+{ 0, 0, 0, 7304, 38857 }, // 1.2.840.10008.6.1.1035
+{ 0, 0, 0, 7305, 38880 }, // 1.2.840.10008.6.1.1036
+{ 0, 0, 0, 7306, 38907 }, // 1.2.840.10008.6.1.1037
+{ 0, 0, 0, 7307, 38944 }, // 1.2.840.10008.6.1.1038
+{ 0, 0, 0, 7308, 38968 }, // 1.2.840.10008.6.1.1039
+{ 0, 0, 0, 7309, 39002 }, // 1.2.840.10008.6.1.1040
+{ 0, 0, 0, 7310, 39039 }, // 1.2.840.10008.6.1.1041
+{ 0, 0, 0, 7445, 39063 }, // 1.2.840.10008.6.1.1042
+{ 0, 0, 0, 8101, 39090 }, // 1.2.840.10008.6.1.1043
+{ 0, 0, 0, 8102, 39106 }, // 1.2.840.10008.6.1.1044
+{ 0, 0, 0, 8103, 39132 }, // 1.2.840.10008.6.1.1045
+{ 0, 0, 0, 8104, 39166 }, // 1.2.840.10008.6.1.1046
+{ 0, 0, 0, 8109, 39195 }, // 1.2.840.10008.6.1.1047
+{ 0, 0, 0, 8110, 39225 }, // 1.2.840.10008.6.1.1048
+{ 0, 0, 0, 8111, 39253 }, // 1.2.840.10008.6.1.1049
+{ 0, 0, 0, 8112, 39284 }, // 1.2.840.10008.6.1.1050
+{ 0, 0, 0, 8113, 39300 }, // 1.2.840.10008.6.1.1051
+{ 0, 0, 0, 8114, 39327 }, // 1.2.840.10008.6.1.1052
+{ 0, 0, 0, 8115, 39346 }, // 1.2.840.10008.6.1.1053
+{ 0, 0, 0, 10020, 39371 }, // 1.2.840.10008.6.1.1054
+{ 0, 0, 0, 10021, 39415 }, // 1.2.840.10008.6.1.1055
+{ 0, 0, 0, 10025, 39445 }, // 1.2.840.10008.6.1.1056
+{ 0, 0, 0, 501, 39477 }, // 1.2.840.10008.6.1.1057
+{ 0, 0, 0, 502, 39505 }, // 1.2.840.10008.6.1.1058
+{ 0, 0, 0, 7260, 39530 }, // 1.2.840.10008.6.1.1059
+{ 0, 0, 0, 7261, 39564 }, // 1.2.840.10008.6.1.1060
+{ 0, 0, 0, 7262, 39592 }, // 1.2.840.10008.6.1.1061
+{ 0, 0, 0, 7263, 39634 }, // 1.2.840.10008.6.1.1062
+{ 0, 0, 0, 7490, 39675 }, // 1.2.840.10008.6.1.1063
+{ 0, 0, 0, 231, 39709 }, // 1.2.840.10008.6.1.1064
+{ 0, 0, 0, 601, 39721 }, // 1.2.840.10008.6.1.1065
+{ 0, 0, 0, 602, 39738 }, // 1.2.840.10008.6.1.1066
+{ 0, 0, 0, 7457, 39764 }, // 1.2.840.10008.6.1.1067
+{ 0, 0, 0, 603, 39790 }, // 1.2.840.10008.6.1.1068
+{ 0, 0, 0, 604, 39808 }, // 1.2.840.10008.6.1.1069
+{ 0, 0, 0, 605, 39821 }, // 1.2.840.10008.6.1.1070
+{ 0, 0, 0, 606, 39845 }, // 1.2.840.10008.6.1.1071
+{ 0, 0, 0, 607, 39866 }, // 1.2.840.10008.6.1.1072
+{ 0, 0, 0, 608, 39884 }, // 1.2.840.10008.6.1.1073
+{ 0, 0, 0, 609, 39904 }, // 1.2.840.10008.6.1.1074
+{ 0, 0, 0, 610, 39927 }, // 1.2.840.10008.6.1.1075
+{ 0, 0, 0, 611, 39939 }, // 1.2.840.10008.6.1.1076
+{ 0, 0, 0, 612, 39997 }, // 1.2.840.10008.6.1.1077
+{ 0, 0, 0, 613, 40068 }, // 1.2.840.10008.6.1.1078
+{ 0, 0, 0, 614, 40127 }, // 1.2.840.10008.6.1.1079
+{ 0, 0, 0, 615, 40199 }, // 1.2.840.10008.6.1.1080
+{ 0, 0, 0, 616, 40260 }, // 1.2.840.10008.6.1.1081
+{ 0, 0, 0, 617, 40334 }, // 1.2.840.10008.6.1.1082
+{ 0, 0, 0, 618, 40397 }, // 1.2.840.10008.6.1.1083
+{ 0, 0, 0, 619, 40473 }, // 1.2.840.10008.6.1.1084
+{ 0, 0, 0, 620, 40540 }, // 1.2.840.10008.6.1.1085
+{ 0, 0, 0, 621, 40620 }, // 1.2.840.10008.6.1.1086
+{ 0, 0, 0, 622, 40674 }, // 1.2.840.10008.6.1.1087
+{ 0, 0, 0, 623, 40741 }, // 1.2.840.10008.6.1.1088
+{ 0, 0, 0, 624, 40780 }, // 1.2.840.10008.6.1.1089
+{ 0, 0, 0, 625, 40839 }, // 1.2.840.10008.6.1.1090
+{ 0, 0, 0, 626, 40896 }, // 1.2.840.10008.6.1.1091
+{ 0, 0, 0, 627, 40945 }, // 1.2.840.10008.6.1.1092
+{ 0, 0, 0, 628, 41003 }, // 1.2.840.10008.6.1.1093
+{ 0, 0, 0, 629, 41053 }, // 1.2.840.10008.6.1.1094
+{ 0, 0, 0, 630, 41095 }, // 1.2.840.10008.6.1.1095
+{ 0, 0, 0, 631, 41141 }, // 1.2.840.10008.6.1.1096
+{ 0, 0, 0, 632, 41181 }, // 1.2.840.10008.6.1.1097
+{ 0, 0, 0, 633, 41230 }, // 1.2.840.10008.6.1.1098
+{ 0, 0, 0, 634, 41278 }, // 1.2.840.10008.6.1.1099
+{ 0, 0, 0, 635, 41303 }, // 1.2.840.10008.6.1.1100
+{ 0, 0, 0, 636, 41318 }, // 1.2.840.10008.6.1.1101
+{ 0, 0, 0, 637, 41387 }, // 1.2.840.10008.6.1.1102
+{ 0, 0, 0, 638, 41413 }, // 1.2.840.10008.6.1.1103
+{ 0, 0, 0, 639, 41433 }, // 1.2.840.10008.6.1.1104
+{ 0, 0, 0, 640, 41461 }, // 1.2.840.10008.6.1.1105
+{ 0, 0, 0, 641, 41469 }, // 1.2.840.10008.6.1.1106
+{ 0, 0, 0, 642, 41477 }, // 1.2.840.10008.6.1.1107
+{ 0, 0, 0, 643, 41487 }, // 1.2.840.10008.6.1.1108
+{ 0, 0, 0, 644, 41494 }, // 1.2.840.10008.6.1.1109
+{ 0, 0, 0, 645, 41535 }, // 1.2.840.10008.6.1.1110
+{ 0, 0, 0, 646, 41572 }, // 1.2.840.10008.6.1.1111
+{ 0, 0, 0, 647, 41616 }, // 1.2.840.10008.6.1.1112
+{ 0, 0, 0, 241, 41668 }, // 1.2.840.10008.6.1.1113
+{ 0, 0, 0, 10024, 41688 }, // 1.2.840.10008.6.1.1114
+{ 0, 0, 0, 7022, 41721 }, // 1.2.840.10008.6.1.1115
+{ 0, 0, 0, 701, 41756 }, // 1.2.840.10008.6.1.1116
+{ 0, 0, 0, 702, 41781 }, // 1.2.840.10008.6.1.1117
+{ 0, 0, 0, 703, 41809 }, // 1.2.840.10008.6.1.1118
+{ 0, 0, 0, 7449, 41829 }, // 1.2.840.10008.6.1.1119
+{ 0, 0, 0, 9233, 41846 }, // 1.2.840.10008.6.1.1120
 { 2346, 2, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.7.1.1
-  "Native DICOM Model" },
-{ 0, 0, 0, 0, // 1.2.840.10008.7.1.2
-  "Abstract Multi-Dimensional Image Model" },
+{ 0, 0, 0, 0, 41869 }, // 1.2.840.10008.7.1.1
+{ 0, 0, 0, 0, 41888 }, // 1.2.840.10008.7.1.2
 { 2349, 1, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.8.1.1
-  "DICOM Content Mapping Resource" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.1
-  "Imaging Report" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.2
-  "Clinical Information" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.3
-  "Imaging Procedure Description" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.4
-  "Comparison Study" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.5
-  "Impression" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.6
-  "Addendum" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.7
-  "Request" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.8
-  "Radiation Exposure and Protection Information" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.9
-  "Fetus Findings" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.10
-  "Labeled Subsection" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.11
-  "Communication of Actionable Findings" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.12
-  "Recommendation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.13
-  "Procedural Medication" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.14
-  "Procedure Technique" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.15
-  "Image Quality" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.16
-  "Study Act" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.17
-  "Series Act" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.18
-  "SOP Instance Observation" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.19
-  "Section Text" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.20
-  "General Header" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.21
-  "Imaging Header" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.22
-  "Parent Document" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.23
-  "General Section Entries" },
-{ 0, 0, 0, 0, // 1.2.840.10008.9.24
-  "Imaging Addendum Report" },
+{ 0, 0, 0, 0, 41927 }, // 1.2.840.10008.8.1.1
+{ 0, 0, 0, 0, 41958 }, // 1.2.840.10008.9.1
+{ 0, 0, 0, 0, 41973 }, // 1.2.840.10008.9.2
+{ 0, 0, 0, 0, 41994 }, // 1.2.840.10008.9.3
+{ 0, 0, 0, 0, 42024 }, // 1.2.840.10008.9.4
+{ 0, 0, 0, 0, 42041 }, // 1.2.840.10008.9.5
+{ 0, 0, 0, 0, 42052 }, // 1.2.840.10008.9.6
+{ 0, 0, 0, 0, 42061 }, // 1.2.840.10008.9.7
+{ 0, 0, 0, 0, 42069 }, // 1.2.840.10008.9.8
+{ 0, 0, 0, 0, 42115 }, // 1.2.840.10008.9.9
+{ 0, 0, 0, 0, 42130 }, // 1.2.840.10008.9.10
+{ 0, 0, 0, 0, 42149 }, // 1.2.840.10008.9.11
+{ 0, 0, 0, 0, 42186 }, // 1.2.840.10008.9.12
+{ 0, 0, 0, 0, 42201 }, // 1.2.840.10008.9.13
+{ 0, 0, 0, 0, 42223 }, // 1.2.840.10008.9.14
+{ 0, 0, 0, 0, 42243 }, // 1.2.840.10008.9.15
+{ 0, 0, 0, 0, 42257 }, // 1.2.840.10008.9.16
+{ 0, 0, 0, 0, 42267 }, // 1.2.840.10008.9.17
+{ 0, 0, 0, 0, 42278 }, // 1.2.840.10008.9.18
+{ 0, 0, 0, 0, 42303 }, // 1.2.840.10008.9.19
+{ 0, 0, 0, 0, 42316 }, // 1.2.840.10008.9.20
+{ 0, 0, 0, 0, 42331 }, // 1.2.840.10008.9.21
+{ 0, 0, 0, 0, 42346 }, // 1.2.840.10008.9.22
+{ 0, 0, 0, 0, 42362 }, // 1.2.840.10008.9.23
+{ 0, 0, 0, 0, 42386 }, // 1.2.840.10008.9.24
 { 2376, 2, 3, 0, 0 },
 { 2417, 1, 1, 0, 0 },
 { 2378, 31, 1, 0, 0 },
 { 2409, 8, 1, 0, 0 },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.1
-  "dicomDeviceName" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.2
-  "dicomDescription" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.3
-  "dicomManufacturer" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.4
-  "dicomManufacturerModelName" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.5
-  "dicomSoftwareVersion" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.6
-  "dicomVendorData" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.7
-  "dicomAETitle" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.8
-  "dicomNetworkConnectionReference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.9
-  "dicomApplicationCluster" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.10
-  "dicomAssociationInitiator" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.11
-  "dicomAssociationAcceptor" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.12
-  "dicomHostname" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.13
-  "dicomPort" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.14
-  "dicomSOPClass" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.15
-  "dicomTransferRole" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.16
-  "dicomTransferSyntax" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.17
-  "dicomPrimaryDeviceType" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.18
-  "dicomRelatedDeviceReference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.19
-  "dicomPreferredCalledAETitle" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.20
-  "dicomTLSCyphersuite" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.21
-  "dicomAuthorizedNodeCertificateReference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.22
-  "dicomThisNodeCertificateReference" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.23
-  "dicomInstalled" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.24
-  "dicomStationName" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.25
-  "dicomDeviceSerialNumber" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.26
-  "dicomInstitutionName" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.27
-  "dicomInstitutionAddress" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.28
-  "dicomInstitutionDepartmentName" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.29
-  "dicomIssuerOfPatientID" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.30
-  "dicomPreferredCallingAETitle" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.3.31
-  "dicomSupportedCharacterSet" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.1
-  "dicomConfigurationRoot" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.2
-  "dicomDevicesRoot" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.3
-  "dicomUniqueAETitlesRegistryRoot" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.4
-  "dicomDevice" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.5
-  "dicomNetworkAE" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.6
-  "dicomNetworkConnection" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.7
-  "dicomUniqueAETitle" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.0.4.8
-  "dicomTransferCapability" },
-{ 0, 0, 0, 0, // 1.2.840.10008.15.1.1
-  "Universal Coordinated Time" },
+{ 0, 0, 0, 0, 42410 }, // 1.2.840.10008.15.0.3.1
+{ 0, 0, 0, 0, 42426 }, // 1.2.840.10008.15.0.3.2
+{ 0, 0, 0, 0, 42443 }, // 1.2.840.10008.15.0.3.3
+{ 0, 0, 0, 0, 42461 }, // 1.2.840.10008.15.0.3.4
+{ 0, 0, 0, 0, 42488 }, // 1.2.840.10008.15.0.3.5
+{ 0, 0, 0, 0, 42509 }, // 1.2.840.10008.15.0.3.6
+{ 0, 0, 0, 0, 42525 }, // 1.2.840.10008.15.0.3.7
+{ 0, 0, 0, 0, 42538 }, // 1.2.840.10008.15.0.3.8
+{ 0, 0, 0, 0, 42570 }, // 1.2.840.10008.15.0.3.9
+{ 0, 0, 0, 0, 42594 }, // 1.2.840.10008.15.0.3.10
+{ 0, 0, 0, 0, 42620 }, // 1.2.840.10008.15.0.3.11
+{ 0, 0, 0, 0, 42645 }, // 1.2.840.10008.15.0.3.12
+{ 0, 0, 0, 0, 42659 }, // 1.2.840.10008.15.0.3.13
+{ 0, 0, 0, 0, 42669 }, // 1.2.840.10008.15.0.3.14
+{ 0, 0, 0, 0, 42683 }, // 1.2.840.10008.15.0.3.15
+{ 0, 0, 0, 0, 42701 }, // 1.2.840.10008.15.0.3.16
+{ 0, 0, 0, 0, 42721 }, // 1.2.840.10008.15.0.3.17
+{ 0, 0, 0, 0, 42744 }, // 1.2.840.10008.15.0.3.18
+{ 0, 0, 0, 0, 42772 }, // 1.2.840.10008.15.0.3.19
+{ 0, 0, 0, 0, 42800 }, // 1.2.840.10008.15.0.3.20
+{ 0, 0, 0, 0, 42820 }, // 1.2.840.10008.15.0.3.21
+{ 0, 0, 0, 0, 42860 }, // 1.2.840.10008.15.0.3.22
+{ 0, 0, 0, 0, 42894 }, // 1.2.840.10008.15.0.3.23
+{ 0, 0, 0, 0, 42909 }, // 1.2.840.10008.15.0.3.24
+{ 0, 0, 0, 0, 42926 }, // 1.2.840.10008.15.0.3.25
+{ 0, 0, 0, 0, 42950 }, // 1.2.840.10008.15.0.3.26
+{ 0, 0, 0, 0, 42971 }, // 1.2.840.10008.15.0.3.27
+{ 0, 0, 0, 0, 42995 }, // 1.2.840.10008.15.0.3.28
+{ 0, 0, 0, 0, 43026 }, // 1.2.840.10008.15.0.3.29
+{ 0, 0, 0, 0, 43049 }, // 1.2.840.10008.15.0.3.30
+{ 0, 0, 0, 0, 43078 }, // 1.2.840.10008.15.0.3.31
+{ 0, 0, 0, 0, 43105 }, // 1.2.840.10008.15.0.4.1
+{ 0, 0, 0, 0, 43128 }, // 1.2.840.10008.15.0.4.2
+{ 0, 0, 0, 0, 43145 }, // 1.2.840.10008.15.0.4.3
+{ 0, 0, 0, 0, 43177 }, // 1.2.840.10008.15.0.4.4
+{ 0, 0, 0, 0, 43189 }, // 1.2.840.10008.15.0.4.5
+{ 0, 0, 0, 0, 43204 }, // 1.2.840.10008.15.0.4.6
+{ 0, 0, 0, 0, 43227 }, // 1.2.840.10008.15.0.4.7
+{ 0, 0, 0, 0, 43246 }, // 1.2.840.10008.15.0.4.8
+{ 0, 0, 0, 0, 43270 }, // 1.2.840.10008.15.1.1
 };
 
+// All of the UID names, concatenated: each entry in the table
+// above stores the offset of its name within this one string,
+// with offset zero reserved to mean that there is no name.
+const char UIDNameTable[] =
+  "\0"
+  "Verification SOP Class\0" // 1.2.840.10008.1.1
+  "Implicit VR Little Endian\0" // 1.2.840.10008.1.2
+  "Basic Study Content Notification SOP Class\0" // 1.2.840.10008.1.9 (Retired)
+  "Papyrus 3 Implicit VR Little Endian\0" // 1.2.840.10008.1.20 (Retired)
+  "Procedural Event Logging SOP Class\0" // 1.2.840.10008.1.40
+  "Substance Administration Logging SOP Class\0" // 1.2.840.10008.1.42
+  "Explicit VR Little Endian\0" // 1.2.840.10008.1.2.1
+  "Explicit VR Big Endian\0" // 1.2.840.10008.1.2.2 (Retired)
+  "RLE Lossless\0" // 1.2.840.10008.1.2.5
+  "Deflated Explicit VR Little Endian\0" // 1.2.840.10008.1.2.1.99
+  "JPEG Baseline (Process 1)\0" // 1.2.840.10008.1.2.4.50
+  "JPEG Extended (Process 2 & 4)\0" // 1.2.840.10008.1.2.4.51
+  "JPEG Extended (Process 3 & 5)\0" // 1.2.840.10008.1.2.4.52 (Retired)
+  "JPEG Spectral Selection, Non-Hierarchical (Process 6 & 8)\0" // 1.2.840.10008.1.2.4.53 (Retired)
+  "JPEG Spectral Selection, Non-Hierarchical (Process 7 & 9)\0" // 1.2.840.10008.1.2.4.54 (Retired)
+  "JPEG Full Progression, Non-Hierarchical (Process 10 & 12)\0" // 1.2.840.10008.1.2.4.55 (Retired)
+  "JPEG Full Progression, Non-Hierarchical (Process 11 & 13)\0" // 1.2.840.10008.1.2.4.56 (Retired)
+  "JPEG Lossless, Non-Hierarchical (Process 14)\0" // 1.2.840.10008.1.2.4.57
+  "JPEG Lossless, Non-Hierarchical (Process 15)\0" // 1.2.840.10008.1.2.4.58 (Retired)
+  "JPEG Extended, Hierarchical (Process 16 & 18)\0" // 1.2.840.10008.1.2.4.59 (Retired)
+  "JPEG Extended, Hierarchical (Process 17 & 19)\0" // 1.2.840.10008.1.2.4.60 (Retired)
+  "JPEG Spectral Selection, Hierarchical (Process 20 & 22)\0" // 1.2.840.10008.1.2.4.61 (Retired)
+  "JPEG Spectral Selection, Hierarchical (Process 21 & 23)\0" // 1.2.840.10008.1.2.4.62 (Retired)
+  "JPEG Full Progression, Hierarchical (Process 24 & 26)\0" // 1.2.840.10008.1.2.4.63 (Retired)
+  "JPEG Full Progression, Hierarchical (Process 25 & 27)\0" // 1.2.840.10008.1.2.4.64 (Retired)
+  "JPEG Lossless, Hierarchical (Process 28)\0" // 1.2.840.10008.1.2.4.65 (Retired)
+  "JPEG Lossless, Hierarchical (Process 29)\0" // 1.2.840.10008.1.2.4.66 (Retired)
+  "JPEG Lossless, Non-Hierarchical, First-Order Prediction (Process 14 [Selection Value 1])\0" // 1.2.840.10008.1.2.4.70
+  "JPEG-LS Lossless Image Compression\0" // 1.2.840.10008.1.2.4.80
+  "JPEG-LS Lossy (Near-Lossless) Image Compression\0" // 1.2.840.10008.1.2.4.81
+  "JPEG 2000 Image Compression (Lossless Only)\0" // 1.2.840.10008.1.2.4.90
+  "JPEG 2000 Image Compression\0" // 1.2.840.10008.1.2.4.91
+  "JPEG 2000 Part 2 Multi-component Image Compression (Lossless Only)\0" // 1.2.840.10008.1.2.4.92
+  "JPEG 2000 Part 2 Multi-component Image Compression\0" // 1.2.840.10008.1.2.4.93
+  "JPIP Referenced\0" // 1.2.840.10008.1.2.4.94
+  "JPIP Referenced Deflate\0" // 1.2.840.10008.1.2.4.95
+  "MPEG2 Main Profile @ Main Level\0" // 1.2.840.10008.1.2.4.100
+  "MPEG2 Main Profile @ High Level\0" // 1.2.840.10008.1.2.4.101
+  "MPEG-4 AVC/H.264 High Profile / Level 4.1\0" // 1.2.840.10008.1.2.4.102
+  "MPEG-4 AVC/H.264 BD-compatible High Profile / Level 4.1\0" // 1.2.840.10008.1.2.4.103
+  "MPEG-4 AVC/H.264 High Profile / Level 4.2 For 2D Video\0" // 1.2.840.10008.1.2.4.104
+  "MPEG-4 AVC/H.264 High Profile / Level 4.2 For 3D Video\0" // 1.2.840.10008.1.2.4.105
+  "MPEG-4 AVC/H.264 Stereo High Profile / Level 4.2\0" // 1.2.840.10008.1.2.4.106
+  "RFC 2557 MIME encapsulation\0" // 1.2.840.10008.1.2.6.1
+  "XML Encoding\0" // 1.2.840.10008.1.2.6.2
+  "Media Storage Directory Storage\0" // 1.2.840.10008.1.3.10
+  "Talairach Brain Atlas Frame of Reference\0" // 1.2.840.10008.1.4.1.1
+  "SPM2 T1 Frame of Reference\0" // 1.2.840.10008.1.4.1.2
+  "SPM2 T2 Frame of Reference\0" // 1.2.840.10008.1.4.1.3
+  "SPM2 PD Frame of Reference\0" // 1.2.840.10008.1.4.1.4
+  "SPM2 EPI Frame of Reference\0" // 1.2.840.10008.1.4.1.5
+  "SPM2 FIL T1 Frame of Reference\0" // 1.2.840.10008.1.4.1.6
+  "SPM2 PET Frame of Reference\0" // 1.2.840.10008.1.4.1.7
+  "SPM2 TRANSM Frame of Reference\0" // 1.2.840.10008.1.4.1.8
+  "SPM2 SPECT Frame of Reference\0" // 1.2.840.10008.1.4.1.9
+  "SPM2 GRAY Frame of Reference\0" // 1.2.840.10008.1.4.1.10
+  "SPM2 WHITE Frame of Reference\0" // 1.2.840.10008.1.4.1.11
+  "SPM2 CSF Frame of Reference\0" // 1.2.840.10008.1.4.1.12
+  "SPM2 BRAINMASK Frame of Reference\0" // 1.2.840.10008.1.4.1.13
+  "SPM2 AVG305T1 Frame of Reference\0" // 1.2.840.10008.1.4.1.14
+  "SPM2 AVG152T1 Frame of Reference\0" // 1.2.840.10008.1.4.1.15
+  "SPM2 AVG152T2 Frame of Reference\0" // 1.2.840.10008.1.4.1.16
+  "SPM2 AVG152PD Frame of Reference\0" // 1.2.840.10008.1.4.1.17
+  "SPM2 SINGLESUBJT1 Frame of Reference\0" // 1.2.840.10008.1.4.1.18
+  "ICBM 452 T1 Frame of Reference\0" // 1.2.840.10008.1.4.2.1
+  "ICBM Single Subject MRI Frame of Reference\0" // 1.2.840.10008.1.4.2.2
+  "Hot Iron Color Palette SOP Instance\0" // 1.2.840.10008.1.5.1
+  "PET Color Palette SOP Instance\0" // 1.2.840.10008.1.5.2
+  "Hot Metal Blue Color Palette SOP Instance\0" // 1.2.840.10008.1.5.3
+  "PET 20 Step Color Palette SOP Instance\0" // 1.2.840.10008.1.5.4
+  "Storage Commitment Push Model SOP Class\0" // 1.2.840.10008.1.20.1
+  "Storage Commitment Pull Model SOP Class\0" // 1.2.840.10008.1.20.2 (Retired)
+  "Storage Commitment Push Model SOP Instance\0" // 1.2.840.10008.1.20.1.1
+  "Storage Commitment Pull Model SOP Instance\0" // 1.2.840.10008.1.20.2.1 (Retired)
+  "Procedural Event Logging SOP Instance\0" // 1.2.840.10008.1.40.1
+  "Substance Administration Logging SOP Instance\0" // 1.2.840.10008.1.42.1
+  "DICOM UID Registry\0" // 1.2.840.10008.2.6.1
+  "DICOM Controlled Terminology\0" // 1.2.840.10008.2.16.4
+  "Adult Mouse Anatomy Ontology\0" // 1.2.840.10008.2.16.5
+  "Uberon Ontology\0" // 1.2.840.10008.2.16.6
+  "Integrated Taxonomic Information System (ITIS) Taxonomic Serial Number (TSN)\0" // 1.2.840.10008.2.16.7
+  "Mouse Genome Initiative (MGI)\0" // 1.2.840.10008.2.16.8
+  "PubChem Compound CID\0" // 1.2.840.10008.2.16.9
+  "DICOM Application Context Name\0" // 1.2.840.10008.3.1.1.1
+  "Detached Patient Management SOP Class\0" // 1.2.840.10008.3.1.2.1.1 (Retired)
+  "Detached Patient Management Meta SOP Class\0" // 1.2.840.10008.3.1.2.1.4 (Retired)
+  "Detached Visit Management SOP Class\0" // 1.2.840.10008.3.1.2.2.1 (Retired)
+  "Detached Study Management SOP Class\0" // 1.2.840.10008.3.1.2.3.1 (Retired)
+  "Study Component Management SOP Class\0" // 1.2.840.10008.3.1.2.3.2 (Retired)
+  "Modality Performed Procedure Step SOP Class\0" // 1.2.840.10008.3.1.2.3.3
+  "Modality Performed Procedure Step Retrieve SOP Class\0" // 1.2.840.10008.3.1.2.3.4
+  "Modality Performed Procedure Step Notification SOP Class\0" // 1.2.840.10008.3.1.2.3.5
+  "Detached Results Management SOP Class\0" // 1.2.840.10008.3.1.2.5.1 (Retired)
+  "Detached Results Management Meta SOP Class\0" // 1.2.840.10008.3.1.2.5.4 (Retired)
+  "Detached Study Management Meta SOP Class\0" // 1.2.840.10008.3.1.2.5.5 (Retired)
+  "Detached Interpretation Management SOP Class\0" // 1.2.840.10008.3.1.2.6.1 (Retired)
+  "Storage Service Class\0" // 1.2.840.10008.4.2
+  "Basic Film Session SOP Class\0" // 1.2.840.10008.5.1.1.1
+  "Basic Film Box SOP Class\0" // 1.2.840.10008.5.1.1.2
+  "Basic Grayscale Image Box SOP Class\0" // 1.2.840.10008.5.1.1.4
+  "Basic Grayscale Print Management Meta SOP Class\0" // 1.2.840.10008.5.1.1.9
+  "Print Job SOP Class\0" // 1.2.840.10008.5.1.1.14
+  "Basic Annotation Box SOP Class\0" // 1.2.840.10008.5.1.1.15
+  "Printer SOP Class\0" // 1.2.840.10008.5.1.1.16
+  "Printer SOP Instance\0" // 1.2.840.10008.5.1.1.17
+  "Basic Color Print Management Meta SOP Class\0" // 1.2.840.10008.5.1.1.18
+  "VOI LUT Box SOP Class\0" // 1.2.840.10008.5.1.1.22
+  "Presentation LUT SOP Class\0" // 1.2.840.10008.5.1.1.23
+  "Image Overlay Box SOP Class\0" // 1.2.840.10008.5.1.1.24 (Retired)
+  "Print Queue SOP Instance\0" // 1.2.840.10008.5.1.1.25 (Retired)
+  "Print Queue Management SOP Class\0" // 1.2.840.10008.5.1.1.26 (Retired)
+  "Stored Print Storage SOP Class\0" // 1.2.840.10008.5.1.1.27 (Retired)
+  "Hardcopy Grayscale Image Storage SOP Class\0" // 1.2.840.10008.5.1.1.29 (Retired)
+  "Hardcopy Color Image Storage SOP Class\0" // 1.2.840.10008.5.1.1.30 (Retired)
+  "Pull Print Request SOP Class\0" // 1.2.840.10008.5.1.1.31 (Retired)
+  "Pull Stored Print Management Meta SOP Class\0" // 1.2.840.10008.5.1.1.32 (Retired)
+  "Media Creation Management SOP Class UID\0" // 1.2.840.10008.5.1.1.33
+  "Display System SOP Class\0" // 1.2.840.10008.5.1.1.40
+  "Basic Color Image Box SOP Class\0" // 1.2.840.10008.5.1.1.4.1
+  "Referenced Image Box SOP Class\0" // 1.2.840.10008.5.1.1.4.2 (Retired)
+  "Referenced Grayscale Print Management Meta SOP Class\0" // 1.2.840.10008.5.1.1.9.1 (Retired)
+  "Printer Configuration Retrieval SOP Class\0" // 1.2.840.10008.5.1.1.16.376
+  "Printer Configuration Retrieval SOP Instance\0" // 1.2.840.10008.5.1.1.17.376
+  "Referenced Color Print Management Meta SOP Class\0" // 1.2.840.10008.5.1.1.18.1 (Retired)
+  "Basic Print Image Overlay Box SOP Class\0" // 1.2.840.10008.5.1.1.24.1 (Retired)
+  "Display System SOP Instance\0" // 1.2.840.10008.5.1.1.40.1
+  "Modality Worklist Information Model - FIND\0" // 1.2.840.10008.5.1.4.31
+  "General Purpose Worklist Management Meta SOP Class\0" // 1.2.840.10008.5.1.4.32 (Retired)
+  "Instance Availability Notification SOP Class\0" // 1.2.840.10008.5.1.4.33
+  "Product Characteristics Query SOP Class\0" // 1.2.840.10008.5.1.4.41
+  "Substance Approval Query SOP Class\0" // 1.2.840.10008.5.1.4.42
+  "Computed Radiography Image Storage\0" // 1.2.840.10008.5.1.4.1.1.1
+  "CT Image Storage\0" // 1.2.840.10008.5.1.4.1.1.2
+  "Ultrasound Multi-frame Image Storage\0" // 1.2.840.10008.5.1.4.1.1.3 (Retired)
+  "MR Image Storage\0" // 1.2.840.10008.5.1.4.1.1.4
+  "Nuclear Medicine Image Storage\0" // 1.2.840.10008.5.1.4.1.1.5 (Retired)
+  "Ultrasound Image Storage\0" // 1.2.840.10008.5.1.4.1.1.6 (Retired)
+  "Secondary Capture Image Storage\0" // 1.2.840.10008.5.1.4.1.1.7
+  "Standalone Overlay Storage\0" // 1.2.840.10008.5.1.4.1.1.8 (Retired)
+  "Standalone Curve Storage\0" // 1.2.840.10008.5.1.4.1.1.9 (Retired)
+  "Standalone Modality LUT Storage\0" // 1.2.840.10008.5.1.4.1.1.10 (Retired)
+  "Standalone VOI LUT Storage\0" // 1.2.840.10008.5.1.4.1.1.11 (Retired)
+  "Parametric Map Storage\0" // 1.2.840.10008.5.1.4.1.1.30
+  "1.2.840.10008.5.1.4.1.1.40\0" // 1.2.840.10008.5.1.4.1.1.40 (Retired)
+  "Raw Data Storage\0" // 1.2.840.10008.5.1.4.1.1.66
+  "Real World Value Mapping Storage\0" // 1.2.840.10008.5.1.4.1.1.67
+  "Positron Emission Tomography Image Storage\0" // 1.2.840.10008.5.1.4.1.1.128
+  "Standalone PET Curve Storage\0" // 1.2.840.10008.5.1.4.1.1.129 (Retired)
+  "Enhanced PET Image Storage\0" // 1.2.840.10008.5.1.4.1.1.130
+  "Basic Structured Display Storage\0" // 1.2.840.10008.5.1.4.1.1.131
+  "Digital X-Ray Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.1.1
+  "Digital Mammography X-Ray Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.1.2
+  "Digital Intra-Oral X-Ray Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.1.3
+  "Digital X-Ray Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.1.1.1
+  "Digital Mammography X-Ray Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.1.2.1
+  "Digital Intra-Oral X-Ray Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.1.3.1
+  "Enhanced CT Image Storage\0" // 1.2.840.10008.5.1.4.1.1.2.1
+  "Legacy Converted Enhanced CT Image Storage\0" // 1.2.840.10008.5.1.4.1.1.2.2
+  "Enhanced MR Image Storage\0" // 1.2.840.10008.5.1.4.1.1.4.1
+  "MR Spectroscopy Storage\0" // 1.2.840.10008.5.1.4.1.1.4.2
+  "Enhanced MR Color Image Storage\0" // 1.2.840.10008.5.1.4.1.1.4.3
+  "Legacy Converted Enhanced MR Image Storage\0" // 1.2.840.10008.5.1.4.1.1.4.4
+  "Enhanced US Volume Storage\0" // 1.2.840.10008.5.1.4.1.1.6.2
+  "Multi-frame Single Bit Secondary Capture Image Storage\0" // 1.2.840.10008.5.1.4.1.1.7.1
+  "Multi-frame Grayscale Byte Secondary Capture Image Storage\0" // 1.2.840.10008.5.1.4.1.1.7.2
+  "Multi-frame Grayscale Word Secondary Capture Image Storage\0" // 1.2.840.10008.5.1.4.1.1.7.3
+  "Multi-frame True Color Secondary Capture Image Storage\0" // 1.2.840.10008.5.1.4.1.1.7.4
+  "Waveform Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.9.1 (Retired)
+  "12-lead ECG Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.1.1
+  "General ECG Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.1.2
+  "Ambulatory ECG Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.1.3
+  "Hemodynamic Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.2.1
+  "Cardiac Electrophysiology Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.3.1
+  "Basic Voice Audio Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.4.1
+  "General Audio Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.4.2
+  "Arterial Pulse Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.5.1
+  "Respiratory Waveform Storage\0" // 1.2.840.10008.5.1.4.1.1.9.6.1
+  "Grayscale Softcopy Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.1
+  "Color Softcopy Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.2
+  "Pseudo-Color Softcopy Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.3
+  "Blending Softcopy Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.4
+  "XA/XRF Grayscale Softcopy Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.5
+  "Grayscale Planar MPR Volumetric Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.6
+  "Compositing Planar MPR Volumetric Presentation State Storage\0" // 1.2.840.10008.5.1.4.1.1.11.7
+  "X-Ray Angiographic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.12.1
+  "X-Ray Radiofluoroscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.12.2
+  "X-Ray Angiographic Bi-Plane Image Storage\0" // 1.2.840.10008.5.1.4.1.1.12.3 (Retired)
+  "1.2.840.10008.5.1.4.1.1.12.77\0" // 1.2.840.10008.5.1.4.1.1.12.77 (Retired)
+  "Enhanced XA Image Storage\0" // 1.2.840.10008.5.1.4.1.1.12.1.1
+  "Enhanced XRF Image Storage\0" // 1.2.840.10008.5.1.4.1.1.12.2.1
+  "X-Ray 3D Angiographic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.13.1.1
+  "X-Ray 3D Craniofacial Image Storage\0" // 1.2.840.10008.5.1.4.1.1.13.1.2
+  "Breast Tomosynthesis Image Storage\0" // 1.2.840.10008.5.1.4.1.1.13.1.3
+  "Breast Projection X-Ray Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.13.1.4
+  "Breast Projection X-Ray Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.13.1.5
+  "Intravascular Optical Coherence Tomography Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.14.1
+  "Intravascular Optical Coherence Tomography Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.14.2
+  "Spatial Registration Storage\0" // 1.2.840.10008.5.1.4.1.1.66.1
+  "Spatial Fiducials Storage\0" // 1.2.840.10008.5.1.4.1.1.66.2
+  "Deformable Spatial Registration Storage\0" // 1.2.840.10008.5.1.4.1.1.66.3
+  "Segmentation Storage\0" // 1.2.840.10008.5.1.4.1.1.66.4
+  "Surface Segmentation Storage\0" // 1.2.840.10008.5.1.4.1.1.66.5
+  "Tractography Results Storage\0" // 1.2.840.10008.5.1.4.1.1.66.6
+  "Surface Scan Mesh Storage\0" // 1.2.840.10008.5.1.4.1.1.68.1
+  "Surface Scan Point Cloud Storage\0" // 1.2.840.10008.5.1.4.1.1.68.2
+  "VL Image Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.77.1 (Retired)
+  "VL Multi-frame Image Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.77.2 (Retired)
+  "VL Endoscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.1
+  "VL Microscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.2
+  "VL Slide-Coordinates Microscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.3
+  "VL Photographic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.4
+  "VL Whole Slide Microscopy Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.6
+  "Video Endoscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.1.1
+  "Video Microscopic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.2.1
+  "Video Photographic Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.4.1
+  "Ophthalmic Photography 8 Bit Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.1
+  "Ophthalmic Photography 16 Bit Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.2
+  "Stereometric Relationship Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.3
+  "Ophthalmic Tomography Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.4
+  "Wide Field Ophthalmic Photography Stereographic Projection Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.5
+  "Wide Field Ophthalmic Photography 3D Coordinates Image Storage\0" // 1.2.840.10008.5.1.4.1.1.77.1.5.6
+  "Lensometry Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.1
+  "Autorefraction Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.2
+  "Keratometry Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.3
+  "Subjective Refraction Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.4
+  "Visual Acuity Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.5
+  "Spectacle Prescription Report Storage\0" // 1.2.840.10008.5.1.4.1.1.78.6
+  "Ophthalmic Axial Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.78.7
+  "Intraocular Lens Calculations Storage\0" // 1.2.840.10008.5.1.4.1.1.78.8
+  "Macular Grid Thickness and Volume Report Storage\0" // 1.2.840.10008.5.1.4.1.1.79.1
+  "Ophthalmic Visual Field Static Perimetry Measurements Storage\0" // 1.2.840.10008.5.1.4.1.1.80.1
+  "Ophthalmic Thickness Map Storage\0" // 1.2.840.10008.5.1.4.1.1.81.1
+  "Corneal Topography Map Storage\0" // 1.2.840.10008.5.1.4.1.1.82.1
+  "Text SR Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.88.1 (Retired)
+  "Audio SR Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.88.2 (Retired)
+  "Detail SR Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.88.3 (Retired)
+  "Comprehensive SR Storage - Trial\0" // 1.2.840.10008.5.1.4.1.1.88.4 (Retired)
+  "Basic Text SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.11
+  "Enhanced SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.22
+  "Comprehensive SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.33
+  "Comprehensive 3D SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.34
+  "Extensible SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.35
+  "Procedure Log Storage\0" // 1.2.840.10008.5.1.4.1.1.88.40
+  "Mammography CAD SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.50
+  "Key Object Selection Document Storage\0" // 1.2.840.10008.5.1.4.1.1.88.59
+  "Chest CAD SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.65
+  "X-Ray Radiation Dose SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.67
+  "Radiopharmaceutical Radiation Dose SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.68
+  "Colon CAD SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.69
+  "Implantation Plan SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.70
+  "Acquisition Context SR Storage\0" // 1.2.840.10008.5.1.4.1.1.88.71
+  "Content Assessment Results Storage\0" // 1.2.840.10008.5.1.4.1.1.90.1
+  "Encapsulated PDF Storage\0" // 1.2.840.10008.5.1.4.1.1.104.1
+  "Encapsulated CDA Storage\0" // 1.2.840.10008.5.1.4.1.1.104.2
+  "Legacy Converted Enhanced PET Image Storage\0" // 1.2.840.10008.5.1.4.1.1.128.1
+  "RT Image Storage\0" // 1.2.840.10008.5.1.4.1.1.481.1
+  "RT Dose Storage\0" // 1.2.840.10008.5.1.4.1.1.481.2
+  "RT Structure Set Storage\0" // 1.2.840.10008.5.1.4.1.1.481.3
+  "RT Beams Treatment Record Storage\0" // 1.2.840.10008.5.1.4.1.1.481.4
+  "RT Plan Storage\0" // 1.2.840.10008.5.1.4.1.1.481.5
+  "RT Brachy Treatment Record Storage\0" // 1.2.840.10008.5.1.4.1.1.481.6
+  "RT Treatment Summary Record Storage\0" // 1.2.840.10008.5.1.4.1.1.481.7
+  "RT Ion Plan Storage\0" // 1.2.840.10008.5.1.4.1.1.481.8
+  "RT Ion Beams Treatment Record Storage\0" // 1.2.840.10008.5.1.4.1.1.481.9
+  "DICOS CT Image Storage\0" // 1.2.840.10008.5.1.4.1.1.501.1
+  "DICOS Threat Detection Report Storage\0" // 1.2.840.10008.5.1.4.1.1.501.3
+  "DICOS 2D AIT Storage\0" // 1.2.840.10008.5.1.4.1.1.501.4
+  "DICOS 3D AIT Storage\0" // 1.2.840.10008.5.1.4.1.1.501.5
+  "DICOS Quadrupole Resonance (QR) Storage\0" // 1.2.840.10008.5.1.4.1.1.501.6
+  "DICOS Digital X-Ray Image Storage - For Presentation\0" // 1.2.840.10008.5.1.4.1.1.501.2.1
+  "DICOS Digital X-Ray Image Storage - For Processing\0" // 1.2.840.10008.5.1.4.1.1.501.2.2
+  "Eddy Current Image Storage\0" // 1.2.840.10008.5.1.4.1.1.601.1
+  "Eddy Current Multi-frame Image Storage\0" // 1.2.840.10008.5.1.4.1.1.601.2
+  "Patient Root Query/Retrieve Information Model - FIND\0" // 1.2.840.10008.5.1.4.1.2.1.1
+  "Patient Root Query/Retrieve Information Model - MOVE\0" // 1.2.840.10008.5.1.4.1.2.1.2
+  "Patient Root Query/Retrieve Information Model - GET\0" // 1.2.840.10008.5.1.4.1.2.1.3
+  "Study Root Query/Retrieve Information Model - FIND\0" // 1.2.840.10008.5.1.4.1.2.2.1
+  "Study Root Query/Retrieve Information Model - MOVE\0" // 1.2.840.10008.5.1.4.1.2.2.2
+  "Study Root Query/Retrieve Information Model - GET\0" // 1.2.840.10008.5.1.4.1.2.2.3
+  "Patient/Study Only Query/Retrieve Information Model - FIND\0" // 1.2.840.10008.5.1.4.1.2.3.1 (Retired)
+  "Patient/Study Only Query/Retrieve Information Model - MOVE\0" // 1.2.840.10008.5.1.4.1.2.3.2 (Retired)
+  "Patient/Study Only Query/Retrieve Information Model - GET\0" // 1.2.840.10008.5.1.4.1.2.3.3 (Retired)
+  "Composite Instance Root Retrieve - MOVE\0" // 1.2.840.10008.5.1.4.1.2.4.2
+  "Composite Instance Root Retrieve - GET\0" // 1.2.840.10008.5.1.4.1.2.4.3
+  "Composite Instance Retrieve Without Bulk Data - GET\0" // 1.2.840.10008.5.1.4.1.2.5.3
+  "General Purpose Worklist Information Model - FIND\0" // 1.2.840.10008.5.1.4.32.1 (Retired)
+  "General Purpose Scheduled Procedure Step SOP Class\0" // 1.2.840.10008.5.1.4.32.2 (Retired)
+  "General Purpose Performed Procedure Step SOP Class\0" // 1.2.840.10008.5.1.4.32.3 (Retired)
+  "RT Beams Delivery Instruction Storage - Trial\0" // 1.2.840.10008.5.1.4.34.1 (Retired)
+  "RT Conventional Machine Verification - Trial\0" // 1.2.840.10008.5.1.4.34.2 (Retired)
+  "RT Ion Machine Verification - Trial\0" // 1.2.840.10008.5.1.4.34.3 (Retired)
+  "Unified Worklist and Procedure Step Service Class - Trial\0" // 1.2.840.10008.5.1.4.34.4 (Retired)
+  "UPS Global Subscription SOP Instance\0" // 1.2.840.10008.5.1.4.34.5
+  "Unified Worklist and Procedure Step Service Class\0" // 1.2.840.10008.5.1.4.34.6
+  "RT Beams Delivery Instruction Storage\0" // 1.2.840.10008.5.1.4.34.7
+  "RT Conventional Machine Verification\0" // 1.2.840.10008.5.1.4.34.8
+  "RT Ion Machine Verification\0" // 1.2.840.10008.5.1.4.34.9
+  "RT Brachy Application Setup Delivery Instruction Storage\0" // 1.2.840.10008.5.1.4.34.10
+  "Unified Procedure Step - Push SOP Class - Trial\0" // 1.2.840.10008.5.1.4.34.4.1 (Retired)
+  "Unified Procedure Step - Watch SOP Class - Trial\0" // 1.2.840.10008.5.1.4.34.4.2 (Retired)
+  "Unified Procedure Step - Pull SOP Class - Trial\0" // 1.2.840.10008.5.1.4.34.4.3 (Retired)
+  "Unified Procedure Step - Event SOP Class - Trial\0" // 1.2.840.10008.5.1.4.34.4.4 (Retired)
+  "UPS Filtered Global Subscription SOP Instance\0" // 1.2.840.10008.5.1.4.34.5.1
+  "Unified Procedure Step - Push SOP Class\0" // 1.2.840.10008.5.1.4.34.6.1
+  "Unified Procedure Step - Watch SOP Class\0" // 1.2.840.10008.5.1.4.34.6.2
+  "Unified Procedure Step - Pull SOP Class\0" // 1.2.840.10008.5.1.4.34.6.3
+  "Unified Procedure Step - Event SOP Class\0" // 1.2.840.10008.5.1.4.34.6.4
+  "General Relevant Patient Information Query\0" // 1.2.840.10008.5.1.4.37.1
+  "Breast Imaging Relevant Patient Information Query\0" // 1.2.840.10008.5.1.4.37.2
+  "Cardiac Relevant Patient Information Query\0" // 1.2.840.10008.5.1.4.37.3
+  "Hanging Protocol Storage\0" // 1.2.840.10008.5.1.4.38.1
+  "Hanging Protocol Information Model - FIND\0" // 1.2.840.10008.5.1.4.38.2
+  "Hanging Protocol Information Model - MOVE\0" // 1.2.840.10008.5.1.4.38.3
+  "Hanging Protocol Information Model - GET\0" // 1.2.840.10008.5.1.4.38.4
+  "Color Palette Storage\0" // 1.2.840.10008.5.1.4.39.1
+  "Color Palette Information Model - FIND\0" // 1.2.840.10008.5.1.4.39.2
+  "Color Palette Information Model - MOVE\0" // 1.2.840.10008.5.1.4.39.3
+  "Color Palette Information Model - GET\0" // 1.2.840.10008.5.1.4.39.4
+  "Generic Implant Template Storage\0" // 1.2.840.10008.5.1.4.43.1
+  "Generic Implant Template Information Model - FIND\0" // 1.2.840.10008.5.1.4.43.2
+  "Generic Implant Template Information Model - MOVE\0" // 1.2.840.10008.5.1.4.43.3
+  "Generic Implant Template Information Model - GET\0" // 1.2.840.10008.5.1.4.43.4
+  "Implant Assembly Template Storage\0" // 1.2.840.10008.5.1.4.44.1
+  "Implant Assembly Template Information Model - FIND\0" // 1.2.840.10008.5.1.4.44.2
+  "Implant Assembly Template Information Model - MOVE\0" // 1.2.840.10008.5.1.4.44.3
+  "Implant Assembly Template Information Model - GET\0" // 1.2.840.10008.5.1.4.44.4
+  "Implant Template Group Storage\0" // 1.2.840.10008.5.1.4.45.1
+  "Implant Template Group Information Model - FIND\0" // 1.2.840.10008.5.1.4.45.2
+  "Implant Template Group Information Model - MOVE\0" // 1.2.840.10008.5.1.4.45.3
+  "Implant Template Group Information Model - GET\0" // 1.2.840.10008.5.1.4.45.4
+  "Anatomic Modifier\0" // 1.2.840.10008.6.1.1
+  "Anatomic Region\0" // 1.2.840.10008.6.1.2
+  "Transducer Approach\0" // 1.2.840.10008.6.1.3
+  "Transducer Orientation\0" // 1.2.840.10008.6.1.4
+  "Ultrasound Beam Path\0" // 1.2.840.10008.6.1.5
+  "Angiographic Interventional Devices\0" // 1.2.840.10008.6.1.6
+  "Image Guided Therapeutic Procedures\0" // 1.2.840.10008.6.1.7
+  "Interventional Drug\0" // 1.2.840.10008.6.1.8
+  "Route of Administration\0" // 1.2.840.10008.6.1.9
+  "Radiographic Contrast Agent\0" // 1.2.840.10008.6.1.10
+  "Radiographic Contrast Agent Ingredient\0" // 1.2.840.10008.6.1.11
+  "Isotopes in Radiopharmaceuticals\0" // 1.2.840.10008.6.1.12
+  "Patient Orientation\0" // 1.2.840.10008.6.1.13
+  "Patient Orientation Modifier\0" // 1.2.840.10008.6.1.14
+  "Patient Equipment Relationship\0" // 1.2.840.10008.6.1.15
+  "Cranio-Caudad Angulation\0" // 1.2.840.10008.6.1.16
+  "Radiopharmaceuticals\0" // 1.2.840.10008.6.1.17
+  "Nuclear Medicine Projections\0" // 1.2.840.10008.6.1.18
+  "Acquisition Modality\0" // 1.2.840.10008.6.1.19
+  "DICOM Devices\0" // 1.2.840.10008.6.1.20
+  "Abstract Priors\0" // 1.2.840.10008.6.1.21
+  "Numeric Value Qualifier\0" // 1.2.840.10008.6.1.22
+  "Units of Measurement\0" // 1.2.840.10008.6.1.23
+  "Units for Real World Value Mapping\0" // 1.2.840.10008.6.1.24
+  "Level of Significance\0" // 1.2.840.10008.6.1.25
+  "Measurement Range Concepts\0" // 1.2.840.10008.6.1.26
+  "Normality Codes\0" // 1.2.840.10008.6.1.27
+  "Normal Range Values\0" // 1.2.840.10008.6.1.28
+  "Selection Method\0" // 1.2.840.10008.6.1.29
+  "Measurement Uncertainty Concepts\0" // 1.2.840.10008.6.1.30
+  "Population Statistical Descriptors\0" // 1.2.840.10008.6.1.31
+  "Sample Statistical Descriptors\0" // 1.2.840.10008.6.1.32
+  "Equation or Table\0" // 1.2.840.10008.6.1.33
+  "Yes-No\0" // 1.2.840.10008.6.1.34
+  "Present-Absent\0" // 1.2.840.10008.6.1.35
+  "Normal-Abnormal\0" // 1.2.840.10008.6.1.36
+  "Laterality\0" // 1.2.840.10008.6.1.37
+  "Positive-Negative\0" // 1.2.840.10008.6.1.38
+  "Severity of Complication\0" // 1.2.840.10008.6.1.39
+  "Observer Type\0" // 1.2.840.10008.6.1.40
+  "Observation Subject Class\0" // 1.2.840.10008.6.1.41
+  "Audio Channel Source\0" // 1.2.840.10008.6.1.42
+  "ECG Leads\0" // 1.2.840.10008.6.1.43
+  "Hemodynamic Waveform Sources\0" // 1.2.840.10008.6.1.44
+  "Cardiovascular Anatomic Locations\0" // 1.2.840.10008.6.1.45
+  "Electrophysiology Anatomic Locations\0" // 1.2.840.10008.6.1.46
+  "Coronary Artery Segments\0" // 1.2.840.10008.6.1.47
+  "Coronary Arteries\0" // 1.2.840.10008.6.1.48
+  "Cardiovascular Anatomic Location Modifiers\0" // 1.2.840.10008.6.1.49
+  "Cardiology Units of Measurement\0" // 1.2.840.10008.6.1.50 (Retired)
+  "Time Synchronization Channel Types\0" // 1.2.840.10008.6.1.51
+  "Cardiac Procedural State Values\0" // 1.2.840.10008.6.1.52
+  "Electrophysiology Measurement Functions and Techniques\0" // 1.2.840.10008.6.1.53
+  "Hemodynamic Measurement Techniques\0" // 1.2.840.10008.6.1.54
+  "Catheterization Procedure Phase\0" // 1.2.840.10008.6.1.55
+  "Electrophysiology Procedure Phase\0" // 1.2.840.10008.6.1.56
+  "Stress Protocols\0" // 1.2.840.10008.6.1.57
+  "ECG Patient State Values\0" // 1.2.840.10008.6.1.58
+  "Electrode Placement Values\0" // 1.2.840.10008.6.1.59
+  "XYZ Electrode Placement Values\0" // 1.2.840.10008.6.1.60 (Retired)
+  "Hemodynamic Physiological Challenges\0" // 1.2.840.10008.6.1.61
+  "ECG Annotations\0" // 1.2.840.10008.6.1.62
+  "Hemodynamic Annotations\0" // 1.2.840.10008.6.1.63
+  "Electrophysiology Annotations\0" // 1.2.840.10008.6.1.64
+  "Procedure Log Titles\0" // 1.2.840.10008.6.1.65
+  "Types of Log Notes\0" // 1.2.840.10008.6.1.66
+  "Patient Status and Events\0" // 1.2.840.10008.6.1.67
+  "Percutaneous Entry\0" // 1.2.840.10008.6.1.68
+  "Staff Actions\0" // 1.2.840.10008.6.1.69
+  "Procedure Action Values\0" // 1.2.840.10008.6.1.70
+  "Non-coronary Transcatheter Interventions\0" // 1.2.840.10008.6.1.71
+  "Purpose of Reference to Object\0" // 1.2.840.10008.6.1.72
+  "Actions With Consumables\0" // 1.2.840.10008.6.1.73
+  "Administration of Drugs/Contrast\0" // 1.2.840.10008.6.1.74
+  "Numeric Parameters of Drugs/Contrast\0" // 1.2.840.10008.6.1.75
+  "Intracoronary Devices\0" // 1.2.840.10008.6.1.76
+  "Intervention Actions and Status\0" // 1.2.840.10008.6.1.77
+  "Adverse Outcomes\0" // 1.2.840.10008.6.1.78
+  "Procedure Urgency\0" // 1.2.840.10008.6.1.79
+  "Cardiac Rhythms\0" // 1.2.840.10008.6.1.80
+  "Respiration Rhythms\0" // 1.2.840.10008.6.1.81
+  "Lesion Risk\0" // 1.2.840.10008.6.1.82
+  "Findings Titles\0" // 1.2.840.10008.6.1.83
+  "Procedure Action\0" // 1.2.840.10008.6.1.84
+  "Device Use Actions\0" // 1.2.840.10008.6.1.85
+  "Numeric Device Characteristics\0" // 1.2.840.10008.6.1.86
+  "Intervention Parameters\0" // 1.2.840.10008.6.1.87
+  "Consumables Parameters\0" // 1.2.840.10008.6.1.88
+  "Equipment Events\0" // 1.2.840.10008.6.1.89
+  "Imaging Procedures\0" // 1.2.840.10008.6.1.90
+  "Catheterization Devices\0" // 1.2.840.10008.6.1.91
+  "DateTime Qualifiers\0" // 1.2.840.10008.6.1.92
+  "Peripheral Pulse Locations\0" // 1.2.840.10008.6.1.93
+  "Patient Assessments\0" // 1.2.840.10008.6.1.94
+  "Peripheral Pulse Methods\0" // 1.2.840.10008.6.1.95
+  "Skin Condition\0" // 1.2.840.10008.6.1.96
+  "Airway Assessment\0" // 1.2.840.10008.6.1.97
+  "Calibration Objects\0" // 1.2.840.10008.6.1.98
+  "Calibration Methods\0" // 1.2.840.10008.6.1.99
+  "Cardiac Volume Methods\0" // 1.2.840.10008.6.1.100
+  "Index Methods\0" // 1.2.840.10008.6.1.101
+  "Sub-segment Methods\0" // 1.2.840.10008.6.1.102
+  "Contour Realignment\0" // 1.2.840.10008.6.1.103
+  "Circumferential Extent\0" // 1.2.840.10008.6.1.104
+  "Regional Extent\0" // 1.2.840.10008.6.1.105
+  "Chamber Identification\0" // 1.2.840.10008.6.1.106
+  "QA Reference Methods\0" // 1.2.840.10008.6.1.107
+  "Plane Identification\0" // 1.2.840.10008.6.1.108
+  "Ejection Fraction\0" // 1.2.840.10008.6.1.109
+  "ED Volume\0" // 1.2.840.10008.6.1.110
+  "ES Volume\0" // 1.2.840.10008.6.1.111
+  "Vessel Lumen Cross-sectional Area Calculation Methods\0" // 1.2.840.10008.6.1.112
+  "Estimated Volumes\0" // 1.2.840.10008.6.1.113
+  "Cardiac Contraction Phase\0" // 1.2.840.10008.6.1.114
+  "IVUS Procedure Phases\0" // 1.2.840.10008.6.1.115
+  "IVUS Distance Measurements\0" // 1.2.840.10008.6.1.116
+  "IVUS Area Measurements\0" // 1.2.840.10008.6.1.117
+  "IVUS Longitudinal Measurements\0" // 1.2.840.10008.6.1.118
+  "IVUS Indices and Ratios\0" // 1.2.840.10008.6.1.119
+  "IVUS Volume Measurements\0" // 1.2.840.10008.6.1.120
+  "Vascular Measurement Sites\0" // 1.2.840.10008.6.1.121
+  "Intravascular Volumetric Regions\0" // 1.2.840.10008.6.1.122
+  "Min/Max/Mean\0" // 1.2.840.10008.6.1.123
+  "Calcium Distribution\0" // 1.2.840.10008.6.1.124
+  "IVUS Lesion Morphologies\0" // 1.2.840.10008.6.1.125
+  "Vascular Dissection Classifications\0" // 1.2.840.10008.6.1.126
+  "IVUS Relative Stenosis Severities\0" // 1.2.840.10008.6.1.127
+  "IVUS Non Morphological Findings\0" // 1.2.840.10008.6.1.128
+  "IVUS Plaque Composition\0" // 1.2.840.10008.6.1.129
+  "IVUS Fiducial Points\0" // 1.2.840.10008.6.1.130
+  "IVUS Arterial Morphology\0" // 1.2.840.10008.6.1.131
+  "Pressure Units\0" // 1.2.840.10008.6.1.132
+  "Hemodynamic Resistance Units\0" // 1.2.840.10008.6.1.133
+  "Indexed Hemodynamic Resistance Units\0" // 1.2.840.10008.6.1.134
+  "Catheter Size Units\0" // 1.2.840.10008.6.1.135
+  "Specimen Collection\0" // 1.2.840.10008.6.1.136
+  "Blood Source Type\0" // 1.2.840.10008.6.1.137
+  "Blood Gas Pressures\0" // 1.2.840.10008.6.1.138
+  "Blood Gas Content\0" // 1.2.840.10008.6.1.139
+  "Blood Gas Saturation\0" // 1.2.840.10008.6.1.140
+  "Blood Base Excess\0" // 1.2.840.10008.6.1.141
+  "Blood pH\0" // 1.2.840.10008.6.1.142
+  "Arterial / Venous Content\0" // 1.2.840.10008.6.1.143
+  "Oxygen Administration Actions\0" // 1.2.840.10008.6.1.144
+  "Oxygen Administration\0" // 1.2.840.10008.6.1.145
+  "Circulatory Support Actions\0" // 1.2.840.10008.6.1.146
+  "Ventilation Actions\0" // 1.2.840.10008.6.1.147
+  "Pacing Actions\0" // 1.2.840.10008.6.1.148
+  "Circulatory Support\0" // 1.2.840.10008.6.1.149
+  "Ventilation\0" // 1.2.840.10008.6.1.150
+  "Pacing\0" // 1.2.840.10008.6.1.151
+  "Blood Pressure Methods\0" // 1.2.840.10008.6.1.152
+  "Relative Times\0" // 1.2.840.10008.6.1.153
+  "Hemodynamic Patient State\0" // 1.2.840.10008.6.1.154
+  "Arterial Lesion Locations\0" // 1.2.840.10008.6.1.155
+  "Arterial Source Locations\0" // 1.2.840.10008.6.1.156
+  "Venous Source Locations\0" // 1.2.840.10008.6.1.157
+  "Atrial Source Locations\0" // 1.2.840.10008.6.1.158
+  "Ventricular Source Locations\0" // 1.2.840.10008.6.1.159
+  "Gradient Source Locations\0" // 1.2.840.10008.6.1.160
+  "Pressure Measurements\0" // 1.2.840.10008.6.1.161
+  "Blood Velocity Measurements\0" // 1.2.840.10008.6.1.162
+  "Hemodynamic Time Measurements\0" // 1.2.840.10008.6.1.163
+  "Valve Areas, Non-mitral\0" // 1.2.840.10008.6.1.164
+  "Valve Areas\0" // 1.2.840.10008.6.1.165
+  "Hemodynamic Period Measurements\0" // 1.2.840.10008.6.1.166
+  "Valve Flows\0" // 1.2.840.10008.6.1.167
+  "Hemodynamic Flows\0" // 1.2.840.10008.6.1.168
+  "Hemodynamic Resistance Measurements\0" // 1.2.840.10008.6.1.169
+  "Hemodynamic Ratios\0" // 1.2.840.10008.6.1.170
+  "Fractional Flow Reserve\0" // 1.2.840.10008.6.1.171
+  "Measurement Type\0" // 1.2.840.10008.6.1.172
+  "Cardiac Output Methods\0" // 1.2.840.10008.6.1.173
+  "Procedure Intent\0" // 1.2.840.10008.6.1.174
+  "Hypertension\0" // 1.2.840.10008.6.1.176
+  "Hemodynamic Assessments\0" // 1.2.840.10008.6.1.177
+  "Degree Findings\0" // 1.2.840.10008.6.1.178
+  "Hemodynamic Measurement Phase\0" // 1.2.840.10008.6.1.179
+  "Body Surface Area Equations\0" // 1.2.840.10008.6.1.180
+  "Oxygen Consumption Equations and Tables\0" // 1.2.840.10008.6.1.181
+  "P50 Equations\0" // 1.2.840.10008.6.1.182
+  "Framingham Scores\0" // 1.2.840.10008.6.1.183
+  "Framingham Tables\0" // 1.2.840.10008.6.1.184
+  "ECG Procedure Types\0" // 1.2.840.10008.6.1.185
+  "Reason for ECG Exam\0" // 1.2.840.10008.6.1.186
+  "Pacemakers\0" // 1.2.840.10008.6.1.187
+  "Diagnosis\0" // 1.2.840.10008.6.1.188 (Retired)
+  "Other Filters\0" // 1.2.840.10008.6.1.189 (Retired)
+  "Lead Measurement Technique\0" // 1.2.840.10008.6.1.190
+  "Summary Codes ECG\0" // 1.2.840.10008.6.1.191
+  "QT Correction Algorithms\0" // 1.2.840.10008.6.1.192
+  "ECG Morphology Descriptions\0" // 1.2.840.10008.6.1.193 (Retired)
+  "ECG Lead Noise Descriptions\0" // 1.2.840.10008.6.1.194
+  "ECG Lead Noise Modifiers\0" // 1.2.840.10008.6.1.195 (Retired)
+  "Probability\0" // 1.2.840.10008.6.1.196 (Retired)
+  "Modifiers\0" // 1.2.840.10008.6.1.197 (Retired)
+  "Trend\0" // 1.2.840.10008.6.1.198 (Retired)
+  "Conjunctive Terms\0" // 1.2.840.10008.6.1.199 (Retired)
+  "ECG Interpretive Statements\0" // 1.2.840.10008.6.1.200 (Retired)
+  "Electrophysiology Waveform Durations\0" // 1.2.840.10008.6.1.201
+  "Electrophysiology Waveform Voltages\0" // 1.2.840.10008.6.1.202
+  "Cath Diagnosis\0" // 1.2.840.10008.6.1.203
+  "Cardiac Valves and Tracts\0" // 1.2.840.10008.6.1.204
+  "Wall Motion\0" // 1.2.840.10008.6.1.205
+  "Myocardium Wall Morphology Findings\0" // 1.2.840.10008.6.1.206
+  "Chamber Size\0" // 1.2.840.10008.6.1.207
+  "Overall Contractility\0" // 1.2.840.10008.6.1.208
+  "VSD Description\0" // 1.2.840.10008.6.1.209
+  "Aortic Root Description\0" // 1.2.840.10008.6.1.210
+  "Coronary Dominance\0" // 1.2.840.10008.6.1.211
+  "Valvular Abnormalities\0" // 1.2.840.10008.6.1.212
+  "Vessel Descriptors\0" // 1.2.840.10008.6.1.213
+  "TIMI Flow Characteristics\0" // 1.2.840.10008.6.1.214
+  "Thrombus\0" // 1.2.840.10008.6.1.215
+  "Lesion Margin\0" // 1.2.840.10008.6.1.216
+  "Severity\0" // 1.2.840.10008.6.1.217
+  "Myocardial Wall Segments\0" // 1.2.840.10008.6.1.218
+  "Myocardial Wall Segments in Projection\0" // 1.2.840.10008.6.1.219
+  "Canadian Clinical Classification\0" // 1.2.840.10008.6.1.220
+  "Cardiac History Dates\0" // 1.2.840.10008.6.1.221 (Retired)
+  "Cardiovascular Surgeries\0" // 1.2.840.10008.6.1.222
+  "Diabetic Therapy\0" // 1.2.840.10008.6.1.223
+  "MI Types\0" // 1.2.840.10008.6.1.224
+  "Smoking History\0" // 1.2.840.10008.6.1.225
+  "Indications for Coronary Intervention\0" // 1.2.840.10008.6.1.226
+  "Indications for Catheterization\0" // 1.2.840.10008.6.1.227
+  "Cath Findings\0" // 1.2.840.10008.6.1.228
+  "Admission Status\0" // 1.2.840.10008.6.1.229
+  "Insurance Payor\0" // 1.2.840.10008.6.1.230
+  "Primary Cause of Death\0" // 1.2.840.10008.6.1.231
+  "Acute Coronary Syndrome Time Period\0" // 1.2.840.10008.6.1.232
+  "NYHA Classification\0" // 1.2.840.10008.6.1.233
+  "Non-invasive Test - Ischemia\0" // 1.2.840.10008.6.1.234
+  "Pre-Cath Angina Type\0" // 1.2.840.10008.6.1.235
+  "Cath Procedure Type\0" // 1.2.840.10008.6.1.236
+  "Thrombolytic Administration\0" // 1.2.840.10008.6.1.237
+  "Medication Administration, Lab Visit\0" // 1.2.840.10008.6.1.238
+  "Medication Administration, PCI\0" // 1.2.840.10008.6.1.239
+  "Clopidogrel/Ticlopidine Administration\0" // 1.2.840.10008.6.1.240
+  "EF Testing Method\0" // 1.2.840.10008.6.1.241
+  "Calculation Method\0" // 1.2.840.10008.6.1.242
+  "Percutaneous Entry Site\0" // 1.2.840.10008.6.1.243
+  "Percutaneous Closure\0" // 1.2.840.10008.6.1.244
+  "Angiographic EF Testing Method\0" // 1.2.840.10008.6.1.245
+  "PCI Procedure Result\0" // 1.2.840.10008.6.1.246
+  "Previously Dilated Lesion\0" // 1.2.840.10008.6.1.247
+  "Guidewire Crossing\0" // 1.2.840.10008.6.1.248
+  "Vascular Complications\0" // 1.2.840.10008.6.1.249
+  "Cath Complications\0" // 1.2.840.10008.6.1.250
+  "Cardiac Patient Risk Factors\0" // 1.2.840.10008.6.1.251
+  "Cardiac Diagnostic Procedures\0" // 1.2.840.10008.6.1.252
+  "Cardiovascular Family History\0" // 1.2.840.10008.6.1.253
+  "Hypertension Therapy\0" // 1.2.840.10008.6.1.254
+  "Antilipemic Agents\0" // 1.2.840.10008.6.1.255
+  "Antiarrhythmic Agents\0" // 1.2.840.10008.6.1.256
+  "Myocardial Infarction Therapies\0" // 1.2.840.10008.6.1.257
+  "Concern Types\0" // 1.2.840.10008.6.1.258
+  "Problem Status\0" // 1.2.840.10008.6.1.259
+  "Health Status\0" // 1.2.840.10008.6.1.260
+  "Use Status\0" // 1.2.840.10008.6.1.261
+  "Social History\0" // 1.2.840.10008.6.1.262
+  "Implanted Devices\0" // 1.2.840.10008.6.1.263
+  "Plaque Structures\0" // 1.2.840.10008.6.1.264
+  "Stenosis Measurement Methods\0" // 1.2.840.10008.6.1.265
+  "Stenosis Types\0" // 1.2.840.10008.6.1.266
+  "Stenosis Shape\0" // 1.2.840.10008.6.1.267
+  "Volume Measurement Methods\0" // 1.2.840.10008.6.1.268
+  "Aneurysm Types\0" // 1.2.840.10008.6.1.269
+  "Associated Conditions\0" // 1.2.840.10008.6.1.270
+  "Vascular Morphology\0" // 1.2.840.10008.6.1.271
+  "Stent Findings\0" // 1.2.840.10008.6.1.272
+  "Stent Composition\0" // 1.2.840.10008.6.1.273
+  "Source of Vascular Finding\0" // 1.2.840.10008.6.1.274
+  "Vascular Sclerosis Types\0" // 1.2.840.10008.6.1.275
+  "Non-invasive Vascular Procedures\0" // 1.2.840.10008.6.1.276
+  "Papillary Muscle Included/Excluded\0" // 1.2.840.10008.6.1.277
+  "Respiratory Status\0" // 1.2.840.10008.6.1.278
+  "Heart Rhythm\0" // 1.2.840.10008.6.1.279
+  "Vessel Segments\0" // 1.2.840.10008.6.1.280
+  "Pulmonary Arteries\0" // 1.2.840.10008.6.1.281
+  "Stenosis Length\0" // 1.2.840.10008.6.1.282
+  "Stenosis Grade\0" // 1.2.840.10008.6.1.283
+  "Cardiac Ejection Fraction\0" // 1.2.840.10008.6.1.284
+  "Cardiac Volume Measurements\0" // 1.2.840.10008.6.1.285
+  "Time-based Perfusion Measurements\0" // 1.2.840.10008.6.1.286
+  "Fiducial Feature\0" // 1.2.840.10008.6.1.287
+  "Diameter Derivation\0" // 1.2.840.10008.6.1.288
+  "Coronary Veins\0" // 1.2.840.10008.6.1.289
+  "Pulmonary Veins\0" // 1.2.840.10008.6.1.290
+  "Myocardial Subsegment\0" // 1.2.840.10008.6.1.291
+  "Partial View Section for Mammography\0" // 1.2.840.10008.6.1.292
+  "DX Anatomy Imaged\0" // 1.2.840.10008.6.1.293
+  "DX View\0" // 1.2.840.10008.6.1.294
+  "DX View Modifier\0" // 1.2.840.10008.6.1.295
+  "Projection Eponymous Name\0" // 1.2.840.10008.6.1.296
+  "Anatomic Region for Mammography\0" // 1.2.840.10008.6.1.297
+  "View for Mammography\0" // 1.2.840.10008.6.1.298
+  "View Modifier for Mammography\0" // 1.2.840.10008.6.1.299
+  "Anatomic Region for Intra-oral Radiography\0" // 1.2.840.10008.6.1.300
+  "Anatomic Region Modifier for Intra-oral Radiography\0" // 1.2.840.10008.6.1.301
+  "Primary Anatomic Structure for Intra-oral Radiography (Permanent Dentition - Designation of Teeth)\0" // 1.2.840.10008.6.1.302
+  "Primary Anatomic Structure for Intra-oral Radiography (Deciduous Dentition - Designation of Teeth)\0" // 1.2.840.10008.6.1.303
+  "PET Radionuclide\0" // 1.2.840.10008.6.1.304
+  "PET Radiopharmaceutical\0" // 1.2.840.10008.6.1.305
+  "Craniofacial Anatomic Regions\0" // 1.2.840.10008.6.1.306
+  "CT, MR and PET Anatomy Imaged\0" // 1.2.840.10008.6.1.307
+  "Common Anatomic Regions\0" // 1.2.840.10008.6.1.308
+  "MR Spectroscopy Metabolites\0" // 1.2.840.10008.6.1.309
+  "MR Proton Spectroscopy Metabolites\0" // 1.2.840.10008.6.1.310
+  "Endoscopy Anatomic Regions\0" // 1.2.840.10008.6.1.311
+  "XA/XRF Anatomy Imaged\0" // 1.2.840.10008.6.1.312
+  "Drug or Contrast Agent Characteristics\0" // 1.2.840.10008.6.1.313
+  "General Devices\0" // 1.2.840.10008.6.1.314
+  "Phantom Devices\0" // 1.2.840.10008.6.1.315
+  "Ophthalmic Imaging Agent\0" // 1.2.840.10008.6.1.316
+  "Patient Eye Movement Command\0" // 1.2.840.10008.6.1.317
+  "Ophthalmic Photography Acquisition Device\0" // 1.2.840.10008.6.1.318
+  "Ophthalmic Photography Illumination\0" // 1.2.840.10008.6.1.319
+  "Ophthalmic Filter\0" // 1.2.840.10008.6.1.320
+  "Ophthalmic Lens\0" // 1.2.840.10008.6.1.321
+  "Ophthalmic Channel Description\0" // 1.2.840.10008.6.1.322
+  "Ophthalmic Image Position\0" // 1.2.840.10008.6.1.323
+  "Mydriatic Agent\0" // 1.2.840.10008.6.1.324
+  "Ophthalmic Anatomic Structure Imaged\0" // 1.2.840.10008.6.1.325
+  "Ophthalmic Tomography Acquisition Device\0" // 1.2.840.10008.6.1.326
+  "Ophthalmic OCT Anatomic Structure Imaged\0" // 1.2.840.10008.6.1.327
+  "Languages\0" // 1.2.840.10008.6.1.328
+  "Countries\0" // 1.2.840.10008.6.1.329
+  "Overall Breast Composition\0" // 1.2.840.10008.6.1.330
+  "Overall Breast Composition from BI-RADS(R)\0" // 1.2.840.10008.6.1.331
+  "Change Since Last Mammogram or Prior Surgery\0" // 1.2.840.10008.6.1.332
+  "Change Since Last Mammogram or Prior Surgery from BI-RADS(R)\0" // 1.2.840.10008.6.1.333
+  "Mammography Characteristics of Shape\0" // 1.2.840.10008.6.1.334
+  "Characteristics of Shape from BI-RADS(R)\0" // 1.2.840.10008.6.1.335
+  "Mammography Characteristics of Margin\0" // 1.2.840.10008.6.1.336
+  "Characteristics of Margin from BI-RADS(R)\0" // 1.2.840.10008.6.1.337
+  "Density Modifier\0" // 1.2.840.10008.6.1.338
+  "Density Modifier from BI-RADS(R)\0" // 1.2.840.10008.6.1.339
+  "Mammography Calcification Types\0" // 1.2.840.10008.6.1.340
+  "Calcification Types from BI-RADS(R)\0" // 1.2.840.10008.6.1.341
+  "Calcification Distribution Modifier\0" // 1.2.840.10008.6.1.342
+  "Calcification Distribution Modifier from BI-RADS(R)\0" // 1.2.840.10008.6.1.343
+  "Mammography Single Image Finding\0" // 1.2.840.10008.6.1.344
+  "Single Image Finding from BI-RADS(R)\0" // 1.2.840.10008.6.1.345
+  "Mammography Composite Feature\0" // 1.2.840.10008.6.1.346
+  "Composite Feature from BI-RADS(R)\0" // 1.2.840.10008.6.1.347
+  "Clockface Location or Region\0" // 1.2.840.10008.6.1.348
+  "Clockface Location or Region from BI-RADS(R)\0" // 1.2.840.10008.6.1.349
+  "Quadrant Location\0" // 1.2.840.10008.6.1.350
+  "Quadrant Location from BI-RADS(R)\0" // 1.2.840.10008.6.1.351
+  "Side\0" // 1.2.840.10008.6.1.352
+  "Side from BI-RADS(R)\0" // 1.2.840.10008.6.1.353
+  "Depth\0" // 1.2.840.10008.6.1.354
+  "Depth from BI-RADS(R)\0" // 1.2.840.10008.6.1.355
+  "Mammography Assessment\0" // 1.2.840.10008.6.1.356
+  "Assessment from BI-RADS(R)\0" // 1.2.840.10008.6.1.357
+  "Mammography Recommended Follow-up\0" // 1.2.840.10008.6.1.358
+  "Recommended Follow-up from BI-RADS(R)\0" // 1.2.840.10008.6.1.359
+  "Mammography Pathology Codes\0" // 1.2.840.10008.6.1.360
+  "Benign Pathology Codes from BI-RADS(R)\0" // 1.2.840.10008.6.1.361
+  "High Risk Lesions Pathology Codes from BI-RADS(R)\0" // 1.2.840.10008.6.1.362
+  "Malignant Pathology Codes from BI-RADS(R)\0" // 1.2.840.10008.6.1.363
+  "Intended Use of CAD Output\0" // 1.2.840.10008.6.1.364
+  "Composite Feature Relations\0" // 1.2.840.10008.6.1.365
+  "Scope of Feature\0" // 1.2.840.10008.6.1.366
+  "Mammography Quantitative Temporal Difference Type\0" // 1.2.840.10008.6.1.367
+  "Mammography Qualitative Temporal Difference Type\0" // 1.2.840.10008.6.1.368
+  "Nipple Characteristic\0" // 1.2.840.10008.6.1.369
+  "Non-lesion Object Type\0" // 1.2.840.10008.6.1.370
+  "Mammography Image Quality Finding\0" // 1.2.840.10008.6.1.371
+  "Status of Results\0" // 1.2.840.10008.6.1.372
+  "Types of Mammography CAD Analysis\0" // 1.2.840.10008.6.1.373
+  "Types of Image Quality Assessment\0" // 1.2.840.10008.6.1.374
+  "Mammography Types of Quality Control Standard\0" // 1.2.840.10008.6.1.375
+  "Units of Follow-up Interval\0" // 1.2.840.10008.6.1.376
+  "CAD Processing and Findings Summary\0" // 1.2.840.10008.6.1.377
+  "CAD Operating Point Axis Label\0" // 1.2.840.10008.6.1.378
+  "Breast Procedure Reported\0" // 1.2.840.10008.6.1.379
+  "Breast Procedure Reason\0" // 1.2.840.10008.6.1.380
+  "Breast Imaging Report Section Title\0" // 1.2.840.10008.6.1.381
+  "Breast Imaging Report Elements\0" // 1.2.840.10008.6.1.382
+  "Breast Imaging Findings\0" // 1.2.840.10008.6.1.383
+  "Breast Clinical Finding or Indicated Problem\0" // 1.2.840.10008.6.1.384
+  "Associated Findings for Breast\0" // 1.2.840.10008.6.1.385
+  "Ductography Findings for Breast\0" // 1.2.840.10008.6.1.386
+  "Procedure Modifiers for Breast\0" // 1.2.840.10008.6.1.387
+  "Breast Implant Types\0" // 1.2.840.10008.6.1.388
+  "Breast Biopsy Techniques\0" // 1.2.840.10008.6.1.389
+  "Breast Imaging Procedure Modifiers\0" // 1.2.840.10008.6.1.390
+  "Interventional Procedure Complications\0" // 1.2.840.10008.6.1.391
+  "Interventional Procedure Results\0" // 1.2.840.10008.6.1.392
+  "Ultrasound Findings for Breast\0" // 1.2.840.10008.6.1.393
+  "Instrument Approach\0" // 1.2.840.10008.6.1.394
+  "Target Confirmation\0" // 1.2.840.10008.6.1.395
+  "Fluid Color\0" // 1.2.840.10008.6.1.396
+  "Tumor Stages From AJCC\0" // 1.2.840.10008.6.1.397
+  "Nottingham Combined Histologic Grade\0" // 1.2.840.10008.6.1.398
+  "Bloom-Richardson Histologic Grade\0" // 1.2.840.10008.6.1.399
+  "Histologic Grading Method\0" // 1.2.840.10008.6.1.400
+  "Breast Implant Findings\0" // 1.2.840.10008.6.1.401
+  "Gynecological Hormones\0" // 1.2.840.10008.6.1.402
+  "Breast Cancer Risk Factors\0" // 1.2.840.10008.6.1.403
+  "Gynecological Procedures\0" // 1.2.840.10008.6.1.404
+  "Procedures for Breast\0" // 1.2.840.10008.6.1.405
+  "Mammoplasty Procedures\0" // 1.2.840.10008.6.1.406
+  "Therapies for Breast\0" // 1.2.840.10008.6.1.407
+  "Menopausal Phase\0" // 1.2.840.10008.6.1.408
+  "General Risk Factors\0" // 1.2.840.10008.6.1.409
+  "OB-GYN Maternal Risk Factors\0" // 1.2.840.10008.6.1.410
+  "Substances\0" // 1.2.840.10008.6.1.411
+  "Relative Usage, Exposure Amount\0" // 1.2.840.10008.6.1.412
+  "Relative Frequency of Event Values\0" // 1.2.840.10008.6.1.413
+  "Quantitative Concepts for Usage, Exposure\0" // 1.2.840.10008.6.1.414
+  "Qualitative Concepts for Usage, Exposure Amount\0" // 1.2.840.10008.6.1.415
+  "Qualitative Concepts for Usage, Exposure Frequency\0" // 1.2.840.10008.6.1.416
+  "Numeric Properties of Procedures\0" // 1.2.840.10008.6.1.417
+  "Pregnancy Status\0" // 1.2.840.10008.6.1.418
+  "Side of Family\0" // 1.2.840.10008.6.1.419
+  "Chest Component Categories\0" // 1.2.840.10008.6.1.420
+  "Chest Finding or Feature\0" // 1.2.840.10008.6.1.421
+  "Chest Finding or Feature Modifier\0" // 1.2.840.10008.6.1.422
+  "Abnormal Lines Finding or Feature\0" // 1.2.840.10008.6.1.423
+  "Abnormal Opacity Finding or Feature\0" // 1.2.840.10008.6.1.424
+  "Abnormal Lucency Finding or Feature\0" // 1.2.840.10008.6.1.425
+  "Abnormal Texture Finding or Feature\0" // 1.2.840.10008.6.1.426
+  "Width Descriptor\0" // 1.2.840.10008.6.1.427
+  "Chest Anatomic Structure Abnormal Distribution\0" // 1.2.840.10008.6.1.428
+  "Radiographic Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.429
+  "Lung Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.430
+  "Bronchovascular Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.431
+  "Pleura Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.432
+  "Mediastinum Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.433
+  "Osseous Anatomy Finding or Feature\0" // 1.2.840.10008.6.1.434
+  "Osseous Anatomy Modifiers\0" // 1.2.840.10008.6.1.435
+  "Muscular Anatomy\0" // 1.2.840.10008.6.1.436
+  "Vascular Anatomy\0" // 1.2.840.10008.6.1.437
+  "Size Descriptor\0" // 1.2.840.10008.6.1.438
+  "Chest Border Shape\0" // 1.2.840.10008.6.1.439
+  "Chest Border Definition\0" // 1.2.840.10008.6.1.440
+  "Chest Orientation Descriptor\0" // 1.2.840.10008.6.1.441
+  "Chest Content Descriptor\0" // 1.2.840.10008.6.1.442
+  "Chest Opacity Descriptor\0" // 1.2.840.10008.6.1.443
+  "Location in Chest\0" // 1.2.840.10008.6.1.444
+  "General Chest Location\0" // 1.2.840.10008.6.1.445
+  "Location in Lung\0" // 1.2.840.10008.6.1.446
+  "Segment Location in Lung\0" // 1.2.840.10008.6.1.447
+  "Chest Distribution Descriptor\0" // 1.2.840.10008.6.1.448
+  "Chest Site Involvement\0" // 1.2.840.10008.6.1.449
+  "Severity Descriptor\0" // 1.2.840.10008.6.1.450
+  "Chest Texture Descriptor\0" // 1.2.840.10008.6.1.451
+  "Chest Calcification Descriptor\0" // 1.2.840.10008.6.1.452
+  "Chest Quantitative Temporal Difference Type\0" // 1.2.840.10008.6.1.453
+  "Chest Qualitative Temporal Difference Type\0" // 1.2.840.10008.6.1.454
+  "Image Quality Finding\0" // 1.2.840.10008.6.1.455
+  "Chest Types of Quality Control Standard\0" // 1.2.840.10008.6.1.456
+  "Types of CAD Analysis\0" // 1.2.840.10008.6.1.457
+  "Chest Non-lesion Object Type\0" // 1.2.840.10008.6.1.458
+  "Non-lesion Modifiers\0" // 1.2.840.10008.6.1.459
+  "Calculation Methods\0" // 1.2.840.10008.6.1.460
+  "Attenuation Coefficient Measurements\0" // 1.2.840.10008.6.1.461
+  "Calculated Value\0" // 1.2.840.10008.6.1.462
+  "Lesion Response\0" // 1.2.840.10008.6.1.463
+  "RECIST Defined Lesion Response\0" // 1.2.840.10008.6.1.464
+  "Baseline Category\0" // 1.2.840.10008.6.1.465
+  "Background Echotexture\0" // 1.2.840.10008.6.1.466
+  "Orientation\0" // 1.2.840.10008.6.1.467
+  "Lesion Boundary\0" // 1.2.840.10008.6.1.468
+  "Echo Pattern\0" // 1.2.840.10008.6.1.469
+  "Posterior Acoustic Features\0" // 1.2.840.10008.6.1.470
+  "Vascularity\0" // 1.2.840.10008.6.1.471
+  "Correlation to Other Findings\0" // 1.2.840.10008.6.1.472
+  "Malignancy Type\0" // 1.2.840.10008.6.1.473
+  "Breast Primary Tumor Assessment From AJCC\0" // 1.2.840.10008.6.1.474
+  "Clinical Regional Lymph Node Assessment for Breast\0" // 1.2.840.10008.6.1.475
+  "Assessment of Metastasis for Breast\0" // 1.2.840.10008.6.1.476
+  "Menstrual Cycle Phase\0" // 1.2.840.10008.6.1.477
+  "Time Intervals\0" // 1.2.840.10008.6.1.478
+  "Breast Linear Measurements\0" // 1.2.840.10008.6.1.479
+  "CAD Geometry Secondary Graphical Representation\0" // 1.2.840.10008.6.1.480
+  "Diagnostic Imaging Report Document Titles\0" // 1.2.840.10008.6.1.481
+  "Diagnostic Imaging Report Headings\0" // 1.2.840.10008.6.1.482
+  "Diagnostic Imaging Report Elements\0" // 1.2.840.10008.6.1.483
+  "Diagnostic Imaging Report Purposes of Reference\0" // 1.2.840.10008.6.1.484
+  "Waveform Purposes of Reference\0" // 1.2.840.10008.6.1.485
+  "Contributing Equipment Purposes of Reference\0" // 1.2.840.10008.6.1.486
+  "SR Document Purposes of Reference\0" // 1.2.840.10008.6.1.487
+  "Signature Purpose\0" // 1.2.840.10008.6.1.488
+  "Media Import\0" // 1.2.840.10008.6.1.489
+  "Key Object Selection Document Title\0" // 1.2.840.10008.6.1.490
+  "Rejected for Quality Reasons\0" // 1.2.840.10008.6.1.491
+  "Best in Set\0" // 1.2.840.10008.6.1.492
+  "Document Titles\0" // 1.2.840.10008.6.1.493
+  "RCS Registration Method Type\0" // 1.2.840.10008.6.1.494
+  "Brain Atlas Fiducials\0" // 1.2.840.10008.6.1.495
+  "Segmentation Property Categories\0" // 1.2.840.10008.6.1.496
+  "Segmentation Property Types\0" // 1.2.840.10008.6.1.497
+  "Cardiac Structure Segmentation Types\0" // 1.2.840.10008.6.1.498
+  "CNS Tissue Segmentation Types\0" // 1.2.840.10008.6.1.499
+  "Abdominal Organ Segmentation Types\0" // 1.2.840.10008.6.1.500
+  "Thoracic Tissue Segmentation Types\0" // 1.2.840.10008.6.1.501
+  "Vascular Tissue Segmentation Types\0" // 1.2.840.10008.6.1.502
+  "Device Segmentation Types\0" // 1.2.840.10008.6.1.503
+  "Artifact Segmentation Types\0" // 1.2.840.10008.6.1.504
+  "Lesion Segmentation Types\0" // 1.2.840.10008.6.1.505
+  "Pelvic Organ Segmentation Types\0" // 1.2.840.10008.6.1.506
+  "Physiology Segmentation Types\0" // 1.2.840.10008.6.1.507
+  "Referenced Image Purposes of Reference\0" // 1.2.840.10008.6.1.508
+  "Source Image Purposes of Reference\0" // 1.2.840.10008.6.1.509
+  "Image Derivation\0" // 1.2.840.10008.6.1.510
+  "Purpose of Reference to Alternate Representation\0" // 1.2.840.10008.6.1.511
+  "Related Series Purposes of Reference\0" // 1.2.840.10008.6.1.512
+  "Multi-Frame Subset Type\0" // 1.2.840.10008.6.1.513
+  "Person Roles\0" // 1.2.840.10008.6.1.514
+  "Family Member\0" // 1.2.840.10008.6.1.515
+  "Organizational Roles\0" // 1.2.840.10008.6.1.516
+  "Performing Roles\0" // 1.2.840.10008.6.1.517
+  "Animal Taxonomic Rank Values\0" // 1.2.840.10008.6.1.518
+  "Sex\0" // 1.2.840.10008.6.1.519
+  "Units of Measure for Age\0" // 1.2.840.10008.6.1.520
+  "Units of Linear Measurement\0" // 1.2.840.10008.6.1.521
+  "Units of Area Measurement\0" // 1.2.840.10008.6.1.522
+  "Units of Volume Measurement\0" // 1.2.840.10008.6.1.523
+  "Linear Measurements\0" // 1.2.840.10008.6.1.524
+  "Area Measurements\0" // 1.2.840.10008.6.1.525
+  "Volume Measurements\0" // 1.2.840.10008.6.1.526
+  "General Area Calculation Methods\0" // 1.2.840.10008.6.1.527
+  "General Volume Calculation Methods\0" // 1.2.840.10008.6.1.528
+  "Breed\0" // 1.2.840.10008.6.1.529
+  "Breed Registry\0" // 1.2.840.10008.6.1.530
+  "Workitem Definition\0" // 1.2.840.10008.6.1.531
+  "Non-DICOM Output Types\0" // 1.2.840.10008.6.1.532 (Retired)
+  "Procedure Discontinuation Reasons\0" // 1.2.840.10008.6.1.533
+  "Scope of Accumulation\0" // 1.2.840.10008.6.1.534
+  "UID Types\0" // 1.2.840.10008.6.1.535
+  "Irradiation Event Types\0" // 1.2.840.10008.6.1.536
+  "Equipment Plane Identification\0" // 1.2.840.10008.6.1.537
+  "Fluoro Modes\0" // 1.2.840.10008.6.1.538
+  "X-Ray Filter Materials\0" // 1.2.840.10008.6.1.539
+  "X-Ray Filter Types\0" // 1.2.840.10008.6.1.540
+  "Dose Related Distance Measurements\0" // 1.2.840.10008.6.1.541
+  "Measured/Calculated\0" // 1.2.840.10008.6.1.542
+  "Dose Measurement Devices\0" // 1.2.840.10008.6.1.543
+  "Effective Dose Evaluation Method\0" // 1.2.840.10008.6.1.544
+  "CT Acquisition Type\0" // 1.2.840.10008.6.1.545
+  "Contrast Imaging Technique\0" // 1.2.840.10008.6.1.546
+  "CT Dose Reference Authorities\0" // 1.2.840.10008.6.1.547
+  "Anode Target Material\0" // 1.2.840.10008.6.1.548
+  "X-Ray Grid\0" // 1.2.840.10008.6.1.549
+  "Ultrasound Protocol Types\0" // 1.2.840.10008.6.1.550
+  "Ultrasound Protocol Stage Types\0" // 1.2.840.10008.6.1.551
+  "OB-GYN Dates\0" // 1.2.840.10008.6.1.552
+  "Fetal Biometry Ratios\0" // 1.2.840.10008.6.1.553
+  "Fetal Biometry Measurements\0" // 1.2.840.10008.6.1.554
+  "Fetal Long Bones Biometry Measurements\0" // 1.2.840.10008.6.1.555
+  "Fetal Cranium\0" // 1.2.840.10008.6.1.556
+  "OB-GYN Amniotic Sac\0" // 1.2.840.10008.6.1.557
+  "Early Gestation Biometry Measurements\0" // 1.2.840.10008.6.1.558
+  "Ultrasound Pelvis and Uterus\0" // 1.2.840.10008.6.1.559
+  "OB Equations and Tables\0" // 1.2.840.10008.6.1.560
+  "Gestational Age Equations and Tables\0" // 1.2.840.10008.6.1.561
+  "OB Fetal Body Weight Equations and Tables\0" // 1.2.840.10008.6.1.562
+  "Fetal Growth Equations and Tables\0" // 1.2.840.10008.6.1.563
+  "Estimated Fetal Weight Percentile Equations and Tables\0" // 1.2.840.10008.6.1.564
+  "Growth Distribution Rank\0" // 1.2.840.10008.6.1.565
+  "OB-GYN Summary\0" // 1.2.840.10008.6.1.566
+  "OB-GYN Fetus Summary\0" // 1.2.840.10008.6.1.567
+  "Vascular Summary\0" // 1.2.840.10008.6.1.568
+  "Temporal Periods Relating to Procedure or Therapy\0" // 1.2.840.10008.6.1.569
+  "Vascular Ultrasound Anatomic Location\0" // 1.2.840.10008.6.1.570
+  "Extracranial Arteries\0" // 1.2.840.10008.6.1.571
+  "Intracranial Cerebral Vessels\0" // 1.2.840.10008.6.1.572
+  "Intracranial Cerebral Vessels (Unilateral)\0" // 1.2.840.10008.6.1.573
+  "Upper Extremity Arteries\0" // 1.2.840.10008.6.1.574
+  "Upper Extremity Veins\0" // 1.2.840.10008.6.1.575
+  "Lower Extremity Arteries\0" // 1.2.840.10008.6.1.576
+  "Lower Extremity Veins\0" // 1.2.840.10008.6.1.577
+  "Abdominal Arteries (Lateral)\0" // 1.2.840.10008.6.1.578
+  "Abdominal Arteries (Unilateral)\0" // 1.2.840.10008.6.1.579
+  "Abdominal Veins (Lateral)\0" // 1.2.840.10008.6.1.580
+  "Abdominal Veins (Unilateral)\0" // 1.2.840.10008.6.1.581
+  "Renal Vessels\0" // 1.2.840.10008.6.1.582
+  "Vessel Segment Modifiers\0" // 1.2.840.10008.6.1.583
+  "Vessel Branch Modifiers\0" // 1.2.840.10008.6.1.584
+  "Vascular Ultrasound Property\0" // 1.2.840.10008.6.1.585
+  "Blood Velocity Measurements by Ultrasound\0" // 1.2.840.10008.6.1.586
+  "Vascular Indices and Ratios\0" // 1.2.840.10008.6.1.587
+  "Other Vascular Properties\0" // 1.2.840.10008.6.1.588
+  "Carotid Ratios\0" // 1.2.840.10008.6.1.589
+  "Renal Ratios\0" // 1.2.840.10008.6.1.590
+  "Pelvic Vasculature Anatomical Location\0" // 1.2.840.10008.6.1.591
+  "Fetal Vasculature Anatomical Location\0" // 1.2.840.10008.6.1.592
+  "Echocardiography Left Ventricle\0" // 1.2.840.10008.6.1.593
+  "Left Ventricle Linear\0" // 1.2.840.10008.6.1.594
+  "Left Ventricle Volume\0" // 1.2.840.10008.6.1.595
+  "Left Ventricle Other\0" // 1.2.840.10008.6.1.596
+  "Echocardiography Right Ventricle\0" // 1.2.840.10008.6.1.597
+  "Echocardiography Left Atrium\0" // 1.2.840.10008.6.1.598
+  "Echocardiography Right Atrium\0" // 1.2.840.10008.6.1.599
+  "Echocardiography Mitral Valve\0" // 1.2.840.10008.6.1.600
+  "Echocardiography Tricuspid Valve\0" // 1.2.840.10008.6.1.601
+  "Echocardiography Pulmonic Valve\0" // 1.2.840.10008.6.1.602
+  "Echocardiography Pulmonary Artery\0" // 1.2.840.10008.6.1.603
+  "Echocardiography Aortic Valve\0" // 1.2.840.10008.6.1.604
+  "Echocardiography Aorta\0" // 1.2.840.10008.6.1.605
+  "Echocardiography Pulmonary Veins\0" // 1.2.840.10008.6.1.606
+  "Echocardiography Vena Cavae\0" // 1.2.840.10008.6.1.607
+  "Echocardiography Hepatic Veins\0" // 1.2.840.10008.6.1.608
+  "Echocardiography Cardiac Shunt\0" // 1.2.840.10008.6.1.609
+  "Echocardiography Congenital\0" // 1.2.840.10008.6.1.610
+  "Pulmonary Vein Modifiers\0" // 1.2.840.10008.6.1.611
+  "Echocardiography Common Measurements\0" // 1.2.840.10008.6.1.612
+  "Flow Direction\0" // 1.2.840.10008.6.1.613
+  "Orifice Flow Properties\0" // 1.2.840.10008.6.1.614
+  "Echocardiography Stroke Volume Origin\0" // 1.2.840.10008.6.1.615
+  "Ultrasound Image Modes\0" // 1.2.840.10008.6.1.616
+  "Echocardiography Image View\0" // 1.2.840.10008.6.1.617
+  "Echocardiography Measurement Method\0" // 1.2.840.10008.6.1.618
+  "Echocardiography Volume Methods\0" // 1.2.840.10008.6.1.619
+  "Echocardiography Area Methods\0" // 1.2.840.10008.6.1.620
+  "Gradient Methods\0" // 1.2.840.10008.6.1.621
+  "Volume Flow Methods\0" // 1.2.840.10008.6.1.622
+  "Myocardium Mass Methods\0" // 1.2.840.10008.6.1.623
+  "Cardiac Phase\0" // 1.2.840.10008.6.1.624
+  "Respiration State\0" // 1.2.840.10008.6.1.625
+  "Mitral Valve Anatomic Sites\0" // 1.2.840.10008.6.1.626
+  "Echo Anatomic Sites\0" // 1.2.840.10008.6.1.627
+  "Echocardiography Anatomic Site Modifiers\0" // 1.2.840.10008.6.1.628
+  "Wall Motion Scoring Schemes\0" // 1.2.840.10008.6.1.629
+  "Cardiac Output Properties\0" // 1.2.840.10008.6.1.630
+  "Left Ventricle Area\0" // 1.2.840.10008.6.1.631
+  "Tricuspid Valve Finding Sites\0" // 1.2.840.10008.6.1.632
+  "Aortic Valve Finding Sites\0" // 1.2.840.10008.6.1.633
+  "Left Ventricle Finding Sites\0" // 1.2.840.10008.6.1.634
+  "Congenital Finding Sites\0" // 1.2.840.10008.6.1.635
+  "Surface Processing Algorithm Families\0" // 1.2.840.10008.6.1.636
+  "Stress Test Procedure Phases\0" // 1.2.840.10008.6.1.637
+  "Stages\0" // 1.2.840.10008.6.1.638
+  "S-M-L Size Descriptor\0" // 1.2.840.10008.6.1.735
+  "Major Coronary Arteries\0" // 1.2.840.10008.6.1.736
+  "Units of Radioactivity\0" // 1.2.840.10008.6.1.737
+  "Rest-Stress\0" // 1.2.840.10008.6.1.738
+  "PET Cardiology Protocols\0" // 1.2.840.10008.6.1.739
+  "PET Cardiology Radiopharmaceuticals\0" // 1.2.840.10008.6.1.740
+  "NM/PET Procedures\0" // 1.2.840.10008.6.1.741
+  "Nuclear Cardiology Protocols\0" // 1.2.840.10008.6.1.742
+  "Nuclear Cardiology Radiopharmaceuticals\0" // 1.2.840.10008.6.1.743
+  "Attenuation Correction\0" // 1.2.840.10008.6.1.744
+  "Types of Perfusion Defects\0" // 1.2.840.10008.6.1.745
+  "Study Quality\0" // 1.2.840.10008.6.1.746
+  "Stress Imaging Quality Issues\0" // 1.2.840.10008.6.1.747
+  "NM Extracardiac Findings\0" // 1.2.840.10008.6.1.748
+  "Attenuation Correction Methods\0" // 1.2.840.10008.6.1.749
+  "Level of Risk\0" // 1.2.840.10008.6.1.750
+  "LV Function\0" // 1.2.840.10008.6.1.751
+  "Perfusion Findings\0" // 1.2.840.10008.6.1.752
+  "Perfusion Morphology\0" // 1.2.840.10008.6.1.753
+  "Ventricular Enlargement\0" // 1.2.840.10008.6.1.754
+  "Stress Test Procedure\0" // 1.2.840.10008.6.1.755
+  "Indications for Stress Test\0" // 1.2.840.10008.6.1.756
+  "Chest Pain\0" // 1.2.840.10008.6.1.757
+  "Exerciser Device\0" // 1.2.840.10008.6.1.758
+  "Stress Agents\0" // 1.2.840.10008.6.1.759
+  "Indications for Pharmacological Stress Test\0" // 1.2.840.10008.6.1.760
+  "Non-invasive Cardiac Imaging Procedures\0" // 1.2.840.10008.6.1.761
+  "Summary Codes Exercise ECG\0" // 1.2.840.10008.6.1.763
+  "Summary Codes Stress Imaging\0" // 1.2.840.10008.6.1.764
+  "Speed of Response\0" // 1.2.840.10008.6.1.765
+  "BP Response\0" // 1.2.840.10008.6.1.766
+  "Treadmill Speed\0" // 1.2.840.10008.6.1.767
+  "Stress Hemodynamic Findings\0" // 1.2.840.10008.6.1.768
+  "Perfusion Finding Method\0" // 1.2.840.10008.6.1.769
+  "Comparison Finding\0" // 1.2.840.10008.6.1.770
+  "Stress Symptoms\0" // 1.2.840.10008.6.1.771
+  "Stress Test Termination Reasons\0" // 1.2.840.10008.6.1.772
+  "QTc Measurements\0" // 1.2.840.10008.6.1.773
+  "ECG Timing Measurements\0" // 1.2.840.10008.6.1.774
+  "ECG Axis Measurements\0" // 1.2.840.10008.6.1.775
+  "ECG Findings\0" // 1.2.840.10008.6.1.776
+  "ST Segment Findings\0" // 1.2.840.10008.6.1.777
+  "ST Segment Location\0" // 1.2.840.10008.6.1.778
+  "ST Segment Morphology\0" // 1.2.840.10008.6.1.779
+  "Ectopic Beat Morphology\0" // 1.2.840.10008.6.1.780
+  "Perfusion Comparison Findings\0" // 1.2.840.10008.6.1.781
+  "Tolerance Comparison Findings\0" // 1.2.840.10008.6.1.782
+  "Wall Motion Comparison Findings\0" // 1.2.840.10008.6.1.783
+  "Stress Scoring Scales\0" // 1.2.840.10008.6.1.784
+  "Perceived Exertion Scales\0" // 1.2.840.10008.6.1.785
+  "Ventricle Identification\0" // 1.2.840.10008.6.1.786
+  "Colon Overall Assessment\0" // 1.2.840.10008.6.1.787
+  "Colon Finding or Feature\0" // 1.2.840.10008.6.1.788
+  "Colon Finding or Feature Modifier\0" // 1.2.840.10008.6.1.789
+  "Colon Non-lesion Object Type\0" // 1.2.840.10008.6.1.790
+  "Anatomic Non-colon Findings\0" // 1.2.840.10008.6.1.791
+  "Clockface Location for Colon\0" // 1.2.840.10008.6.1.792
+  "Recumbent Patient Orientation for Colon\0" // 1.2.840.10008.6.1.793
+  "Colon Quantitative Temporal Difference Type\0" // 1.2.840.10008.6.1.794
+  "Colon Types of Quality Control Standard\0" // 1.2.840.10008.6.1.795
+  "Colon Morphology Descriptor\0" // 1.2.840.10008.6.1.796
+  "Location in Intestinal Tract\0" // 1.2.840.10008.6.1.797
+  "Colon CAD Material Description\0" // 1.2.840.10008.6.1.798
+  "Calculated Value for Colon Findings\0" // 1.2.840.10008.6.1.799
+  "Ophthalmic Horizontal Directions\0" // 1.2.840.10008.6.1.800
+  "Ophthalmic Vertical Directions\0" // 1.2.840.10008.6.1.801
+  "Ophthalmic Visual Acuity Type\0" // 1.2.840.10008.6.1.802
+  "Arterial Pulse Waveform\0" // 1.2.840.10008.6.1.803
+  "Respiration Waveform\0" // 1.2.840.10008.6.1.804
+  "Ultrasound Contrast/Bolus Agents\0" // 1.2.840.10008.6.1.805
+  "Protocol Interval Events\0" // 1.2.840.10008.6.1.806
+  "Transducer Scan Pattern\0" // 1.2.840.10008.6.1.807
+  "Ultrasound Transducer Geometry\0" // 1.2.840.10008.6.1.808
+  "Ultrasound Transducer Beam Steering\0" // 1.2.840.10008.6.1.809
+  "Ultrasound Transducer Application\0" // 1.2.840.10008.6.1.810
+  "Instance Availability Status\0" // 1.2.840.10008.6.1.811
+  "Modality PPS Discontinuation Reasons\0" // 1.2.840.10008.6.1.812
+  "Media Import PPS Discontinuation Reasons\0" // 1.2.840.10008.6.1.813
+  "DX Anatomy Imaged for Animals\0" // 1.2.840.10008.6.1.814
+  "Common Anatomic Regions for Animals\0" // 1.2.840.10008.6.1.815
+  "DX View for Animals\0" // 1.2.840.10008.6.1.816
+  "Institutional Departments, Units and Services\0" // 1.2.840.10008.6.1.817
+  "Purpose of Reference to Predecessor Report\0" // 1.2.840.10008.6.1.818
+  "Visual Fixation Quality During Acquisition\0" // 1.2.840.10008.6.1.819
+  "Visual Fixation Quality Problem\0" // 1.2.840.10008.6.1.820
+  "Ophthalmic Macular Grid Problem\0" // 1.2.840.10008.6.1.821
+  "Organizations\0" // 1.2.840.10008.6.1.822
+  "Mixed Breeds\0" // 1.2.840.10008.6.1.823
+  "Broselow-Luten Pediatric Size Categories\0" // 1.2.840.10008.6.1.824
+  "Calcium Scoring Patient Size Categories\0" // 1.2.840.10008.6.1.825
+  "Cardiac Ultrasound Report Titles\0" // 1.2.840.10008.6.1.826
+  "Cardiac Ultrasound Indication for Study\0" // 1.2.840.10008.6.1.827
+  "Pediatric, Fetal and Congenital Cardiac Surgical Interventions\0" // 1.2.840.10008.6.1.828
+  "Cardiac Ultrasound Summary Codes\0" // 1.2.840.10008.6.1.829
+  "Cardiac Ultrasound Fetal Summary Codes\0" // 1.2.840.10008.6.1.830
+  "Cardiac Ultrasound Common Linear Measurements\0" // 1.2.840.10008.6.1.831
+  "Cardiac Ultrasound Linear Valve Measurements\0" // 1.2.840.10008.6.1.832
+  "Cardiac Ultrasound Cardiac Function\0" // 1.2.840.10008.6.1.833
+  "Cardiac Ultrasound Area Measurements\0" // 1.2.840.10008.6.1.834
+  "Cardiac Ultrasound Hemodynamic Measurements\0" // 1.2.840.10008.6.1.835
+  "Cardiac Ultrasound Myocardium Measurements\0" // 1.2.840.10008.6.1.836
+  "1.2.840.10008.6.1.838\0" // 1.2.840.10008.6.1.837
+  "Cardiac Ultrasound Right Ventricle\0" // 1.2.840.10008.6.1.839
+  "Cardiac Ultrasound Ventricles Measurements\0" // 1.2.840.10008.6.1.840
+  "Cardiac Ultrasound Pulmonary Artery\0" // 1.2.840.10008.6.1.841
+  "Cardiac Ultrasound Pulmonary Vein\0" // 1.2.840.10008.6.1.842
+  "Cardiac Ultrasound Pulmonary Valve\0" // 1.2.840.10008.6.1.843
+  "Cardiac Ultrasound Venous Return Pulmonary Measurements\0" // 1.2.840.10008.6.1.844
+  "Cardiac Ultrasound Venous Return Systemic Measurements\0" // 1.2.840.10008.6.1.845
+  "Cardiac Ultrasound Atria and Atrial Septum Measurements\0" // 1.2.840.10008.6.1.846
+  "Cardiac Ultrasound Mitral Valve\0" // 1.2.840.10008.6.1.847
+  "Cardiac Ultrasound Tricuspid Valve\0" // 1.2.840.10008.6.1.848
+  "Cardiac Ultrasound Atrioventricular Valves Measurements\0" // 1.2.840.10008.6.1.849
+  "Cardiac Ultrasound Interventricular Septum Measurements\0" // 1.2.840.10008.6.1.850
+  "Cardiac Ultrasound Aortic Valve\0" // 1.2.840.10008.6.1.851
+  "Cardiac Ultrasound Outflow Tracts Measurements\0" // 1.2.840.10008.6.1.852
+  "Cardiac Ultrasound Semilunar Valves, Annulate and Sinuses Measurements\0" // 1.2.840.10008.6.1.853
+  "Cardiac Ultrasound Aortic Sinotubular Junction\0" // 1.2.840.10008.6.1.854
+  "Cardiac Ultrasound Aorta Measurements\0" // 1.2.840.10008.6.1.855
+  "Cardiac Ultrasound Coronary Arteries Measurements\0" // 1.2.840.10008.6.1.856
+  "Cardiac Ultrasound Aorto Pulmonary Connections Measurements\0" // 1.2.840.10008.6.1.857
+  "Cardiac Ultrasound Pericardium and Pleura Measurements\0" // 1.2.840.10008.6.1.858
+  "Cardiac Ultrasound Fetal General Measurements\0" // 1.2.840.10008.6.1.859
+  "Cardiac Ultrasound Target Sites\0" // 1.2.840.10008.6.1.860
+  "Cardiac Ultrasound Target Site Modifiers\0" // 1.2.840.10008.6.1.861
+  "Cardiac Ultrasound Venous Return Systemic Finding Sites\0" // 1.2.840.10008.6.1.862
+  "Cardiac Ultrasound Venous Return Pulmonary Finding Sites\0" // 1.2.840.10008.6.1.863
+  "Cardiac Ultrasound Atria and Atrial Septum Finding Sites\0" // 1.2.840.10008.6.1.864
+  "Cardiac Ultrasound Atrioventricular Valves Finding Sites\0" // 1.2.840.10008.6.1.865
+  "Cardiac Ultrasound Interventricular Septum Finding Sites\0" // 1.2.840.10008.6.1.866
+  "Cardiac Ultrasound Ventricles Finding Sites\0" // 1.2.840.10008.6.1.867
+  "Cardiac Ultrasound Outflow Tracts Finding Sites\0" // 1.2.840.10008.6.1.868
+  "Cardiac Ultrasound Semilunar Valves, Annulus and Sinuses Finding Sites\0" // 1.2.840.10008.6.1.869
+  "Cardiac Ultrasound Pulmonary Arteries Finding Sites\0" // 1.2.840.10008.6.1.870
+  "Cardiac Ultrasound Aorta Finding Sites\0" // 1.2.840.10008.6.1.871
+  "Cardiac Ultrasound Coronary Arteries Finding Sites\0" // 1.2.840.10008.6.1.872
+  "Cardiac Ultrasound Aortopulmonary Connections Finding Sites\0" // 1.2.840.10008.6.1.873
+  "Cardiac Ultrasound Pericardium and Pleura Finding Sites\0" // 1.2.840.10008.6.1.874
+  "Ophthalmic Ultrasound Axial Measurements Type\0" // 1.2.840.10008.6.1.876
+  "Lens Status\0" // 1.2.840.10008.6.1.877
+  "Vitreous Status\0" // 1.2.840.10008.6.1.878
+  "Ophthalmic Axial Length Measurements Segment Names\0" // 1.2.840.10008.6.1.879
+  "Refractive Surgery Types\0" // 1.2.840.10008.6.1.880
+  "Keratometry Descriptors\0" // 1.2.840.10008.6.1.881
+  "IOL Calculation Formula\0" // 1.2.840.10008.6.1.882
+  "Lens Constant Type\0" // 1.2.840.10008.6.1.883
+  "Refractive Error Types\0" // 1.2.840.10008.6.1.884
+  "Anterior Chamber Depth Definition\0" // 1.2.840.10008.6.1.885
+  "Ophthalmic Measurement or Calculation Data Source\0" // 1.2.840.10008.6.1.886
+  "Ophthalmic Axial Length Selection Method\0" // 1.2.840.10008.6.1.887
+  "Ophthalmic Quality Metric Type\0" // 1.2.840.10008.6.1.889
+  "Ophthalmic Agent Concentration Units\0" // 1.2.840.10008.6.1.890
+  "Functional Condition Present During Acquisition\0" // 1.2.840.10008.6.1.891
+  "Joint Position During Acquisition\0" // 1.2.840.10008.6.1.892
+  "Joint Positioning Method\0" // 1.2.840.10008.6.1.893
+  "Physical Force Applied During Acquisition\0" // 1.2.840.10008.6.1.894
+  "ECG Control Variables Numeric\0" // 1.2.840.10008.6.1.895
+  "ECG Control Variables Text\0" // 1.2.840.10008.6.1.896
+  "WSI Referenced Image Purposes of Reference\0" // 1.2.840.10008.6.1.897
+  "Microscopy Lens Type\0" // 1.2.840.10008.6.1.898
+  "Microscopy Illuminator and Sensor Color\0" // 1.2.840.10008.6.1.899
+  "Microscopy Illumination Method\0" // 1.2.840.10008.6.1.900
+  "Microscopy Filter\0" // 1.2.840.10008.6.1.901
+  "Microscopy Illuminator Type\0" // 1.2.840.10008.6.1.902
+  "Audit Event ID\0" // 1.2.840.10008.6.1.903
+  "Audit Event Type Code\0" // 1.2.840.10008.6.1.904
+  "Audit Active Participant Role ID Code\0" // 1.2.840.10008.6.1.905
+  "Security Alert Type Code\0" // 1.2.840.10008.6.1.906
+  "Audit Participant Object ID Type Code\0" // 1.2.840.10008.6.1.907
+  "Media Type Code\0" // 1.2.840.10008.6.1.908
+  "Visual Field Static Perimetry Test Patterns\0" // 1.2.840.10008.6.1.909
+  "Visual Field Static Perimetry Test Strategies\0" // 1.2.840.10008.6.1.910
+  "Visual Field Static Perimetry Screening Test Modes\0" // 1.2.840.10008.6.1.911
+  "Visual Field Static Perimetry Fixation Strategy\0" // 1.2.840.10008.6.1.912
+  "Visual Field Static Perimetry Test Analysis Results\0" // 1.2.840.10008.6.1.913
+  "Visual Field Illumination Color\0" // 1.2.840.10008.6.1.914
+  "Visual Field Procedure Modifier\0" // 1.2.840.10008.6.1.915
+  "Visual Field Global Index Name\0" // 1.2.840.10008.6.1.916
+  "Abstract Multi-dimensional Image Model Component Semantics\0" // 1.2.840.10008.6.1.917
+  "Abstract Multi-dimensional Image Model Component Units\0" // 1.2.840.10008.6.1.918
+  "Abstract Multi-dimensional Image Model Dimension Semantics\0" // 1.2.840.10008.6.1.919
+  "Abstract Multi-dimensional Image Model Dimension Units\0" // 1.2.840.10008.6.1.920
+  "Abstract Multi-dimensional Image Model Axis Direction\0" // 1.2.840.10008.6.1.921
+  "Abstract Multi-dimensional Image Model Axis Orientation\0" // 1.2.840.10008.6.1.922
+  "Abstract Multi-dimensional Image Model Qualitative Dimension Sample Semantics\0" // 1.2.840.10008.6.1.923
+  "Planning Methods\0" // 1.2.840.10008.6.1.924
+  "De-identification Method\0" // 1.2.840.10008.6.1.925
+  "Measurement Orientation\0" // 1.2.840.10008.6.1.926
+  "ECG Global Waveform Durations\0" // 1.2.840.10008.6.1.927
+  "ICDs\0" // 1.2.840.10008.6.1.930
+  "Radiotherapy General Workitem Definition\0" // 1.2.840.10008.6.1.931
+  "Radiotherapy Acquisition Workitem Definition\0" // 1.2.840.10008.6.1.932
+  "Radiotherapy Registration Workitem Definition\0" // 1.2.840.10008.6.1.933
+  "Intravascular OCT Flush Agent\0" // 1.2.840.10008.6.1.934
+  "Label Types\0" // 1.2.840.10008.6.1.935
+  "Ophthalmic Mapping Units for Real World Value Mapping\0" // 1.2.840.10008.6.1.936
+  "Ophthalmic Mapping Acquisition Method\0" // 1.2.840.10008.6.1.937
+  "Retinal Thickness Definition\0" // 1.2.840.10008.6.1.938
+  "Ophthalmic Thickness Map Value Type\0" // 1.2.840.10008.6.1.939
+  "Ophthalmic Map Purposes of Reference\0" // 1.2.840.10008.6.1.940
+  "Ophthalmic Thickness Deviation Categories\0" // 1.2.840.10008.6.1.941
+  "Ophthalmic Anatomic Structure Reference Point\0" // 1.2.840.10008.6.1.942
+  "Cardiac Synchronization Technique\0" // 1.2.840.10008.6.1.943
+  "Staining Protocols\0" // 1.2.840.10008.6.1.944
+  "Size Specific Dose Estimation Method for CT\0" // 1.2.840.10008.6.1.947
+  "Pathology Imaging Protocols\0" // 1.2.840.10008.6.1.948
+  "Magnification Selection\0" // 1.2.840.10008.6.1.949
+  "Tissue Selection\0" // 1.2.840.10008.6.1.950
+  "General Region of Interest Measurement Modifiers\0" // 1.2.840.10008.6.1.951
+  "Measurements Derived From Multiple ROI Measurements\0" // 1.2.840.10008.6.1.952
+  "Surface Scan Acquisition Types\0" // 1.2.840.10008.6.1.953
+  "Surface Scan Mode Types\0" // 1.2.840.10008.6.1.954
+  "Surface Scan Registration Method Types\0" // 1.2.840.10008.6.1.956
+  "Basic Cardiac Views\0" // 1.2.840.10008.6.1.957
+  "CT Reconstruction Algorithm\0" // 1.2.840.10008.6.1.958
+  "Detector Types\0" // 1.2.840.10008.6.1.959
+  "CR/DR Mechanical Configuration\0" // 1.2.840.10008.6.1.960
+  "Projection X-Ray Acquisition Device Types\0" // 1.2.840.10008.6.1.961
+  "Abstract Segmentation Types\0" // 1.2.840.10008.6.1.962
+  "Common Tissue Segmentation Types\0" // 1.2.840.10008.6.1.963
+  "Peripheral Nervous System Segmentation Types\0" // 1.2.840.10008.6.1.964
+  "Corneal Topography Mapping Units for Real World Value Mapping\0" // 1.2.840.10008.6.1.965
+  "Corneal Topography Map Value Type\0" // 1.2.840.10008.6.1.966
+  "Brain Structures for Volumetric Measurements\0" // 1.2.840.10008.6.1.967
+  "RT Dose Derivation\0" // 1.2.840.10008.6.1.968
+  "RT Dose Purpose of Reference\0" // 1.2.840.10008.6.1.969
+  "Spectroscopy Purpose of Reference\0" // 1.2.840.10008.6.1.970
+  "Scheduled Processing Parameter Concept Codes for RT Treatment\0" // 1.2.840.10008.6.1.971
+  "Radiopharmaceutical Organ Dose Reference Authority\0" // 1.2.840.10008.6.1.972
+  "Source of Radioisotope Activity Information\0" // 1.2.840.10008.6.1.973
+  "Intravenous Extravasation Symptoms\0" // 1.2.840.10008.6.1.975
+  "Radiosensitive Organs\0" // 1.2.840.10008.6.1.976
+  "Radiopharmaceutical Patient State\0" // 1.2.840.10008.6.1.977
+  "GFR Measurements\0" // 1.2.840.10008.6.1.978
+  "GFR Measurement Methods\0" // 1.2.840.10008.6.1.979
+  "Visual Evaluation Methods\0" // 1.2.840.10008.6.1.980
+  "Test Pattern Codes\0" // 1.2.840.10008.6.1.981
+  "Measurement Pattern Codes\0" // 1.2.840.10008.6.1.982
+  "Display Device Type\0" // 1.2.840.10008.6.1.983
+  "SUV Units\0" // 1.2.840.10008.6.1.984
+  "T1 Measurement Methods\0" // 1.2.840.10008.6.1.985
+  "Tracer Kinetic Models\0" // 1.2.840.10008.6.1.986
+  "Perfusion Measurement Methods\0" // 1.2.840.10008.6.1.987
+  "Arterial Input Function Measurement Methods\0" // 1.2.840.10008.6.1.988
+  "Bolus Arrival Time Derivation Methods\0" // 1.2.840.10008.6.1.989
+  "Perfusion Analysis Methods\0" // 1.2.840.10008.6.1.990
+  "Quantitative Methods used for Perfusion And Tracer Kinetic Models\0" // 1.2.840.10008.6.1.991
+  "Tracer Kinetic Model Parameters\0" // 1.2.840.10008.6.1.992
+  "Perfusion Model Parameters\0" // 1.2.840.10008.6.1.993
+  "Model-Independent Dynamic Contrast Analysis Parameters\0" // 1.2.840.10008.6.1.994
+  "Tracer Kinetic Modeling Covariates\0" // 1.2.840.10008.6.1.995
+  "Contrast Characteristics\0" // 1.2.840.10008.6.1.996
+  "Measurement Report Document Titles\0" // 1.2.840.10008.6.1.997
+  "Quantitative Diagnostic Imaging Procedures\0" // 1.2.840.10008.6.1.998
+  "PET Region of Interest Measurements\0" // 1.2.840.10008.6.1.999
+  "Grey Level Co-occurrence Matrix Measurements\0" // 1.2.840.10008.6.1.1000
+  "Texture Measurements\0" // 1.2.840.10008.6.1.1001
+  "Time Point Types\0" // 1.2.840.10008.6.1.1002
+  "Generic Intensity and Size Measurements\0" // 1.2.840.10008.6.1.1003
+  "Response Criteria\0" // 1.2.840.10008.6.1.1004
+  "Fetal Biometry Anatomic Sites\0" // 1.2.840.10008.6.1.1005
+  "Fetal Long Bone Anatomic Sites\0" // 1.2.840.10008.6.1.1006
+  "Fetal Cranium Anatomic Sites\0" // 1.2.840.10008.6.1.1007
+  "Pelvis and Uterus Anatomic Sites\0" // 1.2.840.10008.6.1.1008
+  "Parametric Map Derivation Image Purpose of Reference\0" // 1.2.840.10008.6.1.1009
+  "Physical Quantity Descriptors\0" // 1.2.840.10008.6.1.1010
+  "Lymph Node Anatomic Sites\0" // 1.2.840.10008.6.1.1011
+  "Head and Neck Cancer Anatomic Sites\0" // 1.2.840.10008.6.1.1012
+  "Fiber Tracts In Brainstem\0" // 1.2.840.10008.6.1.1013
+  "Projection and Thalamic Fibers\0" // 1.2.840.10008.6.1.1014
+  "Association Fibers\0" // 1.2.840.10008.6.1.1015
+  "Limbic System Tracts\0" // 1.2.840.10008.6.1.1016
+  "Commissural Fibers\0" // 1.2.840.10008.6.1.1017
+  "Cranial Nerves\0" // 1.2.840.10008.6.1.1018
+  "Spinal Cord Fibers\0" // 1.2.840.10008.6.1.1019
+  "Tractography Anatomic Sites\0" // 1.2.840.10008.6.1.1020
+  "Primary Anatomic Structure for Intra-oral Radiography\0" // 1.2.840.10008.6.1.1021
+  "Primary Anatomic Structure for Intra-oral and Craniofacial Radiography\0" // 1.2.840.10008.6.1.1022
+  "IEC61217 Device Position Parameters\0" // 1.2.840.10008.6.1.1023
+  "IEC61217 Gantry Position Parameters\0" // 1.2.840.10008.6.1.1024
+  "IEC61217 Patient Support Position Parameters\0" // 1.2.840.10008.6.1.1025
+  "Actionable Finding Classification\0" // 1.2.840.10008.6.1.1026
+  "Image Quality Assessment\0" // 1.2.840.10008.6.1.1027
+  "Summary Radiation Exposure Quantities\0" // 1.2.840.10008.6.1.1028
+  "Wide Field Ophthalmic Photography Transformation Method\0" // 1.2.840.10008.6.1.1029
+  "PET Units\0" // 1.2.840.10008.6.1.1030
+  "Implant Materials\0" // 1.2.840.10008.6.1.1031
+  "Intervention Types\0" // 1.2.840.10008.6.1.1032
+  "Implant Templates View Orientations\0" // 1.2.840.10008.6.1.1033
+  "Implant Templates Modified View Orientations\0" // 1.2.840.10008.6.1.1034
+  "Implant Target Anatomy\0" // 1.2.840.10008.6.1.1035
+  "Implant Planning Landmarks\0" // 1.2.840.10008.6.1.1036
+  "Human Hip Implant Planning Landmarks\0" // 1.2.840.10008.6.1.1037
+  "Implant Component Types\0" // 1.2.840.10008.6.1.1038
+  "Human Hip Implant Component Types\0" // 1.2.840.10008.6.1.1039
+  "Human Trauma Implant Component Types\0" // 1.2.840.10008.6.1.1040
+  "Implant Fixation Method\0" // 1.2.840.10008.6.1.1041
+  "Device Participating Roles\0" // 1.2.840.10008.6.1.1042
+  "Container Types\0" // 1.2.840.10008.6.1.1043
+  "Container Component Types\0" // 1.2.840.10008.6.1.1044
+  "Anatomic Pathology Specimen Types\0" // 1.2.840.10008.6.1.1045
+  "Breast Tissue Specimen Types\0" // 1.2.840.10008.6.1.1046
+  "Specimen Collection Procedure\0" // 1.2.840.10008.6.1.1047
+  "Specimen Sampling Procedure\0" // 1.2.840.10008.6.1.1048
+  "Specimen Preparation Procedure\0" // 1.2.840.10008.6.1.1049
+  "Specimen Stains\0" // 1.2.840.10008.6.1.1050
+  "Specimen Preparation Steps\0" // 1.2.840.10008.6.1.1051
+  "Specimen Fixatives\0" // 1.2.840.10008.6.1.1052
+  "Specimen Embedding Media\0" // 1.2.840.10008.6.1.1053
+  "Source of Projection X-Ray Dose Information\0" // 1.2.840.10008.6.1.1054
+  "Source of CT Dose Information\0" // 1.2.840.10008.6.1.1055
+  "Radiation Dose Reference Points\0" // 1.2.840.10008.6.1.1056
+  "Volumetric View Description\0" // 1.2.840.10008.6.1.1057
+  "Volumetric View Modifier\0" // 1.2.840.10008.6.1.1058
+  "Diffusion Acquisition Value Types\0" // 1.2.840.10008.6.1.1059
+  "Diffusion Model Value Types\0" // 1.2.840.10008.6.1.1060
+  "Diffusion Tractography Algorithm Families\0" // 1.2.840.10008.6.1.1061
+  "Diffusion Tractography Measurement Types\0" // 1.2.840.10008.6.1.1062
+  "Research Animal Source Registries\0" // 1.2.840.10008.6.1.1063
+  "Yes-No Only\0" // 1.2.840.10008.6.1.1064
+  "Biosafety Levels\0" // 1.2.840.10008.6.1.1065
+  "Biosafety Control Reasons\0" // 1.2.840.10008.6.1.1066
+  "Sex - Male Female or Both\0" // 1.2.840.10008.6.1.1067
+  "Animal Room Types\0" // 1.2.840.10008.6.1.1068
+  "Device Reuse\0" // 1.2.840.10008.6.1.1069
+  "Animal Bedding Material\0" // 1.2.840.10008.6.1.1070
+  "Animal Shelter Types\0" // 1.2.840.10008.6.1.1071
+  "Animal Feed Types\0" // 1.2.840.10008.6.1.1072
+  "Animal Feed Sources\0" // 1.2.840.10008.6.1.1073
+  "Animal Feeding Methods\0" // 1.2.840.10008.6.1.1074
+  "Water Types\0" // 1.2.840.10008.6.1.1075
+  "Anesthesia Category Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1076
+  "Anesthesia Category Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1077
+  "Anesthesia Induction Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1078
+  "Anesthesia Induction Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1079
+  "Anesthesia Maintenance Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1080
+  "Anesthesia Maintenance Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1081
+  "Airway Management Method Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1082
+  "Airway Management Method Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1083
+  "Airway Management Sub-Method Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1084
+  "Airway Management Sub-Method Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1085
+  "Medication Type Code Type for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1086
+  "Medication Type Code Type from Anesthesia Quality Initiative (AQI)\0" // 1.2.840.10008.6.1.1087
+  "Medication for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1088
+  "Inhalational Anesthesia Agents for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1089
+  "Injectable Anesthesia Agents for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1090
+  "Premedication Agents for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1091
+  "Neuromuscular Blocking Agents for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1092
+  "Ancillary Medications for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1093
+  "Carrier Gases for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1094
+  "Local Anesthetics for Small Animal Anesthesia\0" // 1.2.840.10008.6.1.1095
+  "Phase of Procedure Requiring Anesthesia\0" // 1.2.840.10008.6.1.1096
+  "Phase of Surgical Procedure Requiring Anesthesia\0" // 1.2.840.10008.6.1.1097
+  "Phase of Imaging Procedure Requiring Anesthesia\0" // 1.2.840.10008.6.1.1098
+  "Phase of Animal Handling\0" // 1.2.840.10008.6.1.1099
+  "Heating Method\0" // 1.2.840.10008.6.1.1100
+  "Temperature Sensor Device Component Type for Small Animal Procedures\0" // 1.2.840.10008.6.1.1101
+  "Exogenous Substance Types\0" // 1.2.840.10008.6.1.1102
+  "Exogenous Substance\0" // 1.2.840.10008.6.1.1103
+  "Tumor Graft Histologic Type\0" // 1.2.840.10008.6.1.1104
+  "Fibrils\0" // 1.2.840.10008.6.1.1105
+  "Viruses\0" // 1.2.840.10008.6.1.1106
+  "Cytokines\0" // 1.2.840.10008.6.1.1107
+  "Toxins\0" // 1.2.840.10008.6.1.1108
+  "Exogenous Substance Administration Sites\0" // 1.2.840.10008.6.1.1109
+  "Exogenous Substance Tissue of Origin\0" // 1.2.840.10008.6.1.1110
+  "Preclinical Small Animal Imaging Procedures\0" // 1.2.840.10008.6.1.1111
+  "Position Reference Indicator for Frame of Reference\0" // 1.2.840.10008.6.1.1112
+  "Present-Absent Only\0" // 1.2.840.10008.6.1.1113
+  "Water Equivalent Diameter Method\0" // 1.2.840.10008.6.1.1114
+  "Radiotherapy Purposes of Reference\0" // 1.2.840.10008.6.1.1115
+  "Content Assessment Types\0" // 1.2.840.10008.6.1.1116
+  "RT Content Assessment Types\0" // 1.2.840.10008.6.1.1117
+  "Basis of Assessment\0" // 1.2.840.10008.6.1.1118
+  "Reader Specialty\0" // 1.2.840.10008.6.1.1119
+  "Requested Report Types\0" // 1.2.840.10008.6.1.1120
+  "Native DICOM Model\0" // 1.2.840.10008.7.1.1
+  "Abstract Multi-Dimensional Image Model\0" // 1.2.840.10008.7.1.2
+  "DICOM Content Mapping Resource\0" // 1.2.840.10008.8.1.1
+  "Imaging Report\0" // 1.2.840.10008.9.1
+  "Clinical Information\0" // 1.2.840.10008.9.2
+  "Imaging Procedure Description\0" // 1.2.840.10008.9.3
+  "Comparison Study\0" // 1.2.840.10008.9.4
+  "Impression\0" // 1.2.840.10008.9.5
+  "Addendum\0" // 1.2.840.10008.9.6
+  "Request\0" // 1.2.840.10008.9.7
+  "Radiation Exposure and Protection Information\0" // 1.2.840.10008.9.8
+  "Fetus Findings\0" // 1.2.840.10008.9.9
+  "Labeled Subsection\0" // 1.2.840.10008.9.10
+  "Communication of Actionable Findings\0" // 1.2.840.10008.9.11
+  "Recommendation\0" // 1.2.840.10008.9.12
+  "Procedural Medication\0" // 1.2.840.10008.9.13
+  "Procedure Technique\0" // 1.2.840.10008.9.14
+  "Image Quality\0" // 1.2.840.10008.9.15
+  "Study Act\0" // 1.2.840.10008.9.16
+  "Series Act\0" // 1.2.840.10008.9.17
+  "SOP Instance Observation\0" // 1.2.840.10008.9.18
+  "Section Text\0" // 1.2.840.10008.9.19
+  "General Header\0" // 1.2.840.10008.9.20
+  "Imaging Header\0" // 1.2.840.10008.9.21
+  "Parent Document\0" // 1.2.840.10008.9.22
+  "General Section Entries\0" // 1.2.840.10008.9.23
+  "Imaging Addendum Report\0" // 1.2.840.10008.9.24
+  "dicomDeviceName\0" // 1.2.840.10008.15.0.3.1
+  "dicomDescription\0" // 1.2.840.10008.15.0.3.2
+  "dicomManufacturer\0" // 1.2.840.10008.15.0.3.3
+  "dicomManufacturerModelName\0" // 1.2.840.10008.15.0.3.4
+  "dicomSoftwareVersion\0" // 1.2.840.10008.15.0.3.5
+  "dicomVendorData\0" // 1.2.840.10008.15.0.3.6
+  "dicomAETitle\0" // 1.2.840.10008.15.0.3.7
+  "dicomNetworkConnectionReference\0" // 1.2.840.10008.15.0.3.8
+  "dicomApplicationCluster\0" // 1.2.840.10008.15.0.3.9
+  "dicomAssociationInitiator\0" // 1.2.840.10008.15.0.3.10
+  "dicomAssociationAcceptor\0" // 1.2.840.10008.15.0.3.11
+  "dicomHostname\0" // 1.2.840.10008.15.0.3.12
+  "dicomPort\0" // 1.2.840.10008.15.0.3.13
+  "dicomSOPClass\0" // 1.2.840.10008.15.0.3.14
+  "dicomTransferRole\0" // 1.2.840.10008.15.0.3.15
+  "dicomTransferSyntax\0" // 1.2.840.10008.15.0.3.16
+  "dicomPrimaryDeviceType\0" // 1.2.840.10008.15.0.3.17
+  "dicomRelatedDeviceReference\0" // 1.2.840.10008.15.0.3.18
+  "dicomPreferredCalledAETitle\0" // 1.2.840.10008.15.0.3.19
+  "dicomTLSCyphersuite\0" // 1.2.840.10008.15.0.3.20
+  "dicomAuthorizedNodeCertificateReference\0" // 1.2.840.10008.15.0.3.21
+  "dicomThisNodeCertificateReference\0" // 1.2.840.10008.15.0.3.22
+  "dicomInstalled\0" // 1.2.840.10008.15.0.3.23
+  "dicomStationName\0" // 1.2.840.10008.15.0.3.24
+  "dicomDeviceSerialNumber\0" // 1.2.840.10008.15.0.3.25
+  "dicomInstitutionName\0" // 1.2.840.10008.15.0.3.26
+  "dicomInstitutionAddress\0" // 1.2.840.10008.15.0.3.27
+  "dicomInstitutionDepartmentName\0" // 1.2.840.10008.15.0.3.28
+  "dicomIssuerOfPatientID\0" // 1.2.840.10008.15.0.3.29
+  "dicomPreferredCallingAETitle\0" // 1.2.840.10008.15.0.3.30
+  "dicomSupportedCharacterSet\0" // 1.2.840.10008.15.0.3.31
+  "dicomConfigurationRoot\0" // 1.2.840.10008.15.0.4.1
+  "dicomDevicesRoot\0" // 1.2.840.10008.15.0.4.2
+  "dicomUniqueAETitlesRegistryRoot\0" // 1.2.840.10008.15.0.4.3
+  "dicomDevice\0" // 1.2.840.10008.15.0.4.4
+  "dicomNetworkAE\0" // 1.2.840.10008.15.0.4.5
+  "dicomNetworkConnection\0" // 1.2.840.10008.15.0.4.6
+  "dicomUniqueAETitle\0" // 1.2.840.10008.15.0.4.7
+  "dicomTransferCapability\0" // 1.2.840.10008.15.0.4.8
+  "Universal Coordinated Time\0" // 1.2.840.10008.15.1.1
+  ;
+
 const UIDTableEntry *GetUIDTableEntry(const char *uid)
 {
   if (uid == 0)
@@ -3921,9 +3924,9 @@ const char *vtkDICOMUtilities::GetUIDName(const char *uid)
   const UIDTableEntry *table = GetUIDTableEntry(uid);
   if (table)
     {
-    if (table->Name)
+    if (table->Name != 0)
       {
-      result = table->Name;
+      result = &UIDNameTable[table->Name];
       }
     }
   return result;
@@ -18,11 +18,19 @@
 
 #include <vtkMath.h>
 #include <vtkTypeTraits.h>
+#include <vtkSimpleCriticalSection.h>
+#include <vtkDataArray.h>
+#include <vtkStringArray.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+
+#include <map>
 
 #include <math.h>
 #include <float.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <string.h>
 #include <assert.h>
 
 #include <new>
@@ -59,15 +67,12 @@ void StringConversion(
 {
   if (vr == vtkDICOMVR::IS || vr == vtkDICOMVR::DS)
     {
+    // use strchr to jump between delimiters, rather than advancing
+    // byte-by-byte (the C library scans words or vectors at a time)
     for (size_t j = 0; j < i && *cp != '\0'; j++)
       {
-      bool bk = false;
-      do
-        {
-        bk = (*cp == '\\');
-        cp++;
-        }
-      while (!bk && *cp != '\0');
+      const char *dp = strchr(cp, '\\');
+      cp = (dp != 0 ? dp + 1 : cp + strlen(cp));
       }
 
     for (size_t k = 0; k < n && *cp != '\0'; k++)
@@ -80,13 +85,8 @@ void StringConversion(
         {
         *v++ = static_cast<OT>(strtol(cp, NULL, 10));
         }
-      bool bk = false;
-      do
-        {
-        bk = (*cp == '\\');
-        cp++;
-        }
-      while (!bk && *cp != '\0');
+      const char *dp = strchr(cp, '\\');
+      cp = (dp != 0 ? dp + 1 : cp + strlen(cp));
       }
     }
   else if (n > 0)
@@ -405,7 +405,14 @@ void vtkDICOMValue::ComputeNumberOfValuesForCharData()
       size_t vl = this->V->VL;
       if (this->V->CharacterSet == 0)
         {
-        do { n += (*ptr++ == '\\'); } while (--vl);
+        // count with memchr, which scans words or vectors at a time
+        const char *ep = ptr + vl;
+        while ((ptr = static_cast<const char *>(
+                  memchr(ptr, '\\', ep - ptr))) != 0)
+          {
+          n++;
+          ptr++;
+          }
         }
       else
         {
@@ -448,6 +455,88 @@ unsigned char *vtkDICOMValue::ReallocateUnsignedCharData(size_t vn)
   return ptr;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMValue::MarkSequenceAsFixedSize()
+{
+  // only safe for a newly built sequence with no other references,
+  // any excess capacity left by AppendValue simply stays unused
+  if (this->V && this->V->Type == VTK_DICOM_ITEM &&
+      this->V->ReferenceCount == 1)
+    {
+    this->V->VL = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Called when an array created by AsDataArray is deleted, in order to
+// release the reference that kept the shared memory alive.
+static void vtkDICOMValueArrayDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  delete static_cast<vtkDICOMValue *>(clientData);
+}
+
+//----------------------------------------------------------------------------
+vtkDataArray *vtkDICOMValue::AsDataArray(int numberOfComponents) const
+{
+  if (this->V == 0 || numberOfComponents < 1)
+    {
+    return 0;
+    }
+
+  // get a pointer to the data (the offset of the Data member depends
+  // on its type, so every type needs its own cast)
+  void *data = 0;
+  int type = this->V->Type;
+  switch (type)
+    {
+    case VTK_UNSIGNED_CHAR:
+      data = static_cast<ValueT<unsigned char> *>(this->V)->Data;
+      break;
+    case VTK_SHORT:
+      data = static_cast<ValueT<short> *>(this->V)->Data;
+      break;
+    case VTK_UNSIGNED_SHORT:
+      data = static_cast<ValueT<unsigned short> *>(this->V)->Data;
+      break;
+    case VTK_INT:
+      data = static_cast<ValueT<int> *>(this->V)->Data;
+      break;
+    case VTK_UNSIGNED_INT:
+      data = static_cast<ValueT<unsigned int> *>(this->V)->Data;
+      break;
+    case VTK_FLOAT:
+      data = static_cast<ValueT<float> *>(this->V)->Data;
+      break;
+    case VTK_DOUBLE:
+      data = static_cast<ValueT<double> *>(this->V)->Data;
+      break;
+    }
+
+  size_t n = this->GetNumberOfValues();
+  if (data == 0 || n == 0 ||
+      n % static_cast<size_t>(numberOfComponents) != 0)
+    {
+    return 0;
+    }
+
+  vtkDataArray *array = vtkDataArray::CreateDataArray(type);
+  array->SetNumberOfComponents(numberOfComponents);
+
+  // point the array at the internal allocation, the "save" flag stops
+  // the array from attempting to free memory that it does not own
+  array->SetVoidArray(data, static_cast<vtkIdType>(n), 1);
+
+  // hold a reference to this value until the array is deleted
+  vtkCallbackCommand *observer = vtkCallbackCommand::New();
+  observer->SetCallback(vtkDICOMValueArrayDeleted);
+  observer->SetClientData(new vtkDICOMValue(*this));
+  array->AddObserver(vtkCommand::DeleteEvent, observer);
+  observer->Delete();
+
+  return array;
+}
+
 //----------------------------------------------------------------------------
 template<class T>
 void vtkDICOMValue::CreateValue(vtkDICOMVR vr, const T *data, size_t n)
@@ -470,38 +559,132 @@ void vtkDICOMValue::CreateValue(vtkDICOMVR vr, const T *data, size_t n)
     vr = (vt == VTK_UNSIGNED_SHORT ? VR::US : VR::SS);
     }
 
-  // use VR to set data type, then convert input to that type
-  if (vr == VR::FD)
-    {
-    double *ptr = this->AllocateDoubleData(vr, n);
-    NumericalConversion(data, ptr, n);
-    }
-  else if (vr == VR::FL)
+  // use VR to set data type, then convert input to that type:
+  // dispatch on the storage type, which vtkDICOMVR provides via a
+  // table lookup, so only the VRs that share a storage type have
+  // to be distinguished from each other within each case
+  switch (vr.GetType())
     {
-    float *ptr = this->AllocateFloatData(vr, n);
-    NumericalConversion(data, ptr, n);
-    }
-  else if (vr == VR::UL)
-    {
-    unsigned int *ptr = this->AllocateUnsignedIntData(vr, n);
-    NumericalConversion(data, ptr, n);
-    }
-  else if (vr == VR::SL)
-    {
-    int *ptr = this->AllocateIntData(vr, n);
-    NumericalConversion(data, ptr, n);
-    }
-  else if (vr == VR::US)
-    {
-    unsigned short *ptr = this->AllocateUnsignedShortData(vr, n);
-    NumericalConversion(data, ptr, n);
-    }
-  else if (vr == VR::SS)
-    {
-    short *ptr = this->AllocateShortData(vr, n);
-    NumericalConversion(data, ptr, n);
+    case VTK_DOUBLE:
+      if (vr == VR::FD)
+        {
+        double *ptr = this->AllocateDoubleData(vr, n);
+        NumericalConversion(data, ptr, n);
+        }
+      else // OD
+        {
+        double *ptr = this->AllocateDoubleData(vr, n*sizeof(T)/8);
+        memcpy(ptr, data, n*sizeof(T));
+        }
+      break;
+    case VTK_FLOAT:
+      if (vr == VR::FL)
+        {
+        float *ptr = this->AllocateFloatData(vr, n);
+        NumericalConversion(data, ptr, n);
+        }
+      else // OF
+        {
+        float *ptr = this->AllocateFloatData(vr, n*sizeof(T)/4);
+        memcpy(ptr, data, n*sizeof(T));
+        }
+      break;
+    case VTK_UNSIGNED_INT:
+      if (vr == VR::UL)
+        {
+        unsigned int *ptr = this->AllocateUnsignedIntData(vr, n);
+        NumericalConversion(data, ptr, n);
+        }
+      else if (vt == VTK_INT) // OL
+        {
+        int *ptr = this->AllocateIntData(vr, n);
+        memcpy(ptr, data, n*4);
+        }
+      else // OL
+        {
+        unsigned int *ptr = this->AllocateUnsignedIntData(vr, n*sizeof(T)/4);
+        memcpy(ptr, data, n*sizeof(T));
+        }
+      break;
+    case VTK_INT:
+      {
+      int *ptr = this->AllocateIntData(vr, n);
+      NumericalConversion(data, ptr, n);
+      }
+      break;
+    case VTK_UNSIGNED_SHORT:
+      if (vr == VR::US)
+        {
+        unsigned short *ptr = this->AllocateUnsignedShortData(vr, n);
+        NumericalConversion(data, ptr, n);
+        }
+      else if (vt == VTK_SHORT) // OW
+        {
+        short *ptr = this->AllocateShortData(vr, n);
+        memcpy(ptr, data, n*2);
+        }
+      else // OW
+        {
+        unsigned short *ptr =
+          this->AllocateUnsignedShortData(vr, n*sizeof(T)/2);
+        memcpy(ptr, data, n*sizeof(T));
+        }
+      break;
+    case VTK_SHORT:
+      {
+      short *ptr = this->AllocateShortData(vr, n);
+      NumericalConversion(data, ptr, n);
+      }
+      break;
+    case VTK_UNSIGNED_CHAR:
+      {
+      size_t m = n*sizeof(T);
+      int pad = (m & 1);
+      unsigned char *ptr = this->AllocateUnsignedCharData(vr, m + pad);
+      memcpy(ptr, data, m);
+      if (pad) { ptr[m] = 0; } // pad to even
+      this->V->NumberOfValues = static_cast<unsigned int>(m);
+      }
+      break;
+    case VTK_DICOM_TAG:
+      if (sizeof(T) > 2)
+        {
+        // subsequent values represent 32-bit keys
+        vtkDICOMTag *ptr = this->AllocateTagData(vr, n);
+        for (size_t i = 0; i < n; i++)
+          {
+          unsigned int k = static_cast<unsigned int>(data[i]);
+          unsigned short g = static_cast<unsigned short>(k >> 16);
+          unsigned short e = static_cast<unsigned short>(k);
+          ptr[i] = vtkDICOMTag(g,e);
+          }
+        }
+      else
+        {
+        // subsequent values represent group,element pairs
+        vtkDICOMTag *ptr = this->AllocateTagData(vr, n/2);
+        for (size_t i = 0; i < n; i += 2)
+          {
+          unsigned short g = static_cast<unsigned short>(data[i]);
+          unsigned short e = static_cast<unsigned short>(data[i+1]);
+          ptr[i/2] = vtkDICOMTag(g,e);
+          }
+        }
+      break;
+    case VTK_CHAR:
+      this->CreateValueFromNumbers(vr, data, n);
+      break;
     }
-  else if (vr == VR::DS)
+}
+
+//----------------------------------------------------------------------------
+template<class T>
+void vtkDICOMValue::CreateValueFromNumbers(
+  vtkDICOMVR vr, const T *data, size_t n)
+{
+  typedef vtkDICOMVR VR; // shorthand
+
+  if (vr == VR::DS)
     {
     char *cp = this->AllocateCharData(vr, 17*n);
     char *dp = cp;
@@ -565,77 +748,6 @@ void vtkDICOMValue::CreateValue(vtkDICOMVR vr, const T *data, size_t n)
       }
     *cp = '\0';
     }
-  else if (vr == VR::OB || vr == VR::UN)
-    {
-    size_t m = n*sizeof(T);
-    int pad = (m & 1);
-    unsigned char *ptr = this->AllocateUnsignedCharData(vr, m + pad);
-    memcpy(ptr, data, m);
-    if (pad) { ptr[m] = 0; } // pad to even
-    this->V->NumberOfValues = static_cast<unsigned int>(m);
-    }
-  else if (vr == VR::OW)
-    {
-    if (vt == VTK_SHORT)
-      {
-      short *ptr = this->AllocateShortData(vr, n);
-      memcpy(ptr, data, n*2);
-      }
-    else
-      {
-      unsigned short *ptr = this->AllocateUnsignedShortData(vr, n*sizeof(T)/2);
-      memcpy(ptr, data, n*sizeof(T));
-      }
-    }
-  else if (vr == VR::OL)
-    {
-    if (vt == VTK_INT)
-      {
-      int *ptr = this->AllocateIntData(vr, n);
-      memcpy(ptr, data, n*4);
-      }
-    else
-      {
-      unsigned int *ptr = this->AllocateUnsignedIntData(vr, n*sizeof(T)/4);
-      memcpy(ptr, data, n*sizeof(T));
-      }
-    }
-  else if (vr == VR::OF)
-    {
-    float *ptr = this->AllocateFloatData(vr, n*sizeof(T)/4);
-    memcpy(ptr, data, n*sizeof(T));
-    }
-  else if (vr == VR::OD)
-    {
-    double *ptr = this->AllocateDoubleData(vr, n*sizeof(T)/8);
-    memcpy(ptr, data, n*sizeof(T));
-    }
-  else if (vr == VR::AT)
-    {
-    if (sizeof(T) > 2)
-      {
-      // subsequent values represent 32-bit keys
-      vtkDICOMTag *ptr = this->AllocateTagData(vr, n);
-      for (size_t i = 0; i < n; i++)
-        {
-        unsigned int k = static_cast<unsigned int>(data[i]);
-        unsigned short g = static_cast<unsigned short>(k >> 16);
-        unsigned short e = static_cast<unsigned short>(k);
-        ptr[i] = vtkDICOMTag(g,e);
-        }
-      }
-    else
-      {
-      // subsequent values represent group,element pairs
-      vtkDICOMTag *ptr = this->AllocateTagData(vr, n/2);
-      for (size_t i = 0; i < n; i += 2)
-        {
-        unsigned short g = static_cast<unsigned short>(data[i]);
-        unsigned short e = static_cast<unsigned short>(data[i+1]);
-        ptr[i/2] = vtkDICOMTag(g,e);
-        }
-      }
-    }
 }
 
 template<>
@@ -908,6 +1020,77 @@ vtkDICOMValue::vtkDICOMValue(
   this->CreateValueWithSpecificCharacterSet(vr, cs, v.data(), v.size());
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// The global table that holds the interned values, with a lock to make
+// it safe for use from multiple threads.  The table is bounded so that
+// pathological data cannot cause it to grow without limit.
+struct InternTableType
+{
+  vtkSimpleCriticalSection Lock;
+  std::map<std::string, vtkDICOMValue> Table;
+};
+
+InternTableType InternTable;
+
+const size_t MaxInternLength = 24;
+const size_t MaxInternTableSize = 4096;
+
+} // end anonymous namespace
+
+vtkDICOMValue vtkDICOMValue::Intern(
+  vtkDICOMVR vr, vtkDICOMCharacterSet cs, const char *data, size_t l)
+{
+  vtkDICOMValue v;
+
+  if (l <= MaxInternLength)
+    {
+    // the key is the VR, the character set, and the raw data
+    std::string key;
+    key.reserve(l + 3);
+    key.append(vr.GetText(), 2);
+    key.push_back(static_cast<char>(cs.GetKey()));
+    key.append(data, l);
+
+    InternTable.Lock.Lock();
+    std::map<std::string, vtkDICOMValue>::iterator iter =
+      InternTable.Table.find(key);
+    if (iter != InternTable.Table.end())
+      {
+      v = iter->second;
+      }
+    InternTable.Lock.Unlock();
+    if (v.IsValid())
+      {
+      return v;
+      }
+
+    // create the value exactly as the parser would, with the padding
+    // kept and the number of values computed from the backslashes
+    char *ptr = v.AllocateCharData(vr, cs, l);
+    memcpy(ptr, data, l);
+    if (l == 0 || ptr[l-1] != '\0') { ptr[l] = '\0'; }
+    v.ComputeNumberOfValuesForCharData();
+
+    InternTable.Lock.Lock();
+    if (InternTable.Table.size() < MaxInternTableSize)
+      {
+      InternTable.Table.insert(std::make_pair(key, v));
+      }
+    InternTable.Lock.Unlock();
+    }
+  else
+    {
+    char *ptr = v.AllocateCharData(vr, cs, l);
+    memcpy(ptr, data, l);
+    if (ptr[l-1] != '\0') { ptr[l] = '\0'; }
+    v.ComputeNumberOfValuesForCharData();
+    }
+
+  return v;
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMValue::vtkDICOMValue(vtkDICOMVR vr)
 {
@@ -1019,8 +1202,11 @@ void vtkDICOMValue::AppendValue(const T &item)
 
   size_t n = this->V->NumberOfValues;
   size_t nn = 0;
+  // if the reference is unique, the elements can be moved rather
+  // than copied when the array is reallocated
+  bool unique = (this->V->ReferenceCount == 1);
   // reallocate if not unique reference, or not yet growable
-  if (this->V->ReferenceCount != 1 || this->V->VL != 0xffffffff)
+  if (!unique || this->V->VL != 0xffffffff)
     {
     // get next power of two that is greater than n
     nn = 1;
@@ -1036,12 +1222,21 @@ void vtkDICOMValue::AppendValue(const T &item)
     {
     vtkDICOMValue::Value *v = this->V;
     ++(v->ReferenceCount);
-    const T *cptr = ptr;
+    T *cptr = ptr;
     ptr = this->Allocate<T>(v->VR, nn);
     this->V->NumberOfValues = static_cast<unsigned int>(n);
     for (size_t i = 0; i < n; i++)
       {
-      ptr[i] = cptr[i];
+      if (unique)
+        {
+        // the old array is about to be freed, so transfer its elements
+        // without going through the atomic reference counts
+        ptr[i].Swap(cptr[i]);
+        }
+      else
+        {
+        ptr[i] = cptr[i];
+        }
       }
     if (--(v->ReferenceCount) == 0)
       {
@@ -1238,7 +1433,30 @@ vtkDICOMValue *vtkDICOMValue::GetMultiplex()
   vtkDICOMValue *ptr = 0;
   if (this->V && this->V->Type == VTK_DICOM_VALUE)
     {
-    ptr = static_cast<ValueT<vtkDICOMValue> *>(this->V)->Data;
+    if (this->V->ReferenceCount != 1)
+      {
+      // copy-on-write: the multiplex is shared with another data set,
+      // so replace it with a private copy before it can be modified
+      // (the contained values are referenced, not copied)
+      size_t n = this->V->NumberOfValues;
+      Value *v = this->V;
+      ++(v->ReferenceCount);
+      const vtkDICOMValue *cptr =
+        static_cast<const ValueT<vtkDICOMValue> *>(v)->Data;
+      ptr = this->AllocateMultiplexData(v->VR, n);
+      for (size_t i = 0; i < n; i++)
+        {
+        ptr[i] = cptr[i];
+        }
+      if (--(v->ReferenceCount) == 0)
+        {
+        vtkDICOMValue::FreeValue(v);
+        }
+      }
+    else
+      {
+      ptr = static_cast<ValueT<vtkDICOMValue> *>(this->V)->Data;
+      }
     }
   return ptr;
 }
@@ -1378,6 +1596,69 @@ void vtkDICOMValue::GetValues(vtkDICOMTag *v, size_t c, size_t s) const
   this->GetValuesT(v, c, s);
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMValue::GetValues(vtkDataArray *a) const
+{
+  size_t n = this->GetNumberOfValues();
+  a->SetNumberOfComponents(1);
+  a->SetNumberOfTuples(static_cast<vtkIdType>(n));
+
+  bool r = true;
+  if (n == 0)
+    {
+    return r;
+    }
+
+  void *vp = a->GetVoidPointer(0);
+  switch (a->GetDataType())
+    {
+    case VTK_SIGNED_CHAR:
+    case VTK_UNSIGNED_CHAR:
+      this->GetValues(static_cast<unsigned char *>(vp), n);
+      break;
+    case VTK_SHORT:
+      this->GetValues(static_cast<short *>(vp), n);
+      break;
+    case VTK_UNSIGNED_SHORT:
+      this->GetValues(static_cast<unsigned short *>(vp), n);
+      break;
+    case VTK_INT:
+      this->GetValues(static_cast<int *>(vp), n);
+      break;
+    case VTK_UNSIGNED_INT:
+      this->GetValues(static_cast<unsigned int *>(vp), n);
+      break;
+    case VTK_FLOAT:
+      this->GetValues(static_cast<float *>(vp), n);
+      break;
+    case VTK_DOUBLE:
+      this->GetValues(static_cast<double *>(vp), n);
+      break;
+    default:
+      for (size_t i = 0; i < n; i++)
+        {
+        a->SetComponent(static_cast<vtkIdType>(i), 0, 0.0);
+        }
+      r = false;
+      break;
+    }
+
+  return r;
+}
+
+bool vtkDICOMValue::GetValues(vtkStringArray *a) const
+{
+  size_t n = this->GetNumberOfValues();
+  a->SetNumberOfValues(static_cast<vtkIdType>(n));
+  for (size_t i = 0; i < n; i++)
+    {
+    std::string s;
+    this->AppendValueToUTF8String(s, i);
+    a->SetValue(static_cast<vtkIdType>(i), s);
+    }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 unsigned char vtkDICOMValue::GetUnsignedChar(size_t i) const
 {
@@ -1698,7 +1979,8 @@ void vtkDICOMValue::Substring(
       do
         {
         cp = dp + 1;
-        do { dp++; } while (*dp != '\\' && dp != ep);
+        dp = static_cast<const char *>(memchr(cp, '\\', ep - cp));
+        if (dp == 0) { dp = ep; }
         }
       while (--i != 0 && dp != ep);
       }
@@ -2684,6 +2966,116 @@ bool vtkDICOMValue::operator==(const vtkDICOMValue& o) const
   return r;
 }
 
+//----------------------------------------------------------------------------
+// accumulate bytes into a 64-bit FNV-1a hash
+static unsigned long long vtkDICOMValueHashBytes(
+  unsigned long long h, const void *data, size_t n)
+{
+  const unsigned char *cp = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < n; i++)
+    {
+    h = (h ^ cp[i])*1099511628211ULL;
+    }
+  return h;
+}
+
+unsigned long long vtkDICOMValue::Hash() const
+{
+  // 64-bit FNV-1a, starting from the FNV offset basis
+  unsigned long long h = 14695981039346656037ULL;
+  const vtkDICOMValue::Value *a = this->V;
+
+  if (a == 0)
+    {
+    return h;
+    }
+
+  // the same fields that decide equality go into the hash
+  h = vtkDICOMValueHashBytes(h, a->VR.GetText(), 2);
+  h = vtkDICOMValueHashBytes(h, &a->VL, sizeof(a->VL));
+
+  switch (a->Type)
+    {
+    case VTK_CHAR:
+      h = vtkDICOMValueHashBytes(h, &a->CharacterSet, 1);
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<char> *>(a)->Data, a->VL);
+      break;
+    case VTK_UNSIGNED_CHAR:
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<unsigned char> *>(a)->Data, a->VL);
+      break;
+    case VTK_SHORT:
+    case VTK_UNSIGNED_SHORT:
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<short> *>(a)->Data,
+        a->NumberOfValues*sizeof(short));
+      break;
+    case VTK_INT:
+    case VTK_UNSIGNED_INT:
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<int> *>(a)->Data,
+        a->NumberOfValues*sizeof(int));
+      break;
+    case VTK_FLOAT:
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<float> *>(a)->Data,
+        a->NumberOfValues*sizeof(float));
+      break;
+    case VTK_DOUBLE:
+      h = vtkDICOMValueHashBytes(
+        h, static_cast<const ValueT<double> *>(a)->Data,
+        a->NumberOfValues*sizeof(double));
+      break;
+    case VTK_DICOM_TAG:
+      {
+      const vtkDICOMTag *tags =
+        static_cast<const ValueT<vtkDICOMTag> *>(a)->Data;
+      for (unsigned int i = 0; i < a->NumberOfValues; i++)
+        {
+        unsigned short g[2];
+        g[0] = tags[i].GetGroup();
+        g[1] = tags[i].GetElement();
+        h = vtkDICOMValueHashBytes(h, g, sizeof(g));
+        }
+      }
+      break;
+    case VTK_DICOM_ITEM:
+      {
+      const vtkDICOMItem *items =
+        static_cast<const ValueT<vtkDICOMItem> *>(a)->Data;
+      for (unsigned int i = 0; i < a->NumberOfValues; i++)
+        {
+        vtkDICOMDataElementIterator iter = items[i].Begin();
+        vtkDICOMDataElementIterator iterEnd = items[i].End();
+        for (; iter != iterEnd; ++iter)
+          {
+          unsigned short g[2];
+          g[0] = iter->GetTag().GetGroup();
+          g[1] = iter->GetTag().GetElement();
+          h = vtkDICOMValueHashBytes(h, g, sizeof(g));
+          unsigned long long e = iter->GetValue().Hash();
+          h = vtkDICOMValueHashBytes(h, &e, sizeof(e));
+          }
+        }
+      }
+      break;
+    case VTK_DICOM_VALUE:
+      {
+      const vtkDICOMValue *values =
+        static_cast<const ValueT<vtkDICOMValue> *>(a)->Data;
+      for (unsigned int i = 0; i < a->NumberOfValues; i++)
+        {
+        unsigned long long e = values[i].Hash();
+        h = vtkDICOMValueHashBytes(h, &e, sizeof(e));
+        }
+      }
+      break;
+    }
+
+  return h;
+}
+
 //----------------------------------------------------------------------------
 ostream& operator<<(ostream& os, const vtkDICOMValue& v)
 {
@@ -36,6 +36,8 @@
 #define VTK_DICOM_USE_OVERFLOW_BYTE
 #endif
 
+class vtkDataArray;
+class vtkStringArray;
 class vtkDICOMItem;
 class vtkDICOMSequence;
 
@@ -120,6 +122,21 @@ public:
                 const char *data, size_t l);
   //@}
 
+  //@{
+  //! Get a shared copy of a short text value (static method).
+  /*!
+   *  Certain values recur endlessly in DICOM data sets: the modality
+   *  codes, the SOP class UIDs, the character set codes, and so on.
+   *  This method draws such values from a global table, so that every
+   *  occurrence shares a single allocation.  Values longer than 24
+   *  bytes are never shared, they are constructed in the usual manner.
+   *  The data is stored exactly as given, including any padding, just
+   *  as if it had been read from a file.  This method is thread-safe.
+   */
+  static vtkDICOMValue Intern(vtkDICOMVR vr, vtkDICOMCharacterSet cs,
+                              const char *data, size_t l);
+  //@}
+
   //@{
   //! Create an emtpy value.
   explicit vtkDICOMValue(vtkDICOMVR vr);
@@ -157,6 +174,17 @@ public:
   bool IsValid() const { return (this->V != 0); }
   //@}
 
+  //@{
+  //! Exchange the contents of this value with another value.
+  /*!
+   *  Unlike assignment, this is a constant-time operation that does
+   *  not modify the reference counts.  Use it to transfer a value into
+   *  a container when the original is no longer needed.
+   */
+  void Swap(vtkDICOMValue& o) {
+    Value *t = this->V; this->V = o.V; o.V = t; }
+  //@}
+
   //@{
   //! Get the VR, the representation of the data values.
   vtkDICOMVR GetVR() const { return (this->V ? this->V->VR : vtkDICOMVR()); }
@@ -216,6 +244,24 @@ public:
   void GetValues(vtkDICOMTag *vb, size_t n, size_t i=0) const;
   //@}
 
+  //@{
+  //! Copy all of the values into a VTK array in a single call.
+  /*!
+   *  The array is resized to the number of values, and the values are
+   *  converted to the type of the array, which must be one of the
+   *  common numeric array types (signed or unsigned char, short, or
+   *  int, or float or double).  The string variant converts each
+   *  value to utf-8 text instead.  A caller working through the VTK
+   *  wrappers can use these to pull a whole multi-valued attribute
+   *  across the language boundary at once, rather than fetching the
+   *  values one index at a time.  The return value is false if the
+   *  array type is unsupported, in which case the array is resized
+   *  but left zero-filled.
+   */
+  bool GetValues(vtkDataArray *a) const;
+  bool GetValues(vtkStringArray *a) const;
+  //@}
+
   //@{
   //! Get one scalar, string, tag or item from the value.
   /*!
@@ -288,6 +334,23 @@ public:
   const vtkDICOMValue *GetMultiplexData() const;
   //@}
 
+  //@{
+  //! Get the value's data as a vtkDataArray, without copying.
+  /*!
+   *  The returned array points directly at the internal allocation of
+   *  this value, and it holds a reference that keeps the allocation
+   *  alive for as long as the array exists, so the data is shared
+   *  rather than copied.  For pixel data, this allows the value to be
+   *  handed to a vtkImageData with no copy of the voxels.  The array
+   *  must not be resized, since that would cause it to reallocate and
+   *  abandon the shared memory.  The caller must delete the returned
+   *  array.  This is only possible for values that store their data
+   *  as a binary array (e.g. OB, OW, OF, OD, UN, and the binary
+   *  numerical VRs), a null pointer is returned for all other values.
+   */
+  vtkDataArray *AsDataArray(int numberOfComponents=1) const;
+  //@}
+
   //@{
   //! Allocate space within a value object.
   /*!
@@ -329,6 +392,16 @@ public:
    *  the NumberOfValues will be vn, and the VL will be 0xffffffff.
    */
   unsigned char *ReallocateUnsignedCharData(size_t vn);
+
+  //! Mark a sequence as fixed-size rather than delimited.
+  /*!
+   *  A sequence that is built by appending items one at a time is
+   *  marked as delimited, i.e. its VL is the special value 0xffffffff.
+   *  The parser calls this method when the sequence had an explicit
+   *  length in the file, so that it is written back out the same way.
+   *  It does nothing if the value is shared or is not a sequence.
+   */
+  void MarkSequenceAsFixedSize();
   //@}
 
   //@{
@@ -403,6 +476,19 @@ public:
   bool operator!=(const vtkDICOMValue& o) const { return !(*this == o); }
   //@}
 
+  //! Compute a 64-bit hash over the raw bytes of the value.
+  /*!
+   *  The hash covers the VR, the length, and the stored bytes of the
+   *  value, and recurses into sequence items and per-instance values.
+   *  Two values with different hashes are certainly unequal, and two
+   *  values with equal hashes are almost certainly equal, so a stored
+   *  digest can stand in for the value itself when checking whether
+   *  data has changed.  The raw bytes are hashed in the byte order of
+   *  the host, so digests should only be compared to other digests
+   *  that were computed on the same architecture.
+   */
+  unsigned long long Hash() const;
+
 private:
   //! Allocate an array of size vn for the specified vr
   template<class T>
@@ -419,6 +505,10 @@ private:
   template<class T>
   void CreateValue(vtkDICOMVR vr, const T *data, size_t count);
 
+  //! Internal templated method to print numbers into a string VR.
+  template<class T>
+  void CreateValueFromNumbers(vtkDICOMVR vr, const T *data, size_t count);
+
   //! Internal templated method to initialize for future appends.
   template<class T>
   void AppendInit(vtkDICOMVR vr);
@@ -432,6 +522,12 @@ private:
   void SetValue(size_t i, const T &item);
 
   //! Method used by vtkDICOMMetaData to change multiplexed value.
+  /*!
+   *  If the multiplex is shared with another data set, then it is
+   *  replaced with a private copy before the pointer is returned, so
+   *  that per-instance values can be modified without any risk of
+   *  modifying the other data set (i.e. copy-on-write).
+   */
   vtkDICOMValue *GetMultiplex();
 
   //! Get the start and end for the "i"th backslash-delimited value.
@@ -13,8 +13,11 @@
 =========================================================================*/
 #include "vtkDICOMWriter.h"
 #include "vtkDICOMAlgorithm.h"
+#include "vtkDICOMBundle.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMCompiler.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFilePath.h"
 #include "vtkDICOMSCGenerator.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
@@ -22,6 +25,7 @@
 
 #include "vtkObjectFactory.h"
 #include "vtkIntArray.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkImageData.h"
 #include "vtkPointData.h"
 #include "vtkInformationVector.h"
@@ -34,11 +38,14 @@
 #include "vtkCommand.h"
 #include "vtkErrorCode.h"
 #include "vtkSmartPointer.h"
+#include "vtkMultiThreader.h"
+#include "vtkSimpleCriticalSection.h"
 
 #include <time.h>
 #include <math.h>
 #include <stdlib.h>
 
+#include <string>
 #include <vector>
 
 vtkStandardNewMacro(vtkDICOMWriter);
@@ -46,6 +53,85 @@ vtkCxxSetObjectMacro(vtkDICOMWriter,PatientMatrix,vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkDICOMWriter,MetaData,vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMWriter,Generator,vtkDICOMGenerator);
 
+//----------------------------------------------------------------------------
+// a description of the update extent, shared by all writing threads
+struct vtkDICOMWriterUpdateInfo
+{
+  vtkDICOMWriter *Writer;
+  vtkDICOMMetaData *MetaData;
+  const char *TransferSyntaxUID;
+  std::vector<std::string> *FileNames; // indexed from MinFileIdx
+  std::vector<std::string> *FinalNames; // null unless AtomicWrites is on
+  vtkDICOMBundle *Bundle; // null unless writing to a bundle
+  vtkIntArray *SliceMap;
+  vtkIntArray *ComponentMap;
+  unsigned char *DataPtr;
+  int Extent[6];
+  int MinFileIdx;
+  int NumFrames;
+  int NumPlanes;
+  int SamplesPerPixel;
+  int ScalarSize;
+  vtkIdType PixelSize;
+  vtkIdType SliceSize;
+  vtkIdType FilePixelSize;
+  vtkIdType FileRowSize;
+  vtkIdType FilePlaneSize;
+  vtkIdType FileFrameSize;
+  bool FlipImage;
+  bool PackedToPlanar;
+  vtkIdType FilesDone; // guarded by Lock
+  vtkSimpleCriticalSection Lock;
+};
+
+//----------------------------------------------------------------------------
+// this friendship class allows the writing threads to use exactly
+// the same per-file code as the sequential write path
+class vtkDICOMWriterUpdateFriendship
+{
+public:
+  static bool WriteOneFile(vtkDICOMWriter *writer,
+    int fileIdx, vtkDICOMWriterUpdateInfo *info)
+    {
+    return writer->WriteOneFileForUpdate(fileIdx, info);
+    }
+};
+
+//----------------------------------------------------------------------------
+// the method that is executed by each of the writing threads,
+// the files are dealt out to the threads round-robin
+static VTK_THREAD_RETURN_TYPE vtkDICOMWriterThreadUpdate(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMWriterUpdateInfo *info =
+    static_cast<vtkDICOMWriterUpdateInfo *>(ti->UserData);
+  vtkDICOMWriter *writer = info->Writer;
+  size_t n = info->FileNames->size();
+
+  for (size_t idx = ti->ThreadID; idx < n;
+       idx += ti->NumberOfThreads)
+    {
+    if (writer->GetAbortExecute()) { break; }
+
+    vtkDICOMWriterUpdateFriendship::WriteOneFile(
+      writer, info->MinFileIdx + static_cast<int>(idx), info);
+
+    info->Lock.Lock();
+    vtkIdType done = ++(info->FilesDone);
+    info->Lock.Unlock();
+
+    // only the first thread reports progress
+    if (ti->ThreadID == 0)
+      {
+      writer->UpdateProgress(static_cast<double>(done)/
+                             static_cast<double>(n));
+      }
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMWriter::vtkDICOMWriter()
 {
@@ -67,6 +153,13 @@ vtkDICOMWriter::vtkDICOMWriter()
   this->ImageType = new char[24];
   strcpy(this->ImageType, "DERIVED/SECONDARY/OTHER");
   this->Streaming = 0;
+  this->StreamingSlabSize = 1;
+  this->ParallelWriting = 0;
+  this->NumberOfWritingThreads = 0;
+  this->DurabilityPolicy = vtkDICOMWriter::NoSync;
+  this->SyncBatchSize = 100;
+  this->AtomicWrites = 0;
+  this->BundleFileName = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -87,6 +180,7 @@ vtkDICOMWriter::~vtkDICOMWriter()
   delete [] this->TransferSyntaxUID;
   delete [] this->SeriesDescription;
   delete [] this->ImageType;
+  delete [] this->BundleFileName;
 }
 
 //----------------------------------------------------------------------------
@@ -158,6 +252,18 @@ void vtkDICOMWriter::PrintSelf(ostream& os, vtkIndent indent)
      << this->GetFileSliceOrderAsString() << "\n";
   os << indent << "Streaming: "
      << (this->Streaming ? "On\n" : "Off\n");
+  os << indent << "StreamingSlabSize: " << this->StreamingSlabSize << "\n";
+  os << indent << "ParallelWriting: "
+     << (this->ParallelWriting ? "On\n" : "Off\n");
+  os << indent << "NumberOfWritingThreads: "
+     << this->NumberOfWritingThreads << "\n";
+  os << indent << "DurabilityPolicy: "
+     << this->GetDurabilityPolicyAsString() << "\n";
+  os << indent << "SyncBatchSize: " << this->SyncBatchSize << "\n";
+  os << indent << "AtomicWrites: "
+     << (this->AtomicWrites ? "On\n" : "Off\n");
+  os << indent << "BundleFileName: "
+     << (this->BundleFileName ? this->BundleFileName : "(none)") << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -229,6 +335,39 @@ const char *vtkDICOMWriter::GetFileSliceOrderAsString()
   return text;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMWriter::SetDurabilityPolicy(int policy)
+{
+  if (policy >= 0 && policy <= vtkDICOMWriter::SeriesSync)
+    {
+    if (policy != this->DurabilityPolicy)
+      {
+      this->DurabilityPolicy = policy;
+      this->Modified();
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+const char *vtkDICOMWriter::GetDurabilityPolicyAsString()
+{
+  const char *text = "";
+  switch (this->DurabilityPolicy)
+    {
+    case vtkDICOMWriter::NoSync:
+      text = "NoSync";
+      break;
+    case vtkDICOMWriter::BatchedSync:
+      text = "BatchedSync";
+      break;
+    case vtkDICOMWriter::SeriesSync:
+      text = "SeriesSync";
+      break;
+    }
+
+  return text;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMWriter::ComputeInternalFileName(int slice)
 {
@@ -460,7 +599,7 @@ int vtkDICOMWriter::RequestData(
     return 0;
     }
 
-  if (!this->FileName && !this->FilePattern)
+  if (!this->FileName && !this->FilePattern && !this->BundleFileName)
     {
     vtkErrorMacro("Write:Please specify either a FileName "
                   "or a file prefix and pattern");
@@ -504,14 +643,7 @@ int vtkDICOMWriter::RequestData(
       }
     }
 
-  vtkSmartPointer<vtkDICOMCompiler> compiler =
-    vtkSmartPointer<vtkDICOMCompiler>::New();
-  if (this->TransferSyntaxUID)
-    {
-    compiler->SetTransferSyntaxUID(this->TransferSyntaxUID);
-    }
   vtkDICOMMetaData *meta = this->GeneratedMetaData;
-  compiler->SetMetaData(meta);
 
   // write the image
   unsigned char *dataPtr = static_cast<unsigned char *>(
@@ -541,109 +673,368 @@ int vtkDICOMWriter::RequestData(
   this->UpdateProgress(0.0);
 
   bool packedToPlanar = (filePixelSize != pixelSize);
-  unsigned char *rowBuffer = 0;
-  if (flipImage)
+
+  // compute the file names up front, ComputeInternalFileName is
+  // not safe to call from the writing threads (the data sets of a
+  // bundle have no names of their own)
+  std::vector<std::string> fileNames;
+  for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
     {
-    rowBuffer = new unsigned char[fileRowSize];
+    if (this->BundleFileName == 0)
+      {
+      this->ComputeInternalFileName(fileIdx + 1);
+      fileNames.push_back(this->InternalFileName);
+      }
+    else
+      {
+      fileNames.push_back(std::string());
+      }
     }
-  unsigned char *frameBuffer = 0;
-  if (flipImage || packedToPlanar)
+
+  // when a bundle file name has been set, the data sets are appended
+  // to a single bundle file instead of being written as separate files
+  bool atomic = (this->AtomicWrites != 0);
+  vtkSmartPointer<vtkDICOMBundle> bundle;
+  std::string bundleName;
+  if (this->BundleFileName)
     {
-    frameBuffer = new unsigned char[fileFrameSize];
+    bundleName = this->BundleFileName;
+    if (atomic)
+      {
+      bundleName += ".tmp";
+      }
+    bundle = vtkSmartPointer<vtkDICOMBundle>::New();
+    bundle->SetFileName(bundleName.c_str());
+    if (!bundle->StartWrite(static_cast<int>(fileNames.size())))
+      {
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      return 0;
+      }
     }
 
-  // loop through all files in the update extent
-  for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
+  // when the files are to be published atomically, they are written
+  // under temporary names and renamed after they have been flushed
+  std::vector<std::string> tempNames;
+  if (atomic && bundle == 0)
     {
-    // get the index for this file
-    this->ComputeInternalFileName(fileIdx + 1);
-    compiler->SetFileName(this->InternalFileName);
-    compiler->SetIndex(fileIdx);
-    compiler->SetSOPInstanceUID(
-      meta->GetAttributeValue(fileIdx, DC::SOPInstanceUID).GetCharData());
-    compiler->SetSeriesInstanceUID(
-      meta->GetAttributeValue(fileIdx, DC::SeriesInstanceUID).GetCharData());
-    compiler->WriteHeader();
-
-    // iterate through all frames in the file
-    for (int frameIdx = 0; frameIdx < numFrames; frameIdx++)
+    for (size_t ni = 0; ni < fileNames.size(); ni++)
       {
-      if (this->AbortExecute) { break; }
+      tempNames.push_back(fileNames[ni] + ".tmp");
+      }
+    }
 
-      this->UpdateProgress(static_cast<double>(fileIdx*numFrames + frameIdx)/
-                           static_cast<double>(numFiles*numFrames));
+  // the parameters that describe the update extent, to be shared
+  // by all of the writing threads
+  vtkDICOMWriterUpdateInfo updateInfo;
+  updateInfo.Writer = this;
+  updateInfo.MetaData = meta;
+  updateInfo.TransferSyntaxUID = this->TransferSyntaxUID;
+  updateInfo.FileNames = (tempNames.empty() ? &fileNames : &tempNames);
+  updateInfo.FinalNames = (tempNames.empty() ? 0 : &fileNames);
+  updateInfo.Bundle = bundle;
+  updateInfo.SliceMap = sliceMap;
+  updateInfo.ComponentMap = componentMap;
+  updateInfo.DataPtr = dataPtr;
+  for (int ii = 0; ii < 6; ii++)
+    {
+    updateInfo.Extent[ii] = extent[ii];
+    }
+  updateInfo.MinFileIdx = minFileIdx;
+  updateInfo.NumFrames = numFrames;
+  updateInfo.NumPlanes = numPlanes;
+  updateInfo.SamplesPerPixel = samplesPerPixel;
+  updateInfo.ScalarSize = scalarSize;
+  updateInfo.PixelSize = pixelSize;
+  updateInfo.SliceSize = sliceSize;
+  updateInfo.FilePixelSize = filePixelSize;
+  updateInfo.FileRowSize = fileRowSize;
+  updateInfo.FilePlaneSize = filePlaneSize;
+  updateInfo.FileFrameSize = fileFrameSize;
+  updateInfo.FlipImage = flipImage;
+  updateInfo.PackedToPlanar = packedToPlanar;
+  updateInfo.FilesDone = 0;
+
+  // decide how many files to write between flushes; with NoSync the
+  // files are not flushed, but atomic publication still renames each
+  // file as soon as it has been closed
+  int publishBatch = 0;
+  if (bundle == 0)
+    {
+    if (this->DurabilityPolicy == vtkDICOMWriter::BatchedSync)
+      {
+      publishBatch = (this->SyncBatchSize > 0 ? this->SyncBatchSize : 0);
+      }
+    else if (this->DurabilityPolicy == vtkDICOMWriter::NoSync && atomic)
+      {
+      publishBatch = 1;
+      }
+    }
+  int published = 0;
+  int filesWritten = 0;
 
-      int sliceIdx = sliceMap->GetComponent(fileIdx, frameIdx);
-      int componentIdx = componentMap->GetComponent(fileIdx, frameIdx);
+  if (this->ParallelWriting && fileNames.size() > 1 && bundle == 0)
+    {
+    // write the files with a pool of worker threads, each worker
+    // assembles and writes whole files through its own compiler
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    if (this->NumberOfWritingThreads > 0)
+      {
+      threader->SetNumberOfThreads(this->NumberOfWritingThreads);
+      }
+    if (threader->GetNumberOfThreads() > static_cast<int>(fileNames.size()))
+      {
+      threader->SetNumberOfThreads(static_cast<int>(fileNames.size()));
+      }
+    threader->SetSingleMethod(vtkDICOMWriterThreadUpdate, &updateInfo);
+    threader->SingleMethodExecute();
+    threader->Delete();
+    filesWritten = static_cast<int>(fileNames.size());
+    }
+  else
+    {
+    // loop through all files in the update extent
+    for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
+      {
+      if (this->AbortExecute) { break; }
+
+      this->UpdateProgress(static_cast<double>(fileIdx - minFileIdx)/
+                           static_cast<double>(fileNames.size()));
 
-      // pointer to the frame that will be written to the file
-      unsigned char *framePtr = frameBuffer;
+      this->WriteOneFileForUpdate(fileIdx, &updateInfo);
+      filesWritten = fileIdx - minFileIdx + 1;
 
-      if (!framePtr)
+      if (publishBatch > 0 && filesWritten % publishBatch == 0)
         {
-        // write the frame directly from image data
-        framePtr = (dataPtr + (sliceIdx - extent[4])*sliceSize);
+        this->PublishFiles(&updateInfo, published, filesWritten);
+        published = filesWritten;
         }
+      }
+    }
 
-      // go to the correct position in image data
-      unsigned char *slicePtr =
-        (dataPtr + (sliceIdx - extent[4])*sliceSize +
-         componentIdx*samplesPerPixel*scalarSize);
-
-      // iterate through all color planes in the slice
-      unsigned char *planePtr = framePtr;
-      for (int pIdx = 0; pIdx < numPlanes; pIdx++)
+  // flush and publish the files that have not been published yet,
+  // then flush the directory so that the new entries are durable
+  if (bundle != 0)
+    {
+    // write the index and close the bundle, then flush, rename, and
+    // sync it according to the same policies that govern plain files
+    bool good = bundle->FinishWrite();
+    if (good && !this->AbortExecute)
+      {
+      if (this->DurabilityPolicy != vtkDICOMWriter::NoSync)
         {
-        // convert scalar components to planes
-        if (packedToPlanar)
+        vtkDICOMFile f(bundleName.c_str(), vtkDICOMFile::In);
+        if (f.GetError() != 0 || !f.Sync())
           {
-          const unsigned char *tmpInPtr = slicePtr;
-          unsigned char *tmpOutPtr = planePtr;
-          int m = sliceSize/pixelSize;
-          for (int i = 0; i < m; i++)
-            {
-            vtkIdType n = filePixelSize;
-            do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
-            tmpInPtr += pixelSize - filePixelSize;
-            }
-          slicePtr += filePixelSize;
+          vtkErrorMacro("Unable to flush file to disk: " << bundleName);
+          good = false;
           }
-        else
+        }
+      if (good && atomic &&
+          vtkDICOMFile::Rename(bundleName.c_str(),
+                               this->BundleFileName) != 0)
+        {
+        vtkErrorMacro("Unable to rename \"" << bundleName << "\" to \""
+                      << this->BundleFileName << "\"");
+        }
+      if (this->DurabilityPolicy != vtkDICOMWriter::NoSync)
+        {
+        vtkDICOMFilePath dirPath(bundleName);
+        dirPath.PopBack();
+        const std::string& dirName = dirPath.AsString();
+        vtkDICOMFile::SyncDirectory(
+          dirName.empty() ? "." : dirName.c_str());
+        }
+      }
+    }
+  else if ((atomic || this->DurabilityPolicy != vtkDICOMWriter::NoSync) &&
+      !this->AbortExecute)
+    {
+    this->PublishFiles(&updateInfo, published, filesWritten);
+    if (this->DurabilityPolicy != vtkDICOMWriter::NoSync &&
+        filesWritten > 0)
+      {
+      vtkDICOMFilePath dirPath(fileNames[0]);
+      dirPath.PopBack();
+      const std::string& dirName = dirPath.AsString();
+      vtkDICOMFile::SyncDirectory(
+        dirName.empty() ? "." : dirName.c_str());
+      }
+    }
+
+  this->FreeInternalFileName();
+
+  this->UpdateProgress(1.0);
+  this->InvokeEvent(vtkCommand::EndEvent);
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMWriter::WriteOneFileForUpdate(
+  int fileIdx, vtkDICOMWriterUpdateInfo *info)
+{
+  vtkDICOMMetaData *meta = info->MetaData;
+  const int *extent = info->Extent;
+
+  // each file gets its own compiler, so that multiple files can be
+  // compiled and written concurrently
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  if (info->TransferSyntaxUID)
+    {
+    compiler->SetTransferSyntaxUID(info->TransferSyntaxUID);
+    }
+  compiler->SetMetaData(meta);
+
+  // allocate the buffers needed to reorganize the frame data
+  unsigned char *rowBuffer = 0;
+  if (info->FlipImage)
+    {
+    rowBuffer = new unsigned char[info->FileRowSize];
+    }
+  unsigned char *frameBuffer = 0;
+  if (info->FlipImage || info->PackedToPlanar)
+    {
+    frameBuffer = new unsigned char[info->FileFrameSize];
+    }
+
+  // when writing to a bundle, the data set is compiled into memory
+  // and then appended to the bundle file
+  vtkSmartPointer<vtkUnsignedCharArray> outputBuffer;
+  if (info->Bundle)
+    {
+    outputBuffer = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    compiler->SetOutputBuffer(outputBuffer);
+    }
+  else
+    {
+    compiler->SetFileName(
+      (*info->FileNames)[fileIdx - info->MinFileIdx].c_str());
+    }
+  compiler->SetIndex(fileIdx);
+  compiler->SetSOPInstanceUID(
+    meta->GetAttributeValue(fileIdx, DC::SOPInstanceUID).GetCharData());
+  compiler->SetSeriesInstanceUID(
+    meta->GetAttributeValue(fileIdx, DC::SeriesInstanceUID).GetCharData());
+  compiler->WriteHeader();
+
+  // iterate through all frames in the file
+  for (int frameIdx = 0; frameIdx < info->NumFrames; frameIdx++)
+    {
+    if (this->AbortExecute) { break; }
+
+    int sliceIdx = info->SliceMap->GetComponent(fileIdx, frameIdx);
+    int componentIdx = info->ComponentMap->GetComponent(fileIdx, frameIdx);
+
+    // pointer to the frame that will be written to the file
+    unsigned char *framePtr = frameBuffer;
+
+    if (!framePtr)
+      {
+      // write the frame directly from image data
+      framePtr = (info->DataPtr + (sliceIdx - extent[4])*info->SliceSize);
+      }
+
+    // go to the correct position in image data
+    unsigned char *slicePtr =
+      (info->DataPtr + (sliceIdx - extent[4])*info->SliceSize +
+       componentIdx*info->SamplesPerPixel*info->ScalarSize);
+
+    // iterate through all color planes in the slice
+    unsigned char *planePtr = framePtr;
+    for (int pIdx = 0; pIdx < info->NumPlanes; pIdx++)
+      {
+      // convert scalar components to planes
+      if (info->PackedToPlanar)
+        {
+        const unsigned char *tmpInPtr = slicePtr;
+        unsigned char *tmpOutPtr = planePtr;
+        int m = info->SliceSize/info->PixelSize;
+        for (int i = 0; i < m; i++)
           {
-          memcpy(framePtr, slicePtr, fileFrameSize);
+          vtkIdType n = info->FilePixelSize;
+          do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
+          tmpInPtr += info->PixelSize - info->FilePixelSize;
           }
+        slicePtr += info->FilePixelSize;
+        }
+      else
+        {
+        memcpy(framePtr, slicePtr, info->FileFrameSize);
+        }
 
-        // flip the data if necessary
-        if (flipImage)
+      // flip the data if necessary
+      if (info->FlipImage)
+        {
+        int numRows = extent[3] - extent[2] + 1;
+        int halfRows = numRows/2;
+        for (int yIdx = 0; yIdx < halfRows; yIdx++)
           {
-          int numRows = extent[3] - extent[2] + 1;
-          int halfRows = numRows/2;
-          for (int yIdx = 0; yIdx < halfRows; yIdx++)
-            {
-            unsigned char *row1 = planePtr + yIdx*fileRowSize;
-            unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
-            memcpy(rowBuffer, row1, fileRowSize);
-            memcpy(row1, row2, fileRowSize);
-            memcpy(row2, rowBuffer, fileRowSize);
-            }
+          unsigned char *row1 = planePtr + yIdx*info->FileRowSize;
+          unsigned char *row2 =
+            planePtr + (numRows-yIdx-1)*info->FileRowSize;
+          memcpy(rowBuffer, row1, info->FileRowSize);
+          memcpy(row1, row2, info->FileRowSize);
+          memcpy(row2, rowBuffer, info->FileRowSize);
           }
-
-        planePtr += filePlaneSize;
         }
-      // write the frame to the file
-      compiler->WriteFrame(framePtr, fileFrameSize);
+
+      planePtr += info->FilePlaneSize;
       }
-    compiler->Close();
+    // write the frame to the file
+    compiler->WriteFrame(framePtr, info->FileFrameSize);
     }
+  compiler->Close();
 
   delete [] rowBuffer;
   delete [] frameBuffer;
-  this->FreeInternalFileName();
 
-  this->UpdateProgress(1.0);
-  this->InvokeEvent(vtkCommand::EndEvent);
+  bool good = (compiler->GetErrorCode() == 0);
+  if (good && info->Bundle)
+    {
+    good = info->Bundle->WriteInstance(
+      outputBuffer->GetPointer(0), outputBuffer->GetNumberOfTuples());
+    }
 
-  return 1;
+  return good;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMWriter::PublishFiles(
+  vtkDICOMWriterUpdateInfo *info, int start, int end)
+{
+  bool good = true;
+  bool sync = (this->DurabilityPolicy != vtkDICOMWriter::NoSync);
+
+  for (int idx = start; idx < end; idx++)
+    {
+    const char *name = (*info->FileNames)[idx].c_str();
+    if (sync)
+      {
+      // reopen the file in order to flush it, the data reaches the
+      // storage device even though the file was written and closed
+      // through a different descriptor
+      vtkDICOMFile f(name, vtkDICOMFile::In);
+      if (f.GetError() != 0 || !f.Sync())
+        {
+        vtkErrorMacro("Unable to flush file to disk: " << name);
+        good = false;
+        continue;
+        }
+      }
+    if (info->FinalNames)
+      {
+      const char *finalName = (*info->FinalNames)[idx].c_str();
+      if (vtkDICOMFile::Rename(name, finalName) != 0)
+        {
+        vtkErrorMacro("Unable to rename \"" << name << "\" to \""
+                      << finalName << "\"");
+        good = false;
+        }
+      }
+    }
+
+  return good;
 }
 
 //----------------------------------------------------------------------------
@@ -655,7 +1046,7 @@ void vtkDICOMWriter::Write()
   vtkInformation* inInfo = this->GetExecutive()->GetInputInformation(0, 0);
   int wholeExtent[6];
   inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
-  // if streaming is on, write the slices one-at-a-time
+  // if streaming is on, write the slices one slab at a time
   if (this->Streaming && this->FileDimensionality == 2)
     {
     if (this->GenerateMetaData(inInfo))
@@ -665,11 +1056,17 @@ void vtkDICOMWriter::Write()
         wholeExtent[2], wholeExtent[3],
         wholeExtent[4], wholeExtent[5]
       };
-      for (int i = wholeExtent[4]; i <= wholeExtent[5]; i++)
+      int slabSize = (this->StreamingSlabSize > 1 ?
+                      this->StreamingSlabSize : 1);
+      for (int i = wholeExtent[4]; i <= wholeExtent[5]; i += slabSize)
         {
-        // set the update extent to the slice
+        // set the update extent to the slab
         extent[4] = i;
-        extent[5] = i;
+        extent[5] = i + slabSize - 1;
+        if (extent[5] > wholeExtent[5])
+          {
+          extent[5] = wholeExtent[5];
+          }
         this->Modified();
         inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
                     extent, 6);
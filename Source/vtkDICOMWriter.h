@@ -31,6 +31,8 @@
 class vtkMatrix4x4;
 class vtkDICOMMetaData;
 class vtkDICOMGenerator;
+struct vtkDICOMWriterUpdateInfo;
+class vtkDICOMWriterUpdateFriendship;
 
 class VTKDICOM_EXPORT vtkDICOMWriter : public vtkImageWriter
 {
@@ -174,6 +176,90 @@ public:
   vtkGetMacro(Streaming, int);
   vtkBooleanMacro(Streaming, int);
 
+  // Description:
+  // The number of slices per streamed update (default: 1).
+  // This only has an effect when Streaming is on.  A slab of several
+  // slices bounds the memory use almost as tightly as single slices
+  // do, but it gives the upstream reader larger, more efficient
+  // requests, and it lets the files of each slab be written
+  // concurrently when ParallelWriting is also on.
+  vtkSetMacro(StreamingSlabSize, int);
+  vtkGetMacro(StreamingSlabSize, int);
+
+  // Description:
+  // Write the files with a pool of worker threads (default: Off).
+  // The shared meta data is still generated just once, but each worker
+  // runs its own vtkDICOMCompiler, so the assembly of the per-file
+  // data and the file I/O proceed concurrently.  When Streaming is
+  // on, this only takes effect if StreamingSlabSize is large enough
+  // for each update to span more than one file.
+  vtkSetMacro(ParallelWriting, int);
+  vtkGetMacro(ParallelWriting, int);
+  vtkBooleanMacro(ParallelWriting, int);
+
+  // Description:
+  // The number of threads to use for parallel writing.
+  // The default is zero, which means one thread per processor core.
+  vtkSetMacro(NumberOfWritingThreads, int);
+  vtkGetMacro(NumberOfWritingThreads, int);
+
+  // Description:
+  // Enumeration of durability policies for the output files.
+  enum Durability { NoSync, BatchedSync, SeriesSync };
+
+  // Description:
+  // Set the durability policy for the output files.
+  // With NoSync (the default), the operating system writes the file
+  // data to the storage device at its own leisure.  With BatchedSync,
+  // the data is flushed to the storage device after every SyncBatchSize
+  // files, and with SeriesSync, all of the files are flushed together
+  // after the last file of the update has been written; in both cases
+  // the directory entries are flushed at the end as well.  Flushing in
+  // batches is much cheaper than flushing each file as it is closed,
+  // because the storage device can work through one batch while the
+  // next batch is being assembled.  When ParallelWriting is on, the
+  // files finish out of order, so BatchedSync is treated as SeriesSync.
+  void SetDurabilityPolicy(int policy);
+  void SetDurabilityPolicyToNoSync() {
+    this->SetDurabilityPolicy(NoSync); }
+  void SetDurabilityPolicyToBatchedSync() {
+    this->SetDurabilityPolicy(BatchedSync); }
+  void SetDurabilityPolicyToSeriesSync() {
+    this->SetDurabilityPolicy(SeriesSync); }
+  int GetDurabilityPolicy() { return this->DurabilityPolicy; }
+  const char *GetDurabilityPolicyAsString();
+
+  // Description:
+  // The number of files to write between flushes (default: 100).
+  // This is only used when the durability policy is BatchedSync.
+  vtkSetMacro(SyncBatchSize, int);
+  vtkGetMacro(SyncBatchSize, int);
+
+  // Description:
+  // Publish each output file atomically (default: Off).
+  // Each file is written under a temporary name, and is only renamed
+  // to its final name after its data has been flushed according to
+  // the durability policy (or, with NoSync, as soon as it has been
+  // closed).  A crash part-way through an export can leave stale
+  // temporary files behind, but it can never leave a partially
+  // written file under a final name.
+  vtkSetMacro(AtomicWrites, int);
+  vtkGetMacro(AtomicWrites, int);
+  vtkBooleanMacro(AtomicWrites, int);
+
+  // Description:
+  // Write the whole series into a single bundle file (default: none).
+  // When a bundle file name is set, each data set is compiled in
+  // memory and appended to one file in the series bundle format (see
+  // vtkDICOMBundle), instead of being written as a file of its own.
+  // A bundle can be read back by vtkDICOMReader with one file open,
+  // which is much cheaper than opening hundreds of small files.  The
+  // data sets are appended in order, so ParallelWriting is ignored,
+  // and the durability policy and AtomicWrites apply to the bundle
+  // file as a whole.
+  vtkSetStringMacro(BundleFileName);
+  vtkGetStringMacro(BundleFileName);
+
   // Description:
   // Write the file to disk.
   virtual void Write();
@@ -200,6 +286,22 @@ protected:
                           vtkInformationVector** inputVector,
                           vtkInformationVector* outputVector);
 
+  // Description:
+  // Write one file of the update extent.  This contains the per-file
+  // work that is done once per file when writing sequentially, or by
+  // each worker thread when the ParallelWriting option is turned on.
+  virtual bool WriteOneFileForUpdate(
+    int fileIdx, vtkDICOMWriterUpdateInfo *info);
+
+  // Description:
+  // Flush and publish a range of files that have just been written.
+  // For each file in the half-open range [start, end), the file data
+  // is flushed to the storage device (unless the durability policy is
+  // NoSync), and then the file is renamed from its temporary name to
+  // its final name (when AtomicWrites is on).  This is called after
+  // each batch of files has been written.
+  bool PublishFiles(vtkDICOMWriterUpdateInfo *info, int start, int end);
+
   // Description:
   // The meta data set by the user.
   vtkDICOMMetaData *MetaData;
@@ -253,8 +355,29 @@ protected:
   // Description:
   // Whether to stream the data and write one file at a time.
   int Streaming;
+  int StreamingSlabSize;
+
+  // Description:
+  // Select whether to write the files with multiple threads.
+  int ParallelWriting;
+  int NumberOfWritingThreads;
+
+  // Description:
+  // The durability policy for the output files.
+  int DurabilityPolicy;
+  int SyncBatchSize;
+
+  // Description:
+  // Whether to write via a temporary name and rename afterwards.
+  int AtomicWrites;
+
+  // Description:
+  // The name of the bundle file, if writing a series bundle.
+  char *BundleFileName;
 
 private:
+  friend class vtkDICOMWriterUpdateFriendship;
+
   vtkDICOMWriter(const vtkDICOMWriter&);  // Not implemented.
   void operator=(const vtkDICOMWriter&);  // Not implemented.
 };
@@ -21,6 +21,7 @@
 #include "vtkByteSwap.h"
 #include "vtkMatrix4x4.h"
 #include "vtkMath.h"
+#include "vtkCallbackCommand.h"
 #include "vtkCommand.h"
 #include "vtkErrorCode.h"
 #include "vtkInformation.h"
@@ -32,6 +33,12 @@
 #ifdef _WIN32
 // To allow use of wchar_t paths on Windows
 #include "vtkDICOMFilePath.h"
+// For opening a file descriptor to pass to gzdopen
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 #include "vtkDICOMFile.h"
 
@@ -83,6 +90,10 @@ vtkNIFTIReader::vtkNIFTIReader()
   this->SFormMatrix = 0;
   this->NIFTIHeader = 0;
   this->PlanarRGB = false;
+  this->MemoryMapping = 0;
+  this->FileBackedOutput = 0;
+  this->ScratchDirectory = 0;
+  this->HugePages = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -100,6 +111,7 @@ vtkNIFTIReader::~vtkNIFTIReader()
     {
     this->NIFTIHeader->Delete();
     }
+  delete [] this->ScratchDirectory;
 }
 
 //----------------------------------------------------------------------------
@@ -243,6 +255,14 @@ void vtkNIFTIReader::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "NIFTIHeader:" << (this->NIFTIHeader ? "\n" : " (none)\n");
   os << indent << "PlanarRGB: " << (this->PlanarRGB ? "On\n" : "Off\n");
+  os << indent << "MemoryMapping: "
+     << (this->MemoryMapping ? "On\n" : "Off\n");
+  os << indent << "FileBackedOutput: "
+     << (this->FileBackedOutput ? "On\n" : "Off\n");
+  os << indent << "ScratchDirectory: "
+     << (this->ScratchDirectory ? this->ScratchDirectory : "(NULL)") << "\n";
+  os << indent << "HugePages: "
+     << (this->HugePages ? "On\n" : "Off\n");
 }
 
 //----------------------------------------------------------------------------
@@ -1096,6 +1116,311 @@ int vtkNIFTIReader::RequestInformation(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+// Find the last gzip member boundary at or before the given offset
+// into the uncompressed stream.  Files produced by vtkNIFTIWriter
+// with ParallelCompression are a series of independent gzip members,
+// each tagged with its compressed and uncompressed sizes in a gzip
+// "extra" subfield (id "VK"), so whole members can be hopped over
+// without decompressing them.  Untagged members (the member that
+// holds the file header, or members written by other software) are
+// decompressed and discarded instead, up to a small cap so that
+// scanning an ordinary single-member file gives up quickly.  The
+// return value is true if a boundary past the start of the file was
+// found, and the compressed and uncompressed offsets of the boundary
+// are returned in "cstartOut" and "ustartOut".
+static bool vtkNIFTIReaderFindMember(
+  const char *fname, z_off_t offset, z_off_t *cstartOut, z_off_t *ustartOut)
+{
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+    {
+    return false;
+    }
+  vtkDICOMFile::Size fsize = f.GetSize();
+  unsigned long long target = static_cast<unsigned long long>(offset);
+  unsigned long long cstart = 0;
+  unsigned long long ustart = 0;
+  // the cap on the output of untagged members
+  const unsigned long long untaggedCap = 1048576;
+
+  for (;;)
+    {
+    unsigned char h[24];
+    if (cstart + 24 > fsize ||
+        !f.SetPosition(cstart) ||
+        f.Read(h, 24) != 24)
+      {
+      break;
+      }
+    if (!(h[0] == 0x1f && h[1] == 0x8b && h[2] == 8))
+      {
+      break;
+      }
+    if ((h[3] & 0x04) != 0 && h[10] == 12 && h[11] == 0 &&
+        h[12] == 'V' && h[13] == 'K' && h[14] == 8 && h[15] == 0)
+      {
+      // a tagged member, hop over it without decompressing
+      unsigned long long csize =
+        h[16] + (h[17] << 8) + (h[18] << 16) +
+        (static_cast<unsigned long long>(h[19]) << 24);
+      unsigned long long usize =
+        h[20] + (h[21] << 8) + (h[22] << 16) +
+        (static_cast<unsigned long long>(h[23]) << 24);
+      if (csize == 0 || ustart + usize > target)
+        {
+        break;
+        }
+      cstart += csize;
+      ustart += usize;
+      }
+    else
+      {
+      // an untagged member, decompress and discard it to find where
+      // the next member begins
+      z_stream strm;
+      memset(&strm, 0, sizeof(strm));
+      if (inflateInit2(&strm, 15 + 16) != Z_OK)
+        {
+        break;
+        }
+      unsigned char inbuf[4096];
+      unsigned char outbuf[4096];
+      f.SetPosition(cstart);
+      int code = Z_OK;
+      while (code == Z_OK && strm.total_out <= untaggedCap)
+        {
+        if (strm.avail_in == 0)
+          {
+          size_t m = f.Read(inbuf, sizeof(inbuf));
+          if (m == 0) { break; }
+          strm.next_in = inbuf;
+          strm.avail_in = static_cast<uInt>(m);
+          }
+        strm.next_out = outbuf;
+        strm.avail_out = sizeof(outbuf);
+        code = inflate(&strm, Z_NO_FLUSH);
+        }
+      bool ended = (code == Z_STREAM_END);
+      unsigned long long csize = strm.total_in;
+      unsigned long long usize = strm.total_out;
+      inflateEnd(&strm);
+      if (!ended || ustart + usize > target)
+        {
+        break;
+        }
+      cstart += csize;
+      ustart += usize;
+      }
+    }
+
+  *cstartOut = static_cast<z_off_t>(cstart);
+  *ustartOut = static_cast<z_off_t>(ustart);
+  return (cstart > 0);
+}
+
+//----------------------------------------------------------------------------
+// Open a compressed file for reading with the read position set to
+// "offset", which must be the position of a gzip member boundary.
+static gzFile vtkNIFTIReaderOpenAtOffset(const char *fname, z_off_t offset)
+{
+#ifdef _WIN32
+  vtkDICOMFilePath fp(fname);
+#if VTK_MAJOR_VERSION < 7
+  int fd = _open(fp.Local(), _O_RDONLY | _O_BINARY);
+#else
+  int fd = _wopen(fp.Wide(), _O_RDONLY | _O_BINARY);
+#endif
+  if (fd < 0)
+    {
+    return 0;
+    }
+  if (_lseeki64(fd, offset, SEEK_SET) < 0)
+    {
+    _close(fd);
+    return 0;
+    }
+#else
+  int fd = open(fname, O_RDONLY);
+  if (fd < 0)
+    {
+    return 0;
+    }
+  if (lseek(fd, static_cast<off_t>(offset), SEEK_SET) < 0)
+    {
+    close(fd);
+    return 0;
+    }
+#endif
+  gzFile gzf = gzdopen(fd, "rb");
+  if (gzf == 0)
+    {
+#ifdef _WIN32
+    _close(fd);
+#else
+    close(fd);
+#endif
+    }
+  return gzf;
+}
+
+//----------------------------------------------------------------------------
+// a record of the scratch-file mapping that backs an output array
+struct vtkNIFTIReaderScratchInfo
+{
+  void *Pointer;
+  vtkIdType Size;
+};
+
+// called when a file-backed output array is deleted, in order to
+// release the mapping (which also reclaims the scratch file)
+static void vtkNIFTIReaderScratchDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  vtkNIFTIReaderScratchInfo *sinfo =
+    static_cast<vtkNIFTIReaderScratchInfo *>(clientData);
+  vtkDICOMFile::UnmapScratchFile(sinfo->Pointer, sinfo->Size);
+  delete sinfo;
+}
+
+// called when a large-page output array is deleted, in order to
+// return the memory to the operating system
+static void vtkNIFTIReaderLargePagesDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  vtkNIFTIReaderScratchInfo *sinfo =
+    static_cast<vtkNIFTIReaderScratchInfo *>(clientData);
+  vtkDICOMFile::UnmapLargePages(sinfo->Pointer, sinfo->Size);
+  delete sinfo;
+}
+
+//----------------------------------------------------------------------------
+// Reverse the order of the slices in a volume, in place.  Pairs of
+// slices are swapped through a small buffer in blocks, so that both
+// the source and destination of every copy stay within the cache.
+static void vtkNIFTIReaderReverseSlices(
+  unsigned char *data, vtkIdType sliceSize, int numSlices)
+{
+  unsigned char block[8192];
+
+  for (int i = 0, j = numSlices - 1; i < j; i++, j--)
+    {
+    unsigned char *lower = data + i*sliceSize;
+    unsigned char *upper = data + j*sliceSize;
+    for (vtkIdType r = 0; r < sliceSize; r += 8192)
+      {
+      size_t n = static_cast<size_t>(
+        sliceSize - r < 8192 ? sliceSize - r : 8192);
+      memcpy(block, lower + r, n);
+      memcpy(lower + r, upper + r, n);
+      memcpy(upper + r, block, n);
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+// Read an update extent that is contiguous within the file, using
+// large reads that may span many slices rather than at most one slice
+// of rows per read.  If "flipSlices" is set, then each chunk is read
+// into its final (reversed) position and the slices within it are
+// swapped in place, so the data still crosses memory only once.  The
+// return value is zero on success, or a vtkErrorCode otherwise.
+static int vtkNIFTIReaderReadContiguous(
+  vtkNIFTIReader *self, gzFile file, const unsigned char *mapData,
+  vtkDICOMFile::Size mapSize, vtkDICOMFile::Size mapOffset,
+  z_off_t offset, unsigned char *dataPtr, vtkIdType sliceSize,
+  int numSlices, bool flipSlices, int swapBytes, int scalarSize)
+{
+  // seek to the start of the update extent
+  if (offset)
+    {
+    if (mapData)
+      {
+      mapOffset += offset;
+      }
+    else if (gzseek(file, offset, SEEK_CUR) == -1)
+      {
+      return (gzeof(file) ? vtkErrorCode::PrematureEndOfFileError
+                          : vtkErrorCode::FileFormatError);
+      }
+    }
+
+  // cap the size of a single read at sixteen mebibytes
+  vtkIdType totalBytes = sliceSize*numSlices;
+  vtkIdType chunkBytes = 16777216;
+  if (flipSlices)
+    {
+    // read whole slices, so that each chunk can be dropped into its
+    // final position and have its slice order reversed in place
+    int chunkSlices = static_cast<int>(chunkBytes/sliceSize);
+    if (chunkSlices < 1)
+      {
+      chunkSlices = 1;
+      }
+    chunkBytes = chunkSlices*sliceSize;
+    }
+
+  // report progress every 2% of the way to completion
+  vtkIdType target = static_cast<vtkIdType>(0.02*totalBytes) + 1;
+
+  vtkIdType bytesDone = 0;
+  int sliceIndex = 0;
+  while (bytesDone < totalBytes && !self->GetAbortExecute())
+    {
+    vtkIdType n = chunkBytes;
+    if (n > totalBytes - bytesDone)
+      {
+      n = totalBytes - bytesDone;
+      }
+
+    unsigned char *ptr = dataPtr + bytesDone;
+    int chunkSlices = 0;
+    if (flipSlices)
+      {
+      chunkSlices = static_cast<int>(n/sliceSize);
+      ptr = dataPtr + (numSlices - sliceIndex - chunkSlices)*sliceSize;
+      }
+
+    if (mapData)
+      {
+      if (mapOffset + n > mapSize)
+        {
+        return vtkErrorCode::PrematureEndOfFileError;
+        }
+      memcpy(ptr, mapData + mapOffset, n);
+      mapOffset += n;
+      }
+    else
+      {
+      int code = gzread(file, ptr, static_cast<unsigned int>(n));
+      if (code != n)
+        {
+        return (gzeof(file) ? vtkErrorCode::PrematureEndOfFileError
+                            : vtkErrorCode::FileFormatError);
+        }
+      }
+
+    if (swapBytes != 0 && scalarSize > 1)
+      {
+      vtkByteSwap::SwapVoidRange(ptr, n/scalarSize, scalarSize);
+      }
+
+    if (chunkSlices > 1)
+      {
+      vtkNIFTIReaderReverseSlices(ptr, sliceSize, chunkSlices);
+      }
+
+    sliceIndex += chunkSlices;
+    bytesDone += n;
+    if (bytesDone/target != (bytesDone - n)/target)
+      {
+      self->UpdateProgress(0.02*bytesDone/target);
+      }
+    }
+
+  return 0;
+}
+
 //----------------------------------------------------------------------------
 int vtkNIFTIReader::RequestData(
   vtkInformation* request,
@@ -1126,11 +1451,87 @@ int vtkNIFTIReader::RequestData(
   // get the data object, allocate memory
   vtkImageData *data =
     static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  bool allocated = false;
+  if (this->FileBackedOutput)
+    {
+    // allocate the output scalars in a memory-mapped scratch file,
+    // so that a volume larger than physical memory can be read with
+    // the operating system paging it to and from the disk
+    vtkIdType numValues = this->NumberOfScalarComponents;
+    numValues *= (extent[1] - extent[0] + 1);
+    numValues *= (extent[3] - extent[2] + 1);
+    numValues *= (extent[5] - extent[4] + 1);
+    vtkIdType numBytes =
+      numValues*vtkDataArray::GetDataTypeSize(this->DataScalarType);
+    void *sptr = vtkDICOMFile::MapScratchFile(
+      this->ScratchDirectory, numBytes);
+    if (sptr)
+      {
+      data->SetExtent(extent);
+      vtkDataArray *scalars =
+        vtkDataArray::CreateDataArray(this->DataScalarType);
+      scalars->SetNumberOfComponents(this->NumberOfScalarComponents);
+      scalars->SetVoidArray(sptr, numValues, 1);
+      // release the mapping when the array is deleted
+      vtkNIFTIReaderScratchInfo *sinfo = new vtkNIFTIReaderScratchInfo;
+      sinfo->Pointer = sptr;
+      sinfo->Size = numBytes;
+      vtkCallbackCommand *cc = vtkCallbackCommand::New();
+      cc->SetCallback(vtkNIFTIReaderScratchDeleted);
+      cc->SetClientData(sinfo);
+      scalars->AddObserver(vtkCommand::DeleteEvent, cc);
+      cc->Delete();
+      data->GetPointData()->SetScalars(scalars);
+      scalars->Delete();
+      allocated = true;
+      }
+    else
+      {
+      vtkWarningMacro("Unable to create a scratch file for "
+                      << numBytes << " bytes, using ordinary memory "
+                      "for the output.");
+      }
+    }
+  else if (this->HugePages)
+    {
+    // allocate the output scalars with large-page backing, which
+    // reduces address-translation overhead for very large volumes
+    vtkIdType numValues = this->NumberOfScalarComponents;
+    numValues *= (extent[1] - extent[0] + 1);
+    numValues *= (extent[3] - extent[2] + 1);
+    numValues *= (extent[5] - extent[4] + 1);
+    vtkIdType numBytes =
+      numValues*vtkDataArray::GetDataTypeSize(this->DataScalarType);
+    void *sptr = vtkDICOMFile::MapLargePages(numBytes);
+    if (sptr)
+      {
+      data->SetExtent(extent);
+      vtkDataArray *scalars =
+        vtkDataArray::CreateDataArray(this->DataScalarType);
+      scalars->SetNumberOfComponents(this->NumberOfScalarComponents);
+      scalars->SetVoidArray(sptr, numValues, 1);
+      // release the memory when the array is deleted
+      vtkNIFTIReaderScratchInfo *sinfo = new vtkNIFTIReaderScratchInfo;
+      sinfo->Pointer = sptr;
+      sinfo->Size = numBytes;
+      vtkCallbackCommand *cc = vtkCallbackCommand::New();
+      cc->SetCallback(vtkNIFTIReaderLargePagesDeleted);
+      cc->SetClientData(sinfo);
+      scalars->AddObserver(vtkCommand::DeleteEvent, cc);
+      cc->Delete();
+      data->GetPointData()->SetScalars(scalars);
+      scalars->Delete();
+      allocated = true;
+      }
+    }
+  if (!allocated)
+    {
 #if VTK_MAJOR_VERSION >= 6
-  this->AllocateOutputData(data, outInfo, extent);
+    this->AllocateOutputData(data, outInfo, extent);
 #else
-  this->AllocateOutputData(data, extent);
+    this->AllocateOutputData(data, extent);
 #endif
+    }
 
   data->GetPointData()->GetScalars()->SetName("NIFTI");
 
@@ -1204,19 +1605,55 @@ int vtkNIFTIReader::RequestData(
   const char *uimgname = imgname;
 #endif
 
+  // try to memory-map the file if requested, so that the update extent
+  // can be copied directly out of the page cache
+  vtkDICOMFile *mapFile = 0;
+  const unsigned char *mapData = 0;
+  vtkDICOMFile::Size mapSize = 0;
+  vtkDICOMFile::Size mapOffset = 0;
+  if (this->MemoryMapping && imgname)
+    {
+    mapFile = new vtkDICOMFile(imgname, vtkDICOMFile::In);
+    if (mapFile->GetError() == 0)
+      {
+      mapSize = mapFile->GetSize();
+      mapData = mapFile->Map(mapSize);
+      }
+    if (mapData && mapSize >= 2 &&
+        mapData[0] == 0x1f && mapData[1] == 0x8b)
+      {
+      // the file is gzip-compressed, mapping it would be useless
+      mapFile->Unmap();
+      mapData = 0;
+      }
+    if (mapData == 0)
+      {
+      // fall back to reading through zlib
+      delete mapFile;
+      mapFile = 0;
+      }
+    }
+
   gzFile file = 0;
-  if (uimgname)
+  if (uimgname && mapData == 0)
     {
     file = gzopen(uimgname, "rb");
     }
 
-  delete [] imgname;
-
-  if (!file)
+  if (!file && mapData == 0)
     {
+    delete [] imgname;
     return 0;
     }
 
+#if ZLIB_VERNUM >= 0x1240
+  // use a larger internal buffer for faster decompression
+  if (file)
+    {
+    gzbuffer(file, 65536);
+    }
+#endif
+
   // check if planar RGB is applicable (Analyze only)
   bool planarRGB = (this->PlanarRGB &&
                     (this->NIFTIHeader->GetDataType() == NIFTI_TYPE_RGB24 ||
@@ -1301,9 +1738,58 @@ int vtkNIFTIReader::RequestData(
   offset += extent[2]*fileRowIncr;
   offset += extent[4]*fileSliceIncr;
 
+  // If the file is compressed as a series of size-tagged gzip members
+  // (which is how vtkNIFTIWriter writes it when ParallelCompression is
+  // on), then begin decompression at the member that contains the
+  // start of the update extent, rather than decompressing and
+  // discarding everything that precedes it.  This is only worthwhile
+  // when the seek is longer than the data blocks that the members
+  // hold, which are around two mebibytes each.
+  if (file && imgname && offset > 2097152)
+    {
+    z_off_t memberStart, memberOffset;
+    if (vtkNIFTIReaderFindMember(imgname, offset,
+                                 &memberStart, &memberOffset))
+      {
+      gzFile mfile = vtkNIFTIReaderOpenAtOffset(imgname, memberStart);
+      if (mfile)
+        {
+        gzclose(file);
+        file = mfile;
+#if ZLIB_VERNUM >= 0x1240
+        gzbuffer(file, 65536);
+#endif
+        offset -= memberOffset;
+        }
+      }
+    }
+
+  delete [] imgname;
+  imgname = 0;
+
   // read the data one row at a time, do planar-to-packed conversion
   // of vector components if NIFTI file has a vector dimension
   int rowSize = fileVoxelIncr/scalarSize*outSizeX;
+
+  // read multiple rows at a time, if the rows are contiguous in both
+  // the file and the output
+  int rowsPerRead = 1;
+  if (vectorDim == 1 && !planarRGB &&
+      fileRowIncr == outSizeX*fileVoxelIncr)
+    {
+    // cap the size of a single read at sixteen mebibytes
+    rowsPerRead = static_cast<int>(16777216/
+      (static_cast<size_t>(rowSize)*scalarSize));
+    if (rowsPerRead < 1)
+      {
+      rowsPerRead = 1;
+      }
+    if (rowsPerRead > outSizeY)
+      {
+      rowsPerRead = outSizeY;
+      }
+    }
+
   int t = 0; // counter for time
   int c = 0; // counter for vector components
   int j = 0; // counter for rows
@@ -1312,49 +1798,95 @@ int vtkNIFTIReader::RequestData(
   unsigned char *ptr = dataPtr;
 
   int errorCode = 0;
+  bool done = false;
+
+  if (vectorDim == 1 && !planarRGB &&
+      fileRowIncr == outSizeX*fileVoxelIncr &&
+      filePlaneIncr == outSizeY*fileRowIncr)
+    {
+    // the update extent is contiguous within the file, so the row loop
+    // below can be bypassed in favor of large multi-slice reads (any
+    // slice-order reversal is done in place, chunk by chunk)
+    vtkIdType sliceSize = scalarSize*numComponents;
+    sliceSize *= outSizeX;
+    sliceSize *= outSizeY;
+    errorCode = vtkNIFTIReaderReadContiguous(
+      this, file, mapData, mapSize, mapOffset,
+      offset, dataPtr - sliceOffset*(outSizeZ - 1), sliceSize,
+      outSizeZ, (sliceOffset != 0), swapBytes, scalarSize);
+    done = true;
+    }
 
-  while (!this->AbortExecute)
+  while (!done && !this->AbortExecute)
     {
     if (offset)
       {
-      int rval = gzseek(file, offset, SEEK_CUR);
-      if (rval == -1)
+      if (mapData)
         {
-        errorCode = vtkErrorCode::FileFormatError;
-        if (gzeof(file))
+        mapOffset += offset;
+        }
+      else
+        {
+        int rval = gzseek(file, offset, SEEK_CUR);
+        if (rval == -1)
           {
-          errorCode = vtkErrorCode::PrematureEndOfFileError;
+          errorCode = vtkErrorCode::FileFormatError;
+          if (gzeof(file))
+            {
+            errorCode = vtkErrorCode::PrematureEndOfFileError;
+            }
+          break;
           }
-        break;
         }
       }
 
+    int rowsToRead = rowsPerRead;
+    if (rowsToRead > outSizeY - j)
+      {
+      rowsToRead = outSizeY - j;
+      }
+
     if (vectorDim == 1 && !planarRGB)
       {
       // read directly into the output instead of into a buffer
       rowBuffer = ptr;
       }
 
-    int code = gzread(file, rowBuffer, rowSize*scalarSize);
-    if (code != rowSize*scalarSize)
+    int readSize = rowsToRead*rowSize*scalarSize;
+    if (mapData)
       {
-      errorCode = vtkErrorCode::FileFormatError;
-      if (gzeof(file))
+      if (mapOffset + readSize > mapSize)
         {
         errorCode = vtkErrorCode::PrematureEndOfFileError;
+        break;
+        }
+      memcpy(rowBuffer, mapData + mapOffset, readSize);
+      mapOffset += readSize;
+      }
+    else
+      {
+      int code = gzread(file, rowBuffer, readSize);
+      if (code != readSize)
+        {
+        errorCode = vtkErrorCode::FileFormatError;
+        if (gzeof(file))
+          {
+          errorCode = vtkErrorCode::PrematureEndOfFileError;
+          }
+        break;
         }
-      break;
       }
 
     if (swapBytes != 0 && scalarSize > 1)
       {
-      vtkByteSwap::SwapVoidRange(rowBuffer, rowSize, scalarSize);
+      vtkByteSwap::SwapVoidRange(rowBuffer, rowsToRead*rowSize, scalarSize);
       }
 
     if (vectorDim == 1 && !planarRGB)
       {
       // advance the pointer to the next row
-      ptr += outSizeX*numComponents*scalarSize;
+      ptr += static_cast<vtkIdType>(rowsToRead)*
+             outSizeX*numComponents*scalarSize;
       rowBuffer = 0;
       }
     else
@@ -1372,7 +1904,8 @@ int vtkNIFTIReader::RequestData(
         }
       }
 
-    if (++count % target == 0)
+    count += rowsToRead;
+    if (count/target != (count - rowsToRead)/target)
       {
       this->UpdateProgress(0.02*count/target);
       }
@@ -1380,7 +1913,8 @@ int vtkNIFTIReader::RequestData(
     // offset to skip unread sections of the file, for when
     // the update extent is less than the whole extent
     offset = fileRowIncr - outSizeX*fileVoxelIncr;
-    if (++j == outSizeY)
+    j += rowsToRead;
+    if (j == outSizeY)
       {
       j = 0;
       offset += filePlaneIncr - outSizeY*fileRowIncr;
@@ -1425,7 +1959,15 @@ int vtkNIFTIReader::RequestData(
     delete [] rowBuffer;
     }
 
-  gzclose(file);
+  if (mapFile)
+    {
+    mapFile->Unmap();
+    delete mapFile;
+    }
+  else
+    {
+    gzclose(file);
+    }
 
   if (errorCode)
     {
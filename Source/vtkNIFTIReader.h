@@ -101,6 +101,52 @@ public:
   vtkSetMacro(PlanarRGB, bool);
   vtkBooleanMacro(PlanarRGB, bool);
 
+  // Description:
+  // Use memory mapping to read uncompressed files (default: Off).
+  // The voxel section of the file is mapped into memory and the update
+  // extent is copied directly out of the page cache, instead of being
+  // read row-by-row through a file descriptor.  This is most useful
+  // when reading many sub-volumes from large uncompressed files.  It
+  // is ignored for compressed (.gz) files, and the reader silently
+  // falls back to regular reads if the mapping fails.
+  vtkGetMacro(MemoryMapping, int);
+  vtkSetMacro(MemoryMapping, int);
+  vtkBooleanMacro(MemoryMapping, int);
+
+  // Description:
+  // Allocate the output voxels in a file-backed scratch mapping
+  // (default: Off).  This allows a volume that is larger than the
+  // physical memory to be read, with the operating system paging
+  // the voxels to and from the disk as they are accessed.  The
+  // scratch file is created in ScratchDirectory and is reclaimed
+  // automatically when the output data is released.  If the scratch
+  // file cannot be created, then a warning is generated and ordinary
+  // memory is used instead.
+  vtkGetMacro(FileBackedOutput, int);
+  vtkSetMacro(FileBackedOutput, int);
+  vtkBooleanMacro(FileBackedOutput, int);
+
+  // Description:
+  // The directory for scratch files (default: the system temporary
+  // directory).  This is only used if FileBackedOutput is On.  It
+  // should be on a storage device with enough free space to hold
+  // the full output volume.
+  vtkSetStringMacro(ScratchDirectory);
+  vtkGetStringMacro(ScratchDirectory);
+
+  // Description:
+  // Request large ("huge") page backing for the output (default: Off).
+  // When this is on, the output voxels are allocated with an
+  // allocator that asks the operating system to back the buffer with
+  // large pages, which reduces address-translation overhead when a
+  // multi-gigabyte volume is swept by later processing passes.  The
+  // request is a hint: if large pages are not available, ordinary
+  // pages are silently used instead.  This option is ignored when
+  // FileBackedOutput is On.
+  vtkGetMacro(HugePages, int);
+  vtkSetMacro(HugePages, int);
+  vtkBooleanMacro(HugePages, int);
+
   // Description:
   // QFac gives the slice order in the NIFTI file versus the VTK image.
   // If QFac is -1, then the VTK slice index J is related to the NIFTI
@@ -218,6 +264,19 @@ protected:
   // Use planar RGB instead of the default (packed).
   bool PlanarRGB;
 
+  // Description:
+  // Use memory mapping for uncompressed files.
+  int MemoryMapping;
+
+  // Description:
+  // Allocate the output in a file-backed scratch mapping.
+  int FileBackedOutput;
+  char *ScratchDirectory;
+
+  // Description:
+  // Whether to request large pages for the output buffer.
+  int HugePages;
+
 private:
   vtkNIFTIReader(const vtkNIFTIReader&);  // Not implemented.
   void operator=(const vtkNIFTIReader&);  // Not implemented.
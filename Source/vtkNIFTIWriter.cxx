@@ -18,6 +18,8 @@
 #include "vtkNIFTIReader.h"
 #include "vtkImageData.h"
 #include "vtkPointData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -26,6 +28,7 @@
 #include "vtkMatrix4x4.h"
 #include "vtkMath.h"
 #include "vtkCommand.h"
+#include "vtkMultiThreader.h"
 #include "vtkVersion.h"
 
 // For removing file if write failed
@@ -58,11 +61,14 @@
 #define gzopen gzopen_w
 #define fopen _wfopen
 #define NIFTI_FILE_MODE L"wb"
+#define NIFTI_FILE_APPEND_MODE L"ab"
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_APPEND_MODE "ab"
 #endif
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_APPEND_MODE "ab"
 #endif
 
 vtkStandardNewMacro(vtkNIFTIWriter);
@@ -70,6 +76,165 @@ vtkCxxSetObjectMacro(vtkNIFTIWriter,QFormMatrix,vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkNIFTIWriter,SFormMatrix,vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkNIFTIWriter,NIFTIHeader,vtkNIFTIHeader);
 
+//----------------------------------------------------------------------------
+// The file handles of a streamed write, kept open between the slabs.
+struct vtkNIFTIWriterStream
+{
+  gzFile File;
+  FILE *UFile;
+};
+
+//----------------------------------------------------------------------------
+// Support for parallel compression.  The image data is divided into
+// blocks that are compressed concurrently, and each block becomes an
+// independent gzip member in the output file.  The gzip format allows
+// members to be concatenated, and decompressors treat the concatenation
+// as a single stream.
+
+// The description of one block of data to be compressed.
+struct vtkNIFTIWriterBlock
+{
+  unsigned char *Input;
+  size_t InputSize;
+  unsigned char *Output;
+  size_t OutputSize;
+  size_t OutputAlloc;
+  int Failed;
+};
+
+// The information to be shared by the compression threads.
+struct vtkNIFTIWriterBlockSet
+{
+  vtkNIFTIWriterBlock *Blocks;
+  int NumberOfBlocks;
+};
+
+// Compress one block of data as a complete gzip member.  Each member
+// is tagged with a gzip "extra" subfield (id "VK") that records the
+// compressed and uncompressed sizes of the member, so that a reader
+// can hop from member to member without decompressing them, and can
+// begin decompression at the member that contains the data it wants
+// (see vtkNIFTIReaderFindMember in vtkNIFTIReader.cxx).  Decompressors
+// that do not know the subfield simply ignore it.
+static int vtkNIFTIWriterCompressBlock(vtkNIFTIWriterBlock *block)
+{
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+  // windowBits of "15 + 16" asks for a gzip header and trailer
+  if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+    return 0;
+    }
+#if ZLIB_VERNUM >= 0x1240
+  // the subfield id, the subfield length, a placeholder for the
+  // compressed size, and the uncompressed size
+  unsigned char extra[12];
+  extra[0] = 'V';
+  extra[1] = 'K';
+  extra[2] = 8;
+  extra[3] = 0;
+  extra[4] = 0;
+  extra[5] = 0;
+  extra[6] = 0;
+  extra[7] = 0;
+  size_t usize = block->InputSize;
+  extra[8] = static_cast<unsigned char>(usize);
+  extra[9] = static_cast<unsigned char>(usize >> 8);
+  extra[10] = static_cast<unsigned char>(usize >> 16);
+  extra[11] = static_cast<unsigned char>(usize >> 24);
+  gz_header head;
+  memset(&head, 0, sizeof(head));
+  head.os = 255;
+  head.extra = extra;
+  head.extra_len = 12;
+  deflateSetHeader(&strm, &head);
+#endif
+  strm.next_in = block->Input;
+  strm.avail_in = static_cast<uInt>(block->InputSize);
+  strm.next_out = block->Output;
+  strm.avail_out = static_cast<uInt>(block->OutputAlloc);
+  int code = deflate(&strm, Z_FINISH);
+  block->OutputSize = strm.total_out;
+  deflateEnd(&strm);
+#if ZLIB_VERNUM >= 0x1240
+  if (code == Z_STREAM_END)
+    {
+    // patch the final compressed size of the member into the subfield,
+    // which sits at a fixed position: a 10-byte fixed header, a 2-byte
+    // extra length, and then the 4-byte subfield header
+    size_t csize = block->OutputSize;
+    block->Output[16] = static_cast<unsigned char>(csize);
+    block->Output[17] = static_cast<unsigned char>(csize >> 8);
+    block->Output[18] = static_cast<unsigned char>(csize >> 16);
+    block->Output[19] = static_cast<unsigned char>(csize >> 24);
+    }
+#endif
+  return (code == Z_STREAM_END);
+}
+
+// The method that is executed by each of the compression threads,
+// the blocks are distributed among the threads round-robin.
+static VTK_THREAD_RETURN_TYPE vtkNIFTIWriterCompressorThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkNIFTIWriterBlockSet *blockSet =
+    static_cast<vtkNIFTIWriterBlockSet *>(ti->UserData);
+
+  for (int i = ti->ThreadID; i < blockSet->NumberOfBlocks;
+       i += ti->NumberOfThreads)
+    {
+    vtkNIFTIWriterBlock *block = &blockSet->Blocks[i];
+    if (!vtkNIFTIWriterCompressBlock(block))
+      {
+      block->Failed = 1;
+      }
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// Compress a set of blocks concurrently and append them to the file.
+// Returns false if compression failed or if the disk is full.
+static bool vtkNIFTIWriterCompressAndWrite(
+  vtkMultiThreader *threader, vtkNIFTIWriterBlock *blocks, int n,
+  FILE *ufile)
+{
+  for (int i = 0; i < n; i++)
+    {
+    blocks[i].Failed = 0;
+    }
+
+  if (n > 1)
+    {
+    vtkNIFTIWriterBlockSet blockSet;
+    blockSet.Blocks = blocks;
+    blockSet.NumberOfBlocks = n;
+    threader->SetSingleMethod(vtkNIFTIWriterCompressorThread, &blockSet);
+    threader->SingleMethodExecute();
+    }
+  else if (n == 1 && !vtkNIFTIWriterCompressBlock(&blocks[0]))
+    {
+    blocks[0].Failed = 1;
+    }
+
+  for (int i = 0; i < n; i++)
+    {
+    if (blocks[i].Failed)
+      {
+      return false;
+      }
+    size_t m = fwrite(blocks[i].Output, 1, blocks[i].OutputSize, ufile);
+    if (m < blocks[i].OutputSize)
+      {
+      return false;
+      }
+    }
+
+  return true;
+}
+
 //----------------------------------------------------------------------------
 vtkNIFTIWriter::vtkNIFTIWriter()
 {
@@ -89,6 +254,10 @@ vtkNIFTIWriter::vtkNIFTIWriter()
   this->Description = 0;
   // Planar RGB (NIFTI doesn't allow this, it's here for Analyze)
   this->PlanarRGB = false;
+  this->ParallelCompression = 0;
+  this->NumberOfCompressionThreads = 0;
+  this->Streaming = 0;
+  this->Stream = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -111,6 +280,19 @@ vtkNIFTIWriter::~vtkNIFTIWriter()
     this->NIFTIHeader->Delete();
     }
   delete [] this->Description;
+  if (this->Stream)
+    {
+    // close the files of an abandoned streamed write
+    if (this->Stream->File)
+      {
+      gzclose(this->Stream->File);
+      }
+    if (this->Stream->UFile)
+      {
+      fclose(this->Stream->UFile);
+      }
+    delete this->Stream;
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -171,6 +353,54 @@ void vtkNIFTIWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NIFTIHeader:" << (this->NIFTIHeader ? "\n" : " (none)\n");
   os << indent << "NIFTIVersion: " << this->NIFTIVersion << "\n";
   os << indent << "PlanarRGB: " << (this->PlanarRGB ? "On\n" : "Off\n");
+  os << indent << "ParallelCompression: "
+     << (this->ParallelCompression ? "On\n" : "Off\n");
+  os << indent << "NumberOfCompressionThreads: "
+     << this->NumberOfCompressionThreads << "\n";
+  os << indent << "Streaming: " << (this->Streaming ? "On\n" : "Off\n");
+}
+
+//----------------------------------------------------------------------------
+int vtkNIFTIWriter::CanDescribeOrientation(
+  vtkMatrix4x4 *matrix, int useQForm, int useSForm)
+{
+  if (!useQForm && !useSForm)
+    {
+    // with no qform and no sform, the memory order is all there is
+    return 0;
+    }
+  if (matrix == 0 || useSForm)
+    {
+    // the sform is a full affine matrix, it can record anything
+    return 1;
+    }
+
+  // the qform is stored as a quaternion, so the matrix must be a
+  // proper rotation: check that the rows are orthonormal and that
+  // the determinant is positive
+  double rmat[3][3];
+  for (int i = 0; i < 3; i++)
+    {
+    for (int j = 0; j < 3; j++)
+      {
+      rmat[i][j] = matrix->GetElement(i, j);
+      }
+    }
+  for (int i = 0; i < 3; i++)
+    {
+    for (int j = i; j < 3; j++)
+      {
+      double dot = (rmat[i][0]*rmat[j][0] +
+                    rmat[i][1]*rmat[j][1] +
+                    rmat[i][2]*rmat[j][2]);
+      double expected = (i == j ? 1.0 : 0.0);
+      if (fabs(dot - expected) > 1e-6)
+        {
+        return 0;
+        }
+      }
+    }
+  return (vtkMath::Determinant3x3(rmat) > 0.0);
 }
 
 //----------------------------------------------------------------------------
@@ -624,6 +854,27 @@ int vtkNIFTIWriter::RequestData(
   int extent[6];
   info->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
 
+  // check whether this is one slab of a streamed write
+  int dataExtent[6];
+  data->GetExtent(dataExtent);
+  bool streaming = (dataExtent[4] > extent[4] || dataExtent[5] < extent[5]);
+  bool lastSlab = (dataExtent[5] >= extent[5]);
+  if (streaming &&
+      (data->GetNumberOfScalarComponents() != 1 ||
+       this->TimeDimension > 1 || this->QFac < 0 ||
+       dataExtent[0] != extent[0] || dataExtent[1] != extent[1] ||
+       dataExtent[2] != extent[2] || dataExtent[3] != extent[3]))
+    {
+    vtkErrorMacro("A streamed write requires whole slices of a volume "
+                  "with a single component, in forward slice order.");
+    return 0;
+    }
+  if (this->Stream == 0 && dataExtent[4] > extent[4])
+    {
+    vtkErrorMacro("A streamed write must begin with the first slice.");
+    return 0;
+    }
+
   // use compression if name ends in .gz
   bool isCompressed = false;
   size_t n = strlen(filename);
@@ -649,11 +900,10 @@ int vtkNIFTIWriter::RequestData(
     singleFile = false;
     }
 
-  // generate the header information
-  if (this->GenerateHeader(info, singleFile) == 0)
-    {
-    return 0;
-    }
+  // when parallel compression is selected, the image data is written
+  // as a series of gzip members that are compressed concurrently and
+  // then appended to the file as raw bytes
+  bool parallelCompression = (isCompressed && this->ParallelCompression != 0);
 
   // if file is not .nii, then get .hdr and .img filenames
   char *hdrname = vtkNIFTIWriter::ReplaceExtension(
@@ -661,135 +911,174 @@ int vtkNIFTIWriter::RequestData(
   char *imgname = vtkNIFTIWriter::ReplaceExtension(
     filename, ".hdr", ".img");
 
-  vtkDebugMacro(<< "Writing NIFTI file " << hdrname);
+  gzFile file = 0;
+  FILE *ufile = 0;
 
-  // get either a NIFTIv1 or a NIFTIv2 header
-  nifti_1_header hdr1;
-  nifti_2_header hdr2;
-  void *hdrptr = 0;
-  size_t hdrsize = 0;
-  int version = this->OwnHeader->GetMagic()[2] - '0';
-  if (version == 2)
+  if (this->Stream)
     {
-    this->OwnHeader->GetHeader(&hdr2);
-    hdrptr = &hdr2;
-    hdrsize = hdr2.sizeof_hdr;
+    // resume the streamed write with the files that were left open
+    // by the previous slab
+    file = this->Stream->File;
+    ufile = this->Stream->UFile;
+    delete this->Stream;
+    this->Stream = 0;
     }
   else
     {
-    this->OwnHeader->GetHeader(&hdr1);
-    hdrptr = &hdr1;
-    hdrsize = hdr1.sizeof_hdr;
-    if (extent[1] - extent[0] + 1 > VTK_SHORT_MAX ||
-        extent[3] - extent[2] + 1 > VTK_SHORT_MAX ||
-        extent[5] - extent[4] + 1 > VTK_SHORT_MAX)
+    // generate the header information
+    if (this->GenerateHeader(info, singleFile) == 0)
       {
-      vtkErrorMacro("Image too large to store in NIFTI-1 format");
+      delete [] hdrname;
+      delete [] imgname;
       return 0;
       }
-    }
 
-#if _WIN32 
-  vtkDICOMFilePath fph(hdrname);
-  vtkDICOMFilePath fpi(imgname);
+    vtkDebugMacro(<< "Writing NIFTI file " << hdrname);
+
+    // get either a NIFTIv1 or a NIFTIv2 header
+    nifti_1_header hdr1;
+    nifti_2_header hdr2;
+    void *hdrptr = 0;
+    size_t hdrsize = 0;
+    int version = this->OwnHeader->GetMagic()[2] - '0';
+    if (version == 2)
+      {
+      this->OwnHeader->GetHeader(&hdr2);
+      hdrptr = &hdr2;
+      hdrsize = hdr2.sizeof_hdr;
+      }
+    else
+      {
+      this->OwnHeader->GetHeader(&hdr1);
+      hdrptr = &hdr1;
+      hdrsize = hdr1.sizeof_hdr;
+      if (extent[1] - extent[0] + 1 > VTK_SHORT_MAX ||
+          extent[3] - extent[2] + 1 > VTK_SHORT_MAX ||
+          extent[5] - extent[4] + 1 > VTK_SHORT_MAX)
+        {
+        vtkErrorMacro("Image too large to store in NIFTI-1 format");
+        delete [] hdrname;
+        delete [] imgname;
+        return 0;
+        }
+      }
+
+#if _WIN32
+    vtkDICOMFilePath fph(hdrname);
+    vtkDICOMFilePath fpi(imgname);
 #if VTK_MAJOR_VERSION < 7
-  // convert to the local character set
-  const char *uhdrname = fph.Local();
-  const char *uimgname = fpi.Local();
+    // convert to the local character set
+    const char *uhdrname = fph.Local();
+    const char *uimgname = fpi.Local();
 #else
-  // use wide character
-  const wchar_t *uhdrname = fph.Wide();
-  const wchar_t *uimgname = fpi.Wide();
+    // use wide character
+    const wchar_t *uhdrname = fph.Wide();
+    const wchar_t *uimgname = fpi.Wide();
 #endif
 #else
-  const char *uhdrname = hdrname;
-  const char *uimgname = imgname;
+    const char *uhdrname = hdrname;
+    const char *uimgname = imgname;
 #endif
 
-  // try opening file
-  gzFile file = 0;
-  FILE *ufile = 0;
-  if (uhdrname && uimgname)
-    {
-    if (isCompressed)
+    // try opening file
+    if (uhdrname && uimgname)
       {
-      file = gzopen(uhdrname, "wb");
+      if (isCompressed)
+        {
+        file = gzopen(uhdrname, "wb");
+        }
+      else
+        {
+        ufile = fopen(uhdrname, NIFTI_FILE_MODE);
+        }
       }
-    else
+
+    if (!file && !ufile)
       {
-      ufile = fopen(uhdrname, NIFTI_FILE_MODE);
+      delete [] hdrname;
+      delete [] imgname;
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      return 0;
       }
-    }
-
-  if (!file && !ufile)
-    {
-    delete [] hdrname;
-    delete [] imgname;
-    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
-    return 0;
-    }
-
-  this->InvokeEvent(vtkCommand::StartEvent);
-  this->UpdateProgress(0.0);
 
-  // write the header
-  size_t bytesWritten = 0;
-  if (isCompressed)
-    {
-    unsigned int hsize = static_cast<unsigned int>(hdrsize);
-    int code = gzwrite(file, hdrptr, hsize);
-    bytesWritten = (code < 0 ? 0 : code);
-    }
-  else
-    {
-    bytesWritten = fwrite(hdrptr, 1, hdrsize, ufile);
-    }
-  if (bytesWritten < hdrsize)
-    {
-    this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
-    }
+    this->InvokeEvent(vtkCommand::StartEvent);
+    this->UpdateProgress(0.0);
 
-  if (singleFile && !this->ErrorCode)
-    {
-    // write the padding between the header and the image to the .nii file
-    size_t padsize = (static_cast<size_t>(this->OwnHeader->GetVoxOffset()) -
-                      hdrsize);
-    char *padding = new char[padsize];
-    memset(padding, '\0', padsize);
+    // write the header
+    size_t bytesWritten = 0;
     if (isCompressed)
       {
-      int code = gzwrite(file, padding, static_cast<unsigned int>(padsize));
+      unsigned int hsize = static_cast<unsigned int>(hdrsize);
+      int code = gzwrite(file, hdrptr, hsize);
       bytesWritten = (code < 0 ? 0 : code);
       }
     else
       {
-      bytesWritten = fwrite(padding, 1, padsize, ufile);
+      bytesWritten = fwrite(hdrptr, 1, hdrsize, ufile);
       }
-    delete [] padding;
-    if (bytesWritten < padsize)
+    if (bytesWritten < hdrsize)
       {
       this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
       }
-    }
-  else if (!this->ErrorCode)
-    {
-    // close the .hdr file and open the .img file
-    if (isCompressed)
+
+    if (singleFile && !this->ErrorCode)
       {
-      gzclose(file);
-      file = gzopen(uimgname, "wb");
+      // write the padding between the header and the image to the .nii file
+      size_t padsize = (static_cast<size_t>(this->OwnHeader->GetVoxOffset()) -
+                        hdrsize);
+      char *padding = new char[padsize];
+      memset(padding, '\0', padsize);
+      if (isCompressed)
+        {
+        int code = gzwrite(file, padding, static_cast<unsigned int>(padsize));
+        bytesWritten = (code < 0 ? 0 : code);
+        }
+      else
+        {
+        bytesWritten = fwrite(padding, 1, padsize, ufile);
+        }
+      delete [] padding;
+      if (bytesWritten < padsize)
+        {
+        this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+        }
       }
-    else
+    else if (!this->ErrorCode)
       {
-      fclose(ufile);
-      ufile = fopen(uimgname, NIFTI_FILE_MODE);
+      // close the .hdr file and open the .img file
+      if (isCompressed && !parallelCompression)
+        {
+        gzclose(file);
+        file = gzopen(uimgname, "wb");
+        }
+      else if (isCompressed)
+        {
+        // parallel compression writes raw gzip members with fwrite
+        gzclose(file);
+        file = 0;
+        ufile = fopen(uimgname, NIFTI_FILE_MODE);
+        }
+      else
+        {
+        fclose(ufile);
+        ufile = fopen(uimgname, NIFTI_FILE_MODE);
+        }
       }
-    }
 
-  if (!file && !ufile)
-    {
-    vtkErrorMacro("Cannot open file " << imgname);
-    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    if (singleFile && parallelCompression && !this->ErrorCode)
+      {
+      // finish the gzip member that contains the header, the members
+      // that contain the image data will be appended to it
+      gzclose(file);
+      file = 0;
+      ufile = fopen(uhdrname, NIFTI_FILE_APPEND_MODE);
+      }
+
+    if (!file && !ufile)
+      {
+      vtkErrorMacro("Cannot open file " << imgname);
+      this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      }
     }
 
   // write the image
@@ -806,7 +1095,8 @@ int vtkNIFTIWriter::RequestData(
   int numComponents = data->GetNumberOfScalarComponents();
   int outSizeX = static_cast<int>(this->OwnHeader->GetDim(1));
   int outSizeY = static_cast<int>(this->OwnHeader->GetDim(2));
-  int outSizeZ = static_cast<int>(this->OwnHeader->GetDim(3));
+  // only write the slices that are present in memory
+  int outSizeZ = dataExtent[5] - dataExtent[4] + 1;
   int timeDim = static_cast<int>(this->OwnHeader->GetDim(4));
   int vectorDim = static_cast<int>(this->OwnHeader->GetDim(5));
 
@@ -868,13 +1158,77 @@ int vtkNIFTIWriter::RequestData(
 
   unsigned char *ptr = dataPtr;
 
+  // set up the block buffers and threader for parallel compression
+  vtkMultiThreader *threader = 0;
+  vtkNIFTIWriterBlock *blocks = 0;
+  int numBlocks = 0;
+  int blockIdx = 0;
+  size_t blockSize = 0;
+  size_t blockFill = 0;
+  if (parallelCompression && !this->ErrorCode)
+    {
+    threader = vtkMultiThreader::New();
+    if (this->NumberOfCompressionThreads > 0)
+      {
+      threader->SetNumberOfThreads(this->NumberOfCompressionThreads);
+      }
+    numBlocks = threader->GetNumberOfThreads();
+    // use blocks of around two mebibytes, made up of whole rows
+    size_t rowBytes = static_cast<size_t>(rowSize)*scalarSize;
+    size_t rowsPerBlock = 2097152/rowBytes;
+    if (rowsPerBlock == 0)
+      {
+      rowsPerBlock = 1;
+      }
+    blockSize = rowsPerBlock*rowBytes;
+    // the worst-case compressed size, plus the gzip header and trailer
+    // and the extra subfield that carries the member sizes
+    size_t outputAlloc = compressBound(static_cast<uLong>(blockSize)) + 32;
+    blocks = new vtkNIFTIWriterBlock[numBlocks];
+    for (int bi = 0; bi < numBlocks; bi++)
+      {
+      blocks[bi].Input = new unsigned char[blockSize];
+      blocks[bi].InputSize = 0;
+      blocks[bi].Output = new unsigned char[outputAlloc];
+      blocks[bi].OutputSize = 0;
+      blocks[bi].OutputAlloc = outputAlloc;
+      blocks[bi].Failed = 0;
+      }
+    }
+
+  // write multiple rows at a time, if the rows are contiguous in both
+  // the input and the file (parallel compression always collects the
+  // data one row at a time)
+  int rowsPerWrite = 1;
+  if (!parallelCompression && vectorDim == 1 && !planarRGB && !swapBytes)
+    {
+    // cap the size of a single write at sixteen mebibytes
+    rowsPerWrite = static_cast<int>(16777216/
+      (static_cast<size_t>(rowSize)*scalarSize));
+    if (rowsPerWrite < 1)
+      {
+      rowsPerWrite = 1;
+      }
+    if (rowsPerWrite > outSizeY)
+      {
+      rowsPerWrite = outSizeY;
+      }
+    }
+
   while (!this->AbortExecute && !this->ErrorCode)
     {
+    int rowsToWrite = rowsPerWrite;
+    if (rowsToWrite > outSizeY - j)
+      {
+      rowsToWrite = outSizeY - j;
+      }
+
     if (vectorDim == 1 && !planarRGB && !swapBytes)
       {
       // write directly from input, instead of using a buffer
       rowBuffer = ptr;
-      ptr += outSizeX*numComponents*scalarSize;
+      ptr += static_cast<vtkIdType>(rowsToWrite)*
+             outSizeX*numComponents*scalarSize;
       }
     else
       {
@@ -896,27 +1250,54 @@ int vtkNIFTIWriter::RequestData(
       vtkByteSwap::SwapVoidRange(rowBuffer, rowSize, scalarSize);
       }
 
-    if (isCompressed)
+    size_t writeSize = static_cast<size_t>(rowsToWrite)*rowSize*scalarSize;
+    if (parallelCompression)
+      {
+      // collect the rows into a block, and compress and write the
+      // blocks whenever every block in the set has been filled
+      memcpy(blocks[blockIdx].Input + blockFill, rowBuffer, writeSize);
+      blockFill += writeSize;
+      bytesWritten = writeSize;
+      if (blockFill == blockSize)
+        {
+        blocks[blockIdx].InputSize = blockFill;
+        blockFill = 0;
+        if (++blockIdx == numBlocks)
+          {
+          blockIdx = 0;
+          if (!vtkNIFTIWriterCompressAndWrite(
+                threader, blocks, numBlocks, ufile))
+            {
+            bytesWritten = 0;
+            }
+          }
+        }
+      }
+    else if (isCompressed)
       {
-      int code = gzwrite(file, rowBuffer, rowSize*scalarSize);
+      int code = gzwrite(file, rowBuffer,
+                         static_cast<unsigned int>(writeSize));
       bytesWritten = (code < 0 ? 0 : code);
       }
     else
       {
-      bytesWritten = fwrite(rowBuffer, scalarSize, rowSize, ufile)*scalarSize;
+      bytesWritten = fwrite(rowBuffer, scalarSize,
+                            rowsToWrite*rowSize, ufile)*scalarSize;
       }
-    if (bytesWritten < static_cast<size_t>(rowSize*scalarSize))
+    if (bytesWritten < writeSize)
       {
       this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
       break;
       }
 
-    if (++count % target == 0)
+    count += rowsToWrite;
+    if (count/target != (count - rowsToWrite)/target)
       {
       this->UpdateProgress(0.02*count/target);
       }
 
-    if (++j == outSizeY)
+    j += rowsToWrite;
+    if (j == outSizeY)
       {
       j = 0;
       // back up for next plane (R, G, or B) if planar mode
@@ -954,16 +1335,51 @@ int vtkNIFTIWriter::RequestData(
       }
     }
 
+  if (blocks)
+    {
+    // compress and write any blocks that remain
+    if (!this->AbortExecute && !this->ErrorCode)
+      {
+      blocks[blockIdx].InputSize = blockFill;
+      int n = blockIdx + (blockFill > 0 ? 1 : 0);
+      if (n > 0 &&
+          !vtkNIFTIWriterCompressAndWrite(threader, blocks, n, ufile))
+        {
+        this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+        }
+      }
+    for (int bi = 0; bi < numBlocks; bi++)
+      {
+      delete [] blocks[bi].Input;
+      delete [] blocks[bi].Output;
+      }
+    delete [] blocks;
+    threader->Delete();
+    }
+
   if (vectorDim > 1 || swapBytes || planarRGB)
     {
     delete [] rowBuffer;
     }
 
-  if (isCompressed)
+  if (streaming && !lastSlab && !this->AbortExecute && !this->ErrorCode)
+    {
+    // keep the files open, the next slab will continue the stream
+    this->Stream = new vtkNIFTIWriterStream;
+    this->Stream->File = file;
+    this->Stream->UFile = ufile;
+
+    delete [] hdrname;
+    delete [] imgname;
+
+    return 1;
+    }
+
+  if (file)
     {
     gzclose(file);
     }
-  else
+  if (ufile)
     {
     fclose(ufile);
     }
@@ -987,3 +1403,98 @@ int vtkNIFTIWriter::RequestData(
 
   return 1;
 }
+
+//----------------------------------------------------------------------------
+void vtkNIFTIWriter::Write()
+{
+  // call Modified to force update to execute
+  this->Modified();
+  this->UpdateInformation();
+  vtkInformation *inInfo = this->GetExecutive()->GetInputInformation(0, 0);
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+  // streaming in slabs is only possible if the slices are the slowest
+  // varying dimension of the file: the time and the vector dimensions
+  // come after the slices, and a negative qfac reverses the slices
+  bool streamable = (this->Streaming != 0 &&
+                     this->TimeDimension <= 1 &&
+                     this->QFac >= 0 &&
+                     wholeExtent[5] > wholeExtent[4]);
+  int scalarSize = 0;
+  if (streamable)
+    {
+    vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(
+      inInfo, vtkDataObject::FIELD_ASSOCIATION_POINTS,
+      vtkDataSetAttributes::SCALARS);
+    if (scalarInfo == 0 ||
+        scalarInfo->Get(vtkDataObject::FIELD_NUMBER_OF_COMPONENTS()) != 1)
+      {
+      streamable = false;
+      }
+    else
+      {
+      scalarSize = vtkDataArray::GetDataTypeSize(
+        scalarInfo->Get(vtkDataObject::FIELD_ARRAY_TYPE()));
+      }
+    }
+
+  if (streamable)
+    {
+    // write the data in slabs of roughly sixteen mebibytes
+    vtkIdType sliceSize = scalarSize;
+    sliceSize *= wholeExtent[1] - wholeExtent[0] + 1;
+    sliceSize *= wholeExtent[3] - wholeExtent[2] + 1;
+    int slabSlices = static_cast<int>(16777216/sliceSize);
+    if (slabSlices < 1)
+      {
+      slabSlices = 1;
+      }
+
+    int extent[6] = {
+      wholeExtent[0], wholeExtent[1],
+      wholeExtent[2], wholeExtent[3],
+      wholeExtent[4], wholeExtent[5]
+    };
+    for (int i = wholeExtent[4]; i <= wholeExtent[5]; i += slabSlices)
+      {
+      // set the update extent to the slab
+      extent[4] = i;
+      extent[5] = i + slabSlices - 1;
+      if (extent[5] > wholeExtent[5])
+        {
+        extent[5] = wholeExtent[5];
+        }
+      this->Modified();
+      inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+                  extent, 6);
+      this->Update();
+      if (this->AbortExecute || this->ErrorCode)
+        {
+        break;
+        }
+      }
+
+    if (this->Stream)
+      {
+      // an interrupted write leaves the files open
+      if (this->Stream->File)
+        {
+        gzclose(this->Stream->File);
+        }
+      if (this->Stream->UFile)
+        {
+        fclose(this->Stream->UFile);
+        }
+      delete this->Stream;
+      this->Stream = 0;
+      }
+    }
+  else
+    {
+    // set update extent to whole extent
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+                wholeExtent, 6);
+    this->Update();
+    }
+}
@@ -35,6 +35,7 @@
 
 class vtkMatrix4x4;
 class vtkNIFTIHeader;
+struct vtkNIFTIWriterStream;
 
 class VTKDICOM_EXPORT vtkNIFTIWriter : public vtkImageWriter
 {
@@ -93,6 +94,46 @@ public:
   vtkSetMacro(PlanarRGB, bool);
   vtkBooleanMacro(PlanarRGB, bool);
 
+  // Description:
+  // Compress the data with multiple threads (default: Off).
+  // When this option is on and the output file ends in ".gz", the image
+  // data is split into blocks that are compressed concurrently and then
+  // written to the file as independent gzip members.  Decompressors
+  // treat the concatenated members as a single stream, so the files can
+  // be read by any gzip-aware software.  The files are slightly larger
+  // than files produced by single-threaded compression.  Each member is
+  // also tagged with its compressed and uncompressed sizes, which lets
+  // vtkNIFTIReader seek to an update extent deep in the volume by
+  // hopping over whole members instead of decompressing them.
+  vtkGetMacro(ParallelCompression, int);
+  vtkSetMacro(ParallelCompression, int);
+  vtkBooleanMacro(ParallelCompression, int);
+
+  // Description:
+  // The number of threads to use for parallel compression (default: 0).
+  // If this is zero, then the number of threads will be equal to the
+  // number of processors.  This option has no effect unless
+  // ParallelCompression is on.
+  vtkGetMacro(NumberOfCompressionThreads, int);
+  vtkSetMacro(NumberOfCompressionThreads, int);
+
+  // Description:
+  // Stream the data to the file in slabs of slices (default: Off).
+  // When this option is on, Write() will request the input volume from
+  // the pipeline as a series of slabs, and will append each slab to the
+  // file as it arrives so that the whole volume never has to be present
+  // in memory at once.  The compression stream is kept open between the
+  // slabs.  Streaming is only possible if the data has a single scalar
+  // component, no time dimension, and a non-negative QFac; otherwise,
+  // the data is requested in a single piece.
+  vtkGetMacro(Streaming, int);
+  vtkSetMacro(Streaming, int);
+  vtkBooleanMacro(Streaming, int);
+
+  // Description:
+  // Write the file to disk.
+  virtual void Write();
+
   // Description:
   // The QFac sets the ordering of the slices in the NIFTI file.
   // If QFac is -1, then the slice ordering in the file will be reversed
@@ -118,6 +159,19 @@ public:
   void SetSFormMatrix(vtkMatrix4x4 *);
   vtkMatrix4x4 *GetSFormMatrix() { return this->SFormMatrix; }
 
+  // Description:
+  // Check whether an orientation can be stored in the header as-is.
+  // The matrix is the direction matrix of the data as it is laid out
+  // in memory, and the flags state whether a qform or sform will be
+  // written.  The sform can record any orientation, but the qform is
+  // stored as a quaternion, so it can only record a matrix that is a
+  // proper rotation (orthonormal, positive determinant).  When this
+  // returns true, a pipeline can skip reordering the voxels into a
+  // canonical memory order and simply record the orientation in the
+  // header, which saves a full repack pass over the volume.
+  static int CanDescribeOrientation(
+    vtkMatrix4x4 *matrix, int useQForm, int useSForm);
+
   // Description:
   // Set the NIFTI header information to use when writing the file.
   // The data dimensions and pixdim from the supplied header will be
@@ -182,6 +236,17 @@ protected:
   // Use planar RGB instead of the default (packed).
   bool PlanarRGB;
 
+  // Description:
+  // Whether to compress the data with multiple threads.
+  int ParallelCompression;
+  int NumberOfCompressionThreads;
+
+  // Description:
+  // Whether to write the data in slabs, and the file handles that a
+  // streamed write keeps open between the slabs.
+  int Streaming;
+  vtkNIFTIWriterStream *Stream;
+
 private:
   vtkNIFTIWriter(const vtkNIFTIWriter&);  // Not implemented.
   void operator=(const vtkNIFTIWriter&);  // Not implemented.
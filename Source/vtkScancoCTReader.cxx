@@ -20,11 +20,14 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkPointData.h"
+#include "vtkCallbackCommand.h"
 #include "vtkDataArray.h"
 #include "vtkStringArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkVersion.h"
 
+#include "vtkDICOMFile.h"
+
 #ifdef _WIN32
 // To allow use of wchar_t paths on Windows
 #include "vtkDICOMFilePath.h"
@@ -42,6 +45,11 @@ vtkScancoCTReader::vtkScancoCTReader()
 {
   this->InitializeHeader();
   this->RawHeader = 0;
+  this->HugePages = 0;
+  this->GenerateLODs = 0;
+
+  // extra output ports for the optional downsampled pyramid
+  this->SetNumberOfOutputPorts(4);
 
   // ISQ uses a lower-left-hand origin
   this->FileLowerLeft = true;
@@ -96,6 +104,14 @@ void vtkScancoCTReader::InitializeHeader()
   this->MuWater = 0;
 
   this->Compression = 0;
+
+  // reading a new header invalidates any saved streaming position
+  this->ResumePosition = 0;
+  this->ResumeSize = 0;
+  this->ResumeSlice = -1;
+  this->ResumeRunLength = 0;
+  this->ResumeValue = 0;
+  this->ResumeFlip = false;
 }
 
 //----------------------------------------------------------------------------
@@ -143,6 +159,9 @@ void vtkScancoCTReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "RescaleSlope: " << this->RescaleSlope << "\n";
   os << indent << "RescaleIntercept: " << this->RescaleIntercept << "\n";
   os << indent << "MuWater: " << this->MuWater << " [cm^-1]\n";
+  os << indent << "HugePages: " << (this->HugePages ? "On\n" : "Off\n");
+  os << indent << "GenerateLODs: "
+     << (this->GenerateLODs ? "On\n" : "Off\n");
 }
 
 //----------------------------------------------------------------------------
@@ -928,49 +947,281 @@ int vtkScancoCTReader::RequestInformation(
   outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
                this->DataExtent, 6);
 
+  // Each level of the downsampled pyramid halves the dimensions and
+  // doubles the spacing, with the origin shifted to the center of the
+  // box of voxels that each downsampled voxel averages.
+  int lodExtent[6];
+  double lodSpacing[3], lodOrigin[3];
+  for (int c = 0; c < 3; c++)
+    {
+    lodExtent[2*c] = this->DataExtent[2*c];
+    lodExtent[2*c+1] = this->DataExtent[2*c+1];
+    lodSpacing[c] = this->DataSpacing[c];
+    lodOrigin[c] = this->DataOrigin[c];
+    }
+  for (int port = 1; port < 4; port++)
+    {
+    for (int c = 0; c < 3; c++)
+      {
+      int n = lodExtent[2*c+1] - lodExtent[2*c] + 1;
+      lodOrigin[c] += 0.5*lodSpacing[c];
+      lodSpacing[c] *= 2;
+      lodExtent[2*c] = 0;
+      lodExtent[2*c+1] = (n + 1)/2 - 1;
+      }
+    vtkInformation *lodInfo = outputVector->GetInformationObject(port);
+    vtkDataObject::SetPointDataActiveScalarInfo(
+      lodInfo, this->DataScalarType, this->NumberOfScalarComponents);
+    lodInfo->Set(vtkDataObject::SPACING(), lodSpacing, 3);
+    lodInfo->Set(vtkDataObject::ORIGIN(), lodOrigin, 3);
+    lodInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
+                 lodExtent, 6);
+    }
+
   return returnValue;
 }
 
 //----------------------------------------------------------------------------
-int vtkScancoCTReader::RequestData(
-  vtkInformation* request,
-  vtkInformationVector** inputVector,
+// Average each 2x2x2 block of input voxels into one output voxel.
+// When a dimension is odd, the voxels at its far edge are counted
+// twice so that every output voxel averages a full block.
+template<class T>
+void vtkScancoCTReaderDownsample(
+  const T *inPtr, const int inDims[3], T *outPtr, const int outDims[3],
+  int numComp)
+{
+  vtkIdType inIncY = static_cast<vtkIdType>(inDims[0])*numComp;
+  vtkIdType inIncZ = inIncY*inDims[1];
+
+  for (int k = 0; k < outDims[2]; k++)
+    {
+    const T *slice0 = inPtr + 2*k*inIncZ;
+    const T *slice1 = slice0 + (2*k + 1 < inDims[2] ? inIncZ : 0);
+    for (int j = 0; j < outDims[1]; j++)
+      {
+      const T *row00 = slice0 + 2*j*inIncY;
+      const T *row01 = row00 + (2*j + 1 < inDims[1] ? inIncY : 0);
+      const T *row10 = slice1 + 2*j*inIncY;
+      const T *row11 = row10 + (2*j + 1 < inDims[1] ? inIncY : 0);
+      for (int i = 0; i < outDims[0]; i++)
+        {
+        vtkIdType t0 = static_cast<vtkIdType>(2*i)*numComp;
+        vtkIdType t1 = t0 + (2*i + 1 < inDims[0] ? numComp : 0);
+        for (int c = 0; c < numComp; c++)
+          {
+          double sum = row00[t0+c] + row00[t1+c] +
+                       row01[t0+c] + row01[t1+c] +
+                       row10[t0+c] + row10[t1+c] +
+                       row11[t0+c] + row11[t1+c];
+          *outPtr++ = static_cast<T>(sum*0.125);
+          }
+        }
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkScancoCTReader::GenerateLODOutputs(
   vtkInformationVector* outputVector)
 {
-  if (this->Compression == 0)
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+  vtkImageData *data = static_cast<vtkImageData *>(
+    outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  // the pyramid is only generated when the full volume was read
+  int extent[6];
+  data->GetExtent(extent);
+  for (int c = 0; c < 6; c++)
     {
-    return this->Superclass::RequestData(request, inputVector, outputVector);
+    if (extent[c] != this->DataExtent[c])
+      {
+      return;
+      }
     }
 
-  // check whether the reader is in an error state
-  if (this->GetErrorCode() != vtkErrorCode::NoError)
+  int scalarType = data->GetScalarType();
+  int numComp = data->GetNumberOfScalarComponents();
+
+  // each level is computed from the one before it, so the full-size
+  // volume is swept only once and the rest of the work is negligible
+  vtkImageData *source = data;
+  for (int port = 1; port < 4; port++)
     {
-    return 0;
+    vtkImageData *lod = static_cast<vtkImageData *>(
+      outputVector->GetInformationObject(port)->Get(
+        vtkDataObject::DATA_OBJECT()));
+
+    int inDims[3], outDims[3];
+    double spacing[3], origin[3];
+    source->GetDimensions(inDims);
+    source->GetSpacing(spacing);
+    source->GetOrigin(origin);
+    for (int c = 0; c < 3; c++)
+      {
+      outDims[c] = (inDims[c] + 1)/2;
+      origin[c] += 0.5*spacing[c];
+      spacing[c] *= 2;
+      }
+
+    lod->SetExtent(0, outDims[0]-1, 0, outDims[1]-1, 0, outDims[2]-1);
+    lod->SetSpacing(spacing);
+    lod->SetOrigin(origin);
+#if VTK_MAJOR_VERSION >= 6
+    lod->AllocateScalars(scalarType, numComp);
+#else
+    lod->SetScalarType(scalarType);
+    lod->SetNumberOfScalarComponents(numComp);
+    lod->AllocateScalars();
+#endif
+    lod->GetPointData()->GetScalars()->SetName("ImageFile");
+
+    void *inPtr = source->GetScalarPointer();
+    void *outPtr = lod->GetScalarPointer();
+    switch (scalarType)
+      {
+      vtkTemplateMacro(
+        vtkScancoCTReaderDownsample(
+          static_cast<VTK_TT *>(inPtr), inDims,
+          static_cast<VTK_TT *>(outPtr), outDims, numComp));
+      }
+
+    source = lod;
     }
+}
 
+//----------------------------------------------------------------------------
+// a record of a large-page allocation that backs an output array
+struct vtkScancoCTReaderBufferInfo
+{
+  void *Pointer;
+  vtkIdType Size;
+};
+
+// called when a large-page output array is deleted, in order to
+// return the memory to the operating system
+static void vtkScancoCTReaderLargePagesDeleted(
+  vtkObject *, unsigned long, void *clientData, void *)
+{
+  vtkScancoCTReaderBufferInfo *binfo =
+    static_cast<vtkScancoCTReaderBufferInfo *>(clientData);
+  vtkDICOMFile::UnmapLargePages(binfo->Pointer, binfo->Size);
+  delete binfo;
+}
+
+// Allocate the output scalars with large-page backing, which reduces
+// address-translation overhead for very large volumes.  The return
+// value is false if the memory could not be allocated.
+static bool vtkScancoCTReaderAllocateLargePages(
+  vtkImageData *data, int extent[6], int scalarType, int numComponents)
+{
+  vtkIdType numValues = numComponents;
+  numValues *= (extent[1] - extent[0] + 1);
+  numValues *= (extent[3] - extent[2] + 1);
+  numValues *= (extent[5] - extent[4] + 1);
+  vtkIdType numBytes = numValues*vtkDataArray::GetDataTypeSize(scalarType);
+  void *ptr = vtkDICOMFile::MapLargePages(numBytes);
+  if (ptr == 0)
+    {
+    return false;
+    }
+  data->SetExtent(extent);
+  vtkDataArray *scalars = vtkDataArray::CreateDataArray(scalarType);
+  scalars->SetNumberOfComponents(numComponents);
+  scalars->SetVoidArray(ptr, numValues, 1);
+  // release the memory when the array is deleted
+  vtkScancoCTReaderBufferInfo *binfo = new vtkScancoCTReaderBufferInfo;
+  binfo->Pointer = ptr;
+  binfo->Size = numBytes;
+  vtkCallbackCommand *cc = vtkCallbackCommand::New();
+  cc->SetCallback(vtkScancoCTReaderLargePagesDeleted);
+  cc->SetClientData(binfo);
+  scalars->AddObserver(vtkCommand::DeleteEvent, cc);
+  cc->Delete();
+  data->GetPointData()->SetScalars(scalars);
+  scalars->Delete();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkScancoCTReader::RequestData(
+  vtkInformation* request,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
   // which output port did the request come from
   int outputPort =
     request->Get(vtkDemandDrivenPipeline::FROM_OUTPUT_PORT());
 
-  // for now, this reader has only one output
+  // the pyramid outputs are filled in while output zero is read
   if (outputPort > 0)
     {
     return 1;
     }
 
+  if (this->Compression == 0)
+    {
+#if VTK_MAJOR_VERSION >= 6
+    if (this->HugePages)
+      {
+      // pre-allocate the output with large-page backing: the base
+      // class reuses a scalar array whose data type, component count,
+      // and size already match the update extent, so the voxels are
+      // read directly into this buffer
+      vtkInformation *outInfo = outputVector->GetInformationObject(0);
+      vtkImageData *data = static_cast<vtkImageData *>(
+        outInfo->Get(vtkDataObject::DATA_OBJECT()));
+      int extent[6];
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+                   extent);
+      vtkScancoCTReaderAllocateLargePages(
+        data, extent, this->DataScalarType, this->NumberOfScalarComponents);
+      }
+#endif
+    int rval =
+      this->Superclass::RequestData(request, inputVector, outputVector);
+    if (rval && this->GenerateLODs)
+      {
+      this->GenerateLODOutputs(outputVector);
+      }
+    return rval;
+    }
+
+  // check whether the reader is in an error state
+  if (this->GetErrorCode() != vtkErrorCode::NoError)
+    {
+    return 0;
+    }
+
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
 
-  int extent[6];
-  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+  int extent[6], wholeExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
+
+  // the compressed formats store whole slices, so only the z range of
+  // the update extent can be used to subset the data that is produced
+  extent[0] = wholeExtent[0];
+  extent[1] = wholeExtent[1];
+  extent[2] = wholeExtent[2];
+  extent[3] = wholeExtent[3];
 
   // get the data object, allocate memory
   vtkImageData *data =
     static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  bool allocated = false;
+  if (this->HugePages)
+    {
+    allocated = vtkScancoCTReaderAllocateLargePages(
+      data, extent, this->DataScalarType, this->NumberOfScalarComponents);
+    }
+  if (!allocated)
+    {
 #if VTK_MAJOR_VERSION >= 6
-  this->AllocateOutputData(data, outInfo, extent);
+    this->AllocateOutputData(data, outInfo, extent);
 #else
-  this->AllocateOutputData(data, extent);
+    this->AllocateOutputData(data, extent);
 #endif
+    }
 
   data->GetPointData()->GetScalars()->SetName("ImageFile");
 
@@ -1014,27 +1265,70 @@ int vtkScancoCTReader::RequestData(
     intSize = 8;
     }
 
-  // Dimensions of the data
+  // Dimensions of the data to produce
   int xsize = (extent[1] - extent[0] + 1);
   int ysize = (extent[3] - extent[2] + 1);
   int zsize = (extent[5] - extent[4] + 1);
+  int wholeZSize = (wholeExtent[5] - wholeExtent[4] + 1);
   size_t outSize = xsize;
   outSize *= ysize;
   outSize *= zsize;
 
-  // For the input (compressed) data
-  char *input = 0;
-  size_t size = 0;
+  // voxels that precede the first requested slice
+  size_t skipSize = xsize;
+  skipSize *= ysize;
+  skipSize *= (extent[4] - wholeExtent[4]);
+
+  size_t shortread = 0;
 
   if (this->Compression == 0x00b1)
     {
     // Compute the size of the binary packed data
     size_t xinc = (xsize+1)/2;
     size_t yinc = (ysize+1)/2;
-    size_t zinc = (zsize+1)/2;
-    size = xinc*yinc*zinc + 1;
-    input = new char[size];
-    infile.read(input, size);
+    size_t zinc = (wholeZSize+1)/2;
+    size_t size = xinc*yinc*zinc + 1;
+
+    // only read the window of packed data that the requested slices
+    // use, so that a slab request only holds a slab's worth of data
+    size_t winStart = static_cast<size_t>(extent[4])*yinc*xinc;
+    size_t winEnd = (static_cast<size_t>(extent[5])*yinc + ysize)*xinc;
+    winStart = (winStart < size - 1 ? winStart : size - 1);
+    winEnd = (winEnd < size - 1 ? winEnd : size - 1);
+    char *input = new char[winEnd - winStart + 1];
+    infile.seekg(this->HeaderSize + winStart);
+    infile.read(input, winEnd - winStart);
+    shortread = (winEnd - winStart) - infile.gcount();
+
+    // the final byte holds the value to use for the "on" voxels
+    char lastByte = 0;
+    infile.seekg(this->HeaderSize + size - 1);
+    infile.read(&lastByte, 1);
+    shortread += 1 - infile.gcount();
+
+    // Unpack binary data, each byte becomes a 2x2x2 block of voxels,
+    // only the requested slices are unpacked
+    unsigned char v = static_cast<unsigned char>(lastByte);
+    v = (v == 0 ? 0x7f : v);
+    for (int i = extent[4]; i <= extent[5]; i++)
+      {
+      unsigned char bit = ((i & 1) << 2);
+      for (int j = 0; j < ysize; j++)
+        {
+        char *inPtr = input + ((i*yinc + j)*xinc - winStart);
+        bit ^= (bit & 1);
+        for (int k = 0; k < xsize; k++)
+          {
+          unsigned char c = *inPtr;
+          *dataPtr++ = ((c >> bit) & 1)*v;
+          inPtr += (bit & 1);
+          bit ^= 1;
+          }
+        bit ^= 2;
+        }
+      }
+
+    delete [] input;
     }
   else if (this->Compression == 0x00b2 ||
            this->Compression == 0x00c2)
@@ -1042,107 +1336,119 @@ int vtkScancoCTReader::RequestData(
     // Get the size of the compressed data
     char head[8];
     infile.read(head, intSize);
-    size = static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
+    size_t size = static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
     if (intSize == 8)
       {
       // Read the high word of a 64-bit int
       unsigned int high = vtkScancoCTReader::DecodeInt(head + 4);
       size += (static_cast<vtkTypeUInt64>(high) << 32);
       }
-    input = new char[size - intSize];
     size -= intSize;
-    infile.read(input, size);
-    }
 
-  // confirm that enough data was read
-  size_t shortread = size - infile.gcount();
-  if (shortread != 0)
-    {
-    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
-    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
-    }
+    // the run lengths are decompressed straight into the output volume,
+    // reading the compressed stream in chunks of bounded size and
+    // stopping as soon as the requested slices are complete
+    const size_t chunkSize = 65536;
+    char *input = new char[chunkSize];
 
-  // Close the file
-  infile.close();
+    bool flip = 0;
+    unsigned char values[2] = { 0, 0 };
+    if (this->Compression == 0x00b2)
+      {
+      // the two values for the binary run-lengths
+      infile.read(reinterpret_cast<char *>(values), 2);
+      size -= 2;
+      }
 
-  if (this->Compression == 0x00b1)
-    {
-    // Unpack binary data, each byte becomes a 2x2x2 block of voxels
-    size_t xinc = (xsize+1)/2;
-    size_t yinc = (ysize+1)/2;
-    unsigned char v = input[size-1];
-    v = (v == 0 ? 0x7f : v);
-    unsigned char bit = 0;
-    for (int i = 0; i < zsize; i++)
+    unsigned char v = values[flip];
+
+    // if the previous request ended where this one begins, resume
+    // the run-length decoding there instead of re-skipping runs from
+    // the top of the stream: a slab-by-slab sweep of the volume then
+    // reads the compressed data exactly once
+    unsigned int pendingRun = 0;
+    unsigned char pendingValue = 0;
+    if (this->ResumeSlice == extent[4] && extent[4] > wholeExtent[4])
       {
-      bit ^= (bit & 2);
-      for (int j = 0; j < ysize; j++)
+      infile.seekg(this->ResumePosition);
+      size = static_cast<size_t>(this->ResumeSize);
+      flip = this->ResumeFlip;
+      v = (this->Compression == 0x00b2 ? values[flip] : this->ResumeValue);
+      pendingRun = this->ResumeRunLength;
+      pendingValue = this->ResumeValue;
+      skipSize = 0;
+      }
+    this->ResumeSlice = -1;
+
+    // finish a run that was split at the end of the previous request
+    while (pendingRun > 0 && outSize > 0)
+      {
+      *dataPtr++ = pendingValue;
+      pendingRun--;
+      outSize--;
+      }
+
+    const char *inPtr = input;
+    const char *inEnd = input;
+    while (size > 0 && skipSize + outSize != 0)
+      {
+      size_t n = (size < chunkSize ? size : chunkSize);
+      if (this->Compression == 0x00c2)
         {
-        char *inPtr = input + (i*yinc + j)*xinc;
-        bit ^= (bit & 1);
-        for (int k = 0; k < xsize; k++)
+        // read whole (length, value) pairs
+        n -= (n & 1);
+        if (n == 0)
           {
-          unsigned char c = *inPtr;
-          *dataPtr++ = ((c >> bit) & 1)*v;
-          inPtr += (bit & 1);
-          bit ^= 1;
+          break;
           }
-        bit ^= 2;
         }
-      bit ^= 4;
-      }
-    }
-  else if (this->Compression == 0x00b2)
-    {
-    // Decompress binary run-lengths
-    bool flip = 0;
-    unsigned char v = input[flip];
-    char *inPtr = input + 2;
-    size -= 2;
-    if (size > 0)
-      {
-      do
+      infile.read(input, n);
+      size_t got = infile.gcount();
+      if (got != n)
+        {
+        shortread = size - got;
+        break;
+        }
+      size -= n;
+
+      inPtr = input;
+      inEnd = input + n;
+      while (inPtr != inEnd && skipSize + outSize != 0)
         {
-        unsigned char l = *inPtr++;
-        if (l == 255)
+        unsigned int l;
+        if (this->Compression == 0x00b2)
           {
-          l = 254;
-          flip = !flip;
+          // Decompress binary run-lengths
+          l = static_cast<unsigned char>(*inPtr++);
+          if (l == 255)
+            {
+            l = 254;
+            flip = !flip;
+            }
           }
-        if (l > outSize)
+        else
           {
-          l = outSize;
+          // Decompress 8-bit run-lengths
+          l = static_cast<unsigned char>(inPtr[0]);
+          v = static_cast<unsigned char>(inPtr[1]);
+          inPtr += 2;
           }
-        outSize -= l;
-        if (l > 0)
+
+        // consume the part of the run that precedes the update extent
+        if (skipSize > 0)
           {
-          do
-            {
-            *dataPtr++ = v;
-            }
-          while (--l);
+          unsigned int m = (l < skipSize ? l : static_cast<unsigned int>(skipSize));
+          skipSize -= m;
+          l -= m;
           }
-        flip = !flip;
-        v = input[flip];
-        }
-      while (--size != 0 && outSize != 0);
-      }
-    }
-  else if (this->Compression == 0x00c2)
-    {
-    // Decompress 8-bit run-lengths
-    char *inPtr = input;
-    size /= 2;
-    if (size > 0)
-      {
-      do
-        {
-        unsigned char l = inPtr[0];
-        unsigned char v = inPtr[1];
-        inPtr += 2;
+
         if (l > outSize)
           {
-          l = outSize;
+          // the run crosses the end of the update extent, save the
+          // remainder so that the next request can resume with it
+          pendingRun = l - static_cast<unsigned int>(outSize);
+          pendingValue = v;
+          l = static_cast<unsigned int>(outSize);
           }
         outSize -= l;
         if (l > 0)
@@ -1153,12 +1459,46 @@ int vtkScancoCTReader::RequestData(
             }
           while (--l);
           }
+
+        if (this->Compression == 0x00b2)
+          {
+          flip = !flip;
+          v = values[flip];
+          }
         }
-      while (--size != 0 && outSize != 0);
       }
+
+    // remember where this request ended, so that a request for the
+    // slices that follow can pick up the decoding from here
+    if (shortread == 0 && skipSize + outSize == 0 &&
+        extent[5] < wholeExtent[5])
+      {
+      this->ResumeSlice = extent[5] + 1;
+      this->ResumePosition =
+        static_cast<vtkTypeInt64>(infile.tellg()) - (inEnd - inPtr);
+      this->ResumeSize = size + (inEnd - inPtr);
+      this->ResumeFlip = flip;
+      this->ResumeValue = (pendingRun > 0 ? pendingValue : v);
+      this->ResumeRunLength = pendingRun;
+      }
+
+    delete [] input;
+    }
+
+  // confirm that enough data was read
+  if (shortread != 0)
+    {
+    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
     }
 
-  delete [] input;
+  // Close the file
+  infile.close();
+
+  if (this->GenerateLODs && shortread == 0)
+    {
+    this->GenerateLODOutputs(outputVector);
+    }
 
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
@@ -192,6 +192,31 @@ public:
   // Get the raw header information (512 bytes) from the file.
   void *GetRawHeader() { return this->RawHeader; }
 
+  // Description:
+  // Request large ("huge") page backing for the output (default: Off).
+  // When this is on, the output voxels are allocated with an
+  // allocator that asks the operating system to back the buffer with
+  // large pages, which reduces address-translation overhead when a
+  // multi-gigabyte scan is swept by later processing passes.  The
+  // request is a hint: if large pages are not available, ordinary
+  // pages are silently used instead.
+  vtkGetMacro(HugePages, int);
+  vtkSetMacro(HugePages, int);
+  vtkBooleanMacro(HugePages, int);
+
+  // Description:
+  // Generate a low-resolution pyramid during the read (default: Off).
+  // When this is on, output ports 1, 2, and 3 of the reader provide
+  // the volume downsampled by factors of 2, 4, and 8 along each axis,
+  // averaged with a box filter while the full volume on output port 0
+  // is produced.  This makes an overview available for rendering after
+  // a single pass, without re-reading a file that may be tens of
+  // gigabytes.  Update output port 0 first: the pyramid is filled in
+  // during the same request, but only when the full extent is read.
+  vtkGetMacro(GenerateLODs, int);
+  vtkSetMacro(GenerateLODs, int);
+  vtkBooleanMacro(GenerateLODs, int);
+
 protected:
   vtkScancoCTReader();
   ~vtkScancoCTReader();
@@ -208,6 +233,10 @@ protected:
     vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector);
 
+  // Description:
+  // Generate the downsampled pyramid outputs from output port zero.
+  void GenerateLODOutputs(vtkInformationVector *outputVector);
+
   // Description:
   // Initialize the header information
   void InitializeHeader();
@@ -287,6 +316,22 @@ protected:
   // The compression mode, if any.
   int Compression;
 
+  // Whether to request large pages for the output buffer.
+  int HugePages;
+
+  // Whether to generate the downsampled pyramid outputs.
+  int GenerateLODs;
+
+  // State for resuming a streamed read of compressed data, so that
+  // sequential slab requests decode the run lengths in one linear
+  // pass instead of re-skipping from the top of the file each time.
+  vtkTypeInt64 ResumePosition;
+  vtkTypeInt64 ResumeSize;
+  int ResumeSlice;
+  unsigned int ResumeRunLength;
+  unsigned char ResumeValue;
+  bool ResumeFlip;
+
 private:
   vtkScancoCTReader(const vtkScancoCTReader&);  // Not implemented.
   void operator=(const vtkScancoCTReader&);  // Not implemented.
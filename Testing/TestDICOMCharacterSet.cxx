@@ -118,6 +118,28 @@ int main(int argc, char *argv[])
     }
   }
 
+  { // test cached conversion of values stored in metadata
+  for (int i = 0; ClunieText[i][0] != 0; i++)
+    {
+    std::string name = ClunieText[i][0];
+    std::string utf = ClunieText[i][1];
+    std::string raw = ClunieText[i][2];
+    vtkSmartPointer<vtkDICOMMetaData> meta =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    meta->SetAttributeValue(DC::SpecificCharacterSet, name);
+    meta->SetAttributeValue(DC::PatientName, raw);
+    std::string s = meta->GetAttributeValueAsUTF8(DC::PatientName);
+    TestAssert(s == utf);
+    // the second conversion comes from the cache
+    std::string t = meta->GetAttributeValueAsUTF8(DC::PatientName);
+    TestAssert(t == utf);
+    // modifying the data set discards the cache
+    meta->SetAttributeValue(DC::PatientName, raw);
+    std::string u = meta->GetAttributeValueAsUTF8(DC::PatientName);
+    TestAssert(u == utf);
+    }
+  }
+
   { // test storing multiple values in their native encoding in metadata
   for (int i = 0; ClunieText[i][0] != 0; i++)
     {
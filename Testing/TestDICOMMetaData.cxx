@@ -5,6 +5,9 @@
 #include "vtkDICOMItem.h"
 #include "vtkDICOMTagPath.h"
 
+#include <vtkIntArray.h>
+#include <vtkStringArray.h>
+
 #include <sstream>
 
 #include <string.h>
@@ -176,6 +179,29 @@ int main(int argc, char *argv[])
   TestAssert(iter == metaData->End());
   metaData->Clear();
 
+  // test columnar extraction of values for all instances
+  metaData->SetNumberOfInstances(3);
+  metaData->SetAttributeValue(0, DC::InstanceNumber, 3);
+  metaData->SetAttributeValue(1, DC::InstanceNumber, 2);
+  metaData->SetAttributeValue(2, DC::InstanceNumber, 1);
+  metaData->SetAttributeValue(DC::Modality, "CT");
+  vtkStringArray *column = vtkStringArray::New();
+  TestAssert(metaData->GetAttributeValues(DC::Modality, column));
+  TestAssert(column->GetNumberOfValues() == 3);
+  TestAssert(column->GetValue(0) == "CT");
+  TestAssert(column->GetValue(2) == "CT");
+  TestAssert(!metaData->GetAttributeValues(DC::StudyDate, column));
+  TestAssert(column->GetValue(1) == "");
+  column->Delete();
+  vtkIntArray *icolumn = vtkIntArray::New();
+  TestAssert(metaData->GetAttributeValues(DC::InstanceNumber, icolumn));
+  TestAssert(icolumn->GetNumberOfTuples() == 3);
+  TestAssert(icolumn->GetValue(0) == 3);
+  TestAssert(icolumn->GetValue(1) == 2);
+  TestAssert(icolumn->GetValue(2) == 1);
+  icolumn->Delete();
+  metaData->Clear();
+
   // ------
   // test sequence access: some miscellaneous UIDs to use
   const char *classUID = "1.2.840.10008.5.1.4.1.1.4";
@@ -302,6 +328,29 @@ int main(int argc, char *argv[])
       "1.2.840.113619.2.176.2025.4110284.7408.1276101323.263"));
     }
 
+  // resolve a path to the item that contains the final tag, so that
+  // the item can be queried directly for repeated access
+  const vtkDICOMItem *itemptr = metaData->FindItem(
+    vtkDICOMTagPath(DC::ReferencedSeriesSequence, 0,
+                    DC::ReferencedInstanceSequence, 9,
+                    DC::ReferencedSOPClassUID));
+  TestAssert(itemptr != 0);
+  if (itemptr)
+    {
+    v2 = itemptr->GetAttributeValue(DC::ReferencedSOPClassUID);
+    TestAssert(v2.GetCharData() != 0);
+    if (v2.GetCharData())
+      {
+      TestAssert(strcmp(v2.GetCharData(), "1.2.840.10008.5.1.4.1.1.4") == 0);
+      }
+    }
+
+  // a path that cannot be resolved gives a null pointer
+  itemptr = metaData->FindItem(
+    vtkDICOMTagPath(DC::ReferencedSeriesSequence, 1,
+                    DC::SeriesInstanceUID));
+  TestAssert(itemptr == 0);
+
   metaData->Clear();
 
   // ------
@@ -349,6 +398,19 @@ int main(int argc, char *argv[])
                     DC::RealWorldValueLastValueMapped));
   TestAssert(v2.GetVR() == vtkDICOMVR::SS);
 
+  // three levels deep
+  metaData->SetAttributeValue(
+    vtkDICOMTagPath(DC::IconImageSequence, 0,
+                    DC::IconImageSequence, 0,
+                    DC::RealWorldValueMappingSequence, 0,
+                    DC::RealWorldValueLastValueMapped), 4095);
+  v2 = metaData->GetAttributeValue(
+    vtkDICOMTagPath(DC::IconImageSequence, 0,
+                    DC::IconImageSequence, 0,
+                    DC::RealWorldValueMappingSequence, 0,
+                    DC::RealWorldValueLastValueMapped));
+  TestAssert(v2.GetVR() == vtkDICOMVR::SS);
+
   metaData->Clear();
 
   // check inheritance of ISO_IR_100
@@ -556,12 +618,123 @@ int main(int argc, char *argv[])
   TestAssert(mcopy->GetAttributeValue(
     DC::AcquisitionDateTime).AsString() == acquisitionTime);
 
+  // modifying the copy must not modify the original (copy-on-write)
+  mcopy->SetAttributeValue(1, DC::Modality, "US");
+  TestAssert(mcopy->GetAttributeValue(1, DC::Modality).AsString() == "US");
+  TestAssert(mcopy->GetAttributeValue(0, DC::Modality).AsString() == "MR");
+  TestAssert(metaData->GetAttributeValue(1, DC::Modality).AsString() == "CT");
+  TestAssert(metaData->GetAttributeValue(0, DC::Modality).AsString() == "MR");
+
   mcopy->Initialize();
   metaData->DeepCopy(mcopy);
   TestAssert(metaData->GetNumberOfInstances() == 1);
   TestAssert(metaData->GetNumberOfDataElements() == 0);
   mcopy->Delete();
 
+  // ------
+  // Test SaveSnapshot and LoadSnapshot
+  metaData->Initialize();
+  metaData->SetNumberOfInstances(3);
+  metaData->SetAttributeValue(DC::Modality, "CT");
+  metaData->SetAttributeValue(0, DC::InstanceNumber, 1);
+  metaData->SetAttributeValue(1, DC::InstanceNumber, 2);
+  metaData->SetAttributeValue(2, DC::InstanceNumber, 3);
+  metaData->SetAttributeValue(DC::AcquisitionDateTime, acquisitionTime);
+  vtkDICOMItem item;
+  item.SetAttributeValue(DC::CodeValue, "T-11170");
+  item.SetAttributeValue(DC::CodingSchemeDesignator, "SNM3");
+  vtkDICOMSequence seq(1);
+  seq.SetItem(0, item);
+  metaData->SetAttributeValue(DC::AnatomicRegionSequence, seq);
+
+  std::vector<unsigned char> snapshot;
+  metaData->SaveSnapshot(&snapshot);
+  TestAssert(snapshot.size() > 20);
+
+  vtkDICOMMetaData *msnap = vtkDICOMMetaData::New();
+  TestAssert(msnap->LoadSnapshot(&snapshot[0], snapshot.size()));
+  TestAssert(msnap->GetNumberOfInstances() == 3);
+  TestAssert(msnap->GetNumberOfDataElements() == 4);
+  TestAssert(msnap->GetAttributeValue(DC::Modality).AsString() == "CT");
+  TestAssert(msnap->GetAttributeValue(0, DC::InstanceNumber).AsInt() == 1);
+  TestAssert(msnap->GetAttributeValue(1, DC::InstanceNumber).AsInt() == 2);
+  TestAssert(msnap->GetAttributeValue(2, DC::InstanceNumber).AsInt() == 3);
+  TestAssert(msnap->GetAttributeValue(
+    DC::AcquisitionDateTime).AsString() == acquisitionTime);
+  TestAssert(msnap->GetAttributeValue(vtkDICOMTagPath(
+    DC::AnatomicRegionSequence, 0, DC::CodeValue)).AsString() == "T-11170");
+
+  // a truncated snapshot must fail and leave the object empty
+  TestAssert(!msnap->LoadSnapshot(&snapshot[0], snapshot.size() - 1));
+  TestAssert(msnap->GetNumberOfDataElements() == 0);
+  msnap->Delete();
+
+  // ------
+  // Test CopyInstanceRange
+  vtkDICOMMetaData *shard = vtkDICOMMetaData::New();
+  shard->CopyInstanceRange(metaData, 1, 2);
+  TestAssert(shard->GetNumberOfInstances() == 2);
+  TestAssert(shard->GetNumberOfDataElements() == 4);
+  TestAssert(shard->GetAttributeValue(DC::Modality).AsString() == "CT");
+  TestAssert(shard->GetAttributeValue(0, DC::InstanceNumber).AsInt() == 2);
+  TestAssert(shard->GetAttributeValue(1, DC::InstanceNumber).AsInt() == 3);
+
+  // modifying the shard must not modify the original (copy-on-write)
+  shard->SetAttributeValue(0, DC::InstanceNumber, 5);
+  TestAssert(shard->GetAttributeValue(0, DC::InstanceNumber).AsInt() == 5);
+  TestAssert(metaData->GetAttributeValue(1, DC::InstanceNumber).AsInt() == 2);
+
+  // a single-instance shard does not need per-instance values
+  shard->CopyInstanceRange(metaData, 2, 1);
+  TestAssert(shard->GetNumberOfInstances() == 1);
+  TestAssert(shard->GetAttributeValue(DC::InstanceNumber).AsInt() == 3);
+
+  // the range is clamped to the instances that actually exist
+  shard->CopyInstanceRange(metaData, 1, 5);
+  TestAssert(shard->GetNumberOfInstances() == 2);
+  TestAssert(shard->GetAttributeValue(1, DC::InstanceNumber).AsInt() == 3);
+  shard->Delete();
+
+  // ------
+  // Test Diff and Hash
+  vtkDICOMMetaData *mdiff = vtkDICOMMetaData::New();
+  mdiff->DeepCopy(metaData);
+  std::vector<vtkDICOMTag> dtags;
+  metaData->Diff(mdiff, &dtags);
+  TestAssert(dtags.size() == 0);
+  TestAssert(metaData->Hash() == mdiff->Hash());
+
+  // a changed value must be reported, and must change the hash
+  mdiff->SetAttributeValue(DC::Modality, "MR");
+  metaData->Diff(mdiff, &dtags);
+  TestAssert(dtags.size() == 1);
+  TestAssert(dtags[0] == vtkDICOMTag(DC::Modality));
+  TestAssert(metaData->Hash() != mdiff->Hash());
+
+  // a tag present in only one of the objects must be reported
+  mdiff->SetAttributeValue(DC::Modality, "CT");
+  mdiff->RemoveAttribute(DC::AcquisitionDateTime);
+  mdiff->SetAttributeValue(DC::PatientName, "Doe^John");
+  metaData->Diff(mdiff, &dtags);
+  TestAssert(dtags.size() == 2);
+  TestAssert(dtags[0] == vtkDICOMTag(DC::AcquisitionDateTime));
+  TestAssert(dtags[1] == vtkDICOMTag(DC::PatientName));
+  TestAssert(metaData->Hash() != mdiff->Hash());
+
+  // a difference within a sequence reports the sequence tag
+  mdiff->DeepCopy(metaData);
+  vtkDICOMItem item2;
+  item2.SetAttributeValue(DC::CodeValue, "T-11171");
+  item2.SetAttributeValue(DC::CodingSchemeDesignator, "SNM3");
+  vtkDICOMSequence seq2(1);
+  seq2.SetItem(0, item2);
+  mdiff->SetAttributeValue(DC::AnatomicRegionSequence, seq2);
+  metaData->Diff(mdiff, &dtags);
+  TestAssert(dtags.size() == 1);
+  TestAssert(dtags[0] == vtkDICOMTag(DC::AnatomicRegionSequence));
+  TestAssert(metaData->Hash() != mdiff->Hash());
+  mdiff->Delete();
+
   metaData->Delete();
 
   return rval;
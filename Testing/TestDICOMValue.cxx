@@ -2,6 +2,10 @@
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
 
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkStringArray.h>
+
 #include <sstream>
 
 #include <string.h>
@@ -44,6 +48,16 @@ int main(int argc, char *argv[])
   TestAssert(v.GetVL() == 12); // padded to even
   }
 
+  { // test swap
+  const char *sp = "HELLO\\THERE";
+  vtkDICOMValue v = vtkDICOMValue(vtkDICOMVR::CS, sp, strlen(sp));
+  vtkDICOMValue u;
+  u.Swap(v);
+  TestAssert(!v.IsValid());
+  TestAssert(u.IsValid());
+  TestAssert(strcmp(u.GetCharData(), "HELLO\\THERE ") == 0);
+  }
+
   { // test constructors and number of values
   vtkDICOMValue v;
   // backslash-separated values
@@ -612,5 +626,43 @@ int main(int argc, char *argv[])
   TestAssert(v.Matches(u));
   }
 
+  { // test bulk copy of the values into VTK arrays
+  static const double dbl[3] = { 1.25, -2.5, 3.0 };
+  v = vtkDICOMValue(vtkDICOMVR::FD, dbl, 3);
+  vtkDoubleArray *da = vtkDoubleArray::New();
+  TestAssert(v.GetValues(da));
+  TestAssert(da->GetNumberOfTuples() == 3);
+  TestAssert(da->GetValue(0) == 1.25);
+  TestAssert(da->GetValue(1) == -2.5);
+  TestAssert(da->GetValue(2) == 3.0);
+  da->Delete();
+
+  // conversion to a different numeric type
+  v = vtkDICOMValue(vtkDICOMVR::DS, "1.5\\2.75");
+  vtkFloatArray *fa = vtkFloatArray::New();
+  TestAssert(v.GetValues(fa));
+  TestAssert(fa->GetNumberOfTuples() == 2);
+  TestAssert(fa->GetValue(0) == 1.5f);
+  TestAssert(fa->GetValue(1) == 2.75f);
+  fa->Delete();
+
+  // conversion of each value to a string
+  v = vtkDICOMValue(vtkDICOMVR::IS, "5\\13\\21");
+  vtkStringArray *sa = vtkStringArray::New();
+  TestAssert(v.GetValues(sa));
+  TestAssert(sa->GetNumberOfValues() == 3);
+  TestAssert(sa->GetValue(0) == "5");
+  TestAssert(sa->GetValue(1) == "13");
+  TestAssert(sa->GetValue(2) == "21");
+  sa->Delete();
+
+  // an empty value produces an empty array
+  v = vtkDICOMValue();
+  vtkDoubleArray *ea = vtkDoubleArray::New();
+  TestAssert(v.GetValues(ea));
+  TestAssert(ea->GetNumberOfTuples() == 0);
+  ea->Delete();
+  }
+
   return rval;
 }
@@ -0,0 +1,364 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2016 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDICOMCharacterSet.h"
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMDictionary.h"
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMFilePath.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMReader.h"
+#include "vtkDICOMValue.h"
+
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+#include <vtkTimerLog.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+// An accumulator that keeps the compiler from optimizing away the
+// operations that are being timed.
+static volatile unsigned int benchmarkSink;
+
+// remove path portion of filename
+const char *fileBasename(const char *filename)
+{
+  const char *cp = filename + strlen(filename);
+  while (cp != filename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  return cp;
+}
+
+// print one result line, "n" is the number of items processed
+void benchmarkReport(const char *name, double t, double n, const char *unit)
+{
+  printf("%-24s %10.2f ms  %12.0f %s/s\n", name, t*1000.0, n/t, unit);
+  fflush(stdout);
+}
+
+// Generate a synthetic CT series of the given dimensions, append the
+// file names to the supplied array.  Returns false if writing fails.
+bool benchmarkGenerateSeries(
+  const std::string& dirname, int cols, int rows, int slices,
+  vtkStringArray *fileNames)
+{
+  if (vtkDICOMFileDirectory::Create(dirname.c_str()) !=
+      vtkDICOMFileDirectory::Good)
+    {
+    fprintf(stderr, "Error: Cannot create directory: %s\n", dirname.c_str());
+    return false;
+    }
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->SetNumberOfInstances(slices);
+
+  meta->SetAttributeValue(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.2");
+  meta->SetAttributeValue(DC::Modality, "CT");
+  meta->SetAttributeValue(DC::PatientName, "Benchmark^Synthetic");
+  meta->SetAttributeValue(DC::PatientID, "BM0001");
+  meta->SetAttributeValue(DC::StudyDate, "20160101");
+  meta->SetAttributeValue(DC::StudyTime, "120000");
+  meta->SetAttributeValue(DC::SeriesNumber, 1);
+  meta->SetAttributeValue(DC::ImageOrientationPatient, "1\\0\\0\\0\\1\\0");
+  meta->SetAttributeValue(DC::PixelSpacing, "1.0\\1.0");
+  meta->SetAttributeValue(DC::SliceThickness, "1.0");
+  meta->SetAttributeValue(DC::SamplesPerPixel, 1);
+  meta->SetAttributeValue(DC::PhotometricInterpretation, "MONOCHROME2");
+  meta->SetAttributeValue(DC::Rows, rows);
+  meta->SetAttributeValue(DC::Columns, cols);
+  meta->SetAttributeValue(DC::BitsAllocated, 16);
+  meta->SetAttributeValue(DC::BitsStored, 16);
+  meta->SetAttributeValue(DC::HighBit, 15);
+  meta->SetAttributeValue(DC::PixelRepresentation, 1);
+  meta->SetAttributeValue(DC::RescaleIntercept, "-1024");
+  meta->SetAttributeValue(DC::RescaleSlope, "1");
+  // an empty value, the compiler writes the data after the header
+  unsigned short empty = 0;
+  meta->SetAttributeValue(
+    DC::PixelData, vtkDICOMValue(vtkDICOMVR::OW, &empty, 0));
+
+  for (int i = 0; i < slices; i++)
+    {
+    char text[64];
+    meta->SetAttributeValue(i, DC::InstanceNumber, i + 1);
+    sprintf(text, "0\\0\\%d", i);
+    meta->SetAttributeValue(i, DC::ImagePositionPatient, text);
+    sprintf(text, "%d", i);
+    meta->SetAttributeValue(i, DC::SliceLocation, text);
+    }
+
+  // deterministic pixel values, a gradient plus a per-slice offset
+  vtkIdType sliceSize = static_cast<vtkIdType>(cols)*rows;
+  std::vector<short> pixels(sliceSize);
+
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetMetaData(meta);
+
+  vtkDICOMFilePath outpath(dirname);
+  for (int i = 0; i < slices; i++)
+    {
+    short *p = &pixels[0];
+    for (int y = 0; y < rows; y++)
+      {
+      for (int x = 0; x < cols; x++)
+        {
+        *p++ = static_cast<short>(((x + y + 4*i) & 0x0fff) - 1024);
+        }
+      }
+
+    char fname[32];
+    sprintf(fname, "IM-0001-%04d.dcm", i + 1);
+    std::string fullname = outpath.Join(fname);
+    compiler->SetFileName(fullname.c_str());
+    compiler->SetIndex(i);
+    compiler->WriteHeader();
+    compiler->WritePixelData(
+      reinterpret_cast<unsigned char *>(&pixels[0]), 2*sliceSize);
+    compiler->Close();
+    if (compiler->GetErrorCode() != 0)
+      {
+      fprintf(stderr, "Error: Cannot write file: %s\n", fullname.c_str());
+      return false;
+      }
+    fileNames->InsertNextValue(fullname);
+    }
+
+  return true;
+}
+
+// time the registration of the built-in private dictionaries, which
+// is deferred to the first private dictionary lookup (it used to run
+// as a static initializer before main() in every process)
+void benchmarkPrivateDictionary()
+{
+  const int n = 100000;
+
+  // the first lookup registers all of the built-in dictionaries
+  double t0 = vtkTimerLog::GetUniversalTime();
+  vtkDICOMDictionary::Dict *dict =
+    vtkDICOMDictionary::FindPrivateDict("GEMS_ACQU_01");
+  double t1 = vtkTimerLog::GetUniversalTime();
+  benchmarkSink += (dict != 0);
+
+  benchmarkReport("PrivateDictFirstUse", t1 - t0, 1.0, "registrations");
+
+  // subsequent lookups only pay for a hash probe
+  t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    dict = vtkDICOMDictionary::FindPrivateDict("GEMS_ACQU_01");
+    benchmarkSink += (dict != 0);
+    }
+  t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("PrivateDictLookup", t1 - t0, n, "lookups");
+}
+
+// time the construction of vtkDICOMValue objects
+void benchmarkValueConstruction()
+{
+  const int n = 1000000;
+  const double doubles[3] = { -104.5, -104.5, 71.3 };
+  const short shorts[6] = { 1, 0, 0, 0, 1, 0 };
+
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    vtkDICOMValue v1(vtkDICOMVR::DS, 1.0 + i);
+    vtkDICOMValue v2(vtkDICOMVR::FD, doubles, 3);
+    vtkDICOMValue v3(vtkDICOMVR::SS, shorts, 6);
+    vtkDICOMValue v4(vtkDICOMVR::SH, "Benchmark");
+    benchmarkSink += static_cast<unsigned int>(
+      v1.GetNumberOfValues() + v2.GetNumberOfValues() +
+      v3.GetNumberOfValues() + v4.GetNumberOfValues());
+    }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("ValueConstruction", t1 - t0, 4.0*n, "values");
+}
+
+// time the conversion of text to utf-8
+void benchmarkCharacterSetConversion()
+{
+  const int n = 100000;
+  // latin1 text with accented characters
+  const char *latin1 = "D\xfcsseldorf^Gr\xf6\xdf""e^\xc9""cole^Fran\xe7""ois";
+  size_t latin1Len = strlen(latin1);
+  // japanese text in iso-2022-jp (from DICOM PS3.5 H.3)
+  const char *jp = "\033$B;3ED\033(B^\033$BB@O:\033(B";
+  size_t jpLen = strlen(jp);
+
+  vtkDICOMCharacterSet cs1(vtkDICOMCharacterSet::ISO_IR_100);
+  vtkDICOMCharacterSet cs2(vtkDICOMCharacterSet::ISO_2022_IR_87);
+
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    std::string s1 = cs1.ConvertToUTF8(latin1, latin1Len);
+    std::string s2 = cs2.ConvertToUTF8(jp, jpLen);
+    benchmarkSink += static_cast<unsigned int>(s1.length() + s2.length());
+    }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("CharacterSetToUTF8", t1 - t0, 2.0*n, "strings");
+}
+
+// time the parsing of the meta data of a series
+void benchmarkParser(vtkStringArray *fileNames)
+{
+  const int n = 10;
+  vtkIdType m = fileNames->GetNumberOfValues();
+
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  parser->SetMetaData(meta);
+
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    for (vtkIdType j = 0; j < m; j++)
+      {
+      meta->Clear();
+      parser->SetFileName(fileNames->GetValue(j).c_str());
+      parser->Update();
+      benchmarkSink += static_cast<unsigned int>(
+        meta->GetNumberOfDataElements());
+      }
+    }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("ParserReadFile", t1 - t0, 1.0*n*m, "files");
+}
+
+// time the loading of a full volume
+void benchmarkReader(vtkStringArray *fileNames)
+{
+  const int n = 5;
+  double voxels = 0.0;
+
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    // a fresh reader each pass, so that nothing is cached
+    vtkSmartPointer<vtkDICOMReader> reader =
+      vtkSmartPointer<vtkDICOMReader>::New();
+    reader->SetFileNames(fileNames);
+    reader->Update();
+    voxels += reader->GetOutput()->GetNumberOfPoints();
+    benchmarkSink += static_cast<unsigned int>(
+      reader->GetOutput()->GetNumberOfPoints());
+    }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("ReaderLoadVolume", t1 - t0, voxels, "voxels");
+}
+
+// time the scan of a directory of dicom files
+void benchmarkDirectory(const std::string& dirname, vtkIdType numFiles)
+{
+  const int n = 5;
+
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < n; i++)
+    {
+    // a fresh finder each pass, so that nothing is cached
+    vtkSmartPointer<vtkDICOMDirectory> finder =
+      vtkSmartPointer<vtkDICOMDirectory>::New();
+    finder->SetDirectoryName(dirname.c_str());
+    finder->Update();
+    benchmarkSink += static_cast<unsigned int>(finder->GetNumberOfSeries());
+    }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  benchmarkReport("DirectoryScan", t1 - t0, 1.0*n*numFiles, "files");
+}
+
+// This program times the hot paths of the library with synthetic
+// data, so that performance can be compared across releases.  The
+// data files are generated in the given scratch directory (or in
+// ./BenchmarkData) and are removed when the benchmarks finish.
+int main(int argc, char *argv[])
+{
+  const char *exename = fileBasename(argc > 0 ? argv[0] : "");
+
+  if (argc > 2 ||
+      (argc == 2 && (strcmp(argv[1], "--help") == 0 ||
+                     strcmp(argv[1], "--version") == 0)))
+    {
+    printf("usage: %s [scratch_directory]\n", exename);
+    return (argc > 2);
+    }
+
+  std::string scratch = (argc == 2 ? argv[1] : "BenchmarkData");
+
+  // the in-memory benchmarks need no data files; the dictionary
+  // benchmark must run first so that it sees the first-use cost
+  benchmarkPrivateDictionary();
+  benchmarkValueConstruction();
+  benchmarkCharacterSetConversion();
+
+  // one series of moderate size for the parser and reader
+  vtkSmartPointer<vtkStringArray> volumeFiles =
+    vtkSmartPointer<vtkStringArray>::New();
+  vtkDICOMFilePath scratchPath(scratch);
+  if (!benchmarkGenerateSeries(
+        scratchPath.Join("Series001"), 256, 256, 16, volumeFiles))
+    {
+    return 1;
+    }
+
+  // several small series for the directory scan
+  vtkSmartPointer<vtkStringArray> scanFiles =
+    vtkSmartPointer<vtkStringArray>::New();
+  for (int i = 0; i < 4; i++)
+    {
+    char dname[32];
+    sprintf(dname, "Scan%03d", i + 1);
+    if (!benchmarkGenerateSeries(
+          scratchPath.Join(dname), 64, 64, 16, scanFiles))
+      {
+      return 1;
+      }
+    }
+
+  benchmarkParser(volumeFiles);
+  benchmarkReader(volumeFiles);
+  benchmarkDirectory(
+    scratch, volumeFiles->GetNumberOfValues() +
+    scanFiles->GetNumberOfValues());
+
+  // remove the generated files
+  for (vtkIdType i = 0; i < volumeFiles->GetNumberOfValues(); i++)
+    {
+    vtkDICOMFile::Remove(volumeFiles->GetValue(i).c_str());
+    }
+  for (vtkIdType i = 0; i < scanFiles->GetNumberOfValues(); i++)
+    {
+    vtkDICOMFile::Remove(scanFiles->GetValue(i).c_str());
+    }
+
+  return 0;
+}
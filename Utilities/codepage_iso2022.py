@@ -51,13 +51,42 @@ else:
                 else:
                     m[c1] = c2
 
-for k in range(94*94):
-    u = 0xFFFD
-    try:
-        u = m[k]
-    except KeyError:
-        pass
+# build the two-level table: the first level has one entry per row,
+# giving the span of assigned columns within the row and the position
+# of that span in the packed second-level array
+rows = []
+data = []
+for a in range(94):
+    row = []
+    for b in range(94):
+        u = 0xFFFD
+        try:
+            u = m[a*94+b]
+        except KeyError:
+            pass
+        row.append(u)
+    nz = [b for b in range(94) if row[b] != 0xFFFD]
+    if nz:
+        rows.append((nz[0], nz[-1]+1, len(data)))
+        data = data + row[nz[0]:nz[-1]+1]
+    else:
+        rows.append((0, 0, 0))
+
+# print the first-level table of CodePageRow entries
+line = '  '
+for r in rows:
+    entry = "{ %d, %d, %d }," % r
+    if len(line) + len(entry) > 78:
+        sys.stdout.write(line.rstrip() + '\n')
+        line = '  '
+    line = line + entry + ' '
+sys.stdout.write(line.rstrip() + '\n\n')
+
+# print the packed second-level table (its size goes to stderr,
+# since it is needed for the array declaration)
+sys.stderr.write("packed table size: %d\n" % len(data))
+for k in range(len(data)):
     s = ' '
-    if ((k+1) % 9 == 0):
+    if ((k+1) % 9 == 0 or k+1 == len(data)):
         s = '\n'
-    sys.stdout.write("0x%4.4X,%s" % (u,s))
+    sys.stdout.write("0x%4.4X,%s" % (data[k],s))